@@ -75,6 +75,8 @@ bool Epub::parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata) {
   bookMetadata.author = opfParser.author;
   bookMetadata.coverItemHref = opfParser.coverItemHref;
   bookMetadata.textReferenceHref = opfParser.textReferenceHref;
+  bookMetadata.language = opfParser.language;
+  bookMetadata.fontHrefs = opfParser.fontHrefs;
 
   if (!opfParser.tocNcxPath.empty()) {
     tocNcxItem = opfParser.tocNcxPath;
@@ -245,6 +247,12 @@ void Epub::setupCacheDir() const {
     return;
   }
 
+  // Create the shard folder along with it
+  for (size_t i = 1; i < cachePath.length(); i++) {
+    if (cachePath[i] == '/') {
+      SdMan.mkdir(cachePath.substr(0, i).c_str());
+    }
+  }
   SdMan.mkdir(cachePath.c_str());
 }
 
@@ -270,6 +278,31 @@ const std::string& Epub::getAuthor() const {
   return bookMetadataCache->coreMetadata.author;
 }
 
+const std::string& Epub::getLanguage() const {
+  static std::string blank;
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    return blank;
+  }
+
+  return bookMetadataCache->coreMetadata.language;
+}
+
+std::vector<std::string> Epub::getFontHrefs() const {
+  std::vector<std::string> hrefs;
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    return hrefs;
+  }
+
+  const std::string& fontHrefs = bookMetadataCache->coreMetadata.fontHrefs;
+  size_t start = 0;
+  size_t end;
+  while ((end = fontHrefs.find('\n', start)) != std::string::npos) {
+    hrefs.push_back(fontHrefs.substr(start, end - start));
+    start = end + 1;
+  }
+  return hrefs;
+}
+
 std::string Epub::getCoverBmpPath() const { return cachePath + "/cover.bmp"; }
 
 bool Epub::generateCoverBmp() const {
@@ -397,6 +430,15 @@ BookMetadataCache::TocEntry Epub::getTocItem(const int tocIndex) const {
   return bookMetadataCache->getTocEntry(tocIndex);
 }
 
+bool Epub::getTocTitles(const int firstTocIndex, const int count, BookMetadataCache::TocTitleRange& range) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    Serial.printf("[%lu] [EBP] getTocTitles called but cache not loaded\n", millis());
+    return false;
+  }
+
+  return bookMetadataCache->readTocTitles(firstTocIndex, count, range);
+}
+
 int Epub::getTocItemsCount() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
     return 0;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <FsHelpers.h>
 #include <Print.h>
 
 #include <memory>
@@ -30,7 +31,7 @@ class Epub {
  public:
   explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
     // create a cache key based on the filepath
-    cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
+    cachePath = FsHelpers::bookCachePath(cacheDir, "epub", this->filepath);
   }
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
@@ -41,6 +42,8 @@ class Epub {
   const std::string& getPath() const;
   const std::string& getTitle() const;
   const std::string& getAuthor() const;
+  const std::string& getLanguage() const;
+  std::vector<std::string> getFontHrefs() const;
   std::string getCoverBmpPath() const;
   bool generateCoverBmp() const;
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
@@ -49,6 +52,7 @@ class Epub {
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
+  bool getTocTitles(int firstTocIndex, int count, BookMetadataCache::TocTitleRange& range) const;
   int getSpineItemsCount() const;
   int getTocItemsCount() const;
   int getSpineIndexForTocIndex(int tocIndex) const;
@@ -4,12 +4,13 @@
 #include <Serialization.h>
 #include <ZipFile.h>
 
+#include <cstring>
 #include <vector>
 
 #include "FsHelpers.h"
 
 namespace {
-constexpr uint8_t BOOK_CACHE_VERSION = 3;
+constexpr uint8_t BOOK_CACHE_VERSION = 5;
 constexpr char bookBinFile[] = "/book.bin";
 constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
 constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
@@ -88,7 +89,8 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   constexpr uint32_t headerASize =
       sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) + sizeof(spineCount) + sizeof(tocCount);
   const uint32_t metadataSize = metadata.title.size() + metadata.author.size() + metadata.coverItemHref.size() +
-                                metadata.textReferenceHref.size() + sizeof(uint32_t) * 4;
+                                metadata.textReferenceHref.size() + metadata.language.size() +
+                                metadata.fontHrefs.size() + sizeof(uint32_t) * 6;
   const uint32_t lutSize = sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
   const uint32_t lutOffset = headerASize + metadataSize;
 
@@ -102,6 +104,8 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   serialization::writeString(bookFile, metadata.author);
   serialization::writeString(bookFile, metadata.coverItemHref);
   serialization::writeString(bookFile, metadata.textReferenceHref);
+  serialization::writeString(bookFile, metadata.language);
+  serialization::writeString(bookFile, metadata.fontHrefs);
 
   // Loop through spine entries, writing LUT positions
   spineFile.seek(0);
@@ -291,12 +295,36 @@ bool BookMetadataCache::load() {
   serialization::readString(bookFile, coreMetadata.author);
   serialization::readString(bookFile, coreMetadata.coverItemHref);
   serialization::readString(bookFile, coreMetadata.textReferenceHref);
+  serialization::readString(bookFile, coreMetadata.language);
+  serialization::readString(bookFile, coreMetadata.fontHrefs);
 
   loaded = true;
   Serial.printf("[%lu] [BMC] Loaded cache data: %d spine, %d TOC entries\n", millis(), spineCount, tocCount);
   return true;
 }
 
+bool BookMetadataCache::readTitleAndAuthor(const std::string& cachePath, std::string& title, std::string& author) {
+  // Not through openFileForRead, a book without a cache is no error here
+  FsFile file = SdMan.open((cachePath + bookBinFile).c_str());
+  if (!file) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(file, version);
+  if (version != BOOK_CACHE_VERSION) {
+    file.close();
+    return false;
+  }
+
+  // LUT offset, spine count and TOC count come first
+  file.seek(file.position() + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint16_t));
+  serialization::readString(file, title);
+  serialization::readString(file, author);
+  file.close();
+  return true;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index) {
   if (!loaded) {
     Serial.printf("[%lu] [BMC] getSpineEntry called but cache not loaded\n", millis());
@@ -335,6 +363,92 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
   return readTocEntry(bookFile);
 }
 
+// TOC entries are stored back to back, so the whole run is read with a single seek and read, starting at the
+// position of its first entry and ending at the one after its last
+bool BookMetadataCache::readTocTitles(const int first, const int count, TocTitleRange& range) {
+  range.first = first;
+  range.count = 0;
+  range.titles.clear();
+  range.titleOffsets.clear();
+  range.levels.clear();
+
+  if (!loaded) {
+    Serial.printf("[%lu] [BMC] readTocTitles called but cache not loaded\n", millis());
+    return false;
+  }
+
+  if (first < 0 || count <= 0 || first + count > static_cast<int>(tocCount)) {
+    Serial.printf("[%lu] [BMC] readTocTitles range %d+%d out of range\n", millis(), first, count);
+    return false;
+  }
+
+  const uint32_t tocLutOffset = lutOffset + sizeof(uint32_t) * spineCount;
+  uint32_t startPos;
+  uint32_t endPos;
+  bookFile.seek(tocLutOffset + sizeof(uint32_t) * first);
+  serialization::readPod(bookFile, startPos);
+  if (first + count < static_cast<int>(tocCount)) {
+    bookFile.seek(tocLutOffset + sizeof(uint32_t) * (first + count));
+    serialization::readPod(bookFile, endPos);
+  } else {
+    endPos = bookFile.size();
+  }
+  if (endPos < startPos) {
+    Serial.printf("[%lu] [BMC] readTocTitles found corrupt LUT entries\n", millis());
+    return false;
+  }
+
+  range.raw.resize(endPos - startPos);
+  bookFile.seek(startPos);
+  if (bookFile.read(range.raw.data(), range.raw.size()) != static_cast<int>(range.raw.size())) {
+    Serial.printf("[%lu] [BMC] readTocTitles could not read %u bytes\n", millis(), endPos - startPos);
+    return false;
+  }
+
+  // Same layout as readTocEntry, only the title and level are kept
+  const uint8_t* data = range.raw.data();
+  const size_t size = range.raw.size();
+  size_t pos = 0;
+  const auto skipString = [&](uint32_t& length) {
+    if (pos + sizeof(uint32_t) > size) {
+      return false;
+    }
+    memcpy(&length, data + pos, sizeof(uint32_t));
+    pos += sizeof(uint32_t);
+    if (length > size - pos) {
+      return false;
+    }
+    pos += length;
+    return true;
+  };
+
+  for (int i = 0; i < count; i++) {
+    uint32_t titleLength;
+    uint32_t hrefLength;
+    uint32_t anchorLength;
+    if (!skipString(titleLength)) {
+      break;
+    }
+    const size_t titlePos = pos - titleLength;
+    if (!skipString(hrefLength) || !skipString(anchorLength) || pos + sizeof(uint8_t) + sizeof(int16_t) > size) {
+      break;
+    }
+    range.titleOffsets.push_back(range.titles.size());
+    range.titles.insert(range.titles.end(), data + titlePos, data + titlePos + titleLength);
+    range.titles.push_back('\0');
+    range.levels.push_back(data[pos]);
+    pos += sizeof(uint8_t) + sizeof(int16_t);
+  }
+
+  if (static_cast<int>(range.levels.size()) != count) {
+    Serial.printf("[%lu] [BMC] readTocTitles found a truncated entry at %d\n", millis(),
+                  first + static_cast<int>(range.levels.size()));
+    return false;
+  }
+  range.count = count;
+  return true;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) const {
   SpineEntry entry;
   serialization::readString(file, entry.href);
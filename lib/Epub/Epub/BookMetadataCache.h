@@ -3,6 +3,7 @@
 #include <SDCardManager.h>
 
 #include <string>
+#include <vector>
 
 class BookMetadataCache {
  public:
@@ -11,6 +12,9 @@ class BookMetadataCache {
     std::string author;
     std::string coverItemHref;
     std::string textReferenceHref;
+    std::string language;
+    // Manifest hrefs of the embedded fonts, one per line
+    std::string fontHrefs;
   };
 
   struct SpineEntry {
@@ -39,6 +43,21 @@ class BookMetadataCache {
           spineIndex(spineIndex) {}
   };
 
+  // Titles and levels of a run of consecutive TOC entries, read in one go. The buffers are kept when it is refilled,
+  // so scrolling through the TOC doesn't allocate once they have grown to the size of a window.
+  struct TocTitleRange {
+    int first = 0;
+    int count = 0;
+    std::vector<uint8_t> raw;  // Serialized entries as read from book.bin
+    std::vector<char> titles;  // NUL terminated titles back to back
+    std::vector<uint32_t> titleOffsets;
+    std::vector<uint8_t> levels;
+
+    bool contains(const int index) const { return index >= first && index < first + count; }
+    const char* getTitle(const int index) const { return titles.data() + titleOffsets[index - first]; }
+    uint8_t getLevel(const int index) const { return levels[index - first]; }
+  };
+
  private:
   std::string cachePath;
   size_t lutOffset;
@@ -82,7 +101,11 @@ class BookMetadataCache {
   bool load();
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
+  bool readTocTitles(int first, int count, TocTitleRange& range);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
   bool isLoaded() const { return loaded; }
+
+  // Title and author from the header of an existing book.bin, without loading the rest of the cache
+  static bool readTitleAndAuthor(const std::string& cachePath, std::string& title, std::string& author);
 };
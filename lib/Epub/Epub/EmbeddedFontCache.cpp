@@ -0,0 +1,528 @@
+#include "EmbeddedFontCache.h"
+
+#include <GlyphRasterizer.h>
+#include <HardwareSerial.h>
+#include <Print.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <TrueTypeFont.h>
+#include <Utf8.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+
+#include "../Epub.h"
+#include "htmlEntities.h"
+
+namespace {
+// Kept clear of the generated builtin font ids, the pixel size is added to it
+constexpr int EMBEDDED_FONT_ID_BASE = 0x45465400;
+constexpr size_t MAX_ENTITY_LENGTH = 10;
+// Basic Latin is cached up front, it is in every book and '?' stands in for the characters a font doesn't have
+constexpr uint32_t FIRST_PRELOADED = 0x20;
+constexpr uint32_t LAST_PRELOADED = 0x7E;
+// RAM taken by a glyph on top of its bitmap
+constexpr size_t GLYPH_OVERHEAD = sizeof(EpdGlyph) + sizeof(uint32_t);
+
+void addCodepoint(std::vector<uint32_t>& codepoints, const uint32_t codepoint) {
+  const auto it = std::lower_bound(codepoints.begin(), codepoints.end(), codepoint);
+  if (it == codepoints.end() || *it != codepoint) {
+    codepoints.insert(it, codepoint);
+  }
+}
+
+// Collects the characters above basic Latin in the text of a chapter streamed through it, outside of tags and with
+// entities resolved
+class CodepointCollector final : public Print {
+  std::vector<uint32_t>& codepoints;
+  char entity[MAX_ENTITY_LENGTH + 2] = {};
+  size_t entityLength = 0;
+  bool inTag = false;
+  bool inEntity = false;
+  uint32_t codepoint = 0;
+  int continuationBytes = 0;
+
+  void add(const uint32_t c) {
+    if (c > LAST_PRELOADED) {
+      addCodepoint(codepoints, c);
+    }
+  }
+
+ public:
+  explicit CodepointCollector(std::vector<uint32_t>& codepoints) : codepoints(codepoints) {}
+
+  // Chapters are streamed one after the other, none of the state carries over
+  void reset() {
+    inTag = false;
+    inEntity = false;
+    continuationBytes = 0;
+  }
+
+  size_t write(const uint8_t data) override { return write(&data, 1); }
+
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    for (size_t i = 0; i < size; i++) {
+      const uint8_t c = buffer[i];
+      if (inTag) {
+        inTag = c != '>';
+        continue;
+      }
+      if (inEntity) {
+        if (c == ';') {
+          entity[entityLength++] = ';';
+          entity[entityLength] = '\0';
+          const std::string text = replaceHtmlEntities(entity, entityLength);
+          auto* next = reinterpret_cast<const unsigned char*>(text.c_str());
+          uint32_t decoded;
+          while ((decoded = utf8NextCodepoint(&next))) {
+            add(decoded);
+          }
+          inEntity = false;
+          continue;
+        }
+        if (entityLength < MAX_ENTITY_LENGTH && (isalnum(c) || c == '#')) {
+          entity[entityLength++] = static_cast<char>(c);
+          continue;
+        }
+        // Not an entity after all, what was read of it is basic Latin
+        inEntity = false;
+      }
+
+      if (c < 0x80) {
+        continuationBytes = 0;
+        if (c == '<') {
+          inTag = true;
+        } else if (c == '&') {
+          inEntity = true;
+          entity[0] = '&';
+          entityLength = 1;
+        }
+      } else if ((c & 0xC0) == 0x80) {
+        if (continuationBytes > 0) {
+          codepoint = codepoint << 6 | (c & 0x3F);
+          if (--continuationBytes == 0) {
+            add(codepoint);
+          }
+        }
+      } else if ((c & 0xE0) == 0xC0) {
+        codepoint = c & 0x1F;
+        continuationBytes = 1;
+      } else if ((c & 0xF0) == 0xE0) {
+        codepoint = c & 0x0F;
+        continuationBytes = 2;
+      } else if ((c & 0xF8) == 0xF0) {
+        codepoint = c & 0x07;
+        continuationBytes = 3;
+      } else {
+        continuationBytes = 0;
+      }
+    }
+    return size;
+  }
+};
+}  // namespace
+
+bool EmbeddedFontCache::Face::isCached(const uint32_t codepoint) const {
+  return std::binary_search(codepoints.begin(), codepoints.end(), codepoint) ||
+         std::binary_search(missing.begin(), missing.end(), codepoint);
+}
+
+// Sort the glyphs added since the last call into place and point the font data at them
+void EmbeddedFontCache::Face::publish() {
+  std::vector<uint32_t> order(codepoints.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [this](const uint32_t a, const uint32_t b) {
+    return codepoints[a] < codepoints[b];
+  });
+  std::vector<uint32_t> sortedCodepoints;
+  std::vector<EpdGlyph> sortedGlyphs;
+  sortedCodepoints.reserve(order.size());
+  sortedGlyphs.reserve(order.size());
+  for (const uint32_t index : order) {
+    sortedCodepoints.push_back(codepoints[index]);
+    sortedGlyphs.push_back(glyphs[index]);
+  }
+  codepoints.swap(sortedCodepoints);
+  glyphs.swap(sortedGlyphs);
+  std::sort(missing.begin(), missing.end());
+
+  intervals.clear();
+  for (uint32_t i = 0; i < codepoints.size(); i++) {
+    if (!intervals.empty() && codepoints[i] == intervals.back().last + 1) {
+      intervals.back().last = codepoints[i];
+    } else {
+      intervals.push_back({codepoints[i], codepoints[i], i});
+    }
+  }
+  intervals.shrink_to_fit();
+
+  data.bitmap = bitmaps.data();
+  data.glyph = glyphs.data();
+  data.intervals = intervals.data();
+  data.intervalCount = intervals.size();
+}
+
+EmbeddedFontCache::EmbeddedFontCache(std::shared_ptr<Epub> epub, const uint16_t pixelSize)
+    : epub(std::move(epub)), pixelSize(pixelSize) {}
+
+int EmbeddedFontCache::getFontId() const { return EMBEDDED_FONT_ID_BASE + pixelSize; }
+
+EpdFontFamily EmbeddedFontCache::getFamily() const {
+  auto font = [this](const int style) { return faces[style] ? &faces[style]->font : nullptr; };
+  return EpdFontFamily(font(EpdFontFamily::REGULAR), font(EpdFontFamily::BOLD), font(EpdFontFamily::ITALIC),
+                       font(EpdFontFamily::BOLD_ITALIC));
+}
+
+bool EmbeddedFontCache::openFont(const std::string& path, TrueTypeFont& font, FsFile& file) {
+  if (!SdMan.openFileForRead("EFC", path, file)) {
+    return false;
+  }
+  FsFile* source = &file;
+  if (!font.open([source](const uint32_t offset, void* buffer, const size_t size) {
+        return source->seekSet(offset) && source->read(buffer, size) == static_cast<int>(size);
+      })) {
+    file.close();
+    return false;
+  }
+  return true;
+}
+
+bool EmbeddedFontCache::load() {
+  const auto hrefs = epub->getFontHrefs();
+  if (hrefs.empty()) {
+    return false;
+  }
+  const auto fontsDir = epub->getCachePath() + "/fonts";
+  SdMan.mkdir(fontsDir.c_str());
+
+  // The book's glyphs either all fit or the book uses the reader font, so a word never measures differently
+  // depending on what happened to be rasterized before it
+  const auto indexPath = fontsDir + "/" + std::to_string(pixelSize) + ".idx";
+  uint8_t fits = 0;
+  const bool indexed = readIndex(indexPath, fits);
+  if (indexed && !fits) {
+    Serial.printf("[%lu] [EFC] Book's characters don't fit in glyph memory at %upx\n", millis(), pixelSize);
+    return false;
+  }
+
+  // Extract the fonts once, they are read a glyph at a time while rasterizing
+  struct Candidate {
+    std::string path;
+    std::string family;
+    uint8_t style;
+    uint16_t weight;
+  };
+  std::vector<Candidate> candidates;
+  for (size_t i = 0; i < hrefs.size(); i++) {
+    const auto path = fontsDir + "/" + std::to_string(i) + ".ttf";
+    if (!SdMan.exists(path.c_str())) {
+      FsFile out;
+      if (!SdMan.openFileForWrite("EFC", path, out)) {
+        continue;
+      }
+      const bool extracted = epub->readItemContentsToStream(hrefs[i], out, 1024);
+      out.close();
+      if (!extracted) {
+        Serial.printf("[%lu] [EFC] Could not extract %s\n", millis(), hrefs[i].c_str());
+        SdMan.remove(path.c_str());
+        continue;
+      }
+    }
+
+    TrueTypeFont font;
+    FsFile file;
+    if (!openFont(path, font, file)) {
+      Serial.printf("[%lu] [EFC] Skipping font %s\n", millis(), hrefs[i].c_str());
+      continue;
+    }
+    candidates.push_back({path, font.getFamilyName(), font.getStyle(), font.getWeight()});
+    file.close();
+  }
+
+  // Books often add a family for headings or ornaments, the text font is the family with a regular face and the
+  // most styles
+  std::string family;
+  int familyStyles = 0;
+  for (const auto& candidate : candidates) {
+    if (candidate.style != TrueTypeFont::REGULAR) {
+      continue;
+    }
+    uint8_t styles = 0;
+    for (const auto& other : candidates) {
+      if (other.family == candidate.family) {
+        styles |= 1 << other.style;
+      }
+    }
+    const int count = __builtin_popcount(styles);
+    if (count > familyStyles) {
+      familyStyles = count;
+      family = candidate.family;
+    }
+  }
+  if (familyStyles == 0) {
+    Serial.printf("[%lu] [EFC] No usable embedded font\n", millis());
+    return false;
+  }
+
+  bool cachesRead = true;
+  for (uint8_t style = TrueTypeFont::REGULAR; style <= TrueTypeFont::BOLD_ITALIC; style++) {
+    // A family can have several weights of a style, take the one closest to regular or bold
+    const int weight = style & TrueTypeFont::BOLD ? 700 : 400;
+    const Candidate* best = nullptr;
+    for (const auto& candidate : candidates) {
+      if (candidate.family == family && candidate.style == style &&
+          (!best || std::abs(candidate.weight - weight) < std::abs(best->weight - weight))) {
+        best = &candidate;
+      }
+    }
+    if (!best) {
+      continue;
+    }
+
+    auto face = std::unique_ptr<Face>(new Face());
+    face->fontPath = best->path;
+    face->glyphPath = fontsDir + "/" + std::to_string(pixelSize) + "_" + std::to_string(style) + ".bin";
+    TrueTypeFont font;
+    FsFile file;
+    if (!openFont(face->fontPath, font, file)) {
+      continue;
+    }
+    face->fontSize = file.size();
+    const float scale = static_cast<float>(pixelSize) / font.getUnitsPerEm();
+    face->data.ascender = static_cast<int>(std::ceil(font.getAscender() * scale));
+    face->data.descender = static_cast<int>(std::floor(font.getDescender() * scale));
+    face->data.advanceY = static_cast<uint8_t>(
+        std::min(255L, std::lround((font.getAscender() - font.getDescender() + font.getLineGap()) * scale)));
+    face->data.is2Bit = true;
+    file.close();
+
+    if (!readGlyphCache(*face)) {
+      cachesRead = false;
+    }
+    faces[style] = std::move(face);
+  }
+  if (!faces[TrueTypeFont::REGULAR]) {
+    return false;
+  }
+
+  if (!indexed || !cachesRead) {
+    if (!indexBook()) {
+      if (overBudget) {
+        writeIndex(indexPath, false);
+        for (const auto& face : faces) {
+          if (face) {
+            SdMan.remove(face->glyphPath.c_str());
+          }
+        }
+      }
+      return false;
+    }
+    writeIndex(indexPath, true);
+  }
+
+  Serial.printf("[%lu] [EFC] Using embedded font %s at %upx (%d styles, %u glyph bytes)\n", millis(), family.c_str(),
+                pixelSize, familyStyles, glyphBytes);
+  return true;
+}
+
+bool EmbeddedFontCache::readGlyphCache(Face& face) {
+  FsFile file;
+  if (!SdMan.exists(face.glyphPath.c_str()) || !SdMan.openFileForRead("EFC", face.glyphPath, file)) {
+    return false;
+  }
+
+  uint8_t version = 0;
+  uint16_t size = 0;
+  uint32_t fontSize = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, size);
+  serialization::readPod(file, fontSize);
+  if (version != GLYPH_CACHE_VERSION || size != pixelSize || fontSize != face.fontSize) {
+    Serial.printf("[%lu] [EFC] Discarding glyph cache %s\n", millis(), face.glyphPath.c_str());
+    file.close();
+    SdMan.remove(face.glyphPath.c_str());
+    return false;
+  }
+  face.cacheEnd = file.position();
+  face.bitmaps.reserve(std::min(file.size(), static_cast<uint64_t>(MAX_GLYPH_BYTES)));
+
+  // Records are appended as the book is indexed, a partly written last one is dropped
+  while (file.available() >= static_cast<int>(sizeof(uint32_t) + sizeof(uint8_t))) {
+    uint32_t codepoint;
+    uint8_t found;
+    serialization::readPod(file, codepoint);
+    serialization::readPod(file, found);
+    if (!found) {
+      face.missing.push_back(codepoint);
+      face.cacheEnd = file.position();
+      continue;
+    }
+
+    EpdGlyph glyph;
+    if (file.available() < 9) {
+      break;
+    }
+    serialization::readPod(file, glyph.width);
+    serialization::readPod(file, glyph.height);
+    serialization::readPod(file, glyph.advanceX);
+    serialization::readPod(file, glyph.left);
+    serialization::readPod(file, glyph.top);
+    serialization::readPod(file, glyph.dataLength);
+    if (file.available() < glyph.dataLength) {
+      break;
+    }
+    if (glyphBytes + glyph.dataLength + GLYPH_OVERHEAD > MAX_GLYPH_BYTES) {
+      Serial.printf("[%lu] [EFC] Glyph memory full reading %s\n", millis(), face.glyphPath.c_str());
+      file.close();
+      face.publish();
+      return false;
+    }
+    glyph.dataOffset = face.bitmaps.size();
+    face.bitmaps.resize(face.bitmaps.size() + glyph.dataLength);
+    file.read(&face.bitmaps[glyph.dataOffset], glyph.dataLength);
+    face.codepoints.push_back(codepoint);
+    face.glyphs.push_back(glyph);
+    glyphBytes += glyph.dataLength + GLYPH_OVERHEAD;
+    face.cacheEnd = file.position();
+  }
+  file.close();
+  face.publish();
+  return true;
+}
+
+bool EmbeddedFontCache::rasterizeMissing(Face& face, const std::vector<uint32_t>& codepoints) {
+  std::vector<uint32_t> pending;
+  for (const uint32_t codepoint : codepoints) {
+    if (!face.isCached(codepoint)) {
+      pending.push_back(codepoint);
+    }
+  }
+  if (pending.empty()) {
+    return true;
+  }
+  if (glyphBytes >= MAX_GLYPH_BYTES) {
+    overBudget = true;
+    return false;
+  }
+
+  TrueTypeFont font;
+  FsFile fontFile;
+  if (!openFont(face.fontPath, font, fontFile)) {
+    return false;
+  }
+  FsFile cache = SdMan.open(face.glyphPath.c_str(), O_RDWR | O_CREAT);
+  if (!cache) {
+    Serial.printf("[%lu] [EFC] Could not open %s for writing\n", millis(), face.glyphPath.c_str());
+    fontFile.close();
+    return false;
+  }
+  // Cut off a partly written record from an earlier run before appending
+  cache.truncate(face.cacheEnd);
+  cache.seekSet(face.cacheEnd);
+  if (face.cacheEnd == 0) {
+    serialization::writePod(cache, GLYPH_CACHE_VERSION);
+    serialization::writePod(cache, pixelSize);
+    serialization::writePod(cache, face.fontSize);
+  }
+
+  const float scale = static_cast<float>(pixelSize) / font.getUnitsPerEm();
+  TrueTypeFont::Outline outline;
+  GlyphRasterizer::Glyph rasterized;
+  std::vector<uint8_t> bitmaps;
+  bool success = true;
+  for (const uint32_t codepoint : pending) {
+    const uint16_t glyphIndex = font.getGlyphIndex(codepoint);
+    const uint8_t found = glyphIndex != 0 && font.loadOutline(glyphIndex, outline) &&
+                          GlyphRasterizer::rasterize(outline, scale, rasterized);
+    if (found && glyphBytes + rasterized.bitmap.size() + GLYPH_OVERHEAD > MAX_GLYPH_BYTES) {
+      Serial.printf("[%lu] [EFC] Glyph memory full at U+%04X\n", millis(), codepoint);
+      overBudget = true;
+      success = false;
+      break;
+    }
+    serialization::writePod(cache, codepoint);
+    serialization::writePod(cache, found);
+    if (!found) {
+      face.missing.push_back(codepoint);
+      continue;
+    }
+
+    const EpdGlyph glyph = {rasterized.width,
+                            rasterized.height,
+                            rasterized.advanceX,
+                            rasterized.left,
+                            rasterized.top,
+                            static_cast<uint16_t>(rasterized.bitmap.size()),
+                            static_cast<uint32_t>(face.bitmaps.size() + bitmaps.size())};
+    serialization::writePod(cache, glyph.width);
+    serialization::writePod(cache, glyph.height);
+    serialization::writePod(cache, glyph.advanceX);
+    serialization::writePod(cache, glyph.left);
+    serialization::writePod(cache, glyph.top);
+    serialization::writePod(cache, glyph.dataLength);
+    cache.write(rasterized.bitmap.data(), rasterized.bitmap.size());
+
+    bitmaps.insert(bitmaps.end(), rasterized.bitmap.begin(), rasterized.bitmap.end());
+    face.codepoints.push_back(codepoint);
+    face.glyphs.push_back(glyph);
+    glyphBytes += glyph.dataLength + GLYPH_OVERHEAD;
+  }
+  face.cacheEnd = cache.position();
+  cache.close();
+  fontFile.close();
+
+  // Grow the bitmaps once, doubling capacity for every glyph would need twice the budget
+  face.bitmaps.reserve(face.bitmaps.size() + bitmaps.size());
+  face.bitmaps.insert(face.bitmaps.end(), bitmaps.begin(), bitmaps.end());
+  face.publish();
+  return success;
+}
+
+bool EmbeddedFontCache::readIndex(const std::string& path, uint8_t& fits) {
+  FsFile file;
+  if (!SdMan.exists(path.c_str()) || !SdMan.openFileForRead("EFC", path, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, fits);
+  file.close();
+  return version == INDEX_VERSION;
+}
+
+void EmbeddedFontCache::writeIndex(const std::string& path, const bool fits) {
+  FsFile file;
+  if (!SdMan.openFileForWrite("EFC", path, file)) {
+    return;
+  }
+  serialization::writePod(file, INDEX_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(fits));
+  file.close();
+}
+
+bool EmbeddedFontCache::indexBook() {
+  const unsigned long start = millis();
+  std::vector<uint32_t> codepoints(LAST_PRELOADED - FIRST_PRELOADED + 1);
+  std::iota(codepoints.begin(), codepoints.end(), FIRST_PRELOADED);
+  CodepointCollector collector(codepoints);
+  for (int i = 0; i < epub->getSpineItemsCount(); i++) {
+    collector.reset();
+    const auto href = epub->getSpineItem(i).href;
+    if (!epub->readItemContentsToStream(href, collector, 1024)) {
+      Serial.printf("[%lu] [EFC] Could not read %s\n", millis(), href.c_str());
+      return false;
+    }
+  }
+
+  for (auto& face : faces) {
+    if (face && !rasterizeMissing(*face, codepoints)) {
+      return false;
+    }
+  }
+  Serial.printf("[%lu] [EFC] %u characters in book, %u glyph bytes after %lu ms\n", millis(), codepoints.size(),
+                glyphBytes, millis() - start);
+  return true;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <EpdFontFamily.h>
+#include <SdFat.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class Epub;
+class TrueTypeFont;
+
+/**
+ * Glyphs of the fonts a book embeds, rasterized at the reader size and kept in a per-book cache on the SD card.
+ *
+ * load() picks the book's text font among the TrueType fonts in the manifest (the family with a regular face and the
+ * most styles) and extracts its faces to <cache>/fonts/. The first time the book is opened at a size, every character
+ * of its text is rasterized for every face and appended to the glyph cache, later opens only read the glyphs back, so
+ * measuring and drawing words only ever look glyphs up. The glyphs are held in RAM as the EpdFontData of each face, up
+ * to MAX_GLYPH_BYTES for all faces. A book whose characters need more than that is not set in its font at that size,
+ * load() fails and the reader font is used.
+ */
+class EmbeddedFontCache {
+ public:
+  static constexpr size_t MAX_GLYPH_BYTES = 64 * 1024;
+
+  explicit EmbeddedFontCache(std::shared_ptr<Epub> epub, uint16_t pixelSize);
+  ~EmbeddedFontCache() = default;
+
+  // False if the book has no usable font or its glyphs don't fit in MAX_GLYPH_BYTES
+  bool load();
+
+  // Renderer font id for the embedded family at this size
+  int getFontId() const;
+  EpdFontFamily getFamily() const;
+
+ private:
+  static constexpr uint8_t GLYPH_CACHE_VERSION = 1;
+  // <px>.idx records that the whole book was rasterized at a size (version and whether its glyphs fit)
+  static constexpr uint8_t INDEX_VERSION = 1;
+
+  // The glyph cache of a face starts with a header (version, pixel size, font file size) followed by a record for
+  // every character looked up: codepoint, found flag and for found ones the EpdGlyph metrics and the bitmap
+  struct Face {
+    std::string fontPath;
+    uint32_t fontSize = 0;
+    std::string glyphPath;
+    // End of the last complete record in the glyph cache
+    uint32_t cacheEnd = 0;
+    // Sorted by codepoint, glyphs[i] is the glyph of codepoints[i]
+    std::vector<uint32_t> codepoints;
+    std::vector<EpdGlyph> glyphs;
+    std::vector<EpdUnicodeInterval> intervals;
+    std::vector<uint8_t> bitmaps;
+    // Sorted, characters the font doesn't have
+    std::vector<uint32_t> missing;
+    EpdFontData data = {};
+    EpdFont font{&data};
+
+    bool isCached(uint32_t codepoint) const;
+    void publish();
+  };
+
+  std::shared_ptr<Epub> epub;
+  uint16_t pixelSize;
+  std::unique_ptr<Face> faces[4];
+  size_t glyphBytes = 0;
+  bool overBudget = false;
+
+  static bool openFont(const std::string& path, TrueTypeFont& font, FsFile& file);
+  static bool readIndex(const std::string& path, uint8_t& fits);
+  static void writeIndex(const std::string& path, bool fits);
+  bool readGlyphCache(Face& face);
+  bool rasterizeMissing(Face& face, const std::vector<uint32_t>& codepoints);
+  // Rasterize the characters of every chapter that are not cached yet
+  bool indexBook();
+};
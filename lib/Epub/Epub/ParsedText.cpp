@@ -1,20 +1,30 @@
 #include "ParsedText.h"
 
 #include <GfxRenderer.h>
+#include <Hyphenator.h>
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <vector>
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
+constexpr size_t MAX_HYPHENATION_POINTS = 16;
 
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle) {
+namespace {
+bool endsWithHyphen(const char* s, const size_t len) {
+  return s[len - 1] == '-' || (len >= 3 && memcmp(s + len - 3, "\xe2\x80\x90", 3) == 0);  // U+2010 HYPHEN
+}
+}  // namespace
+
+void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool attachToPrevious) {
   if (word.empty()) return;
 
   words.push_back(std::move(word));
   wordStyles.push_back(fontStyle);
+  wordAttached.push_back(attachToPrevious);
 }
 
 // Consumes data to minimize memory usage
@@ -27,72 +37,121 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
 
   const int pageWidth = viewportWidth;
   const int spaceWidth = renderer.getSpaceWidth(fontId);
-  const auto wordWidths = calculateWordWidths(renderer, fontId);
-  const auto lineBreakIndices = computeLineBreaks(pageWidth, spaceWidth, wordWidths);
+  const auto fragments = calculateFragments(renderer, fontId);
+  const auto lineBreakIndices = computeLineBreaks(pageWidth, spaceWidth, fragments);
   const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
+    extractLine(i, pageWidth, spaceWidth, fragments, lineBreakIndices, processLine);
   }
 }
 
-std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
+std::vector<ParsedText::Fragment> ParsedText::calculateFragments(const GfxRenderer& renderer, const int fontId) {
   const size_t totalWordCount = words.size();
 
-  std::vector<uint16_t> wordWidths;
-  wordWidths.reserve(totalWordCount);
+  std::vector<Fragment> fragments;
+  fragments.reserve(totalWordCount);
 
-  // add em-space at the beginning of first word in paragraph to indent
-  if (!extraParagraphSpacing) {
+  // add em-space at the beginning of first word in paragraph to indent, only once: after a partial layout the words
+  // left over continue the paragraph (possibly with the tail of a hyphenated word)
+  if (!extraParagraphSpacing && !indented) {
     std::string& first_word = words.front();
     first_word.insert(0, "\xe2\x80\x83");
   }
+  indented = true;
+
+  // Centered and right aligned text (mostly headings) is never hyphenated
+  const bool hyphenate = hyphenator && (style == TextBlock::JUSTIFIED || style == TextBlock::LEFT_ALIGN);
+  int hyphenWidths[4] = {-1, -1, -1, -1};
+  uint8_t breaks[MAX_HYPHENATION_POINTS];
+  char part[UINT8_MAX + 1];
 
   auto wordsIt = words.begin();
   auto wordStylesIt = wordStyles.begin();
+  auto wordAttachedIt = wordAttached.begin();
 
   while (wordsIt != words.end()) {
-    wordWidths.push_back(renderer.getTextWidth(fontId, wordsIt->c_str(), *wordStylesIt));
+    const bool spaceBefore = !*wordAttachedIt;
+    const size_t breakCount = hyphenate ? hyphenator->hyphenate(*wordsIt, breaks, MAX_HYPHENATION_POINTS) : 0;
+    if (breakCount == 0) {
+      fragments.push_back({static_cast<uint16_t>(renderer.getTextWidth(fontId, wordsIt->c_str(), *wordStylesIt)), 0,
+                           0, spaceBefore, true});
+    } else {
+      int& hyphenWidth = hyphenWidths[*wordStylesIt];
+      if (hyphenWidth < 0) {
+        hyphenWidth = renderer.getTextWidth(fontId, "-", *wordStylesIt);
+      }
+
+      // Measure each part on its own, the hyphenator only accepts words short enough for part
+      size_t start = 0;
+      for (size_t i = 0; i <= breakCount; i++) {
+        const size_t end = i < breakCount ? breaks[i] : wordsIt->size();
+        memcpy(part, wordsIt->data() + start, end - start);
+        part[end - start] = '\0';
+        const auto width = static_cast<uint16_t>(renderer.getTextWidth(fontId, part, *wordStylesIt));
+        if (i == breakCount) {
+          fragments.push_back({width, 0, 0, spaceBefore && i == 0, true});
+        } else {
+          // No hyphen added where the word already has one
+          const uint8_t addedHyphenWidth = endsWithHyphen(part, end - start) ? 0 : hyphenWidth;
+          fragments.push_back(
+              {width, static_cast<uint8_t>(end - start), addedHyphenWidth, spaceBefore && i == 0, false});
+        }
+        start = end;
+      }
+    }
 
     std::advance(wordsIt, 1);
     std::advance(wordStylesIt, 1);
+    std::advance(wordAttachedIt, 1);
   }
 
-  return wordWidths;
+  return fragments;
 }
 
 std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int spaceWidth,
-                                                  const std::vector<uint16_t>& wordWidths) const {
-  const size_t totalWordCount = words.size();
+                                                  const std::vector<Fragment>& fragments) const {
+  const size_t totalFragmentCount = fragments.size();
+  // Ending a line in the middle of a word costs about as much as two spaces of slack
+  const int hyphenPenalty = 4 * spaceWidth * spaceWidth;
 
   // DP table to store the minimum badness (cost) of lines starting at index i
-  std::vector<int> dp(totalWordCount);
-  // 'ans[i]' stores the index 'j' of the *last word* in the optimal line starting at 'i'
-  std::vector<size_t> ans(totalWordCount);
+  std::vector<int> dp(totalFragmentCount);
+  // 'ans[i]' stores the index 'j' of the *last fragment* in the optimal line starting at 'i'
+  std::vector<size_t> ans(totalFragmentCount);
 
   // Base Case
-  dp[totalWordCount - 1] = 0;
-  ans[totalWordCount - 1] = totalWordCount - 1;
+  dp[totalFragmentCount - 1] = 0;
+  ans[totalFragmentCount - 1] = totalFragmentCount - 1;
 
-  for (int i = totalWordCount - 2; i >= 0; --i) {
-    int currlen = -spaceWidth;
+  for (int i = totalFragmentCount - 2; i >= 0; --i) {
+    int currlen = 0;
     dp[i] = MAX_COST;
 
-    for (size_t j = i; j < totalWordCount; ++j) {
-      // Current line length: previous width + space + current word width
-      currlen += wordWidths[j] + spaceWidth;
+    for (size_t j = i; j < totalFragmentCount; ++j) {
+      // Current line length: previous width + space (unless attached to the previous fragment) + current width
+      if (j > static_cast<size_t>(i) && fragments[j].spaceBefore) {
+        currlen += spaceWidth;
+      }
+      currlen += fragments[j].width;
 
       if (currlen > pageWidth) {
         break;
       }
+      // A hyphen at the end might not fit where the following fragment still does
+      const int lineWidth = currlen + fragments[j].hyphenWidth;
+      if (lineWidth > pageWidth) {
+        continue;
+      }
 
       int cost;
-      if (j == totalWordCount - 1) {
+      if (j == totalFragmentCount - 1) {
         cost = 0;  // Last line
       } else {
-        const int remainingSpace = pageWidth - currlen;
+        const int remainingSpace = pageWidth - lineWidth;
         // Use long long for the square to prevent overflow
-        const long long cost_ll = static_cast<long long>(remainingSpace) * remainingSpace + dp[j + 1];
+        const long long cost_ll = static_cast<long long>(remainingSpace) * remainingSpace + dp[j + 1] +
+                                  (fragments[j].endsWord ? 0 : hyphenPenalty);
 
         if (cost_ll > MAX_COST) {
           cost = MAX_COST;
@@ -103,16 +162,16 @@ std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int
 
       if (cost < dp[i]) {
         dp[i] = cost;
-        ans[i] = j;  // j is the index of the last word in this optimal line
+        ans[i] = j;  // j is the index of the last fragment in this optimal line
       }
     }
 
-    // Handle oversized word: if no valid configuration found, force single-word line
+    // Handle oversized word: if no valid configuration found, force single-fragment line
     // This prevents cascade failure where one oversized word breaks all preceding words
     if (dp[i] == MAX_COST) {
-      ans[i] = i;  // Just this word on its own line
-      // Inherit cost from next word to allow subsequent words to find valid configurations
-      if (i + 1 < static_cast<int>(totalWordCount)) {
+      ans[i] = i;  // Just this fragment on its own line
+      // Inherit cost from next fragment to allow subsequent fragments to find valid configurations
+      if (i + 1 < static_cast<int>(totalFragmentCount)) {
         dp[i] = dp[i + 1];
       } else {
         dp[i] = 0;
@@ -120,70 +179,103 @@ std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int
     }
   }
 
-  // Stores the index of the word that starts the next line (last_word_index + 1)
+  // Stores the index of the fragment that starts the next line (last_fragment_index + 1)
   std::vector<size_t> lineBreakIndices;
-  size_t currentWordIndex = 0;
+  size_t currentFragmentIndex = 0;
 
-  while (currentWordIndex < totalWordCount) {
-    size_t nextBreakIndex = ans[currentWordIndex] + 1;
+  while (currentFragmentIndex < totalFragmentCount) {
+    size_t nextBreakIndex = ans[currentFragmentIndex] + 1;
 
     // Safety check: prevent infinite loop if nextBreakIndex doesn't advance
-    if (nextBreakIndex <= currentWordIndex) {
-      // Force advance by at least one word to avoid infinite loop
-      nextBreakIndex = currentWordIndex + 1;
+    if (nextBreakIndex <= currentFragmentIndex) {
+      // Force advance by at least one fragment to avoid infinite loop
+      nextBreakIndex = currentFragmentIndex + 1;
     }
 
     lineBreakIndices.push_back(nextBreakIndex);
-    currentWordIndex = nextBreakIndex;
+    currentFragmentIndex = nextBreakIndex;
   }
 
   return lineBreakIndices;
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
+                             const std::vector<Fragment>& fragments, const std::vector<size_t>& lineBreakIndices,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
-  const size_t lineWordCount = lineBreak - lastBreakAt;
+
+  // Put the fragments back together into words, the last one might continue on the next line
+  std::vector<uint16_t> lineWordWidths;
+  std::vector<bool> lineWordSpaced;  // Separated from the word before it by a space
+  size_t spaceCount = 0;
+  int wordWidth = 0;
+  size_t splitLength = 0;
+  for (size_t i = lastBreakAt; i < lineBreak; i++) {
+    if (i == lastBreakAt || fragments[i - 1].endsWord) {
+      const bool spaced = i > lastBreakAt && fragments[i].spaceBefore;
+      lineWordSpaced.push_back(spaced);
+      spaceCount += spaced;
+    }
+    wordWidth += fragments[i].width;
+    splitLength = fragments[i].endsWord ? 0 : splitLength + fragments[i].length;
+    if (fragments[i].endsWord || i == lineBreak - 1) {
+      lineWordWidths.push_back(wordWidth + (fragments[i].endsWord ? 0 : fragments[i].hyphenWidth));
+      wordWidth = 0;
+    }
+  }
+  const bool endsInWord = !fragments[lineBreak - 1].endsWord;
+  const size_t lineWordCount = lineWordWidths.size();
 
   // Calculate total word width for this line
   int lineWordWidthSum = 0;
-  for (size_t i = lastBreakAt; i < lineBreak; i++) {
-    lineWordWidthSum += wordWidths[i];
+  for (const uint16_t width : lineWordWidths) {
+    lineWordWidthSum += width;
   }
 
   // Calculate spacing
   const int spareSpace = pageWidth - lineWordWidthSum;
 
   int spacing = spaceWidth;
+  int attachedSpacing = 0;
   const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
 
   if (style == TextBlock::JUSTIFIED && !isLastLine && lineWordCount >= 2) {
-    spacing = spareSpace / (lineWordCount - 1);
+    if (spaceCount > 0) {
+      spacing = spareSpace / spaceCount;
+    } else {
+      // Text without spaces (CJK) is justified by spreading out its characters
+      attachedSpacing = spareSpace / (lineWordCount - 1);
+    }
   }
 
   // Calculate initial x position
   uint16_t xpos = 0;
   if (style == TextBlock::RIGHT_ALIGN) {
-    xpos = spareSpace - (lineWordCount - 1) * spaceWidth;
+    xpos = spareSpace - spaceCount * spaceWidth;
   } else if (style == TextBlock::CENTER_ALIGN) {
-    xpos = (spareSpace - (lineWordCount - 1) * spaceWidth) / 2;
+    xpos = (spareSpace - spaceCount * spaceWidth) / 2;
   }
 
   // Pre-calculate X positions for words
   std::list<uint16_t> lineXPos;
-  for (size_t i = lastBreakAt; i < lineBreak; i++) {
-    const uint16_t currentWordWidth = wordWidths[i];
+  for (size_t i = 0; i < lineWordCount; i++) {
+    if (i > 0) {
+      xpos += lineWordSpaced[i] ? spacing : attachedSpacing;
+    }
     lineXPos.push_back(xpos);
-    xpos += currentWordWidth + spacing;
+    xpos += lineWordWidths[i];
   }
 
   // Iterators always start at the beginning as we are moving content with splice below
+  const size_t completeWordCount = endsInWord ? lineWordCount - 1 : lineWordCount;
   auto wordEndIt = words.begin();
   auto wordStyleEndIt = wordStyles.begin();
-  std::advance(wordEndIt, lineWordCount);
-  std::advance(wordStyleEndIt, lineWordCount);
+  auto wordAttachedEndIt = wordAttached.begin();
+  std::advance(wordEndIt, completeWordCount);
+  std::advance(wordStyleEndIt, completeWordCount);
+  std::advance(wordAttachedEndIt, completeWordCount);
+  wordAttached.erase(wordAttached.begin(), wordAttachedEndIt);
 
   // *** CRITICAL STEP: CONSUME DATA USING SPLICE ***
   std::list<std::string> lineWords;
@@ -191,5 +283,16 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   std::list<EpdFontFamily::Style> lineWordStyles;
   lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
 
+  // A hyphenated word is split, the rest of it stays behind for the next line
+  if (endsInWord) {
+    std::string& word = words.front();
+    lineWords.push_back(word.substr(0, splitLength));
+    if (fragments[lineBreak - 1].hyphenWidth) {
+      lineWords.back().push_back('-');
+    }
+    word.erase(0, splitLength);
+    lineWordStyles.push_back(wordStyles.front());
+  }
+
   processLine(std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), style));
 }
@@ -11,25 +11,39 @@
 #include "blocks/TextBlock.h"
 
 class GfxRenderer;
+class Hyphenator;
 
 class ParsedText {
+  // Lines are broken between fragments, a whole word or, with hyphenation, the part of one up to a hyphenation point
+  struct Fragment {
+    uint16_t width;
+    uint8_t length;       // Bytes of the word covered, only set when the word continues in the next fragment
+    uint8_t hyphenWidth;  // Width of the hyphen added when a line ends in this fragment
+    bool spaceBefore;     // Starts a word that is separated from the previous one by a space
+    bool endsWord;
+  };
+
   std::list<std::string> words;
   std::list<EpdFontFamily::Style> wordStyles;
+  std::list<bool> wordAttached;  // No space between the word and the one before it (CJK text broken per character)
   TextBlock::Style style;
   bool extraParagraphSpacing;
+  bool indented = false;  // The paragraph indent went into the first word on the first layout pass
+  const Hyphenator* hyphenator;
 
-  std::vector<size_t> computeLineBreaks(int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths) const;
-  void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
+  std::vector<size_t> computeLineBreaks(int pageWidth, int spaceWidth, const std::vector<Fragment>& fragments) const;
+  void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<Fragment>& fragments,
                    const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
-  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
+  std::vector<Fragment> calculateFragments(const GfxRenderer& renderer, int fontId);
 
  public:
-  explicit ParsedText(const TextBlock::Style style, const bool extraParagraphSpacing)
-      : style(style), extraParagraphSpacing(extraParagraphSpacing) {}
+  explicit ParsedText(const TextBlock::Style style, const bool extraParagraphSpacing,
+                      const Hyphenator* hyphenator = nullptr)
+      : style(style), extraParagraphSpacing(extraParagraphSpacing), hyphenator(hyphenator) {}
   ~ParsedText() = default;
 
-  void addWord(std::string word, EpdFontFamily::Style fontStyle);
+  void addWord(std::string word, EpdFontFamily::Style fontStyle, bool attachToPrevious = false);
   void setStyle(const TextBlock::Style style) { this->style = style; }
   TextBlock::Style getStyle() const { return style; }
   size_t size() const { return words.size(); }
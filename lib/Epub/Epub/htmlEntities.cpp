@@ -128,21 +128,26 @@ bool process_string_entity(const std::string& entity, std::string& res) {
 }
 
 // replace all the entities in the string
-std::string replaceHtmlEntities(const char* text) {
+std::string replaceHtmlEntities(const char* text) { return replaceHtmlEntities(text, strlen(text)); }
+
+std::string replaceHtmlEntities(const char* text, const size_t len) {
   std::string res;
-  res.reserve(strlen(text));
-  for (int i = 0; i < strlen(text); ++i) {
+  res.reserve(len);
+  for (int i = 0; i < len; ++i) {
     bool flag = false;
     // do we have a potential entity?
     if (text[i] == '&') {
       // find the end of the entity
       int j = i + 1;
-      while (j < strlen(text) && text[j] != ';' && j - i < MAX_ENTITY_LENGTH) {
+      while (j < len && text[j] != ';' && j - i < MAX_ENTITY_LENGTH) {
         j++;
       }
-      if (j - i > 2) {
-        char entity[j - i + 1];
-        strncpy(entity, text + i, j - i);
+      if (j < len && text[j] == ';' && j - i > 2) {
+        // The lookup table and the numeric parsing both expect the entity with its ';'
+        const int entityLength = j - i + 1;
+        char entity[entityLength + 1];
+        strncpy(entity, text + i, entityLength);
+        entity[entityLength] = '\0';
         // is it a numeric code?
         if (entity[1] == '#') {
           flag = process_numeric_entity(entity, res);
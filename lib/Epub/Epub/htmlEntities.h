@@ -5,3 +5,4 @@
 #include <string>
 
 std::string replaceHtmlEntities(const char* text);
+std::string replaceHtmlEntities(const char* text, size_t len);
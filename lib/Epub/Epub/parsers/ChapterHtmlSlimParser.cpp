@@ -2,44 +2,37 @@
 
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
+#include <LineBreak.h>
 #include <SDCardManager.h>
+#include <Utf8.h>
 #include <expat.h>
 
+#include <new>
+
 #include "../Page.h"
 #include "../htmlEntities.h"
-
-const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
-constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
+#include "WordTokenizer.h"
+#include "XhtmlTokenizer.h"
 
 // Minimum file size (in bytes) to show progress bar - smaller chapters don't benefit from it
 constexpr size_t MIN_SIZE_FOR_PROGRESS = 50 * 1024;  // 50KB
 
-const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
-constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
+constexpr size_t READ_BUFFER_SIZE = 1024;
 
-const char* BOLD_TAGS[] = {"b", "strong"};
-constexpr int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
+bool isHeaderTag(const HtmlTag tag) { return tag >= HtmlTag::H1 && tag <= HtmlTag::H6; }
 
-const char* ITALIC_TAGS[] = {"i", "em"};
-constexpr int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
+bool isBlockTag(const HtmlTag tag) {
+  return tag == HtmlTag::P || tag == HtmlTag::LI || tag == HtmlTag::DIV || tag == HtmlTag::BR ||
+         tag == HtmlTag::BLOCKQUOTE;
+}
 
-const char* IMAGE_TAGS[] = {"img"};
-constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
+bool isBoldTag(const HtmlTag tag) { return tag == HtmlTag::B || tag == HtmlTag::STRONG; }
 
-const char* SKIP_TAGS[] = {"head", "table"};
-constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
+bool isItalicTag(const HtmlTag tag) { return tag == HtmlTag::I || tag == HtmlTag::EM; }
 
-bool isWhitespace(const char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
+bool isImageTag(const HtmlTag tag) { return tag == HtmlTag::IMG; }
 
-// given the start and end of a tag, check to see if it matches a known tag
-bool matches(const char* tag_name, const char* possible_tags[], const int possible_tag_count) {
-  for (int i = 0; i < possible_tag_count; i++) {
-    if (strcmp(tag_name, possible_tags[i]) == 0) {
-      return true;
-    }
-  }
-  return false;
-}
+bool isSkipTag(const HtmlTag tag) { return tag == HtmlTag::HEAD || tag == HtmlTag::TABLE; }
 
 // start a new text block if needed
 void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::Style style) {
@@ -52,10 +45,94 @@ void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::Style style) {
 
     makePages();
   }
-  currentTextBlock.reset(new ParsedText(style, extraParagraphSpacing));
+  currentTextBlock.reset(new ParsedText(style, extraParagraphSpacing, hyphenator));
+}
+
+bool isUtf8Continuation(const char c) { return (static_cast<unsigned char>(c) & 0xC0) == 0x80; }
+
+// Where to cut the len bytes at s so the character continuing in the byte after them isn't split
+size_t utf8CutLength(const char* s, const size_t len, const char next) {
+  if (!isUtf8Continuation(next)) {
+    return len;
+  }
+  size_t cut = len;
+  while (cut > 0 && isUtf8Continuation(s[cut - 1])) {
+    cut--;
+  }
+  // Step back over the lead byte as well, unless this isn't UTF-8 after all
+  return cut > 1 && len - cut < 3 ? cut - 1 : len;
+}
+
+// Text that doesn't separate words with spaces (CJK) is split into the pieces lines may break between, these
+// are attached to each other so no space is drawn between them
+void ChapterHtmlSlimParser::addWord(const char* word, const size_t len, const bool hasAmpersand,
+                                    const EpdFontFamily::Style fontStyle, const bool attachToPrevious) {
+  std::string text = hasAmpersand ? replaceHtmlEntities(word, len) : std::string(word, len);
+  if (!LineBreak::mayHaveBreaks(text.data(), text.size())) {
+    currentTextBlock->addWord(std::move(text), fontStyle, attachToPrevious);
+    return;
+  }
+
+  const auto* start = reinterpret_cast<const unsigned char*>(text.c_str());
+  const auto* end = start + text.size();
+  const auto* p = start;
+  size_t pieceStart = 0;
+  LineBreak::Class previous = LineBreak::AL;
+  while (p < end) {
+    const size_t offset = p - start;
+    const uint32_t codePoint = utf8NextCodepoint(&p);
+    LineBreak::Class current = LineBreak::classOf(codePoint);
+    if (current == LineBreak::CM) {
+      // Combining marks take the class of the character they belong to
+      current = offset == 0 ? LineBreak::AL : previous;
+    } else if (offset > 0 && LineBreak::isBreakAllowed(previous, current)) {
+      currentTextBlock->addWord(text.substr(pieceStart, offset - pieceStart), fontStyle,
+                                pieceStart == 0 ? attachToPrevious : true);
+      pieceStart = offset;
+    }
+    previous = current;
+  }
+  currentTextBlock->addWord(text.substr(pieceStart), fontStyle, pieceStart == 0 ? attachToPrevious : true);
+}
+
+// Collect a word that may continue in the next characterData call, cutting it off if it gets too long
+void ChapterHtmlSlimParser::appendToPartWord(const char* s, size_t len, const EpdFontFamily::Style fontStyle) {
+  while (len > 0) {
+    if (partWordBufferIndex >= MAX_WORD_SIZE) {
+      // Cut between characters, the rest of a character that doesn't fit starts the next piece
+      const size_t keep = utf8CutLength(partWordBuffer, partWordBufferIndex, *s);
+      char carry[4];
+      const size_t carryLength = partWordBufferIndex - keep;
+      memcpy(carry, partWordBuffer + keep, carryLength);
+      partWordBufferIndex = keep;
+      flushPartWord(fontStyle);
+      memcpy(partWordBuffer, carry, carryLength);
+      partWordBufferIndex = carryLength;
+      partWordAttached = true;
+    }
+    const size_t take = std::min(len, static_cast<size_t>(MAX_WORD_SIZE - partWordBufferIndex));
+    memcpy(partWordBuffer + partWordBufferIndex, s, take);
+    partWordBufferIndex += take;
+    s += take;
+    len -= take;
+  }
+}
+
+void ChapterHtmlSlimParser::flushPartWord(const EpdFontFamily::Style fontStyle) {
+  if (partWordBufferIndex == 0) {
+    return;
+  }
+  const bool hasAmpersand = memchr(partWordBuffer, '&', partWordBufferIndex) != nullptr;
+  addWord(partWordBuffer, partWordBufferIndex, hasAmpersand, fontStyle, partWordAttached);
+  partWordBufferIndex = 0;
+  partWordAttached = false;
 }
 
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
+  startTag(userData, lookupHtmlTag(name, strlen(name)), name, atts);
+}
+
+void ChapterHtmlSlimParser::startTag(void* userData, const HtmlTag tag, const char*, const char** atts) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
   // Middle of skip
@@ -64,14 +141,14 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
+  if (isImageTag(tag)) {
     // TODO: Start processing image tags
     self->skipUntilDepth = self->depth;
     self->depth += 1;
     return;
   }
 
-  if (matches(name, SKIP_TAGS, NUM_SKIP_TAGS)) {
+  if (isSkipTag(tag)) {
     // start skip
     self->skipUntilDepth = self->depth;
     self->depth += 1;
@@ -90,18 +167,18 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
   }
 
-  if (matches(name, HEADER_TAGS, NUM_HEADER_TAGS)) {
+  if (isHeaderTag(tag)) {
     self->startNewTextBlock(TextBlock::CENTER_ALIGN);
     self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
-  } else if (matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS)) {
-    if (strcmp(name, "br") == 0) {
+  } else if (isBlockTag(tag)) {
+    if (tag == HtmlTag::BR) {
       self->startNewTextBlock(self->currentTextBlock->getStyle());
     } else {
       self->startNewTextBlock(TextBlock::JUSTIFIED);
     }
-  } else if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) {
+  } else if (isBoldTag(tag)) {
     self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
-  } else if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) {
+  } else if (isItalicTag(tag)) {
     self->italicUntilDepth = std::min(self->italicUntilDepth, self->depth);
   }
 
@@ -125,26 +202,38 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     fontStyle = EpdFontFamily::ITALIC;
   }
 
-  for (int i = 0; i < len; i++) {
-    if (isWhitespace(s[i])) {
-      // Currently looking at whitespace, if there's anything in the partWordBuffer, flush it
-      if (self->partWordBufferIndex > 0) {
-        self->partWordBuffer[self->partWordBufferIndex] = '\0';
-        self->currentTextBlock->addWord(std::move(replaceHtmlEntities(self->partWordBuffer)), fontStyle);
-        self->partWordBufferIndex = 0;
-      }
-      // Skip the whitespace char
+  size_t i = 0;
+  const size_t length = len;
+  while (i < length) {
+    const size_t spaces = WordTokenizer::whitespaceLength(s + i, length - i);
+    if (spaces > 0) {
+      // Whitespace ends the word carried over from the previous call
+      self->flushPartWord(fontStyle);
+      i += spaces;
       continue;
     }
 
-    // If we're about to run out of space, then cut the word off and start a new one
-    if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
-      self->partWordBuffer[self->partWordBufferIndex] = '\0';
-      self->currentTextBlock->addWord(std::move(replaceHtmlEntities(self->partWordBuffer)), fontStyle);
-      self->partWordBufferIndex = 0;
+    bool hasAmpersand = false;
+    const size_t wordLen = WordTokenizer::wordLength(s + i, length - i, hasAmpersand);
+    const bool endsChunk = i + wordLen == length;
+    if (self->partWordBufferIndex > 0 || endsChunk) {
+      // Joins the previous call's piece or may continue in the next one, so it has to be buffered
+      self->appendToPartWord(s + i, wordLen, fontStyle);
+      if (!endsChunk) {
+        self->flushPartWord(fontStyle);
+      }
+    } else {
+      // Common case, the whole word is in this chunk and goes straight into the text block
+      // Words longer than MAX_WORD_SIZE are cut between characters into attached pieces
+      for (size_t offset = 0; offset < wordLen;) {
+        const size_t pieceLen = wordLen - offset > MAX_WORD_SIZE
+                                    ? utf8CutLength(s + i + offset, MAX_WORD_SIZE, s[i + offset + MAX_WORD_SIZE])
+                                    : wordLen - offset;
+        self->addWord(s + i + offset, pieceLen, hasAmpersand, fontStyle, offset > 0);
+        offset += pieceLen;
+      }
     }
-
-    self->partWordBuffer[self->partWordBufferIndex++] = s[i];
+    i += wordLen;
   }
 
   // If we have > 750 words buffered up, perform the layout and consume out all but the last line
@@ -160,6 +249,10 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
 }
 
 void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
+  endTag(userData, lookupHtmlTag(name, strlen(name)));
+}
+
+void ChapterHtmlSlimParser::endTag(void* userData, const HtmlTag tag) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
   if (self->partWordBufferIndex > 0) {
@@ -168,8 +261,7 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
     // Currently this also flushes out on closing <b> and <i> tags, but they are line tags so that shouldn't happen,
     // text styling needs to be overhauled to fix it.
     const bool shouldBreakText =
-        matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS) || matches(name, HEADER_TAGS, NUM_HEADER_TAGS) ||
-        matches(name, BOLD_TAGS, NUM_BOLD_TAGS) || matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) || self->depth == 1;
+        isBlockTag(tag) || isHeaderTag(tag) || isBoldTag(tag) || isItalicTag(tag) || self->depth == 1;
 
     if (shouldBreakText) {
       EpdFontFamily::Style fontStyle = EpdFontFamily::REGULAR;
@@ -181,9 +273,7 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
         fontStyle = EpdFontFamily::ITALIC;
       }
 
-      self->partWordBuffer[self->partWordBufferIndex] = '\0';
-      self->currentTextBlock->addWord(std::move(replaceHtmlEntities(self->partWordBuffer)), fontStyle);
-      self->partWordBufferIndex = 0;
+      self->flushPartWord(fontStyle);
     }
   }
 
@@ -205,9 +295,50 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 }
 
-bool ChapterHtmlSlimParser::parseAndBuildPages() {
-  startNewTextBlock(TextBlock::JUSTIFIED);
+void ChapterHtmlSlimParser::reportProgress(const size_t bytesRead, const size_t totalSize, int& lastProgress) const {
+  // Update progress (call every 10% change to avoid too frequent updates)
+  // Only show progress for larger chapters where rendering overhead is worth it
+  if (progressFn && totalSize >= MIN_SIZE_FOR_PROGRESS) {
+    const int progress = static_cast<int>((bytesRead * 100) / totalSize);
+    if (lastProgress / 10 != progress / 10) {
+      lastProgress = progress;
+      progressFn(progress);
+    }
+  }
+}
+
+bool ChapterHtmlSlimParser::parseWithTokenizer(FsFile& file) {
+  const std::unique_ptr<XhtmlTokenizer> tokenizer(new (std::nothrow)
+                                                      XhtmlTokenizer(this, startTag, endTag, characterData));
+  const std::unique_ptr<char[]> buffer(new (std::nothrow) char[READ_BUFFER_SIZE]);
+  if (!tokenizer || !buffer) {
+    Serial.printf("[%lu] [EHP] Couldn't allocate memory for tokenizer\n", millis());
+    return false;
+  }
 
+  const size_t totalSize = file.size();
+  size_t bytesRead = 0;
+  int lastProgress = -1;
+  while (true) {
+    const int len = file.read(buffer.get(), READ_BUFFER_SIZE);
+    if (len <= 0) {
+      if (file.available() > 0) {
+        Serial.printf("[%lu] [EHP] File read error\n", millis());
+        return false;
+      }
+      break;
+    }
+
+    bytesRead += len;
+    reportProgress(bytesRead, totalSize, lastProgress);
+    tokenizer->feed(buffer.get(), len);
+  }
+
+  tokenizer->finish();
+  return true;
+}
+
+bool ChapterHtmlSlimParser::parseWithExpat(FsFile& file) {
   const XML_Parser parser = XML_ParserCreate(nullptr);
   int done;
 
@@ -216,12 +347,6 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
     return false;
   }
 
-  FsFile file;
-  if (!SdMan.openFileForRead("EHP", filepath, file)) {
-    XML_ParserFree(parser);
-    return false;
-  }
-
   // Get file size for progress calculation
   const size_t totalSize = file.size();
   size_t bytesRead = 0;
@@ -232,18 +357,17 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_SetCharacterDataHandler(parser, characterData);
 
   do {
-    void* const buf = XML_GetBuffer(parser, 1024);
+    void* const buf = XML_GetBuffer(parser, READ_BUFFER_SIZE);
     if (!buf) {
       Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
       XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
 
-    const size_t len = file.read(buf, 1024);
+    const size_t len = file.read(buf, READ_BUFFER_SIZE);
 
     if (len == 0 && file.available() > 0) {
       Serial.printf("[%lu] [EHP] File read error\n", millis());
@@ -251,20 +375,11 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
 
-    // Update progress (call every 10% change to avoid too frequent updates)
-    // Only show progress for larger chapters where rendering overhead is worth it
     bytesRead += len;
-    if (progressFn && totalSize >= MIN_SIZE_FOR_PROGRESS) {
-      const int progress = static_cast<int>((bytesRead * 100) / totalSize);
-      if (lastProgress / 10 != progress / 10) {
-        lastProgress = progress;
-        progressFn(progress);
-      }
-    }
+    reportProgress(bytesRead, totalSize, lastProgress);
 
     done = file.available() == 0;
 
@@ -275,7 +390,6 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
   } while (!done);
@@ -284,7 +398,26 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
   XML_SetCharacterDataHandler(parser, nullptr);
   XML_ParserFree(parser);
+  return true;
+}
+
+bool ChapterHtmlSlimParser::parseAndBuildPages() {
+  startNewTextBlock(TextBlock::JUSTIFIED);
+
+  FsFile file;
+  if (!SdMan.openFileForRead("EHP", filepath, file)) {
+    return false;
+  }
+
+#ifdef EPUB_STRICT_XHTML_PARSER
+  const bool parsed = parseWithExpat(file);
+#else
+  const bool parsed = parseWithTokenizer(file);
+#endif
   file.close();
+  if (!parsed) {
+    return false;
+  }
 
   // Process last page if there is still text
   if (currentTextBlock) {
@@ -8,7 +8,9 @@
 
 #include "../ParsedText.h"
 #include "../blocks/TextBlock.h"
+#include "XhtmlTokenizer.h"
 
+class FsFile;
 class Page;
 class GfxRenderer;
 
@@ -27,17 +29,29 @@ class ChapterHtmlSlimParser {
   // leave one char at end for null pointer
   char partWordBuffer[MAX_WORD_SIZE + 1] = {};
   int partWordBufferIndex = 0;
+  bool partWordAttached = false;  // The buffered word continues one that was cut off at MAX_WORD_SIZE
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
   int fontId;
   float lineCompression;
   bool extraParagraphSpacing;
+  const Hyphenator* hyphenator;
   uint16_t viewportWidth;
   uint16_t viewportHeight;
 
   void startNewTextBlock(TextBlock::Style style);
   void makePages();
+  void addWord(const char* word, size_t len, bool hasAmpersand, EpdFontFamily::Style fontStyle,
+               bool attachToPrevious = false);
+  void appendToPartWord(const char* s, size_t len, EpdFontFamily::Style fontStyle);
+  void flushPartWord(EpdFontFamily::Style fontStyle);
+  void reportProgress(size_t bytesRead, size_t totalSize, int& lastProgress) const;
+  bool parseWithTokenizer(FsFile& file);
+  bool parseWithExpat(FsFile& file);
+  // Tokenizer callbacks, the XML callbacks map names to tags and forward to these
+  static void startTag(void* userData, HtmlTag tag, const char* name, const char** atts);
+  static void endTag(void* userData, HtmlTag tag);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
@@ -46,7 +60,8 @@ class ChapterHtmlSlimParser {
  public:
   explicit ChapterHtmlSlimParser(const std::string& filepath, GfxRenderer& renderer, const int fontId,
                                  const float lineCompression, const bool extraParagraphSpacing,
-                                 const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                 const Hyphenator* hyphenator, const uint16_t viewportWidth,
+                                 const uint16_t viewportHeight,
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
                                  const std::function<void(int)>& progressFn = nullptr)
       : filepath(filepath),
@@ -54,6 +69,7 @@ class ChapterHtmlSlimParser {
         fontId(fontId),
         lineCompression(lineCompression),
         extraParagraphSpacing(extraParagraphSpacing),
+        hyphenator(hyphenator),
         viewportWidth(viewportWidth),
         viewportHeight(viewportHeight),
         completePageFn(completePageFn),
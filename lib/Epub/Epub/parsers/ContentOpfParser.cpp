@@ -9,6 +9,21 @@
 namespace {
 constexpr char MEDIA_TYPE_NCX[] = "application/x-dtbncx+xml";
 constexpr char itemCacheFile[] = "/.items.bin";
+
+// font/ttf, application/x-font-ttf, application/vnd.ms-opentype and so on, or a font file extension
+bool isFontItem(const std::string& mediaType, const std::string& href) {
+  if (mediaType.find("font") != std::string::npos || mediaType.find("opentype") != std::string::npos) {
+    return true;
+  }
+  if (href.size() < 4) {
+    return false;
+  }
+  std::string extension = href.substr(href.size() - 4);
+  for (auto& c : extension) {
+    c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+  }
+  return extension == ".ttf" || extension == ".otf";
+}
 }  // namespace
 
 bool ContentOpfParser::setup() {
@@ -107,6 +122,12 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
     return;
   }
 
+  // Books can list several languages, the first one is the main one
+  if (self->state == IN_METADATA && strcmp(name, "dc:language") == 0 && self->language.empty()) {
+    self->state = IN_BOOK_LANGUAGE;
+    return;
+  }
+
   if (self->state == IN_PACKAGE && (strcmp(name, "manifest") == 0 || strcmp(name, "opf:manifest") == 0)) {
     self->state = IN_MANIFEST;
     if (!SdMan.openFileForWrite("COF", self->cachePath + itemCacheFile, self->tempItemStore)) {
@@ -188,6 +209,11 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
                       href.c_str());
       }
     }
+
+    if (isFontItem(mediaType, href)) {
+      self->fontHrefs += href;
+      self->fontHrefs += '\n';
+    }
     return;
   }
 
@@ -254,6 +280,11 @@ void XMLCALL ContentOpfParser::characterData(void* userData, const XML_Char* s,
     self->author.append(s, len);
     return;
   }
+
+  if (self->state == IN_BOOK_LANGUAGE) {
+    self->language.append(s, len);
+    return;
+  }
 }
 
 void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name) {
@@ -288,6 +319,11 @@ void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name)
     return;
   }
 
+  if (self->state == IN_BOOK_LANGUAGE && strcmp(name, "dc:language") == 0) {
+    self->state = IN_METADATA;
+    return;
+  }
+
   if (self->state == IN_METADATA && (strcmp(name, "metadata") == 0 || strcmp(name, "opf:metadata") == 0)) {
     self->state = IN_PACKAGE;
     return;
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Splits chapter text into words, looking at four bytes per step instead of one.
+ *
+ * Expat hands over text that can only contain tab, LF, CR and characters from 0x20 up, so "whitespace" is simply any
+ * byte <= 0x20. The word scan also stops on '&', the only byte that needs a closer look (entity decoding), which lets
+ * the caller skip that pass for the vast majority of words.
+ *
+ * The bit tricks flag a byte by setting its top bit. Borrows and carries can only produce false flags in bytes above a
+ * genuinely flagged one, so the lowest flag is always exact, which is the only one used.
+ */
+namespace WordTokenizer {
+constexpr uint32_t ONES = 0x01010101u;
+constexpr uint32_t HIGHS = 0x80808080u;
+
+inline uint32_t load(const char* p) {
+  uint32_t word;
+  memcpy(&word, p, sizeof(word));  // Compiles to a single load where unaligned access is allowed
+  return word;
+}
+
+// Top bit set in bytes <= 0x20 (whitespace) or equal to '&'
+inline uint32_t delimiterMask(const uint32_t word) {
+  const uint32_t lessThan = (word - ONES * 0x21) & ~word & HIGHS;
+  const uint32_t amp = word ^ (ONES * '&');
+  const uint32_t isAmp = (amp - ONES) & ~amp & HIGHS;
+  return lessThan | isAmp;
+}
+
+// Top bit set in bytes > 0x20
+inline uint32_t nonWhitespaceMask(const uint32_t word) { return ((word + ONES * (0x7F - 0x20)) | word) & HIGHS; }
+
+// Index of the lowest flagged byte, the text is read little endian (RISC-V, x86 and ARM all are)
+inline size_t firstFlagged(const uint32_t mask) { return __builtin_ctz(mask) >> 3; }
+
+inline bool isWhitespace(const char c) { return static_cast<uint8_t>(c) <= 0x20; }
+
+// Number of whitespace bytes at the start of s
+inline size_t whitespaceLength(const char* s, const size_t len) {
+  size_t i = 0;
+  // Almost always a single space between words, check that before setting up the wide scan
+  if (i < len && !isWhitespace(s[i])) {
+    return 0;
+  }
+  for (; i + 4 <= len; i += 4) {
+    const uint32_t mask = nonWhitespaceMask(load(s + i));
+    if (mask) {
+      return i + firstFlagged(mask);
+    }
+  }
+  while (i < len && isWhitespace(s[i])) {
+    i++;
+  }
+  return i;
+}
+
+// Number of word bytes at the start of s, hasAmpersand is set when the word contains a '&'
+inline size_t wordLength(const char* s, const size_t len, bool& hasAmpersand) {
+  size_t i = 0;
+  while (true) {
+    for (; i + 4 <= len; i += 4) {
+      const uint32_t mask = delimiterMask(load(s + i));
+      if (mask) {
+        i += firstFlagged(mask);
+        break;
+      }
+    }
+    while (i < len && !isWhitespace(s[i]) && s[i] != '&') {
+      i++;
+    }
+    if (i == len || s[i] != '&') {
+      return i;
+    }
+    // Part of the word, keep scanning past it
+    hasAmpersand = true;
+    i++;
+  }
+}
+}  // namespace WordTokenizer
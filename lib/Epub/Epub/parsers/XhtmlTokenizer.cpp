@@ -0,0 +1,516 @@
+#include "XhtmlTokenizer.h"
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+struct TagName {
+  const char* name;
+  HtmlTag tag;
+};
+
+constexpr TagName TAG_NAMES[] = {
+    {"html", HtmlTag::HTML},     {"head", HtmlTag::HEAD},     {"title", HtmlTag::TITLE},
+    {"body", HtmlTag::BODY},     {"p", HtmlTag::P},           {"li", HtmlTag::LI},
+    {"div", HtmlTag::DIV},       {"br", HtmlTag::BR},         {"blockquote", HtmlTag::BLOCKQUOTE},
+    {"h1", HtmlTag::H1},         {"h2", HtmlTag::H2},         {"h3", HtmlTag::H3},
+    {"h4", HtmlTag::H4},         {"h5", HtmlTag::H5},         {"h6", HtmlTag::H6},
+    {"b", HtmlTag::B},           {"strong", HtmlTag::STRONG}, {"i", HtmlTag::I},
+    {"em", HtmlTag::EM},         {"span", HtmlTag::SPAN},     {"a", HtmlTag::A},
+    {"img", HtmlTag::IMG},       {"image", HtmlTag::IMAGE},   {"svg", HtmlTag::SVG},
+    {"table", HtmlTag::TABLE},   {"script", HtmlTag::SCRIPT}, {"style", HtmlTag::STYLE},
+    {"hr", HtmlTag::HR},         {"meta", HtmlTag::META},     {"link", HtmlTag::LINK},
+    {"col", HtmlTag::COL},       {"area", HtmlTag::AREA},     {"base", HtmlTag::BASE},
+    {"wbr", HtmlTag::WBR},       {"source", HtmlTag::SOURCE}, {"embed", HtmlTag::EMBED},
+    {"param", HtmlTag::PARAM},   {"track", HtmlTag::TRACK},
+};
+constexpr size_t TAG_COUNT = sizeof(TAG_NAMES) / sizeof(TAG_NAMES[0]);
+constexpr size_t MAX_TAG_NAME_LENGTH = 10;
+
+// Coefficients found by search so that every name above lands in its own slot
+constexpr size_t TAG_TABLE_SIZE = 128;
+constexpr size_t tagHash(const char* name, const size_t len) {
+  const auto first = static_cast<uint8_t>(name[0]);
+  const auto second = static_cast<uint8_t>(len > 1 ? name[1] : name[0]);
+  const auto last = static_cast<uint8_t>(name[len - 1]);
+  return (len + 3 * first + 10 * second + 9 * last) & (TAG_TABLE_SIZE - 1);
+}
+
+constexpr size_t constLength(const char* s) {
+  size_t len = 0;
+  while (s[len]) {
+    len++;
+  }
+  return len;
+}
+
+// Slot -> index into TAG_NAMES + 1, 0 for an empty slot
+constexpr std::array<uint8_t, TAG_TABLE_SIZE> buildTagTable() {
+  std::array<uint8_t, TAG_TABLE_SIZE> table{};
+  for (size_t i = 0; i < TAG_COUNT; i++) {
+    table[tagHash(TAG_NAMES[i].name, constLength(TAG_NAMES[i].name))] = i + 1;
+  }
+  return table;
+}
+constexpr std::array<uint8_t, TAG_TABLE_SIZE> TAG_TABLE = buildTagTable();
+
+constexpr bool isPerfect() {
+  size_t used = 0;
+  for (const uint8_t slot : TAG_TABLE) {
+    used += slot != 0;
+  }
+  return used == TAG_COUNT;
+}
+static_assert(isPerfect(), "Tag names collide in the hash table, search new coefficients for tagHash");
+
+bool isVoidElement(const HtmlTag tag) {
+  switch (tag) {
+    case HtmlTag::BR:
+    case HtmlTag::IMG:
+    case HtmlTag::HR:
+    case HtmlTag::META:
+    case HtmlTag::LINK:
+    case HtmlTag::COL:
+    case HtmlTag::AREA:
+    case HtmlTag::BASE:
+    case HtmlTag::WBR:
+    case HtmlTag::SOURCE:
+    case HtmlTag::EMBED:
+    case HtmlTag::PARAM:
+    case HtmlTag::TRACK:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool isSpace(const char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+bool isNameStart(const char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'; }
+
+bool isEntityChar(const char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '#';
+}
+
+// FNV-1a, enough to tell open elements apart when matching end tags
+uint32_t nameHash(const char* name, const size_t len) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ static_cast<uint8_t>(name[i])) * 16777619u;
+  }
+  return hash;
+}
+
+size_t encodeUtf8(const uint32_t cp, char* out) {
+  if (cp < 0x80) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (cp >> 6));
+    out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (cp >> 12));
+    out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | (cp >> 18));
+  out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+  return 4;
+}
+// UTF-8 of a character reference or one of the XML entities, from '&' to ';'. 0 for anything else
+size_t decodeEntity(const char* entity, const size_t length, char* out) {
+  if (length < 3 || entity[0] != '&' || entity[length - 1] != ';') {
+    return 0;
+  }
+  if (entity[1] == '#') {
+    const bool hex = entity[2] == 'x' || entity[2] == 'X';
+    char* end = nullptr;
+    const unsigned long cp = strtoul(entity + (hex ? 3 : 2), &end, hex ? 16 : 10);
+    // U+00A0 stays a no-break space inside the word, like &nbsp; and like expat delivered it
+    if (end != entity + length - 1 || cp == 0 || cp > 0x10FFFF) {
+      return 0;
+    }
+    // Surrogates are no characters of their own and have no valid UTF-8 form
+    return encodeUtf8(cp >= 0xD800 && cp <= 0xDFFF ? 0xFFFD : cp, out);
+  }
+
+  struct XmlEntity {
+    const char* name;
+    char value;
+  };
+  static constexpr XmlEntity XML_ENTITIES[] = {
+      {"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&apos;", '\''},
+  };
+  for (const auto& xmlEntity : XML_ENTITIES) {
+    if (strncmp(entity, xmlEntity.name, length) == 0 && xmlEntity.name[length] == '\0') {
+      out[0] = xmlEntity.value;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Decode the references in an attribute value in place, decoded text is never longer than the reference
+void decodeAttributeValue(char* value, const size_t maxEntityLength) {
+  char* out = value;
+  const char* in = value;
+  while (*in) {
+    if (*in == '&') {
+      size_t length = 1;
+      while (length < maxEntityLength && isEntityChar(in[length])) {
+        length++;
+      }
+      char decoded[4];
+      const size_t decodedLength = in[length] == ';' ? decodeEntity(in, length + 1, decoded) : 0;
+      if (decodedLength > 0) {
+        memcpy(out, decoded, decodedLength);
+        out += decodedLength;
+        in += length + 1;
+        continue;
+      }
+    }
+    *out++ = *in++;
+  }
+  *out = '\0';
+}
+}  // namespace
+
+HtmlTag lookupHtmlTag(const char* name, size_t len) {
+  const char* colon = static_cast<const char*>(memchr(name, ':', len));
+  if (colon) {
+    len -= colon + 1 - name;
+    name = colon + 1;
+  }
+  if (len == 0 || len > MAX_TAG_NAME_LENGTH) {
+    return HtmlTag::UNKNOWN;
+  }
+
+  const uint8_t slot = TAG_TABLE[tagHash(name, len)];
+  if (slot == 0) {
+    return HtmlTag::UNKNOWN;
+  }
+  const TagName& candidate = TAG_NAMES[slot - 1];
+  return strncmp(candidate.name, name, len) == 0 && candidate.name[len] == '\0' ? candidate.tag : HtmlTag::UNKNOWN;
+}
+
+void XhtmlTokenizer::emitText(const char* s, const size_t len) const {
+  // Like expat, text outside of the root element (and inside script or style) is not reported
+  if (len > 0 && !inRawText && depth + untrackedDepth > 0) {
+    characterDataHandler(userData, s, static_cast<int>(len));
+  }
+}
+
+void XhtmlTokenizer::flushEntity(const bool terminated) {
+  char decoded[4];
+  const size_t decodedLength = terminated ? decodeEntity(entity, entityLength, decoded) : 0;
+  if (decodedLength > 0) {
+    emitText(decoded, decodedLength);
+  } else {
+    // Unknown (HTML) entity or a lone '&', leave it for the consumer
+    emitText(entity, entityLength);
+  }
+  entityLength = 0;
+}
+
+void XhtmlTokenizer::collectMarkup(const char c) {
+  if (quote) {
+    if (c == quote) {
+      quote = 0;
+    }
+  } else if ((c == '"' || c == '\'') && lastMarkupChar == '=') {
+    quote = c;
+  } else if (c == '>') {
+    markup[markupLength] = '\0';
+    state = State::TEXT;
+    handleMarkup();
+    return;
+  }
+
+  if (!isSpace(c)) {
+    lastMarkupChar = c;
+  }
+  if (markupLength < MAX_MARKUP_LENGTH) {
+    markup[markupLength++] = c;
+  }
+
+  // Comments and CDATA end with their own terminator rather than the first '>'
+  if (markupLength == 3 && memcmp(markup, "!--", 3) == 0) {
+    state = State::COMMENT;
+    terminatorMatched = 0;
+  } else if (markupLength == 8 && memcmp(markup, "![CDATA[", 8) == 0) {
+    state = State::CDATA;
+    terminatorMatched = 0;
+  }
+}
+
+void XhtmlTokenizer::feed(const char* data, const size_t len) {
+  const char* p = data;
+  const char* end = data + len;
+
+  while (p < end) {
+    switch (state) {
+      case State::TEXT: {
+        const char* stop = p;
+        while (stop < end && *stop != '<' && *stop != '&') {
+          stop++;
+        }
+        emitText(p, stop - p);
+        p = stop;
+        if (p == end) {
+          break;
+        }
+        if (*p == '<') {
+          state = State::MARKUP;
+          markupLength = 0;
+          quote = 0;
+          lastMarkupChar = 0;
+        } else {
+          state = State::ENTITY;
+          entity[0] = '&';
+          entityLength = 1;
+        }
+        p++;
+        break;
+      }
+
+      case State::ENTITY:
+        if (*p == ';') {
+          entity[entityLength++] = ';';
+          p++;
+          state = State::TEXT;
+          flushEntity(true);
+        } else if (isEntityChar(*p) && entityLength < MAX_ENTITY_LENGTH - 1) {
+          entity[entityLength++] = *p++;
+        } else {
+          // Not an entity after all, the current character is looked at again as text
+          state = State::TEXT;
+          flushEntity(false);
+        }
+        break;
+
+      case State::MARKUP:
+        if (markupLength == 0 && (inRawText ? *p != '/' : !isNameStart(*p) && *p != '/' && *p != '!' && *p != '?')) {
+          // "a < b" in text, script content only ends with an end tag
+          state = State::TEXT;
+          emitText("<", 1);
+          break;
+        }
+        collectMarkup(*p++);
+        break;
+
+      case State::COMMENT:
+        if (*p == '>' && terminatorMatched >= 2) {
+          state = State::TEXT;
+        } else {
+          // Only the last two dashes matter, a long run of them must not wrap the counter
+          terminatorMatched = *p == '-' ? (terminatorMatched < 2 ? terminatorMatched + 1 : 2) : 0;
+        }
+        p++;
+        break;
+
+      case State::CDATA: {
+        if (*p == ']') {
+          // Only the last two brackets can start "]]>", earlier ones are text
+          if (terminatorMatched == 2) {
+            emitText("]", 1);
+          } else {
+            terminatorMatched++;
+          }
+          p++;
+          break;
+        }
+        if (*p == '>' && terminatorMatched == 2) {
+          state = State::TEXT;
+          p++;
+          break;
+        }
+        for (; terminatorMatched > 0; terminatorMatched--) {
+          emitText("]", 1);
+        }
+        const char* stop = p;
+        while (stop < end && *stop != ']') {
+          stop++;
+        }
+        emitText(p, stop - p);
+        p = stop;
+        break;
+      }
+    }
+  }
+}
+
+void XhtmlTokenizer::finish() {
+  if (state == State::ENTITY) {
+    flushEntity(false);
+  }
+  state = State::TEXT;
+  while (depth + untrackedDepth > 0) {
+    closeElement();
+  }
+}
+
+void XhtmlTokenizer::handleMarkup() {
+  // Processing instructions and declarations (<?xml ...?>, <!DOCTYPE ...>) carry nothing for the page
+  if (markupLength == 0 || markup[0] == '?' || markup[0] == '!') {
+    return;
+  }
+
+  const bool isEndTag = markup[0] == '/';
+  char* name = markup + (isEndTag ? 1 : 0);
+  size_t nameLength = 0;
+  while (name[nameLength] && !isSpace(name[nameLength]) && name[nameLength] != '/') {
+    char& c = name[nameLength++];
+    if (c >= 'A' && c <= 'Z') {
+      c = static_cast<char>(c - 'A' + 'a');
+    }
+  }
+  if (nameLength == 0) {
+    return;
+  }
+
+  if (isEndTag) {
+    handleEndTag(name, nameLength);
+  } else {
+    handleStartTag(name, nameLength, name + nameLength);
+  }
+}
+
+void XhtmlTokenizer::handleStartTag(char* name, const size_t nameLength, char* rest) {
+  const HtmlTag tag = lookupHtmlTag(name, nameLength);
+
+  // In script or style content only the closing tag counts
+  if (inRawText) {
+    return;
+  }
+
+  // A trailing '/' makes the element self-closing
+  char* tail = markup + markupLength;
+  while (tail > rest && isSpace(tail[-1])) {
+    tail--;
+  }
+  const bool selfClosing = tail > rest && tail[-1] == '/';
+  if (selfClosing) {
+    tail--;
+  }
+  *tail = '\0';
+
+  // Split the attributes in place, names and values are terminated where the separators were
+  size_t attributeCount = 0;
+  char* p = rest;
+  while (true) {
+    while (*p && (isSpace(*p) || *p == '/')) {
+      p++;
+    }
+    if (!*p) {
+      break;
+    }
+
+    char* attributeName = p;
+    while (*p && !isSpace(*p) && *p != '=' && *p != '/') {
+      p++;
+    }
+    char* attributeNameEnd = p;
+    while (isSpace(*p)) {
+      p++;
+    }
+
+    char* value = nullptr;
+    if (*p == '=') {
+      p++;
+      while (isSpace(*p)) {
+        p++;
+      }
+      if (*p == '"' || *p == '\'') {
+        const char valueQuote = *p++;
+        value = p;
+        while (*p && *p != valueQuote) {
+          p++;
+        }
+      } else {
+        value = p;
+        while (*p && !isSpace(*p)) {
+          p++;
+        }
+      }
+      if (*p) {
+        *p++ = '\0';
+      }
+    }
+    *attributeNameEnd = '\0';
+
+    if (attributeCount < MAX_ATTRIBUTES) {
+      if (value) {
+        decodeAttributeValue(value, MAX_ENTITY_LENGTH);
+      }
+      atts[attributeCount * 2] = attributeName;
+      atts[attributeCount * 2 + 1] = value ? value : "";
+      attributeCount++;
+    }
+  }
+  atts[attributeCount * 2] = nullptr;
+  name[nameLength] = '\0';
+
+  if (depth < MAX_DEPTH) {
+    openElements[depth++] = {nameHash(name, nameLength), tag};
+  } else {
+    untrackedDepth++;
+  }
+  startHandler(userData, tag, name, atts);
+
+  if (selfClosing || isVoidElement(tag)) {
+    closeElement();
+  } else if (tag == HtmlTag::SCRIPT || tag == HtmlTag::STYLE) {
+    inRawText = true;
+    rawTextTag = tag;
+  }
+}
+
+void XhtmlTokenizer::handleEndTag(char* name, const size_t nameLength) {
+  const HtmlTag tag = lookupHtmlTag(name, nameLength);
+  // Void elements were closed when they started, </br> and friends are noise
+  if (isVoidElement(tag)) {
+    return;
+  }
+  // Script or style content only ends with its own end tag. Nothing opens inside it, so the innermost element is the
+  // one to close, even when it was nested too deep to be tracked
+  if (inRawText) {
+    if (tag == rawTextTag) {
+      closeElement();
+    }
+    return;
+  }
+  if (untrackedDepth > 0) {
+    closeElement();
+    return;
+  }
+
+  const uint32_t hash = nameHash(name, nameLength);
+
+  // Close everything left open inside the matching element, drop the tag when nothing matches
+  for (size_t i = depth; i > 0; i--) {
+    if (openElements[i - 1].nameHash == hash) {
+      while (depth >= i) {
+        closeElement();
+      }
+      return;
+    }
+  }
+}
+
+void XhtmlTokenizer::closeElement() {
+  HtmlTag tag = HtmlTag::UNKNOWN;
+  if (untrackedDepth > 0) {
+    untrackedDepth--;
+  } else {
+    tag = openElements[--depth].tag;
+  }
+  inRawText = false;
+  endHandler(userData, tag);
+}
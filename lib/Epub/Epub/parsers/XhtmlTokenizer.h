@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Elements the chapter parser or the tokenizer itself treat specially, everything else is UNKNOWN
+enum class HtmlTag : uint8_t {
+  UNKNOWN,
+  HTML,
+  HEAD,
+  TITLE,
+  BODY,
+  P,
+  LI,
+  DIV,
+  BR,
+  BLOCKQUOTE,
+  H1,
+  H2,
+  H3,
+  H4,
+  H5,
+  H6,
+  B,
+  STRONG,
+  I,
+  EM,
+  SPAN,
+  A,
+  IMG,
+  IMAGE,
+  SVG,
+  TABLE,
+  SCRIPT,
+  STYLE,
+  HR,
+  META,
+  LINK,
+  COL,
+  AREA,
+  BASE,
+  WBR,
+  SOURCE,
+  EMBED,
+  PARAM,
+  TRACK,
+};
+
+// Tag ID of a lowercase element name through a perfect hash, a namespace prefix ("svg:image") is ignored
+HtmlTag lookupHtmlTag(const char* name, size_t len);
+
+/**
+ * Streaming, fault tolerant XHTML tokenizer for chapter content, a lightweight alternative to a full expat instance.
+ *
+ * Input is pushed in with feed() in chunks of any size. Text is handed to the character data handler straight from
+ * the input, only tags are collected in a fixed buffer, so nothing is allocated while tokenizing. Elements come with
+ * their HtmlTag ID and an expat style NULL terminated name/value array whose strings point into that buffer.
+ *
+ * Broken markup doesn't stop it:
+ * - End tags close any elements left open inside them, end tags without a matching open element are dropped
+ * - Void elements (<br>, <img>, ...) close themselves with or without the trailing slash
+ * - A '<' or '&' that doesn't start markup or an entity is kept as text
+ * - Elements still open at the end of the input are closed by finish()
+ * Start and end handler calls are therefore always balanced.
+ *
+ * Character references and the five XML entities are decoded in text and attribute values, other named entities are
+ * passed through untouched.
+ * Comments, processing instructions and DOCTYPE are skipped, CDATA sections become text and the content of <script>
+ * and <style> is dropped.
+ */
+class XhtmlTokenizer {
+ public:
+  typedef void (*StartElementHandler)(void* userData, HtmlTag tag, const char* name, const char** atts);
+  typedef void (*EndElementHandler)(void* userData, HtmlTag tag);
+  typedef void (*CharacterDataHandler)(void* userData, const char* s, int len);
+
+ private:
+  enum class State : uint8_t { TEXT, ENTITY, MARKUP, COMMENT, CDATA };
+
+  // Longer tags are cut, only their leading attributes are seen
+  static constexpr size_t MAX_MARKUP_LENGTH = 512;
+  static constexpr size_t MAX_ATTRIBUTES = 16;
+  static constexpr size_t MAX_DEPTH = 64;
+  static constexpr size_t MAX_ENTITY_LENGTH = 12;
+
+  struct OpenElement {
+    uint32_t nameHash;
+    HtmlTag tag;
+  };
+
+  void* userData;
+  StartElementHandler startHandler;
+  EndElementHandler endHandler;
+  CharacterDataHandler characterDataHandler;
+
+  State state = State::TEXT;
+  char markup[MAX_MARKUP_LENGTH + 1] = {};
+  size_t markupLength = 0;
+  char quote = 0;           // Quote character of the attribute value being collected
+  char lastMarkupChar = 0;  // Last non whitespace character collected, a quote only opens a value after '='
+  uint8_t terminatorMatched = 0;
+  char entity[MAX_ENTITY_LENGTH + 1] = {};
+  size_t entityLength = 0;
+  const char* atts[MAX_ATTRIBUTES * 2 + 1] = {};
+  OpenElement openElements[MAX_DEPTH] = {};
+  size_t depth = 0;
+  size_t untrackedDepth = 0;  // Elements nested deeper than MAX_DEPTH, closed by whatever end tag comes next
+  bool inRawText = false;     // Inside <script> or <style>
+  HtmlTag rawTextTag = HtmlTag::UNKNOWN;
+
+  void emitText(const char* s, size_t len) const;
+  void flushEntity(bool terminated);
+  void collectMarkup(char c);
+  void handleMarkup();
+  void handleStartTag(char* name, size_t nameLength, char* rest);
+  void handleEndTag(char* name, size_t nameLength);
+  void closeElement();
+
+ public:
+  XhtmlTokenizer(void* userData, const StartElementHandler startHandler, const EndElementHandler endHandler,
+                 const CharacterDataHandler characterDataHandler)
+      : userData(userData),
+        startHandler(startHandler),
+        endHandler(endHandler),
+        characterDataHandler(characterDataHandler) {}
+
+  void feed(const char* data, size_t len);
+  // Signal the end of the input, closes elements that are still open
+  void finish();
+};
@@ -1,5 +1,7 @@
 #include "FsHelpers.h"
 
+#include <cstdio>
+#include <functional>
 #include <vector>
 
 std::string FsHelpers::normalisePath(const std::string& path) {
@@ -37,3 +39,14 @@ std::string FsHelpers::normalisePath(const std::string& path) {
 
   return result;
 }
+
+std::string FsHelpers::bookCachePath(const std::string& cacheDir, const char* prefix, const std::string& bookPath) {
+  const size_t hash = std::hash<std::string>{}(bookPath);
+  return bookCacheShardPath(cacheDir, hash) + "/" + prefix + "_" + std::to_string(hash);
+}
+
+std::string FsHelpers::bookCacheShardPath(const std::string& cacheDir, const size_t hash) {
+  char shard[3];
+  snprintf(shard, sizeof(shard), "%02x", static_cast<unsigned>(hash & 0xFF));
+  return cacheDir + "/cache/" + shard;
+}
@@ -4,4 +4,10 @@
 class FsHelpers {
  public:
   static std::string normalisePath(const std::string& path);
+
+  // Cache folder of a book, <cacheDir>/cache/<xx>/<prefix>_<hash of the book path> where xx is the low byte of the hash
+  // in hex. Spread over 256 folders, no FAT directory a lookup has to scan grows much with the library.
+  static std::string bookCachePath(const std::string& cacheDir, const char* prefix, const std::string& bookPath);
+  // Folder of the books whose path hashes to hash
+  static std::string bookCacheShardPath(const std::string& cacheDir, size_t hash);
 };
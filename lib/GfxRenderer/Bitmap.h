@@ -37,6 +37,7 @@ class Bitmap {
   int getHeight() const { return height; }
   bool isTopDown() const { return topDown; }
   bool hasGreyscale() const { return bpp > 1; }
+  uint16_t getBpp() const { return bpp; }
   int getRowBytes() const { return rowBytes; }
 
  private:
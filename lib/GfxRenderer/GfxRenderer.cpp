@@ -2,7 +2,19 @@
 
 #include <Utf8.h>
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+#include <algorithm>
+#include <cstdlib>
+
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  // A font id can come back with other glyphs, drop words drawn with the old ones
+  wordCache.clear();
+  fontMap.insert({fontId, font});
+}
+
+void GfxRenderer::removeFont(const int fontId) {
+  wordCache.clear();
+  fontMap.erase(fontId);
+}
 
 void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int* rotatedY) const {
   switch (orientation) {
@@ -110,6 +122,143 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   }
 }
 
+void GfxRenderer::drawWord(const int fontId, const int x, const int y, const char* word,
+                           const EpdFontFamily::Style style) const {
+  // The gray passes draw the antialiasing only, leave those to drawText
+  if (renderMode != BW || word == nullptr || *word == '\0' || fontMap.count(fontId) == 0) {
+    drawText(fontId, x, y, word, true, style);
+    return;
+  }
+
+  const int yPos = y + getFontAscenderSize(fontId);
+  const WordBitmapCache::Strip* strip = wordCache.find(fontId, style, word);
+  if (!strip) {
+    WordBitmapCache::Strip rasterized;
+    if (rasterizeWord(fontMap.at(fontId), word, style, &rasterized)) {
+      strip = wordCache.insert(fontId, style, word, std::move(rasterized));
+    }
+  }
+
+  // Words too long to cache or partly off screen go glyph by glyph
+  if (!strip || !drawStrip(*strip, x, yPos)) {
+    drawText(fontId, x, y, word, true, style);
+  }
+}
+
+// Renders a word the way renderChar would in BW mode, into a strip in panel layout relative to the pen origin
+bool GfxRenderer::rasterizeWord(const EpdFontFamily& fontFamily, const char* text, const EpdFontFamily::Style style,
+                                WordBitmapCache::Strip* strip) const {
+  const auto glyphFor = [&](const uint32_t cp) {
+    const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
+    return glyph ? glyph : fontFamily.getGlyph('?', style);
+  };
+
+  // Ink bounds in logical coordinates relative to the pen origin on the baseline
+  int minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
+  int penX = 0;
+  const auto* p = reinterpret_cast<const uint8_t*>(text);
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(&p))) {
+    const EpdGlyph* glyph = glyphFor(cp);
+    if (!glyph) {
+      continue;
+    }
+    if (glyph->width > 0 && glyph->height > 0) {
+      minX = std::min(minX, penX + glyph->left);
+      maxX = std::max(maxX, penX + glyph->left + glyph->width - 1);
+      minY = std::min(minY, -glyph->top);
+      maxY = std::max(maxY, -glyph->top + glyph->height - 1);
+    }
+    penX += glyph->advanceX;
+  }
+  if (minX > maxX) {
+    return false;
+  }
+
+  // Rotation only turns the word around the pen origin, so the panel layout doesn't depend on where it is drawn
+  int originX, originY, cornerAX, cornerAY, cornerBX, cornerBY;
+  rotateCoordinates(0, 0, &originX, &originY);
+  rotateCoordinates(minX, minY, &cornerAX, &cornerAY);
+  rotateCoordinates(maxX, maxY, &cornerBX, &cornerBY);
+  strip->offsetX = static_cast<int16_t>(std::min(cornerAX, cornerBX) - originX);
+  strip->offsetY = static_cast<int16_t>(std::min(cornerAY, cornerBY) - originY);
+  strip->width = static_cast<uint16_t>(std::abs(cornerBX - cornerAX) + 1);
+  strip->height = static_cast<uint16_t>(std::abs(cornerBY - cornerAY) + 1);
+  const size_t rowBytes = strip->getRowBytes();
+  if (rowBytes * strip->height > WordBitmapCache::MAX_STRIP_BYTES) {
+    return false;
+  }
+  strip->bits.assign(rowBytes * strip->height, 0);
+
+  penX = 0;
+  p = reinterpret_cast<const uint8_t*>(text);
+  while ((cp = utf8NextCodepoint(&p))) {
+    const EpdGlyph* glyph = glyphFor(cp);
+    if (!glyph) {
+      continue;
+    }
+
+    const bool is2Bit = fontFamily.getData(style)->is2Bit;
+    const uint8_t* bitmap = &fontFamily.getData(style)->bitmap[glyph->dataOffset];
+    for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+      for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+        const int pixelPosition = glyphY * glyph->width + glyphX;
+        // Anything but white is black in BW mode
+        const bool ink = is2Bit ? (bitmap[pixelPosition / 4] >> ((3 - pixelPosition % 4) * 2)) & 0x3
+                                : (bitmap[pixelPosition / 8] >> (7 - pixelPosition % 8)) & 1;
+        if (!ink) {
+          continue;
+        }
+
+        int panelX, panelY;
+        rotateCoordinates(penX + glyph->left + glyphX, glyphY - glyph->top, &panelX, &panelY);
+        const int stripX = panelX - originX - strip->offsetX;
+        const int stripY = panelY - originY - strip->offsetY;
+        strip->bits[stripY * rowBytes + stripX / 8] |= 0x80 >> (stripX % 8);
+      }
+    }
+    penX += glyph->advanceX;
+  }
+  return true;
+}
+
+// Masks a strip into the frame buffer with its pen origin at logical (x, y), false if it isn't fully on the panel
+bool GfxRenderer::drawStrip(const WordBitmapCache::Strip& strip, const int x, const int y) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    return false;
+  }
+
+  int panelX, panelY;
+  rotateCoordinates(x, y, &panelX, &panelY);
+  panelX += strip.offsetX;
+  panelY += strip.offsetY;
+  if (panelX < 0 || panelY < 0 || panelX + strip.width > EInkDisplay::DISPLAY_WIDTH ||
+      panelY + strip.height > EInkDisplay::DISPLAY_HEIGHT) {
+    return false;
+  }
+
+  const size_t rowBytes = strip.getRowBytes();
+  const int shift = panelX % 8;
+  // The byte the last bits are shifted into may lie past the row, its bits are all padding then
+  const bool spills = shift != 0 && panelX / 8 + rowBytes < EInkDisplay::DISPLAY_WIDTH_BYTES;
+  const uint8_t* src = strip.bits.data();
+  for (int row = 0; row < strip.height; row++) {
+    uint8_t* dst = frameBuffer + (panelY + row) * EInkDisplay::DISPLAY_WIDTH_BYTES + panelX / 8;
+    uint8_t carry = 0;
+    for (size_t i = 0; i < rowBytes; i++) {
+      // Ink clears bits, 0 is black
+      dst[i] &= ~static_cast<uint8_t>((src[i] >> shift) | carry);
+      carry = shift ? static_cast<uint8_t>(src[i] << (8 - shift)) : 0;
+    }
+    if (spills) {
+      dst[rowBytes] &= ~carry;
+    }
+    src += rowBytes;
+  }
+  return true;
+}
+
 void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) const {
   if (x1 == x2) {
     if (y2 < y1) {
@@ -235,7 +384,33 @@ void GfxRenderer::invertScreen() const {
 }
 
 void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode) const {
+  displaying = true;
   einkDisplay.displayBuffer(refreshMode);
+  displaying = false;
+  displayedFrames++;
+}
+
+void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+
+  // Opposite corners in panel coordinates, any rotation swaps them around
+  int x0, y0, x1, y1;
+  rotateCoordinates(x, y, &x0, &y0);
+  rotateCoordinates(x + width - 1, y + height - 1, &x1, &y1);
+  // The controller addresses panel columns 8 at a time
+  const int left = std::max(0, std::min(x0, x1)) & ~7;
+  const int right = std::min(EInkDisplay::DISPLAY_WIDTH - 1, std::max(x0, x1) | 7);
+  const int top = std::max(0, std::min(y0, y1));
+  const int bottom = std::min(EInkDisplay::DISPLAY_HEIGHT - 1, std::max(y0, y1));
+  if (left > right || top > bottom) {
+    return;
+  }
+  displaying = true;
+  einkDisplay.displayWindow(left, top, right - left + 1, bottom - top + 1);
+  displaying = false;
+  displayedFrames++;
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
@@ -337,7 +512,12 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { einkDisplay.copyGrayscaleLsb
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { einkDisplay.copyGrayscaleMsbBuffers(einkDisplay.getFrameBuffer()); }
 
-void GfxRenderer::displayGrayBuffer() const { einkDisplay.displayGrayBuffer(); }
+void GfxRenderer::displayGrayBuffer() const {
+  displaying = true;
+  einkDisplay.displayGrayBuffer();
+  displaying = false;
+  displayedFrames++;
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
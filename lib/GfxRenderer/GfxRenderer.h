@@ -3,10 +3,12 @@
 #include <EInkDisplay.h>
 #include <EpdFontFamily.h>
 
+#include <atomic>
 #include <map>
 #include <string>
 
 #include "Bitmap.h"
+#include "WordBitmapCache.h"
 
 class GfxRenderer {
  public:
@@ -31,8 +33,15 @@ class GfxRenderer {
   Orientation orientation;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
   std::map<int, EpdFontFamily> fontMap;
+  mutable WordBitmapCache wordCache;
+  // Set while a frame goes out to the panel, read from other tasks
+  mutable std::atomic<bool> displaying{false};
+  mutable std::atomic<uint32_t> displayedFrames{0};
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
+  bool rasterizeWord(const EpdFontFamily& fontFamily, const char* text, EpdFontFamily::Style style,
+                     WordBitmapCache::Strip* strip) const;
+  bool drawStrip(const WordBitmapCache::Strip& strip, int x, int y) const;
   void freeBwBufferChunks();
   void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const;
 
@@ -47,17 +56,29 @@ class GfxRenderer {
 
   // Setup
   void insertFont(int fontId, EpdFontFamily font);
+  void removeFont(int fontId);
 
   // Orientation control (affects logical width/height and coordinate transforms)
-  void setOrientation(const Orientation o) { orientation = o; }
+  void setOrientation(const Orientation o) {
+    // Cached words are laid out for the panel orientation they were drawn in
+    if (o != orientation) {
+      wordCache.clear();
+    }
+    orientation = o;
+  }
   Orientation getOrientation() const { return orientation; }
 
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
+  // EXPERIMENTAL: Windowed update - display only a rectangular region (logical coordinates, widened to whole bytes of
+  // panel columns)
   void displayWindow(int x, int y, int width, int height) const;
+  // Whether a display call is still waiting for the panel
+  bool isDisplaying() const { return displaying; }
+  // Display calls completed so far, tells when a frame drawn on another task is on the panel
+  uint32_t getDisplayedFrames() const { return displayedFrames; }
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
 
@@ -75,6 +96,9 @@ class GfxRenderer {
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  // drawText for the words of a page, in black and white they are drawn from the word bitmap cache
+  void drawWord(int fontId, int x, int y, const char* word, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  const WordBitmapCache& getWordCache() const { return wordCache; }
   int getSpaceWidth(int fontId) const;
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
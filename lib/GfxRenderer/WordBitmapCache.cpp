@@ -0,0 +1,60 @@
+#include "WordBitmapCache.h"
+
+namespace {
+// List and hash map node overhead of an entry, roughly
+constexpr size_t ENTRY_OVERHEAD = 48;
+}  // namespace
+
+void WordBitmapCache::setLookupKey(const int fontId, const uint8_t style, const char* word) {
+  lookupKey.assign(reinterpret_cast<const char*>(&fontId), sizeof(fontId));
+  lookupKey.push_back(static_cast<char>(style));
+  lookupKey.append(word);
+}
+
+size_t WordBitmapCache::entryBytes(const Entry& entry) {
+  return sizeof(Entry) + ENTRY_OVERHEAD + entry.key.size() + entry.strip.bits.size();
+}
+
+const WordBitmapCache::Strip* WordBitmapCache::find(const int fontId, const uint8_t style, const char* word) {
+  setLookupKey(fontId, style, word);
+  const auto it = index.find(lookupKey);
+  if (it == index.end()) {
+    misses++;
+    return nullptr;
+  }
+
+  hits++;
+  entries.splice(entries.begin(), entries, it->second);
+  return &it->second->strip;
+}
+
+const WordBitmapCache::Strip* WordBitmapCache::insert(const int fontId, const uint8_t style, const char* word,
+                                                      Strip strip) {
+  if (strip.bits.size() > MAX_STRIP_BYTES) {
+    return nullptr;
+  }
+
+  setLookupKey(fontId, style, word);
+  if (index.count(lookupKey)) {
+    return nullptr;
+  }
+
+  entries.push_front({lookupKey, std::move(strip)});
+  const size_t bytes = entryBytes(entries.front());
+  while (usedBytes + bytes > MAX_BYTES && entries.size() > 1) {
+    const Entry& oldest = entries.back();
+    usedBytes -= entryBytes(oldest);
+    index.erase(oldest.key);
+    entries.pop_back();
+  }
+
+  usedBytes += bytes;
+  index.emplace(entries.front().key, entries.begin());
+  return &entries.front().strip;
+}
+
+void WordBitmapCache::clear() {
+  index.clear();
+  entries.clear();
+  usedBytes = 0;
+}
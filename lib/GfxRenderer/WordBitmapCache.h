@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Least recently used cache of rasterized words, kept within a fixed memory budget.
+ *
+ * A few hundred words ("the", "and", "of", ...) make up most of any book. Rather than drawing them glyph by glyph
+ * on every page, the renderer keeps each word as a strip in panel layout: rows of MSB first bits in panel
+ * orientation, exactly like the frame buffer. Drawing a cached word then masks a few bytes into each frame buffer
+ * row.
+ */
+class WordBitmapCache {
+ public:
+  struct Strip {
+    int16_t offsetX;  // Panel position of the strip relative to the panel position of the pen origin
+    int16_t offsetY;
+    uint16_t width;  // Panel pixels
+    uint16_t height;
+    std::vector<uint8_t> bits;  // height rows of (width + 7) / 8 bytes, set bits are ink
+
+    size_t getRowBytes() const { return (width + 7) / 8; }
+  };
+
+  static constexpr size_t MAX_BYTES = 16 * 1024;
+  // Longer words are rare enough not to be worth the room
+  static constexpr size_t MAX_STRIP_BYTES = 512;
+
+ private:
+  struct Entry {
+    std::string key;
+    Strip strip;
+  };
+
+  std::list<Entry> entries;  // Most recently used first
+  // Keys point into the entries, list nodes never move
+  std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+  std::string lookupKey;  // Reused so lookups don't allocate
+  size_t usedBytes = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+
+  void setLookupKey(int fontId, uint8_t style, const char* word);
+  static size_t entryBytes(const Entry& entry);
+
+ public:
+  const Strip* find(int fontId, uint8_t style, const char* word);
+  // Takes the strip for the word find() just missed, evicting the least recently used words to make room
+  const Strip* insert(int fontId, uint8_t style, const char* word, Strip strip);
+  void clear();
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+  size_t getUsedBytes() const { return usedBytes; }
+};
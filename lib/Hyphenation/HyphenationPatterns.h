@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+
+/// Letter the patterns know about, upper and lower case forms share a code
+typedef struct {
+  uint32_t codePoint;  ///< Unicode code point, the table is sorted by it
+  uint8_t code;        ///< Letter code used in the trie, 0 is the word boundary
+} HyphenationLetter;
+
+/// Liang patterns compiled into a packed trie, nodes are stored breadth first so the children of a node are
+/// consecutive and sorted by letter code
+typedef struct {
+  const char* language;              ///< Primary language subtag ("en", "de", ...)
+  const HyphenationLetter* letters;  ///< Letters of the pattern alphabet
+  uint16_t letterCount;              ///< Number of entries in letters
+  const uint8_t* nodeChars;          ///< Letter code of each node
+  const uint16_t* nodeFirstChild;    ///< First child of each node, children of node i end at nodeFirstChild[i + 1]
+  const uint16_t* nodeLevels;        ///< Offset into levels of the pattern ending at each node, 0 if none
+  const uint8_t* levels;             ///< Pattern levels as [offset into pattern, count, levels...]
+  uint16_t nodeCount;                ///< Number of trie nodes
+  uint8_t leftMin;                   ///< Minimum number of letters before a hyphen
+  uint8_t rightMin;                  ///< Minimum number of letters after a hyphen
+} HyphenationPatterns;
+
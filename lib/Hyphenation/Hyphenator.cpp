@@ -0,0 +1,143 @@
+#include "Hyphenator.h"
+
+#include <Utf8.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "patterns/hyph_de.h"
+#include "patterns/hyph_en.h"
+#include "patterns/hyph_es.h"
+#include "patterns/hyph_fr.h"
+#include "patterns/hyph_it.h"
+
+namespace {
+constexpr Hyphenator HYPHENATORS[] = {
+    Hyphenator(hyph_en), Hyphenator(hyph_de), Hyphenator(hyph_fr), Hyphenator(hyph_es), Hyphenator(hyph_it),
+};
+
+constexpr uint8_t NOT_A_LETTER = 0xFF;
+constexpr uint8_t WORD_BOUNDARY = 0;
+
+bool isHyphen(const uint32_t codePoint) { return codePoint == '-' || codePoint == 0x2010; }
+}  // namespace
+
+const Hyphenator* Hyphenator::forLanguage(const std::string& language) {
+  const size_t subtagLength = std::min(language.find_first_of("-_"), language.size());
+  if (subtagLength == 0) {
+    return nullptr;
+  }
+
+  for (const auto& hyphenator : HYPHENATORS) {
+    const char* candidate = hyphenator.getLanguage();
+    if (strlen(candidate) != subtagLength) {
+      continue;
+    }
+    bool matches = true;
+    for (size_t i = 0; i < subtagLength && matches; i++) {
+      matches = tolower(static_cast<unsigned char>(language[i])) == candidate[i];
+    }
+    if (matches) {
+      return &hyphenator;
+    }
+  }
+  return nullptr;
+}
+
+uint8_t Hyphenator::letterCode(const uint32_t codePoint) const {
+  const HyphenationLetter* end = patterns.letters + patterns.letterCount;
+  const HyphenationLetter* it = std::lower_bound(
+      patterns.letters, end, codePoint,
+      [](const HyphenationLetter& letter, const uint32_t value) { return letter.codePoint < value; });
+  return it != end && it->codePoint == codePoint ? it->code : NOT_A_LETTER;
+}
+
+// codes holds the letters surrounded by word boundaries (letterCount + 2 entries), points receives the highest
+// pattern level seen in front of each of them (letterCount + 3 entries)
+void Hyphenator::hyphenateLetters(const uint8_t* codes, const size_t letterCount, uint8_t* points) const {
+  const size_t codeCount = letterCount + 2;
+  std::fill_n(points, codeCount + 1, 0);
+
+  for (size_t start = 0; start < codeCount; start++) {
+    uint16_t node = 0;
+    for (size_t i = start; i < codeCount; i++) {
+      // Children are sorted by letter code, find the one for this letter
+      const uint8_t* first = patterns.nodeChars + patterns.nodeFirstChild[node];
+      const uint8_t* last = patterns.nodeChars + patterns.nodeFirstChild[node + 1];
+      const uint8_t* child = std::lower_bound(first, last, codes[i]);
+      if (child == last || *child != codes[i]) {
+        break;
+      }
+      node = static_cast<uint16_t>(child - patterns.nodeChars);
+
+      const uint16_t levelsOffset = patterns.nodeLevels[node];
+      if (levelsOffset) {
+        const uint8_t* levels = patterns.levels + levelsOffset;
+        const size_t offset = start + levels[0];
+        for (size_t k = 0; k < levels[1]; k++) {
+          points[offset + k] = std::max(points[offset + k], levels[2 + k]);
+        }
+      }
+    }
+  }
+}
+
+size_t Hyphenator::hyphenate(const std::string& word, uint8_t* breaks, const size_t maxBreaks) const {
+  if (word.size() > UINT8_MAX) {
+    return 0;
+  }
+
+  // Letter codes of the current run of letters with a word boundary in front, and where each letter starts
+  uint8_t codes[MAX_WORD_LETTERS + 2];
+  uint8_t offsets[MAX_WORD_LETTERS + 1];
+  uint8_t points[MAX_WORD_LETTERS + 3];
+  size_t letterCount = 0;
+  size_t breakCount = 0;
+
+  const auto* start = reinterpret_cast<const unsigned char*>(word.c_str());
+  const auto* end = start + word.size();
+  const auto* p = start;
+  codes[0] = WORD_BOUNDARY;
+  while (breakCount < maxBreaks) {
+    const auto offset = static_cast<uint8_t>(p - start);
+    // A sequence cut off at the end of the word could have stepped past it
+    const uint32_t codePoint = p < end ? utf8NextCodepoint(&p) : 0;
+    const uint8_t code = codePoint ? letterCode(codePoint) : NOT_A_LETTER;
+
+    if (code != NOT_A_LETTER) {
+      if (letterCount < MAX_WORD_LETTERS) {
+        codes[letterCount + 1] = code;
+        offsets[letterCount] = offset;
+      }
+      letterCount++;
+      continue;
+    }
+
+    // End of a run of letters, hyphenate it
+    if (letterCount >= patterns.leftMin + patterns.rightMin && letterCount <= MAX_WORD_LETTERS) {
+      codes[letterCount + 1] = WORD_BOUNDARY;
+      hyphenateLetters(codes, letterCount, points);
+      // points[i + 1] is the level in front of letter i
+      for (size_t i = patterns.leftMin; i + patterns.rightMin <= letterCount && breakCount < maxBreaks; i++) {
+        if (points[i + 1] & 1) {
+          breaks[breakCount++] = offsets[i];
+        }
+      }
+    }
+
+    if (!codePoint) {
+      break;
+    }
+    // An existing hyphen between two letters is a break as well
+    if (isHyphen(codePoint) && letterCount > 0 && p < end && breakCount < maxBreaks) {
+      const auto* next = p;
+      if (letterCode(utf8NextCodepoint(&next)) != NOT_A_LETTER) {
+        breaks[breakCount++] = static_cast<uint8_t>(p - start);
+      }
+    }
+    letterCount = 0;
+  }
+
+  return breakCount;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "HyphenationPatterns.h"
+
+/**
+ * Finds the points where a word can be hyphenated using Liang's algorithm (the one TeX uses).
+ *
+ * Patterns are compiled into a packed trie kept in flash (see scripts/hyphenconvert.py), a lookup only walks that
+ * trie once for every letter of the word and works in fixed size buffers on the stack, nothing is allocated.
+ *
+ * Only runs of letters of the language's alphabet are hyphenated, anything else (punctuation, digits, the indent
+ * added in front of a paragraph) separates them. A word can also be broken right after a hyphen it already contains.
+ */
+class Hyphenator {
+  const HyphenationPatterns& patterns;
+
+  uint8_t letterCode(uint32_t codePoint) const;
+  void hyphenateLetters(const uint8_t* codes, size_t letterCount, uint8_t* points) const;
+
+ public:
+  // Longer runs of letters are left alone, no dictionary word comes close
+  static constexpr size_t MAX_WORD_LETTERS = 64;
+
+  explicit constexpr Hyphenator(const HyphenationPatterns& patterns) : patterns(patterns) {}
+
+  // Hyphenator for a BCP 47 language tag like "en-GB" (only the primary subtag is used), nullptr if not supported
+  static const Hyphenator* forLanguage(const std::string& language);
+
+  const char* getLanguage() const { return patterns.language; }
+
+  // Fills breaks with the byte offsets into word it can be broken at, in ascending order, and returns their count.
+  // The word needs a hyphen added at a break unless the byte before it is already one.
+  size_t hyphenate(const std::string& word, uint8_t* breaks, size_t maxBreaks) const;
+};
@@ -0,0 +1,6493 @@
+/**
+ * generated by hyphenconvert.py
+ * name: hyph_de
+ * language: de
+ * patterns: 23390
+ * nodes: 33158
+ */
+#pragma once
+#include "HyphenationPatterns.h"
+
+static const HyphenationLetter hyph_deLetters[83] = {
+    { 0x41, 1 }, // A
+    { 0x42, 2 }, // B
+    { 0x43, 3 }, // C
+    { 0x44, 4 }, // D
+    { 0x45, 5 }, // E
+    { 0x46, 6 }, // F
+    { 0x47, 7 }, // G
+    { 0x48, 8 }, // H
+    { 0x49, 9 }, // I
+    { 0x4A, 10 }, // J
+    { 0x4B, 11 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 13 }, // M
+    { 0x4E, 14 }, // N
+    { 0x4F, 15 }, // O
+    { 0x50, 16 }, // P
+    { 0x51, 17 }, // Q
+    { 0x52, 18 }, // R
+    { 0x53, 19 }, // S
+    { 0x54, 20 }, // T
+    { 0x55, 21 }, // U
+    { 0x56, 22 }, // V
+    { 0x57, 23 }, // W
+    { 0x58, 24 }, // X
+    { 0x59, 25 }, // Y
+    { 0x5A, 26 }, // Z
+    { 0x61, 1 }, // a
+    { 0x62, 2 }, // b
+    { 0x63, 3 }, // c
+    { 0x64, 4 }, // d
+    { 0x65, 5 }, // e
+    { 0x66, 6 }, // f
+    { 0x67, 7 }, // g
+    { 0x68, 8 }, // h
+    { 0x69, 9 }, // i
+    { 0x6A, 10 }, // j
+    { 0x6B, 11 }, // k
+    { 0x6C, 12 }, // l
+    { 0x6D, 13 }, // m
+    { 0x6E, 14 }, // n
+    { 0x6F, 15 }, // o
+    { 0x70, 16 }, // p
+    { 0x71, 17 }, // q
+    { 0x72, 18 }, // r
+    { 0x73, 19 }, // s
+    { 0x74, 20 }, // t
+    { 0x75, 21 }, // u
+    { 0x76, 22 }, // v
+    { 0x77, 23 }, // w
+    { 0x78, 24 }, // x
+    { 0x79, 25 }, // y
+    { 0x7A, 26 }, // z
+    { 0xC0, 28 }, // À
+    { 0xC1, 29 }, // Á
+    { 0xC2, 30 }, // Â
+    { 0xC4, 31 }, // Ä
+    { 0xC7, 32 }, // Ç
+    { 0xC8, 33 }, // È
+    { 0xC9, 34 }, // É
+    { 0xCA, 35 }, // Ê
+    { 0xCB, 36 }, // Ë
+    { 0xCD, 37 }, // Í
+    { 0xD1, 38 }, // Ñ
+    { 0xD3, 39 }, // Ó
+    { 0xD4, 40 }, // Ô
+    { 0xD6, 41 }, // Ö
+    { 0xDC, 42 }, // Ü
+    { 0xDF, 27 }, // ß
+    { 0xE0, 28 }, // à
+    { 0xE1, 29 }, // á
+    { 0xE2, 30 }, // â
+    { 0xE4, 31 }, // ä
+    { 0xE7, 32 }, // ç
+    { 0xE8, 33 }, // è
+    { 0xE9, 34 }, // é
+    { 0xEA, 35 }, // ê
+    { 0xEB, 36 }, // ë
+    { 0xED, 37 }, // í
+    { 0xF1, 38 }, // ñ
+    { 0xF3, 39 }, // ó
+    { 0xF4, 40 }, // ô
+    { 0xF6, 41 }, // ö
+    { 0xFC, 42 }, // ü
+};
+
+static const uint8_t hyph_deNodeChars[33158] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 29, 30, 31,
+    33, 34, 35, 36, 37, 38, 39, 41, 42, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 31,
+    32, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 31, 41, 42, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+    19, 20, 21, 23, 25, 26, 31, 34, 40, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    25, 26, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    31, 38, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 31, 34, 41,
+    42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 31, 41, 42, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 25, 26, 31, 33, 41, 42, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 26, 27, 31, 38, 41, 42, 1, 5, 9, 15, 21, 22, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 26, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 28, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26,
+    31, 34, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 31, 34, 41,
+    42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 31, 32, 38, 41,
+    42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 18, 19, 20, 21, 22, 23, 25, 26, 31, 34, 41, 42, 21, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 31, 32, 34, 37, 41, 42, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 25, 26, 31, 34, 37, 41, 42, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 25, 26, 28, 31, 41, 42, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 27, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 26, 41, 42,
+    1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19,
+    20, 21, 23, 26, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26,
+    41, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 31, 1, 2, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 25, 26, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 26, 31,
+    41, 42, 14, 20, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 26, 27, 31, 3, 13,
+    14, 18, 2, 3, 7, 8, 12, 15, 16, 18, 19, 20, 21, 22, 26, 16,
+    20, 14, 12, 15, 18, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13,
+    14, 15, 16, 18, 19, 20, 22, 23, 26, 27, 2, 3, 4, 5, 6, 7,
+    8, 11, 12, 13, 14, 16, 18, 19, 20, 22, 26, 27, 2, 4, 5, 6,
+    7, 9, 11, 12, 13, 14, 16, 18, 19, 20, 21, 24, 1, 5, 9, 15,
+    21, 25, 1, 8, 1, 5, 9, 15, 25, 2, 4, 7, 8, 9, 11, 12,
+    13, 14, 18, 19, 20, 21, 24, 5, 9, 12, 15, 19, 21, 1, 4, 5,
+    12, 15, 19, 1, 5, 9, 15, 1, 13, 14, 15, 18, 19, 20, 22, 15,
+    1, 9, 12, 15, 18, 19, 21, 1, 5, 9, 15, 21, 1, 4, 5, 9,
+    13, 21, 1, 5, 9, 15, 21, 31, 1, 2, 6, 16, 18, 19, 20, 26,
+    1, 5, 6, 8, 15, 18, 19, 1, 5, 9, 15, 21, 31, 41, 42, 1,
+    3, 5, 8, 9, 11, 15, 16, 20, 21, 1, 5, 8, 9, 15, 18, 19,
+    21, 2, 6, 12, 13, 14, 18, 20, 5, 15, 1, 5, 9, 15, 21, 5,
+    1, 1, 5, 9, 21, 23, 13, 18, 20, 4, 12, 2, 2, 3, 7, 11,
+    12, 14, 17, 18, 19, 20, 21, 1, 2, 4, 5, 6, 7, 8, 9, 11,
+    12, 14, 15, 18, 19, 20, 21, 23, 25, 26, 31, 41, 42, 1, 3, 5,
+    8, 9, 11, 12, 15, 21, 0, 1, 3, 4, 5, 6, 8, 9, 10, 12,
+    13, 15, 16, 17, 18, 19, 20, 22, 31, 2, 3, 4, 9, 11, 12, 13,
+    15, 16, 18, 19, 23, 24, 1, 5, 6, 9, 12, 15, 18, 19, 20, 21,
+    31, 42, 0, 1, 4, 5, 7, 9, 12, 13, 14, 18, 19, 20, 21, 0,
+    1, 5, 9, 12, 13, 14, 15, 18, 20, 21, 23, 25, 31, 41, 0, 1,
+    2, 4, 5, 6, 7, 11, 12, 14, 18, 19, 20, 22, 1, 5, 0, 1,
+    2, 3, 4, 5, 9, 11, 12, 14, 15, 18, 19, 20, 21, 26, 31, 42,
+    1, 2, 4, 5, 6, 7, 9, 11, 12, 13, 15, 16, 18, 19, 20, 21,
+    25, 26, 31, 41, 0, 1, 5, 6, 9, 11, 12, 13, 14, 16, 19, 20,
+    21, 31, 41, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 18, 19, 20, 21, 23, 26, 31, 41, 42, 6, 9, 16, 18,
+    19, 20, 0, 1, 5, 6, 8, 9, 12, 14, 15, 16, 18, 19, 20, 21,
+    34, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15,
+    16, 18, 19, 20, 21, 22, 23, 25, 26, 31, 41, 42, 1, 3, 5, 8,
+    9, 11, 15, 16, 19, 20, 21, 23, 25, 31, 41, 42, 1, 2, 3, 5,
+    8, 9, 12, 13, 15, 18, 19, 20, 21, 26, 31, 42, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20,
+    21, 22, 23, 24, 26, 27, 1, 5, 9, 18, 9, 1, 5, 9, 1, 5,
+    13, 19, 20, 21, 1, 9, 15, 21, 26, 5, 0, 2, 3, 4, 6, 8,
+    9, 11, 12, 13, 14, 18, 19, 20, 21, 24, 25, 5, 12, 18, 19, 21,
+    5, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14,
+    15, 16, 18, 19, 20, 21, 22, 23, 24, 26, 1, 1, 5, 31, 2, 3,
+    5, 11, 12, 13, 14, 15, 18, 19, 20, 26, 5, 0, 1, 5, 9, 15,
+    21, 31, 42, 1, 9, 1, 2, 3, 4, 5, 6, 8, 9, 12, 14, 15,
+    16, 18, 19, 20, 24, 1, 0, 1, 5, 9, 15, 21, 31, 41, 42, 1,
+    3, 5, 9, 11, 12, 15, 16, 19, 20, 21, 26, 31, 41, 1, 5, 8,
+    9, 18, 19, 42, 3, 5, 6, 12, 13, 14, 18, 19, 16, 19, 5, 3,
+    4, 8, 12, 18, 19, 21, 2, 6, 12, 2, 3, 7, 2, 3, 5, 7,
+    8, 12, 13, 14, 16, 18, 19, 20, 25, 5, 8, 15, 3, 4, 5, 6,
+    9, 11, 12, 14, 15, 18, 19, 20, 21, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23,
+    25, 26, 30, 31, 34, 41, 42, 1, 3, 5, 12, 14, 19, 20, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19,
+    20, 21, 22, 23, 25, 26, 31, 41, 42, 5, 9, 15, 21, 5, 21, 1,
+    3, 4, 6, 9, 11, 12, 13, 14, 16, 18, 19, 20, 5, 15, 25, 31,
+    1, 6, 9, 20, 9, 21, 1, 5, 16, 19, 19, 0, 1, 2, 3, 4,
+    6, 7, 8, 9, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 23, 24,
+    5, 21, 8, 1, 5, 8, 15, 31, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 24, 1, 5, 1,
+    15, 21, 1, 3, 4, 5, 6, 7, 11, 12, 13, 14, 15, 16, 18, 19,
+    20, 22, 26, 1, 5, 9, 13, 19, 5, 9, 1, 2, 6, 8, 12, 13,
+    14, 16, 18, 19, 20, 21, 23, 24, 1, 15, 1, 5, 8, 9, 15, 21,
+    31, 41, 42, 1, 2, 3, 5, 8, 9, 11, 12, 15, 16, 19, 20, 21,
+    26, 31, 41, 1, 5, 8, 15, 18, 19, 20, 21, 25, 41, 42, 1, 2,
+    3, 6, 8, 9, 11, 12, 13, 14, 15, 18, 19, 1, 5, 12, 14, 19,
+    3, 7, 8, 13, 14, 16, 17, 18, 21, 24, 4, 6, 12, 14, 18, 19,
+    2, 14, 2, 3, 4, 7, 11, 12, 13, 14, 18, 19, 20, 21, 22, 1,
+    5, 8, 9, 12, 15, 18, 19, 21, 25, 31, 41, 1, 5, 8, 9, 11,
+    12, 15, 18, 19, 20, 1, 4, 5, 9, 15, 18, 19, 21, 25, 41, 1,
+    2, 3, 4, 5, 6, 7, 9, 12, 13, 14, 15, 16, 18, 19, 20, 21,
+    23, 24, 1, 5, 6, 9, 12, 15, 18, 19, 20, 21, 31, 42, 1, 4,
+    5, 9, 12, 14, 15, 18, 19, 20, 21, 1, 5, 9, 12, 13, 14, 15,
+    18, 19, 20, 21, 23, 25, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7,
+    8, 11, 12, 13, 14, 15, 16, 18, 19, 20, 22, 26, 1, 4, 5, 12,
+    14, 15, 18, 19, 20, 21, 23, 26, 31, 1, 4, 5, 6, 7, 9, 11,
+    12, 13, 14, 15, 16, 19, 20, 21, 25, 26, 31, 41, 42, 1, 2, 4,
+    5, 9, 13, 15, 16, 19, 20, 21, 31, 42, 1, 3, 4, 5, 6, 7,
+    9, 11, 14, 15, 19, 20, 21, 23, 25, 26, 31, 41, 42, 2, 3, 4,
+    6, 7, 8, 12, 13, 14, 15, 16, 18, 19, 20, 21, 1, 5, 6, 9,
+    12, 15, 16, 18, 19, 20, 21, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 23, 26, 31, 41, 42, 1,
+    2, 3, 5, 6, 8, 9, 11, 12, 13, 15, 16, 18, 19, 20, 21, 23,
+    25, 26, 41, 1, 2, 5, 7, 8, 9, 15, 18, 19, 20, 21, 23, 25,
+    26, 31, 42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14,
+    15, 16, 18, 19, 20, 24, 26, 1, 5, 9, 15, 5, 9, 31, 0, 1,
+    3, 4, 5, 9, 12, 16, 19, 20, 21, 25, 14, 19, 1, 5, 9, 15,
+    23, 31, 5, 2, 3, 4, 5, 8, 9, 11, 12, 13, 14, 16, 18, 19,
+    20, 21, 22, 24, 27, 1, 5, 8, 9, 0, 1, 3, 4, 5, 8, 9,
+    11, 12, 13, 14, 16, 18, 19, 20, 21, 23, 24, 26, 1, 5, 6, 9,
+    12, 15, 18, 19, 20, 21, 5, 0, 1, 4, 5, 11, 12, 13, 14, 15,
+    18, 19, 20, 22, 24, 15, 1, 0, 1, 5, 9, 15, 21, 31, 41, 42,
+    1, 9, 2, 6, 12, 14, 16, 18, 20, 24, 1, 5, 9, 15, 21, 31,
+    41, 42, 1, 3, 5, 9, 11, 15, 16, 19, 20, 21, 25, 31, 1, 5,
+    8, 9, 15, 18, 19, 21, 23, 26, 31, 42, 3, 7, 8, 11, 13, 14,
+    18, 19, 20, 27, 1, 1, 5, 21, 23, 41, 3, 8, 12, 17, 18, 19,
+    20, 21, 24, 27, 6, 11, 12, 18, 2, 8, 14, 18, 0, 2, 3, 4,
+    5, 6, 7, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 5, 9, 15,
+    25, 1, 5, 15, 18, 19, 20, 31, 41, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 23, 24, 9, 1,
+    5, 12, 14, 18, 19, 0, 1, 5, 9, 12, 18, 19, 21, 23, 3, 5,
+    6, 7, 11, 12, 13, 14, 15, 19, 20, 21, 0, 1, 2, 5, 9, 15,
+    19, 21, 23, 25, 31, 41, 42, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 11, 12, 13, 15, 16, 18, 19, 20, 21, 22, 23, 25, 26, 31, 42,
+    1, 2, 6, 7, 8, 9, 12, 14, 15, 16, 18, 19, 20, 21, 25, 1,
+    5, 9, 15, 21, 31, 41, 42, 1, 3, 5, 6, 8, 9, 11, 13, 14,
+    15, 16, 18, 19, 20, 23, 25, 31, 5, 8, 9, 15, 18, 19, 42, 1,
+    3, 4, 5, 6, 8, 9, 13, 14, 18, 19, 20, 14, 16, 5, 16, 18,
+    21, 6, 12, 20, 2, 18, 19, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 16, 18, 19, 20, 21, 22, 27, 1, 5, 1, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20,
+    21, 24, 25, 1, 5, 9, 12, 1, 5, 15, 0, 1, 3, 4, 5, 6,
+    11, 12, 13, 14, 15, 16, 18, 19, 20, 22, 1, 5, 41, 1, 2, 4,
+    5, 6, 9, 12, 13, 15, 19, 20, 21, 26, 31, 41, 42, 1, 5, 9,
+    15, 16, 19, 21, 31, 41, 1, 4, 5, 6, 8, 9, 11, 15, 19, 20,
+    21, 26, 31, 1, 2, 3, 4, 5, 6, 9, 12, 13, 14, 15, 16, 18,
+    19, 20, 23, 24, 25, 26, 27, 1, 2, 3, 4, 5, 7, 9, 11, 12,
+    13, 15, 18, 19, 20, 21, 25, 26, 31, 41, 42, 1, 3, 5, 8, 9,
+    11, 15, 16, 19, 20, 21, 31, 1, 5, 8, 9, 14, 15, 18, 19, 20,
+    21, 26, 31, 42, 2, 3, 6, 8, 11, 12, 13, 14, 16, 18, 19, 20,
+    9, 1, 5, 9, 12, 13, 15, 16, 20, 1, 15, 21, 23, 4, 6, 11,
+    18, 19, 21, 0, 3, 8, 19, 2, 6, 8, 19, 1, 2, 3, 4, 6,
+    7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 1,
+    2, 5, 9, 12, 15, 18, 19, 21, 41, 1, 3, 5, 8, 9, 11, 12,
+    21, 1, 5, 9, 14, 15, 18, 19, 20, 21, 25, 31, 41, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 18, 19, 20, 21, 23, 24,
+    1, 5, 6, 12, 18, 19, 20, 25, 31, 1, 4, 5, 9, 12, 14, 15,
+    18, 19, 21, 1, 5, 13, 14, 18, 19, 21, 23, 1, 5, 7, 8, 13,
+    14, 19, 20, 19, 1, 5, 9, 12, 14, 15, 18, 19, 20, 21, 31, 41,
+    42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 15, 19, 20, 21,
+    22, 26, 31, 42, 1, 2, 5, 9, 13, 15, 16, 19, 20, 21, 41, 0,
+    1, 4, 5, 6, 7, 8, 9, 11, 13, 14, 15, 18, 19, 20, 21, 22,
+    25, 26, 31, 41, 3, 4, 5, 6, 8, 11, 12, 13, 14, 15, 16, 18,
+    19, 20, 21, 22, 24, 26, 0, 1, 5, 6, 8, 9, 16, 18, 19, 20,
+    21, 1, 2, 3, 5, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19,
+    20, 21, 31, 34, 41, 42, 1, 2, 3, 5, 6, 8, 9, 11, 12, 13,
+    15, 16, 19, 20, 21, 31, 42, 1, 5, 8, 9, 13, 15, 18, 19, 20,
+    21, 26, 31, 42, 13, 14, 19, 1, 5, 9, 15, 18, 21, 31, 1, 5,
+    9, 20, 1, 5, 9, 15, 21, 23, 26, 31, 41, 5, 13, 16, 18, 20,
+    11, 14, 19, 2, 3, 8, 12, 14, 18, 19, 20, 1, 7, 11, 16, 19,
+    20, 22, 23, 1, 20, 22, 1, 2, 4, 9, 14, 18, 19, 21, 2, 7,
+    9, 11, 12, 14, 18, 19, 20, 1, 2, 3, 4, 6, 7, 8, 9, 11,
+    12, 13, 14, 15, 18, 19, 20, 21, 26, 15, 21, 25, 2, 3, 4, 6,
+    7, 8, 9, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 24, 25, 1,
+    5, 15, 21, 1, 3, 4, 5, 6, 11, 12, 14, 15, 18, 19, 22, 26,
+    1, 0, 1, 5, 9, 15, 21, 25, 31, 41, 42, 1, 1, 5, 9, 15,
+    21, 31, 1, 2, 6, 8, 11, 12, 13, 14, 16, 18, 19, 20, 21, 23,
+    24, 1, 5, 8, 9, 15, 21, 31, 41, 1, 3, 5, 8, 9, 11, 13,
+    15, 16, 19, 20, 21, 26, 31, 41, 1, 5, 8, 9, 15, 18, 19, 20,
+    21, 26, 31, 42, 1, 3, 4, 7, 8, 12, 13, 14, 16, 18, 19, 20,
+    1, 5, 13, 14, 18, 19, 6, 12, 3, 14, 18, 0, 1, 2, 3, 4,
+    6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23,
+    25, 1, 2, 5, 9, 12, 15, 18, 19, 21, 26, 31, 1, 8, 11, 12,
+    15, 1, 5, 9, 15, 18, 19, 20, 21, 23, 31, 41, 1, 2, 3, 5,
+    6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 24,
+    1, 5, 9, 12, 18, 19, 21, 1, 4, 5, 9, 12, 15, 16, 18, 21,
+    5, 9, 1, 2, 3, 4, 5, 7, 11, 12, 13, 14, 15, 16, 19, 20,
+    21, 22, 24, 26, 1, 5, 12, 13, 14, 15, 18, 19, 20, 42, 1, 2,
+    3, 4, 5, 6, 7, 9, 11, 12, 13, 14, 15, 19, 20, 21, 25, 26,
+    31, 1, 2, 3, 4, 5, 9, 15, 16, 19, 20, 21, 31, 1, 4, 5,
+    9, 21, 25, 42, 1, 2, 3, 5, 6, 7, 8, 9, 11, 12, 13, 14,
+    15, 16, 18, 19, 20, 22, 24, 27, 1, 6, 8, 20, 21, 31, 1, 5,
+    21, 41, 1, 3, 5, 8, 9, 11, 15, 16, 19, 20, 21, 31, 41, 1,
+    2, 5, 8, 9, 15, 18, 19, 20, 21, 31, 41, 42, 1, 2, 4, 5,
+    6, 7, 8, 9, 12, 13, 14, 15, 18, 19, 20, 24, 1, 12, 18, 1,
+    3, 13, 14, 15, 19, 20, 1, 5, 9, 12, 15, 20, 21, 22, 23, 31,
+    41, 3, 4, 8, 13, 14, 16, 17, 18, 19, 20, 21, 24, 2, 3, 4,
+    6, 8, 11, 12, 16, 19, 26, 27, 2, 3, 4, 8, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21,
+    25, 27, 5, 12, 18, 21, 25, 8, 1, 5, 18, 19, 20, 21, 31, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 16, 18, 19, 20,
+    21, 24, 41, 9, 1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 13, 14,
+    15, 16, 18, 19, 20, 22, 31, 14, 3, 5, 6, 11, 15, 16, 19, 1,
+    5, 7, 9, 16, 19, 20, 21, 31, 42, 5, 2, 4, 6, 7, 8, 9,
+    11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 24, 25, 1, 5, 6, 8,
+    12, 15, 19, 21, 1, 3, 5, 15, 16, 19, 20, 21, 25, 31, 42, 1,
+    5, 8, 9, 13, 15, 18, 19, 21, 26, 41, 42, 1, 3, 8, 12, 13,
+    14, 18, 19, 20, 15, 1, 5, 21, 1, 12, 19, 8, 14, 15, 16, 17,
+    18, 20, 21, 27, 2, 3, 6, 11, 12, 18, 2, 8, 12, 14, 20, 0,
+    2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 5, 25, 1, 5, 8, 11, 15, 21, 1, 3, 5, 9,
+    15, 18, 19, 20, 21, 23, 25, 41, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 1, 5, 6, 9, 12, 15, 18, 19, 20, 21, 31, 1, 4, 5,
+    7, 8, 9, 12, 14, 15, 18, 19, 20, 21, 26, 31, 41, 1, 5, 1,
+    2, 3, 4, 5, 6, 7, 8, 11, 12, 13, 14, 15, 16, 18, 19, 20,
+    22, 24, 1, 5, 9, 12, 14, 15, 18, 19, 20, 21, 31, 41, 42, 1,
+    5, 1, 5, 9, 31, 1, 5, 6, 7, 9, 15, 19, 20, 21, 22, 0,
+    1, 2, 3, 4, 5, 6, 8, 9, 11, 12, 13, 14, 16, 18, 19, 20,
+    22, 24, 26, 1, 6, 18, 19, 1, 5, 31, 41, 42, 1, 3, 5, 6,
+    9, 11, 13, 15, 16, 18, 19, 20, 21, 25, 26, 31, 1, 5, 7, 8,
+    9, 12, 13, 14, 15, 18, 19, 20, 21, 26, 31, 42, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 24,
+    26, 5, 12, 15, 0, 8, 15, 18, 19, 23, 1, 5, 9, 12, 15, 19,
+    23, 31, 41, 2, 3, 5, 6, 7, 8, 9, 13, 14, 16, 17, 18, 19,
+    21, 4, 6, 11, 12, 18, 20, 0, 2, 18, 19, 20, 2, 3, 4, 9,
+    11, 12, 13, 14, 18, 19, 20, 21, 0, 1, 2, 5, 9, 10, 12, 15,
+    18, 19, 21, 25, 31, 41, 42, 1, 3, 5, 8, 9, 11, 12, 21, 1,
+    4, 5, 9, 14, 15, 18, 20, 21, 25, 4, 13, 14, 18, 19, 20, 1,
+    5, 6, 9, 12, 15, 18, 19, 20, 21, 31, 41, 1, 5, 7, 8, 9,
+    12, 14, 15, 19, 1, 5, 9, 12, 13, 14, 15, 18, 19, 21, 23, 25,
+    31, 41, 4, 5, 13, 14, 18, 19, 20, 5, 1, 5, 9, 12, 15, 19,
+    20, 23, 1, 3, 4, 5, 6, 7, 9, 11, 12, 15, 19, 20, 21, 25,
+    26, 31, 34, 1, 5, 9, 13, 14, 15, 16, 19, 20, 21, 1, 3, 4,
+    5, 6, 7, 9, 11, 12, 14, 15, 19, 20, 21, 22, 25, 26, 31, 7,
+    11, 13, 16, 18, 19, 20, 0, 1, 5, 6, 8, 9, 12, 14, 15, 16,
+    18, 19, 20, 21, 25, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 25, 26, 31, 41, 42, 1, 3,
+    5, 8, 9, 11, 12, 13, 15, 16, 19, 20, 21, 25, 26, 41, 1, 5,
+    8, 9, 12, 15, 18, 19, 20, 21, 31, 41, 42, 6, 7, 8, 9, 12,
+    13, 14, 18, 19, 20, 1, 5, 9, 15, 5, 8, 9, 21, 0, 1, 11,
+    12, 21, 25, 15, 19, 5, 9, 15, 26, 5, 9, 0, 1, 3, 4, 6,
+    7, 8, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 22, 25, 27, 1,
+    0, 1, 2, 3, 4, 5, 6, 7, 9, 11, 12, 13, 14, 16, 18, 19,
+    20, 24, 0, 1, 5, 6, 9, 12, 15, 18, 19, 20, 21, 31, 18, 0,
+    1, 2, 4, 5, 6, 7, 9, 11, 12, 13, 14, 15, 18, 19, 20, 21,
+    25, 26, 31, 41, 42, 1, 3, 4, 5, 7, 12, 13, 14, 15, 16, 18,
+    19, 20, 26, 21, 0, 1, 5, 9, 21, 31, 2, 3, 4, 5, 8, 9,
+    12, 13, 14, 15, 16, 18, 19, 20, 21, 23, 24, 1, 5, 6, 8, 9,
+    12, 15, 16, 18, 19, 20, 21, 41, 1, 5, 9, 15, 31, 41, 42, 0,
+    1, 8, 9, 16, 19, 20, 25, 26, 41, 1, 5, 8, 9, 15, 18, 19,
+    21, 25, 26, 42, 1, 2, 3, 4, 8, 11, 12, 13, 14, 18, 19, 20,
+    26, 1, 20, 3, 4, 18, 19, 20, 2, 3, 6, 12, 5, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 16, 17, 18, 19, 20,
+    21, 24, 27, 42, 1, 2, 5, 9, 12, 15, 18, 19, 21, 25, 42, 5,
+    8, 9, 11, 12, 1, 5, 9, 15, 18, 19, 20, 21, 31, 41, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19,
+    20, 21, 22, 23, 24, 26, 31, 42, 1, 5, 6, 9, 12, 15, 18, 19,
+    20, 21, 26, 1, 4, 5, 9, 12, 14, 15, 18, 19, 41, 0, 1, 5,
+    9, 15, 19, 21, 31, 41, 42, 1, 2, 3, 4, 5, 6, 7, 10, 11,
+    13, 14, 15, 18, 19, 20, 24, 1, 5, 9, 12, 14, 15, 18, 19, 20,
+    21, 31, 41, 42, 1, 5, 7, 9, 15, 19, 20, 21, 25, 26, 41, 1,
+    4, 5, 9, 15, 16, 19, 20, 21, 31, 1, 4, 5, 6, 7, 9, 11,
+    14, 15, 19, 20, 21, 25, 26, 41, 42, 2, 3, 4, 5, 6, 7, 8,
+    9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 25, 27, 1, 5, 6,
+    12, 15, 18, 19, 20, 21, 1, 2, 3, 5, 8, 9, 13, 14, 15, 18,
+    19, 20, 21, 26, 31, 42, 1, 3, 5, 8, 9, 11, 13, 14, 15, 16,
+    19, 20, 21, 25, 1, 5, 8, 9, 15, 18, 19, 20, 21, 26, 31, 42,
+    1, 2, 3, 4, 6, 7, 8, 9, 13, 14, 16, 18, 19, 20, 26, 5,
+    15, 5, 15, 21, 3, 19, 1, 5, 9, 15, 20, 21, 23, 31, 2, 4,
+    6, 7, 8, 13, 14, 16, 17, 18, 19, 20, 21, 24, 2, 4, 6, 8,
+    11, 12, 13, 18, 19, 20, 27, 2, 3, 8, 13, 14, 0, 1, 2, 3,
+    4, 6, 7, 8, 9, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 22,
+    24, 25, 1, 5, 0, 1, 5, 8, 10, 12, 15, 18, 19, 21, 1, 5,
+    9, 18, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 24, 1, 1, 5, 0, 1, 5, 9, 14, 15,
+    18, 19, 21, 31, 41, 1, 3, 4, 5, 6, 7, 11, 12, 13, 14, 15,
+    18, 19, 20, 22, 26, 0, 1, 2, 5, 8, 9, 12, 14, 15, 18, 19,
+    20, 21, 22, 31, 41, 42, 1, 2, 5, 9, 15, 25, 31, 1, 5, 9,
+    1, 9, 15, 0, 1, 2, 3, 5, 6, 7, 8, 9, 11, 12, 13, 14,
+    15, 16, 18, 19, 20, 21, 22, 23, 24, 26, 27, 0, 1, 5, 6, 8,
+    9, 12, 14, 15, 18, 19, 20, 21, 25, 31, 1, 5, 41, 42, 1, 3,
+    5, 9, 11, 12, 15, 16, 17, 19, 20, 21, 25, 31, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 25, 26, 31, 41, 42, 1, 2, 3, 4, 5, 6, 8,
+    9, 11, 12, 13, 14, 16, 18, 19, 20, 22, 15, 5, 9, 12, 13, 14,
+    19, 1, 5, 9, 15, 21, 23, 31, 42, 2, 3, 7, 8, 12, 13, 14,
+    16, 17, 18, 20, 21, 3, 4, 6, 11, 12, 19, 2, 3, 4, 14, 19,
+    27, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15,
+    16, 18, 19, 20, 21, 22, 24, 26, 1, 5, 12, 25, 8, 11, 12, 15,
+    18, 1, 21, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13,
+    14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 1, 5, 18, 0, 1, 2,
+    5, 6, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 25, 31,
+    41, 42, 1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 26, 1, 5, 9, 21, 41, 1, 5, 15, 1,
+    5, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 18, 19, 20, 21, 23, 26, 27, 6, 9, 0, 1, 5, 8, 9, 15,
+    21, 25, 31, 34, 41, 42, 0, 1, 3, 5, 9, 11, 15, 16, 19, 20,
+    21, 23, 25, 31, 41, 1, 5, 8, 9, 12, 15, 18, 19, 21, 26, 31,
+    42, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 16, 18,
+    19, 20, 15, 1, 9, 1, 16, 19, 1, 5, 9, 15, 20, 21, 23, 31,
+    2, 3, 4, 6, 7, 8, 12, 13, 14, 16, 17, 18, 19, 20, 21, 24,
+    31, 3, 4, 6, 11, 12, 14, 19, 20, 2, 3, 6, 8, 13, 18, 20,
+    2, 3, 4, 7, 12, 13, 14, 18, 19, 20, 21, 25, 2, 5, 9, 12,
+    15, 18, 19, 20, 3, 8, 9, 11, 12, 1, 5, 9, 15, 18, 3, 4,
+    5, 7, 8, 11, 12, 13, 14, 16, 18, 20, 22, 24, 1, 5, 6, 9,
+    12, 15, 18, 19, 20, 21, 31, 1, 4, 5, 7, 8, 9, 12, 14, 15,
+    18, 19, 21, 41, 42, 1, 5, 9, 12, 13, 18, 19, 21, 23, 42, 3,
+    5, 7, 12, 13, 14, 19, 20, 1, 5, 9, 12, 14, 15, 18, 20, 21,
+    31, 41, 42, 1, 2, 4, 5, 6, 9, 11, 12, 13, 14, 15, 16, 19,
+    20, 22, 26, 31, 42, 1, 4, 5, 6, 7, 9, 11, 12, 13, 15, 16,
+    18, 19, 20, 21, 26, 31, 0, 1, 4, 5, 6, 7, 9, 11, 12, 14,
+    15, 18, 19, 20, 21, 22, 23, 25, 26, 31, 2, 6, 18, 19, 20, 24,
+    1, 4, 5, 6, 7, 9, 12, 16, 18, 20, 0, 1, 2, 3, 4, 5,
+    6, 7, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 26, 31, 41,
+    42, 1, 3, 5, 9, 11, 15, 16, 18, 19, 20, 21, 31, 42, 1, 3,
+    5, 6, 8, 9, 12, 15, 18, 19, 20, 21, 26, 31, 41, 42, 6, 13,
+    5, 5, 15, 20, 1, 5, 15, 23, 26, 21, 13, 19, 21, 4, 11, 0,
+    2, 3, 6, 7, 12, 14, 18, 19, 20, 21, 1, 2, 4, 6, 7, 8,
+    9, 12, 13, 14, 15, 18, 19, 20, 22, 23, 24, 42, 1, 3, 4, 5,
+    7, 9, 12, 13, 14, 19, 22, 26, 31, 5, 9, 5, 2, 7, 12, 16,
+    18, 20, 25, 1, 5, 9, 15, 3, 5, 16, 20, 26, 5, 13, 3, 1,
+    2, 3, 6, 7, 8, 12, 14, 16, 18, 19, 21, 1, 2, 3, 5, 6,
+    7, 8, 9, 12, 14, 18, 19, 20, 25, 9, 15, 3, 4, 5, 12, 13,
+    14, 18, 19, 20, 26, 19, 3, 8, 12, 18, 20, 15, 5, 8, 11, 20,
+    9, 3, 6, 12, 14, 18, 19, 20, 8, 12, 14, 19, 21, 3, 12, 18,
+    8, 12, 14, 18, 0, 2, 4, 5, 6, 7, 12, 13, 14, 19, 5, 8,
+    12, 1, 7, 11, 12, 13, 14, 18, 21, 24, 3, 4, 5, 7, 12, 13,
+    14, 19, 20, 22, 1, 5, 31, 4, 5, 18, 15, 1, 2, 5, 6, 8,
+    9, 15, 18, 19, 21, 31, 1, 14, 19, 0, 19, 2, 3, 7, 8, 12,
+    13, 14, 18, 19, 20, 26, 8, 18, 3, 4, 6, 12, 14, 18, 19, 20,
+    9, 12, 18, 5, 12, 19, 1, 3, 5, 9, 15, 19, 1, 5, 16, 5,
+    11, 15, 2, 7, 13, 14, 19, 21, 1, 5, 6, 9, 12, 15, 19, 20,
+    21, 1, 5, 9, 15, 18, 1, 3, 5, 8, 12, 13, 16, 20, 21, 26,
+    5, 8, 15, 18, 20, 18, 5, 20, 2, 3, 4, 6, 7, 8, 11, 12,
+    13, 14, 16, 17, 18, 19, 20, 21, 5, 42, 1, 9, 31, 0, 2, 3,
+    5, 6, 7, 8, 9, 12, 13, 14, 15, 18, 19, 20, 21, 24, 5, 5,
+    5, 9, 1, 3, 4, 5, 12, 13, 14, 15, 18, 19, 20, 22, 5, 25,
+    5, 1, 2, 6, 7, 8, 12, 14, 15, 16, 18, 19, 21, 1, 8, 11,
+    16, 26, 1, 5, 8, 9, 18, 19, 42, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 26, 1, 5, 9, 15,
+    21, 31, 41, 42, 1, 12, 1, 9, 21, 41, 3, 8, 13, 14, 16, 18,
+    21, 6, 11, 12, 14, 2, 3, 18, 2, 3, 6, 7, 9, 12, 13, 14,
+    16, 18, 19, 24, 5, 7, 11, 12, 13, 14, 5, 19, 41, 1, 3, 9,
+    42, 13, 14, 12, 19, 5, 8, 11, 1, 5, 9, 18, 19, 24, 5, 6,
+    9, 12, 18, 19, 20, 1, 4, 5, 12, 14, 18, 19, 25, 31, 1, 5,
+    9, 12, 13, 14, 18, 19, 20, 21, 23, 13, 19, 1, 12, 18, 1, 2,
+    11, 12, 16, 19, 20, 21, 1, 5, 9, 12, 15, 16, 19, 20, 0, 4,
+    5, 6, 7, 9, 11, 14, 19, 20, 26, 14, 19, 1, 6, 16, 19, 1,
+    2, 3, 4, 5, 6, 7, 9, 11, 13, 15, 18, 19, 20, 26, 31, 41,
+    42, 5, 11, 16, 19, 20, 21, 1, 5, 15, 18, 19, 20, 26, 2, 3,
+    4, 5, 6, 7, 12, 13, 14, 18, 19, 20, 27, 5, 9, 21, 4, 5,
+    12, 18, 19, 8, 11, 5, 9, 19, 21, 6, 12, 5, 12, 18, 5, 12,
+    18, 21, 7, 19, 5, 15, 18, 19, 0, 1, 5, 6, 9, 11, 12, 13,
+    14, 15, 19, 20, 21, 26, 19, 5, 9, 14, 19, 20, 5, 6, 19, 1,
+    2, 3, 4, 5, 6, 7, 9, 11, 14, 15, 16, 19, 20, 21, 1, 3,
+    5, 12, 16, 19, 20, 21, 1, 5, 18, 19, 20, 5, 5, 20, 3, 4,
+    5, 12, 18, 19, 31, 8, 11, 1, 5, 15, 18, 19, 20, 21, 2, 9,
+    1, 5, 6, 9, 12, 15, 20, 21, 31, 5, 12, 14, 19, 1, 5, 9,
+    12, 13, 14, 15, 18, 19, 20, 21, 23, 1, 3, 5, 12, 21, 41, 1,
+    5, 9, 21, 1, 4, 5, 6, 7, 19, 26, 5, 6, 9, 16, 1, 5,
+    6, 7, 11, 15, 18, 19, 20, 26, 1, 3, 5, 19, 20, 1, 5, 8,
+    18, 19, 20, 26, 1, 9, 12, 15, 19, 21, 5, 20, 14, 18, 21, 19,
+    20, 5, 11, 12, 19, 20, 16, 20, 1, 4, 5, 7, 9, 11, 14, 19,
+    26, 16, 19, 9, 11, 13, 19, 20, 26, 2, 20, 1, 5, 8, 18, 4,
+    5, 6, 19, 27, 8, 21, 5, 12, 18, 15, 20, 7, 19, 19, 20, 19,
+    1, 9, 2, 18, 20, 1, 9, 12, 13, 14, 15, 18, 19, 5, 2, 13,
+    14, 16, 18, 19, 5, 21, 15, 5, 5, 6, 11, 14, 19, 20, 5, 12,
+    1, 2, 6, 9, 19, 13, 4, 7, 14, 20, 2, 4, 5, 6, 9, 19,
+    26, 5, 16, 20, 19, 7, 18, 20, 20, 12, 18, 5, 12, 19, 21, 18,
+    19, 13, 19, 20, 2, 5, 12, 14, 18, 19, 21, 1, 12, 12, 21, 2,
+    6, 12, 18, 14, 16, 19, 6, 13, 19, 1, 13, 4, 7, 11, 14, 19,
+    21, 14, 5, 1, 20, 8, 15, 14, 18, 2, 9, 12, 20, 5, 1, 2,
+    16, 18, 1, 19, 2, 8, 19, 1, 7, 14, 3, 6, 22, 7, 19, 22,
+    19, 20, 4, 7, 12, 19, 20, 12, 14, 19, 6, 11, 12, 19, 20, 20,
+    14, 20, 2, 18, 19, 3, 5, 11, 20, 19, 19, 19, 1, 5, 5, 5,
+    1, 4, 20, 19, 20, 15, 2, 18, 3, 12, 11, 19, 15, 2, 3, 13,
+    19, 21, 1, 2, 3, 9, 12, 19, 1, 3, 1, 2, 8, 13, 20, 6,
+    8, 14, 21, 19, 2, 3, 2, 12, 13, 21, 8, 3, 5, 8, 14, 18,
+    20, 1, 7, 20, 9, 21, 1, 9, 5, 15, 3, 7, 14, 18, 20, 5,
+    6, 8, 9, 12, 14, 18, 19, 5, 13, 19, 20, 4, 14, 16, 23, 9,
+    15, 1, 5, 18, 5, 2, 1, 5, 15, 1, 4, 5, 7, 9, 19, 1,
+    3, 5, 9, 15, 19, 1, 18, 14, 12, 18, 8, 19, 7, 9, 12, 18,
+    20, 5, 18, 18, 12, 8, 12, 21, 5, 14, 3, 7, 16, 5, 19, 8,
+    19, 12, 5, 5, 5, 18, 20, 19, 19, 1, 2, 4, 5, 6, 7, 11,
+    20, 1, 8, 18, 19, 12, 13, 14, 21, 1, 9, 0, 3, 5, 9, 12,
+    14, 18, 19, 20, 23, 1, 12, 14, 18, 19, 20, 1, 5, 9, 15, 21,
+    31, 41, 0, 6, 14, 20, 5, 15, 31, 41, 3, 16, 20, 26, 5, 18,
+    13, 18, 20, 18, 21, 13, 14, 15, 1, 2, 5, 6, 9, 12, 13, 14,
+    15, 18, 19, 20, 21, 22, 23, 25, 41, 42, 0, 1, 5, 9, 19, 14,
+    0, 2, 3, 4, 7, 13, 14, 16, 18, 20, 21, 0, 1, 3, 5, 6,
+    7, 14, 18, 19, 5, 19, 9, 9, 21, 2, 16, 5, 21, 20, 26, 5,
+    8, 11, 0, 1, 5, 9, 19, 0, 15, 1, 3, 20, 2, 14, 18, 21,
+    3, 14, 16, 1, 12, 19, 5, 11, 20, 21, 3, 18, 19, 1, 5, 15,
+    31, 41, 42, 1, 8, 9, 16, 20, 1, 5, 15, 18, 19, 21, 41, 18,
+    14, 18, 2, 4, 18, 21, 5, 9, 18, 21, 0, 9, 12, 13, 14, 19,
+    18, 4, 13, 1, 5, 41, 1, 5, 21, 31, 1, 5, 9, 15, 1, 5,
+    16, 20, 8, 14, 14, 20, 9, 18, 19, 21, 14, 1, 5, 15, 19, 31,
+    41, 5, 21, 1, 5, 9, 15, 18, 19, 1, 5, 9, 20, 1, 5, 18,
+    19, 0, 12, 19, 14, 18, 0, 5, 1, 4, 5, 7, 15, 1, 4, 5,
+    19, 2, 1, 3, 5, 0, 12, 19, 20, 11, 0, 2, 4, 12, 13, 18,
+    20, 26, 6, 13, 14, 19, 21, 14, 19, 21, 9, 1, 1, 9, 8, 1,
+    2, 5, 9, 13, 18, 19, 23, 41, 14, 16, 18, 19, 5, 0, 2, 6,
+    7, 9, 11, 13, 14, 16, 18, 19, 20, 21, 1, 5, 12, 15, 18, 19,
+    31, 5, 9, 18, 19, 31, 0, 1, 2, 3, 6, 9, 12, 13, 14, 16,
+    18, 19, 21, 24, 18, 0, 9, 12, 15, 13, 14, 5, 12, 14, 15, 19,
+    1, 5, 9, 15, 41, 1, 15, 2, 5, 6, 7, 14, 18, 0, 5, 8,
+    1, 1, 3, 11, 20, 21, 1, 5, 9, 15, 18, 19, 21, 31, 41, 2,
+    6, 7, 11, 13, 18, 19, 1, 5, 23, 13, 14, 21, 19, 4, 7, 12,
+    14, 16, 26, 0, 2, 12, 14, 18, 19, 20, 14, 18, 19, 20, 0, 1,
+    5, 9, 15, 21, 41, 9, 5, 6, 12, 15, 18, 1, 3, 5, 8, 15,
+    16, 21, 0, 1, 5, 9, 15, 18, 21, 31, 41, 12, 0, 2, 3, 4,
+    7, 11, 12, 13, 14, 19, 20, 21, 1, 21, 8, 0, 1, 5, 19, 21,
+    25, 0, 3, 5, 9, 11, 13, 14, 18, 20, 0, 1, 5, 9, 10, 12,
+    15, 18, 19, 21, 31, 0, 1, 5, 8, 9, 12, 14, 18, 19, 20, 4,
+    5, 7, 11, 13, 14, 15, 19, 0, 1, 5, 9, 12, 14, 15, 18, 19,
+    20, 1, 15, 21, 0, 1, 5, 19, 20, 0, 2, 4, 6, 7, 9, 12,
+    13, 18, 19, 21, 41, 1, 3, 11, 16, 20, 26, 31, 0, 1, 5, 8,
+    9, 15, 18, 23, 29, 31, 20, 9, 2, 4, 5, 7, 8, 9, 11, 13,
+    18, 19, 20, 22, 23, 25, 31, 42, 19, 6, 20, 0, 18, 19, 0, 12,
+    1, 5, 12, 20, 1, 15, 31, 20, 21, 15, 20, 0, 2, 4, 7, 12,
+    14, 16, 18, 19, 21, 0, 1, 5, 9, 12, 15, 18, 19, 20, 21, 8,
+    1, 5, 15, 18, 21, 1, 2, 5, 6, 8, 9, 12, 13, 14, 18, 21,
+    18, 19, 0, 1, 12, 14, 15, 18, 1, 4, 5, 14, 15, 18, 19, 21,
+    1, 9, 12, 15, 19, 20, 5, 1, 5, 15, 21, 31, 42, 1, 5, 9,
+    3, 4, 6, 12, 13, 14, 16, 18, 19, 6, 1, 5, 15, 1, 5, 8,
+    9, 1, 2, 5, 8, 9, 15, 18, 19, 21, 8, 13, 1, 1, 5, 9,
+    20, 21, 23, 31, 41, 1, 6, 7, 12, 13, 18, 19, 20, 21, 1, 8,
+    2, 3, 6, 9, 13, 14, 18, 19, 20, 24, 9, 11, 13, 14, 19, 1,
+    2, 6, 12, 13, 16, 18, 26, 5, 8, 9, 18, 1, 5, 9, 11, 15,
+    16, 20, 1, 5, 8, 9, 15, 18, 21, 31, 18, 19, 1, 0, 12, 20,
+    2, 6, 7, 11, 12, 13, 16, 19, 20, 21, 24, 2, 3, 9, 12, 13,
+    14, 16, 18, 19, 20, 21, 23, 24, 1, 5, 9, 12, 18, 21, 11, 14,
+    15, 19, 1, 9, 1, 21, 31, 13, 18, 19, 1, 5, 9, 15, 31, 42,
+    1, 3, 5, 9, 15, 16, 20, 1, 5, 8, 15, 18, 19, 21, 31, 2,
+    14, 5, 9, 15, 20, 23, 14, 1, 5, 12, 19, 5, 18, 2, 18, 19,
+    1, 5, 6, 9, 12, 14, 15, 19, 20, 1, 5, 12, 18, 21, 14, 19,
+    20, 5, 12, 42, 1, 5, 9, 15, 16, 19, 21, 1, 5, 9, 15, 21,
+    26, 20, 1, 8, 42, 1, 3, 4, 5, 6, 7, 9, 12, 15, 16, 18,
+    19, 20, 23, 26, 42, 0, 2, 5, 7, 15, 18, 19, 31, 5, 5, 23,
+    5, 14, 19, 20, 14, 5, 13, 14, 4, 15, 12, 19, 21, 1, 9, 4,
+    12, 5, 9, 23, 14, 1, 6, 7, 12, 18, 19, 8, 11, 5, 12, 13,
+    18, 21, 14, 19, 1, 5, 9, 12, 18, 1, 5, 11, 12, 20, 1, 5,
+    1, 4, 5, 6, 7, 11, 12, 14, 15, 19, 20, 23, 26, 1, 4, 5,
+    14, 15, 19, 26, 1, 3, 9, 19, 20, 5, 15, 0, 2, 5, 6, 7,
+    11, 18, 19, 15, 14, 16, 5, 41, 5, 21, 19, 13, 14, 18, 2, 8,
+    5, 9, 8, 12, 18, 20, 6, 1, 5, 18, 2, 5, 6, 7, 11, 12,
+    13, 14, 19, 20, 1, 5, 6, 9, 12, 15, 19, 20, 21, 41, 16, 21,
+    1, 5, 7, 9, 14, 16, 19, 20, 21, 26, 9, 1, 2, 4, 5, 6,
+    7, 8, 9, 11, 14, 19, 20, 21, 26, 41, 1, 5, 9, 12, 16, 19,
+    20, 26, 1, 19, 14, 18, 12, 12, 14, 19, 5, 14, 18, 19, 20, 1,
+    5, 18, 1, 4, 5, 12, 21, 16, 2, 5, 6, 8, 15, 20, 22, 9,
+    15, 16, 19, 20, 0, 1, 5, 9, 21, 11, 2, 3, 4, 14, 20, 21,
+    23, 1, 2, 3, 7, 8, 9, 12, 14, 19, 20, 21, 3, 5, 7, 14,
+    19, 20, 3, 19, 13, 14, 19, 20, 14, 19, 20, 19, 19, 19, 5, 18,
+    8, 9, 5, 18, 21, 19, 1, 12, 0, 1, 4, 5, 11, 19, 12, 20,
+    0, 1, 4, 5, 9, 19, 20, 21, 31, 3, 5, 16, 5, 8, 19, 20,
+    15, 7, 0, 4, 8, 11, 19, 20, 0, 3, 4, 6, 7, 9, 11, 12,
+    13, 14, 15, 16, 18, 20, 4, 5, 7, 14, 15, 19, 20, 8, 12, 14,
+    19, 20, 21, 3, 6, 13, 14, 19, 20, 4, 21, 2, 4, 13, 20, 21,
+    8, 15, 21, 0, 2, 12, 14, 18, 19, 20, 13, 20, 9, 21, 6, 8,
+    16, 18, 9, 12, 21, 1, 5, 8, 9, 15, 18, 31, 41, 42, 14, 5,
+    9, 18, 21, 19, 19, 1, 8, 12, 6, 11, 12, 18, 4, 5, 7, 8,
+    3, 7, 9, 14, 19, 20, 1, 3, 9, 16, 21, 9, 26, 7, 11, 5,
+    12, 1, 6, 20, 1, 5, 2, 14, 18, 19, 1, 20, 8, 9, 18, 18,
+    14, 19, 1, 21, 5, 9, 8, 1, 2, 3, 6, 7, 11, 12, 14, 15,
+    18, 19, 20, 21, 2, 3, 4, 6, 8, 9, 12, 13, 14, 18, 19, 20,
+    24, 1, 3, 14, 16, 18, 19, 5, 21, 5, 2, 6, 8, 12, 18, 19,
+    1, 5, 8, 9, 15, 16, 20, 18, 6, 8, 13, 14, 18, 20, 8, 18,
+    19, 12, 18, 11, 19, 12, 1, 20, 0, 2, 3, 4, 7, 12, 13, 14,
+    16, 18, 20, 6, 8, 9, 13, 14, 18, 19, 24, 4, 14, 19, 20, 1,
+    3, 16, 20, 5, 9, 8, 13, 14, 16, 1, 20, 14, 16, 3, 2, 8,
+    5, 9, 6, 20, 5, 1, 5, 15, 20, 14, 5, 1, 4, 5, 20, 20,
+    5, 9, 5, 13, 19, 9, 18, 15, 18, 19, 1, 5, 9, 15, 18, 31,
+    0, 8, 5, 18, 6, 15, 9, 15, 12, 15, 12, 14, 18, 19, 18, 1,
+    2, 12, 16, 20, 41, 42, 13, 15, 16, 20, 0, 1, 2, 3, 4, 5,
+    6, 7, 8, 11, 14, 15, 19, 23, 26, 8, 15, 16, 1, 2, 3, 4,
+    5, 7, 12, 13, 15, 19, 20, 21, 26, 8, 16, 20, 25, 5, 12, 13,
+    15, 19, 20, 2, 4, 5, 6, 7, 11, 14, 19, 5, 3, 4, 12, 18,
+    20, 42, 1, 11, 15, 5, 9, 1, 6, 12, 12, 1, 5, 14, 18, 3,
+    4, 5, 7, 12, 13, 14, 19, 26, 1, 2, 5, 6, 9, 12, 15, 19,
+    20, 31, 1, 2, 5, 9, 15, 16, 0, 1, 4, 5, 7, 9, 11, 15,
+    19, 20, 21, 26, 2, 12, 14, 9, 12, 15, 20, 0, 1, 2, 4, 5,
+    6, 8, 9, 11, 13, 15, 18, 19, 20, 21, 26, 41, 0, 1, 5, 9,
+    15, 16, 19, 20, 21, 23, 31, 1, 5, 8, 23, 12, 14, 18, 19, 9,
+    5, 9, 19, 0, 18, 19, 20, 19, 18, 19, 20, 5, 8, 15, 1, 5,
+    25, 4, 14, 18, 19, 20, 5, 14, 1, 19, 2, 16, 1, 4, 5, 6,
+    7, 8, 9, 10, 19, 20, 22, 2, 14, 18, 19, 20, 1, 5, 9, 12,
+    18, 1, 15, 16, 18, 20, 26, 1, 5, 8, 9, 15, 18, 19, 21, 7,
+    16, 18, 6, 19, 1, 5, 12, 25, 1, 5, 9, 21, 1, 9, 5, 6,
+    1, 3, 4, 6, 7, 9, 14, 20, 0, 5, 11, 13, 19, 20, 1, 15,
+    18, 14, 19, 19, 19, 0, 2, 4, 8, 11, 12, 13, 14, 19, 21, 0,
+    1, 3, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 18, 19, 23, 26,
+    0, 1, 2, 3, 4, 5, 6, 11, 12, 14, 16, 19, 20, 2, 3, 4,
+    7, 8, 9, 12, 19, 20, 21, 22, 23, 2, 3, 4, 8, 20, 4, 8,
+    20, 21, 19, 2, 3, 19, 2, 12, 13, 14, 19, 21, 8, 15, 18, 2,
+    5, 6, 8, 9, 13, 14, 18, 20, 22, 24, 1, 15, 4, 13, 14, 1,
+    5, 9, 8, 16, 18, 1, 5, 8, 9, 15, 18, 21, 31, 1, 5, 9,
+    15, 18, 21, 31, 13, 14, 5, 14, 21, 2, 3, 4, 7, 14, 19, 24,
+    1, 5, 9, 15, 25, 2, 16, 1, 1, 20, 14, 18, 12, 18, 12, 5,
+    5, 20, 18, 1, 2, 4, 5, 6, 7, 11, 12, 16, 18, 19, 22, 4,
+    6, 7, 9, 11, 18, 19, 20, 23, 26, 19, 1, 3, 11, 12, 14, 19,
+    20, 3, 18, 19, 16, 20, 4, 7, 26, 19, 12, 3, 5, 19, 5, 9,
+    12, 15, 18, 12, 18, 1, 12, 20, 1, 5, 9, 15, 20, 21, 5, 15,
+    20, 1, 6, 15, 31, 0, 1, 5, 15, 26, 3, 9, 16, 19, 5, 8,
+    19, 20, 21, 5, 6, 7, 14, 11, 16, 1, 3, 4, 5, 7, 12, 14,
+    18, 19, 20, 23, 5, 9, 15, 31, 41, 2, 20, 5, 3, 5, 9, 16,
+    20, 14, 20, 20, 14, 19, 1, 5, 9, 12, 13, 14, 15, 18, 19, 20,
+    21, 23, 31, 41, 1, 5, 19, 20, 18, 1, 14, 15, 18, 19, 0, 1,
+    16, 20, 5, 1, 5, 9, 15, 16, 20, 21, 19, 19, 12, 5, 8, 11,
+    5, 19, 6, 12, 14, 19, 5, 41, 1, 2, 16, 31, 1, 3, 5, 15,
+    19, 26, 31, 15, 1, 2, 4, 5, 11, 15, 19, 20, 21, 26, 41, 8,
+    11, 16, 20, 0, 1, 8, 9, 18, 21, 1, 4, 14, 18, 20, 2, 6,
+    12, 13, 14, 18, 21, 5, 9, 12, 4, 14, 19, 5, 21, 42, 5, 15,
+    21, 42, 15, 16, 1, 5, 13, 21, 13, 14, 12, 14, 18, 19, 21, 15,
+    21, 9, 31, 16, 21, 41, 1, 5, 9, 11, 15, 16, 20, 8, 14, 19,
+    3, 8, 12, 14, 18, 21, 6, 9, 12, 14, 16, 18, 19, 13, 1, 5,
+    15, 19, 31, 1, 21, 1, 15, 6, 12, 1, 5, 9, 15, 31, 41, 8,
+    20, 1, 18, 14, 18, 18, 2, 1, 12, 21, 5, 8, 1, 5, 14, 15,
+    19, 2, 12, 13, 14, 20, 0, 12, 18, 0, 1, 5, 9, 12, 14, 18,
+    19, 20, 21, 31, 21, 1, 9, 12, 0, 1, 2, 4, 5, 6, 13, 15,
+    41, 0, 1, 15, 16, 19, 21, 1, 4, 5, 6, 7, 8, 9, 11, 12,
+    14, 15, 18, 19, 20, 21, 31, 6, 3, 5, 18, 0, 1, 3, 5, 8,
+    11, 16, 19, 20, 21, 23, 1, 5, 8, 9, 15, 18, 19, 20, 21, 26,
+    31, 5, 1, 9, 0, 14, 19, 25, 18, 16, 1, 5, 15, 31, 18, 2,
+    3, 4, 6, 9, 11, 13, 14, 15, 16, 18, 19, 20, 21, 5, 18, 19,
+    0, 1, 3, 8, 9, 11, 12, 13, 14, 16, 18, 19, 20, 22, 24, 0,
+    5, 13, 20, 9, 12, 1, 4, 5, 7, 13, 14, 20, 19, 1, 5, 9,
+    15, 19, 31, 41, 5, 1, 2, 6, 12, 14, 18, 20, 22, 5, 16, 20,
+    21, 1, 5, 8, 6, 13, 18, 19, 20, 1, 1, 5, 23, 25, 19, 2,
+    12, 14, 16, 19, 21, 1, 15, 18, 18, 31, 2, 6, 12, 14, 18, 19,
+    20, 4, 5, 7, 11, 13, 14, 18, 19, 20, 1, 5, 1, 6, 16, 19,
+    6, 15, 1, 3, 9, 16, 20, 12, 18, 8, 19, 0, 2, 3, 4, 6,
+    8, 11, 12, 13, 14, 16, 18, 19, 20, 21, 24, 26, 5, 25, 1, 5,
+    15, 18, 19, 21, 42, 0, 2, 3, 6, 9, 11, 12, 13, 14, 16, 18,
+    19, 20, 21, 22, 24, 1, 21, 1, 5, 9, 14, 15, 16, 18, 19, 0,
+    3, 4, 5, 11, 12, 13, 14, 15, 18, 19, 20, 22, 41, 1, 5, 42,
+    5, 9, 19, 1, 2, 3, 6, 12, 13, 16, 18, 19, 20, 23, 1, 3,
+    5, 9, 16, 20, 21, 1, 4, 5, 6, 7, 8, 9, 12, 14, 15, 18,
+    19, 23, 26, 41, 0, 18, 20, 42, 5, 12, 15, 31, 18, 4, 19, 5,
+    12, 18, 8, 18, 1, 25, 0, 4, 6, 8, 12, 16, 18, 19, 6, 0,
+    1, 2, 4, 19, 20, 23, 0, 5, 20, 5, 12, 7, 19, 18, 4, 7,
+    11, 12, 15, 19, 20, 5, 3, 18, 19, 1, 5, 12, 18, 8, 1, 19,
+    0, 3, 4, 6, 7, 8, 9, 11, 12, 14, 16, 18, 19, 20, 21, 22,
+    23, 24, 26, 27, 1, 5, 19, 8, 1, 2, 5, 7, 15, 19, 25, 0,
+    2, 3, 4, 6, 8, 9, 12, 13, 14, 16, 18, 19, 20, 21, 22, 5,
+    15, 18, 42, 1, 5, 9, 15, 18, 19, 1, 5, 21, 1, 2, 3, 4,
+    5, 11, 14, 15, 19, 20, 22, 0, 1, 5, 12, 13, 18, 20, 0, 1,
+    5, 1, 5, 9, 1, 5, 15, 0, 1, 2, 6, 7, 8, 11, 12, 13,
+    14, 15, 16, 18, 19, 21, 23, 24, 26, 5, 15, 31, 42, 1, 3, 5,
+    9, 11, 16, 20, 23, 26, 1, 5, 8, 18, 19, 41, 6, 8, 13, 14,
+    16, 19, 26, 5, 5, 6, 8, 13, 16, 19, 20, 4, 8, 12, 19, 2,
+    2, 3, 4, 6, 11, 12, 13, 14, 16, 18, 19, 20, 21, 22, 24, 9,
+    5, 8, 3, 8, 9, 12, 14, 18, 19, 24, 1, 5, 5, 12, 19, 1,
+    5, 12, 21, 25, 2, 8, 18, 1, 5, 8, 9, 15, 18, 21, 0, 1,
+    3, 5, 11, 15, 16, 20, 31, 1, 5, 8, 9, 13, 14, 15, 18, 21,
+    25, 42, 8, 13, 14, 18, 5, 2, 3, 6, 12, 13, 14, 20, 24, 5,
+    9, 11, 14, 15, 18, 19, 0, 1, 9, 14, 15, 31, 42, 4, 13, 14,
+    20, 6, 14, 18, 1, 5, 15, 3, 8, 16, 20, 21, 1, 5, 8, 9,
+    18, 21, 9, 18, 1, 13, 23, 8, 8, 5, 9, 2, 18, 19, 1, 5,
+    1, 5, 9, 18, 19, 4, 14, 31, 1, 5, 9, 0, 1, 2, 6, 12,
+    19, 23, 1, 5, 7, 9, 11, 6, 1, 5, 6, 15, 1, 9, 16, 20,
+    5, 8, 15, 19, 1, 15, 23, 11, 18, 19, 18, 5, 18, 0, 9, 18,
+    18, 19, 20, 19, 13, 19, 20, 12, 13, 18, 19, 11, 12, 14, 19, 0,
+    1, 9, 18, 21, 22, 13, 5, 14, 19, 8, 12, 14, 18, 2, 5, 6,
+    7, 12, 14, 18, 19, 23, 8, 5, 9, 18, 3, 12, 18, 2, 1, 5,
+    20, 21, 1, 5, 11, 12, 19, 20, 20, 0, 1, 2, 4, 7, 11, 12,
+    14, 16, 18, 23, 26, 2, 3, 9, 18, 20, 26, 1, 8, 20, 0, 15,
+    19, 6, 7, 19, 1, 21, 18, 5, 20, 8, 18, 9, 13, 5, 12, 5,
+    14, 19, 1, 4, 5, 15, 19, 20, 31, 0, 13, 16, 1, 5, 9, 15,
+    19, 20, 9, 0, 1, 4, 5, 6, 7, 9, 12, 14, 16, 18, 19, 20,
+    26, 31, 41, 19, 20, 1, 5, 20, 0, 5, 2, 4, 11, 18, 19, 21,
+    2, 5, 6, 9, 13, 14, 18, 11, 13, 14, 1, 5, 9, 21, 42, 24,
+    1, 15, 31, 1, 16, 20, 19, 2, 19, 18, 20, 15, 14, 18, 1, 5,
+    9, 14, 15, 18, 1, 4, 5, 9, 13, 15, 16, 1, 6, 7, 9, 11,
+    19, 20, 12, 1, 5, 13, 1, 3, 8, 15, 16, 20, 5, 9, 15, 5,
+    5, 20, 4, 14, 16, 19, 20, 21, 0, 2, 5, 9, 11, 18, 24, 0,
+    13, 14, 14, 16, 18, 20, 23, 27, 3, 7, 19, 20, 3, 4, 14, 21,
+    6, 7, 13, 3, 4, 19, 5, 12, 9, 11, 1, 4, 5, 9, 15, 19,
+    21, 7, 9, 13, 14, 19, 20, 21, 18, 0, 3, 4, 8, 13, 14, 16,
+    20, 21, 0, 3, 4, 6, 7, 9, 11, 16, 19, 21, 3, 4, 5, 7,
+    11, 16, 19, 3, 12, 14, 16, 19, 20, 3, 4, 14, 19, 12, 14, 18,
+    19, 21, 1, 5, 8, 18, 2, 8, 14, 18, 20, 4, 25, 8, 12, 14,
+    1, 8, 12, 15, 18, 21, 1, 5, 8, 9, 15, 18, 21, 31, 42, 13,
+    14, 14, 0, 2, 6, 7, 12, 14, 18, 20, 3, 4, 8, 9, 12, 13,
+    14, 18, 20, 24, 5, 4, 14, 6, 13, 20, 1, 5, 9, 15, 21, 1,
+    3, 5, 9, 20, 13, 18, 1, 5, 21, 21, 4, 6, 7, 9, 11, 13,
+    18, 20, 3, 5, 12, 19, 5, 9, 7, 18, 20, 13, 26, 19, 26, 7,
+    5, 19, 12, 6, 7, 9, 12, 15, 18, 19, 20, 21, 23, 26, 5, 9,
+    12, 18, 12, 0, 1, 21, 1, 7, 12, 16, 20, 21, 5, 13, 15, 20,
+    1, 2, 4, 6, 7, 11, 12, 13, 15, 18, 19, 23, 25, 26, 5, 16,
+    0, 1, 3, 4, 9, 13, 15, 19, 20, 21, 26, 0, 1, 3, 5, 19,
+    20, 1, 8, 13, 18, 3, 6, 7, 11, 14, 19, 20, 18, 14, 20, 4,
+    11, 14, 18, 21, 9, 12, 14, 18, 19, 16, 18, 1, 12, 15, 42, 11,
+    3, 19, 6, 12, 18, 21, 31, 5, 12, 5, 4, 5, 6, 7, 12, 14,
+    18, 19, 0, 2, 4, 5, 6, 9, 12, 19, 20, 26, 41, 1, 5, 16,
+    21, 0, 1, 3, 4, 5, 9, 11, 14, 19, 20, 31, 18, 21, 1, 4,
+    5, 9, 11, 12, 13, 14, 15, 19, 21, 26, 41, 0, 1, 3, 5, 8,
+    9, 16, 19, 20, 1, 9, 18, 19, 21, 12, 20, 1, 12, 20, 14, 1,
+    15, 12, 20, 5, 3, 8, 2, 7, 9, 12, 14, 18, 19, 20, 20, 21,
+    5, 12, 5, 16, 4, 5, 6, 7, 8, 19, 20, 22, 2, 11, 5, 1,
+    21, 19, 2, 3, 4, 7, 13, 14, 19, 21, 0, 1, 2, 3, 4, 5,
+    7, 8, 9, 14, 18, 19, 22, 1, 2, 4, 5, 6, 11, 12, 13, 14,
+    15, 19, 20, 26, 1, 2, 3, 11, 13, 16, 18, 19, 20, 6, 11, 14,
+    20, 21, 3, 19, 23, 7, 0, 3, 8, 12, 14, 8, 14, 20, 5, 6,
+    14, 19, 14, 18, 20, 13, 12, 5, 10, 12, 18, 14, 1, 6, 0, 5,
+    19, 5, 6, 15, 20, 1, 4, 7, 16, 20, 26, 8, 20, 2, 4, 8,
+    11, 13, 14, 18, 19, 21, 0, 2, 3, 4, 5, 6, 7, 9, 13, 14,
+    18, 19, 20, 22, 3, 5, 6, 7, 12, 14, 16, 2, 3, 8, 12, 14,
+    19, 20, 6, 8, 9, 13, 14, 16, 19, 20, 27, 4, 19, 21, 8, 3,
+    14, 2, 3, 4, 11, 12, 13, 14, 16, 18, 20, 21, 22, 1, 5, 8,
+    15, 8, 9, 11, 12, 13, 14, 18, 19, 20, 21, 9, 1, 4, 11, 12,
+    14, 20, 9, 2, 12, 16, 18, 1, 5, 9, 12, 15, 18, 1, 42, 1,
+    5, 8, 9, 15, 18, 21, 31, 41, 42, 21, 9, 25, 13, 12, 13, 14,
+    19, 18, 4, 20, 14, 19, 5, 13, 5, 6, 7, 9, 11, 18, 19, 20,
+    5, 12, 20, 21, 1, 3, 5, 19, 20, 1, 5, 8, 19, 1, 21, 20,
+    26, 1, 5, 6, 9, 14, 18, 19, 23, 8, 11, 5, 12, 15, 18, 1,
+    5, 6, 20, 7, 19, 0, 1, 12, 0, 1, 2, 5, 12, 15, 16, 19,
+    20, 5, 20, 0, 1, 2, 4, 5, 6, 7, 9, 11, 12, 15, 18, 19,
+    26, 5, 12, 15, 18, 1, 2, 4, 6, 13, 14, 15, 20, 26, 1, 3,
+    8, 19, 20, 1, 12, 18, 19, 20, 4, 6, 7, 11, 19, 20, 5, 18,
+    18, 14, 5, 12, 18, 21, 8, 11, 7, 9, 12, 13, 19, 20, 0, 1,
+    5, 6, 9, 12, 18, 20, 21, 21, 5, 2, 5, 6, 7, 13, 14, 15,
+    19, 20, 23, 20, 1, 5, 6, 9, 12, 13, 15, 20, 41, 2, 4, 9,
+    13, 16, 0, 1, 5, 6, 7, 11, 19, 20, 21, 26, 14, 16, 1, 8,
+    9, 20, 0, 1, 2, 5, 6, 7, 9, 11, 12, 14, 15, 20, 21, 26,
+    41, 1, 5, 9, 16, 20, 1, 5, 8, 9, 19, 31, 7, 13, 19, 1,
+    16, 12, 14, 12, 19, 5, 19, 20, 8, 3, 14, 20, 5, 8, 5, 14,
+    18, 6, 18, 1, 5, 6, 1, 9, 13, 16, 1, 4, 5, 6, 8, 9,
+    14, 15, 19, 20, 2, 14, 18, 12, 19, 21, 1, 5, 9, 13, 14, 19,
+    20, 0, 1, 5, 15, 1, 5, 8, 9, 26, 15, 13, 21, 7, 12, 14,
+    19, 20, 21, 25, 0, 1, 2, 4, 5, 9, 14, 18, 19, 5, 6, 13,
+    14, 16, 19, 20, 2, 3, 7, 18, 19, 1, 5, 11, 12, 20, 21, 6,
+    11, 13, 3, 19, 21, 19, 6, 4, 7, 11, 14, 18, 0, 4, 5, 9,
+    12, 14, 18, 19, 24, 5, 12, 14, 18, 16, 20, 1, 16, 12, 3, 8,
+    12, 12, 3, 7, 13, 18, 20, 21, 2, 5, 6, 9, 12, 14, 16, 18,
+    19, 24, 12, 15, 3, 4, 5, 13, 16, 18, 1, 16, 20, 21, 19, 12,
+    14, 8, 18, 5, 12, 8, 11, 25, 1, 5, 6, 12, 15, 18, 21, 31,
+    1, 4, 5, 7, 11, 12, 15, 19, 25, 26, 5, 0, 4, 5, 7, 8,
+    11, 19, 25, 14, 18, 5, 1, 4, 5, 7, 15, 20, 5, 12, 16, 41,
+    0, 8, 18, 19, 5, 2, 3, 4, 7, 8, 9, 14, 16, 19, 20, 3,
+    4, 6, 8, 9, 12, 16, 18, 19, 20, 21, 22, 26, 3, 5, 14, 19,
+    20, 7, 8, 12, 13, 14, 16, 18, 21, 1, 3, 5, 8, 9, 11, 12,
+    15, 16, 20, 21, 1, 5, 8, 15, 18, 19, 8, 13, 20, 21, 19, 2,
+    3, 4, 12, 13, 14, 19, 20, 21, 8, 18, 3, 5, 8, 9, 12, 13,
+    14, 18, 20, 24, 1, 4, 13, 14, 20, 1, 6, 16, 18, 1, 5, 8,
+    9, 15, 18, 1, 5, 9, 15, 18, 21, 31, 42, 14, 8, 21, 4, 7,
+    11, 12, 13, 14, 16, 18, 19, 20, 21, 24, 2, 3, 4, 6, 8, 9,
+    11, 12, 13, 14, 18, 19, 20, 21, 24, 5, 15, 4, 13, 14, 19, 9,
+    2, 4, 6, 12, 16, 18, 1, 5, 9, 15, 21, 41, 42, 1, 3, 5,
+    8, 11, 15, 16, 20, 9, 2, 5, 18, 18, 1, 5, 9, 12, 18, 21,
+    1, 1, 9, 18, 21, 9, 15, 20, 31, 1, 5, 9, 12, 15, 19, 31,
+    41, 1, 8, 19, 1, 4, 6, 7, 9, 13, 20, 19, 7, 20, 1, 15,
+    19, 1, 9, 15, 18, 20, 26, 12, 12, 3, 9, 18, 15, 5, 7, 5,
+    6, 12, 26, 3, 7, 19, 11, 5, 20, 5, 19, 21, 14, 8, 0, 15,
+    12, 15, 5, 18, 21, 0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11,
+    12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 26, 31, 0, 16, 0, 1,
+    4, 5, 12, 19, 20, 23, 26, 6, 0, 1, 9, 0, 8, 9, 16, 19,
+    20, 0, 5, 8, 18, 19, 14, 18, 21, 12, 9, 14, 16, 18, 13, 14,
+    1, 5, 21, 1, 5, 9, 15, 5, 20, 14, 19, 19, 1, 5, 9, 12,
+    13, 14, 15, 18, 19, 20, 21, 23, 31, 14, 5, 19, 20, 1, 2, 3,
+    14, 20, 21, 24, 1, 5, 12, 13, 14, 15, 18, 19, 1, 15, 19, 9,
+    12, 15, 21, 3, 5, 16, 12, 18, 19, 31, 8, 11, 1, 5, 18, 1,
+    5, 6, 9, 12, 15, 18, 31, 12, 14, 18, 19, 9, 18, 14, 1, 4,
+    5, 6, 9, 12, 15, 19, 20, 5, 0, 1, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 26, 31, 41,
+    1, 2, 5, 6, 7, 11, 14, 15, 18, 19, 20, 26, 41, 1, 3, 5,
+    16, 19, 20, 1, 5, 8, 15, 18, 19, 20, 26, 41, 5, 14, 21, 18,
+    20, 21, 3, 6, 9, 14, 18, 1, 12, 18, 19, 1, 15, 31, 42, 5,
+    1, 5, 16, 20, 1, 5, 15, 18, 19, 21, 14, 9, 18, 19, 20, 2,
+    6, 9, 14, 18, 19, 13, 1, 9, 1, 5, 15, 31, 16, 1, 5, 15,
+    1, 3, 15, 16, 20, 31, 14, 18, 1, 5, 12, 14, 21, 13, 0, 0,
+    7, 11, 13, 14, 18, 20, 21, 26, 2, 3, 4, 6, 9, 12, 14, 18,
+    20, 0, 5, 14, 19, 5, 9, 21, 31, 5, 6, 16, 18, 19, 5, 9,
+    31, 41, 1, 20, 26, 5, 18, 21, 8, 16, 19, 8, 18, 12, 2, 3,
+    11, 13, 14, 18, 19, 21, 12, 8, 1, 5, 9, 15, 18, 3, 9, 12,
+    13, 14, 18, 20, 24, 5, 12, 18, 19, 12, 5, 7, 11, 14, 16, 1,
+    5, 21, 1, 5, 9, 15, 2, 6, 8, 16, 18, 21, 24, 5, 20, 8,
+    13, 14, 18, 19, 1, 5, 23, 18, 4, 9, 12, 14, 18, 20, 21, 9,
+    7, 9, 10, 11, 12, 14, 18, 19, 20, 23, 4, 13, 14, 5, 15, 31,
+    2, 16, 6, 19, 16, 5, 9, 19, 21, 13, 18, 2, 3, 4, 5, 12,
+    13, 14, 18, 20, 21, 0, 1, 5, 9, 18, 19, 21, 31, 41, 42, 2,
+    3, 5, 6, 12, 13, 14, 18, 19, 20, 21, 24, 9, 15, 1, 5, 12,
+    15, 19, 1, 5, 4, 5, 7, 11, 19, 20, 1, 5, 42, 1, 0, 5,
+    12, 15, 20, 4, 12, 18, 19, 20, 21, 9, 1, 3, 5, 9, 11, 13,
+    20, 21, 26, 1, 5, 8, 15, 18, 19, 41, 8, 14, 5, 9, 5, 9,
+    21, 23, 8, 18, 19, 4, 12, 18, 0, 0, 5, 19, 0, 1, 4, 5,
+    7, 14, 15, 19, 25, 6, 20, 0, 3, 5, 8, 16, 19, 20, 0, 8,
+    11, 16, 20, 21, 26, 0, 18, 19, 0, 14, 18, 1, 5, 1, 5, 6,
+    12, 21, 1, 5, 16, 20, 1, 21, 0, 4, 19, 20, 12, 8, 5, 11,
+    14, 19, 5, 1, 7, 5, 12, 9, 1, 5, 15, 20, 21, 31, 1, 15,
+    14, 12, 5, 8, 3, 5, 8, 20, 19, 13, 19, 8, 3, 13, 16, 18,
+    20, 21, 1, 8, 18, 1, 5, 8, 9, 12, 14, 18, 19, 20, 21, 1,
+    4, 14, 19, 9, 21, 1, 1, 9, 6, 12, 13, 14, 16, 18, 20, 1,
+    5, 9, 15, 18, 1, 3, 5, 16, 20, 21, 1, 5, 9, 15, 18, 31,
+    41, 42, 6, 13, 8, 14, 2, 12, 13, 14, 16, 18, 20, 21, 6, 9,
+    12, 13, 14, 16, 18, 19, 24, 18, 25, 3, 4, 7, 9, 11, 14, 19,
+    22, 5, 2, 3, 6, 16, 19, 1, 5, 15, 21, 31, 1, 5, 15, 5,
+    8, 15, 18, 19, 8, 13, 14, 18, 20, 5, 23, 14, 19, 20, 1, 19,
+    20, 4, 11, 13, 14, 2, 6, 9, 12, 14, 18, 19, 24, 14, 12, 14,
+    18, 13, 7, 14, 16, 19, 21, 9, 12, 14, 18, 18, 6, 14, 9, 1,
+    14, 18, 0, 13, 19, 5, 9, 18, 19, 0, 20, 18, 1, 5, 9, 21,
+    15, 20, 14, 20, 20, 1, 8, 9, 15, 18, 19, 20, 21, 18, 1, 7,
+    1, 4, 3, 12, 12, 5, 7, 9, 1, 15, 20, 5, 18, 2, 4, 5,
+    6, 7, 8, 14, 15, 19, 20, 23, 26, 5, 13, 18, 21, 22, 12, 18,
+    20, 1, 5, 15, 14, 5, 12, 20, 1, 4, 5, 11, 12, 15, 20, 21,
+    20, 1, 2, 4, 5, 6, 9, 11, 12, 15, 19, 20, 21, 23, 26, 31,
+    1, 2, 3, 4, 5, 7, 9, 11, 13, 16, 19, 20, 21, 23, 3, 9,
+    15, 16, 20, 21, 26, 1, 5, 8, 18, 20, 6, 19, 20, 14, 19, 5,
+    9, 6, 9, 5, 12, 5, 18, 3, 7, 12, 13, 14, 19, 20, 1, 2,
+    4, 5, 12, 15, 19, 20, 31, 41, 9, 16, 0, 1, 4, 5, 7, 9,
+    12, 14, 15, 19, 20, 26, 12, 0, 1, 2, 3, 4, 5, 6, 7, 9,
+    11, 12, 14, 15, 18, 19, 26, 31, 0, 1, 5, 19, 1, 5, 8, 21,
+    16, 19, 1, 19, 19, 13, 4, 18, 5, 18, 19, 25, 12, 18, 26, 12,
+    18, 1, 15, 31, 0, 4, 6, 7, 8, 9, 14, 15, 19, 20, 18, 19,
+    15, 16, 19, 20, 5, 2, 0, 3, 14, 18, 19, 21, 0, 2, 7, 8,
+    9, 13, 18, 21, 3, 5, 6, 7, 13, 14, 16, 18, 19, 20, 26, 3,
+    9, 11, 16, 18, 19, 2, 4, 7, 13, 14, 24, 4, 18, 3, 6, 19,
+    20, 3, 12, 3, 4, 8, 13, 3, 5, 19, 20, 21, 25, 22, 2, 12,
+    18, 22, 13, 18, 16, 4, 12, 19, 1, 10, 19, 5, 6, 1, 12, 1,
+    1, 5, 11, 14, 21, 5, 9, 19, 20, 21, 0, 5, 6, 19, 20, 26,
+    1, 2, 3, 4, 5, 7, 9, 13, 14, 16, 11, 16, 20, 26, 5, 9,
+    18, 19, 20, 14, 5, 4, 8, 12, 20, 21, 23, 26, 0, 1, 3, 4,
+    6, 7, 9, 12, 14, 19, 22, 2, 3, 5, 16, 19, 2, 3, 8, 9,
+    11, 14, 16, 20, 21, 6, 14, 3, 4, 14, 21, 8, 2, 3, 11, 13,
+    14, 18, 21, 22, 8, 2, 3, 9, 14, 18, 22, 24, 1, 4, 14, 19,
+    12, 14, 16, 18, 1, 5, 8, 15, 21, 31, 1, 5, 9, 15, 18, 21,
+    31, 42, 12, 5, 8, 2, 4, 11, 12, 13, 14, 18, 21, 9, 12, 14,
+    18, 20, 24, 4, 13, 14, 15, 19, 20, 6, 1, 5, 15, 21, 42, 1,
+    5, 15, 16, 20, 26, 2, 13, 14, 18, 19, 21, 12, 18, 18, 1, 5,
+    9, 16, 20, 5, 7, 12, 19, 1, 4, 7, 19, 20, 23, 0, 2, 5,
+    9, 11, 15, 19, 20, 1, 3, 16, 20, 21, 0, 12, 9, 4, 7, 3,
+    5, 5, 19, 18, 0, 1, 2, 4, 5, 6, 7, 8, 9, 12, 14, 15,
+    18, 19, 21, 23, 26, 31, 5, 8, 11, 1, 4, 5, 9, 10, 12, 13,
+    18, 21, 1, 5, 18, 19, 20, 21, 42, 1, 4, 5, 7, 9, 12, 14,
+    15, 15, 5, 9, 11, 12, 18, 20, 1, 9, 20, 1, 9, 13, 14, 15,
+    16, 20, 21, 1, 4, 5, 6, 7, 8, 12, 14, 15, 16, 19, 20, 23,
+    26, 31, 6, 8, 15, 16, 1, 3, 5, 6, 7, 9, 13, 15, 20, 21,
+    0, 1, 4, 5, 7, 8, 9, 11, 15, 16, 19, 20, 31, 1, 5, 9,
+    12, 13, 15, 18, 19, 20, 26, 41, 2, 6, 7, 14, 19, 20, 1, 5,
+    1, 3, 14, 18, 21, 25, 9, 18, 19, 20, 4, 14, 1, 5, 9, 15,
+    21, 31, 41, 18, 5, 1, 5, 8, 9, 11, 15, 16, 20, 6, 13, 14,
+    5, 18, 5, 9, 12, 14, 15, 18, 19, 23, 42, 2, 3, 4, 6, 7,
+    8, 11, 12, 14, 18, 19, 20, 21, 0, 2, 9, 12, 13, 14, 18, 19,
+    24, 4, 13, 2, 16, 18, 19, 1, 5, 9, 21, 42, 1, 20, 8, 19,
+    21, 12, 13, 5, 13, 18, 20, 4, 18, 19, 5, 12, 18, 8, 18, 1,
+    6, 1, 5, 12, 15, 18, 31, 5, 18, 19, 20, 2, 4, 6, 7, 8,
+    12, 13, 14, 19, 20, 27, 15, 20, 26, 1, 5, 6, 9, 0, 1, 5,
+    15, 16, 19, 21, 0, 1, 3, 4, 5, 7, 11, 14, 19, 20, 26, 6,
+    19, 1, 6, 9, 18, 20, 0, 1, 5, 6, 7, 8, 9, 11, 12, 13,
+    14, 18, 19, 21, 23, 26, 31, 41, 0, 1, 5, 8, 9, 11, 16, 20,
+    21, 23, 25, 1, 8, 9, 19, 20, 5, 6, 11, 12, 14, 18, 20, 15,
+    9, 8, 3, 5, 9, 14, 18, 5, 15, 21, 31, 1, 5, 21, 42, 16,
+    20, 21, 14, 18, 19, 20, 14, 18, 20, 41, 1, 15, 14, 0, 4, 13,
+    14, 19, 9, 8, 11, 12, 1, 15, 19, 0, 2, 6, 14, 18, 19, 5,
+    14, 18, 5, 15, 19, 20, 21, 1, 1, 13, 15, 16, 1, 4, 5, 6,
+    8, 9, 10, 11, 15, 19, 20, 21, 22, 26, 13, 6, 20, 0, 1, 3,
+    8, 12, 15, 16, 19, 20, 1, 5, 18, 19, 21, 26, 31, 5, 9, 18,
+    9, 1, 5, 31, 12, 14, 16, 18, 18, 1, 9, 21, 5, 5, 18, 21,
+    5, 16, 20, 2, 7, 13, 14, 18, 20, 21, 8, 2, 3, 5, 6, 9,
+    12, 14, 16, 18, 19, 24, 7, 13, 14, 2, 6, 12, 16, 18, 21, 23,
+    5, 11, 16, 31, 5, 9, 19, 18, 19, 13, 18, 2, 4, 7, 11, 13,
+    14, 16, 18, 20, 21, 4, 6, 16, 18, 19, 4, 14, 6, 18, 6, 11,
+    20, 26, 13, 14, 19, 18, 19, 14, 19, 11, 0, 1, 2, 5, 10, 12,
+    18, 8, 5, 8, 12, 15, 18, 5, 18, 18, 11, 18, 19, 5, 25, 9,
+    31, 9, 15, 5, 16, 20, 1, 2, 3, 4, 5, 7, 11, 16, 20, 31,
+    1, 5, 11, 16, 20, 1, 5, 8, 9, 5, 18, 9, 15, 18, 31, 18,
+    21, 2, 19, 20, 2, 3, 4, 12, 13, 14, 18, 21, 8, 2, 9, 12,
+    18, 20, 24, 1, 4, 13, 1, 5, 25, 16, 18, 1, 8, 9, 15, 18,
+    21, 1, 5, 9, 15, 18, 21, 31, 42, 6, 13, 14, 13, 21, 12, 2,
+    7, 12, 13, 14, 16, 18, 20, 21, 1, 3, 8, 9, 12, 13, 14, 18,
+    19, 1, 5, 21, 3, 4, 13, 14, 20, 2, 6, 18, 23, 1, 5, 9,
+    15, 31, 41, 5, 15, 16, 20, 2, 8, 13, 18, 8, 12, 19, 20, 14,
+    1, 19, 18, 19, 5, 6, 15, 20, 1, 5, 9, 12, 15, 18, 19, 21,
+    4, 19, 41, 2, 4, 5, 6, 7, 8, 11, 12, 16, 18, 19, 21, 23,
+    26, 1, 6, 7, 9, 18, 19, 20, 23, 1, 5, 9, 14, 15, 20, 21,
+    5, 16, 19, 20, 21, 1, 5, 15, 18, 19, 31, 16, 15, 14, 3, 7,
+    14, 16, 20, 21, 12, 14, 18, 4, 13, 6, 6, 18, 15, 5, 21, 16,
+    18, 14, 20, 4, 6, 13, 26, 3, 2, 3, 5, 6, 7, 11, 5, 18,
+    3, 21, 4, 11, 5, 12, 1, 2, 5, 6, 7, 11, 12, 13, 18, 19,
+    20, 31, 8, 9, 11, 1, 5, 13, 18, 19, 31, 1, 5, 7, 9, 12,
+    14, 15, 12, 15, 19, 5, 20, 1, 4, 5, 9, 12, 16, 20, 21, 22,
+    9, 13, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 14, 19, 20, 21,
+    23, 26, 31, 18, 1, 2, 7, 8, 9, 11, 15, 18, 19, 20, 21, 26,
+    1, 5, 16, 19, 20, 26, 1, 5, 13, 15, 19, 20, 21, 31, 6, 12,
+    14, 18, 19, 20, 15, 5, 18, 5, 19, 20, 20, 14, 19, 20, 1, 9,
+    18, 1, 5, 13, 18, 5, 18, 9, 6, 14, 18, 6, 1, 5, 12, 18,
+    6, 7, 12, 14, 19, 1, 2, 4, 5, 6, 11, 12, 15, 19, 20, 9,
+    16, 21, 1, 4, 5, 7, 9, 11, 15, 19, 20, 21, 1, 9, 0, 1,
+    5, 6, 7, 9, 11, 14, 19, 20, 26, 1, 5, 16, 19, 20, 26, 31,
+    1, 8, 18, 20, 21, 5, 12, 2, 14, 9, 5, 8, 9, 1, 9, 18,
+    25, 4, 12, 14, 18, 19, 20, 5, 1, 5, 9, 12, 18, 21, 1, 3,
+    4, 9, 26, 1, 13, 16, 1, 4, 5, 6, 7, 8, 9, 15, 19, 21,
+    14, 0, 9, 19, 23, 26, 0, 1, 3, 5, 16, 19, 20, 1, 5, 8,
+    15, 18, 19, 20, 21, 26, 1, 2, 11, 12, 14, 18, 19, 21, 2, 6,
+    9, 12, 14, 18, 19, 21, 1, 5, 11, 14, 19, 20, 6, 1, 9, 15,
+    16, 20, 5, 13, 14, 18, 21, 12, 19, 5, 10, 19, 5, 18, 5, 0,
+    1, 1, 18, 12, 4, 5, 4, 5, 9, 19, 20, 25, 31, 5, 6, 20,
+    1, 4, 6, 7, 20, 20, 9, 15, 18, 19, 14, 12, 14, 5, 12, 18,
+    1, 15, 5, 9, 14, 18, 8, 20, 13, 14, 16, 19, 20, 21, 8, 15,
+    4, 6, 9, 12, 14, 18, 21, 24, 18, 5, 15, 18, 21, 31, 5, 9,
+    15, 18, 21, 31, 42, 13, 14, 2, 11, 13, 18, 21, 4, 9, 12, 14,
+    18, 20, 21, 22, 4, 13, 14, 18, 19, 20, 5, 2, 16, 15, 41, 1,
+    3, 5, 11, 20, 13, 18, 12, 19, 11, 1, 4, 12, 20, 2, 9, 19,
+    4, 5, 6, 7, 9, 23, 26, 21, 1, 15, 16, 20, 21, 1, 19, 12,
+    18, 7, 12, 12, 14, 18, 4, 11, 26, 18, 19, 5, 20, 5, 12, 12,
+    20, 5, 8, 9, 12, 15, 18, 19, 21, 31, 8, 1, 4, 5, 12, 13,
+    18, 22, 18, 1, 5, 7, 9, 18, 1, 14, 15, 5, 7, 18, 19, 1,
+    15, 18, 20, 31, 0, 1, 2, 4, 5, 6, 7, 9, 12, 16, 19, 20,
+    21, 25, 31, 1, 5, 9, 14, 15, 16, 19, 20, 0, 1, 2, 4, 5,
+    6, 7, 8, 9, 11, 12, 14, 15, 16, 18, 19, 20, 23, 26, 31, 20,
+    5, 6, 15, 18, 19, 0, 1, 3, 4, 5, 9, 11, 12, 15, 18, 20,
+    21, 0, 3, 6, 16, 19, 20, 25, 31, 1, 5, 8, 13, 15, 19, 6,
+    9, 12, 19, 5, 9, 9, 18, 19, 2, 14, 14, 19, 12, 13, 18, 4,
+    6, 7, 9, 11, 14, 16, 18, 20, 21, 24, 1, 4, 5, 9, 12, 13,
+    14, 15, 18, 19, 20, 1, 13, 2, 3, 6, 14, 16, 18, 19, 20, 1,
+    5, 9, 15, 21, 41, 5, 16, 8, 9, 18, 14, 1, 19, 16, 19, 20,
+    21, 12, 14, 18, 1, 5, 11, 9, 9, 14, 18, 20, 0, 1, 18, 7,
+    12, 15, 18, 5, 13, 18, 1, 3, 4, 5, 7, 14, 16, 19, 5, 19,
+    20, 2, 5, 9, 11, 12, 15, 21, 31, 0, 2, 9, 16, 19, 21, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 14, 15, 19, 20,
+    21, 22, 23, 26, 2, 8, 18, 19, 1, 5, 6, 9, 15, 20, 0, 1,
+    2, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 19, 20, 21,
+    22, 23, 26, 41, 0, 1, 5, 8, 9, 11, 15, 16, 19, 20, 25, 1,
+    5, 8, 9, 20, 21, 26, 3, 5, 7, 14, 16, 18, 9, 15, 12, 14,
+    18, 14, 18, 19, 24, 12, 5, 19, 1, 18, 19, 21, 3, 4, 11, 13,
+    14, 18, 22, 9, 12, 14, 18, 19, 19, 21, 4, 1, 9, 15, 31, 5,
+    9, 15, 21, 2, 16, 18, 1, 15, 1, 3, 5, 19, 13, 14, 5, 12,
+    12, 18, 11, 2, 5, 0, 5, 9, 18, 25, 2, 12, 14, 18, 19, 21,
+    5, 12, 1, 5, 12, 14, 18, 19, 9, 1, 5, 9, 15, 18, 20, 1,
+    9, 16, 0, 1, 2, 4, 6, 7, 8, 11, 15, 16, 19, 20, 21, 22,
+    23, 2, 11, 12, 18, 15, 18, 1, 3, 5, 15, 16, 19, 21, 31, 1,
+    9, 15, 18, 19, 20, 2, 3, 7, 12, 14, 16, 18, 19, 20, 21, 3,
+    9, 12, 14, 18, 20, 4, 13, 14, 1, 5, 9, 15, 1, 5, 9, 2,
+    16, 18, 1, 5, 15, 31, 1, 5, 15, 20, 26, 1, 5, 9, 15, 18,
+    19, 13, 14, 18, 8, 16, 12, 2, 7, 7, 24, 14, 2, 4, 12, 14,
+    19, 21, 3, 9, 12, 14, 18, 19, 21, 24, 19, 2, 6, 16, 18, 1,
+    5, 16, 20, 1, 8, 6, 14, 18, 15, 20, 5, 10, 12, 19, 8, 18,
+    4, 5, 6, 5, 4, 11, 12, 0, 5, 9, 25, 5, 16, 5, 11, 19,
+    20, 25, 1, 5, 9, 19, 0, 1, 3, 4, 5, 7, 8, 12, 13, 19,
+    20, 41, 0, 5, 8, 11, 16, 20, 21, 1, 5, 8, 9, 15, 18, 31,
+    7, 19, 15, 25, 14, 2, 12, 19, 21, 19, 3, 2, 4, 7, 11, 12,
+    14, 18, 19, 20, 21, 22, 24, 8, 18, 2, 8, 9, 12, 13, 14, 16,
+    18, 20, 21, 24, 9, 4, 12, 13, 14, 19, 20, 1, 5, 9, 12, 25,
+    1, 4, 6, 13, 14, 16, 18, 1, 5, 8, 9, 15, 18, 42, 1, 5,
+    9, 15, 18, 21, 31, 42, 6, 13, 14, 18, 20, 5, 14, 21, 3, 11,
+    12, 14, 18, 20, 1, 5, 7, 8, 9, 12, 13, 14, 18, 19, 20, 21,
+    22, 5, 5, 15, 18, 21, 25, 3, 13, 14, 5, 5, 15, 9, 16, 18,
+    19, 1, 5, 9, 15, 42, 1, 16, 20, 2, 18, 19, 13, 21, 12, 18,
+    9, 5, 19, 5, 9, 18, 12, 18, 12, 0, 1, 2, 6, 7, 12, 13,
+    18, 19, 22, 23, 26, 1, 5, 7, 9, 11, 18, 19, 20, 22, 23, 1,
+    9, 19, 26, 3, 5, 16, 19, 1, 15, 18, 18, 18, 3, 7, 11, 14,
+    18, 19, 20, 21, 12, 14, 18, 19, 20, 21, 4, 7, 14, 5, 6, 16,
+    1, 5, 9, 21, 31, 41, 14, 18, 12, 5, 9, 13, 14, 21, 6, 19,
+    3, 19, 20, 13, 27, 3, 9, 8, 5, 19, 14, 5, 12, 1, 9, 19,
+    12, 13, 19, 21, 0, 1, 3, 6, 9, 14, 18, 22, 26, 20, 1, 5,
+    9, 15, 21, 41, 18, 5, 42, 8, 11, 16, 26, 14, 19, 20, 20, 2,
+    1, 5, 9, 12, 13, 15, 18, 19, 20, 21, 23, 41, 1, 5, 9, 19,
+    20, 11, 18, 3, 9, 12, 14, 19, 24, 1, 3, 6, 18, 21, 14, 19,
+    5, 9, 5, 3, 0, 8, 19, 3, 4, 7, 14, 21, 2, 3, 4, 9,
+    14, 18, 19, 20, 21, 1, 5, 9, 12, 15, 18, 19, 20, 21, 11, 19,
+    5, 9, 41, 31, 42, 1, 3, 5, 20, 31, 1, 5, 8, 18, 2, 3,
+    4, 14, 9, 12, 14, 18, 12, 5, 14, 5, 15, 9, 18, 16, 20, 12,
+    0, 9, 13, 14, 18, 19, 1, 5, 15, 19, 21, 31, 9, 1, 5, 9,
+    13, 15, 19, 12, 16, 1, 5, 9, 15, 20, 12, 1, 5, 3, 13, 19,
+    8, 21, 11, 2, 3, 9, 12, 19, 12, 15, 9, 31, 16, 15, 16, 2,
+    6, 14, 18, 19, 22, 8, 1, 5, 9, 15, 18, 31, 0, 6, 9, 18,
+    19, 21, 24, 1, 5, 12, 18, 20, 5, 12, 18, 5, 11, 20, 22, 26,
+    5, 12, 18, 1, 5, 19, 6, 16, 18, 11, 20, 8, 20, 1, 5, 9,
+    15, 23, 20, 2, 7, 12, 14, 16, 18, 19, 20, 21, 2, 6, 9, 12,
+    14, 16, 18, 3, 5, 7, 14, 1, 5, 9, 1, 18, 6, 11, 13, 14,
+    2, 7, 12, 14, 16, 18, 20, 21, 1, 5, 18, 19, 3, 5, 6, 8,
+    9, 13, 14, 18, 20, 21, 12, 18, 19, 21, 4, 5, 11, 13, 14, 5,
+    9, 15, 1, 5, 4, 6, 11, 18, 19, 20, 1, 5, 9, 12, 16, 20,
+    1, 5, 8, 18, 11, 18, 20, 5, 8, 1, 12, 14, 15, 4, 11, 19,
+    21, 1, 5, 8, 18, 19, 21, 2, 11, 12, 19, 0, 3, 4, 6, 9,
+    11, 12, 14, 18, 0, 1, 5, 9, 12, 15, 31, 5, 1, 5, 14, 1,
+    5, 9, 12, 1, 12, 15, 18, 20, 9, 26, 13, 0, 1, 2, 4, 7,
+    11, 12, 13, 14, 16, 18, 19, 20, 21, 23, 12, 1, 5, 0, 1, 2,
+    5, 9, 14, 15, 18, 19, 20, 21, 23, 1, 2, 3, 5, 6, 8, 9,
+    12, 13, 18, 20, 21, 1, 12, 1, 5, 8, 9, 12, 14, 18, 1, 3,
+    5, 12, 13, 14, 19, 21, 1, 18, 19, 1, 5, 15, 21, 23, 1, 5,
+    9, 15, 2, 12, 14, 16, 18, 21, 24, 1, 5, 8, 1, 8, 9, 11,
+    26, 1, 5, 8, 9, 15, 18, 21, 41, 6, 8, 13, 14, 19, 1, 5,
+    14, 20, 4, 12, 19, 1, 8, 15, 5, 9, 12, 14, 18, 24, 9, 15,
+    21, 1, 9, 12, 15, 18, 15, 15, 12, 1, 5, 8, 15, 18, 1, 5,
+    9, 15, 16, 20, 31, 1, 5, 8, 9, 15, 18, 21, 41, 13, 5, 2,
+    8, 11, 12, 13, 14, 19, 21, 2, 9, 12, 13, 14, 18, 19, 5, 9,
+    18, 4, 12, 13, 14, 9, 2, 16, 18, 19, 1, 5, 9, 15, 21, 1,
+    3, 5, 15, 16, 20, 1, 5, 8, 9, 15, 18, 18, 6, 12, 5, 12,
+    19, 5, 7, 5, 9, 13, 14, 9, 16, 19, 21, 12, 14, 19, 19, 3,
+    18, 1, 14, 19, 18, 14, 12, 14, 18, 19, 1, 18, 18, 8, 15, 12,
+    20, 1, 5, 9, 13, 20, 31, 1, 1, 4, 5, 6, 7, 9, 11, 12,
+    14, 15, 19, 20, 26, 9, 16, 19, 1, 2, 3, 4, 5, 6, 7, 11,
+    13, 14, 15, 16, 18, 20, 26, 5, 16, 19, 20, 1, 3, 5, 8, 9,
+    18, 6, 14, 19, 18, 19, 8, 1, 12, 14, 6, 3, 12, 13, 19, 20,
+    21, 0, 1, 4, 5, 9, 11, 12, 15, 19, 31, 1, 4, 5, 9, 15,
+    19, 20, 9, 20, 1, 5, 9, 12, 15, 18, 19, 21, 23, 31, 42, 1,
+    5, 19, 20, 18, 2, 4, 6, 9, 11, 13, 14, 18, 21, 0, 6, 9,
+    12, 14, 16, 18, 19, 4, 14, 19, 1, 5, 15, 31, 13, 18, 1, 42,
+    1, 5, 12, 26, 13, 18, 21, 1, 12, 14, 19, 21, 9, 14, 18, 5,
+    11, 0, 2, 15, 8, 19, 20, 14, 18, 2, 11, 12, 14, 16, 19, 5,
+    12, 18, 12, 5, 15, 26, 0, 1, 7, 19, 9, 14, 19, 5, 1, 9,
+    15, 1, 8, 19, 26, 9, 4, 8, 14, 21, 25, 0, 3, 5, 7, 14,
+    18, 7, 11, 26, 19, 11, 12, 4, 14, 1, 4, 9, 15, 26, 16, 4,
+    20, 2, 1, 5, 12, 20, 1, 6, 19, 20, 19, 20, 1, 5, 8, 9,
+    20, 21, 31, 14, 2, 14, 20, 21, 5, 9, 12, 14, 18, 18, 1, 1,
+    5, 31, 8, 1, 9, 15, 21, 31, 1, 16, 25, 5, 13, 11, 24, 0,
+    3, 4, 5, 7, 9, 13, 14, 18, 19, 5, 7, 12, 14, 20, 22, 2,
+    3, 4, 7, 10, 19, 20, 4, 6, 7, 12, 13, 16, 19, 22, 6, 7,
+    8, 14, 4, 9, 4, 9, 1, 5, 8, 9, 15, 21, 31, 41, 42, 19,
+    5, 2, 7, 20, 2, 3, 9, 12, 13, 14, 16, 18, 20, 14, 13, 16,
+    19, 23, 12, 20, 8, 13, 14, 18, 18, 12, 15, 9, 19, 23, 16, 4,
+    5, 19, 20, 1, 5, 8, 20, 5, 19, 9, 18, 11, 5, 5, 8, 15,
+    18, 19, 12, 12, 18, 20, 21, 2, 3, 12, 18, 19, 1, 2, 4, 5,
+    6, 7, 8, 9, 11, 12, 18, 19, 20, 23, 25, 26, 31, 0, 5, 8,
+    11, 0, 1, 5, 6, 8, 9, 15, 16, 18, 20, 12, 1, 5, 18, 20,
+    5, 7, 12, 13, 14, 15, 0, 12, 13, 14, 15, 20, 41, 3, 12, 18,
+    5, 11, 12, 18, 20, 21, 26, 42, 0, 1, 2, 4, 5, 9, 11, 13,
+    16, 19, 20, 21, 25, 31, 1, 5, 9, 13, 14, 19, 20, 1, 2, 4,
+    5, 6, 7, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 23, 26,
+    6, 15, 16, 18, 1, 3, 5, 6, 9, 11, 15, 20, 26, 0, 1, 3,
+    16, 20, 25, 0, 1, 5, 9, 13, 15, 18, 20, 26, 0, 2, 5, 6,
+    7, 13, 16, 18, 19, 20, 5, 20, 2, 3, 4, 12, 14, 18, 21, 3,
+    5, 9, 12, 14, 18, 13, 14, 20, 1, 5, 9, 41, 2, 1, 5, 1,
+    5, 15, 20, 21, 20, 2, 14, 5, 9, 12, 13, 18, 19, 20, 23, 3,
+    6, 11, 12, 13, 14, 18, 0, 9, 12, 13, 14, 15, 18, 19, 24, 14,
+    18, 20, 6, 14, 19, 1, 9, 41, 42, 11, 26, 31, 8, 19, 11, 18,
+    4, 12, 13, 20, 1, 12, 18, 19, 8, 11, 0, 1, 4, 9, 14, 21,
+    5, 6, 12, 15, 5, 7, 9, 1, 5, 9, 12, 15, 42, 0, 2, 4,
+    5, 6, 7, 12, 13, 14, 19, 20, 5, 11, 0, 1, 2, 5, 6, 9,
+    12, 15, 19, 20, 21, 0, 2, 4, 5, 9, 16, 19, 21, 0, 1, 4,
+    5, 6, 7, 8, 9, 12, 13, 14, 18, 19, 20, 26, 2, 14, 18, 5,
+    9, 15, 16, 21, 0, 1, 2, 4, 5, 6, 7, 8, 11, 12, 13, 14,
+    15, 18, 19, 20, 23, 26, 41, 0, 1, 3, 5, 15, 16, 19, 20, 21,
+    1, 8, 18, 5, 7, 12, 14, 18, 21, 1, 9, 1, 9, 15, 9, 13,
+    14, 19, 5, 12, 1, 9, 31, 41, 42, 2, 12, 20, 1, 21, 42, 1,
+    21, 31, 1, 18, 21, 4, 8, 11, 14, 16, 18, 19, 1, 2, 3, 12,
+    14, 20, 5, 19, 1, 5, 9, 15, 21, 1, 5, 9, 15, 1, 2, 7,
+    16, 18, 1, 5, 9, 21, 42, 5, 9, 16, 20, 21, 31, 4, 0, 12,
+    14, 0, 1, 2, 6, 9, 18, 6, 9, 12, 20, 19, 12, 14, 19, 20,
+    2, 5, 8, 15, 1, 5, 19, 6, 9, 12, 14, 18, 19, 21, 1, 5,
+    6, 15, 18, 19, 20, 31, 1, 5, 10, 12, 18, 1, 9, 14, 15, 31,
+    1, 5, 13, 16, 19, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14,
+    17, 19, 20, 22, 2, 1, 3, 9, 11, 13, 15, 16, 18, 19, 20, 1,
+    18, 19, 20, 21, 2, 11, 12, 13, 18, 19, 21, 6, 12, 14, 18, 20,
+    13, 1, 9, 15, 21, 21, 2, 12, 14, 18, 21, 9, 15, 31, 5, 8,
+    15, 16, 20, 1, 5, 9, 15, 18, 21, 13, 14, 19, 8, 2, 2, 7,
+    14, 18, 19, 21, 1, 3, 16, 24, 14, 19, 21, 1, 16, 20, 19, 2,
+    4, 12, 13, 14, 16, 18, 19, 20, 6, 9, 14, 15, 18, 19, 20, 4,
+    14, 14, 18, 19, 1, 11, 14, 18, 2, 4, 7, 12, 14, 18, 19, 20,
+    21, 5, 18, 6, 9, 13, 14, 16, 18, 19, 20, 21, 24, 4, 14, 20,
+    4, 8, 12, 16, 18, 1, 16, 21, 26, 31, 1, 5, 18, 4, 10, 12,
+    15, 18, 19, 8, 11, 5, 6, 12, 0, 1, 7, 12, 14, 18, 41, 14,
+    18, 12, 5, 9, 12, 19, 25, 0, 1, 2, 5, 14, 19, 20, 1, 4,
+    11, 14, 19, 20, 25, 6, 5, 6, 12, 20, 1, 3, 5, 15, 20, 42,
+    8, 9, 11, 19, 20, 21, 26, 1, 5, 8, 18, 19, 20, 21, 31, 12,
+    14, 20, 9, 18, 9, 21, 19, 15, 5, 20, 2, 20, 21, 7, 9, 12,
+    16, 18, 19, 22, 5, 15, 11, 1, 2, 13, 18, 20, 8, 13, 2, 4,
+    12, 13, 14, 18, 8, 2, 5, 6, 9, 14, 16, 18, 20, 24, 1, 9,
+    15, 21, 12, 1, 5, 9, 12, 15, 18, 25, 15, 15, 2, 16, 18, 1,
+    5, 8, 15, 21, 1, 5, 8, 9, 15, 18, 21, 31, 42, 3, 6, 2,
+    3, 4, 5, 6, 11, 12, 13, 14, 18, 20, 21, 5, 8, 9, 12, 13,
+    14, 15, 18, 19, 24, 5, 9, 15, 21, 3, 4, 11, 13, 14, 19, 2,
+    16, 18, 1, 5, 9, 15, 42, 5, 9, 15, 16, 20, 13, 14, 16, 18,
+    20, 8, 14, 18, 12, 18, 5, 9, 11, 5, 18, 1, 6, 19, 20, 18,
+    13, 18, 14, 19, 4, 6, 7, 9, 12, 19, 23, 26, 1, 4, 5, 6,
+    7, 9, 11, 12, 13, 14, 18, 19, 20, 23, 4, 18, 5, 15, 9, 16,
+    19, 20, 1, 5, 8, 15, 18, 19, 23, 12, 14, 19, 7, 9, 12, 18,
+    0, 8, 18, 14, 20, 14, 18, 20, 14, 16, 18, 19, 4, 14, 18, 6,
+    20, 1, 5, 8, 7, 5, 9, 31, 8, 14, 18, 0, 9, 19, 0, 1,
+    15, 3, 5, 5, 19, 26, 5, 19, 20, 27, 12, 21, 0, 5, 12, 16,
+    9, 0, 3, 5, 12, 21, 21, 8, 11, 5, 12, 13, 26, 4, 5, 9,
+    12, 13, 15, 18, 19, 31, 3, 8, 11, 1, 13, 18, 1, 5, 6, 18,
+    20, 1, 5, 7, 9, 14, 18, 19, 11, 12, 18, 1, 5, 9, 11, 20,
+    0, 1, 2, 4, 5, 9, 12, 15, 19, 20, 26, 1, 5, 13, 14, 16,
+    20, 0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 15, 16, 19, 20,
+    23, 26, 31, 5, 15, 16, 18, 0, 1, 2, 4, 5, 7, 9, 11, 13,
+    15, 18, 19, 20, 21, 1, 3, 9, 16, 20, 25, 1, 5, 8, 9, 12,
+    13, 15, 18, 20, 26, 0, 3, 5, 6, 7, 13, 18, 19, 27, 5, 9,
+    14, 21, 18, 2, 3, 12, 13, 18, 9, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    26, 31, 41, 16, 13, 19, 5, 19, 18, 20, 5, 31, 8, 11, 9, 9,
+    12, 14, 18, 19, 20, 6, 12, 1, 12, 18, 1, 5, 9, 12, 18, 19,
+    20, 41, 42, 0, 3, 4, 6, 7, 12, 13, 14, 19, 20, 5, 26, 0,
+    1, 2, 5, 6, 9, 12, 15, 19, 26, 1, 5, 9, 16, 0, 1, 2,
+    4, 5, 6, 9, 11, 15, 19, 20, 21, 26, 18, 5, 0, 1, 2, 5,
+    6, 7, 8, 9, 11, 13, 14, 15, 19, 21, 22, 26, 31, 41, 0, 1,
+    5, 11, 19, 20, 1, 8, 9, 21, 25, 26, 3, 12, 13, 14, 0, 1,
+    5, 9, 15, 16, 20, 26, 12, 14, 19, 19, 0, 12, 14, 19, 0, 4,
+    16, 18, 3, 6, 13, 16, 18, 23, 4, 20, 8, 5, 15, 25, 2, 8,
+    14, 18, 1, 5, 14, 18, 19, 1, 5, 9, 14, 15, 18, 19, 20, 21,
+    31, 2, 5, 9, 12, 15, 13, 19, 21, 1, 4, 6, 7, 8, 9, 14,
+    17, 19, 20, 22, 14, 14, 18, 21, 1, 3, 5, 9, 15, 16, 19, 20,
+    21, 1, 18, 21, 1, 5, 15, 2, 4, 12, 13, 14, 16, 18, 19, 20,
+    12, 14, 16, 18, 0, 6, 11, 14, 18, 19, 26, 1, 21, 8, 12, 13,
+    14, 16, 19, 23, 1, 5, 15, 15, 12, 14, 19, 2, 12, 22, 23, 18,
+    16, 0, 2, 3, 5, 6, 23, 2, 19, 14, 20, 2, 1, 5, 20, 19,
+    1, 10, 15, 20, 5, 20, 12, 5, 12, 14, 18, 0, 1, 4, 5, 9,
+    12, 15, 25, 5, 1, 5, 19, 5, 6, 18, 19, 3, 4, 5, 7, 8,
+    9, 15, 16, 20, 21, 0, 11, 13, 20, 26, 8, 20, 14, 20, 5, 1,
+    3, 7, 11, 12, 13, 14, 16, 18, 20, 21, 26, 27, 0, 7, 9, 14,
+    16, 18, 20, 26, 1, 5, 9, 31, 5, 11, 12, 15, 16, 19, 1, 5,
+    9, 21, 31, 4, 5, 7, 9, 11, 12, 14, 16, 18, 19, 20, 0, 1,
+    5, 9, 15, 21, 31, 41, 42, 2, 4, 11, 12, 14, 16, 18, 20, 4,
+    8, 18, 19, 20, 3, 12, 20, 19, 3, 2, 3, 7, 10, 12, 13, 14,
+    18, 19, 20, 21, 5, 8, 15, 18, 2, 3, 5, 8, 9, 12, 14, 16,
+    18, 19, 20, 11, 12, 13, 14, 19, 1, 6, 9, 12, 16, 18, 8, 9,
+    15, 18, 21, 1, 1, 5, 9, 15, 18, 21, 31, 41, 42, 13, 18, 0,
+    1, 2, 3, 4, 6, 7, 8, 11, 12, 13, 14, 16, 18, 19, 20, 21,
+    22, 24, 0, 1, 3, 4, 5, 7, 8, 9, 12, 13, 14, 16, 18, 19,
+    20, 21, 22, 23, 24, 5, 9, 15, 21, 1, 2, 3, 5, 6, 7, 11,
+    12, 13, 14, 15, 16, 18, 19, 20, 22, 0, 2, 3, 4, 6, 11, 12,
+    13, 14, 15, 16, 18, 19, 20, 21, 23, 26, 27, 1, 5, 9, 15, 21,
+    31, 41, 42, 20, 2, 3, 4, 5, 6, 7, 8, 11, 13, 14, 18, 19,
+    20, 41, 15, 0, 12, 16, 19, 2, 4, 7, 16, 18, 20, 21, 3, 12,
+    14, 18, 20, 3, 8, 18, 20, 14, 1, 9, 18, 8, 2, 9, 19, 20,
+    9, 20, 1, 5, 6, 9, 13, 15, 16, 19, 23, 0, 1, 4, 5, 6,
+    7, 9, 13, 19, 20, 23, 16, 1, 5, 6, 11, 12, 15, 20, 1, 5,
+    18, 18, 7, 8, 5, 12, 19, 20, 31, 9, 12, 14, 18, 19, 20, 21,
+    23, 5, 14, 20, 4, 7, 12, 27, 5, 14, 0, 1, 2, 4, 5, 6,
+    7, 8, 9, 11, 12, 13, 14, 18, 19, 20, 23, 26, 8, 21, 1, 4,
+    5, 9, 13, 15, 18, 19, 20, 18, 0, 5, 6, 7, 18, 1, 5, 7,
+    12, 15, 19, 12, 11, 12, 14, 18, 19, 1, 5, 11, 18, 20, 26, 0,
+    1, 2, 4, 5, 7, 9, 12, 13, 15, 19, 20, 21, 0, 5, 13, 16,
+    19, 20, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 19, 20, 23, 26, 31, 18, 5, 6, 12, 15, 16, 1, 2, 3,
+    4, 5, 7, 8, 9, 11, 12, 13, 15, 20, 21, 26, 0, 1, 3, 5,
+    16, 19, 20, 0, 1, 2, 5, 12, 15, 18, 19, 20, 2, 3, 4, 6,
+    7, 11, 13, 19, 21, 1, 20, 21, 18, 15, 20, 1, 5, 9, 12, 18,
+    21, 23, 18, 18, 14, 3, 4, 7, 11, 12, 13, 14, 18, 19, 1, 2,
+    5, 8, 11, 21, 9, 13, 14, 18, 20, 1, 6, 7, 1, 9, 18, 31,
+    41, 0, 3, 6, 11, 12, 13, 14, 19, 23, 26, 5, 20, 0, 1, 2,
+    4, 5, 6, 7, 9, 11, 12, 14, 15, 16, 19, 20, 31, 41, 0, 1,
+    2, 5, 9, 13, 15, 16, 19, 21, 0, 1, 4, 5, 6, 7, 9, 11,
+    14, 15, 19, 20, 25, 31, 41, 6, 0, 9, 16, 20, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21,
+    22, 23, 25, 26, 41, 1, 3, 16, 19, 20, 21, 0, 1, 12, 6, 13,
+    14, 16, 18, 1, 9, 1, 15, 1, 5, 9, 16, 20, 26, 19, 14, 18,
+    0, 7, 11, 12, 14, 16, 21, 0, 1, 2, 6, 9, 11, 13, 14, 15,
+    18, 19, 0, 3, 5, 12, 13, 14, 18, 21, 2, 3, 6, 8, 12, 19,
+    20, 21, 22, 2, 8, 14, 20, 12, 4, 7, 12, 13, 18, 3, 5, 0,
+    5, 2, 6, 7, 8, 9, 12, 14, 18, 19, 21, 27, 0, 5, 18, 1,
+    5, 9, 1, 5, 9, 12, 14, 18, 1, 5, 7, 12, 15, 20, 21, 41,
+    1, 13, 15, 16, 19, 0, 1, 4, 5, 6, 7, 8, 9, 10, 11, 14,
+    15, 19, 20, 21, 22, 19, 24, 12, 21, 1, 8, 15, 3, 5, 11, 12,
+    16, 18, 19, 20, 21, 1, 5, 8, 9, 21, 13, 1, 5, 15, 18, 1,
+    9, 14, 6, 9, 18, 14, 20, 14, 19, 14, 4, 19, 19, 20, 1, 5,
+    10, 12, 19, 20, 8, 11, 5, 21, 6, 18, 18, 26, 5, 16, 26, 1,
+    7, 9, 11, 15, 21, 1, 4, 5, 9, 25, 0, 1, 6, 8, 15, 20,
+    0, 3, 4, 5, 6, 7, 9, 11, 15, 19, 20, 21, 23, 31, 41, 5,
+    8, 16, 19, 20, 5, 8, 18, 19, 31, 9, 14, 21, 14, 0, 3, 4,
+    6, 7, 8, 9, 11, 12, 14, 19, 21, 27, 0, 1, 2, 3, 4, 6,
+    7, 8, 9, 12, 13, 14, 16, 18, 19, 20, 21, 22, 26, 2, 3, 4,
+    5, 7, 11, 14, 16, 22, 24, 26, 0, 2, 3, 5, 9, 11, 12, 13,
+    14, 16, 19, 21, 25, 1, 2, 3, 6, 11, 13, 14, 16, 19, 20, 23,
+    3, 4, 7, 14, 19, 20, 21, 27, 3, 8, 13, 16, 19, 20, 2, 3,
+    7, 13, 2, 3, 4, 8, 12, 13, 14, 18, 19, 21, 22, 8, 15, 2,
+    5, 6, 8, 9, 13, 14, 16, 18, 19, 20, 22, 24, 4, 11, 14, 18,
+    1, 5, 15, 6, 12, 13, 16, 18, 21, 1, 5, 8, 9, 15, 18, 21,
+    31, 1, 5, 8, 9, 15, 18, 21, 25, 31, 42, 2, 14, 1, 8, 14,
+    21, 2, 3, 4, 7, 8, 11, 12, 14, 16, 18, 2, 9, 12, 13, 14,
+    15, 18, 19, 9, 15, 31, 4, 7, 14, 5, 18, 19, 15, 42, 1, 5,
+    16, 20, 26, 6, 8, 12, 14, 1, 8, 9, 18, 5, 6, 1, 12, 19,
+    18, 9, 0, 2, 5, 6, 7, 8, 11, 12, 15, 18, 19, 20, 23, 26,
+    0, 1, 4, 5, 6, 7, 9, 13, 14, 15, 19, 20, 22, 0, 1, 3,
+    5, 6, 7, 9, 13, 14, 15, 21, 31, 1, 3, 5, 15, 1, 18, 5,
+    19, 1, 7, 18, 21, 3, 4, 8, 9, 14, 18, 19, 20, 4, 7, 14,
+    13, 8, 9, 7, 14, 1, 9, 21, 31, 8, 25, 31, 12, 20, 20, 7,
+    26, 5, 21, 26, 9, 20, 7, 27, 8, 11, 0, 20, 5, 8, 11, 0,
+    3, 5, 7, 19, 23, 26, 3, 5, 26, 18, 0, 1, 2, 4, 5, 6,
+    7, 8, 9, 14, 15, 16, 18, 19, 20, 21, 23, 26, 31, 1, 19, 20,
+    0, 1, 19, 20, 1, 9, 8, 9, 15, 12, 2, 3, 5, 8, 9, 14,
+    18, 19, 21, 20, 9, 21, 31, 2, 16, 26, 9, 42, 1, 3, 15, 16,
+    20, 8, 1, 5, 9, 12, 13, 14, 15, 18, 19, 20, 21, 23, 31, 42,
+    5, 9, 19, 9, 12, 14, 18, 19, 5, 20, 2, 14, 1, 21, 11, 14,
+    1, 5, 9, 12, 9, 0, 1, 4, 5, 7, 9, 11, 15, 26, 1, 2,
+    4, 5, 7, 9, 12, 14, 15, 18, 19, 20, 21, 23, 26, 31, 41, 1,
+    5, 9, 2, 3, 8, 11, 12, 13, 14, 18, 19, 20, 21, 27, 9, 12,
+    13, 14, 18, 20, 5, 12, 18, 4, 13, 14, 2, 18, 16, 20, 31, 1,
+    5, 9, 19, 13, 14, 19, 27, 2, 4, 11, 14, 16, 18, 21, 0, 9,
+    12, 14, 18, 19, 20, 5, 12, 20, 21, 4, 13, 14, 5, 9, 15, 21,
+    31, 2, 3, 13, 14, 16, 18, 19, 5, 9, 15, 31, 42, 5, 16, 20,
+    13, 14, 20, 1, 19, 1, 5, 9, 31, 1, 5, 9, 15, 21, 42, 8,
+    11, 13, 5, 12, 0, 3, 5, 9, 20, 19, 14, 5, 13, 1, 5, 9,
+    15, 18, 19, 21, 19, 8, 21, 13, 14, 18, 19, 12, 1, 5, 18, 19,
+    12, 13, 14, 18, 20, 4, 11, 14, 1, 14, 1, 5, 9, 15, 19, 5,
+    9, 9, 16, 18, 8, 1, 5, 20, 21, 1, 18, 19, 18, 23, 13, 2,
+    4, 11, 12, 14, 16, 18, 20, 21, 0, 6, 9, 14, 18, 19, 4, 14,
+    18, 5, 20, 6, 8, 1, 5, 9, 16, 21, 13, 18, 8, 0, 2, 7,
+    12, 13, 14, 16, 18, 19, 20, 0, 1, 4, 5, 6, 7, 9, 14, 15,
+    18, 19, 21, 22, 26, 42, 2, 4, 9, 13, 14, 18, 19, 1, 20, 1,
+    5, 8, 12, 15, 18, 19, 3, 6, 11, 13, 15, 18, 19, 20, 22, 1,
+    5, 14, 15, 18, 19, 20, 41, 1, 5, 2, 18, 19, 0, 3, 5, 9,
+    11, 16, 20, 25, 26, 1, 5, 9, 18, 19, 21, 25, 3, 15, 5, 31,
+    1, 5, 18, 0, 3, 5, 19, 20, 23, 0, 5, 18, 1, 5, 9, 21,
+    21, 12, 1, 1, 5, 9, 15, 18, 2, 11, 12, 13, 14, 16, 18, 19,
+    20, 21, 1, 8, 1, 9, 6, 9, 12, 14, 16, 18, 20, 21, 12, 18,
+    19, 20, 5, 9, 12, 18, 19, 3, 4, 5, 14, 21, 1, 5, 21, 5,
+    6, 19, 5, 1, 5, 15, 16, 20, 26, 1, 5, 9, 18, 19, 6, 1,
+    5, 9, 15, 20, 23, 31, 12, 13, 14, 2, 6, 7, 13, 14, 18, 19,
+    8, 0, 2, 3, 9, 14, 16, 18, 19, 24, 0, 4, 5, 14, 19, 12,
+    3, 8, 12, 16, 21, 1, 5, 8, 9, 15, 21, 9, 5, 15, 21, 1,
+    5, 8, 9, 18, 21, 13, 19, 8, 6, 12, 13, 14, 16, 18, 19, 21,
+    4, 8, 9, 11, 12, 13, 14, 18, 19, 20, 22, 24, 9, 5, 9, 15,
+    21, 25, 4, 22, 9, 2, 13, 16, 18, 19, 5, 15, 42, 1, 3, 5,
+    11, 31, 5, 12, 19, 2, 13, 14, 18, 5, 9, 23, 8, 18, 12, 5,
+    1, 0, 18, 3, 18, 6, 20, 5, 18, 1, 1, 21, 2, 7, 2, 13,
+    19, 1, 5, 8, 9, 15, 18, 19, 21, 14, 18, 21, 1, 7, 12, 14,
+    20, 1, 5, 9, 15, 1, 5, 21, 1, 3, 5, 9, 20, 41, 6, 1,
+    2, 4, 5, 6, 7, 9, 11, 14, 19, 20, 21, 1, 3, 5, 20, 5,
+    4, 18, 20, 5, 19, 8, 12, 18, 23, 1, 5, 9, 31, 1, 1, 4,
+    7, 20, 1, 5, 9, 15, 16, 21, 5, 5, 5, 12, 1, 5, 21, 1,
+    12, 1, 5, 7, 9, 13, 15, 20, 1, 5, 1, 5, 14, 20, 6, 7,
+    11, 2, 8, 11, 6, 5, 14, 15, 12, 1, 2, 4, 5, 9, 13, 19,
+    20, 26, 1, 4, 6, 7, 14, 26, 5, 14, 20, 1, 3, 8, 19, 21,
+    1, 5, 12, 15, 18, 19, 11, 4, 12, 1, 5, 12, 14, 15, 18, 19,
+    18, 2, 4, 5, 6, 7, 11, 12, 14, 19, 20, 26, 12, 19, 20, 1,
+    4, 7, 9, 11, 1, 2, 4, 5, 6, 7, 9, 11, 19, 20, 41, 5,
+    16, 20, 19, 20, 8, 11, 2, 4, 12, 14, 4, 13, 1, 4, 7, 11,
+    14, 19, 20, 5, 3, 5, 16, 19, 8, 26, 1, 8, 8, 12, 6, 12,
+    1, 4, 9, 14, 20, 21, 42, 8, 19, 4, 7, 19, 0, 6, 19, 20,
+    7, 3, 19, 6, 20, 6, 19, 12, 12, 4, 20, 26, 5, 0, 19, 19,
+    0, 5, 12, 19, 8, 1, 5, 15, 19, 12, 5, 15, 21, 19, 1, 3,
+    5, 15, 16, 19, 20, 21, 21, 5, 12, 18, 14, 19, 12, 4, 9, 12,
+    14, 18, 22, 9, 4, 12, 18, 1, 5, 13, 14, 20, 19, 8, 0, 1,
+    7, 11, 1, 9, 14, 9, 14, 5, 14, 16, 20, 8, 5, 14, 3, 13,
+    14, 20, 21, 0, 13, 19, 20, 14, 9, 14, 18, 8, 9, 21, 4, 20,
+    1, 1, 9, 20, 20, 2, 14, 4, 14, 13, 11, 1, 5, 19, 14, 9,
+    5, 15, 18, 5, 8, 15, 18, 25, 18, 0, 19, 5, 19, 18, 12, 18,
+    12, 14, 11, 9, 0, 1, 2, 5, 6, 7, 11, 18, 19, 20, 6, 0,
+    2, 13, 15, 20, 3, 20, 5, 15, 2, 6, 7, 14, 18, 20, 18, 2,
+    14, 19, 5, 8, 21, 6, 1, 5, 12, 15, 6, 12, 14, 19, 20, 1,
+    4, 5, 9, 12, 13, 15, 19, 21, 31, 2, 16, 0, 1, 5, 7, 14,
+    15, 19, 20, 26, 18, 0, 1, 5, 6, 7, 8, 9, 11, 12, 14, 17,
+    18, 19, 20, 23, 26, 41, 3, 5, 16, 19, 20, 31, 1, 8, 18, 20,
+    7, 12, 18, 21, 18, 14, 18, 18, 8, 5, 12, 14, 18, 19, 5, 12,
+    16, 20, 4, 5, 6, 8, 9, 10, 14, 15, 19, 20, 22, 11, 15, 19,
+    26, 1, 5, 8, 15, 9, 19, 5, 19, 12, 19, 12, 19, 20, 5, 5,
+    14, 26, 21, 15, 14, 21, 8, 9, 12, 14, 18, 19, 5, 9, 15, 18,
+    25, 3, 5, 8, 9, 12, 18, 1, 5, 12, 15, 21, 18, 21, 0, 1,
+    2, 5, 6, 7, 9, 12, 18, 19, 21, 1, 5, 6, 7, 9, 18, 19,
+    20, 6, 12, 1, 11, 12, 14, 19, 20, 3, 18, 21, 26, 3, 7, 8,
+    12, 16, 18, 19, 4, 7, 8, 9, 12, 14, 18, 19, 3, 5, 14, 18,
+    19, 20, 18, 19, 18, 14, 5, 2, 12, 20, 4, 14, 19, 7, 9, 19,
+    27, 12, 19, 3, 1, 5, 16, 1, 5, 9, 15, 19, 20, 2, 5, 19,
+    20, 23, 19, 20, 2, 1, 19, 18, 21, 8, 14, 6, 20, 5, 9, 12,
+    18, 19, 20, 21, 19, 1, 14, 12, 7, 15, 5, 19, 9, 18, 19, 1,
+    20, 9, 18, 14, 1, 5, 1, 5, 12, 5, 9, 0, 3, 11, 12, 5,
+    9, 5, 12, 19, 1, 3, 20, 5, 18, 5, 14, 6, 5, 5, 18, 14,
+    19, 20, 5, 12, 18, 19, 5, 12, 18, 19, 5, 1, 3, 5, 5, 5,
+    12, 18, 3, 20, 6, 12, 5, 9, 12, 13, 14, 18, 19, 19, 5, 14,
+    5, 19, 1, 5, 19, 2, 6, 16, 5, 5, 9, 16, 20, 5, 8, 19,
+    5, 21, 23, 7, 9, 18, 20, 18, 3, 5, 16, 20, 5, 8, 18, 1,
+    5, 9, 12, 14, 15, 2, 1, 3, 9, 12, 15, 16, 20, 31, 5, 18,
+    5, 23, 12, 18, 5, 12, 12, 1, 16, 19, 5, 21, 5, 0, 3, 5,
+    7, 11, 14, 16, 19, 5, 18, 18, 12, 5, 12, 18, 19, 5, 12, 18,
+    5, 14, 20, 12, 12, 14, 14, 5, 5, 9, 0, 3, 9, 13, 14, 5,
+    14, 5, 12, 19, 1, 5, 1, 1, 26, 21, 23, 26, 5, 3, 16, 1,
+    9, 12, 20, 12, 18, 3, 9, 12, 13, 14, 18, 19, 12, 12, 13, 12,
+    5, 5, 5, 11, 5, 14, 8, 9, 19, 20, 3, 20, 1, 5, 8, 18,
+    14, 3, 18, 19, 14, 9, 3, 12, 14, 18, 20, 20, 5, 12, 19, 20,
+    5, 9, 3, 12, 14, 9, 14, 18, 12, 5, 13, 12, 14, 20, 9, 14,
+    18, 24, 1, 5, 19, 31, 15, 5, 19, 5, 15, 20, 16, 18, 6, 18,
+    1, 5, 9, 15, 19, 41, 14, 18, 4, 14, 1, 18, 19, 18, 12, 12,
+    3, 5, 16, 20, 1, 21, 23, 12, 12, 9, 12, 12, 18, 5, 5, 13,
+    18, 3, 5, 9, 16, 5, 8, 1, 9, 23, 41, 8, 5, 12, 14, 18,
+    19, 20, 1, 3, 5, 15, 20, 1, 5, 12, 13, 14, 18, 5, 18, 5,
+    23, 20, 12, 18, 14, 1, 5, 5, 1, 5, 19, 21, 5, 19, 3, 5,
+    18, 18, 12, 19, 19, 1, 9, 12, 5, 1, 1, 21, 3, 1, 5, 18,
+    5, 1, 18, 19, 19, 14, 19, 18, 1, 1, 5, 7, 20, 19, 1, 5,
+    11, 5, 20, 18, 5, 9, 13, 5, 12, 14, 15, 5, 11, 5, 11, 20,
+    12, 14, 15, 1, 5, 6, 18, 19, 9, 5, 4, 5, 5, 16, 19, 20,
+    18, 9, 9, 12, 19, 5, 12, 20, 1, 5, 18, 19, 42, 12, 1, 5,
+    9, 18, 19, 5, 18, 21, 1, 5, 3, 20, 5, 12, 1, 5, 8, 18,
+    1, 14, 19, 5, 7, 20, 3, 5, 5, 5, 12, 2, 4, 21, 1, 5,
+    15, 1, 5, 15, 19, 1, 14, 4, 20, 20, 5, 5, 5, 1, 2, 5,
+    9, 21, 19, 5, 5, 20, 7, 12, 5, 11, 9, 9, 12, 5, 1, 9,
+    14, 6, 4, 6, 5, 15, 5, 18, 1, 9, 26, 8, 5, 9, 3, 19,
+    5, 20, 8, 5, 5, 20, 3, 21, 1, 5, 15, 19, 20, 19, 26, 20,
+    20, 15, 8, 5, 6, 15, 8, 12, 8, 3, 18, 18, 5, 8, 19, 1,
+    5, 18, 21, 5, 20, 1, 5, 1, 20, 5, 8, 5, 1, 13, 19, 12,
+    19, 8, 14, 19, 9, 20, 19, 8, 5, 1, 18, 19, 18, 4, 19, 11,
+    18, 9, 9, 3, 5, 1, 5, 11, 9, 1, 6, 19, 5, 15, 14, 5,
+    5, 19, 18, 14, 5, 9, 18, 8, 5, 11, 1, 20, 8, 15, 21, 5,
+    12, 15, 19, 1, 20, 5, 3, 5, 5, 1, 9, 12, 18, 5, 19, 1,
+    9, 13, 18, 20, 20, 4, 14, 14, 13, 16, 5, 12, 12, 19, 20, 20,
+    11, 20, 20, 20, 6, 14, 12, 7, 12, 11, 19, 8, 12, 18, 6, 9,
+    3, 20, 1, 9, 20, 20, 20, 14, 3, 4, 12, 14, 1, 9, 20, 4,
+    9, 11, 18, 26, 5, 19, 19, 20, 7, 20, 21, 9, 20, 14, 20, 19,
+    9, 19, 12, 18, 19, 21, 3, 9, 16, 18, 13, 0, 2, 18, 3, 5,
+    9, 11, 15, 21, 1, 5, 15, 18, 19, 21, 6, 18, 12, 14, 16, 20,
+    14, 1, 0, 12, 9, 1, 16, 19, 14, 18, 19, 20, 3, 9, 14, 20,
+    21, 9, 1, 4, 21, 9, 12, 18, 1, 5, 20, 18, 12, 14, 5, 0,
+    5, 20, 1, 9, 16, 19, 20, 14, 19, 20, 0, 20, 8, 13, 9, 15,
+    1, 5, 41, 4, 14, 8, 9, 14, 18, 26, 9, 19, 5, 12, 18, 14,
+    14, 19, 1, 5, 9, 18, 21, 12, 24, 18, 9, 16, 8, 20, 1, 20,
+    19, 2, 12, 18, 11, 19, 9, 9, 16, 20, 15, 18, 5, 18, 1, 4,
+    7, 26, 16, 0, 3, 5, 13, 18, 20, 9, 19, 1, 13, 26, 7, 20,
+    18, 8, 21, 18, 18, 19, 14, 18, 5, 3, 14, 1, 0, 3, 4, 7,
+    14, 20, 15, 0, 2, 6, 8, 11, 12, 13, 18, 20, 23, 11, 19, 9,
+    9, 15, 18, 2, 13, 1, 4, 17, 19, 14, 41, 5, 8, 20, 2, 14,
+    16, 18, 21, 0, 3, 5, 14, 18, 19, 4, 5, 2, 16, 6, 16, 19,
+    4, 1, 18, 20, 20, 0, 15, 20, 11, 8, 1, 5, 21, 13, 11, 13,
+    14, 13, 18, 21, 14, 16, 1, 5, 9, 15, 20, 2, 18, 21, 18, 7,
+    19, 1, 6, 9, 21, 8, 7, 12, 14, 18, 9, 4, 5, 14, 18, 0,
+    14, 1, 15, 5, 8, 21, 9, 12, 18, 24, 19, 20, 21, 5, 9, 9,
+    7, 9, 1, 4, 0, 8, 13, 18, 7, 19, 3, 18, 9, 14, 18, 19,
+    24, 1, 15, 16, 21, 18, 0, 6, 7, 19, 9, 6, 8, 11, 14, 26,
+    8, 2, 5, 18, 1, 2, 14, 18, 0, 2, 8, 9, 18, 5, 1, 1,
+    9, 0, 12, 18, 5, 4, 19, 14, 15, 2, 11, 14, 9, 14, 18, 21,
+    41, 15, 16, 18, 1, 15, 31, 5, 16, 4, 7, 8, 18, 6, 14, 16,
+    1, 0, 18, 8, 18, 1, 15, 18, 18, 18, 9, 1, 5, 19, 14, 9,
+    9, 14, 4, 14, 1, 9, 14, 12, 19, 5, 2, 6, 20, 18, 5, 5,
+    9, 15, 7, 26, 16, 20, 11, 20, 21, 6, 9, 11, 14, 18, 5, 11,
+    15, 12, 18, 21, 12, 2, 16, 12, 6, 18, 4, 8, 13, 14, 5, 0,
+    9, 19, 1, 5, 7, 8, 9, 11, 12, 23, 1, 16, 14, 14, 18, 6,
+    9, 19, 20, 21, 12, 18, 21, 12, 1, 5, 15, 41, 18, 1, 5, 8,
+    18, 19, 4, 21, 5, 7, 9, 18, 18, 13, 14, 12, 14, 11, 5, 5,
+    4, 19, 14, 18, 21, 9, 18, 5, 15, 5, 11, 3, 13, 21, 5, 18,
+    20, 6, 7, 5, 9, 13, 20, 21, 5, 9, 0, 1, 15, 11, 18, 7,
+    14, 19, 11, 15, 18, 1, 2, 21, 9, 12, 9, 15, 18, 1, 5, 9,
+    18, 21, 19, 20, 21, 12, 18, 19, 24, 5, 12, 6, 18, 5, 15, 2,
+    19, 5, 18, 20, 6, 3, 20, 0, 5, 7, 9, 7, 1, 19, 1, 14,
+    19, 21, 19, 7, 2, 14, 1, 5, 6, 14, 1, 5, 19, 19, 1, 5,
+    11, 15, 20, 20, 21, 14, 13, 14, 20, 8, 31, 3, 4, 11, 14, 18,
+    21, 0, 3, 9, 12, 18, 31, 31, 12, 18, 14, 2, 14, 21, 14, 21,
+    9, 15, 21, 31, 9, 18, 5, 19, 20, 41, 14, 0, 8, 14, 18, 21,
+    14, 1, 11, 0, 18, 2, 8, 12, 18, 19, 5, 12, 14, 18, 4, 12,
+    18, 14, 9, 15, 5, 8, 14, 21, 8, 0, 8, 14, 18, 14, 19, 18,
+    18, 1, 5, 20, 1, 5, 15, 12, 14, 18, 41, 21, 7, 5, 19, 14,
+    14, 20, 5, 19, 9, 12, 5, 18, 1, 5, 2, 11, 12, 21, 18, 1,
+    5, 5, 9, 1, 5, 18, 12, 1, 5, 12, 14, 18, 21, 1, 2, 4,
+    19, 20, 5, 9, 14, 18, 3, 23, 1, 5, 20, 14, 18, 12, 18, 11,
+    20, 19, 0, 18, 3, 3, 5, 20, 12, 1, 5, 12, 20, 1, 19, 0,
+    9, 18, 5, 1, 5, 4, 8, 3, 5, 20, 19, 7, 19, 3, 11, 14,
+    18, 20, 5, 1, 5, 9, 13, 26, 14, 6, 12, 2, 18, 19, 20, 9,
+    14, 18, 19, 21, 19, 16, 20, 26, 2, 4, 5, 6, 8, 18, 19, 23,
+    14, 13, 14, 19, 2, 3, 9, 14, 18, 19, 0, 1, 1, 14, 19, 18,
+    1, 20, 0, 20, 1, 5, 9, 5, 41, 2, 16, 18, 18, 4, 15, 15,
+    1, 5, 20, 26, 1, 5, 9, 15, 18, 21, 5, 13, 16, 20, 5, 18,
+    19, 5, 19, 21, 0, 19, 5, 14, 21, 5, 9, 21, 11, 3, 1, 14,
+    20, 3, 5, 20, 0, 19, 0, 4, 8, 14, 19, 20, 11, 5, 21, 26,
+    8, 11, 6, 7, 0, 5, 26, 5, 15, 5, 14, 5, 14, 21, 5, 14,
+    1, 5, 9, 14, 19, 1, 18, 9, 7, 5, 18, 8, 14, 20, 20, 0,
+    5, 7, 8, 6, 9, 20, 20, 1, 6, 13, 14, 18, 19, 11, 1, 4,
+    3, 20, 20, 18, 20, 4, 20, 8, 2, 20, 18, 1, 5, 9, 0, 0,
+    20, 6, 7, 9, 11, 19, 2, 11, 14, 19, 18, 3, 14, 16, 2, 4,
+    12, 18, 1, 5, 9, 15, 31, 20, 2, 16, 20, 14, 5, 9, 19, 1,
+    5, 14, 1, 9, 18, 1, 19, 8, 14, 14, 20, 12, 9, 15, 21, 13,
+    9, 11, 12, 3, 6, 7, 12, 26, 0, 1, 4, 20, 3, 9, 15, 20,
+    19, 20, 5, 8, 9, 0, 5, 19, 13, 5, 9, 16, 5, 15, 20, 1,
+    2, 7, 11, 26, 19, 20, 1, 1, 4, 5, 6, 8, 19, 20, 22, 0,
+    21, 15, 9, 18, 6, 19, 1, 3, 9, 4, 20, 13, 14, 15, 1, 21,
+    6, 13, 20, 19, 20, 13, 6, 16, 1, 19, 20, 1, 5, 7, 8, 11,
+    14, 15, 18, 26, 5, 12, 5, 18, 20, 7, 1, 11, 0, 21, 5, 5,
+    1, 5, 9, 11, 14, 1, 9, 42, 1, 15, 19, 14, 15, 18, 5, 1,
+    31, 6, 14, 20, 5, 1, 25, 9, 12, 15, 18, 1, 0, 9, 42, 18,
+    1, 5, 14, 1, 9, 21, 8, 18, 14, 13, 20, 1, 18, 20, 15, 0,
+    1, 12, 20, 0, 5, 5, 2, 4, 19, 23, 5, 13, 16, 3, 4, 11,
+    21, 3, 9, 11, 13, 14, 18, 0, 13, 11, 1, 5, 31, 2, 5, 15,
+    16, 14, 18, 14, 14, 20, 13, 4, 14, 18, 19, 5, 12, 15, 19, 1,
+    3, 5, 20, 4, 6, 7, 8, 14, 23, 26, 5, 3, 2, 6, 14, 16,
+    19, 12, 19, 2, 2, 3, 9, 14, 18, 21, 12, 42, 14, 12, 16, 20,
+    5, 18, 8, 13, 0, 22, 8, 13, 2, 8, 9, 12, 13, 14, 20, 14,
+    18, 5, 20, 1, 5, 15, 18, 21, 14, 14, 14, 9, 12, 4, 12, 18,
+    19, 20, 5, 8, 1, 5, 8, 12, 20, 2, 5, 9, 19, 26, 19, 3,
+    8, 19, 20, 9, 19, 1, 11, 0, 14, 14, 19, 5, 1, 5, 18, 3,
+    18, 5, 14, 2, 1, 12, 18, 14, 14, 14, 21, 5, 1, 9, 12, 15,
+    18, 21, 31, 5, 18, 1, 5, 9, 18, 21, 5, 19, 20, 13, 16, 4,
+    11, 20, 2, 3, 6, 13, 16, 0, 19, 11, 1, 3, 5, 22, 9, 0,
+    3, 5, 19, 7, 6, 20, 0, 4, 3, 9, 19, 21, 18, 21, 12, 5,
+    19, 20, 3, 11, 11, 20, 5, 19, 20, 5, 9, 18, 5, 7, 14, 2,
+    5, 7, 20, 6, 8, 11, 18, 19, 20, 26, 1, 11, 12, 18, 6, 12,
+    12, 9, 18, 19, 20, 3, 18, 18, 9, 15, 7, 19, 21, 3, 9, 12,
+    13, 14, 18, 12, 16, 3, 12, 5, 9, 15, 18, 20, 19, 14, 5, 8,
+    9, 14, 22, 9, 5, 15, 18, 18, 0, 1, 5, 12, 5, 12, 9, 20,
+    21, 8, 1, 8, 20, 18, 9, 1, 15, 9, 13, 14, 18, 24, 14, 9,
+    18, 18, 0, 9, 14, 18, 19, 14, 18, 5, 15, 18, 5, 15, 5, 1,
+    20, 5, 19, 0, 18, 21, 5, 1, 8, 14, 1, 1, 5, 8, 9, 18,
+    31, 20, 13, 9, 14, 18, 0, 2, 9, 5, 20, 5, 14, 18, 20, 25,
+    12, 5, 19, 1, 20, 20, 14, 5, 9, 12, 8, 19, 18, 15, 19, 7,
+    19, 19, 11, 14, 7, 18, 19, 20, 9, 14, 19, 20, 14, 19, 20, 18,
+    1, 3, 5, 9, 5, 20, 6, 9, 11, 19, 9, 12, 13, 14, 9, 26,
+    1, 5, 15, 1, 5, 1, 20, 14, 7, 12, 14, 21, 9, 12, 14, 5,
+    15, 7, 8, 20, 4, 13, 26, 20, 6, 14, 6, 20, 19, 20, 1, 6,
+    12, 20, 13, 21, 9, 14, 18, 18, 5, 20, 2, 14, 25, 3, 9, 12,
+    18, 19, 14, 2, 3, 6, 5, 6, 9, 5, 18, 9, 21, 20, 15, 9,
+    18, 7, 19, 15, 18, 2, 8, 14, 18, 19, 23, 15, 1, 5, 21, 41,
+    42, 13, 11, 13, 18, 1, 31, 13, 14, 18, 9, 14, 20, 2, 2, 7,
+    12, 18, 12, 1, 18, 3, 4, 14, 19, 20, 5, 2, 12, 14, 18, 21,
+    9, 15, 5, 18, 31, 5, 20, 1, 31, 5, 9, 1, 3, 20, 5, 15,
+    41, 19, 8, 18, 15, 25, 5, 5, 15, 13, 18, 15, 2, 12, 14, 16,
+    18, 20, 18, 19, 14, 18, 1, 15, 1, 13, 18, 14, 18, 14, 4, 14,
+    20, 12, 18, 2, 1, 18, 20, 21, 11, 5, 9, 16, 1, 4, 5, 13,
+    19, 20, 23, 26, 5, 9, 18, 9, 16, 21, 6, 18, 19, 9, 18, 8,
+    5, 5, 14, 0, 1, 9, 16, 0, 5, 11, 19, 20, 0, 1, 4, 5,
+    6, 7, 8, 11, 12, 14, 18, 21, 23, 41, 19, 1, 9, 20, 15, 0,
+    18, 5, 18, 6, 1, 15, 1, 3, 18, 0, 9, 12, 14, 18, 19, 13,
+    16, 18, 16, 18, 9, 5, 11, 5, 9, 9, 8, 5, 13, 14, 13, 14,
+    18, 19, 5, 5, 15, 3, 18, 14, 1, 11, 6, 15, 19, 16, 16, 19,
+    25, 1, 5, 7, 20, 12, 23, 21, 9, 9, 1, 4, 20, 3, 19, 18,
+    21, 9, 12, 19, 8, 13, 18, 11, 9, 2, 5, 7, 9, 11, 13, 15,
+    16, 4, 5, 20, 26, 5, 11, 15, 3, 20, 9, 12, 19, 20, 21, 6,
+    7, 18, 20, 0, 3, 12, 14, 12, 19, 24, 18, 15, 1, 12, 16, 26,
+    13, 5, 6, 4, 5, 7, 14, 19, 12, 5, 9, 19, 20, 0, 1, 4,
+    5, 6, 7, 8, 11, 12, 13, 14, 15, 18, 19, 20, 21, 23, 3, 19,
+    1, 8, 12, 4, 7, 12, 18, 1, 5, 18, 15, 12, 1, 9, 15, 21,
+    18, 6, 12, 18, 7, 22, 20, 5, 18, 1, 1, 9, 13, 20, 2, 3,
+    14, 8, 2, 13, 14, 18, 4, 15, 1, 5, 8, 15, 31, 42, 13, 7,
+    14, 18, 12, 14, 18, 15, 41, 1, 5, 9, 21, 42, 4, 1, 19, 15,
+    3, 15, 20, 5, 9, 15, 16, 18, 1, 12, 16, 20, 14, 5, 19, 5,
+    20, 20, 0, 9, 12, 12, 14, 21, 8, 0, 9, 10, 13, 18, 1, 3,
+    5, 4, 5, 11, 12, 0, 1, 4, 7, 8, 15, 6, 18, 5, 9, 18,
+    0, 3, 20, 9, 12, 20, 2, 3, 5, 6, 7, 18, 21, 16, 12, 15,
+    13, 3, 12, 14, 18, 19, 21, 2, 20, 5, 8, 11, 9, 6, 0, 2,
+    7, 8, 13, 14, 19, 5, 9, 1, 2, 16, 21, 0, 1, 5, 19, 20,
+    26, 5, 0, 2, 6, 8, 11, 12, 14, 15, 18, 19, 20, 22, 23, 19,
+    1, 8, 9, 12, 9, 18, 18, 18, 2, 8, 12, 14, 5, 16, 5, 15,
+    16, 20, 2, 9, 12, 13, 19, 2, 9, 18, 20, 15, 5, 14, 12, 0,
+    2, 4, 9, 11, 12, 20, 18, 18, 10, 18, 31, 5, 7, 21, 2, 8,
+    7, 14, 18, 12, 14, 18, 21, 19, 12, 18, 25, 2, 11, 1, 9, 14,
+    18, 14, 8, 8, 12, 14, 5, 9, 15, 18, 9, 2, 4, 20, 9, 18,
+    15, 21, 5, 16, 19, 18, 4, 7, 5, 3, 18, 26, 5, 8, 12, 16,
+    11, 13, 18, 26, 6, 1, 7, 20, 15, 19, 5, 5, 9, 18, 14, 1,
+    5, 15, 19, 1, 21, 11, 18, 18, 20, 20, 5, 20, 12, 14, 18, 11,
+    12, 18, 18, 1, 7, 12, 21, 25, 18, 6, 1, 21, 1, 18, 21, 2,
+    7, 11, 14, 16, 18, 19, 20, 21, 3, 9, 12, 14, 18, 19, 4, 7,
+    12, 16, 15, 9, 2, 13, 18, 1, 5, 13, 18, 19, 20, 14, 12, 9,
+    0, 20, 18, 14, 5, 4, 8, 20, 12, 11, 20, 6, 8, 9, 1, 8,
+    1, 19, 7, 21, 3, 19, 19, 8, 5, 5, 13, 2, 4, 11, 13, 14,
+    19, 21, 9, 14, 13, 13, 18, 20, 19, 5, 5, 9, 11, 18, 3, 18,
+    14, 18, 14, 5, 9, 16, 14, 5, 16, 9, 15, 19, 1, 12, 14, 19,
+    14, 18, 18, 19, 1, 15, 18, 1, 3, 9, 12, 19, 20, 14, 14, 20,
+    5, 7, 14, 5, 9, 15, 19, 12, 18, 5, 20, 9, 15, 12, 5, 3,
+    18, 18, 1, 18, 1, 5, 9, 12, 15, 18, 21, 1, 8, 19, 18, 2,
+    20, 14, 21, 5, 14, 5, 4, 7, 19, 23, 21, 1, 5, 18, 11, 13,
+    18, 19, 15, 20, 5, 21, 18, 1, 3, 20, 6, 9, 12, 15, 23, 26,
+    2, 12, 14, 21, 0, 1, 5, 2, 3, 9, 12, 18, 1, 18, 5, 5,
+    0, 5, 1, 6, 12, 1, 5, 9, 0, 18, 5, 1, 5, 15, 18, 7,
+    1, 9, 18, 19, 14, 9, 12, 19, 7, 11, 13, 1, 9, 42, 19, 6,
+    19, 12, 14, 14, 19, 14, 16, 1, 5, 31, 5, 19, 3, 20, 5, 8,
+    14, 18, 12, 4, 19, 3, 19, 13, 14, 20, 5, 7, 19, 5, 19, 15,
+    8, 18, 14, 21, 18, 18, 14, 16, 14, 1, 5, 9, 3, 20, 5, 8,
+    18, 19, 21, 8, 4, 0, 3, 0, 3, 5, 6, 7, 11, 13, 14, 20,
+    8, 3, 20, 1, 5, 20, 1, 5, 18, 18, 5, 20, 1, 14, 19, 18,
+    5, 15, 12, 11, 19, 20, 12, 18, 16, 12, 5, 42, 20, 20, 20, 19,
+    5, 12, 1, 20, 11, 9, 5, 7, 14, 19, 9, 9, 20, 6, 11, 12,
+    26, 9, 9, 6, 19, 14, 19, 3, 8, 13, 8, 8, 14, 1, 5, 9,
+    18, 31, 11, 12, 4, 5, 12, 12, 15, 18, 21, 8, 0, 1, 16, 20,
+    18, 20, 1, 9, 21, 5, 5, 18, 19, 9, 3, 18, 18, 5, 6, 18,
+    21, 15, 1, 4, 3, 12, 1, 1, 5, 18, 19, 21, 21, 0, 9, 20,
+    9, 12, 8, 0, 9, 12, 13, 14, 5, 5, 18, 5, 5, 19, 20, 5,
+    9, 20, 20, 14, 9, 9, 14, 18, 19, 22, 5, 8, 19, 20, 18, 19,
+    5, 3, 11, 13, 14, 18, 22, 13, 1, 9, 1, 16, 20, 26, 1, 18,
+    0, 3, 11, 12, 13, 18, 20, 21, 1, 13, 18, 9, 18, 19, 4, 13,
+    1, 11, 26, 6, 8, 18, 23, 31, 21, 9, 2, 12, 14, 18, 7, 14,
+    18, 14, 12, 1, 5, 15, 20, 2, 16, 1, 5, 31, 21, 8, 2, 12,
+    18, 1, 9, 20, 1, 5, 8, 21, 14, 16, 9, 5, 5, 20, 1, 5,
+    15, 5, 20, 18, 19, 12, 0, 19, 20, 1, 12, 21, 4, 26, 3, 20,
+    2, 6, 3, 14, 20, 11, 5, 0, 5, 2, 5, 5, 8, 6, 8, 5,
+    12, 20, 18, 20, 5, 0, 9, 5, 18, 19, 5, 1, 9, 12, 12, 13,
+    4, 5, 1, 8, 16, 20, 2, 6, 13, 19, 5, 5, 3, 6, 8, 14,
+    20, 14, 15, 26, 19, 13, 19, 12, 7, 14, 1, 5, 12, 18, 5, 19,
+    20, 0, 20, 7, 3, 11, 2, 12, 13, 20, 1, 2, 16, 20, 7, 18,
+    5, 12, 19, 12, 0, 1, 14, 20, 5, 9, 12, 1, 5, 7, 3, 14,
+    19, 11, 5, 18, 21, 20, 3, 14, 18, 20, 8, 9, 12, 18, 21, 25,
+    6, 12, 13, 18, 3, 4, 18, 1, 5, 9, 15, 14, 18, 19, 5, 0,
+    20, 19, 9, 0, 5, 12, 8, 18, 19, 8, 5, 15, 16, 20, 1, 5,
+    18, 18, 1, 16, 7, 8, 5, 15, 19, 12, 14, 5, 18, 12, 31, 15,
+    18, 19, 14, 18, 21, 1, 5, 9, 18, 21, 5, 5, 11, 16, 20, 1,
+    5, 18, 12, 14, 5, 1, 18, 19, 13, 5, 18, 3, 2, 18, 0, 1,
+    5, 5, 13, 5, 8, 9, 18, 1, 1, 5, 20, 18, 18, 9, 2, 12,
+    13, 19, 20, 1, 3, 5, 16, 19, 21, 1, 15, 18, 0, 1, 5, 9,
+    5, 9, 15, 19, 5, 20, 5, 14, 21, 9, 13, 18, 4, 14, 1, 5,
+    12, 1, 5, 16, 21, 5, 20, 13, 20, 19, 1, 14, 21, 3, 11, 13,
+    14, 1, 5, 6, 18, 1, 19, 19, 20, 2, 14, 18, 20, 1, 1, 1,
+    20, 1, 5, 18, 19, 23, 26, 2, 4, 16, 18, 20, 2, 3, 9, 12,
+    14, 18, 15, 5, 6, 14, 5, 12, 18, 1, 2, 6, 16, 20, 8, 18,
+    13, 1, 5, 23, 18, 18, 31, 16, 18, 3, 12, 12, 9, 7, 20, 19,
+    9, 19, 18, 14, 18, 20, 5, 11, 13, 16, 19, 5, 12, 14, 1, 1,
+    9, 5, 3, 14, 12, 5, 16, 18, 4, 19, 26, 20, 14, 19, 0, 1,
+    5, 14, 20, 26, 1, 5, 7, 11, 14, 21, 23, 26, 9, 20, 4, 4,
+    5, 13, 0, 9, 19, 18, 18, 1, 15, 5, 9, 18, 16, 8, 20, 3,
+    18, 14, 4, 5, 19, 1, 20, 4, 9, 26, 18, 20, 0, 7, 14, 7,
+    6, 4, 5, 15, 19, 5, 6, 15, 3, 6, 18, 1, 5, 1, 5, 20,
+    21, 1, 18, 25, 9, 16, 13, 5, 0, 3, 4, 18, 11, 14, 18, 21,
+    14, 20, 16, 1, 5, 21, 9, 1, 18, 14, 5, 19, 8, 0, 2, 3,
+    6, 7, 14, 20, 9, 7, 11, 12, 13, 19, 20, 23, 26, 19, 20, 1,
+    11, 19, 20, 20, 20, 1, 5, 9, 15, 1, 3, 14, 8, 14, 18, 20,
+    14, 6, 1, 2, 14, 12, 16, 9, 1, 5, 9, 16, 19, 8, 11, 12,
+    20, 8, 4, 18, 20, 1, 18, 5, 14, 5, 9, 9, 4, 6, 7, 8,
+    11, 12, 14, 23, 26, 41, 8, 20, 11, 7, 14, 1, 12, 14, 5, 7,
+    3, 14, 18, 20, 3, 9, 18, 5, 9, 15, 31, 2, 6, 12, 14, 21,
+    3, 9, 12, 18, 5, 20, 12, 18, 1, 5, 9, 15, 13, 14, 21, 7,
+    7, 20, 12, 15, 20, 5, 11, 26, 18, 9, 25, 0, 5, 5, 8, 6,
+    5, 6, 7, 12, 13, 14, 19, 5, 1, 5, 6, 9, 9, 16, 7, 20,
+    4, 5, 6, 7, 8, 12, 14, 19, 23, 26, 5, 19, 8, 20, 9, 18,
+    19, 21, 5, 18, 25, 5, 4, 11, 14, 19, 20, 21, 3, 6, 9, 11,
+    19, 3, 5, 14, 12, 19, 13, 8, 12, 14, 18, 9, 12, 14, 18, 1,
+    1, 9, 18, 21, 31, 42, 19, 9, 12, 14, 2, 9, 13, 14, 18, 20,
+    4, 14, 5, 5, 19, 8, 1, 5, 15, 16, 20, 2, 5, 21, 12, 2,
+    8, 14, 18, 18, 0, 8, 3, 16, 18, 5, 5, 9, 18, 19, 2, 6,
+    9, 11, 12, 14, 18, 20, 24, 1, 13, 14, 1, 5, 9, 14, 18, 5,
+    12, 21, 2, 18, 16, 5, 20, 6, 19, 20, 9, 7, 19, 7, 15, 4,
+    21, 21, 14, 3, 3, 18, 5, 11, 20, 18, 9, 18, 5, 9, 15, 18,
+    5, 9, 16, 20, 1, 18, 19, 31, 21, 15, 19, 14, 0, 9, 18, 41,
+    15, 16, 20, 5, 9, 42, 20, 15, 20, 14, 14, 21, 9, 13, 14, 15,
+    8, 9, 1, 5, 3, 5, 20, 14, 4, 2, 3, 9, 11, 14, 18, 19,
+    4, 2, 18, 26, 1, 7, 13, 19, 2, 3, 11, 18, 24, 5, 13, 14,
+    1, 5, 0, 1, 3, 5, 9, 11, 16, 20, 26, 1, 8, 25, 13, 4,
+    16, 21, 3, 9, 18, 20, 9, 0, 9, 5, 5, 20, 5, 19, 14, 14,
+    1, 21, 5, 20, 5, 18, 7, 14, 16, 20, 21, 14, 18, 1, 5, 15,
+    25, 2, 9, 21, 5, 23, 19, 13, 14, 7, 8, 18, 15, 20, 3, 19,
+    22, 1, 4, 6, 9, 12, 16, 18, 19, 16, 1, 9, 15, 16, 20, 26,
+    18, 2, 20, 20, 18, 1, 14, 1, 5, 9, 1, 23, 26, 19, 7, 13,
+    21, 4, 14, 21, 7, 12, 8, 1, 5, 9, 15, 18, 42, 7, 20, 0,
+    5, 5, 20, 20, 7, 20, 20, 20, 5, 19, 1, 5, 6, 8, 12, 15,
+    21, 1, 19, 18, 20, 13, 14, 6, 9, 19, 19, 5, 18, 19, 5, 18,
+    19, 1, 13, 19, 26, 2, 16, 2, 6, 5, 2, 14, 18, 19, 18, 14,
+    2, 20, 4, 5, 6, 7, 8, 11, 18, 26, 8, 19, 5, 14, 1, 4,
+    9, 19, 0, 19, 14, 14, 18, 11, 16, 21, 9, 14, 18, 9, 15, 7,
+    18, 21, 18, 1, 8, 19, 3, 5, 13, 20, 19, 21, 19, 20, 14, 5,
+    6, 6, 12, 26, 8, 9, 4, 6, 19, 9, 14, 1, 15, 5, 8, 11,
+    5, 4, 5, 16, 1, 14, 2, 13, 19, 20, 3, 12, 14, 0, 9, 14,
+    18, 19, 24, 11, 9, 5, 19, 5, 6, 5, 7, 26, 31, 0, 2, 8,
+    12, 20, 11, 14, 26, 6, 7, 12, 13, 18, 20, 14, 18, 1, 31, 18,
+    1, 16, 2, 18, 21, 18, 5, 26, 18, 19, 14, 18, 12, 14, 18, 18,
+    1, 19, 20, 13, 8, 0, 2, 4, 14, 1, 5, 9, 15, 18, 31, 6,
+    13, 18, 0, 7, 9, 9, 31, 26, 18, 12, 31, 14, 21, 5, 18, 14,
+    1, 14, 12, 14, 14, 9, 1, 42, 15, 1, 14, 14, 7, 11, 21, 9,
+    14, 8, 13, 14, 20, 1, 12, 8, 20, 16, 20, 5, 6, 7, 1, 5,
+    9, 12, 13, 14, 18, 23, 42, 1, 9, 14, 9, 20, 1, 4, 19, 5,
+    7, 8, 13, 19, 1, 7, 13, 5, 7, 20, 18, 3, 18, 15, 3, 21,
+    8, 18, 15, 1, 18, 21, 13, 2, 3, 14, 20, 12, 14, 19, 21, 4,
+    12, 3, 1, 5, 15, 21, 21, 18, 16, 0, 19, 1, 20, 5, 18, 15,
+    16, 5, 20, 3, 20, 6, 3, 1, 5, 16, 19, 20, 15, 5, 19, 41,
+    11, 20, 5, 15, 16, 1, 14, 5, 6, 19, 21, 6, 20, 2, 13, 14,
+    21, 7, 8, 18, 2, 31, 2, 16, 9, 15, 3, 5, 15, 16, 20, 19,
+    7, 19, 1, 7, 3, 18, 4, 5, 20, 5, 20, 5, 6, 8, 11, 12,
+    19, 19, 19, 3, 20, 5, 5, 12, 1, 19, 13, 5, 19, 20, 19, 1,
+    5, 9, 15, 18, 14, 18, 14, 19, 12, 14, 18, 14, 0, 0, 2, 14,
+    2, 8, 14, 18, 1, 12, 9, 20, 16, 19, 5, 8, 12, 19, 21, 1,
+    31, 13, 13, 18, 0, 1, 5, 8, 21, 42, 5, 1, 1, 5, 6, 1,
+    5, 9, 0, 5, 18, 14, 7, 5, 15, 19, 0, 19, 23, 15, 14, 0,
+    14, 19, 9, 4, 5, 5, 3, 7, 13, 21, 9, 11, 14, 18, 5, 9,
+    11, 21, 18, 2, 14, 18, 1, 5, 13, 14, 1, 31, 1, 5, 5, 9,
+    11, 20, 26, 5, 6, 7, 8, 12, 19, 23, 26, 14, 21, 12, 2, 9,
+    1, 15, 5, 21, 14, 5, 15, 1, 5, 1, 5, 2, 4, 19, 5, 0,
+    1, 0, 5, 9, 12, 1, 7, 2, 12, 1, 3, 5, 15, 14, 19, 5,
+    9, 21, 19, 11, 19, 5, 20, 15, 4, 20, 6, 7, 18, 20, 0, 1,
+    19, 14, 0, 1, 11, 3, 20, 19, 5, 20, 7, 20, 1, 8, 26, 12,
+    13, 12, 5, 21, 13, 5, 1, 5, 5, 1, 12, 18, 5, 12, 1, 15,
+    31, 9, 42, 18, 1, 19, 13, 11, 12, 0, 5, 14, 21, 3, 5, 6,
+    8, 13, 19, 9, 21, 19, 9, 8, 8, 13, 20, 9, 4, 6, 14, 4,
+    7, 20, 5, 6, 7, 11, 12, 19, 23, 12, 20, 12, 18, 12, 12, 14,
+    20, 12, 16, 5, 20, 12, 18, 15, 3, 13, 18, 12, 20, 14, 18, 19,
+    20, 4, 5, 9, 7, 14, 1, 19, 20, 26, 1, 5, 6, 7, 8, 21,
+    41, 1, 5, 7, 9, 14, 19, 14, 5, 5, 14, 19, 21, 6, 19, 14,
+    12, 14, 18, 1, 9, 19, 19, 5, 15, 18, 1, 5, 20, 12, 9, 5,
+    3, 16, 20, 18, 8, 18, 14, 12, 20, 0, 1, 19, 0, 5, 19, 14,
+    9, 18, 15, 2, 14, 15, 0, 18, 20, 1, 6, 18, 19, 14, 4, 14,
+    20, 21, 1, 5, 9, 18, 13, 18, 5, 19, 1, 5, 6, 9, 23, 23,
+    12, 14, 2, 9, 12, 14, 14, 0, 13, 8, 9, 13, 2, 9, 12, 14,
+    19, 5, 20, 1, 5, 18, 21, 11, 12, 1, 9, 20, 1, 5, 8, 9,
+    18, 5, 0, 5, 18, 19, 9, 15, 18, 12, 0, 0, 2, 3, 4, 6,
+    7, 12, 18, 19, 23, 26, 15, 18, 14, 20, 9, 3, 14, 19, 1, 5,
+    9, 1, 19, 20, 4, 1, 1, 1, 5, 21, 9, 13, 9, 14, 5, 9,
+    15, 2, 11, 5, 9, 13, 19, 15, 19, 5, 14, 19, 6, 9, 19, 1,
+    5, 20, 0, 6, 7, 8, 12, 14, 16, 20, 1, 19, 20, 9, 9, 13,
+    14, 3, 5, 19, 3, 14, 19, 14, 5, 1, 9, 20, 2, 19, 9, 0,
+    5, 12, 1, 5, 19, 16, 0, 4, 5, 6, 9, 11, 19, 20, 21, 3,
+    5, 6, 19, 20, 1, 15, 19, 5, 18, 9, 11, 13, 14, 19, 0, 21,
+    9, 19, 20, 18, 14, 4, 14, 20, 25, 5, 16, 21, 4, 18, 21, 1,
+    1, 12, 9, 5, 11, 26, 6, 11, 12, 14, 18, 23, 26, 25, 7, 16,
+    19, 21, 2, 3, 9, 12, 14, 18, 1, 15, 18, 42, 1, 5, 9, 12,
+    18, 15, 14, 1, 5, 12, 15, 18, 5, 31, 1, 5, 1, 9, 0, 1,
+    20, 16, 1, 5, 15, 5, 15, 31, 13, 9, 12, 9, 15, 15, 1, 5,
+    9, 15, 18, 16, 20, 9, 3, 5, 15, 18, 19, 20, 15, 12, 11, 19,
+    14, 19, 5, 12, 4, 13, 19, 5, 9, 1, 19, 31, 9, 7, 0, 7,
+    20, 20, 1, 5, 1, 5, 11, 12, 1, 5, 19, 5, 19, 3, 18, 1,
+    5, 18, 16, 16, 5, 15, 19, 20, 18, 21, 6, 8, 16, 19, 5, 20,
+    1, 19, 12, 0, 1, 5, 16, 20, 21, 26, 8, 9, 12, 20, 12, 5,
+    26, 14, 18, 5, 1, 19, 5, 21, 9, 5, 16, 0, 4, 5, 4, 19,
+    3, 14, 18, 2, 5, 11, 18, 20, 21, 5, 12, 1, 5, 2, 5, 19,
+    23, 26, 13, 13, 20, 6, 19, 5, 8, 18, 3, 13, 19, 1, 0, 1,
+    4, 20, 0, 1, 5, 6, 7, 13, 14, 20, 5, 1, 2, 4, 6, 19,
+    5, 6, 2, 9, 19, 1, 18, 21, 13, 20, 5, 1, 1, 6, 20, 20,
+    9, 6, 12, 26, 19, 4, 19, 3, 5, 20, 20, 5, 19, 19, 9, 5,
+    18, 5, 14, 14, 1, 13, 14, 14, 5, 5, 18, 5, 15, 18, 1, 15,
+    18, 19, 19, 2, 16, 20, 5, 5, 7, 11, 13, 18, 9, 13, 19, 12,
+    5, 9, 6, 7, 8, 11, 12, 19, 23, 1, 20, 16, 12, 12, 20, 3,
+    18, 20, 9, 12, 2, 6, 8, 19, 20, 1, 3, 8, 9, 12, 13, 14,
+    18, 5, 16, 20, 3, 12, 9, 21, 42, 20, 13, 4, 11, 7, 19, 19,
+    7, 5, 16, 0, 4, 1, 20, 15, 20, 21, 21, 7, 14, 19, 20, 9,
+    7, 19, 20, 1, 6, 7, 11, 14, 19, 41, 11, 20, 19, 9, 13, 15,
+    5, 4, 7, 9, 12, 3, 9, 19, 12, 21, 8, 12, 18, 5, 8, 9,
+    1, 9, 1, 5, 18, 2, 9, 14, 16, 0, 9, 5, 8, 19, 14, 9,
+    1, 3, 5, 15, 16, 20, 5, 15, 18, 19, 21, 7, 12, 18, 6, 16,
+    18, 3, 14, 19, 5, 20, 8, 9, 5, 12, 3, 1, 5, 5, 12, 18,
+    9, 1, 9, 1, 5, 20, 19, 3, 13, 12, 0, 2, 6, 7, 11, 16,
+    19, 20, 22, 23, 5, 19, 5, 0, 7, 11, 14, 20, 21, 5, 9, 24,
+    5, 15, 20, 20, 4, 12, 18, 20, 21, 5, 18, 20, 18, 5, 12, 18,
+    16, 5, 1, 31, 8, 23, 1, 7, 14, 18, 4, 3, 16, 21, 9, 5,
+    20, 1, 5, 9, 15, 18, 2, 14, 12, 18, 5, 15, 18, 5, 16, 18,
+    18, 4, 1, 1, 5, 20, 9, 3, 15, 12, 19, 14, 5, 5, 12, 5,
+    5, 4, 5, 21, 20, 14, 21, 5, 11, 13, 18, 20, 0, 5, 2, 5,
+    5, 19, 7, 14, 18, 19, 21, 12, 14, 1, 5, 13, 14, 5, 15, 20,
+    1, 5, 14, 19, 11, 19, 21, 2, 14, 18, 31, 4, 14, 12, 19, 8,
+    13, 20, 18, 5, 12, 18, 15, 18, 1, 5, 15, 16, 20, 15, 5, 19,
+    9, 5, 5, 0, 18, 5, 15, 19, 5, 15, 9, 15, 18, 14, 18, 12,
+    14, 8, 19, 3, 14, 5, 21, 6, 18, 21, 15, 1, 19, 11, 6, 5,
+    9, 21, 8, 1, 5, 5, 15, 18, 1, 5, 19, 26, 20, 20, 14, 9,
+    1, 5, 20, 1, 5, 3, 20, 26, 19, 12, 2, 8, 19, 20, 3, 20,
+    23, 1, 9, 12, 9, 19, 12, 1, 5, 15, 18, 1, 5, 21, 1, 8,
+    18, 11, 14, 18, 1, 18, 5, 5, 9, 5, 9, 5, 6, 18, 6, 19,
+    9, 13, 14, 19, 19, 20, 18, 5, 14, 5, 5, 20, 8, 9, 4, 20,
+    15, 8, 9, 12, 20, 31, 19, 18, 7, 14, 19, 20, 7, 20, 2, 5,
+    6, 7, 9, 11, 12, 19, 20, 1, 1, 14, 15, 14, 1, 5, 21, 31,
+    5, 5, 1, 16, 5, 18, 5, 14, 22, 6, 0, 5, 21, 20, 12, 19,
+    20, 12, 5, 3, 18, 1, 5, 5, 14, 18, 42, 5, 19, 20, 23, 2,
+    12, 18, 1, 13, 14, 5, 15, 13, 18, 11, 1, 2, 9, 14, 18, 19,
+    20, 24, 12, 4, 1, 8, 0, 18, 25, 20, 0, 9, 14, 18, 4, 16,
+    19, 20, 21, 1, 18, 0, 5, 18, 5, 19, 9, 5, 13, 8, 1, 8,
+    8, 3, 9, 1, 18, 12, 13, 21, 9, 13, 13, 1, 6, 18, 2, 4,
+    6, 7, 12, 15, 18, 19, 23, 26, 5, 14, 5, 0, 20, 1, 9, 12,
+    14, 26, 18, 20, 20, 12, 5, 0, 6, 12, 19, 15, 19, 20, 0, 5,
+    8, 9, 12, 15, 19, 5, 19, 8, 13, 1, 20, 9, 20, 20, 13, 20,
+    21, 6, 3, 4, 9, 14, 14, 18, 19, 18, 1, 20, 14, 19, 0, 13,
+    14, 18, 5, 18, 20, 21, 7, 8, 12, 26, 19, 11, 13, 14, 13, 20,
+    1, 5, 3, 1, 2, 4, 6, 7, 8, 11, 12, 16, 20, 23, 2, 9,
+    13, 14, 21, 2, 5, 19, 20, 21, 1, 5, 11, 16, 1, 2, 4, 6,
+    9, 12, 14, 18, 19, 23, 26, 5, 14, 19, 2, 3, 6, 7, 12, 13,
+    14, 16, 20, 21, 1, 5, 2, 2, 3, 9, 1, 18, 42, 18, 41, 1,
+    41, 9, 41, 9, 0, 5, 20, 31, 19, 0, 1, 20, 0, 16, 1, 1,
+    6, 19, 12, 14, 9, 22, 1, 6, 18, 1, 9, 1, 5, 9, 18, 14,
+    2, 7, 11, 14, 16, 20, 12, 1, 5, 14, 1, 5, 18, 5, 9, 18,
+    12, 20, 7, 5, 14, 20, 5, 19, 4, 19, 20, 19, 14, 2, 5, 5,
+    19, 1, 7, 19, 26, 1, 16, 4, 3, 11, 20, 19, 13, 6, 9, 14,
+    20, 3, 21, 18, 8, 11, 14, 7, 9, 20, 0, 5, 1, 5, 9, 5,
+    14, 1, 19, 12, 20, 9, 5, 1, 16, 18, 12, 18, 14, 18, 3, 12,
+    19, 18, 0, 1, 14, 13, 14, 8, 0, 13, 20, 9, 1, 5, 18, 19,
+    18, 5, 7, 7, 6, 20, 3, 13, 19, 20, 0, 5, 1, 20, 12, 15,
+    19, 9, 21, 8, 19, 4, 7, 9, 14, 19, 14, 3, 2, 19, 20, 5,
+    20, 4, 9, 20, 2, 0, 12, 14, 16, 26, 12, 20, 12, 14, 9, 11,
+    14, 21, 14, 18, 19, 20, 14, 20, 16, 9, 15, 21, 5, 19, 8, 5,
+    1, 19, 5, 1, 7, 12, 20, 0, 14, 2, 5, 21, 19, 5, 6, 7,
+    8, 11, 12, 15, 23, 26, 41, 5, 15, 20, 5, 9, 13, 15, 41, 6,
+    12, 12, 1, 5, 15, 41, 5, 18, 0, 21, 7, 22, 18, 4, 11, 12,
+    18, 1, 2, 5, 18, 1, 9, 18, 22, 14, 18, 9, 14, 18, 24, 15,
+    14, 16, 5, 5, 9, 26, 19, 11, 15, 9, 12, 16, 20, 1, 13, 7,
+    11, 8, 18, 19, 20, 5, 12, 20, 21, 23, 1, 5, 14, 5, 0, 5,
+    19, 15, 6, 7, 8, 11, 12, 14, 19, 20, 23, 26, 41, 8, 25, 20,
+    12, 5, 16, 6, 9, 14, 20, 15, 5, 18, 12, 12, 19, 5, 18, 6,
+    20, 3, 20, 3, 7, 11, 12, 14, 18, 5, 18, 9, 15, 31, 2, 7,
+    11, 12, 14, 18, 19, 20, 9, 14, 16, 18, 21, 3, 6, 12, 13, 2,
+    16, 18, 9, 21, 20, 13, 14, 13, 7, 11, 23, 26, 19, 14, 7, 19,
+    20, 9, 12, 15, 16, 5, 19, 20, 26, 2, 11, 13, 15, 20, 26, 8,
+    21, 5, 7, 14, 19, 9, 15, 1, 20, 1, 5, 8, 11, 13, 14, 19,
+    20, 1, 19, 20, 1, 5, 14, 12, 19, 13, 16, 5, 6, 8, 9, 13,
+    14, 19, 6, 7, 9, 12, 21, 1, 3, 5, 9, 16, 3, 5, 7, 8,
+    16, 8, 1, 5, 5, 5, 1, 5, 12, 15, 5, 1, 8, 5, 9, 1,
+    5, 19, 20, 5, 8, 12, 19, 20, 23, 11, 1, 20, 1, 19, 8, 9,
+    20, 20, 18, 5, 20, 5, 9, 20, 6, 14, 1, 4, 0, 2, 5, 6,
+    9, 21, 5, 9, 9, 20, 2, 18, 2, 3, 8, 9, 12, 18, 4, 6,
+    20, 18, 21, 18, 14, 26, 1, 14, 1, 5, 16, 13, 7, 20, 2, 14,
+    18, 14, 26, 8, 9, 16, 12, 13, 8, 14, 1, 18, 9, 7, 19, 4,
+    9, 5, 9, 31, 18, 9, 9, 5, 9, 11, 19, 0, 19, 0, 5, 20,
+    26, 4, 3, 9, 16, 18, 18, 5, 3, 16, 5, 11, 5, 20, 12, 13,
+    14, 18, 5, 14, 12, 18, 8, 20, 1, 5, 20, 20, 21, 20, 13, 19,
+    20, 18, 13, 4, 9, 14, 18, 19, 21, 13, 5, 19, 20, 20, 26, 13,
+    18, 1, 14, 14, 18, 21, 5, 5, 3, 4, 11, 13, 21, 2, 3, 9,
+    12, 18, 19, 1, 16, 20, 5, 8, 14, 18, 13, 12, 5, 7, 12, 5,
+    19, 20, 19, 20, 25, 5, 4, 0, 5, 8, 19, 21, 26, 20, 4, 7,
+    19, 20, 7, 9, 20, 5, 14, 26, 2, 8, 19, 6, 14, 18, 1, 9,
+    11, 14, 1, 4, 7, 19, 0, 2, 4, 6, 7, 8, 11, 19, 41, 20,
+    1, 5, 7, 18, 4, 7, 8, 14, 19, 12, 3, 14, 5, 3, 4, 13,
+    2, 14, 20, 4, 14, 1, 18, 2, 12, 14, 18, 1, 9, 9, 20, 18,
+    20, 5, 20, 1, 1, 8, 8, 14, 1, 42, 18, 7, 1, 14, 2, 4,
+    18, 5, 12, 13, 20, 9, 4, 6, 7, 13, 26, 18, 20, 19, 13, 18,
+    21, 14, 19, 21, 14, 18, 20, 20, 11, 6, 7, 9, 19, 5, 9, 15,
+    8, 18, 9, 20, 9, 1, 5, 1, 5, 0, 14, 18, 1, 9, 4, 18,
+    13, 14, 19, 2, 18, 18, 13, 14, 1, 3, 12, 18, 0, 14, 25, 1,
+    5, 6, 11, 14, 18, 21, 6, 14, 18, 22, 5, 14, 6, 18, 1, 5,
+    31, 13, 19, 4, 1, 5, 12, 14, 11, 12, 7, 3, 3, 31, 20, 1,
+    3, 12, 14, 9, 14, 16, 18, 11, 13, 14, 1, 15, 13, 18, 19, 20,
+    9, 14, 18, 19, 21, 4, 12, 20, 2, 3, 18, 1, 5, 15, 31, 6,
+    7, 5, 9, 20, 20, 0, 2, 3, 14, 19, 1, 9, 9, 16, 1, 20,
+    2, 12, 23, 13, 8, 6, 5, 14, 20, 21, 14, 3, 19, 20, 8, 14,
+    5, 18, 1, 9, 18, 14, 19, 2, 18, 19, 13, 1, 9, 21, 12, 0,
+    0, 19, 5, 20, 5, 5, 5, 15, 20, 19, 1, 11, 26, 2, 5, 6,
+    15, 20, 1, 15, 31, 1, 5, 18, 18, 20, 19, 21, 19, 5, 12, 8,
+    15, 18, 5, 5, 18, 6, 11, 14, 18, 41, 5, 0, 1, 18, 19, 5,
+    1, 9, 14, 25, 5, 16, 12, 9, 26, 9, 19, 9, 8, 18, 20, 21,
+    4, 14, 1, 5, 9, 2, 16, 12, 19, 1, 14, 20, 1, 9, 15, 16,
+    20, 21, 26, 1, 23, 25, 13, 19, 21, 2, 18, 19, 4, 15, 5, 1,
+    5, 9, 16, 14, 1, 14, 5, 15, 19, 5, 13, 14, 0, 5, 20, 1,
+    4, 16, 14, 19, 13, 14, 7, 9, 20, 4, 4, 5, 19, 19, 14, 1,
+    5, 9, 1, 1, 5, 5, 23, 4, 5, 19, 0, 5, 16, 21, 20, 14,
+    5, 14, 1, 14, 21, 5, 16, 8, 11, 18, 21, 1, 8, 9, 15, 18,
+    1, 5, 18, 31, 18, 14, 18, 19, 9, 19, 1, 26, 3, 14, 12, 20,
+    9, 19, 26, 7, 19, 7, 26, 1, 5, 20, 5, 19, 20, 5, 15, 20,
+    21, 1, 12, 18, 5, 16, 7, 20, 5, 23, 26, 9, 7, 15, 7, 19,
+    14, 16, 20, 12, 9, 5, 5, 18, 8, 14, 16, 18, 5, 14, 5, 18,
+    9, 12, 18, 9, 18, 5, 9, 15, 20, 5, 15, 20, 21, 13, 16, 18,
+    9, 15, 9, 8, 18, 18, 19, 19, 5, 5, 12, 5, 15, 9, 19, 2,
+    11, 13, 19, 14, 18, 24, 4, 5, 14, 0, 0, 0, 5, 11, 21, 8,
+    19, 9, 18, 1, 5, 21, 3, 19, 4, 12, 14, 18, 21, 5, 1, 5,
+    9, 19, 18, 1, 5, 9, 12, 19, 5, 12, 1, 18, 42, 9, 21, 1,
+    9, 0, 3, 16, 5, 8, 18, 0, 11, 19, 18, 9, 9, 14, 5, 14,
+    19, 20, 13, 23, 8, 18, 1, 5, 8, 15, 12, 11, 14, 9, 12, 4,
+    13, 18, 1, 18, 5, 0, 14, 31, 1, 9, 2, 3, 4, 6, 7, 8,
+    12, 16, 19, 22, 23, 15, 18, 19, 5, 7, 20, 5, 20, 26, 6, 8,
+    18, 4, 14, 15, 31, 0, 5, 7, 21, 6, 1, 21, 4, 14, 19, 20,
+    21, 0, 14, 18, 21, 14, 19, 1, 3, 13, 9, 18, 31, 0, 14, 15,
+    16, 1, 5, 13, 9, 1, 11, 26, 0, 19, 2, 6, 4, 7, 21, 2,
+    5, 9, 14, 16, 14, 9, 1, 19, 20, 20, 21, 19, 14, 5, 0, 19,
+    1, 15, 1, 19, 0, 9, 11, 0, 12, 3, 18, 14, 12, 5, 12, 18,
+    5, 5, 9, 14, 18, 31, 1, 9, 20, 16, 1, 2, 4, 5, 6, 14,
+    18, 19, 20, 22, 1, 2, 5, 6, 8, 18, 20, 23, 9, 19, 20, 1,
+    9, 11, 13, 22, 20, 24, 1, 5, 1, 9, 7, 19, 20, 6, 3, 20,
+    0, 3, 12, 14, 7, 9, 18, 21, 1, 16, 1, 5, 19, 42, 5, 16,
+    4, 6, 7, 8, 12, 19, 23, 26, 5, 9, 23, 14, 19, 3, 19, 9,
+    18, 9, 11, 16, 18, 1, 5, 18, 42, 5, 15, 18, 41, 1, 5, 9,
+    15, 1, 5, 9, 41, 5, 9, 19, 20, 31, 2, 19, 5, 9, 0, 1,
+    3, 5, 16, 20, 5, 18, 1, 5, 25, 31, 13, 18, 8, 8, 12, 14,
+    15, 5, 21, 1, 5, 21, 11, 21, 25, 15, 18, 9, 4, 18, 20, 5,
+    14, 3, 7, 21, 13, 5, 2, 20, 11, 20, 21, 14, 12, 5, 19, 26,
+    1, 15, 5, 14, 21, 7, 7, 12, 21, 7, 19, 20, 14, 14, 19, 9,
+    12, 5, 15, 9, 18, 21, 20, 20, 5, 15, 20, 18, 12, 1, 20, 14,
+    21, 0, 5, 12, 1, 13, 18, 14, 1, 19, 5, 9, 19, 21, 31, 0,
+    5, 19, 1, 9, 18, 5, 5, 12, 14, 18, 14, 14, 18, 7, 21, 0,
+    3, 20, 5, 9, 21, 9, 15, 18, 1, 12, 18, 20, 12, 15, 18, 5,
+    18, 21, 0, 5, 15, 16, 25, 5, 18, 14, 8, 11, 15, 21, 12, 5,
+    18, 12, 14, 1, 5, 15, 18, 12, 12, 5, 16, 6, 5, 19, 19, 23,
+    19, 21, 13, 19, 9, 14, 13, 21, 21, 9, 12, 18, 9, 1, 5, 15,
+    12, 14, 18, 20, 14, 2, 9, 13, 1, 4, 3, 7, 5, 18, 5, 15,
+    19, 1, 4, 9, 11, 20, 26, 8, 3, 26, 16, 15, 14, 1, 5, 20,
+    8, 12, 16, 20, 26, 1, 5, 1, 5, 19, 9, 1, 9, 5, 5, 12,
+    4, 9, 26, 5, 9, 20, 20, 7, 4, 6, 19, 1, 5, 7, 7, 8,
+    12, 20, 23, 26, 5, 15, 6, 25, 18, 5, 1, 0, 22, 1, 5, 19,
+    4, 12, 14, 14, 18, 2, 14, 1, 5, 18, 21, 12, 20, 12, 8, 19,
+    1, 3, 20, 1, 18, 13, 14, 19, 21, 9, 15, 21, 15, 1, 20, 9,
+    20, 19, 6, 1, 9, 5, 1, 19, 5, 14, 19, 21, 19, 5, 18, 21,
+    15, 16, 20, 6, 7, 13, 16, 20, 26, 11, 13, 5, 21, 5, 14, 4,
+    5, 9, 5, 8, 19, 26, 1, 20, 22, 18, 18, 12, 18, 9, 7, 4,
+    9, 20, 18, 18, 20, 2, 12, 14, 19, 20, 9, 13, 18, 22, 5, 14,
+    16, 20, 12, 18, 20, 1, 3, 8, 15, 19, 11, 18, 2, 5, 12, 5,
+    2, 7, 14, 20, 20, 6, 14, 19, 6, 19, 15, 1, 19, 20, 26, 5,
+    6, 8, 11, 12, 13, 14, 18, 19, 26, 41, 11, 1, 12, 13, 1, 6,
+    0, 6, 7, 11, 13, 14, 20, 3, 19, 19, 12, 13, 16, 21, 3, 8,
+    12, 24, 14, 1, 18, 1, 9, 2, 1, 20, 5, 4, 13, 5, 14, 5,
+    21, 1, 16, 5, 19, 1, 1, 5, 19, 9, 1, 12, 15, 19, 18, 5,
+    16, 20, 2, 9, 12, 3, 5, 20, 5, 20, 11, 20, 20, 19, 8, 9,
+    19, 20, 5, 7, 20, 1, 4, 6, 7, 11, 12, 23, 19, 20, 14, 12,
+    3, 18, 14, 19, 5, 3, 19, 5, 19, 12, 18, 20, 20, 18, 5, 15,
+    20, 18, 14, 15, 20, 14, 18, 20, 12, 18, 4, 5, 5, 8, 20, 9,
+    18, 1, 8, 1, 15, 19, 1, 18, 19, 18, 0, 5, 5, 11, 16, 5,
+    18, 1, 1, 14, 0, 13, 21, 14, 9, 13, 12, 13, 1, 18, 1, 5,
+    2, 12, 18, 9, 0, 2, 6, 7, 16, 19, 20, 23, 5, 13, 5, 6,
+    12, 14, 15, 18, 3, 6, 9, 13, 18, 19, 21, 24, 4, 5, 6, 18,
+    19, 1, 5, 15, 41, 1, 5, 25, 41, 42, 0, 5, 21, 2, 18, 24,
+    1, 5, 9, 15, 5, 11, 20, 1, 9, 15, 14, 5, 9, 21, 17, 18,
+    5, 14, 20, 0, 14, 15, 19, 20, 11, 7, 5, 0, 5, 0, 1, 5,
+    9, 19, 12, 7, 12, 18, 14, 5, 9, 2, 0, 1, 5, 5, 0, 2,
+    4, 5, 6, 7, 8, 9, 11, 12, 14, 18, 19, 20, 23, 26, 19, 12,
+    4, 3, 6, 7, 13, 18, 0, 20, 24, 2, 26, 19, 4, 12, 19, 21,
+    12, 18, 14, 18, 19, 13, 20, 26, 1, 5, 9, 15, 20, 1, 4, 6,
+    7, 12, 14, 18, 19, 23, 26, 31, 5, 23, 14, 4, 12, 19, 5, 2,
+    9, 14, 5, 18, 42, 18, 41, 5, 9, 0, 5, 20, 19, 20, 0, 1,
+    5, 8, 13, 16, 21, 6, 12, 1, 1, 5, 18, 16, 20, 11, 14, 19,
+    14, 18, 12, 7, 21, 1, 12, 20, 0, 5, 1, 0, 21, 5, 18, 9,
+    20, 2, 11, 18, 12, 14, 18, 20, 14, 18, 20, 15, 1, 12, 18, 19,
+    5, 5, 15, 0, 13, 8, 19, 12, 21, 1, 18, 18, 11, 1, 4, 31,
+    5, 15, 9, 0, 19, 22, 0, 18, 16, 5, 19, 5, 3, 1, 18, 5,
+    7, 21, 9, 1, 5, 15, 31, 9, 12, 1, 5, 9, 15, 4, 20, 5,
+    11, 1, 20, 31, 0, 14, 20, 26, 1, 11, 15, 20, 0, 9, 18, 3,
+    14, 19, 1, 7, 9, 12, 15, 18, 19, 42, 14, 18, 18, 0, 19, 5,
+    14, 20, 5, 3, 11, 14, 24, 3, 4, 9, 14, 19, 3, 14, 20, 2,
+    7, 10, 16, 19, 26, 3, 13, 14, 19, 3, 6, 14, 5, 11, 5, 19,
+    8, 9, 8, 11, 12, 15, 11, 9, 2, 12, 20, 6, 7, 14, 15, 19,
+    20, 26, 1, 19, 20, 5, 18, 23, 5, 1, 14, 19, 41, 0, 19, 5,
+    1, 6, 7, 8, 13, 19, 21, 23, 41, 19, 20, 1, 15, 12, 16, 7,
+    18, 12, 6, 3, 9, 20, 9, 15, 31, 5, 21, 7, 11, 12, 16, 18,
+    21, 1, 5, 15, 31, 41, 18, 18, 7, 18, 19, 0, 2, 5, 9, 12,
+    13, 6, 12, 18, 19, 1, 2, 7, 9, 11, 16, 18, 9, 13, 2, 4,
+    6, 8, 12, 13, 14, 19, 23, 15, 16, 0, 2, 5, 9, 11, 13, 19,
+    20, 5, 9, 20, 0, 2, 9, 20, 0, 6, 7, 18, 19, 20, 5, 13,
+    8, 9, 18, 3, 4, 7, 12, 14, 0, 5, 6, 12, 14, 19, 1, 5,
+    13, 0, 1, 4, 19, 20, 15, 0, 1, 2, 5, 6, 9, 13, 14, 3,
+    19, 20, 1, 9, 20, 5, 6, 14, 1, 14, 8, 0, 6, 7, 12, 14,
+    13, 13, 16, 2, 6, 14, 19, 20, 0, 5, 16, 1, 9, 12, 1, 5,
+    21, 12, 8, 0, 6, 5, 9, 5, 15, 0, 2, 5, 7, 9, 16, 19,
+    20, 25, 20, 5, 18, 3, 4, 6, 7, 8, 9, 11, 12, 14, 16, 19,
+    21, 27, 0, 1, 6, 9, 16, 20, 21, 2, 5, 7, 11, 19, 21, 3,
+    7, 8, 13, 16, 19, 1, 2, 4, 7, 11, 14, 16, 3, 7, 14, 16,
+    8, 1, 15, 19, 20, 0, 1, 4, 5, 7, 9, 14, 19, 20, 1, 5,
+    12, 14, 20, 26, 18, 20, 19, 8, 8, 11, 0, 5, 26, 3, 1, 15,
+    19, 0, 1, 9, 12, 14, 1, 5, 14, 18, 1, 5, 16, 20, 1, 5,
+    19, 5, 12, 19, 0, 20, 1, 18, 1, 5, 1, 5, 20, 14, 14, 12,
+    14, 20, 1, 20, 19, 18, 12, 20, 9, 14, 1, 3, 20, 19, 19, 0,
+    19, 15, 15, 21, 7, 14, 20, 21, 0, 11, 14, 18, 20, 1, 5, 1,
+    5, 19, 41, 0, 16, 18, 5, 1, 8, 18, 14, 18, 1, 5, 12, 2,
+    12, 20, 1, 18, 19, 18, 5, 18, 15, 12, 1, 5, 0, 9, 1, 5,
+    18, 1, 31, 0, 1, 5, 21, 23, 42, 19, 11, 12, 5, 2, 11, 13,
+    16, 21, 1, 5, 9, 12, 8, 9, 12, 18, 12, 15, 20, 31, 13, 1,
+    5, 8, 9, 15, 18, 21, 9, 5, 15, 2, 14, 9, 12, 13, 14, 18,
+    13, 1, 1, 8, 12, 18, 8, 5, 7, 12, 15, 19, 5, 2, 3, 4,
+    5, 6, 7, 11, 12, 18, 19, 23, 26, 14, 5, 5, 3, 13, 14, 5,
+    14, 21, 9, 19, 20, 0, 23, 3, 13, 12, 1, 5, 0, 5, 8, 11,
+    0, 2, 3, 12, 2, 3, 14, 21, 3, 8, 13, 14, 18, 19, 21, 0,
+    14, 20, 1, 5, 9, 21, 2, 19, 11, 1, 16, 21, 9, 18, 13, 14,
+    18, 5, 6, 14, 4, 14, 19, 20, 21, 1, 6, 12, 15, 16, 18, 2,
+    6, 8, 9, 13, 14, 18, 19, 0, 1, 12, 12, 13, 14, 12, 5, 16,
+    20, 2, 4, 5, 12, 14, 18, 19, 23, 26, 21, 2, 3, 4, 12, 13,
+    14, 16, 19, 15, 19, 20, 5, 19, 0, 2, 3, 9, 13, 14, 18, 19,
+    20, 18, 1, 5, 12, 18, 1, 5, 9, 15, 21, 31, 41, 1, 11, 12,
+    14, 12, 9, 31, 0, 1, 3, 2, 19, 1, 5, 15, 0, 5, 20, 1,
+    6, 31, 1, 2, 5, 15, 23, 3, 11, 5, 18, 1, 9, 1, 5, 18,
+    2, 16, 20, 21, 0, 19, 12, 1, 5, 5, 1, 9, 0, 9, 16, 0,
+    4, 14, 1, 4, 5, 13, 5, 9, 4, 13, 15, 18, 26, 19, 11, 12,
+    18, 21, 8, 0, 15, 26, 18, 12, 5, 5, 14, 18, 0, 5, 12, 18,
+    0, 1, 19, 1, 5, 14, 20, 14, 12, 18, 20, 13, 18, 21, 14, 18,
+    14, 21, 1, 5, 31, 14, 18, 9, 12, 21, 7, 1, 5, 6, 11, 13,
+    14, 9, 1, 12, 19, 19, 20, 1, 12, 14, 18, 21, 18, 0, 1, 5,
+    16, 21, 31, 13, 11, 9, 5, 4, 14, 8, 9, 12, 8, 9, 18, 12,
+    19, 14, 12, 14, 18, 18, 7, 4, 1, 7, 7, 20, 19, 20, 5, 19,
+    19, 20, 5, 18, 14, 1, 5, 9, 19, 18, 14, 14, 14, 8, 18, 7,
+    11, 14, 20, 5, 9, 9, 14, 9, 12, 13, 14, 1, 1, 5, 14, 16,
+    0, 1, 8, 14, 19, 14, 15, 12, 8, 0, 5, 9, 16, 1, 9, 12,
+    13, 5, 20, 5, 12, 0, 4, 7, 14, 19, 20, 2, 3, 5, 6, 16,
+    11, 18, 8, 11, 5, 6, 12, 15, 0, 2, 3, 6, 7, 8, 11, 14,
+    19, 20, 26, 0, 4, 14, 20, 5, 15, 16, 18, 0, 1, 5, 18, 20,
+    8, 11, 2, 6, 14, 18, 0, 5, 7, 12, 5, 15, 4, 7, 9, 14,
+    20, 9, 11, 5, 12, 0, 1, 2, 5, 9, 11, 12, 19, 20, 1, 6,
+    13, 20, 20, 19, 31, 4, 11, 19, 8, 5, 7, 19, 3, 19, 27, 19,
+    5, 21, 11, 13, 8, 14, 2, 12, 5, 16, 20, 5, 1, 5, 12, 18,
+    42, 18, 5, 12, 5, 7, 19, 20, 19, 1, 8, 9, 9, 15, 7, 9,
+    12, 12, 6, 9, 20, 22, 3, 12, 18, 19, 20, 4, 9, 11, 3, 14,
+    14, 18, 15, 12, 20, 2, 6, 7, 11, 12, 14, 19, 20, 1, 9, 18,
+    6, 13, 20, 3, 9, 12, 5, 9, 2, 20, 13, 9, 19, 19, 8, 5,
+    5, 1, 13, 20, 20, 5, 6, 14, 19, 1, 5, 9, 15, 21, 1, 20,
+    5, 9, 15, 41, 1, 15, 31, 21, 9, 6, 19, 20, 6, 7, 21, 12,
+    14, 5, 18, 31, 5, 13, 22, 2, 9, 15, 5, 5, 14, 18, 14, 5,
+    20, 12, 1, 3, 9, 15, 20, 5, 14, 0, 1, 5, 19, 6, 15, 22,
+    0, 7, 14, 19, 2, 9, 14, 18, 19, 20, 22, 4, 14, 21, 16, 8,
+    1, 20, 18, 5, 19, 5, 19, 20, 5, 7, 23, 26, 9, 19, 20, 14,
+    21, 9, 14, 5, 19, 14, 7, 18, 19, 2, 14, 18, 20, 4, 1, 2,
+    1, 5, 11, 5, 14, 1, 15, 4, 20, 12, 3, 20, 21, 3, 20, 14,
+    21, 8, 0, 3, 4, 9, 18, 19, 13, 14, 16, 5, 15, 16, 20, 5,
+    18, 12, 13, 14, 18, 20, 14, 19, 5, 19, 20, 14, 9, 1, 18, 1,
+    5, 12, 5, 21, 23, 20, 1, 3, 9, 13, 14, 18, 19, 20, 24, 14,
+    0, 1, 5, 19, 42, 3, 20, 8, 13, 14, 9, 11, 11, 12, 5, 19,
+    0, 20, 6, 8, 12, 14, 15, 19, 9, 15, 1, 9, 2, 2, 18, 14,
+    5, 20, 9, 19, 26, 7, 14, 15, 19, 6, 12, 18, 22, 11, 19, 9,
+    3, 19, 26, 7, 9, 19, 5, 21, 19, 9, 1, 15, 18, 21, 1, 15,
+    18, 21, 31, 42, 7, 19, 5, 18, 14, 18, 9, 18, 14, 5, 5, 5,
+    8, 14, 9, 12, 14, 18, 14, 18, 13, 5, 14, 9, 5, 2, 8, 1,
+    19, 21, 18, 1, 13, 3, 9, 18, 8, 13, 18, 9, 12, 7, 26, 3,
+    13, 20, 12, 13, 19, 20, 14, 5, 7, 1, 6, 7, 11, 12, 23, 20,
+    5, 4, 8, 9, 1, 9, 12, 15, 13, 14, 20, 18, 13, 5, 13, 18,
+    2, 2, 11, 16, 0, 18, 24, 13, 2, 16, 18, 0, 3, 16, 20, 13,
+    4, 14, 19, 9, 20, 11, 26, 19, 13, 20, 14, 18, 20, 23, 21, 42,
+    9, 1, 20, 15, 12, 18, 19, 20, 5, 16, 15, 9, 18, 4, 14, 8,
+    1, 5, 18, 18, 12, 20, 5, 19, 14, 18, 4, 13, 1, 5, 20, 20,
+    1, 4, 7, 8, 19, 26, 9, 3, 16, 20, 5, 15, 20, 20, 6, 7,
+    5, 1, 7, 19, 20, 8, 11, 20, 23, 1, 8, 15, 16, 14, 14, 1,
+    9, 15, 5, 14, 4, 19, 14, 20, 21, 9, 18, 20, 13, 14, 6, 20,
+    3, 14, 21, 18, 6, 1, 18, 5, 9, 9, 15, 3, 3, 16, 16, 9,
+    2, 20, 7, 14, 11, 1, 5, 9, 13, 21, 23, 4, 19, 20, 1, 5,
+    12, 16, 23, 5, 18, 14, 0, 3, 18, 19, 3, 11, 3, 20, 26, 18,
+    3, 2, 7, 12, 14, 16, 18, 19, 26, 6, 13, 12, 21, 9, 12, 18,
+    5, 14, 1, 9, 14, 18, 4, 7, 26, 20, 19, 20, 0, 5, 14, 1,
+    1, 20, 1, 5, 9, 15, 12, 9, 14, 5, 19, 1, 4, 1, 21, 21,
+    8, 18, 21, 5, 5, 5, 15, 21, 8, 14, 18, 20, 14, 31, 9, 14,
+    19, 4, 11, 13, 14, 15, 18, 19, 19, 14, 21, 9, 12, 19, 14, 1,
+    4, 12, 14, 19, 1, 12, 11, 1, 14, 5, 5, 9, 18, 20, 1, 1,
+    5, 5, 8, 9, 18, 14, 12, 1, 5, 9, 14, 5, 7, 5, 21, 21,
+    12, 5, 19, 20, 5, 14, 5, 9, 3, 18, 1, 9, 19, 1, 5, 15,
+    21, 1, 5, 18, 5, 19, 5, 9, 14, 5, 8, 8, 5, 9, 3, 5,
+    9, 18, 1, 20, 5, 12, 18, 18, 5, 18, 19, 5, 19, 3, 19, 18,
+    5, 5, 3, 1, 5, 8, 9, 15, 18, 5, 12, 1, 12, 18, 5, 12,
+    19, 21, 5, 21, 18, 12, 5, 15, 18, 14, 15, 0, 1, 5, 9, 12,
+    14, 15, 18, 21, 1, 5, 8, 15, 18, 21, 31, 1, 5, 9, 15, 18,
+    21, 19, 20, 1, 5, 1, 21, 5, 18, 18, 12, 5, 15, 8, 26, 0,
+    12, 1, 5, 5, 19, 1, 5, 1, 5, 18, 19, 19, 5, 5, 18, 19,
+    3, 1, 15, 18, 20, 5, 5, 15, 8, 20, 14, 9, 13, 18, 31, 20,
+    20, 15, 14, 20, 6, 1, 12, 2, 14, 21, 3, 19, 4, 5, 20, 4,
+    9, 1, 1, 14, 20, 14, 5, 1, 15, 5, 5, 19, 1, 9, 18, 5,
+    5, 20, 14, 15, 14, 1, 5, 0, 4, 5, 15, 19, 11, 20, 1, 5,
+    15, 18, 4, 11, 13, 14, 18, 14, 20, 1, 5, 19, 1, 26, 5, 3,
+    19, 21, 13, 14, 5, 12, 16, 20, 5, 16, 8, 14, 19, 23, 26, 5,
+    23, 4, 12, 2, 5, 5, 12, 15, 21, 31, 5, 41, 14, 15, 0, 1,
+    5, 41, 1, 5, 5, 0, 1, 1, 5, 9, 15, 18, 5, 5, 9, 6,
+    8, 15, 18, 1, 5, 16, 20, 1, 18, 19, 18, 5, 1, 19, 15, 9,
+    5, 9, 19, 8, 19, 9, 14, 20, 1, 1, 5, 21, 19, 5, 14, 5,
+    20, 1, 5, 5, 5, 18, 5, 5, 14, 20, 26, 20, 13, 18, 3, 5,
+    18, 14, 1, 41, 14, 14, 2, 13, 5, 12, 15, 22, 9, 8, 7, 12,
+    20, 7, 20, 3, 19, 0, 9, 19, 11, 18, 20, 12, 26, 9, 0, 5,
+    18, 12, 5, 14, 1, 15, 16, 20, 5, 19, 1, 1, 18, 7, 20, 2,
+    18, 12, 8, 1, 8, 19, 14, 9, 5, 18, 5, 12, 12, 5, 19, 5,
+    4, 20, 18, 5, 14, 2, 8, 18, 21, 18, 5, 9, 18, 8, 18, 9,
+    14, 12, 18, 6, 8, 9, 3, 11, 19, 9, 20, 12, 14, 5, 19, 8,
+    9, 18, 18, 9, 1, 5, 20, 2, 5, 6, 7, 12, 18, 23, 26, 19,
+    18, 5, 1, 5, 9, 12, 13, 14, 23, 14, 20, 5, 1, 5, 3, 5,
+    14, 18, 14, 0, 7, 19, 20, 7, 18, 1, 5, 15, 31, 19, 7, 20,
+    6, 11, 26, 18, 20, 9, 14, 1, 1, 9, 18, 4, 20, 1, 4, 9,
+    5, 18, 14, 14, 18, 12, 14, 12, 14, 19, 20, 26, 1, 5, 9, 14,
+    14, 9, 14, 14, 9, 18, 3, 14, 9, 9, 20, 0, 5, 3, 14, 14,
+    9, 18, 5, 2, 1, 5, 18, 18, 14, 18, 13, 18, 14, 0, 19, 14,
+    1, 12, 15, 14, 5, 19, 2, 18, 9, 18, 9, 15, 15, 9, 5, 14,
+    9, 14, 16, 18, 5, 18, 12, 14, 5, 15, 20, 0, 14, 1, 18, 18,
+    3, 5, 5, 9, 14, 20, 18, 18, 14, 14, 20, 5, 15, 7, 1, 19,
+    20, 0, 14, 18, 5, 18, 3, 16, 5, 14, 20, 5, 5, 12, 12, 14,
+    18, 8, 5, 3, 5, 1, 19, 5, 20, 18, 20, 5, 3, 5, 5, 18,
+    6, 9, 9, 7, 14, 5, 5, 19, 1, 12, 18, 5, 5, 18, 19, 8,
+    18, 19, 20, 14, 19, 1, 6, 6, 1, 5, 5, 18, 18, 5, 5, 21,
+    1, 5, 9, 21, 1, 3, 20, 20, 1, 7, 8, 14, 5, 9, 0, 6,
+    8, 12, 23, 41, 12, 18, 18, 11, 18, 1, 9, 31, 1, 13, 1, 0,
+    3, 12, 14, 20, 11, 31, 19, 18, 2, 13, 5, 9, 4, 18, 14, 1,
+    4, 8, 4, 5, 12, 14, 19, 7, 14, 9, 15, 14, 0, 23, 15, 11,
+    5, 8, 23, 12, 14, 14, 5, 18, 19, 6, 12, 9, 31, 12, 4, 11,
+    18, 20, 5, 5, 19, 18, 21, 6, 20, 42, 11, 16, 20, 12, 7, 14,
+    14, 13, 7, 20, 15, 19, 1, 1, 5, 0, 5, 19, 21, 6, 23, 26,
+    19, 19, 6, 6, 19, 19, 18, 14, 5, 5, 14, 18, 14, 12, 5, 2,
+    19, 20, 5, 9, 4, 7, 20, 5, 7, 5, 5, 11, 5, 12, 19, 5,
+    9, 13, 3, 6, 9, 18, 13, 5, 20, 19, 14, 5, 9, 9, 5, 3,
+    14, 12, 14, 5, 12, 14, 20, 1, 2, 18, 14, 14, 14, 20, 7, 1,
+    20, 5, 9, 9, 20, 0, 20, 11, 4, 9, 19, 20, 9, 18, 14, 13,
+    2, 6, 11, 16, 23, 7, 0, 9, 7, 8, 18, 5, 18, 14, 11, 8,
+    9, 18, 12, 14, 18, 14, 18, 20, 5, 9, 20, 12, 19, 9, 0, 1,
+    9, 5, 14, 5, 4, 19, 19, 1, 18, 21, 5, 11, 0, 23, 5, 7,
+    23, 3, 6, 12, 19, 2, 0, 14, 19, 19, 1, 2, 0, 2, 9, 18,
+    14, 12, 18, 19, 31, 18, 19, 19, 2, 15, 3, 13, 9, 18, 1, 5,
+    18, 20, 5, 1, 14, 6, 14, 11, 11, 3, 21, 18, 3, 18, 16, 18,
+    19, 14, 18, 14, 1, 5, 23, 5, 5, 1, 20, 14, 20, 18, 13, 18,
+    2, 19, 23, 19, 5, 5, 9, 19, 5, 15, 12, 5, 6, 23, 5, 41,
+    5, 14, 9, 0, 19, 19, 5, 5, 5, 0, 5, 14, 5, 20, 5, 7,
+    7, 14, 18, 21, 2, 9, 18, 4, 20, 4, 7, 0, 9, 13, 8, 13,
+    18, 1, 18, 4, 9, 11, 19, 4, 2, 6, 14, 15, 20, 26, 6, 14,
+    20, 31, 1, 14, 1, 20, 4, 5, 12, 12, 13, 18, 24, 1, 9, 13,
+    20, 18, 5, 2, 18, 20, 0, 18, 1, 12, 13, 19, 7, 18, 3, 12,
+    14, 19, 5, 5, 9, 6, 14, 14, 18, 20, 9, 20, 6, 12, 12, 14,
+    8, 9, 9, 18, 20, 18, 14, 18, 23, 20, 7, 20, 5, 18, 14, 19,
+    8, 5, 21, 13, 20, 26, 12, 18, 18, 9, 18, 18, 1, 18, 5, 16,
+    14, 14, 5, 7, 9, 12, 8, 21, 9, 18, 18, 18, 7, 19, 5, 5,
+    18, 18, 14, 20, 20, 12, 14, 18, 5, 14, 19, 18, 5, 15, 19, 20,
+    5, 20, 26, 14, 12, 16, 18, 5, 7, 19, 2, 6, 11, 19, 26, 0,
+    19, 18, 18, 14, 3, 20, 8, 1, 18, 12, 23, 7, 12, 19, 23, 18,
+    12, 1, 19, 21, 7, 1, 20, 6, 11, 26, 18, 1, 23, 6, 16, 19,
+    20, 0, 18, 5, 12, 5, 9, 1, 9, 31, 1, 18, 5, 0, 2, 20,
+    14, 19, 4, 5, 19, 14, 14, 18, 19, 0, 20, 2, 6, 12, 14, 19,
+    3, 5, 5, 1, 8, 1, 7, 31, 19, 20, 13, 21, 14, 14, 5, 21,
+    5, 18, 9, 18, 9, 15, 5, 0, 0, 1, 0, 16, 19, 19, 7, 11,
+    6, 7, 12, 5, 5, 12, 2, 5, 5, 5, 18, 12, 12, 13, 20, 6,
+    13, 23, 11, 2, 7, 12, 15, 20, 3, 7, 11, 12, 13, 19, 14, 5,
+    9, 2, 5, 0, 18, 13, 5, 7, 23, 20, 14, 19, 20, 5, 0, 1,
+    2, 6, 18, 20, 22, 5, 14, 19, 5, 1, 15, 12, 0, 5, 9, 0,
+    3, 11, 4, 5, 9, 14, 42, 1, 31, 19, 9, 5, 13, 19, 21, 2,
+    14, 19, 19, 20, 5, 6, 11, 5, 20, 1, 21, 4, 12, 18, 12, 4,
+    7, 6, 7, 8, 11, 19, 21, 11, 11, 19, 12, 18, 13, 19, 12, 21,
+    11, 20, 0, 11, 19, 9, 19, 6, 7, 8, 2, 2, 5, 2, 7, 20,
+    2, 13, 19, 14, 7, 8, 11, 26, 41, 19, 4, 9, 3, 3, 19, 5,
+    41, 18, 12, 13, 5, 23, 7, 19, 1, 9, 14, 18, 19, 7, 4, 20,
+    19, 8, 5, 3, 2, 12, 16, 14, 15, 9, 14, 18, 8, 12, 18, 14,
+    18, 9, 0, 13, 18, 9, 8, 18, 7, 1, 7, 20, 26, 7, 19, 12,
+    7, 8, 14, 2, 9, 7, 2, 14, 9, 19, 41, 0, 8, 5, 14, 4,
+    9, 9, 1, 5, 12, 15, 18, 23, 1, 14, 18, 5, 7, 19, 9, 5,
+    8, 9, 18, 20, 20, 14, 6, 15, 14, 14, 19, 9, 5, 42, 5, 6,
+    9, 13, 5, 5, 15, 21, 20, 18, 5, 14, 18, 3, 2, 16, 21, 20,
+    0, 14, 19, 12, 31, 14, 19, 20, 3, 1, 18, 11, 5, 5, 11, 19,
+    41, 5, 7, 0, 15, 4, 6, 7, 14, 23, 26, 19, 13, 14, 20, 5,
+    7, 19, 20, 6, 14, 20, 31, 19, 20, 8, 6, 5, 0, 20, 11, 18,
+    18, 7, 20, 5, 18, 9, 18, 14, 18, 5, 0, 11, 18, 5, 23, 5,
+    5, 1, 18, 5, 6, 5, 20, 20, 26, 9, 14, 12, 18, 8, 19, 20,
+    9, 19, 21, 20, 19, 23, 9, 18, 2, 14, 18, 8, 9, 14, 16, 3,
+    12, 14, 18, 9, 12, 9, 14, 0, 9, 18, 9, 15, 14, 12, 14, 1,
+    5, 5, 18, 19, 19, 13, 7, 12, 14, 18, 9, 2, 14, 18, 18, 21,
+    9, 19, 5, 4, 5, 19, 7, 13, 12, 7, 14, 21, 18, 11, 6, 7,
+    19, 5, 19, 23, 2, 4, 6, 14, 19, 31, 1, 16, 21, 15, 5, 5,
+    19, 14, 18, 1, 20, 19, 14, 18, 19, 31, 14, 20, 18, 5, 5, 5,
+    19, 5, 9, 1, 9, 19, 8, 14, 18, 14, 19, 18, 5, 1, 18, 9,
+    12, 19, 8, 5, 1, 5, 1, 42, 12, 5, 20, 4, 12, 3, 14, 20,
+    14, 4, 19, 14, 19, 23, 5, 31, 9, 4, 9, 2, 12, 20, 5, 2,
+    14, 6, 14, 21, 0, 5, 18, 1, 26, 19, 9, 11, 5, 20, 1, 12,
+    1, 6, 19, 5, 18, 42, 5, 18, 31, 41, 5, 5, 16, 20, 31, 5,
+    18, 1, 4, 5, 2, 13, 11, 7, 14, 4, 7, 9, 11, 12, 1, 18,
+    20, 18, 7, 20, 9, 19, 1, 18, 14, 18, 19, 5, 7, 20, 2, 6,
+    8, 13, 18, 20, 5, 20, 9, 20, 12, 14, 5, 9, 2, 14, 5, 14,
+    5, 15, 11, 4, 5, 7, 5, 6, 7, 11, 12, 23, 6, 7, 12, 6,
+    26, 5, 18, 18, 14, 11, 19, 11, 26, 0, 8, 9, 1, 5, 19, 18,
+    9, 20, 8, 20, 18, 5, 11, 3, 1, 18, 14, 4, 5, 5, 18, 9,
+    1, 14, 5, 1, 9, 11, 11, 5, 2, 14, 5, 20, 16, 12, 19, 9,
+    15, 12, 9, 2, 20, 14, 14, 14, 3, 18, 20, 18, 4, 11, 16, 14,
+    14, 25, 9, 5, 41, 18, 9, 23, 13, 15, 18, 14, 20, 5, 13, 20,
+    12, 16, 20, 1, 9, 42, 20, 26, 7, 13, 5, 20, 5, 12, 13, 18,
+    23, 18, 6, 8, 9, 13, 18, 14, 1, 1, 5, 21, 1, 9, 15, 21,
+    42, 2, 4, 20, 5, 9, 20, 14, 5, 6, 7, 9, 11, 19, 9, 3,
+    18, 12, 8, 8, 9, 18, 9, 14, 7, 12, 15, 12, 19, 18, 9, 18,
+    14, 18, 4, 19, 9, 14, 24, 18, 14, 19, 11, 1, 18, 1, 16, 20,
+    15, 19, 5, 19, 14, 7, 12, 4, 4, 13, 5, 0, 14, 5, 7, 14,
+    8, 13, 2, 14, 19, 20, 14, 21, 2, 9, 21, 5, 7, 21, 8, 9,
+    20, 24, 21, 9, 14, 18, 14, 18, 3, 11, 18, 5, 20, 4, 26, 18,
+    16, 6, 19, 15, 18, 14, 14, 18, 5, 18, 12, 13, 21, 18, 14, 4,
+    6, 19, 5, 9, 18, 18, 14, 9, 14, 24, 14, 18, 14, 5, 14, 9,
+    8, 11, 5, 12, 9, 14, 3, 9, 20, 14, 18, 12, 1, 5, 5, 1,
+    18, 18, 19, 5, 5, 14, 9, 18, 21, 18, 1, 8, 18, 5, 18, 11,
+    20, 18, 5, 20, 14, 7, 18, 22, 7, 21, 15, 21, 9, 13, 1, 1,
+    15, 5, 31, 7, 13, 19, 7, 7, 11, 19, 19, 6, 8, 14, 18, 19,
+    23, 12, 19, 5, 31, 2, 9, 12, 9, 3, 15, 18, 21, 18, 8, 12,
+    16, 8, 9, 12, 21, 1, 15, 19, 18, 9, 16, 19, 18, 14, 18, 12,
+    13, 21, 18, 18, 0, 1, 7, 14, 5, 18, 21, 6, 19, 9, 15, 5,
+    15, 9, 20, 18, 14, 20, 1, 12, 14, 42, 5, 0, 12, 12, 0, 5,
+    12, 16, 11, 14, 8, 9, 5, 1, 21, 5, 16, 19, 12, 1, 5, 31,
+    5, 18, 20, 14, 9, 3, 9, 18, 31, 18, 5, 7, 19, 8, 8, 18,
+    18, 14, 5, 18, 0, 18, 20, 20, 19, 12, 5, 8, 14, 12, 4, 26,
+    20, 12, 9, 18, 18, 1, 5, 18, 20, 9, 9, 18, 5, 7, 0, 13,
+    14, 18, 19, 11, 9, 18, 16, 13, 19, 18, 23, 14, 4, 20, 31, 15,
+    14, 14, 18, 7, 14, 18, 2, 5, 26, 19, 9, 1, 18, 23, 18, 18,
+    14, 12, 23, 3, 3, 12, 14, 18, 14, 6, 7, 16, 18, 26, 0, 1,
+    5, 1, 12, 6, 7, 18, 19, 9, 4, 12, 20, 12, 21, 18, 2, 18,
+    18, 14, 18, 19, 14, 5, 16, 5, 18, 20, 5, 7, 13, 23, 19, 14,
+    12, 23, 18, 18, 0, 5, 1, 5, 20, 11, 12, 19, 14, 18, 31, 2,
+    19, 1, 20, 5, 5, 9, 9, 18, 5, 14, 18, 0, 14, 0, 19, 21,
+    19, 18, 7, 18, 5, 6, 11, 18, 19, 23, 0, 18, 9, 18, 1, 13,
+    5, 31, 19, 20, 19, 9, 1, 14, 8, 7, 1, 23, 12, 18, 1, 9,
+    1, 0, 9, 13, 5, 5, 19, 1, 5, 19, 20, 7, 14, 11, 3, 14,
+    9, 42, 5, 18, 1, 1, 3, 12, 19, 12, 20, 20, 2, 5, 20, 0,
+    6, 21, 0, 5, 18, 6, 20, 13, 16, 15, 5, 5, 3, 18, 14, 19,
+    1, 0, 9, 19, 5, 12, 5, 5, 4, 5, 0, 5, 9, 19, 6, 14,
+    20, 7, 9, 14, 7, 6, 3, 5, 11, 16, 14, 5, 1, 14, 16, 1,
+    9, 21, 14, 5, 9, 18, 18, 5, 5, 13, 6, 18, 8, 7, 18, 0,
+    2, 9, 18, 14, 18, 5, 12, 13, 41, 20, 18, 5, 12, 9, 14, 19,
+    14, 11, 19, 7, 26, 6, 18, 4, 20, 7, 8, 23, 14, 19, 7, 0,
+    15, 18, 7, 19, 5, 5, 7, 11, 23, 19, 18, 14, 18, 3, 5, 5,
+    18, 5, 5, 14, 19, 1, 1, 7, 9, 4, 12, 20, 14, 0, 19, 21,
+    5, 23, 7, 7, 0, 20, 19, 16, 6, 7, 4, 9, 20, 7, 2, 5,
+    6, 7, 11, 12, 19, 6, 21, 21, 18, 5, 1, 4, 11, 26, 2, 5,
+    6, 18, 5, 23, 19, 18, 14, 20, 14, 2, 18, 9, 21, 1, 8, 11,
+    0, 0, 1, 3, 9, 12, 2, 18, 6, 20, 20, 7, 12, 13, 21, 9,
+    18, 16, 11, 14, 5, 26, 14, 18, 18, 18, 5, 18, 5, 14, 2, 18,
+    14, 5, 12, 0, 19, 5, 9, 7, 9, 12, 13, 1, 14, 20, 3, 5,
+    1, 5, 19, 18, 8, 9, 18, 20, 2, 12, 0, 21, 4, 2, 18, 14,
+    14, 16, 4, 20, 14, 4, 7, 14, 14, 18, 5, 16, 18, 5, 2, 20,
+    1, 9, 20, 12, 9, 7, 14, 5, 3, 5, 1, 15, 12, 6, 6, 8,
+    20, 9, 13, 19, 20, 8, 18, 12, 18, 14, 20, 18, 18, 31, 5, 20,
+    12, 5, 0, 9, 12, 8, 12, 14, 21, 3, 12, 21, 3, 14, 15, 20,
+    26, 5, 18, 19, 5, 18, 9, 18, 7, 18, 14, 9, 18, 15, 31, 18,
+    14, 7, 8, 2, 14, 19, 21, 14, 14, 7, 2, 9, 7, 9, 8, 1,
+    31, 3, 3, 19, 23, 18, 19, 24, 12, 9, 0, 4, 19, 3, 18, 0,
+    1, 18, 5, 23, 16, 12, 2, 19, 21, 14, 0, 14, 18, 18, 5, 5,
+    24, 26, 5, 14, 18, 11, 9, 5, 15, 23, 18, 20, 18, 19, 13, 20,
+    20, 20, 3, 3, 7, 20, 6, 7, 12, 19, 23, 26, 1, 9, 0, 18,
+    5, 8, 14, 14, 9, 13, 14, 18, 0, 5, 14, 14, 12, 14, 14, 2,
+    18, 5, 0, 1, 12, 1, 5, 19, 20, 9, 21, 14, 16, 2, 12, 14,
+    23, 7, 11, 14, 19, 5, 5, 4, 8, 20, 19, 9, 1, 15, 1, 41,
+    9, 31, 5, 16, 19, 4, 9, 1, 7, 14, 5, 19, 18, 18, 14, 18,
+    0, 8, 14, 26, 12, 19, 19, 8, 12, 0, 20, 11, 0, 9, 20, 14,
+    9, 14, 9, 20, 12, 14, 5, 5, 5, 1, 3, 7, 1, 13, 8, 0,
+    9, 19, 0, 14, 16, 6, 19, 21, 3, 0, 9, 3, 3, 19, 4, 8,
+    2, 20, 10, 3, 4, 0, 14, 19, 13, 14, 21, 9, 20, 2, 7, 18,
+    20, 4, 5, 20, 14, 5, 11, 18, 21, 9, 12, 15, 0, 3, 16, 20,
+    18, 19, 5, 7, 19, 19, 20, 8, 13, 21, 1, 21, 42, 18, 19, 0,
+    7, 13, 11, 12, 20, 21, 8, 20, 19, 3, 9, 13, 9, 3, 5, 9,
+    19, 19, 12, 18, 5, 1, 15, 18, 21, 6, 1, 0, 7, 19, 0, 19,
+    18, 19, 21, 1, 5, 14, 25, 9, 5, 18, 1, 19, 7, 26, 19, 18,
+    1, 5, 1, 14, 4, 20, 5, 20, 42, 18, 41, 9, 5, 5, 6, 1,
+    18, 19, 1, 20, 14, 14, 19, 20, 3, 13, 12, 20, 11, 16, 12, 19,
+    20, 14, 8, 2, 7, 18, 19, 14, 18, 7, 19, 31, 18, 14, 19, 6,
+    19, 5, 15, 15, 42, 14, 2, 5, 14, 18, 7, 0, 12, 1, 0, 20,
+    5, 1, 9, 11, 19, 13, 2, 6, 8, 19, 0, 5, 6, 19, 5, 3,
+    16, 20, 18, 14, 14, 18, 20, 14, 20, 4, 7, 19, 20, 7, 14, 3,
+    9, 14, 18, 18, 20, 6, 2, 1, 14, 0, 9, 9, 1, 2, 11, 18,
+    18, 18, 19, 13, 19, 0, 9, 8, 18, 11, 14, 14, 1, 42, 8, 20,
+    18, 7, 14, 9, 20, 7, 18, 9, 12, 14, 16, 0, 4, 5, 7, 19,
+    7, 14, 19, 7, 1, 13, 18, 8, 9, 15, 5, 19, 0, 7, 9, 4,
+    5, 7, 20, 11, 12, 16, 19, 23, 2, 13, 19, 23, 5, 21, 12, 14,
+    21, 9, 21, 8, 15, 4, 6, 8, 31, 18, 5, 0, 0, 1, 9, 18,
+    21, 31, 42, 8, 9, 21, 14, 14, 12, 18, 9, 12, 18, 14, 0, 18,
+    4, 12, 9, 21, 26, 5, 9, 20, 14, 20, 18, 1, 13, 0, 5, 12,
+    23, 5, 8, 11, 12, 5, 19, 3, 19, 14, 14, 18, 2, 11, 14, 14,
+    14, 20, 1, 12, 13, 5, 8, 18, 2, 0, 0, 5, 3, 9, 21, 9,
+    18, 1, 19, 0, 19, 0, 19, 1, 14, 14, 5, 19, 5, 13, 18, 6,
+    9, 15, 0, 5, 1, 5, 0, 5, 5, 19, 5, 5, 26, 0, 14, 2,
+    14, 15, 8, 14, 3, 5, 9, 19, 19, 2, 14, 14, 2, 6, 19, 11,
+    20, 14, 18, 20, 18, 12, 19, 5, 14, 12, 14, 20, 7, 12, 19, 18,
+    4, 7, 11, 0, 20, 7, 11, 14, 5, 19, 5, 5, 9, 12, 18, 5,
+    6, 20, 7, 9, 5, 21, 7, 14, 21, 0, 14, 9, 16, 20, 2, 6,
+    7, 8, 12, 13, 19, 11, 20, 14, 20, 6, 20, 1, 1, 5, 5, 2,
+    3, 4, 7, 12, 5, 2, 20, 20, 19, 14, 18, 14, 18, 5, 20, 2,
+    19, 18, 19, 0, 19, 20, 9, 11, 5, 14, 9, 5, 6, 20, 26, 41,
+    0, 1, 5, 18, 20, 9, 5, 7, 3, 9, 12, 18, 5, 6, 7, 11,
+    19, 20, 5, 18, 5, 1, 5, 14, 18, 19, 14, 19, 20, 20, 20, 14,
+    14, 2, 11, 0, 6, 9, 21, 42, 5, 5, 12, 14, 3, 0, 19, 20,
+    8, 0, 6, 26, 16, 14, 12, 18, 19, 19, 6, 12, 18, 14, 19, 18,
+    12, 13, 15, 41, 7, 7, 19, 14, 4, 7, 4, 5, 18, 16, 3, 19,
+    14, 18, 19, 14, 20, 18, 12, 14, 18, 14, 18, 18, 12, 14, 18, 1,
+    5, 12, 23, 0, 14, 19, 19, 18, 12, 12, 1, 5, 16, 8, 14, 19,
+    1, 9, 9, 9, 14, 12, 5, 9, 18, 5, 9, 13, 9, 14, 24, 19,
+    3, 9, 18, 18, 12, 9, 18, 12, 18, 3, 20, 8, 5, 18, 5, 9,
+    18, 18, 5, 18, 9, 3, 9, 18, 0, 13, 1, 18, 2, 19, 14, 20,
+    21, 0, 2, 14, 14, 2, 9, 7, 7, 14, 14, 18, 14, 1, 2, 9,
+    14, 18, 21, 1, 18, 18, 6, 9, 18, 18, 19, 18, 20, 20, 5, 7,
+    5, 5, 0, 12, 5, 1, 5, 13, 20, 6, 9, 14, 11, 19, 23, 12,
+    18, 9, 13, 5, 18, 21, 0, 22, 9, 18, 18, 9, 11, 19, 3, 9,
+    1, 9, 0, 19, 18, 7, 1, 3, 19, 11, 0, 8, 18, 2, 19, 5,
+    20, 20, 12, 16, 3, 11, 9, 18, 9, 11, 18, 1, 14, 5, 18, 8,
+    18, 5, 9, 7, 4, 5, 23, 8, 26, 9, 5, 18, 18, 0, 20, 14,
+    5, 5, 5, 18, 18, 18, 5, 1, 18, 18, 18, 14, 2, 5, 12, 1,
+    19, 23, 21, 20, 21, 12, 26, 14, 20, 5, 3, 5, 7, 0, 19, 0,
+    9, 2, 18, 1, 2, 18, 19, 0, 1, 18, 13, 14, 1, 7, 15, 0,
+    12, 4, 23, 14, 0, 5, 9, 14, 5, 5, 7, 11, 7, 9, 12, 9,
+    5, 14, 8, 20, 5, 14, 19, 9, 9, 18, 2, 5, 9, 13, 2, 21,
+    18, 1, 7, 19, 15, 5, 21, 19, 5, 21, 5, 4, 7, 20, 16, 14,
+    20, 18, 12, 18, 7, 9, 15, 9, 5, 8, 7, 5, 15, 5, 5, 3,
+    11, 5, 5, 3, 14, 31, 12, 22, 21, 20, 19, 5, 20, 14, 7, 0,
+    19, 14, 14, 5, 3, 12, 0, 18, 20, 16, 3, 18, 18, 18, 14, 8,
+    20, 19, 0, 7, 11, 12, 1, 5, 5, 18, 6, 19, 19, 20, 5, 1,
+    14, 18, 20, 20, 11, 19, 1, 12, 13, 8, 14, 1, 9, 18, 12, 18,
+    5, 18, 21, 7, 14, 11, 23, 19, 9, 8, 19, 5, 5, 0, 18, 2,
+    7, 14, 18, 9, 18, 12, 0, 15, 20, 4, 12, 5, 6, 7, 4, 5,
+    20, 14, 5, 0, 5, 3, 14, 21, 14, 18, 18, 16, 14, 20, 12, 5,
+    2, 2, 3, 12, 20, 0, 0, 19, 12, 2, 9, 12, 8, 2, 21, 21,
+    1, 1, 19, 5, 21, 1, 14, 2, 0, 14, 5, 5, 14, 7, 9, 5,
+    5, 1, 5, 15, 1, 18, 31, 7, 21, 5, 18, 19, 9, 14, 13, 18,
+    7, 8, 5, 5, 2, 18, 0, 9, 26, 7, 18, 18, 4, 14, 7, 8,
+    9, 18, 12, 14, 19, 5, 0, 9, 0, 21, 20, 5, 18, 18, 12, 18,
+    7, 9, 23, 26, 14, 3, 19, 1, 7, 2, 19, 7, 2, 1, 5, 15,
+    14, 18, 14, 20, 0, 5, 9, 5, 5, 14, 7, 14, 5, 19, 12, 14,
+    12, 1, 12, 18, 0, 19, 12, 13, 18, 20, 11, 14, 2, 7, 19, 7,
+    7, 4, 5, 19, 5, 18, 7, 18, 6, 0, 18, 1, 9, 5, 7, 0,
+    19, 14, 19, 20, 5, 23, 5, 7, 11, 7, 2, 18, 5, 18, 18, 12,
+    18, 5, 14, 14, 5, 8, 5, 5, 19, 5, 0, 19, 9, 9, 12, 7,
+    5, 1, 19, 7, 7, 3, 5, 18, 5, 1, 5, 5, 9, 18, 0, 1,
+    9, 1, 3, 9, 5, 5, 5, 4, 14, 7, 18, 15, 3, 5, 5, 9,
+    31, 19, 19, 5, 5, 23, 8, 14, 5, 20, 18, 19, 23, 19, 18, 7,
+    18, 5, 14, 7, 6, 12, 19, 23, 42, 9, 4, 23, 13, 16, 4, 5,
+    13, 19, 1, 9, 3, 26, 7, 7, 4, 12, 7, 20, 7, 7, 19, 20,
+    12, 5, 1, 5, 14, 0, 42, 14, 11, 9, 18, 18, 14, 14, 16, 18,
+    14, 7, 18, 13, 20, 20, 9, 19, 1, 16, 14, 20, 14, 6, 8, 19,
+    8, 1, 19, 19, 5, 5, 16, 1, 13, 18, 23, 5, 20, 19, 2, 0,
+    20, 14, 7, 3, 14, 9, 12, 21, 4, 20, 7, 8, 11, 7, 9, 18,
+    8, 20, 20, 5, 20, 8, 19, 18, 14, 20, 14, 19, 5, 14, 14, 6,
+    20, 5, 5, 20, 3, 16, 20, 2, 21, 12, 18, 5, 12, 7, 5, 9,
+    3, 18, 0, 7, 19, 20, 4, 20, 3, 21, 20, 5, 12, 19, 4, 0,
+    3, 4, 21, 12, 9, 12, 18, 4, 19, 19, 7, 11, 13, 4, 26, 19,
+    8, 12, 18, 14, 20, 5, 7, 5, 12, 7, 21, 4, 20, 20, 18, 2,
+    18, 1, 9, 6, 9, 5, 19, 8, 19, 19, 1, 8, 14, 20, 5, 18,
+    12, 23, 5, 5, 12, 5, 5, 18, 12, 18, 19, 7, 8, 14, 5, 11,
+    5, 4, 14, 16, 13, 13, 1, 0, 7, 0, 0, 6, 7, 5, 5, 1,
+    18, 4, 5, 5, 0, 4, 19, 4, 19, 18, 21, 18, 21, 2, 2, 14,
+    5, 7, 13, 21, 9, 5, 8, 19, 19, 21, 4, 20, 5, 19, 9, 9,
+    19, 9, 14, 2, 31, 5, 18, 19, 5, 15, 5, 14, 20, 13, 14, 12,
+    0, 0, 20, 2, 14, 14, 0, 8, 2, 3, 14, 4, 20, 20, 19, 14,
+    18, 0, 5, 11, 3, 4, 12, 18, 4, 5, 0, 1, 14, 5, 14, 3,
+    13, 14, 4, 9, 0, 4, 12, 0, 5, 4, 9, 19, 0, 14, 19, 7,
+    4, 14, 0, 0, 21, 0,
+};
+
+static const uint16_t hyph_deNodeFirstChild[33159] = {
+    1, 41, 69, 99, 127, 153, 181, 212, 241, 269, 298, 328, 334, 361, 391, 420,
+    449, 481, 509, 510, 543, 573, 602, 632, 656, 679, 705, 731, 759, 786, 787, 788,
+    814, 818, 831, 833, 834, 835, 836, 837, 858, 876, 892, 898, 900, 905, 919, 925,
+    931, 935, 943, 944, 951, 956, 962, 968, 976, 983, 991, 1001, 1009, 1016, 1018, 1023,
+    1024, 1025, 1030, 1033, 1035, 1036, 1047, 1069, 1078, 1097, 1110, 1122, 1135, 1150, 1164, 1166,
+    1184, 1204, 1219, 1244, 1250, 1265, 1292, 1308, 1324, 1350, 1354, 1355, 1358, 1364, 1369, 1370,
+    1370, 1370, 1370, 1370, 1387, 1392, 1392, 1394, 1418, 1419, 1421, 1422, 1434, 1435, 1435, 1443,
+    1443, 1445, 1461, 1462, 1462, 1471, 1485, 1492, 1500, 1500, 1500, 1502, 1503, 1510, 1513, 1516,
+    1529, 1529, 1531, 1532, 1545, 1545, 1545, 1575, 1582, 1582, 1609, 1613, 1615, 1628, 1628, 1628,
+    1632, 1636, 1638, 1642, 1642, 1642, 1642, 1643, 1643, 1643, 1664, 1666, 1667, 1672, 1693, 1693,
+    1695, 1698, 1715, 1715, 1715, 1720, 1720, 1722, 1736, 1738, 1738, 1747, 1763, 1774, 1787, 1787,
+    1789, 1792, 1792, 1802, 1808, 1810, 1823, 1835, 1845, 1855, 1874, 1886, 1897, 1913, 1932, 1932,
+    1945, 1965, 1978, 1997, 2012, 2023, 2023, 2047, 2067, 2083, 2103, 2107, 2110, 2122, 2124, 2130,
+    2131, 2131, 2131, 2131, 2131, 2149, 2151, 2152, 2153, 2172, 2182, 2183, 2183, 2197, 2198, 2199,
+    2208, 2209, 2210, 2218, 2218, 2218, 2226, 2238, 2250, 2260, 2260, 2260, 2261, 2266, 2276, 2276,
+    2280, 2284, 2301, 2305, 2305, 2313, 2334, 2335, 2341, 2350, 2362, 2362, 2362, 2375, 2375, 2400,
+    2415, 2415, 2415, 2423, 2440, 2447, 2459, 2459, 2459, 2461, 2462, 2465, 2468, 2471, 2491, 2493,
+    2493, 2494, 2515, 2519, 2521, 2522, 2538, 2538, 2541, 2557, 2566, 2579, 2599, 2599, 2599, 2619,
+    2631, 2644, 2656, 2657, 2660, 2665, 2669, 2675, 2675, 2679, 2683, 2703, 2713, 2721, 2733, 2752,
+    2761, 2771, 2779, 2787, 2788, 2801, 2820, 2831, 2852, 2870, 2881, 2881, 2902, 2919, 2932, 2935,
+    2942, 2942, 2946, 2955, 2956, 2960, 2960, 2963, 2963, 2971, 2979, 2982, 2990, 2999, 2999, 3017,
+    3020, 3020, 3020, 3039, 3039, 3041, 3043, 3056, 3056, 3057, 3067, 3068, 3074, 3089, 3089, 3089,
+    3097, 3112, 3124, 3136, 3136, 3137, 3138, 3142, 3144, 3147, 3169, 3180, 3185, 3196, 3216, 3223,
+    3232, 3234, 3252, 3252, 3262, 3281, 3293, 3300, 3320, 3326, 3326, 3330, 3343, 3356, 3372, 3375,
+    3375, 3375, 3382, 3393, 3393, 3405, 3416, 3420, 3442, 3447, 3448, 3455, 3475, 3476, 3476, 3476,
+    3495, 3495, 3496, 3503, 3513, 3514, 3532, 3540, 3540, 3540, 3551, 3563, 3572, 3573, 3576, 3579,
+    3579, 3588, 3588, 3594, 3599, 3620, 3622, 3628, 3640, 3666, 3677, 3693, 3695, 3714, 3714, 3727,
+    3729, 3733, 3743, 3763, 3767, 3767, 3772, 3788, 3804, 3825, 3828, 3828, 3834, 3843, 3857, 3857,
+    3863, 3868, 3880, 3895, 3903, 3913, 3919, 3931, 3940, 3954, 3961, 3962, 3970, 3987, 3997, 4015,
+    4022, 4037, 4037, 4062, 4078, 4091, 4101, 4105, 4109, 4115, 4117, 4121, 4123, 4123, 4123, 4123,
+    4123, 4123, 4143, 4143, 4143, 4144, 4162, 4174, 4175, 4197, 4211, 4211, 4212, 4218, 4218, 4218,
+    4235, 4248, 4255, 4265, 4276, 4289, 4289, 4290, 4291, 4291, 4296, 4296, 4298, 4300, 4301, 4324,
+    4335, 4340, 4350, 4376, 4387, 4397, 4407, 4423, 4423, 4436, 4447, 4457, 4473, 4493, 4502, 4502,
+    4518, 4532, 4544, 4559, 4561, 4564, 4564, 4566, 4574, 4574, 4588, 4588, 4588, 4588, 4599, 4604,
+    4626, 4628, 4638, 4642, 4663, 4664, 4666, 4677, 4693, 4693, 4710, 4717, 4720, 4723, 4747, 4762,
+    4762, 4766, 4780, 4809, 4826, 4827, 4829, 4833, 4841, 4853, 4853, 4853, 4859, 4865, 4888, 4892,
+    4897, 4899, 4922, 4922, 4925, 4946, 4967, 4967, 4967, 4972, 4975, 4977, 5000, 5002, 5002, 5014,
+    5029, 5041, 5058, 5059, 5061, 5064, 5072, 5072, 5089, 5097, 5104, 5116, 5124, 5129, 5134, 5148,
+    5159, 5173, 5183, 5191, 5191, 5203, 5221, 5238, 5258, 5264, 5274, 5274, 5297, 5310, 5326, 5328,
+    5329, 5329, 5332, 5333, 5337, 5338, 5341, 5343, 5343, 5354, 5354, 5354, 5354, 5372, 5372, 5372,
+    5372, 5385, 5385, 5387, 5388, 5388, 5395, 5395, 5399, 5404, 5404, 5406, 5406, 5406, 5406, 5407,
+    5407, 5418, 5419, 5419, 5419, 5433, 5433, 5435, 5445, 5445, 5445, 5445, 5446, 5451, 5451, 5452,
+    5456, 5457, 5464, 5464, 5464, 5469, 5472, 5476, 5486, 5486, 5489, 5490, 5498, 5498, 5498, 5498,
+    5508, 5508, 5509, 5511, 5511, 5511, 5514, 5515, 5515, 5515, 5515, 5526, 5529, 5529, 5529, 5531,
+    5531, 5531, 5542, 5542, 5543, 5544, 5552, 5552, 5554, 5555, 5555, 5555, 5558, 5564, 5567, 5570,
+    5576, 5585, 5585, 5590, 5600, 5605, 5606, 5606, 5606, 5606, 5607, 5608, 5624, 5626, 5626, 5629,
+    5646, 5647, 5648, 5650, 5662, 5662, 5662, 5664, 5665, 5665, 5677, 5677, 5677, 5677, 5682, 5689,
+    5708, 5708, 5716, 5718, 5722, 5729, 5733, 5736, 5736, 5736, 5736, 5736, 5748, 5748, 5749, 5749,
+    5754, 5754, 5754, 5755, 5755, 5755, 5756, 5756, 5756, 5757, 5759, 5761, 5763, 5763, 5763, 5763,
+    5763, 5763, 5763, 5763, 5763, 5763, 5765, 5768, 5773, 5774, 5781, 5790, 5801, 5803, 5803, 5806,
+    5814, 5822, 5833, 5835, 5839, 5839, 5857, 5863, 5870, 5883, 5883, 5883, 5883, 5884, 5884, 5884,
+    5884, 5884, 5884, 5884, 5884, 5885, 5885, 5886, 5886, 5886, 5886, 5886, 5886, 5886, 5886, 5886,
+    5886, 5886, 5886, 5886, 5886, 5887, 5891, 5893, 5897, 5897, 5899, 5902, 5906, 5908, 5912, 5926,
+    5927, 5931, 5932, 5935, 5950, 5958, 5963, 5963, 5963, 5964, 5966, 5973, 5975, 5982, 5984, 5993,
+    5997, 6009, 6009, 6015, 6019, 6026, 6030, 6040, 6045, 6052, 6052, 6052, 6052, 6058, 6059, 6059,
+    6060, 6063, 6064, 6065, 6070, 6072, 6081, 6083, 6089, 6091, 6095, 6100, 6100, 6102, 6105, 6107,
+    6109, 6110, 6111, 6112, 6114, 6117, 6125, 6126, 6131, 6132, 6133, 6134, 6135, 6136, 6142, 6144,
+    6149, 6150, 6154, 6161, 6164, 6165, 6168, 6169, 6171, 6174, 6175, 6176, 6176, 6177, 6180, 6180,
+    6187, 6188, 6189, 6189, 6191, 6195, 6198, 6201, 6201, 6203, 6209, 6210, 6211, 6213, 6214, 6215,
+    6217, 6221, 6222, 6223, 6226, 6227, 6227, 6228, 6231, 6234, 6237, 6240, 6242, 6247, 6247, 6250,
+    6255, 6255, 6256, 6258, 6261, 6264, 6265, 6266, 6267, 6268, 6270, 6271, 6272, 6275, 6277, 6277,
+    6278, 6280, 6282, 6282, 6282, 6284, 6285, 6285, 6290, 6296, 6298, 6303, 6306, 6307, 6308, 6310,
+    6314, 6315, 6321, 6322, 6324, 6325, 6326, 6328, 6330, 6331, 6335, 6343, 6343, 6347, 6351, 6353,
+    6355, 6356, 6356, 6357, 6358, 6361, 6367, 6373, 6375, 6376, 6378, 6380, 6385, 6386, 6387, 6388,
+    6388, 6389, 6390, 6392, 6394, 6397, 6398, 6398, 6399, 6401, 6401, 6402, 6403, 6404, 6405, 6406,
+    6407, 6408, 6409, 6409, 6417, 6417, 6421, 6421, 6425, 6427, 6427, 6437, 6437, 6438, 6438, 6443,
+    6443, 6450, 6450, 6454, 6458, 6462, 6464, 6466, 6466, 6467, 6467, 6469, 6469, 6469, 6469, 6469,
+    6472, 6490, 6490, 6495, 6495, 6496, 6496, 6496, 6507, 6507, 6507, 6516, 6516, 6516, 6518, 6518,
+    6519, 6521, 6523, 6523, 6523, 6525, 6527, 6529, 6529, 6529, 6529, 6530, 6530, 6530, 6530, 6535,
+    6535, 6535, 6535, 6537, 6540, 6540, 6540, 6544, 6547, 6550, 6553, 6554, 6557, 6563, 6568, 6575,
+    6576, 6577, 6578, 6578, 6582, 6586, 6592, 6593, 6595, 6598, 6598, 6602, 6606, 6610, 6611, 6612,
+    6612, 6614, 6618, 6619, 6625, 6627, 6631, 6633, 6637, 6641, 6641, 6641, 6641, 6641, 6641, 6641,
+    6642, 6643, 6644, 6645, 6646, 6646, 6648, 6653, 6657, 6658, 6661, 6661, 6664, 6665, 6666, 6666,
+    6674, 6674, 6674, 6674, 6679, 6681, 6682, 6683, 6684, 6684, 6686, 6687, 6696, 6700, 6701, 6701,
+    6701, 6714, 6721, 6726, 6740, 6741, 6745, 6747, 6752, 6757, 6759, 6765, 6768, 6769, 6774, 6783,
+    6790, 6790, 6793, 6796, 6797, 6797, 6803, 6810, 6810, 6814, 6814, 6814, 6821, 6822, 6827, 6834,
+    6843, 6844, 6844, 6844, 6856, 6858, 6859, 6865, 6874, 6885, 6895, 6895, 6903, 6903, 6913, 6914,
+    6916, 6921, 6931, 6932, 6933, 6940, 6950, 6951, 6952, 6968, 6969, 6969, 6969, 6969, 6969, 6970,
+    6970, 6971, 6974, 6974, 6974, 6976, 6979, 6980, 6980, 6983, 6983, 6984, 6985, 6986, 6987, 6987,
+    6987, 6987, 6987, 6997, 7007, 7008, 7013, 7024, 7026, 7032, 7032, 7040, 7046, 7047, 7053, 7056,
+    7065, 7066, 7069, 7073, 7082, 7084, 7084, 7085, 7085, 7093, 7093, 7093, 7093, 7102, 7104, 7114,
+    7115, 7119, 7120, 7127, 7131, 7138, 7146, 7148, 7149, 7151, 7152, 7152, 7152, 7163, 7163, 7163,
+    7176, 7182, 7186, 7188, 7191, 7194, 7200, 7207, 7215, 7217, 7222, 7223, 7223, 7223, 7223, 7227,
+    7227, 7229, 7232, 7241, 7246, 7246, 7248, 7248, 7249, 7252, 7259, 7265, 7265, 7266, 7269, 7285,
+    7293, 7293, 7294, 7294, 7294, 7296, 7297, 7300, 7301, 7301, 7301, 7302, 7304, 7304, 7306, 7308,
+    7309, 7310, 7311, 7311, 7311, 7313, 7313, 7313, 7313, 7316, 7317, 7317, 7323, 7325, 7330, 7330,
+    7331, 7332, 7337, 7342, 7344, 7357, 7364, 7369, 7371, 7379, 7379, 7380, 7382, 7384, 7386, 7386,
+    7386, 7387, 7388, 7388, 7390, 7391, 7392, 7394, 7398, 7399, 7400, 7402, 7412, 7412, 7422, 7424,
+    7434, 7434, 7435, 7450, 7458, 7460, 7462, 7462, 7462, 7462, 7462, 7463, 7463, 7466, 7466, 7467,
+    7467, 7471, 7474, 7479, 7480, 7487, 7487, 7488, 7492, 7497, 7497, 7498, 7498, 7505, 7516, 7522,
+    7524, 7528, 7531, 7531, 7532, 7533, 7534, 7536, 7537, 7537, 7538, 7539, 7541, 7542, 7544, 7550,
+    7552, 7552, 7561, 7564, 7568, 7569, 7570, 7570, 7576, 7590, 7597, 7603, 7609, 7611, 7611, 7612,
+    7616, 7619, 7626, 7628, 7630, 7630, 7634, 7637, 7637, 7646, 7647, 7649, 7651, 7651, 7652, 7652,
+    7652, 7653, 7654, 7654, 7654, 7655, 7655, 7655, 7656, 7660, 7664, 7670, 7675, 7675, 7675, 7676,
+    7676, 7676, 7676, 7676, 7677, 7677, 7678, 7678, 7678, 7679, 7679, 7679, 7680, 7681, 7681, 7681,
+    7681, 7681, 7684, 7684, 7685, 7686, 7690, 7692, 7693, 7693, 7693, 7694, 7694, 7694, 7695, 7696,
+    7696, 7697, 7697, 7698, 7700, 7700, 7702, 7703, 7704, 7704, 7704, 7716, 7716, 7716, 7716, 7729,
+    7729, 7729, 7729, 7735, 7735, 7735, 7737, 7737, 7738, 7744, 7744, 7749, 7751, 7752, 7758, 7758,
+    7758, 7758, 7758, 7758, 7761, 7761, 7763, 7763, 7764, 7764, 7765, 7766, 7768, 7768, 7768, 7768,
+    7779, 7779, 7779, 7779, 7787, 7787, 7787, 7787, 7790, 7790, 7790, 7790, 7790, 7791, 7791, 7791,
+    7795, 7797, 7801, 7801, 7801, 7801, 7801, 7801, 7801, 7801, 7803, 7805, 7806, 7807, 7807, 7807,
+    7807, 7808, 7810, 7811, 7812, 7813, 7816, 7817, 7818, 7819, 7823, 7824, 7826, 7828, 7829, 7829,
+    7829, 7829, 7829, 7829, 7831, 7832, 7833, 7833, 7833, 7833, 7834, 7834, 7834, 7834, 7840, 7842,
+    7844, 7846, 7848, 7850, 7854, 7855, 7862, 7866, 7881, 7884, 7884, 7897, 7901, 7907, 7915, 7915,
+    7915, 7916, 7917, 7917, 7917, 7917, 7917, 7917, 7917, 7921, 7922, 7925, 7927, 7927, 7930, 7931,
+    7935, 7943, 7944, 7954, 7960, 7972, 7975, 7979, 7996, 8007, 8011, 8015, 8016, 8018, 8019, 8023,
+    8024, 8024, 8024, 8027, 8030, 8033, 8038, 8038, 8040, 8041, 8042, 8044, 8055, 8059, 8060, 8065,
+    8071, 8079, 8079, 8079, 8081, 8082, 8083, 8083, 8083, 8083, 8084, 8084, 8085, 8086, 8086, 8088,
+    8092, 8094, 8096, 8104, 8110, 8113, 8114, 8115, 8115, 8116, 8117, 8127, 8144, 8144, 8157, 8169,
+    8174, 8178, 8179, 8182, 8188, 8188, 8191, 8202, 8204, 8207, 8209, 8210, 8213, 8221, 8221, 8228,
+    8230, 8231, 8233, 8233, 8240, 8241, 8245, 8247, 8248, 8250, 8250, 8252, 8252, 8252, 8252, 8254,
+    8255, 8256, 8258, 8258, 8258, 8259, 8260, 8271, 8281, 8282, 8289, 8290, 8291, 8292, 8292, 8292,
+    8293, 8293, 8293, 8293, 8294, 8296, 8296, 8296, 8297, 8298, 8298, 8298, 8298, 8299, 8299, 8299,
+    8300, 8301, 8302, 8307, 8307, 8309, 8311, 8312, 8318, 8321, 8325, 8330, 8334, 8339, 8343, 8343,
+    8345, 8356, 8356, 8356, 8361, 8363, 8364, 8369, 8371, 8372, 8373, 8374, 8374, 8374, 8388, 8389,
+    8392, 8392, 8392, 8392, 8392, 8392, 8392, 8393, 8398, 8402, 8402, 8403, 8410, 8411, 8412, 8412,
+    8412, 8413, 8416, 8418, 8418, 8420, 8420, 8422, 8424, 8428, 8435, 8435, 8436, 8447, 8451, 8457,
+    8457, 8458, 8458, 8462, 8469, 8472, 8475, 8478, 8478, 8482, 8484, 8486, 8487, 8488, 8488, 8490,
+    8490, 8495, 8495, 8497, 8499, 8500, 8502, 8509, 8510, 8512, 8518, 8525, 8526, 8531, 8533, 8535,
+    8537, 8543, 8545, 8547, 8549, 8549, 8549, 8549, 8550, 8551, 8551, 8554, 8556, 8561, 8566, 8569,
+    8580, 8581, 8584, 8593, 8599, 8615, 8615, 8616, 8619, 8630, 8641, 8642, 8644, 8644, 8644, 8648,
+    8648, 8648, 8649, 8649, 8650, 8654, 8655, 8655, 8655, 8655, 8669, 8672, 8687, 8691, 8693, 8700,
+    8701, 8708, 8709, 8709, 8717, 8717, 8721, 8724, 8729, 8730, 8734, 8734, 8735, 8735, 8741, 8744,
+    8746, 8753, 8762, 8764, 8768, 8770, 8775, 8775, 8777, 8779, 8779, 8796, 8798, 8805, 8821, 8823,
+    8831, 8845, 8848, 8851, 8862, 8869, 8884, 8887, 8888, 8888, 8892, 8893, 8894, 8895, 8898, 8899,
+    8900, 8900, 8900, 8900, 8902, 8902, 8910, 8910, 8911, 8918, 8921, 8922, 8923, 8925, 8926, 8926,
+    8933, 8934, 8937, 8941, 8941, 8942, 8943, 8944, 8964, 8967, 8968, 8975, 8991, 8995, 9001, 9004,
+    9015, 9022, 9025, 9028, 9031, 9049, 9049, 9053, 9062, 9068, 9075, 9076, 9077, 9083, 9087, 9088,
+    9103, 9104, 9106, 9114, 9114, 9116, 9119, 9124, 9124, 9124, 9127, 9134, 9134, 9143, 9154, 9158,
+    9158, 9158, 9159, 9159, 9167, 9167, 9174, 9174, 9181, 9185, 9188, 9191, 9196, 9202, 9204, 9205,
+    9206, 9207, 9208, 9208, 9208, 9208, 9209, 9211, 9214, 9216, 9221, 9221, 9223, 9224, 9227, 9234,
+    9239, 9239, 9240, 9244, 9248, 9252, 9252, 9255, 9258, 9259, 9260, 9261, 9264, 9267, 9268, 9268,
+    9271, 9271, 9271, 9275, 9279, 9279, 9279, 9279, 9285, 9286, 9286, 9287, 9287, 9287, 9288, 9289,
+    9290, 9290, 9290, 9293, 9302, 9303, 9306, 9307, 9309, 9310, 9314, 9320, 9321, 9333, 9333, 9339,
+    9342, 9345, 9348, 9348, 9349, 9349, 9350, 9351, 9351, 9352, 9352, 9353, 9354, 9355, 9357, 9359,
+    9362, 9362, 9369, 9372, 9378, 9379, 9395, 9397, 9400, 9402, 9402, 9402, 9402, 9408, 9415, 9415,
+    9418, 9423, 9424, 9427, 9430, 9430, 9431, 9433, 9433, 9435, 9436, 9438, 9444, 9450, 9451, 9458,
+    9459, 9462, 9468, 9471, 9472, 9473, 9473, 9474, 9474, 9480, 9487, 9490, 9496, 9500, 9504, 9506,
+    9507, 9509, 9510, 9512, 9512, 9514, 9521, 9521, 9528, 9529, 9529, 9538, 9548, 9555, 9561, 9562,
+    9564, 9565, 9565, 9570, 9574, 9579, 9580, 9581, 9584, 9590, 9590, 9599, 9601, 9601, 9602, 9610,
+    9620, 9621, 9623, 9626, 9631, 9636, 9638, 9639, 9640, 9641, 9641, 9641, 9641, 9641, 9642, 9642,
+    9650, 9653, 9654, 9654, 9655, 9655, 9655, 9656, 9657, 9657, 9657, 9657, 9658, 9659, 9659, 9661,
+    9662, 9663, 9664, 9664, 9665, 9665, 9665, 9665, 9666, 9666, 9667, 9667, 9667, 9667, 9678, 9678,
+    9682, 9682, 9683, 9684, 9686, 9692, 9696, 9710, 9712, 9712, 9723, 9729, 9733, 9740, 9741, 9741,
+    9742, 9743, 9748, 9753, 9755, 9755, 9755, 9755, 9755, 9755, 9755, 9759, 9760, 9760, 9762, 9767,
+    9769, 9770, 9778, 9779, 9789, 9793, 9804, 9806, 9806, 9819, 9828, 9833, 9835, 9836, 9836, 9837,
+    9838, 9839, 9841, 9841, 9841, 9841, 9841, 9842, 9843, 9844, 9844, 9844, 9845, 9845, 9845, 9846,
+    9854, 9855, 9856, 9857, 9858, 9860, 9868, 9870, 9871, 9873, 9874, 9874, 9882, 9882, 9895, 9908,
+    9917, 9917, 9921, 9921, 9921, 9922, 9925, 9926, 9926, 9931, 9931, 9931, 9931, 9934, 9934, 9934,
+    9934, 9938, 9938, 9938, 9938, 9941, 9941, 9941, 9941, 9941, 9942, 9942, 9942, 9942, 9942, 9942,
+    9942, 9943, 9946, 9946, 9946, 9947, 9948, 9950, 9953, 9953, 9957, 9960, 9963, 9965, 9965, 9965,
+    9974, 9988, 9995, 10002, 10011, 10014, 10015, 10017, 10029, 10033, 10043, 10044, 10045, 10050, 10051, 10051,
+    10051, 10055, 10061, 10063, 10063, 10073, 10073, 10073, 10074, 10075, 10076, 10077, 10077, 10077, 10077, 10077,
+    10081, 10081, 10082, 10084, 10084, 10084, 10086, 10088, 10096, 10100, 10105, 10109, 10109, 10110, 10111, 10111,
+    10113, 10113, 10113, 10113, 10113, 10113, 10113, 10113, 10121, 10123, 10127, 10127, 10131, 10132, 10133, 10134,
+    10134, 10136, 10145, 10147, 10161, 10165, 10174, 10179, 10184, 10190, 10191, 10191, 10192, 10193, 10194, 10194,
+    10198, 10200, 10202, 10206, 10215, 10216, 10217, 10227, 10228, 10237, 10242, 10252, 10254, 10258, 10273, 10278,
+    10284, 10287, 10289, 10289, 10291, 10292, 10293, 10294, 10295, 10296, 10297, 10297, 10300, 10302, 10303, 10305,
+    10306, 10307, 10310, 10314, 10324, 10327, 10330, 10337, 10341, 10346, 10347, 10348, 10349, 10349, 10356, 10356,
+    10356, 10365, 10365, 10372, 10372, 10372, 10377, 10383, 10383, 10386, 10386, 10389, 10390, 10391, 10396, 10405,
+    10409, 10411, 10411, 10413, 10414, 10417, 10418, 10424, 10424, 10434, 10435, 10436, 10441, 10441, 10442, 10446,
+    10447, 10449, 10449, 10450, 10451, 10453, 10456, 10456, 10456, 10464, 10464, 10474, 10475, 10483, 10485, 10486,
+    10492, 10496, 10500, 10500, 10500, 10500, 10500, 10501, 10511, 10511, 10511, 10511, 10524, 10524, 10529, 10529,
+    10529, 10529, 10537, 10537, 10548, 10554, 10557, 10557, 10557, 10558, 10559, 10560, 10568, 10570, 10580, 10581,
+    10585, 10586, 10589, 10595, 10595, 10603, 10604, 10606, 10618, 10633, 10635, 10639, 10640, 10646, 10653, 10661,
+    10662, 10665, 10665, 10666, 10666, 10672, 10672, 10673, 10677, 10681, 10689, 10692, 10699, 10700, 10702, 10705,
+    10711, 10712, 10713, 10715, 10716, 10717, 10717, 10717, 10718, 10718, 10718, 10718, 10719, 10719, 10720, 10721,
+    10722, 10723, 10724, 10726, 10726, 10727, 10728, 10729, 10732, 10732, 10733, 10733, 10733, 10733, 10734, 10736,
+    10737, 10738, 10738, 10738, 10741, 10764, 10766, 10775, 10775, 10776, 10776, 10779, 10785, 10790, 10791, 10791,
+    10793, 10794, 10798, 10800, 10803, 10803, 10807, 10809, 10811, 10811, 10811, 10811, 10812, 10825, 10826, 10829,
+    10830, 10830, 10836, 10844, 10847, 10848, 10850, 10851, 10854, 10854, 10854, 10854, 10854, 10854, 10854, 10858,
+    10860, 10863, 10863, 10871, 10875, 10877, 10878, 10887, 10888, 10912, 10912, 10925, 10931, 10940, 10942, 10943,
+    10943, 10946, 10951, 10955, 10959, 10960, 10964, 10970, 10970, 10971, 10975, 10975, 10981, 10982, 10984, 10988,
+    10989, 10992, 10998, 10999, 11000, 11005, 11005, 11005, 11005, 11005, 11006, 11006, 11006, 11006, 11006, 11006,
+    11006, 11006, 11007, 11008, 11008, 11016, 11025, 11029, 11033, 11034, 11038, 11042, 11045, 11048, 11051, 11053,
+    11054, 11054, 11062, 11063, 11064, 11069, 11077, 11081, 11082, 11082, 11087, 11090, 11094, 11101, 11103, 11104,
+    11108, 11108, 11111, 11112, 11112, 11119, 11120, 11130, 11133, 11136, 11138, 11140, 11141, 11145, 11147, 11147,
+    11147, 11157, 11167, 11179, 11181, 11186, 11188, 11194, 11197, 11198, 11203, 11209, 11210, 11219, 11226, 11228,
+    11230, 11230, 11234, 11237, 11238, 11238, 11238, 11238, 11239, 11239, 11240, 11241, 11244, 11253, 11253, 11255,
+    11262, 11269, 11272, 11272, 11272, 11272, 11273, 11273, 11274, 11275, 11276, 11276, 11277, 11282, 11282, 11286,
+    11288, 11288, 11292, 11293, 11294, 11297, 11298, 11299, 11301, 11303, 11304, 11310, 11312, 11313, 11314, 11316,
+    11320, 11321, 11323, 11324, 11324, 11324, 11324, 11330, 11330, 11333, 11343, 11343, 11343, 11347, 11349, 11350,
+    11352, 11359, 11364, 11370, 11378, 11380, 11382, 11382, 11390, 11399, 11401, 11409, 11410, 11415, 11420, 11423,
+    11428, 11433, 11435, 11438, 11438, 11440, 11440, 11441, 11445, 11453, 11454, 11455, 11455, 11457, 11457, 11457,
+    11458, 11458, 11458, 11463, 11467, 11468, 11469, 11470, 11471, 11472, 11473, 11473, 11474, 11474, 11474, 11477,
+    11481, 11481, 11481, 11483, 11483, 11483, 11484, 11485, 11487, 11488, 11490, 11490, 11491, 11491, 11492, 11492,
+    11493, 11501, 11501, 11501, 11501, 11501, 11501, 11501, 11502, 11503, 11503, 11504, 11506, 11507, 11508, 11509,
+    11510, 11510, 11510, 11510, 11512, 11514, 11515, 11516, 11517, 11529, 11529, 11534, 11537, 11539, 11540, 11541,
+    11544, 11552, 11553, 11568, 11568, 11582, 11589, 11594, 11597, 11597, 11598, 11599, 11599, 11600, 11600, 11601,
+    11603, 11605, 11607, 11614, 11624, 11626, 11638, 11638, 11639, 11656, 11660, 11664, 11666, 11667, 11667, 11667,
+    11668, 11669, 11670, 11670, 11672, 11672, 11676, 11679, 11681, 11681, 11684, 11694, 11696, 11696, 11700, 11701,
+    11701, 11702, 11702, 11708, 11716, 11727, 11733, 11739, 11739, 11741, 11745, 11746, 11747, 11751, 11757, 11758,
+    11762, 11764, 11765, 11768, 11771, 11773, 11775, 11776, 11779, 11781, 11786, 11792, 11802, 11806, 11811, 11812,
+    11813, 11813, 11820, 11831, 11831, 11836, 11845, 11847, 11851, 11852, 11860, 11861, 11868, 11869, 11872, 11873,
+    11873, 11876, 11882, 11882, 11890, 11891, 11892, 11893, 11893, 11901, 11907, 11907, 11913, 11914, 11919, 11925,
+    11925, 11929, 11929, 11931, 11931, 11932, 11932, 11933, 11933, 11934, 11939, 11943, 11949, 11950, 11957, 11962,
+    11963, 11963, 11964, 11965, 11966, 11967, 11969, 11969, 11969, 11969, 11970, 11971, 11971, 11972, 11990, 11993,
+    12002, 12009, 12017, 12018, 12018, 12024, 12027, 12035, 12050, 12050, 12054, 12064, 12077, 12088, 12094, 12096,
+    12097, 12097, 12101, 12102, 12106, 12108, 12115, 12116, 12117, 12125, 12128, 12129, 12130, 12130, 12139, 12139,
+    12139, 12139, 12152, 12161, 12163, 12167, 12172, 12174, 12177, 12179, 12180, 12183, 12183, 12186, 12189, 12190,
+    12191, 12193, 12199, 12203, 12214, 12217, 12221, 12228, 12239, 12241, 12246, 12264, 12275, 12280, 12287, 12288,
+    12289, 12290, 12295, 12295, 12299, 12303, 12306, 12308, 12310, 12310, 12313, 12313, 12314, 12314, 12314, 12316,
+    12317, 12317, 12318, 12322, 12323, 12326, 12329, 12335, 12338, 12343, 12344, 12348, 12362, 12363, 12365, 12374,
+    12381, 12381, 12384, 12385, 12388, 12392, 12393, 12396, 12397, 12398, 12399, 12400, 12403, 12403, 12403, 12410,
+    12410, 12411, 12411, 12422, 12422, 12422, 12425, 12425, 12425, 12425, 12425, 12432, 12436, 12439, 12441, 12441,
+    12441, 12443, 12452, 12453, 12453, 12453, 12458, 12460, 12462, 12463, 12466, 12466, 12468, 12469, 12470, 12470,
+    12471, 12472, 12473, 12473, 12473, 12474, 12481, 12482, 12482, 12483, 12487, 12489, 12490, 12493, 12495, 12497,
+    12499, 12499, 12502, 12512, 12517, 12521, 12522, 12522, 12522, 12523, 12523, 12527, 12527, 12527, 12528, 12529,
+    12531, 12532, 12532, 12540, 12541, 12547, 12548, 12550, 12553, 12555, 12561, 12561, 12569, 12572, 12574, 12575,
+    12584, 12585, 12593, 12596, 12601, 12605, 12611, 12615, 12615, 12619, 12620, 12623, 12623, 12624, 12626, 12627,
+    12628, 12632, 12640, 12640, 12642, 12643, 12657, 12665, 12665, 12672, 12677, 12683, 12683, 12683, 12683, 12683,
+    12683, 12683, 12684, 12685, 12686, 12686, 12686, 12692, 12695, 12697, 12697, 12698, 12698, 12700, 12701, 12703,
+    12705, 12705, 12705, 12705, 12706, 12707, 12708, 12709, 12709, 12711, 12712, 12712, 12717, 12717, 12717, 12718,
+    12718, 12719, 12720, 12720, 12720, 12720, 12722, 12722, 12722, 12723, 12724, 12724, 12726, 12726, 12726, 12738,
+    12741, 12747, 12747, 12747, 12754, 12756, 12757, 12759, 12768, 12770, 12787, 12788, 12788, 12800, 12806, 12814,
+    12820, 12821, 12821, 12823, 12824, 12824, 12826, 12827, 12827, 12830, 12833, 12834, 12835, 12835, 12836, 12837,
+    12837, 12839, 12839, 12840, 12843, 12844, 12846, 12848, 12853, 12863, 12866, 12875, 12876, 12878, 12889, 12896,
+    12901, 12901, 12902, 12902, 12903, 12905, 12906, 12909, 12913, 12919, 12919, 12920, 12920, 12926, 12931, 12934,
+    12944, 12945, 12945, 12950, 12957, 12966, 12966, 12966, 12966, 12966, 12966, 12966, 12966, 12966, 12966, 12966,
+    12974, 12982, 12983, 12988, 12989, 12994, 12995, 12998, 12999, 13000, 13001, 13004, 13006, 13007, 13009, 13010,
+    13011, 13012, 13013, 13014, 13021, 13021, 13024, 13029, 13030, 13033, 13034, 13034, 13034, 13035, 13037, 13040,
+    13042, 13044, 13046, 13048, 13048, 13054, 13056, 13064, 13065, 13070, 13070, 13077, 13078, 13078, 13079, 13079,
+    13084, 13092, 13092, 13098, 13099, 13101, 13103, 13108, 13110, 13110, 13112, 13112, 13112, 13113, 13113, 13117,
+    13120, 13127, 13128, 13133, 13135, 13136, 13137, 13139, 13139, 13140, 13140, 13140, 13142, 13143, 13143, 13143,
+    13143, 13145, 13146, 13147, 13147, 13148, 13148, 13148, 13148, 13148, 13149, 13149, 13151, 13152, 13152, 13153,
+    13153, 13162, 13163, 13170, 13170, 13171, 13176, 13179, 13183, 13188, 13203, 13211, 13231, 13232, 13237, 13237,
+    13249, 13257, 13263, 13267, 13269, 13272, 13272, 13274, 13276, 13278, 13278, 13279, 13279, 13290, 13290, 13301,
+    13303, 13311, 13317, 13319, 13322, 13323, 13324, 13324, 13325, 13325, 13329, 13332, 13335, 13336, 13340, 13343,
+    13347, 13350, 13358, 13361, 13369, 13375, 13396, 13400, 13406, 13428, 13439, 13446, 13452, 13454, 13454, 13454,
+    13454, 13454, 13454, 13457, 13461, 13461, 13462, 13463, 13464, 13464, 13464, 13468, 13468, 13468, 13475, 13475,
+    13480, 13481, 13482, 13483, 13487, 13491, 13494, 13496, 13499, 13500, 13502, 13503, 13504, 13504, 13505, 13506,
+    13507, 13508, 13509, 13514, 13520, 13522, 13528, 13529, 13535, 13537, 13538, 13553, 13557, 13557, 13559, 13567,
+    13573, 13573, 13573, 13583, 13589, 13592, 13596, 13599, 13602, 13606, 13611, 13617, 13620, 13622, 13623, 13624,
+    13625, 13627, 13627, 13628, 13628, 13628, 13634, 13642, 13642, 13642, 13643, 13647, 13651, 13653, 13656, 13657,
+    13657, 13658, 13662, 13663, 13664, 13665, 13667, 13668, 13669, 13671, 13675, 13677, 13682, 13686, 13698, 13705,
+    13712, 13712, 13712, 13712, 13714, 13714, 13715, 13716, 13717, 13720, 13721, 13722, 13723, 13735, 13737, 13748,
+    13749, 13755, 13760, 13761, 13767, 13773, 13774, 13774, 13782, 13787, 13787, 13788, 13790, 13796, 13809, 13810,
+    13815, 13818, 13819, 13821, 13822, 13825, 13830, 13833, 13833, 13836, 13836, 13838, 13838, 13840, 13841, 13841,
+    13842, 13843, 13844, 13844, 13846, 13846, 13848, 13849, 13861, 13871, 13871, 13871, 13875, 13879, 13882, 13882,
+    13882, 13882, 13883, 13883, 13884, 13884, 13884, 13884, 13884, 13884, 13884, 13892, 13898, 13901, 13902, 13904,
+    13904, 13910, 13912, 13913, 13913, 13913, 13913, 13913, 13913, 13918, 13918, 13918, 13918, 13919, 13919, 13920,
+    13923, 13925, 13925, 13925, 13925, 13925, 13925, 13925, 13925, 13925, 13926, 13926, 13926, 13927, 13928, 13930,
+    13931, 13933, 13934, 13935, 13935, 13935, 13936, 13936, 13936, 13936, 13940, 13940, 13949, 13950, 13950, 13956,
+    13957, 13959, 13963, 13966, 13967, 13967, 13967, 13968, 13968, 13968, 13968, 13980, 13980, 13985, 13985, 13985,
+    13986, 13987, 13993, 13998, 13998, 14000, 14001, 14001, 14001, 14001, 14002, 14002, 14003, 14003, 14004, 14007,
+    14012, 14021, 14030, 14032, 14035, 14035, 14037, 14042, 14045, 14046, 14046, 14046, 14050, 14054, 14055, 14055,
+    14057, 14059, 14059, 14061, 14063, 14064, 14070, 14070, 14076, 14077, 14083, 14085, 14090, 14090, 14090, 14090,
+    14090, 14090, 14091, 14092, 14092, 14092, 14093, 14093, 14096, 14098, 14099, 14104, 14105, 14106, 14108, 14109,
+    14111, 14111, 14111, 14117, 14118, 14124, 14131, 14136, 14139, 14144, 14147, 14150, 14153, 14155, 14156, 14157,
+    14157, 14162, 14163, 14163, 14172, 14179, 14183, 14185, 14186, 14188, 14189, 14190, 14190, 14192, 14200, 14200,
+    14204, 14214, 14214, 14218, 14223, 14224, 14226, 14228, 14234, 14240, 14244, 14247, 14247, 14247, 14248, 14249,
+    14249, 14252, 14253, 14253, 14254, 14257, 14263, 14263, 14267, 14276, 14283, 14284, 14287, 14290, 14290, 14291,
+    14296, 14296, 14298, 14298, 14299, 14299, 14299, 14314, 14315, 14317, 14329, 14341, 14343, 14350, 14350, 14358,
+    14361, 14366, 14370, 14377, 14377, 14377, 14380, 14385, 14393, 14398, 14399, 14400, 14402, 14402, 14402, 14405,
+    14408, 14414, 14417, 14417, 14422, 14423, 14424, 14425, 14430, 14437, 14445, 14446, 14446, 14447, 14447, 14455,
+    14462, 14465, 14469, 14470, 14474, 14479, 14485, 14491, 14492, 14492, 14492, 14492, 14494, 14496, 14496, 14497,
+    14498, 14498, 14499, 14503, 14504, 14507, 14507, 14510, 14511, 14511, 14513, 14513, 14513, 14513, 14513, 14513,
+    14513, 14513, 14513, 14513, 14513, 14513, 14516, 14517, 14518, 14518, 14521, 14522, 14522, 14522, 14522, 14524,
+    14525, 14526, 14527, 14529, 14535, 14536, 14549, 14552, 14552, 14567, 14571, 14577, 14580, 14580, 14580, 14580,
+    14580, 14580, 14582, 14582, 14583, 14584, 14586, 14587, 14587, 14591, 14593, 14603, 14603, 14610, 14612, 14623,
+    14627, 14628, 14628, 14628, 14637, 14645, 14645, 14648, 14652, 14654, 14656, 14660, 14660, 14661, 14663, 14664,
+    14664, 14668, 14668, 14668, 14671, 14671, 14671, 14673, 14673, 14673, 14673, 14673, 14675, 14676, 14676, 14677,
+    14679, 14679, 14679, 14681, 14681, 14681, 14687, 14688, 14688, 14690, 14691, 14694, 14694, 14698, 14701, 14702,
+    14704, 14705, 14709, 14710, 14710, 14710, 14715, 14721, 14724, 14725, 14725, 14725, 14726, 14726, 14727, 14727,
+    14729, 14734, 14735, 14737, 14738, 14742, 14746, 14748, 14755, 14756, 14756, 14756, 14760, 14765, 14766, 14766,
+    14767, 14770, 14771, 14771, 14776, 14779, 14780, 14781, 14781, 14783, 14793, 14799, 14806, 14814, 14814, 14818,
+    14818, 14819, 14820, 14821, 14822, 14822, 14831, 14832, 14833, 14833, 14836, 14845, 14845, 14846, 14850, 14850,
+    14852, 14856, 14856, 14856, 14856, 14856, 14856, 14856, 14857, 14857, 14859, 14862, 14863, 14867, 14869, 14871,
+    14873, 14874, 14875, 14875, 14876, 14877, 14877, 14877, 14882, 14883, 14883, 14883, 14884, 14887, 14887, 14892,
+    14909, 14913, 14923, 14924, 14928, 14934, 14941, 14944, 14952, 14966, 14973, 14992, 14996, 14996, 15005, 15011,
+    15020, 15030, 15032, 15032, 15032, 15039, 15039, 15045, 15048, 15052, 15053, 15055, 15060, 15060, 15061, 15062,
+    15063, 15071, 15071, 15071, 15071, 15078, 15087, 15090, 15093, 15097, 15100, 15102, 15103, 15104, 15104, 15104,
+    15108, 15112, 15114, 15120, 15120, 15124, 15127, 15133, 15144, 15146, 15157, 15165, 15180, 15183, 15188, 15207,
+    15216, 15219, 15225, 15227, 15230, 15230, 15231, 15231, 15231, 15232, 15234, 15235, 15236, 15241, 15244, 15247,
+    15250, 15252, 15252, 15253, 15260, 15260, 15266, 15268, 15273, 15277, 15282, 15287, 15293, 15294, 15294, 15297,
+    15303, 15303, 15307, 15307, 15308, 15308, 15309, 15309, 15312, 15313, 15316, 15319, 15326, 15334, 15339, 15339,
+    15344, 15349, 15364, 15365, 15365, 15375, 15380, 15380, 15387, 15392, 15393, 15397, 15398, 15403, 15406, 15411,
+    15417, 15420, 15421, 15421, 15422, 15428, 15432, 15432, 15434, 15435, 15438, 15438, 15438, 15438, 15438, 15439,
+    15448, 15448, 15455, 15457, 15460, 15460, 15462, 15462, 15463, 15464, 15473, 15475, 15485, 15485, 15485, 15488,
+    15488, 15488, 15493, 15498, 15500, 15501, 15501, 15501, 15502, 15502, 15507, 15509, 15510, 15510, 15512, 15515,
+    15519, 15521, 15522, 15527, 15534, 15541, 15542, 15546, 15552, 15559, 15567, 15570, 15570, 15571, 15571, 15572,
+    15572, 15574, 15575, 15576, 15578, 15578, 15578, 15581, 15581, 15581, 15588, 15590, 15591, 15591, 15592, 15595,
+    15595, 15596, 15597, 15597, 15597, 15598, 15598, 15604, 15605, 15614, 15618, 15619, 15626, 15627, 15628, 15631,
+    15636, 15636, 15645, 15647, 15647, 15659, 15669, 15673, 15679, 15682, 15687, 15692, 15692, 15697, 15697, 15700,
+    15700, 15702, 15704, 15705, 15707, 15711, 15712, 15714, 15716, 15724, 15738, 15740, 15742, 15746, 15752, 15753,
+    15756, 15756, 15760, 15763, 15764, 15764, 15765, 15768, 15772, 15775, 15777, 15780, 15781, 15784, 15786, 15786,
+    15786, 15787, 15787, 15787, 15787, 15790, 15790, 15790, 15793, 15795, 15798, 15802, 15802, 15803, 15804, 15804,
+    15804, 15804, 15808, 15809, 15809, 15813, 15814, 15814, 15815, 15817, 15819, 15820, 15821, 15821, 15821, 15830,
+    15833, 15836, 15841, 15847, 15848, 15851, 15856, 15867, 15873, 15891, 15895, 15895, 15909, 15915, 15925, 15934,
+    15935, 15936, 15936, 15938, 15939, 15939, 15944, 15945, 15971, 15971, 15971, 15972, 15972, 15972, 15972, 15973,
+    15974, 15976, 15976, 15978, 15980, 15982, 15983, 15989, 15991, 15994, 16003, 16013, 16015, 16025, 16029, 16042,
+    16043, 16044, 16044, 16062, 16068, 16074, 16078, 16086, 16087, 16089, 16090, 16090, 16094, 16094, 16098, 16098,
+    16104, 16104, 16104, 16104, 16104, 16104, 16106, 16107, 16110, 16114, 16114, 16119, 16129, 16134, 16137, 16148,
+    16149, 16152, 16161, 16164, 16167, 16167, 16167, 16176, 16176, 16180, 16180, 16187, 16189, 16189, 16196, 16199,
+    16199, 16200, 16203, 16203, 16203, 16203, 16203, 16207, 16207, 16208, 16209, 16215, 16215, 16215, 16217, 16218,
+    16219, 16220, 16222, 16223, 16223, 16224, 16227, 16227, 16228, 16230, 16231, 16235, 16235, 16235, 16243, 16244,
+    16247, 16247, 16251, 16261, 16266, 16268, 16270, 16270, 16270, 16270, 16271, 16271, 16271, 16284, 16292, 16292,
+    16296, 16302, 16307, 16307, 16318, 16327, 16327, 16327, 16335, 16335, 16339, 16340, 16343, 16344, 16345, 16356,
+    16360, 16371, 16376, 16377, 16377, 16382, 16386, 16387, 16388, 16397, 16399, 16399, 16399, 16399, 16418, 16418,
+    16418, 16418, 16437, 16437, 16437, 16441, 16457, 16457, 16457, 16457, 16457, 16457, 16475, 16475, 16475, 16483,
+    16484, 16484, 16498, 16498, 16499, 16503, 16503, 16510, 16515, 16519, 16520, 16523, 16524, 16524, 16525, 16526,
+    16526, 16528, 16528, 16530, 16539, 16550, 16551, 16558, 16559, 16561, 16561, 16562, 16564, 16568, 16568, 16568,
+    16569, 16569, 16569, 16577, 16578, 16578, 16578, 16578, 16578, 16578, 16578, 16578, 16578, 16579, 16580, 16580,
+    16581, 16581, 16581, 16582, 16582, 16584, 16584, 16584, 16584, 16584, 16584, 16584, 16584, 16584, 16585, 16585,
+    16585, 16585, 16585, 16586, 16604, 16606, 16615, 16616, 16621, 16627, 16628, 16633, 16639, 16652, 16658, 16679,
+    16680, 16685, 16700, 16707, 16716, 16725, 16726, 16727, 16727, 16728, 16729, 16730, 16731, 16738, 16738, 16738,
+    16739, 16739, 16740, 16741, 16741, 16750, 16753, 16756, 16757, 16761, 16763, 16764, 16769, 16779, 16781, 16798,
+    16808, 16823, 16824, 16828, 16853, 16859, 16862, 16867, 16869, 16871, 16877, 16878, 16880, 16880, 16880, 16887,
+    16887, 16898, 16898, 16905, 16905, 16905, 16906, 16906, 16915, 16915, 16915, 16915, 16915, 16919, 16919, 16919,
+    16920, 16920, 16920, 16925, 16925, 16927, 16929, 16940, 16943, 16946, 16946, 16952, 16960, 16965, 16981, 16983,
+    16984, 16985, 16988, 16997, 17002, 17003, 17007, 17009, 17010, 17013, 17015, 17016, 17016, 17017, 17018, 17019,
+    17019, 17020, 17020, 17022, 17028, 17030, 17032, 17033, 17033, 17034, 17036, 17036, 17036, 17039, 17045, 17050,
+    17050, 17056, 17071, 17076, 17081, 17083, 17083, 17083, 17084, 17084, 17085, 17085, 17098, 17117, 17117, 17128,
+    17141, 17152, 17152, 17160, 17160, 17166, 17170, 17170, 17181, 17183, 17196, 17200, 17203, 17209, 17217, 17217,
+    17227, 17229, 17230, 17230, 17233, 17233, 17243, 17251, 17254, 17257, 17258, 17260, 17262, 17267, 17268, 17268,
+    17269, 17269, 17271, 17272, 17273, 17274, 17275, 17277, 17278, 17279, 17280, 17281, 17282, 17296, 17309, 17310,
+    17321, 17325, 17326, 17327, 17327, 17329, 17329, 17330, 17330, 17333, 17341, 17344, 17345, 17347, 17349, 17353,
+    17354, 17354, 17354, 17354, 17354, 17356, 17356, 17358, 17359, 17361, 17361, 17361, 17364, 17364, 17366, 17368,
+    17368, 17368, 17370, 17370, 17370, 17370, 17371, 17371, 17372, 17372, 17373, 17375, 17375, 17375, 17375, 17382,
+    17385, 17385, 17385, 17386, 17386, 17405, 17405, 17408, 17412, 17414, 17417, 17417, 17417, 17418, 17427, 17428,
+    17431, 17434, 17436, 17441, 17442, 17442, 17456, 17456, 17459, 17459, 17459, 17464, 17466, 17468, 17470, 17471,
+    17471, 17472, 17472, 17472, 17472, 17476, 17477, 17486, 17486, 17503, 17506, 17506, 17506, 17518, 17524, 17527,
+    17530, 17530, 17532, 17532, 17535, 17539, 17540, 17543, 17550, 17550, 17557, 17560, 17561, 17564, 17569, 17569,
+    17576, 17581, 17584, 17587, 17587, 17587, 17587, 17589, 17589, 17593, 17593, 17599, 17599, 17599, 17599, 17599,
+    17601, 17602, 17603, 17604, 17604, 17605, 17609, 17610, 17610, 17611, 17611, 17612, 17612, 17613, 17613, 17620,
+    17621, 17623, 17623, 17623, 17627, 17628, 17632, 17637, 17637, 17640, 17642, 17647, 17648, 17649, 17652, 17653,
+    17657, 17660, 17661, 17662, 17663, 17663, 17672, 17672, 17678, 17678, 17678, 17681, 17681, 17681, 17682, 17683,
+    17685, 17685, 17690, 17690, 17692, 17692, 17693, 17693, 17703, 17718, 17725, 17727, 17734, 17743, 17750, 17751,
+    17753, 17756, 17756, 17765, 17772, 17773, 17774, 17776, 17776, 17778, 17779, 17779, 17779, 17785, 17786, 17787,
+    17787, 17787, 17787, 17788, 17792, 17792, 17792, 17793, 17794, 17795, 17800, 17800, 17810, 17811, 17812, 17814,
+    17822, 17826, 17831, 17835, 17836, 17836, 17839, 17840, 17842, 17842, 17843, 17849, 17854, 17855, 17862, 17865,
+    17865, 17865, 17872, 17873, 17882, 17887, 17888, 17893, 17899, 17900, 17903, 17909, 17911, 17912, 17912, 17920,
+    17920, 17932, 17933, 17938, 17940, 17941, 17946, 17949, 17954, 17957, 17961, 17964, 17966, 17967, 17967, 17968,
+    17969, 17971, 17971, 17971, 17971, 17971, 17973, 17975, 17976, 17976, 17976, 17976, 17976, 17976, 17976, 17976,
+    17976, 17977, 17977, 17977, 17978, 17980, 17982, 17984, 17985, 17993, 17993, 17996, 17996, 17996, 17997, 17997,
+    17997, 18001, 18005, 18008, 18014, 18015, 18027, 18031, 18032, 18032, 18032, 18032, 18032, 18035, 18035, 18037,
+    18041, 18041, 18041, 18045, 18046, 18050, 18056, 18056, 18057, 18057, 18057, 18058, 18058, 18060, 18063, 18065,
+    18065, 18072, 18073, 18073, 18073, 18074, 18074, 18074, 18074, 18074, 18074, 18076, 18076, 18078, 18081, 18081,
+    18081, 18082, 18084, 18085, 18088, 18089, 18098, 18104, 18104, 18107, 18112, 18112, 18112, 18118, 18119, 18120,
+    18121, 18128, 18129, 18140, 18143, 18148, 18159, 18162, 18164, 18164, 18164, 18164, 18166, 18166, 18170, 18171,
+    18172, 18179, 18180, 18184, 18186, 18186, 18188, 18189, 18190, 18192, 18199, 18199, 18199, 18199, 18199, 18199,
+    18199, 18199, 18200, 18200, 18201, 18204, 18207, 18208, 18208, 18208, 18208, 18209, 18211, 18211, 18211, 18212,
+    18213, 18213, 18213, 18213, 18215, 18215, 18215, 18215, 18215, 18216, 18216, 18217, 18217, 18220, 18220, 18220,
+    18220, 18220, 18220, 18220, 18220, 18221, 18223, 18224, 18228, 18228, 18228, 18229, 18233, 18234, 18234, 18237,
+    18237, 18238, 18246, 18247, 18248, 18249, 18249, 18249, 18249, 18249, 18249, 18250, 18252, 18253, 18259, 18260,
+    18260, 18262, 18263, 18265, 18265, 18267, 18268, 18268, 18268, 18269, 18269, 18269, 18269, 18270, 18270, 18270,
+    18271, 18271, 18274, 18275, 18275, 18275, 18275, 18277, 18278, 18278, 18278, 18278, 18278, 18279, 18281, 18283,
+    18284, 18285, 18285, 18285, 18286, 18286, 18286, 18291, 18291, 18295, 18296, 18299, 18299, 18299, 18299, 18301,
+    18302, 18302, 18304, 18304, 18305, 18305, 18308, 18309, 18309, 18311, 18311, 18311, 18313, 18313, 18313, 18313,
+    18313, 18314, 18315, 18315, 18317, 18318, 18318, 18319, 18319, 18320, 18320, 18320, 18321, 18323, 18328, 18329,
+    18329, 18331, 18332, 18333, 18333, 18333, 18333, 18334, 18334, 18335, 18335, 18335, 18335, 18336, 18338, 18339,
+    18340, 18340, 18350, 18351, 18351, 18356, 18358, 18360, 18366, 18367, 18368, 18369, 18370, 18370, 18370, 18371,
+    18372, 18373, 18374, 18375, 18378, 18383, 18393, 18395, 18404, 18405, 18422, 18428, 18432, 18435, 18435, 18436,
+    18437, 18438, 18439, 18440, 18441, 18442, 18446, 18448, 18450, 18461, 18461, 18462, 18465, 18469, 18469, 18471,
+    18471, 18472, 18473, 18473, 18473, 18475, 18475, 18476, 18478, 18478, 18479, 18481, 18482, 18482, 18483, 18483,
+    18483, 18484, 18484, 18486, 18492, 18497, 18498, 18499, 18499, 18499, 18499, 18499, 18500, 18501, 18503, 18503,
+    18508, 18510, 18510, 18510, 18510, 18521, 18529, 18529, 18531, 18537, 18538, 18541, 18541, 18548, 18556, 18562,
+    18562, 18563, 18564, 18565, 18565, 18566, 18567, 18570, 18573, 18574, 18574, 18574, 18575, 18575, 18575, 18575,
+    18575, 18577, 18577, 18577, 18579, 18579, 18579, 18579, 18580, 18580, 18580, 18580, 18580, 18580, 18582, 18583,
+    18589, 18589, 18594, 18596, 18596, 18597, 18599, 18599, 18599, 18599, 18599, 18600, 18600, 18600, 18601, 18602,
+    18603, 18603, 18603, 18605, 18605, 18605, 18605, 18612, 18612, 18612, 18613, 18614, 18614, 18614, 18614, 18615,
+    18616, 18617, 18617, 18618, 18618, 18620, 18620, 18620, 18623, 18623, 18623, 18624, 18625, 18625, 18625, 18625,
+    18627, 18628, 18630, 18630, 18633, 18635, 18635, 18635, 18635, 18635, 18635, 18638, 18639, 18641, 18641, 18641,
+    18643, 18644, 18645, 18645, 18647, 18648, 18648, 18648, 18649, 18650, 18650, 18651, 18652, 18652, 18653, 18653,
+    18655, 18657, 18658, 18662, 18662, 18666, 18667, 18670, 18671, 18671, 18671, 18671, 18671, 18672, 18674, 18676,
+    18677, 18678, 18678, 18679, 18685, 18686, 18687, 18688, 18690, 18693, 18696, 18697, 18701, 18704, 18707, 18707,
+    18707, 18707, 18711, 18712, 18712, 18716, 18719, 18719, 18719, 18725, 18726, 18726, 18734, 18736, 18738, 18740,
+    18740, 18741, 18742, 18742, 18743, 18743, 18746, 18748, 18749, 18757, 18759, 18759, 18760, 18760, 18760, 18760,
+    18761, 18762, 18762, 18762, 18765, 18766, 18768, 18770, 18771, 18771, 18772, 18772, 18774, 18774, 18774, 18775,
+    18776, 18778, 18778, 18779, 18780, 18780, 18780, 18780, 18780, 18780, 18780, 18783, 18784, 18785, 18788, 18790,
+    18790, 18791, 18791, 18793, 18794, 18794, 18795, 18795, 18795, 18796, 18797, 18799, 18801, 18801, 18802, 18803,
+    18803, 18804, 18804, 18805, 18812, 18813, 18814, 18815, 18816, 18817, 18817, 18818, 18820, 18821, 18822, 18822,
+    18823, 18826, 18826, 18826, 18828, 18832, 18832, 18832, 18833, 18833, 18834, 18835, 18836, 18837, 18838, 18838,
+    18838, 18843, 18843, 18843, 18844, 18844, 18848, 18850, 18850, 18853, 18853, 18853, 18853, 18853, 18853, 18853,
+    18853, 18853, 18856, 18857, 18857, 18857, 18857, 18858, 18859, 18859, 18861, 18861, 18861, 18862, 18862, 18866,
+    18866, 18870, 18871, 18873, 18873, 18876, 18877, 18878, 18878, 18878, 18878, 18878, 18880, 18886, 18886, 18886,
+    18886, 18888, 18890, 18890, 18890, 18893, 18894, 18895, 18896, 18900, 18903, 18903, 18904, 18904, 18905, 18905,
+    18907, 18909, 18910, 18911, 18913, 18913, 18917, 18919, 18923, 18923, 18924, 18930, 18935, 18937, 18938, 18941,
+    18941, 18941, 18941, 18943, 18945, 18945, 18946, 18946, 18948, 18948, 18948, 18949, 18949, 18949, 18949, 18949,
+    18949, 18950, 18950, 18950, 18951, 18952, 18956, 18957, 18958, 18959, 18961, 18962, 18964, 18965, 18965, 18966,
+    18967, 18967, 18968, 18968, 18969, 18970, 18972, 18973, 18976, 18976, 18977, 18979, 18979, 18979, 18979, 18979,
+    18979, 18979, 18980, 18981, 18981, 18982, 18983, 18984, 18985, 18989, 18990, 18991, 18992, 18993, 18994, 18994,
+    18995, 18996, 18997, 18997, 18999, 19000, 19001, 19002, 19003, 19004, 19005, 19005, 19006, 19008, 19010, 19010,
+    19011, 19012, 19013, 19014, 19014, 19015, 19016, 19016, 19017, 19017, 19018, 19018, 19020, 19024, 19025, 19025,
+    19026, 19026, 19029, 19031, 19031, 19032, 19032, 19037, 19038, 19038, 19043, 19046, 19048, 19049, 19049, 19049,
+    19050, 19051, 19052, 19052, 19056, 19056, 19056, 19056, 19056, 19056, 19057, 19058, 19059, 19060, 19060, 19061,
+    19062, 19063, 19064, 19065, 19065, 19067, 19067, 19070, 19073, 19077, 19078, 19078, 19079, 19080, 19081, 19082,
+    19083, 19084, 19085, 19089, 19090, 19091, 19091, 19092, 19093, 19094, 19095, 19095, 19095, 19096, 19096, 19097,
+    19098, 19098, 19099, 19099, 19099, 19099, 19099, 19099, 19100, 19100, 19101, 19101, 19102, 19104, 19104, 19105,
+    19105, 19106, 19107, 19108, 19108, 19109, 19110, 19111, 19112, 19113, 19115, 19116, 19116, 19117, 19118, 19120,
+    19121, 19122, 19123, 19123, 19124, 19125, 19126, 19128, 19129, 19133, 19134, 19134, 19134, 19135, 19136, 19136,
+    19137, 19138, 19139, 19140, 19142, 19142, 19143, 19143, 19144, 19145, 19145, 19146, 19146, 19146, 19147, 19147,
+    19148, 19148, 19149, 19151, 19151, 19155, 19155, 19155, 19157, 19157, 19159, 19160, 19161, 19161, 19162, 19163,
+    19164, 19165, 19167, 19168, 19169, 19170, 19172, 19173, 19174, 19175, 19176, 19176, 19177, 19177, 19178, 19179,
+    19180, 19181, 19182, 19183, 19183, 19183, 19184, 19185, 19186, 19187, 19189, 19191, 19192, 19193, 19194, 19196,
+    19198, 19198, 19198, 19199, 19200, 19202, 19203, 19204, 19205, 19206, 19207, 19208, 19209, 19210, 19212, 19215,
+    19215, 19215, 19216, 19217, 19217, 19219, 19220, 19221, 19221, 19222, 19223, 19224, 19225, 19227, 19229, 19229,
+    19230, 19231, 19231, 19231, 19234, 19235, 19235, 19235, 19235, 19235, 19235, 19235, 19235, 19235, 19236, 19237,
+    19239, 19239, 19239, 19240, 19242, 19242, 19242, 19242, 19243, 19244, 19244, 19245, 19245, 19246, 19247, 19248,
+    19250, 19251, 19251, 19252, 19253, 19253, 19254, 19255, 19256, 19257, 19259, 19260, 19262, 19263, 19264, 19265,
+    19265, 19265, 19265, 19265, 19265, 19265, 19265, 19265, 19266, 19266, 19266, 19266, 19266, 19268, 19268, 19268,
+    19268, 19268, 19268, 19268, 19268, 19268, 19269, 19269, 19270, 19270, 19271, 19272, 19272, 19272, 19272, 19276,
+    19278, 19279, 19284, 19286, 19286, 19286, 19286, 19286, 19287, 19287, 19288, 19288, 19291, 19293, 19295, 19295,
+    19295, 19295, 19295, 19295, 19295, 19295, 19295, 19295, 19296, 19296, 19296, 19296, 19296, 19296, 19296, 19298,
+    19298, 19298, 19298, 19298, 19298, 19298, 19298, 19298, 19298, 19302, 19302, 19306, 19306, 19307, 19307, 19307,
+    19307, 19310, 19310, 19316, 19322, 19323, 19323, 19323, 19323, 19323, 19323, 19323, 19324, 19325, 19326, 19328,
+    19329, 19329, 19329, 19329, 19329, 19329, 19330, 19330, 19330, 19330, 19330, 19331, 19331, 19332, 19332, 19332,
+    19333, 19333, 19333, 19334, 19336, 19339, 19340, 19340, 19340, 19340, 19340, 19340, 19342, 19343, 19343, 19343,
+    19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343, 19343,
+    19343, 19343, 19344, 19344, 19344, 19345, 19345, 19346, 19347, 19347, 19347, 19347, 19348, 19348, 19349, 19349,
+    19349, 19349, 19349, 19349, 19349, 19349, 19349, 19349, 19349, 19349, 19352, 19352, 19354, 19355, 19356, 19356,
+    19356, 19356, 19356, 19356, 19356, 19356, 19356, 19357, 19357, 19357, 19357, 19357, 19358, 19359, 19359, 19362,
+    19367, 19367, 19367, 19367, 19369, 19369, 19369, 19370, 19371, 19371, 19371, 19372, 19372, 19372, 19372, 19374,
+    19375, 19376, 19379, 19379, 19380, 19380, 19380, 19381, 19382, 19382, 19382, 19382, 19382, 19385, 19385, 19386,
+    19386, 19386, 19388, 19388, 19388, 19391, 19392, 19392, 19392, 19392, 19392, 19394, 19394, 19399, 19399, 19401,
+    19401, 19401, 19401, 19401, 19401, 19401, 19401, 19401, 19401, 19402, 19402, 19403, 19403, 19403, 19403, 19403,
+    19403, 19404, 19404, 19404, 19405, 19405, 19405, 19405, 19405, 19405, 19406, 19406, 19406, 19406, 19406, 19406,
+    19406, 19407, 19407, 19407, 19407, 19408, 19408, 19408, 19409, 19409, 19409, 19409, 19409, 19409, 19409, 19409,
+    19410, 19410, 19412, 19414, 19414, 19415, 19418, 19418, 19418, 19418, 19418, 19418, 19418, 19418, 19418, 19420,
+    19420, 19421, 19421, 19422, 19422, 19426, 19427, 19433, 19435, 19438, 19439, 19440, 19441, 19441, 19442, 19443,
+    19443, 19444, 19446, 19447, 19447, 19447, 19447, 19447, 19448, 19449, 19449, 19449, 19451, 19451, 19452, 19458,
+    19459, 19469, 19471, 19471, 19472, 19472, 19472, 19472, 19474, 19475, 19477, 19481, 19482, 19483, 19484, 19485,
+    19486, 19491, 19497, 19499, 19501, 19502, 19504, 19505, 19505, 19505, 19505, 19507, 19508, 19509, 19509, 19510,
+    19511, 19512, 19513, 19514, 19515, 19517, 19518, 19521, 19524, 19525, 19526, 19530, 19531, 19531, 19531, 19531,
+    19531, 19531, 19531, 19531, 19532, 19532, 19532, 19534, 19535, 19535, 19535, 19535, 19535, 19535, 19535, 19535,
+    19536, 19536, 19536, 19536, 19536, 19536, 19536, 19537, 19541, 19542, 19542, 19543, 19543, 19543, 19543, 19543,
+    19546, 19547, 19550, 19551, 19551, 19551, 19551, 19553, 19555, 19556, 19556, 19556, 19556, 19557, 19557, 19557,
+    19557, 19557, 19557, 19557, 19558, 19562, 19564, 19565, 19567, 19567, 19567, 19567, 19567, 19567, 19567, 19567,
+    19568, 19568, 19568, 19570, 19571, 19572, 19572, 19576, 19577, 19578, 19578, 19578, 19578, 19580, 19585, 19589,
+    19590, 19590, 19590, 19590, 19590, 19594, 19594, 19595, 19595, 19600, 19601, 19601, 19602, 19602, 19602, 19602,
+    19603, 19604, 19605, 19605, 19605, 19605, 19605, 19608, 19613, 19613, 19614, 19615, 19615, 19617, 19618, 19618,
+    19618, 19620, 19620, 19621, 19621, 19623, 19624, 19625, 19625, 19628, 19631, 19631, 19633, 19634, 19636, 19639,
+    19641, 19641, 19643, 19643, 19643, 19643, 19645, 19647, 19648, 19648, 19648, 19648, 19648, 19648, 19648, 19648,
+    19649, 19650, 19650, 19650, 19650, 19650, 19651, 19652, 19653, 19656, 19657, 19657, 19657, 19657, 19658, 19659,
+    19660, 19662, 19663, 19664, 19664, 19664, 19664, 19664, 19664, 19664, 19664, 19666, 19666, 19666, 19668, 19668,
+    19668, 19668, 19668, 19668, 19668, 19670, 19670, 19670, 19671, 19671, 19671, 19671, 19671, 19671, 19671, 19671,
+    19671, 19671, 19673, 19673, 19673, 19673, 19673, 19673, 19673, 19673, 19673, 19674, 19674, 19677, 19678, 19679,
+    19682, 19684, 19685, 19685, 19686, 19686, 19686, 19689, 19694, 19694, 19694, 19694, 19695, 19697, 19697, 19697,
+    19699, 19700, 19701, 19703, 19703, 19703, 19704, 19704, 19704, 19705, 19706, 19710, 19711, 19711, 19714, 19722,
+    19722, 19723, 19724, 19724, 19725, 19725, 19725, 19725, 19725, 19725, 19725, 19727, 19731, 19731, 19731, 19732,
+    19732, 19735, 19736, 19740, 19741, 19744, 19745, 19746, 19748, 19752, 19753, 19754, 19754, 19754, 19755, 19756,
+    19757, 19758, 19758, 19759, 19759, 19759, 19759, 19759, 19759, 19759, 19760, 19762, 19763, 19764, 19764, 19764,
+    19764, 19764, 19765, 19765, 19767, 19769, 19769, 19769, 19770, 19771, 19772, 19772, 19773, 19773, 19774, 19774,
+    19774, 19776, 19776, 19776, 19776, 19776, 19776, 19776, 19776, 19776, 19776, 19777, 19777, 19777, 19779, 19779,
+    19784, 19784, 19784, 19784, 19785, 19786, 19789, 19790, 19790, 19790, 19790, 19791, 19791, 19791, 19793, 19793,
+    19794, 19794, 19794, 19794, 19794, 19794, 19794, 19794, 19795, 19795, 19797, 19798, 19800, 19802, 19802, 19803,
+    19803, 19805, 19810, 19813, 19817, 19817, 19819, 19821, 19823, 19824, 19824, 19824, 19824, 19825, 19825, 19825,
+    19825, 19827, 19827, 19827, 19828, 19828, 19828, 19829, 19830, 19831, 19832, 19832, 19832, 19832, 19834, 19835,
+    19836, 19838, 19838, 19842, 19843, 19843, 19843, 19843, 19843, 19844, 19845, 19846, 19846, 19846, 19846, 19848,
+    19849, 19850, 19853, 19853, 19853, 19853, 19854, 19854, 19858, 19859, 19859, 19861, 19861, 19862, 19865, 19865,
+    19865, 19865, 19866, 19866, 19866, 19866, 19866, 19867, 19873, 19878, 19879, 19879, 19880, 19880, 19880, 19880,
+    19880, 19880, 19882, 19883, 19883, 19883, 19883, 19883, 19886, 19888, 19892, 19893, 19894, 19894, 19894, 19898,
+    19898, 19899, 19904, 19904, 19905, 19906, 19906, 19906, 19907, 19908, 19909, 19913, 19913, 19913, 19913, 19913,
+    19913, 19913, 19914, 19915, 19915, 19916, 19918, 19920, 19921, 19921, 19921, 19922, 19922, 19923, 19924, 19924,
+    19924, 19924, 19925, 19925, 19925, 19925, 19928, 19929, 19929, 19933, 19933, 19933, 19935, 19935, 19936, 19937,
+    19937, 19940, 19943, 19943, 19943, 19943, 19943, 19943, 19946, 19946, 19946, 19947, 19947, 19948, 19948, 19948,
+    19948, 19948, 19949, 19949, 19949, 19950, 19950, 19950, 19951, 19951, 19951, 19951, 19951, 19951, 19951, 19951,
+    19951, 19951, 19952, 19953, 19953, 19953, 19953, 19953, 19953, 19953, 19953, 19953, 19954, 19956, 19958, 19958,
+    19958, 19958, 19958, 19959, 19959, 19959, 19960, 19960, 19960, 19962, 19966, 19967, 19969, 19970, 19971, 19971,
+    19971, 19971, 19974, 19974, 19974, 19975, 19981, 19981, 19982, 19982, 19982, 19982, 19982, 19982, 19986, 19987,
+    19990, 19990, 19990, 19991, 19992, 19992, 19992, 19992, 19995, 19995, 19996, 19996, 19996, 19996, 19997, 19999,
+    19999, 19999, 19999, 20001, 20001, 20002, 20002, 20004, 20004, 20005, 20006, 20006, 20007, 20007, 20007, 20007,
+    20008, 20009, 20009, 20009, 20010, 20013, 20014, 20014, 20015, 20016, 20017, 20017, 20018, 20018, 20019, 20019,
+    20020, 20021, 20023, 20026, 20027, 20029, 20034, 20034, 20035, 20038, 20039, 20040, 20040, 20041, 20042, 20042,
+    20043, 20047, 20052, 20052, 20053, 20053, 20053, 20056, 20064, 20065, 20065, 20065, 20068, 20068, 20068, 20074,
+    20074, 20076, 20077, 20079, 20080, 20082, 20084, 20087, 20087, 20089, 20089, 20092, 20093, 20094, 20095, 20096,
+    20100, 20106, 20107, 20108, 20109, 20109, 20109, 20110, 20111, 20111, 20111, 20112, 20113, 20114, 20114, 20116,
+    20116, 20118, 20119, 20121, 20122, 20123, 20124, 20124, 20124, 20124, 20124, 20124, 20124, 20125, 20125, 20125,
+    20125, 20125, 20125, 20126, 20127, 20127, 20128, 20128, 20128, 20128, 20129, 20129, 20129, 20129, 20130, 20132,
+    20134, 20134, 20134, 20134, 20134, 20134, 20134, 20140, 20140, 20141, 20144, 20144, 20144, 20146, 20147, 20147,
+    20148, 20149, 20151, 20151, 20151, 20151, 20151, 20151, 20153, 20153, 20154, 20154, 20154, 20154, 20154, 20155,
+    20155, 20155, 20155, 20155, 20156, 20156, 20156, 20158, 20159, 20159, 20160, 20162, 20162, 20162, 20162, 20162,
+    20163, 20163, 20165, 20167, 20168, 20169, 20169, 20171, 20172, 20172, 20172, 20172, 20172, 20173, 20173, 20174,
+    20174, 20174, 20174, 20174, 20174, 20174, 20174, 20175, 20178, 20178, 20179, 20179, 20179, 20179, 20180, 20180,
+    20181, 20181, 20182, 20182, 20182, 20182, 20183, 20184, 20189, 20190, 20192, 20192, 20193, 20194, 20194, 20194,
+    20194, 20195, 20197, 20197, 20197, 20197, 20197, 20198, 20199, 20200, 20200, 20200, 20200, 20200, 20202, 20202,
+    20203, 20206, 20206, 20206, 20206, 20206, 20207, 20209, 20214, 20214, 20214, 20214, 20214, 20214, 20214, 20214,
+    20214, 20214, 20214, 20214, 20214, 20214, 20218, 20219, 20219, 20222, 20226, 20231, 20232, 20232, 20233, 20233,
+    20234, 20234, 20234, 20234, 20235, 20235, 20236, 20239, 20240, 20240, 20240, 20240, 20240, 20241, 20241, 20242,
+    20242, 20242, 20245, 20245, 20245, 20246, 20247, 20247, 20248, 20249, 20249, 20250, 20251, 20251, 20251, 20251,
+    20252, 20252, 20252, 20252, 20252, 20252, 20252, 20252, 20252, 20253, 20253, 20253, 20254, 20254, 20254, 20254,
+    20254, 20254, 20254, 20254, 20254, 20255, 20255, 20255, 20256, 20257, 20258, 20258, 20258, 20258, 20259, 20264,
+    20264, 20268, 20270, 20272, 20274, 20275, 20276, 20277, 20280, 20280, 20281, 20282, 20284, 20287, 20292, 20294,
+    20295, 20295, 20295, 20295, 20303, 20304, 20305, 20306, 20307, 20307, 20308, 20308, 20310, 20310, 20311, 20313,
+    20313, 20314, 20314, 20314, 20315, 20317, 20318, 20319, 20320, 20320, 20320, 20320, 20323, 20324, 20325, 20325,
+    20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326, 20326,
+    20326, 20326, 20326, 20326, 20327, 20327, 20327, 20328, 20331, 20340, 20341, 20341, 20341, 20341, 20341, 20341,
+    20342, 20342, 20343, 20344, 20344, 20344, 20344, 20344, 20345, 20345, 20345, 20345, 20346, 20347, 20348, 20348,
+    20348, 20349, 20349, 20349, 20349, 20349, 20349, 20350, 20350, 20351, 20352, 20352, 20352, 20353, 20353, 20353,
+    20353, 20353, 20353, 20353, 20354, 20354, 20354, 20354, 20354, 20354, 20355, 20356, 20357, 20357, 20357, 20360,
+    20360, 20360, 20363, 20363, 20363, 20363, 20364, 20364, 20364, 20364, 20364, 20364, 20364, 20364, 20364, 20365,
+    20366, 20366, 20366, 20366, 20367, 20367, 20367, 20369, 20369, 20370, 20370, 20370, 20372, 20372, 20373, 20375,
+    20376, 20376, 20376, 20376, 20379, 20380, 20380, 20380, 20380, 20383, 20383, 20384, 20384, 20384, 20384, 20384,
+    20386, 20387, 20387, 20387, 20390, 20390, 20390, 20392, 20392, 20392, 20392, 20392, 20392, 20392, 20393, 20393,
+    20393, 20394, 20395, 20396, 20396, 20396, 20397, 20397, 20397, 20397, 20398, 20398, 20398, 20398, 20398, 20399,
+    20399, 20399, 20399, 20400, 20401, 20401, 20402, 20403, 20404, 20404, 20404, 20404, 20404, 20404, 20404, 20404,
+    20404, 20405, 20405, 20405, 20405, 20406, 20410, 20413, 20413, 20417, 20417, 20423, 20425, 20426, 20429, 20430,
+    20433, 20433, 20434, 20435, 20435, 20436, 20437, 20438, 20438, 20438, 20439, 20439, 20443, 20444, 20444, 20446,
+    20447, 20451, 20458, 20458, 20459, 20459, 20459, 20459, 20459, 20459, 20460, 20460, 20460, 20465, 20467, 20468,
+    20474, 20475, 20476, 20477, 20478, 20478, 20479, 20479, 20480, 20482, 20484, 20486, 20486, 20486, 20488, 20495,
+    20496, 20497, 20498, 20499, 20504, 20505, 20505, 20506, 20506, 20507, 20508, 20508, 20508, 20508, 20509, 20509,
+    20511, 20512, 20513, 20514, 20514, 20515, 20516, 20518, 20518, 20518, 20518, 20519, 20519, 20521, 20521, 20521,
+    20521, 20521, 20521, 20526, 20527, 20528, 20529, 20530, 20530, 20530, 20530, 20530, 20530, 20530, 20530, 20530,
+    20530, 20530, 20530, 20531, 20531, 20531, 20531, 20531, 20531, 20533, 20534, 20535, 20535, 20535, 20537, 20539,
+    20539, 20539, 20539, 20539, 20540, 20540, 20543, 20543, 20543, 20545, 20546, 20547, 20548, 20548, 20548, 20548,
+    20548, 20548, 20549, 20549, 20549, 20549, 20549, 20549, 20549, 20551, 20552, 20553, 20553, 20555, 20556, 20556,
+    20556, 20556, 20556, 20556, 20563, 20563, 20563, 20563, 20565, 20565, 20565, 20565, 20565, 20565, 20570, 20570,
+    20570, 20571, 20571, 20571, 20572, 20573, 20573, 20573, 20573, 20574, 20574, 20574, 20575, 20577, 20578, 20583,
+    20583, 20585, 20586, 20586, 20586, 20587, 20590, 20590, 20590, 20591, 20591, 20591, 20591, 20591, 20595, 20595,
+    20595, 20595, 20595, 20595, 20595, 20595, 20596, 20598, 20598, 20598, 20600, 20600, 20603, 20604, 20604, 20604,
+    20604, 20604, 20606, 20606, 20607, 20610, 20610, 20610, 20610, 20610, 20610, 20610, 20610, 20610, 20610, 20610,
+    20610, 20610, 20610, 20611, 20611, 20612, 20612, 20612, 20613, 20614, 20615, 20616, 20617, 20620, 20620, 20620,
+    20620, 20620, 20620, 20621, 20623, 20624, 20627, 20634, 20635, 20635, 20635, 20637, 20638, 20638, 20638, 20639,
+    20640, 20641, 20641, 20641, 20641, 20642, 20645, 20647, 20647, 20647, 20648, 20650, 20650, 20650, 20653, 20659,
+    20661, 20663, 20666, 20667, 20668, 20669, 20669, 20670, 20670, 20670, 20671, 20672, 20672, 20672, 20672, 20672,
+    20672, 20672, 20673, 20673, 20673, 20673, 20673, 20673, 20674, 20674, 20674, 20674, 20674, 20675, 20675, 20676,
+    20676, 20676, 20679, 20679, 20680, 20680, 20680, 20680, 20680, 20680, 20680, 20680, 20680, 20680, 20681, 20681,
+    20683, 20683, 20684, 20684, 20686, 20686, 20688, 20688, 20688, 20688, 20688, 20689, 20690, 20690, 20690, 20690,
+    20691, 20691, 20692, 20692, 20693, 20693, 20693, 20693, 20693, 20693, 20693, 20693, 20693, 20694, 20694, 20694,
+    20694, 20694, 20694, 20694, 20695, 20695, 20695, 20695, 20697, 20697, 20702, 20703, 20703, 20705, 20705, 20705,
+    20705, 20705, 20706, 20706, 20706, 20706, 20706, 20706, 20711, 20711, 20711, 20711, 20712, 20712, 20712, 20713,
+    20713, 20713, 20713, 20713, 20713, 20715, 20715, 20715, 20715, 20715, 20715, 20715, 20715, 20716, 20716, 20718,
+    20719, 20721, 20722, 20723, 20723, 20726, 20727, 20727, 20727, 20727, 20727, 20727, 20728, 20729, 20729, 20730,
+    20731, 20737, 20738, 20738, 20738, 20738, 20738, 20739, 20742, 20742, 20742, 20742, 20742, 20744, 20745, 20747,
+    20748, 20748, 20748, 20748, 20748, 20748, 20750, 20751, 20752, 20752, 20753, 20755, 20755, 20757, 20758, 20758,
+    20759, 20759, 20760, 20761, 20762, 20764, 20764, 20764, 20764, 20765, 20765, 20765, 20765, 20765, 20765, 20766,
+    20766, 20767, 20767, 20767, 20767, 20769, 20770, 20772, 20772, 20772, 20772, 20772, 20772, 20773, 20773, 20774,
+    20774, 20774, 20774, 20774, 20774, 20775, 20776, 20776, 20779, 20779, 20779, 20780, 20780, 20781, 20781, 20782,
+    20782, 20782, 20782, 20782, 20782, 20783, 20783, 20783, 20783, 20783, 20784, 20784, 20785, 20786, 20786, 20786,
+    20786, 20787, 20788, 20790, 20791, 20792, 20793, 20793, 20793, 20793, 20794, 20794, 20794, 20794, 20794, 20795,
+    20797, 20797, 20797, 20797, 20797, 20798, 20799, 20799, 20799, 20799, 20800, 20803, 20805, 20806, 20807, 20807,
+    20807, 20807, 20807, 20807, 20807, 20808, 20808, 20812, 20814, 20815, 20815, 20815, 20816, 20817, 20817, 20818,
+    20818, 20819, 20819, 20820, 20821, 20823, 20824, 20825, 20826, 20828, 20830, 20830, 20833, 20834, 20834, 20836,
+    20839, 20840, 20842, 20842, 20844, 20844, 20844, 20844, 20844, 20845, 20845, 20850, 20851, 20854, 20854, 20854,
+    20854, 20855, 20855, 20855, 20857, 20857, 20858, 20858, 20859, 20861, 20862, 20862, 20863, 20863, 20865, 20865,
+    20865, 20865, 20865, 20865, 20865, 20867, 20867, 20867, 20868, 20868, 20868, 20869, 20875, 20875, 20876, 20876,
+    20881, 20881, 20881, 20881, 20881, 20882, 20885, 20885, 20887, 20887, 20890, 20890, 20890, 20893, 20893, 20893,
+    20894, 20894, 20894, 20897, 20898, 20899, 20900, 20901, 20906, 20907, 20912, 20914, 20916, 20917, 20919, 20921,
+    20921, 20922, 20922, 20923, 20926, 20929, 20929, 20929, 20929, 20929, 20929, 20929, 20929, 20930, 20931, 20932,
+    20933, 20934, 20935, 20936, 20937, 20939, 20940, 20946, 20948, 20948, 20949, 20950, 20952, 20953, 20953, 20955,
+    20955, 20956, 20956, 20957, 20958, 20958, 20958, 20958, 20958, 20959, 20959, 20961, 20963, 20964, 20964, 20965,
+    20968, 20969, 20970, 20970, 20970, 20970, 20972, 20980, 20980, 20980, 20983, 20986, 20986, 20987, 20989, 20990,
+    20990, 20990, 20991, 20992, 20993, 20995, 20995, 20995, 20999, 21004, 21004, 21018, 21019, 21022, 21023, 21024,
+    21024, 21025, 21025, 21025, 21026, 21026, 21027, 21027, 21028, 21028, 21028, 21030, 21031, 21032, 21033, 21039,
+    21041, 21042, 21043, 21044, 21044, 21045, 21045, 21046, 21046, 21046, 21047, 21049, 21049, 21049, 21050, 21051,
+    21052, 21053, 21054, 21058, 21059, 21059, 21059, 21059, 21060, 21061, 21061, 21063, 21064, 21065, 21065, 21065,
+    21065, 21066, 21069, 21070, 21071, 21072, 21072, 21072, 21073, 21074, 21074, 21074, 21074, 21075, 21077, 21079,
+    21080, 21081, 21081, 21082, 21082, 21082, 21082, 21085, 21085, 21087, 21088, 21089, 21090, 21090, 21090, 21090,
+    21090, 21091, 21092, 21092, 21093, 21094, 21095, 21095, 21095, 21095, 21095, 21095, 21095, 21095, 21096, 21097,
+    21097, 21097, 21097, 21105, 21105, 21109, 21109, 21112, 21114, 21119, 21123, 21123, 21123, 21124, 21124, 21127,
+    21130, 21131, 21132, 21136, 21137, 21137, 21137, 21138, 21138, 21139, 21144, 21145, 21146, 21147, 21149, 21149,
+    21166, 21168, 21170, 21171, 21171, 21171, 21171, 21171, 21174, 21175, 21175, 21175, 21175, 21175, 21176, 21177,
+    21177, 21177, 21177, 21178, 21179, 21180, 21182, 21182, 21182, 21182, 21183, 21183, 21183, 21183, 21184, 21185,
+    21185, 21188, 21190, 21191, 21191, 21193, 21193, 21193, 21193, 21194, 21194, 21197, 21198, 21198, 21198, 21201,
+    21202, 21206, 21207, 21208, 21214, 21215, 21218, 21218, 21221, 21223, 21225, 21228, 21229, 21230, 21230, 21231,
+    21232, 21235, 21237, 21237, 21237, 21237, 21237, 21238, 21238, 21240, 21241, 21242, 21243, 21243, 21243, 21244,
+    21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245,
+    21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21245, 21246, 21246, 21246, 21246, 21247, 21247, 21247,
+    21247, 21247, 21248, 21248, 21249, 21249, 21249, 21249, 21250, 21251, 21251, 21253, 21253, 21253, 21253, 21256,
+    21256, 21256, 21257, 21262, 21263, 21263, 21263, 21264, 21265, 21269, 21275, 21277, 21280, 21283, 21286, 21291,
+    21291, 21291, 21291, 21291, 21291, 21293, 21293, 21294, 21296, 21297, 21297, 21303, 21303, 21304, 21305, 21305,
+    21305, 21306, 21308, 21309, 21310, 21310, 21317, 21319, 21323, 21329, 21330, 21343, 21344, 21347, 21348, 21349,
+    21349, 21350, 21350, 21351, 21352, 21356, 21357, 21358, 21359, 21362, 21367, 21370, 21370, 21371, 21371, 21372,
+    21373, 21374, 21375, 21382, 21382, 21383, 21384, 21384, 21384, 21385, 21386, 21387, 21387, 21388, 21388, 21388,
+    21390, 21392, 21393, 21395, 21395, 21396, 21399, 21400, 21400, 21400, 21402, 21402, 21402, 21402, 21402, 21403,
+    21404, 21405, 21405, 21405, 21406, 21407, 21407, 21407, 21407, 21407, 21408, 21409, 21409, 21409, 21410, 21411,
+    21414, 21414, 21414, 21414, 21418, 21419, 21419, 21422, 21424, 21425, 21426, 21428, 21428, 21429, 21430, 21430,
+    21432, 21432, 21433, 21433, 21434, 21435, 21435, 21435, 21435, 21435, 21435, 21436, 21436, 21436, 21436, 21436,
+    21436, 21437, 21438, 21438, 21438, 21438, 21439, 21440, 21444, 21445, 21447, 21448, 21449, 21450, 21450, 21450,
+    21451, 21451, 21453, 21453, 21454, 21455, 21455, 21459, 21461, 21462, 21462, 21463, 21463, 21464, 21464, 21465,
+    21466, 21466, 21466, 21466, 21466, 21466, 21466, 21468, 21471, 21474, 21474, 21474, 21475, 21476, 21476, 21476,
+    21480, 21480, 21481, 21481, 21482, 21484, 21487, 21487, 21496, 21502, 21502, 21506, 21507, 21508, 21511, 21513,
+    21515, 21515, 21515, 21515, 21516, 21517, 21517, 21518, 21519, 21519, 21519, 21519, 21520, 21522, 21523, 21523,
+    21523, 21524, 21525, 21526, 21526, 21528, 21528, 21528, 21529, 21530, 21530, 21531, 21531, 21531, 21531, 21531,
+    21534, 21536, 21536, 21538, 21539, 21540, 21542, 21543, 21544, 21544, 21545, 21546, 21547, 21554, 21556, 21556,
+    21557, 21557, 21558, 21558, 21558, 21559, 21559, 21559, 21559, 21560, 21561, 21562, 21562, 21566, 21567, 21567,
+    21568, 21568, 21570, 21571, 21573, 21574, 21574, 21574, 21574, 21575, 21575, 21575, 21575, 21575, 21575, 21575,
+    21575, 21577, 21577, 21577, 21578, 21578, 21580, 21581, 21581, 21584, 21586, 21586, 21586, 21587, 21588, 21588,
+    21591, 21591, 21592, 21592, 21593, 21593, 21593, 21593, 21593, 21593, 21593, 21594, 21595, 21595, 21595, 21596,
+    21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597, 21597,
+    21597, 21597, 21598, 21598, 21598, 21598, 21598, 21598, 21599, 21599, 21599, 21599, 21600, 21602, 21602, 21603,
+    21603, 21603, 21603, 21603, 21603, 21603, 21603, 21607, 21609, 21609, 21609, 21609, 21610, 21611, 21611, 21611,
+    21611, 21613, 21613, 21613, 21613, 21614, 21615, 21616, 21617, 21617, 21617, 21618, 21618, 21619, 21620, 21620,
+    21620, 21620, 21620, 21620, 21620, 21620, 21627, 21627, 21627, 21630, 21630, 21630, 21630, 21630, 21631, 21631,
+    21631, 21631, 21631, 21631, 21633, 21633, 21633, 21633, 21634, 21635, 21636, 21636, 21637, 21637, 21637, 21638,
+    21638, 21642, 21642, 21643, 21646, 21650, 21650, 21652, 21653, 21653, 21653, 21653, 21653, 21654, 21655, 21655,
+    21655, 21658, 21664, 21664, 21664, 21668, 21671, 21676, 21677, 21678, 21679, 21680, 21682, 21685, 21688, 21689,
+    21690, 21690, 21690, 21690, 21691, 21695, 21696, 21696, 21698, 21698, 21699, 21700, 21700, 21700, 21700, 21700,
+    21700, 21700, 21700, 21700, 21701, 21702, 21702, 21703, 21703, 21703, 21704, 21705, 21705, 21705, 21705, 21705,
+    21705, 21706, 21706, 21706, 21707, 21707, 21710, 21711, 21711, 21711, 21711, 21711, 21711, 21711, 21712, 21713,
+    21714, 21715, 21715, 21715, 21715, 21716, 21716, 21717, 21719, 21722, 21722, 21722, 21722, 21722, 21724, 21724,
+    21724, 21726, 21726, 21726, 21726, 21726, 21727, 21727, 21728, 21728, 21728, 21728, 21728, 21728, 21729, 21730,
+    21730, 21731, 21731, 21731, 21733, 21733, 21734, 21735, 21736, 21736, 21736, 21736, 21737, 21738, 21738, 21738,
+    21738, 21738, 21741, 21741, 21741, 21741, 21741, 21741, 21741, 21741, 21742, 21743, 21744, 21744, 21744, 21744,
+    21744, 21744, 21744, 21744, 21745, 21745, 21745, 21746, 21746, 21746, 21746, 21748, 21749, 21750, 21751, 21752,
+    21752, 21752, 21752, 21753, 21755, 21756, 21758, 21763, 21763, 21763, 21763, 21764, 21764, 21764, 21764, 21765,
+    21765, 21765, 21767, 21767, 21767, 21767, 21767, 21767, 21775, 21775, 21775, 21776, 21776, 21777, 21777, 21777,
+    21777, 21777, 21777, 21779, 21779, 21779, 21780, 21780, 21780, 21780, 21780, 21780, 21780, 21780, 21780, 21781,
+    21781, 21781, 21782, 21782, 21782, 21785, 21785, 21785, 21786, 21788, 21788, 21789, 21789, 21789, 21789, 21789,
+    21789, 21791, 21791, 21791, 21792, 21794, 21795, 21798, 21800, 21800, 21801, 21802, 21804, 21805, 21806, 21807,
+    21808, 21808, 21808, 21808, 21810, 21810, 21810, 21811, 21811, 21811, 21812, 21813, 21814, 21815, 21818, 21819,
+    21820, 21821, 21825, 21826, 21826, 21827, 21827, 21829, 21829, 21829, 21829, 21830, 21831, 21832, 21832, 21833,
+    21834, 21835, 21837, 21837, 21842, 21842, 21844, 21844, 21845, 21845, 21845, 21846, 21846, 21847, 21847, 21851,
+    21851, 21851, 21851, 21852, 21853, 21853, 21856, 21857, 21858, 21859, 21861, 21862, 21862, 21862, 21863, 21863,
+    21863, 21864, 21864, 21865, 21865, 21865, 21865, 21865, 21865, 21866, 21867, 21868, 21868, 21868, 21868, 21869,
+    21870, 21870, 21870, 21870, 21870, 21870, 21870, 21873, 21873, 21874, 21874, 21876, 21876, 21878, 21879, 21879,
+    21879, 21879, 21879, 21879, 21879, 21884, 21884, 21884, 21885, 21885, 21885, 21888, 21888, 21888, 21888, 21888,
+    21888, 21888, 21888, 21888, 21888, 21888, 21888, 21888, 21888, 21889, 21889, 21889, 21889, 21890, 21891, 21896,
+    21897, 21899, 21899, 21899, 21899, 21899, 21899, 21899, 21899, 21899, 21900, 21900, 21900, 21900, 21900, 21900,
+    21901, 21901, 21901, 21901, 21901, 21901, 21902, 21903, 21903, 21903, 21903, 21903, 21903, 21905, 21906, 21906,
+    21906, 21906, 21907, 21907, 21907, 21907, 21907, 21907, 21908, 21908, 21909, 21909, 21909, 21909, 21909, 21909,
+    21914, 21914, 21918, 21918, 21920, 21921, 21927, 21927, 21928, 21930, 21934, 21936, 21936, 21936, 21937, 21937,
+    21937, 21937, 21937, 21944, 21944, 21947, 21950, 21952, 21952, 21952, 21955, 21960, 21961, 21962, 21962, 21966,
+    21967, 21969, 21970, 21971, 21972, 21973, 21975, 21977, 21979, 21979, 21980, 21980, 21980, 21981, 21982, 21985,
+    21986, 21986, 21987, 21988, 21992, 21994, 21994, 21995, 21995, 21995, 21995, 21995, 21995, 21995, 21995, 21996,
+    21996, 21996, 21997, 21997, 21997, 21997, 21998, 21998, 21998, 21998, 21999, 22001, 22002, 22003, 22003, 22005,
+    22005, 22006, 22006, 22009, 22009, 22009, 22009, 22009, 22010, 22010, 22010, 22010, 22010, 22010, 22010, 22011,
+    22011, 22011, 22011, 22011, 22011, 22012, 22012, 22012, 22014, 22016, 22018, 22018, 22018, 22018, 22018, 22018,
+    22018, 22018, 22018, 22021, 22022, 22023, 22025, 22025, 22025, 22025, 22025, 22026, 22026, 22026, 22026, 22026,
+    22026, 22026, 22026, 22027, 22028, 22028, 22028, 22029, 22029, 22029, 22029, 22029, 22029, 22029, 22029, 22029,
+    22029, 22029, 22030, 22031, 22031, 22031, 22031, 22031, 22031, 22031, 22032, 22033, 22033, 22034, 22035, 22035,
+    22035, 22036, 22037, 22037, 22037, 22037, 22038, 22039, 22039, 22039, 22039, 22040, 22040, 22040, 22041, 22041,
+    22041, 22041, 22041, 22041, 22042, 22042, 22042, 22042, 22042, 22042, 22042, 22042, 22042, 22043, 22046, 22047,
+    22047, 22047, 22048, 22049, 22050, 22054, 22058, 22058, 22058, 22058, 22059, 22059, 22059, 22060, 22065, 22065,
+    22068, 22068, 22069, 22069, 22069, 22069, 22071, 22071, 22071, 22072, 22074, 22074, 22078, 22078, 22078, 22078,
+    22078, 22081, 22081, 22083, 22083, 22083, 22083, 22084, 22084, 22084, 22084, 22084, 22084, 22085, 22085, 22085,
+    22085, 22085, 22085, 22086, 22086, 22086, 22090, 22093, 22094, 22094, 22094, 22094, 22096, 22096, 22096, 22096,
+    22097, 22097, 22097, 22099, 22100, 22103, 22103, 22104, 22106, 22106, 22106, 22106, 22107, 22107, 22107, 22107,
+    22107, 22107, 22108, 22109, 22109, 22109, 22109, 22110, 22113, 22114, 22115, 22115, 22116, 22117, 22118, 22119,
+    22122, 22127, 22128, 22132, 22135, 22139, 22140, 22140, 22141, 22141, 22141, 22142, 22142, 22142, 22143, 22143,
+    22145, 22145, 22145, 22145, 22145, 22146, 22146, 22146, 22147, 22147, 22147, 22150, 22150, 22150, 22150, 22150,
+    22150, 22150, 22150, 22153, 22153, 22153, 22154, 22154, 22158, 22161, 22161, 22162, 22162, 22164, 22164, 22165,
+    22166, 22166, 22166, 22166, 22166, 22166, 22166, 22166, 22166, 22166, 22168, 22169, 22171, 22172, 22172, 22172,
+    22173, 22173, 22175, 22178, 22178, 22178, 22178, 22178, 22178, 22178, 22181, 22186, 22186, 22187, 22187, 22187,
+    22191, 22194, 22194, 22194, 22194, 22196, 22197, 22200, 22201, 22201, 22202, 22202, 22203, 22203, 22203, 22203,
+    22204, 22204, 22204, 22204, 22204, 22204, 22205, 22205, 22205, 22206, 22209, 22210, 22211, 22215, 22216, 22216,
+    22216, 22216, 22219, 22220, 22220, 22220, 22220, 22220, 22221, 22222, 22226, 22226, 22227, 22233, 22236, 22237,
+    22238, 22239, 22239, 22240, 22240, 22240, 22240, 22244, 22245, 22245, 22246, 22247, 22247, 22247, 22247, 22247,
+    22249, 22252, 22252, 22254, 22254, 22256, 22256, 22256, 22256, 22257, 22257, 22257, 22257, 22257, 22261, 22263,
+    22263, 22265, 22266, 22266, 22267, 22269, 22273, 22273, 22273, 22274, 22275, 22277, 22277, 22277, 22277, 22277,
+    22279, 22279, 22279, 22279, 22281, 22285, 22286, 22287, 22288, 22289, 22295, 22295, 22295, 22295, 22295, 22295,
+    22295, 22295, 22295, 22295, 22300, 22300, 22306, 22307, 22308, 22310, 22313, 22314, 22314, 22318, 22320, 22321,
+    22324, 22325, 22325, 22325, 22325, 22325, 22327, 22328, 22329, 22329, 22329, 22329, 22329, 22329, 22329, 22330,
+    22330, 22330, 22331, 22331, 22332, 22332, 22333, 22333, 22333, 22333, 22333, 22334, 22334, 22334, 22335, 22335,
+    22336, 22338, 22339, 22339, 22339, 22340, 22341, 22341, 22342, 22342, 22343, 22347, 22348, 22350, 22350, 22350,
+    22350, 22350, 22350, 22350, 22351, 22351, 22351, 22351, 22351, 22351, 22351, 22351, 22351, 22351, 22353, 22354,
+    22354, 22354, 22354, 22354, 22354, 22354, 22356, 22357, 22357, 22357, 22358, 22358, 22359, 22359, 22360, 22360,
+    22363, 22363, 22363, 22364, 22364, 22364, 22364, 22364, 22364, 22364, 22366, 22372, 22380, 22382, 22383, 22383,
+    22383, 22384, 22384, 22384, 22384, 22384, 22384, 22384, 22386, 22389, 22390, 22391, 22392, 22393, 22396, 22396,
+    22396, 22396, 22397, 22398, 22398, 22398, 22398, 22398, 22398, 22398, 22398, 22399, 22400, 22400, 22400, 22401,
+    22402, 22404, 22405, 22406, 22407, 22407, 22407, 22407, 22410, 22411, 22411, 22411, 22411, 22411, 22411, 22411,
+    22411, 22411, 22411, 22411, 22411, 22411, 22411, 22412, 22413, 22413, 22413, 22413, 22415, 22415, 22416, 22417,
+    22421, 22421, 22421, 22422, 22423, 22423, 22423, 22423, 22423, 22423, 22423, 22423, 22423, 22424, 22425, 22425,
+    22425, 22426, 22426, 22426, 22427, 22427, 22429, 22432, 22432, 22432, 22433, 22434, 22434, 22434, 22434, 22434,
+    22434, 22435, 22436, 22437, 22437, 22437, 22437, 22438, 22438, 22439, 22440, 22443, 22443, 22443, 22444, 22444,
+    22444, 22444, 22444, 22444, 22444, 22444, 22444, 22448, 22448, 22450, 22450, 22451, 22454, 22455, 22456, 22457,
+    22457, 22457, 22457, 22457, 22457, 22458, 22458, 22458, 22458, 22458, 22458, 22458, 22459, 22459, 22460, 22460,
+    22461, 22461, 22461, 22461, 22468, 22469, 22469, 22477, 22479, 22480, 22480, 22480, 22480, 22481, 22482, 22483,
+    22484, 22485, 22485, 22485, 22485, 22489, 22489, 22490, 22490, 22490, 22492, 22493, 22496, 22496, 22497, 22497,
+    22497, 22498, 22499, 22499, 22499, 22501, 22502, 22502, 22503, 22504, 22508, 22508, 22509, 22509, 22509, 22509,
+    22509, 22510, 22510, 22512, 22513, 22513, 22513, 22514, 22517, 22518, 22518, 22518, 22518, 22519, 22521, 22523,
+    22524, 22525, 22534, 22535, 22536, 22537, 22537, 22537, 22539, 22540, 22542, 22543, 22543, 22544, 22548, 22551,
+    22551, 22552, 22553, 22555, 22560, 22564, 22566, 22568, 22572, 22574, 22575, 22575, 22576, 22576, 22577, 22577,
+    22577, 22578, 22581, 22581, 22584, 22584, 22585, 22587, 22589, 22589, 22589, 22590, 22591, 22591, 22592, 22593,
+    22599, 22600, 22604, 22606, 22608, 22618, 22620, 22621, 22621, 22622, 22626, 22626, 22626, 22626, 22627, 22628,
+    22628, 22628, 22628, 22628, 22629, 22630, 22631, 22636, 22641, 22644, 22646, 22646, 22647, 22647, 22650, 22651,
+    22655, 22656, 22657, 22657, 22657, 22662, 22662, 22662, 22662, 22663, 22663, 22663, 22666, 22666, 22666, 22666,
+    22666, 22666, 22666, 22666, 22666, 22666, 22666, 22666, 22666, 22666, 22666, 22672, 22674, 22674, 22674, 22674,
+    22674, 22674, 22674, 22674, 22674, 22674, 22675, 22675, 22677, 22677, 22677, 22677, 22677, 22677, 22678, 22678,
+    22678, 22683, 22684, 22684, 22684, 22684, 22684, 22686, 22686, 22687, 22687, 22690, 22691, 22692, 22693, 22693,
+    22693, 22693, 22693, 22693, 22694, 22694, 22696, 22696, 22696, 22696, 22697, 22697, 22697, 22698, 22699, 22699,
+    22699, 22699, 22699, 22700, 22700, 22700, 22700, 22702, 22702, 22702, 22702, 22711, 22711, 22711, 22714, 22714,
+    22714, 22717, 22717, 22717, 22719, 22719, 22719, 22719, 22719, 22719, 22719, 22719, 22719, 22719, 22720, 22720,
+    22722, 22722, 22724, 22724, 22725, 22725, 22725, 22725, 22725, 22725, 22725, 22725, 22725, 22725, 22725, 22725,
+    22725, 22725, 22725, 22725, 22726, 22726, 22726, 22726, 22727, 22730, 22731, 22733, 22733, 22733, 22735, 22735,
+    22735, 22736, 22737, 22737, 22738, 22739, 22740, 22741, 22742, 22743, 22745, 22745, 22745, 22746, 22748, 22748,
+    22751, 22751, 22751, 22752, 22752, 22756, 22758, 22758, 22758, 22758, 22758, 22758, 22758, 22758, 22758, 22758,
+    22758, 22759, 22759, 22759, 22759, 22759, 22759, 22760, 22761, 22763, 22764, 22768, 22770, 22770, 22770, 22770,
+    22770, 22770, 22770, 22770, 22770, 22771, 22771, 22771, 22774, 22775, 22775, 22777, 22777, 22778, 22778, 22778,
+    22780, 22782, 22782, 22782, 22782, 22783, 22784, 22785, 22786, 22786, 22788, 22791, 22792, 22792, 22793, 22793,
+    22793, 22800, 22800, 22801, 22801, 22803, 22804, 22805, 22805, 22805, 22808, 22808, 22813, 22813, 22814, 22814,
+    22816, 22816, 22816, 22818, 22818, 22818, 22818, 22818, 22818, 22827, 22830, 22831, 22831, 22831, 22831, 22831,
+    22831, 22833, 22834, 22838, 22838, 22839, 22839, 22841, 22841, 22842, 22844, 22846, 22846, 22846, 22847, 22847,
+    22848, 22850, 22852, 22854, 22859, 22861, 22865, 22866, 22868, 22869, 22869, 22870, 22871, 22871, 22871, 22871,
+    22872, 22872, 22872, 22872, 22872, 22873, 22873, 22875, 22876, 22876, 22877, 22878, 22879, 22880, 22880, 22880,
+    22881, 22881, 22881, 22881, 22882, 22882, 22889, 22890, 22893, 22896, 22897, 22897, 22897, 22899, 22899, 22900,
+    22901, 22902, 22903, 22906, 22909, 22910, 22910, 22911, 22912, 22912, 22913, 22913, 22913, 22913, 22914, 22915,
+    22916, 22918, 22919, 22919, 22920, 22925, 22925, 22926, 22926, 22926, 22926, 22927, 22927, 22927, 22928, 22928,
+    22928, 22929, 22931, 22932, 22934, 22935, 22936, 22936, 22936, 22937, 22937, 22937, 22937, 22937, 22937, 22938,
+    22945, 22946, 22946, 22946, 22947, 22947, 22949, 22950, 22950, 22951, 22951, 22952, 22952, 22953, 22953, 22954,
+    22955, 22955, 22955, 22955, 22956, 22956, 22958, 22959, 22959, 22959, 22959, 22959, 22959, 22959, 22959, 22961,
+    22961, 22961, 22962, 22965, 22966, 22967, 22969, 22969, 22970, 22970, 22974, 22974, 22975, 22975, 22975, 22976,
+    22976, 22977, 22978, 22986, 22987, 22987, 22988, 22988, 22989, 22989, 22989, 22990, 22991, 22991, 22994, 22996,
+    22997, 22999, 22999, 23002, 23003, 23004, 23005, 23005, 23005, 23005, 23005, 23005, 23005, 23005, 23006, 23007,
+    23007, 23007, 23008, 23008, 23008, 23010, 23011, 23012, 23012, 23012, 23012, 23012, 23014, 23018, 23020, 23022,
+    23022, 23022, 23023, 23023, 23023, 23025, 23025, 23028, 23029, 23030, 23030, 23030, 23030, 23033, 23035, 23035,
+    23035, 23035, 23035, 23037, 23038, 23039, 23039, 23039, 23039, 23039, 23039, 23040, 23041, 23041, 23041, 23041,
+    23044, 23044, 23046, 23049, 23050, 23050, 23050, 23053, 23059, 23060, 23061, 23062, 23063, 23063, 23063, 23063,
+    23064, 23064, 23064, 23065, 23066, 23066, 23069, 23074, 23075, 23075, 23076, 23076, 23077, 23077, 23083, 23085,
+    23087, 23088, 23090, 23093, 23093, 23093, 23093, 23093, 23094, 23095, 23096, 23098, 23100, 23100, 23101, 23101,
+    23103, 23103, 23104, 23105, 23105, 23106, 23106, 23107, 23107, 23107, 23107, 23108, 23109, 23113, 23113, 23113,
+    23113, 23119, 23122, 23122, 23122, 23124, 23125, 23125, 23127, 23127, 23127, 23127, 23128, 23129, 23130, 23130,
+    23130, 23130, 23131, 23131, 23131, 23131, 23131, 23131, 23131, 23131, 23131, 23131, 23131, 23131, 23133, 23133,
+    23134, 23134, 23134, 23135, 23135, 23135, 23135, 23135, 23135, 23135, 23136, 23136, 23136, 23136, 23136, 23136,
+    23136, 23137, 23137, 23137, 23137, 23137, 23137, 23137, 23137, 23137, 23137, 23137, 23138, 23140, 23141, 23141,
+    23141, 23141, 23141, 23141, 23142, 23142, 23144, 23144, 23144, 23144, 23144, 23144, 23144, 23144, 23145, 23145,
+    23145, 23146, 23146, 23146, 23146, 23146, 23147, 23147, 23148, 23151, 23153, 23153, 23154, 23156, 23156, 23157,
+    23157, 23157, 23158, 23159, 23159, 23160, 23160, 23160, 23160, 23161, 23161, 23161, 23161, 23161, 23163, 23163,
+    23164, 23164, 23166, 23166, 23175, 23175, 23175, 23175, 23177, 23178, 23180, 23183, 23187, 23188, 23189, 23189,
+    23189, 23189, 23190, 23190, 23190, 23190, 23191, 23191, 23191, 23191, 23191, 23191, 23192, 23192, 23194, 23194,
+    23195, 23195, 23196, 23197, 23198, 23200, 23201, 23202, 23203, 23206, 23207, 23211, 23215, 23217, 23218, 23222,
+    23223, 23224, 23224, 23224, 23225, 23225, 23225, 23227, 23229, 23229, 23231, 23233, 23235, 23235, 23237, 23238,
+    23239, 23241, 23242, 23244, 23245, 23248, 23249, 23250, 23250, 23250, 23250, 23250, 23250, 23250, 23251, 23251,
+    23253, 23254, 23255, 23256, 23256, 23256, 23256, 23256, 23259, 23261, 23263, 23264, 23265, 23266, 23268, 23268,
+    23269, 23270, 23272, 23274, 23279, 23279, 23280, 23282, 23284, 23284, 23286, 23286, 23287, 23287, 23287, 23287,
+    23288, 23288, 23288, 23288, 23288, 23288, 23288, 23288, 23288, 23289, 23291, 23297, 23297, 23297, 23298, 23298,
+    23298, 23298, 23298, 23298, 23298, 23298, 23298, 23299, 23301, 23302, 23303, 23304, 23304, 23304, 23305, 23305,
+    23305, 23305, 23306, 23306, 23306, 23306, 23307, 23307, 23307, 23307, 23307, 23307, 23309, 23309, 23309, 23310,
+    23310, 23310, 23310, 23311, 23316, 23316, 23316, 23316, 23317, 23318, 23318, 23318, 23318, 23318, 23318, 23318,
+    23318, 23318, 23318, 23318, 23318, 23318, 23319, 23320, 23320, 23320, 23320, 23320, 23320, 23320, 23321, 23321,
+    23322, 23322, 23322, 23322, 23322, 23322, 23322, 23322, 23322, 23322, 23323, 23323, 23323, 23323, 23323, 23323,
+    23323, 23323, 23323, 23323, 23323, 23323, 23324, 23324, 23325, 23328, 23328, 23332, 23334, 23336, 23338, 23340,
+    23340, 23340, 23343, 23343, 23345, 23345, 23345, 23346, 23346, 23346, 23348, 23349, 23352, 23352, 23352, 23354,
+    23354, 23354, 23355, 23355, 23356, 23357, 23357, 23358, 23358, 23358, 23359, 23359, 23362, 23362, 23362, 23362,
+    23362, 23362, 23362, 23365, 23365, 23365, 23366, 23367, 23367, 23367, 23367, 23370, 23373, 23374, 23374, 23374,
+    23375, 23375, 23375, 23375, 23375, 23375, 23377, 23378, 23378, 23378, 23379, 23379, 23381, 23382, 23382, 23386,
+    23386, 23386, 23390, 23392, 23392, 23393, 23393, 23393, 23393, 23393, 23393, 23393, 23394, 23395, 23398, 23400,
+    23402, 23404, 23406, 23406, 23411, 23419, 23419, 23419, 23419, 23421, 23422, 23422, 23422, 23424, 23426, 23428,
+    23429, 23431, 23433, 23435, 23438, 23439, 23441, 23444, 23444, 23444, 23444, 23445, 23446, 23447, 23449, 23450,
+    23450, 23450, 23451, 23451, 23451, 23451, 23451, 23451, 23451, 23451, 23451, 23451, 23451, 23453, 23455, 23455,
+    23455, 23455, 23455, 23455, 23455, 23455, 23458, 23458, 23459, 23459, 23460, 23460, 23461, 23463, 23463, 23463,
+    23463, 23463, 23463, 23463, 23464, 23464, 23464, 23464, 23464, 23465, 23465, 23466, 23468, 23468, 23469, 23469,
+    23469, 23470, 23471, 23472, 23473, 23473, 23474, 23474, 23474, 23474, 23477, 23477, 23477, 23479, 23480, 23480,
+    23480, 23480, 23480, 23480, 23480, 23482, 23482, 23482, 23482, 23482, 23483, 23483, 23483, 23483, 23483, 23483,
+    23484, 23484, 23484, 23485, 23486, 23486, 23486, 23486, 23486, 23486, 23486, 23487, 23487, 23487, 23487, 23488,
+    23488, 23489, 23489, 23489, 23489, 23489, 23489, 23489, 23489, 23490, 23490, 23490, 23490, 23490, 23490, 23492,
+    23492, 23492, 23492, 23492, 23492, 23492, 23493, 23493, 23493, 23494, 23494, 23494, 23494, 23496, 23496, 23497,
+    23497, 23497, 23500, 23500, 23501, 23502, 23502, 23502, 23502, 23505, 23506, 23506, 23506, 23507, 23507, 23508,
+    23508, 23508, 23508, 23509, 23509, 23509, 23509, 23509, 23509, 23510, 23511, 23511, 23511, 23511, 23513, 23513,
+    23517, 23517, 23517, 23523, 23524, 23524, 23525, 23525, 23525, 23525, 23526, 23526, 23527, 23527, 23528, 23528,
+    23528, 23528, 23528, 23528, 23529, 23529, 23529, 23529, 23529, 23529, 23529, 23530, 23530, 23530, 23530, 23530,
+    23531, 23531, 23531, 23531, 23531, 23532, 23532, 23532, 23535, 23538, 23545, 23545, 23545, 23545, 23545, 23545,
+    23545, 23545, 23545, 23545, 23545, 23547, 23548, 23548, 23549, 23550, 23550, 23553, 23555, 23557, 23559, 23560,
+    23563, 23564, 23565, 23565, 23566, 23566, 23568, 23568, 23569, 23569, 23569, 23570, 23572, 23573, 23574, 23575,
+    23578, 23585, 23586, 23586, 23586, 23587, 23591, 23592, 23593, 23594, 23594, 23597, 23598, 23599, 23600, 23600,
+    23600, 23602, 23603, 23604, 23605, 23605, 23605, 23606, 23607, 23608, 23608, 23608, 23608, 23608, 23608, 23608,
+    23608, 23608, 23608, 23610, 23610, 23610, 23610, 23610, 23610, 23612, 23612, 23613, 23613, 23613, 23613, 23614,
+    23615, 23616, 23616, 23616, 23619, 23619, 23620, 23621, 23621, 23621, 23621, 23621, 23621, 23621, 23621, 23621,
+    23621, 23621, 23621, 23621, 23621, 23621, 23621, 23622, 23622, 23623, 23623, 23623, 23623, 23625, 23625, 23625,
+    23626, 23627, 23627, 23628, 23628, 23628, 23628, 23629, 23630, 23631, 23631, 23631, 23632, 23632, 23632, 23632,
+    23632, 23632, 23632, 23632, 23633, 23633, 23633, 23633, 23633, 23633, 23633, 23633, 23634, 23634, 23635, 23635,
+    23635, 23636, 23636, 23636, 23637, 23637, 23637, 23638, 23638, 23640, 23640, 23640, 23640, 23641, 23643, 23643,
+    23644, 23644, 23645, 23646, 23650, 23654, 23656, 23656, 23658, 23660, 23660, 23660, 23661, 23661, 23662, 23663,
+    23663, 23664, 23664, 23664, 23664, 23664, 23665, 23666, 23666, 23670, 23670, 23670, 23671, 23672, 23673, 23675,
+    23675, 23675, 23676, 23676, 23679, 23679, 23679, 23681, 23681, 23681, 23681, 23683, 23687, 23687, 23688, 23689,
+    23689, 23689, 23689, 23689, 23691, 23692, 23697, 23698, 23698, 23702, 23705, 23706, 23707, 23718, 23720, 23720,
+    23721, 23721, 23721, 23722, 23723, 23724, 23724, 23726, 23729, 23729, 23730, 23730, 23731, 23732, 23733, 23733,
+    23733, 23733, 23733, 23733, 23734, 23735, 23735, 23735, 23735, 23735, 23735, 23735, 23735, 23738, 23738, 23738,
+    23738, 23739, 23740, 23742, 23742, 23745, 23745, 23746, 23746, 23746, 23746, 23746, 23746, 23747, 23747, 23747,
+    23747, 23747, 23747, 23747, 23748, 23750, 23751, 23752, 23753, 23753, 23754, 23756, 23757, 23759, 23762, 23770,
+    23773, 23773, 23773, 23774, 23774, 23774, 23775, 23775, 23777, 23778, 23780, 23780, 23781, 23782, 23782, 23782,
+    23782, 23782, 23782, 23782, 23783, 23783, 23783, 23783, 23783, 23783, 23783, 23784, 23784, 23785, 23788, 23788,
+    23788, 23788, 23790, 23791, 23791, 23791, 23791, 23791, 23792, 23793, 23793, 23793, 23794, 23794, 23797, 23797,
+    23797, 23797, 23798, 23807, 23812, 23815, 23816, 23816, 23817, 23817, 23817, 23822, 23823, 23823, 23823, 23824,
+    23827, 23828, 23828, 23828, 23829, 23829, 23832, 23833, 23836, 23839, 23840, 23842, 23843, 23846, 23853, 23854,
+    23854, 23854, 23854, 23854, 23854, 23854, 23854, 23854, 23858, 23864, 23868, 23873, 23874, 23875, 23880, 23881,
+    23882, 23884, 23886, 23889, 23890, 23893, 23896, 23896, 23896, 23896, 23897, 23899, 23899, 23899, 23901, 23902,
+    23907, 23907, 23907, 23907, 23909, 23910, 23910, 23911, 23915, 23915, 23915, 23915, 23915, 23916, 23917, 23917,
+    23918, 23920, 23920, 23920, 23920, 23922, 23922, 23924, 23925, 23925, 23925, 23925, 23926, 23927, 23927, 23927,
+    23928, 23929, 23929, 23929, 23929, 23929, 23929, 23931, 23932, 23933, 23933, 23933, 23933, 23934, 23934, 23934,
+    23935, 23936, 23937, 23937, 23938, 23939, 23939, 23939, 23939, 23939, 23939, 23940, 23944, 23947, 23949, 23950,
+    23951, 23951, 23953, 23954, 23955, 23956, 23958, 23958, 23958, 23960, 23960, 23960, 23960, 23961, 23962, 23966,
+    23966, 23966, 23968, 23968, 23970, 23971, 23978, 23978, 23978, 23978, 23978, 23978, 23978, 23978, 23978, 23978,
+    23979, 23980, 23980, 23982, 23982, 23982, 23982, 23983, 23983, 23983, 23985, 23987, 23988, 23988, 23990, 23991,
+    23991, 23991, 23992, 23993, 23993, 23995, 23995, 23995, 23996, 23998, 24000, 24001, 24001, 24002, 24003, 24004,
+    24004, 24004, 24005, 24005, 24009, 24011, 24013, 24018, 24019, 24021, 24023, 24023, 24024, 24025, 24026, 24026,
+    24029, 24030, 24034, 24034, 24042, 24042, 24043, 24044, 24045, 24048, 24049, 24049, 24049, 24050, 24052, 24052,
+    24052, 24053, 24054, 24055, 24056, 24056, 24057, 24057, 24057, 24058, 24058, 24058, 24058, 24058, 24059, 24060,
+    24060, 24061, 24062, 24063, 24064, 24064, 24065, 24065, 24065, 24068, 24069, 24069, 24071, 24071, 24072, 24072,
+    24072, 24073, 24073, 24073, 24074, 24075, 24076, 24077, 24077, 24077, 24077, 24077, 24077, 24077, 24078, 24078,
+    24078, 24079, 24080, 24080, 24080, 24080, 24081, 24082, 24082, 24082, 24082, 24082, 24082, 24082, 24082, 24082,
+    24083, 24083, 24084, 24084, 24084, 24085, 24085, 24087, 24087, 24087, 24087, 24088, 24088, 24088, 24088, 24088,
+    24088, 24088, 24088, 24089, 24091, 24094, 24094, 24094, 24095, 24096, 24096, 24096, 24097, 24097, 24097, 24097,
+    24097, 24098, 24099, 24099, 24099, 24099, 24099, 24099, 24099, 24102, 24103, 24106, 24108, 24111, 24111, 24112,
+    24114, 24121, 24122, 24123, 24123, 24123, 24124, 24125, 24126, 24126, 24126, 24127, 24128, 24128, 24130, 24130,
+    24131, 24132, 24137, 24145, 24148, 24150, 24153, 24153, 24154, 24155, 24155, 24155, 24157, 24157, 24159, 24159,
+    24160, 24160, 24161, 24163, 24165, 24165, 24167, 24168, 24169, 24170, 24170, 24171, 24174, 24175, 24176, 24179,
+    24186, 24188, 24189, 24191, 24191, 24191, 24191, 24192, 24193, 24193, 24193, 24193, 24196, 24196, 24197, 24199,
+    24200, 24201, 24202, 24202, 24204, 24205, 24207, 24208, 24208, 24208, 24208, 24210, 24210, 24210, 24210, 24210,
+    24210, 24210, 24210, 24210, 24210, 24210, 24210, 24210, 24213, 24213, 24216, 24216, 24216, 24216, 24216, 24217,
+    24217, 24217, 24218, 24218, 24219, 24219, 24219, 24219, 24219, 24219, 24219, 24219, 24221, 24221, 24221, 24221,
+    24221, 24221, 24221, 24221, 24222, 24222, 24222, 24222, 24222, 24222, 24223, 24224, 24224, 24224, 24224, 24224,
+    24224, 24224, 24224, 24230, 24233, 24233, 24235, 24238, 24241, 24241, 24242, 24242, 24242, 24242, 24243, 24243,
+    24243, 24243, 24243, 24243, 24244, 24245, 24246, 24247, 24247, 24248, 24248, 24249, 24249, 24250, 24251, 24251,
+    24251, 24251, 24251, 24251, 24251, 24251, 24253, 24253, 24253, 24253, 24253, 24253, 24253, 24253, 24253, 24253,
+    24253, 24253, 24253, 24253, 24254, 24255, 24255, 24256, 24256, 24256, 24256, 24256, 24256, 24257, 24257, 24259,
+    24259, 24259, 24259, 24262, 24262, 24263, 24265, 24266, 24266, 24266, 24266, 24266, 24266, 24276, 24276, 24277,
+    24277, 24277, 24277, 24278, 24278, 24279, 24280, 24280, 24285, 24287, 24288, 24289, 24291, 24291, 24291, 24292,
+    24292, 24293, 24293, 24297, 24297, 24298, 24298, 24300, 24301, 24304, 24304, 24305, 24306, 24306, 24308, 24310,
+    24310, 24310, 24311, 24311, 24311, 24313, 24313, 24313, 24313, 24313, 24314, 24315, 24315, 24318, 24319, 24319,
+    24319, 24319, 24319, 24319, 24321, 24326, 24326, 24328, 24330, 24332, 24333, 24335, 24336, 24337, 24337, 24337,
+    24337, 24337, 24337, 24338, 24339, 24339, 24339, 24342, 24343, 24344, 24344, 24344, 24344, 24344, 24345, 24345,
+    24345, 24346, 24347, 24347, 24347, 24347, 24348, 24348, 24349, 24349, 24349, 24350, 24350, 24350, 24351, 24352,
+    24353, 24353, 24353, 24353, 24356, 24357, 24359, 24359, 24360, 24364, 24365, 24366, 24366, 24367, 24368, 24369,
+    24370, 24370, 24370, 24375, 24376, 24377, 24379, 24380, 24380, 24381, 24384, 24388, 24388, 24388, 24388, 24388,
+    24391, 24394, 24394, 24395, 24397, 24398, 24399, 24402, 24403, 24404, 24405, 24406, 24408, 24413, 24414, 24415,
+    24415, 24416, 24416, 24417, 24418, 24418, 24418, 24419, 24419, 24419, 24419, 24419, 24419, 24419, 24419, 24420,
+    24420, 24420, 24421, 24422, 24424, 24426, 24426, 24429, 24429, 24431, 24432, 24433, 24433, 24433, 24433, 24433,
+    24434, 24435, 24435, 24435, 24435, 24435, 24435, 24437, 24439, 24442, 24443, 24445, 24445, 24446, 24447, 24448,
+    24448, 24449, 24449, 24449, 24449, 24449, 24449, 24449, 24450, 24451, 24451, 24451, 24453, 24456, 24456, 24456,
+    24456, 24456, 24456, 24457, 24458, 24458, 24458, 24458, 24458, 24458, 24458, 24460, 24461, 24462, 24462, 24462,
+    24462, 24463, 24464, 24467, 24469, 24472, 24472, 24473, 24474, 24474, 24478, 24480, 24481, 24481, 24481, 24481,
+    24481, 24481, 24483, 24483, 24483, 24483, 24483, 24483, 24484, 24485, 24485, 24485, 24485, 24486, 24486, 24486,
+    24486, 24487, 24487, 24487, 24487, 24487, 24487, 24490, 24491, 24491, 24494, 24496, 24496, 24496, 24497, 24497,
+    24497, 24500, 24502, 24502, 24503, 24503, 24505, 24505, 24505, 24505, 24505, 24506, 24507, 24508, 24510, 24510,
+    24510, 24511, 24512, 24516, 24517, 24517, 24518, 24518, 24519, 24519, 24519, 24519, 24519, 24519, 24520, 24520,
+    24520, 24520, 24520, 24521, 24522, 24524, 24525, 24525, 24525, 24526, 24527, 24528, 24529, 24529, 24529, 24532,
+    24533, 24533, 24534, 24534, 24534, 24534, 24535, 24535, 24535, 24535, 24535, 24536, 24537, 24537, 24539, 24540,
+    24542, 24551, 24552, 24552, 24552, 24552, 24552, 24552, 24552, 24552, 24553, 24554, 24554, 24554, 24554, 24554,
+    24554, 24555, 24556, 24558, 24560, 24560, 24561, 24561, 24561, 24562, 24562, 24562, 24563, 24563, 24563, 24563,
+    24564, 24565, 24566, 24566, 24567, 24569, 24569, 24569, 24570, 24570, 24570, 24570, 24572, 24572, 24573, 24574,
+    24575, 24575, 24576, 24577, 24577, 24577, 24577, 24577, 24578, 24579, 24579, 24580, 24580, 24580, 24581, 24582,
+    24583, 24584, 24585, 24585, 24585, 24585, 24586, 24587, 24587, 24587, 24587, 24591, 24592, 24592, 24594, 24594,
+    24594, 24594, 24594, 24595, 24595, 24596, 24596, 24597, 24597, 24597, 24597, 24597, 24597, 24597, 24598, 24598,
+    24598, 24598, 24599, 24599, 24599, 24599, 24601, 24602, 24603, 24610, 24610, 24611, 24612, 24613, 24614, 24615,
+    24617, 24617, 24617, 24617, 24618, 24622, 24623, 24623, 24623, 24623, 24624, 24625, 24625, 24626, 24626, 24626,
+    24627, 24627, 24627, 24627, 24627, 24627, 24627, 24628, 24628, 24628, 24628, 24628, 24629, 24629, 24631, 24631,
+    24631, 24632, 24633, 24634, 24634, 24635, 24635, 24635, 24635, 24635, 24635, 24635, 24635, 24636, 24637, 24638,
+    24640, 24640, 24640, 24641, 24641, 24641, 24643, 24645, 24647, 24647, 24648, 24650, 24650, 24650, 24651, 24652,
+    24654, 24654, 24654, 24664, 24664, 24665, 24666, 24667, 24667, 24667, 24667, 24667, 24668, 24668, 24668, 24668,
+    24668, 24668, 24668, 24668, 24669, 24674, 24674, 24675, 24676, 24677, 24677, 24678, 24679, 24679, 24680, 24683,
+    24684, 24686, 24686, 24693, 24695, 24696, 24696, 24697, 24697, 24697, 24697, 24698, 24699, 24700, 24701, 24702,
+    24705, 24705, 24706, 24708, 24710, 24710, 24711, 24712, 24712, 24712, 24712, 24713, 24714, 24714, 24714, 24714,
+    24714, 24714, 24714, 24714, 24714, 24714, 24714, 24715, 24716, 24718, 24718, 24718, 24718, 24718, 24718, 24718,
+    24718, 24718, 24718, 24718, 24722, 24722, 24722, 24722, 24722, 24723, 24724, 24726, 24730, 24730, 24731, 24731,
+    24731, 24731, 24731, 24734, 24736, 24736, 24738, 24738, 24738, 24738, 24738, 24738, 24738, 24738, 24738, 24738,
+    24738, 24739, 24739, 24739, 24750, 24755, 24755, 24760, 24760, 24760, 24760, 24760, 24760, 24761, 24761, 24764,
+    24775, 24775, 24775, 24775, 24776, 24776, 24776, 24776, 24776, 24776, 24777, 24777, 24777, 24778, 24778, 24778,
+    24788, 24790, 24791, 24794, 24797, 24798, 24799, 24799, 24799, 24801, 24803, 24804, 24808, 24809, 24812, 24813,
+    24814, 24814, 24815, 24816, 24818, 24818, 24820, 24822, 24822, 24822, 24823, 24825, 24826, 24827, 24831, 24832,
+    24838, 24839, 24841, 24842, 24845, 24845, 24847, 24847, 24848, 24848, 24848, 24848, 24848, 24848, 24849, 24850,
+    24851, 24851, 24851, 24851, 24851, 24851, 24852, 24852, 24852, 24853, 24853, 24854, 24854, 24854, 24854, 24854,
+    24856, 24859, 24860, 24860, 24861, 24863, 24865, 24869, 24871, 24871, 24871, 24871, 24872, 24873, 24875, 24876,
+    24876, 24876, 24877, 24877, 24877, 24878, 24878, 24881, 24882, 24883, 24884, 24887, 24887, 24887, 24888, 24889,
+    24889, 24890, 24890, 24890, 24890, 24890, 24890, 24892, 24892, 24892, 24892, 24892, 24893, 24895, 24897, 24898,
+    24898, 24899, 24899, 24899, 24901, 24902, 24902, 24903, 24905, 24905, 24906, 24908, 24909, 24910, 24910, 24910,
+    24910, 24910, 24910, 24910, 24912, 24912, 24912, 24912, 24913, 24913, 24913, 24914, 24914, 24915, 24915, 24915,
+    24915, 24915, 24915, 24915, 24915, 24916, 24917, 24917, 24919, 24920, 24921, 24923, 24924, 24924, 24924, 24924,
+    24924, 24924, 24924, 24924, 24924, 24928, 24929, 24929, 24930, 24931, 24932, 24933, 24934, 24935, 24936, 24938,
+    24938, 24939, 24940, 24942, 24945, 24947, 24947, 24947, 24949, 24951, 24954, 24955, 24955, 24956, 24957, 24959,
+    24960, 24961, 24964, 24965, 24970, 24971, 24972, 24973, 24974, 24974, 24975, 24975, 24978, 24982, 24984, 24985,
+    24988, 24989, 24990, 24990, 24991, 24991, 24991, 24991, 24991, 24992, 24993, 24993, 24994, 24995, 24996, 24998,
+    24998, 24999, 24999, 24999, 25001, 25004, 25005, 25015, 25016, 25016, 25016, 25018, 25019, 25019, 25019, 25020,
+    25021, 25021, 25021, 25023, 25023, 25023, 25023, 25024, 25024, 25025, 25025, 25026, 25026, 25030, 25030, 25032,
+    25032, 25032, 25032, 25032, 25032, 25033, 25033, 25033, 25033, 25034, 25036, 25036, 25036, 25036, 25036, 25036,
+    25036, 25036, 25036, 25036, 25037, 25037, 25037, 25037, 25041, 25041, 25045, 25045, 25045, 25045, 25045, 25046,
+    25046, 25046, 25046, 25046, 25046, 25046, 25046, 25046, 25049, 25049, 25051, 25055, 25056, 25057, 25058, 25058,
+    25058, 25059, 25059, 25059, 25059, 25059, 25060, 25061, 25062, 25063, 25063, 25064, 25065, 25065, 25066, 25066,
+    25069, 25071, 25073, 25073, 25074, 25077, 25077, 25077, 25082, 25082, 25082, 25084, 25085, 25086, 25087, 25089,
+    25090, 25101, 25103, 25103, 25104, 25105, 25106, 25106, 25107, 25111, 25112, 25114, 25115, 25116, 25117, 25118,
+    25118, 25119, 25119, 25120, 25120, 25121, 25121, 25123, 25125, 25129, 25129, 25131, 25131, 25134, 25134, 25142,
+    25147, 25151, 25154, 25156, 25157, 25159, 25160, 25160, 25160, 25164, 25165, 25165, 25166, 25166, 25168, 25168,
+    25169, 25173, 25177, 25183, 25184, 25185, 25185, 25185, 25186, 25189, 25190, 25191, 25193, 25201, 25204, 25205,
+    25206, 25206, 25207, 25208, 25209, 25209, 25210, 25210, 25210, 25211, 25215, 25216, 25217, 25217, 25218, 25219,
+    25221, 25221, 25223, 25228, 25231, 25233, 25233, 25234, 25236, 25236, 25236, 25237, 25237, 25237, 25237, 25238,
+    25238, 25238, 25238, 25238, 25238, 25238, 25238, 25238, 25238, 25240, 25240, 25240, 25240, 25240, 25240, 25240,
+    25240, 25240, 25240, 25240, 25240, 25240, 25240, 25240, 25241, 25241, 25241, 25241, 25241, 25241, 25241, 25241,
+    25241, 25241, 25241, 25241, 25241, 25241, 25242, 25243, 25243, 25243, 25243, 25243, 25244, 25245, 25245, 25245,
+    25247, 25247, 25247, 25247, 25247, 25248, 25251, 25257, 25258, 25259, 25260, 25260, 25262, 25265, 25265, 25265,
+    25265, 25265, 25266, 25267, 25267, 25267, 25267, 25267, 25267, 25267, 25267, 25267, 25267, 25267, 25267, 25268,
+    25269, 25269, 25269, 25269, 25269, 25269, 25269, 25269, 25271, 25271, 25272, 25272, 25272, 25272, 25272, 25272,
+    25272, 25272, 25272, 25272, 25273, 25273, 25273, 25273, 25273, 25274, 25276, 25282, 25282, 25282, 25283, 25283,
+    25284, 25284, 25284, 25284, 25284, 25284, 25285, 25285, 25285, 25285, 25285, 25285, 25286, 25286, 25286, 25286,
+    25286, 25288, 25294, 25295, 25295, 25295, 25295, 25295, 25295, 25295, 25297, 25297, 25297, 25299, 25300, 25301,
+    25302, 25303, 25303, 25303, 25303, 25304, 25305, 25305, 25307, 25307, 25307, 25307, 25307, 25307, 25308, 25308,
+    25308, 25308, 25308, 25308, 25308, 25308, 25308, 25308, 25308, 25308, 25308, 25309, 25309, 25309, 25309, 25309,
+    25309, 25310, 25311, 25311, 25311, 25312, 25312, 25313, 25315, 25315, 25315, 25315, 25318, 25318, 25318, 25319,
+    25319, 25319, 25319, 25319, 25319, 25319, 25320, 25321, 25322, 25324, 25324, 25324, 25325, 25325, 25325, 25325,
+    25325, 25325, 25327, 25327, 25329, 25331, 25332, 25332, 25333, 25334, 25334, 25334, 25334, 25335, 25335, 25337,
+    25338, 25338, 25339, 25339, 25341, 25345, 25345, 25346, 25350, 25351, 25352, 25352, 25352, 25352, 25354, 25355,
+    25355, 25355, 25355, 25356, 25357, 25357, 25358, 25362, 25364, 25365, 25366, 25366, 25366, 25366, 25367, 25367,
+    25367, 25367, 25367, 25368, 25368, 25368, 25368, 25370, 25371, 25371, 25371, 25371, 25371, 25372, 25372, 25372,
+    25373, 25373, 25374, 25376, 25377, 25377, 25378, 25379, 25385, 25386, 25386, 25386, 25386, 25386, 25386, 25388,
+    25389, 25390, 25390, 25391, 25391, 25393, 25393, 25394, 25394, 25395, 25395, 25395, 25397, 25397, 25398, 25398,
+    25399, 25399, 25399, 25400, 25405, 25411, 25413, 25413, 25413, 25414, 25414, 25415, 25415, 25416, 25417, 25418,
+    25419, 25419, 25419, 25419, 25420, 25421, 25423, 25426, 25426, 25428, 25429, 25429, 25429, 25430, 25430, 25430,
+    25431, 25433, 25433, 25437, 25437, 25438, 25438, 25442, 25442, 25442, 25442, 25442, 25444, 25444, 25444, 25444,
+    25445, 25445, 25445, 25446, 25448, 25448, 25449, 25451, 25452, 25453, 25454, 25456, 25457, 25457, 25457, 25457,
+    25457, 25458, 25459, 25462, 25471, 25472, 25472, 25473, 25473, 25473, 25474, 25474, 25475, 25476, 25476, 25481,
+    25482, 25482, 25483, 25484, 25484, 25484, 25484, 25485, 25487, 25487, 25487, 25488, 25491, 25493, 25493, 25493,
+    25495, 25495, 25499, 25499, 25500, 25500, 25500, 25500, 25501, 25501, 25501, 25501, 25501, 25501, 25501, 25501,
+    25501, 25501, 25501, 25502, 25502, 25502, 25503, 25504, 25504, 25505, 25506, 25507, 25507, 25507, 25507, 25507,
+    25507, 25507, 25508, 25508, 25510, 25510, 25511, 25511, 25512, 25514, 25514, 25514, 25514, 25514, 25515, 25515,
+    25516, 25516, 25516, 25517, 25518, 25518, 25518, 25518, 25518, 25518, 25518, 25518, 25518, 25518, 25519, 25521,
+    25521, 25522, 25525, 25526, 25531, 25531, 25532, 25532, 25533, 25534, 25534, 25534, 25534, 25534, 25534, 25537,
+    25537, 25540, 25543, 25543, 25543, 25543, 25544, 25544, 25544, 25544, 25544, 25544, 25545, 25545, 25546, 25546,
+    25547, 25548, 25549, 25552, 25553, 25553, 25554, 25555, 25555, 25556, 25557, 25559, 25561, 25561, 25561, 25561,
+    25561, 25564, 25564, 25566, 25567, 25567, 25567, 25568, 25568, 25568, 25571, 25573, 25574, 25576, 25577, 25580,
+    25581, 25582, 25582, 25582, 25583, 25584, 25586, 25586, 25586, 25586, 25586, 25586, 25586, 25586, 25586, 25586,
+    25586, 25586, 25590, 25594, 25595, 25596, 25598, 25601, 25602, 25602, 25602, 25602, 25603, 25603, 25603, 25603,
+    25603, 25604, 25604, 25604, 25604, 25604, 25604, 25607, 25607, 25607, 25608, 25608, 25608, 25609, 25609, 25609,
+    25609, 25609, 25610, 25610, 25610, 25610, 25610, 25610, 25611, 25611, 25612, 25613, 25614, 25615, 25616, 25619,
+    25623, 25625, 25626, 25627, 25628, 25628, 25632, 25637, 25637, 25640, 25643, 25647, 25649, 25649, 25649, 25649,
+    25651, 25651, 25651, 25651, 25651, 25652, 25653, 25654, 25654, 25658, 25660, 25662, 25664, 25667, 25667, 25668,
+    25668, 25668, 25668, 25668, 25668, 25669, 25669, 25669, 25670, 25671, 25671, 25674, 25674, 25675, 25676, 25677,
+    25678, 25679, 25680, 25680, 25682, 25685, 25687, 25690, 25690, 25691, 25691, 25694, 25695, 25695, 25695, 25695,
+    25695, 25696, 25698, 25699, 25700, 25701, 25702, 25703, 25703, 25703, 25703, 25703, 25703, 25703, 25703, 25704,
+    25704, 25704, 25704, 25705, 25706, 25706, 25707, 25707, 25709, 25712, 25712, 25712, 25712, 25712, 25712, 25712,
+    25712, 25713, 25714, 25714, 25714, 25717, 25720, 25720, 25720, 25722, 25723, 25724, 25724, 25724, 25725, 25725,
+    25725, 25726, 25726, 25727, 25730, 25731, 25732, 25733, 25733, 25736, 25736, 25736, 25736, 25737, 25738, 25739,
+    25743, 25743, 25744, 25744, 25744, 25744, 25748, 25748, 25748, 25748, 25750, 25750, 25750, 25750, 25751, 25751,
+    25751, 25751, 25751, 25752, 25753, 25753, 25753, 25753, 25753, 25753, 25753, 25753, 25753, 25753, 25753, 25753,
+    25755, 25755, 25755, 25756, 25756, 25760, 25762, 25762, 25765, 25766, 25767, 25767, 25769, 25770, 25771, 25772,
+    25772, 25779, 25782, 25782, 25782, 25785, 25788, 25790, 25791, 25791, 25792, 25795, 25796, 25797, 25797, 25797,
+    25797, 25798, 25798, 25800, 25800, 25800, 25800, 25800, 25800, 25800, 25800, 25801, 25802, 25802, 25802, 25802,
+    25804, 25804, 25807, 25807, 25810, 25810, 25810, 25812, 25812, 25814, 25816, 25816, 25816, 25816, 25816, 25816,
+    25816, 25816, 25816, 25816, 25816, 25816, 25816, 25816, 25816, 25817, 25818, 25818, 25818, 25818, 25821, 25822,
+    25823, 25824, 25824, 25824, 25824, 25825, 25825, 25825, 25825, 25825, 25825, 25825, 25826, 25826, 25826, 25826,
+    25826, 25827, 25829, 25829, 25829, 25829, 25831, 25831, 25832, 25834, 25837, 25837, 25838, 25838, 25838, 25839,
+    25840, 25840, 25840, 25840, 25840, 25841, 25842, 25842, 25842, 25843, 25843, 25843, 25843, 25843, 25843, 25843,
+    25843, 25843, 25843, 25843, 25843, 25843, 25843, 25843, 25843, 25843, 25845, 25846, 25846, 25847, 25847, 25848,
+    25848, 25848, 25848, 25850, 25850, 25850, 25850, 25851, 25851, 25851, 25856, 25856, 25860, 25861, 25861, 25861,
+    25862, 25863, 25863, 25863, 25863, 25863, 25864, 25864, 25864, 25864, 25864, 25866, 25867, 25868, 25868, 25868,
+    25870, 25870, 25870, 25870, 25870, 25870, 25872, 25872, 25872, 25872, 25872, 25872, 25872, 25872, 25872, 25872,
+    25872, 25872, 25872, 25873, 25873, 25875, 25875, 25876, 25876, 25877, 25877, 25877, 25877, 25879, 25882, 25882,
+    25883, 25883, 25883, 25883, 25883, 25885, 25888, 25888, 25888, 25888, 25888, 25888, 25888, 25888, 25888, 25888,
+    25888, 25888, 25888, 25888, 25888, 25888, 25888, 25889, 25892, 25892, 25892, 25892, 25892, 25892, 25892, 25892,
+    25892, 25892, 25892, 25892, 25892, 25892, 25892, 25892, 25893, 25894, 25896, 25896, 25899, 25900, 25901, 25902,
+    25902, 25902, 25902, 25902, 25902, 25902, 25902, 25903, 25904, 25904, 25904, 25904, 25905, 25907, 25907, 25908,
+    25908, 25908, 25908, 25908, 25908, 25909, 25910, 25910, 25910, 25910, 25910, 25910, 25911, 25912, 25916, 25916,
+    25916, 25916, 25916, 25916, 25916, 25918, 25919, 25919, 25919, 25919, 25919, 25919, 25919, 25920, 25922, 25923,
+    25925, 25925, 25925, 25925, 25925, 25925, 25928, 25928, 25928, 25928, 25928, 25928, 25928, 25928, 25928, 25929,
+    25933, 25933, 25933, 25936, 25937, 25937, 25937, 25938, 25938, 25938, 25939, 25939, 25939, 25941, 25942, 25942,
+    25943, 25944, 25944, 25945, 25945, 25945, 25945, 25945, 25946, 25946, 25946, 25946, 25946, 25946, 25946, 25947,
+    25947, 25947, 25947, 25947, 25949, 25950, 25951, 25951, 25951, 25951, 25955, 25955, 25955, 25958, 25961, 25962,
+    25963, 25965, 25967, 25968, 25968, 25968, 25968, 25969, 25971, 25971, 25974, 25974, 25975, 25976, 25981, 25982,
+    25986, 25987, 25987, 25992, 25994, 25997, 25997, 25999, 26000, 26001, 26001, 26001, 26004, 26007, 26007, 26007,
+    26008, 26008, 26010, 26011, 26012, 26012, 26012, 26014, 26014, 26018, 26018, 26019, 26019, 26020, 26020, 26020,
+    26021, 26022, 26026, 26027, 26027, 26029, 26031, 26032, 26032, 26034, 26034, 26036, 26037, 26037, 26038, 26039,
+    26040, 26040, 26042, 26042, 26042, 26053, 26056, 26056, 26056, 26056, 26056, 26057, 26057, 26059, 26062, 26063,
+    26064, 26065, 26067, 26069, 26070, 26073, 26073, 26074, 26076, 26081, 26085, 26086, 26086, 26086, 26087, 26089,
+    26090, 26092, 26092, 26093, 26093, 26093, 26093, 26093, 26095, 26095, 26096, 26096, 26096, 26097, 26099, 26099,
+    26099, 26099, 26099, 26099, 26100, 26101, 26104, 26104, 26106, 26108, 26108, 26111, 26112, 26115, 26116, 26116,
+    26117, 26118, 26119, 26119, 26119, 26121, 26123, 26124, 26124, 26124, 26124, 26124, 26125, 26125, 26125, 26125,
+    26125, 26125, 26126, 26126, 26128, 26128, 26128, 26129, 26130, 26132, 26134, 26134, 26134, 26134, 26135, 26135,
+    26135, 26135, 26136, 26136, 26136, 26137, 26137, 26137, 26139, 26140, 26140, 26140, 26141, 26141, 26141, 26143,
+    26143, 26144, 26145, 26150, 26153, 26154, 26164, 26172, 26174, 26174, 26174, 26174, 26175, 26175, 26180, 26180,
+    26182, 26184, 26184, 26184, 26184, 26184, 26184, 26184, 26185, 26186, 26189, 26190, 26192, 26192, 26192, 26196,
+    26199, 26200, 26200, 26202, 26202, 26202, 26202, 26202, 26205, 26206, 26208, 26216, 26219, 26219, 26219, 26219,
+    26220, 26221, 26223, 26223, 26223, 26223, 26223, 26225, 26225, 26229, 26233, 26236, 26237, 26241, 26245, 26245,
+    26250, 26252, 26254, 26260, 26262, 26264, 26266, 26266, 26266, 26268, 26269, 26270, 26272, 26273, 26275, 26278,
+    26278, 26280, 26281, 26282, 26283, 26283, 26283, 26284, 26284, 26284, 26284, 26285, 26286, 26286, 26286, 26286,
+    26286, 26287, 26287, 26287, 26288, 26289, 26290, 26290, 26290, 26290, 26290, 26291, 26291, 26292, 26292, 26292,
+    26293, 26293, 26293, 26293, 26293, 26293, 26293, 26293, 26293, 26294, 26294, 26296, 26299, 26300, 26301, 26301,
+    26302, 26304, 26306, 26306, 26307, 26308, 26309, 26310, 26311, 26311, 26311, 26311, 26311, 26311, 26311, 26311,
+    26311, 26311, 26311, 26313, 26316, 26317, 26318, 26319, 26321, 26321, 26323, 26326, 26326, 26326, 26326, 26326,
+    26327, 26327, 26327, 26327, 26327, 26327, 26328, 26328, 26328, 26328, 26328, 26328, 26328, 26328, 26330, 26331,
+    26332, 26333, 26333, 26335, 26336, 26337, 26340, 26340, 26343, 26344, 26346, 26351, 26354, 26355, 26355, 26355,
+    26357, 26358, 26358, 26358, 26358, 26359, 26359, 26359, 26361, 26361, 26361, 26361, 26362, 26363, 26363, 26365,
+    26365, 26367, 26368, 26368, 26368, 26370, 26370, 26373, 26374, 26376, 26379, 26379, 26380, 26380, 26383, 26383,
+    26386, 26386, 26391, 26393, 26393, 26393, 26394, 26395, 26396, 26397, 26398, 26399, 26399, 26399, 26399, 26401,
+    26403, 26403, 26403, 26407, 26407, 26408, 26408, 26409, 26409, 26410, 26411, 26412, 26412, 26413, 26414, 26416,
+    26416, 26416, 26418, 26420, 26420, 26420, 26420, 26420, 26420, 26420, 26421, 26421, 26422, 26424, 26425, 26428,
+    26429, 26429, 26429, 26432, 26432, 26436, 26437, 26438, 26439, 26440, 26440, 26440, 26441, 26441, 26441, 26441,
+    26441, 26442, 26442, 26443, 26444, 26444, 26444, 26444, 26444, 26445, 26445, 26445, 26445, 26446, 26448, 26449,
+    26449, 26449, 26451, 26452, 26455, 26456, 26458, 26459, 26460, 26460, 26461, 26464, 26464, 26467, 26469, 26470,
+    26471, 26473, 26474, 26475, 26475, 26475, 26475, 26477, 26477, 26477, 26478, 26479, 26480, 26483, 26485, 26486,
+    26487, 26488, 26488, 26488, 26488, 26491, 26492, 26494, 26494, 26500, 26500, 26502, 26503, 26503, 26503, 26503,
+    26503, 26503, 26503, 26504, 26504, 26504, 26504, 26504, 26504, 26504, 26504, 26504, 26504, 26504, 26504, 26504,
+    26504, 26505, 26506, 26506, 26507, 26508, 26508, 26508, 26508, 26508, 26508, 26508, 26508, 26508, 26508, 26508,
+    26508, 26508, 26508, 26508, 26509, 26512, 26512, 26512, 26512, 26515, 26515, 26517, 26517, 26517, 26517, 26519,
+    26519, 26519, 26519, 26519, 26523, 26523, 26523, 26523, 26523, 26523, 26523, 26525, 26525, 26526, 26526, 26528,
+    26528, 26528, 26528, 26528, 26531, 26533, 26534, 26534, 26537, 26538, 26539, 26540, 26541, 26542, 26542, 26542,
+    26542, 26543, 26543, 26543, 26544, 26544, 26544, 26545, 26545, 26545, 26545, 26545, 26546, 26547, 26549, 26549,
+    26550, 26551, 26552, 26552, 26553, 26554, 26555, 26555, 26556, 26557, 26557, 26558, 26560, 26560, 26560, 26561,
+    26561, 26561, 26563, 26569, 26571, 26573, 26574, 26574, 26574, 26575, 26577, 26578, 26582, 26583, 26584, 26585,
+    26586, 26587, 26587, 26587, 26587, 26588, 26588, 26588, 26589, 26590, 26590, 26591, 26591, 26591, 26591, 26594,
+    26595, 26595, 26595, 26596, 26597, 26602, 26606, 26606, 26610, 26613, 26614, 26615, 26615, 26615, 26616, 26616,
+    26618, 26619, 26619, 26619, 26619, 26620, 26623, 26624, 26628, 26628, 26629, 26630, 26630, 26630, 26632, 26634,
+    26635, 26639, 26639, 26650, 26651, 26652, 26652, 26652, 26653, 26654, 26654, 26654, 26654, 26655, 26656, 26656,
+    26656, 26658, 26659, 26663, 26665, 26666, 26670, 26671, 26674, 26675, 26675, 26677, 26679, 26680, 26681, 26681,
+    26682, 26683, 26683, 26684, 26685, 26686, 26686, 26687, 26687, 26689, 26690, 26690, 26690, 26690, 26691, 26692,
+    26692, 26692, 26692, 26693, 26693, 26693, 26693, 26693, 26693, 26693, 26694, 26694, 26694, 26694, 26697, 26698,
+    26698, 26700, 26702, 26703, 26703, 26703, 26703, 26703, 26704, 26704, 26704, 26704, 26704, 26704, 26704, 26704,
+    26704, 26706, 26706, 26707, 26709, 26709, 26709, 26709, 26710, 26710, 26710, 26712, 26712, 26713, 26713, 26714,
+    26716, 26716, 26716, 26717, 26718, 26720, 26722, 26722, 26722, 26725, 26725, 26732, 26733, 26733, 26734, 26734,
+    26734, 26734, 26735, 26735, 26735, 26736, 26737, 26738, 26738, 26739, 26739, 26739, 26739, 26739, 26739, 26739,
+    26739, 26739, 26739, 26739, 26740, 26741, 26741, 26741, 26743, 26743, 26743, 26743, 26743, 26743, 26743, 26743,
+    26743, 26743, 26743, 26743, 26743, 26743, 26743, 26743, 26743, 26745, 26747, 26747, 26747, 26747, 26747, 26748,
+    26749, 26749, 26749, 26750, 26750, 26750, 26750, 26750, 26753, 26753, 26753, 26753, 26753, 26753, 26753, 26753,
+    26753, 26754, 26754, 26755, 26755, 26757, 26757, 26757, 26757, 26757, 26757, 26757, 26757, 26757, 26757, 26757,
+    26757, 26757, 26760, 26761, 26761, 26762, 26763, 26764, 26764, 26765, 26766, 26766, 26767, 26769, 26770, 26770,
+    26771, 26774, 26774, 26774, 26774, 26774, 26777, 26778, 26779, 26779, 26779, 26780, 26780, 26780, 26780, 26783,
+    26785, 26785, 26785, 26785, 26785, 26785, 26785, 26785, 26785, 26785, 26785, 26785, 26786, 26787, 26788, 26788,
+    26789, 26790, 26790, 26790, 26790, 26790, 26790, 26790, 26790, 26790, 26791, 26791, 26792, 26794, 26794, 26794,
+    26794, 26794, 26796, 26796, 26798, 26800, 26800, 26800, 26800, 26801, 26803, 26803, 26804, 26812, 26812, 26812,
+    26812, 26813, 26814, 26815, 26815, 26815, 26815, 26815, 26815, 26815, 26815, 26820, 26820, 26820, 26820, 26828,
+    26828, 26828, 26828, 26833, 26833, 26837, 26842, 26845, 26848, 26848, 26848, 26852, 26855, 26858, 26859, 26859,
+    26862, 26862, 26863, 26864, 26864, 26865, 26865, 26866, 26867, 26867, 26868, 26869, 26869, 26872, 26872, 26873,
+    26874, 26875, 26877, 26882, 26882, 26882, 26882, 26882, 26883, 26883, 26883, 26884, 26886, 26887, 26887, 26889,
+    26889, 26889, 26889, 26890, 26890, 26890, 26892, 26893, 26893, 26894, 26894, 26910, 26910, 26911, 26912, 26912,
+    26912, 26913, 26913, 26918, 26919, 26921, 26921, 26922, 26923, 26923, 26923, 26923, 26924, 26924, 26924, 26928,
+    26928, 26930, 26933, 26933, 26934, 26934, 26936, 26941, 26952, 26952, 26954, 26954, 26955, 26955, 26958, 26959,
+    26962, 26965, 26966, 26967, 26968, 26968, 26969, 26972, 26974, 26977, 26980, 26980, 26980, 26981, 26982, 26982,
+    26982, 26983, 26983, 26984, 26987, 26989, 26989, 26990, 26991, 26991, 26991, 26991, 26991, 26992, 26992, 26992,
+    26992, 26993, 26993, 26993, 26993, 26994, 26994, 26995, 26996, 26997, 26998, 26998, 27000, 27000, 27001, 27001,
+    27001, 27001, 27001, 27001, 27001, 27001, 27001, 27002, 27002, 27002, 27002, 27003, 27004, 27004, 27004, 27005,
+    27006, 27006, 27007, 27007, 27008, 27008, 27008, 27009, 27012, 27016, 27017, 27017, 27017, 27017, 27017, 27017,
+    27017, 27017, 27018, 27018, 27018, 27018, 27018, 27018, 27019, 27019, 27019, 27019, 27020, 27024, 27024, 27025,
+    27027, 27027, 27028, 27028, 27028, 27028, 27028, 27028, 27028, 27029, 27030, 27030, 27031, 27031, 27031, 27031,
+    27031, 27031, 27033, 27034, 27034, 27034, 27035, 27036, 27036, 27036, 27037, 27037, 27040, 27040, 27040, 27040,
+    27042, 27043, 27043, 27043, 27043, 27043, 27043, 27043, 27043, 27043, 27044, 27044, 27046, 27046, 27046, 27046,
+    27046, 27046, 27048, 27048, 27048, 27048, 27048, 27048, 27048, 27049, 27049, 27049, 27049, 27049, 27050, 27050,
+    27051, 27051, 27051, 27052, 27052, 27052, 27052, 27052, 27052, 27053, 27054, 27054, 27054, 27054, 27055, 27055,
+    27055, 27055, 27055, 27055, 27055, 27055, 27055, 27055, 27055, 27056, 27057, 27057, 27057, 27058, 27058, 27059,
+    27059, 27061, 27061, 27061, 27061, 27061, 27061, 27063, 27063, 27063, 27063, 27063, 27063, 27063, 27065, 27066,
+    27066, 27067, 27067, 27067, 27068, 27068, 27068, 27068, 27068, 27068, 27068, 27069, 27069, 27071, 27071, 27071,
+    27071, 27073, 27073, 27073, 27076, 27076, 27080, 27080, 27084, 27087, 27087, 27087, 27087, 27087, 27087, 27089,
+    27090, 27090, 27098, 27098, 27098, 27098, 27098, 27099, 27100, 27101, 27101, 27101, 27101, 27101, 27101, 27101,
+    27102, 27102, 27102, 27102, 27102, 27102, 27102, 27102, 27102, 27102, 27103, 27103, 27106, 27106, 27107, 27107,
+    27111, 27116, 27119, 27125, 27125, 27129, 27129, 27132, 27132, 27132, 27132, 27133, 27134, 27134, 27135, 27135,
+    27135, 27135, 27135, 27135, 27136, 27137, 27138, 27139, 27139, 27140, 27142, 27143, 27144, 27144, 27146, 27147,
+    27154, 27156, 27156, 27157, 27159, 27159, 27160, 27160, 27160, 27161, 27161, 27161, 27162, 27164, 27165, 27167,
+    27168, 27177, 27179, 27180, 27181, 27182, 27183, 27184, 27185, 27186, 27187, 27187, 27187, 27187, 27188, 27189,
+    27189, 27190, 27193, 27194, 27195, 27197, 27201, 27201, 27201, 27206, 27207, 27207, 27208, 27208, 27211, 27211,
+    27211, 27211, 27216, 27216, 27217, 27218, 27220, 27220, 27221, 27228, 27230, 27239, 27241, 27249, 27252, 27256,
+    27262, 27263, 27263, 27263, 27264, 27265, 27266, 27266, 27267, 27267, 27272, 27278, 27281, 27286, 27287, 27295,
+    27298, 27301, 27304, 27304, 27304, 27305, 27306, 27306, 27306, 27306, 27306, 27306, 27307, 27312, 27312, 27313,
+    27313, 27313, 27315, 27320, 27320, 27323, 27325, 27326, 27329, 27329, 27329, 27330, 27331, 27332, 27333, 27333,
+    27334, 27335, 27336, 27336, 27337, 27346, 27347, 27349, 27349, 27349, 27349, 27349, 27362, 27369, 27375, 27381,
+    27388, 27391, 27392, 27392, 27392, 27392, 27393, 27393, 27393, 27393, 27394, 27394, 27394, 27397, 27406, 27412,
+    27412, 27412, 27412, 27413, 27413, 27413, 27413, 27413, 27413, 27413, 27413, 27413, 27413, 27414, 27415, 27416,
+    27416, 27416, 27416, 27416, 27418, 27418, 27421, 27422, 27422, 27422, 27422, 27422, 27425, 27425, 27425, 27425,
+    27426, 27426, 27427, 27427, 27430, 27432, 27433, 27433, 27434, 27434, 27438, 27439, 27439, 27439, 27441, 27441,
+    27441, 27444, 27444, 27444, 27446, 27446, 27447, 27447, 27447, 27448, 27448, 27448, 27448, 27448, 27448, 27448,
+    27448, 27448, 27449, 27450, 27450, 27450, 27450, 27450, 27450, 27450, 27450, 27450, 27453, 27453, 27453, 27453,
+    27453, 27453, 27453, 27453, 27453, 27453, 27453, 27453, 27453, 27454, 27454, 27454, 27455, 27455, 27455, 27457,
+    27457, 27457, 27457, 27458, 27458, 27459, 27459, 27459, 27459, 27460, 27460, 27460, 27460, 27461, 27461, 27461,
+    27461, 27462, 27462, 27462, 27463, 27463, 27463, 27463, 27463, 27463, 27464, 27464, 27464, 27464, 27464, 27466,
+    27466, 27466, 27466, 27469, 27470, 27470, 27470, 27471, 27472, 27472, 27472, 27473, 27473, 27474, 27476, 27476,
+    27476, 27480, 27482, 27482, 27485, 27486, 27487, 27491, 27492, 27494, 27495, 27498, 27498, 27498, 27500, 27502,
+    27503, 27503, 27503, 27506, 27506, 27506, 27509, 27510, 27510, 27512, 27513, 27513, 27513, 27514, 27514, 27514,
+    27516, 27516, 27516, 27518, 27521, 27523, 27529, 27529, 27529, 27530, 27530, 27530, 27532, 27533, 27538, 27542,
+    27543, 27543, 27546, 27546, 27546, 27546, 27549, 27549, 27550, 27551, 27557, 27557, 27558, 27558, 27558, 27558,
+    27558, 27558, 27559, 27561, 27561, 27563, 27563, 27568, 27568, 27569, 27569, 27570, 27570, 27574, 27575, 27575,
+    27580, 27581, 27581, 27581, 27593, 27593, 27594, 27594, 27595, 27596, 27597, 27597, 27597, 27597, 27597, 27597,
+    27597, 27597, 27597, 27597, 27598, 27598, 27598, 27598, 27598, 27598, 27598, 27598, 27598, 27598, 27598, 27598,
+    27598, 27599, 27602, 27604, 27604, 27605, 27605, 27605, 27607, 27607, 27607, 27607, 27607, 27608, 27609, 27609,
+    27609, 27609, 27609, 27609, 27610, 27610, 27612, 27612, 27616, 27619, 27619, 27619, 27620, 27620, 27620, 27624,
+    27624, 27624, 27631, 27632, 27632, 27634, 27634, 27638, 27638, 27640, 27640, 27641, 27642, 27642, 27642, 27642,
+    27644, 27644, 27646, 27648, 27648, 27649, 27651, 27651, 27652, 27652, 27657, 27663, 27671, 27671, 27674, 27677,
+    27677, 27677, 27678, 27681, 27690, 27690, 27690, 27690, 27690, 27690, 27690, 27691, 27691, 27691, 27699, 27702,
+    27702, 27704, 27713, 27714, 27718, 27725, 27729, 27730, 27732, 27732, 27735, 27737, 27737, 27740, 27743, 27744,
+    27745, 27745, 27746, 27746, 27751, 27751, 27753, 27753, 27755, 27757, 27760, 27760, 27760, 27763, 27763, 27763,
+    27763, 27764, 27764, 27765, 27765, 27765, 27766, 27766, 27766, 27767, 27767, 27767, 27768, 27768, 27769, 27770,
+    27772, 27772, 27772, 27772, 27775, 27777, 27777, 27777, 27777, 27777, 27777, 27777, 27778, 27778, 27782, 27784,
+    27784, 27789, 27790, 27790, 27791, 27793, 27793, 27793, 27794, 27794, 27794, 27794, 27795, 27795, 27795, 27798,
+    27798, 27799, 27799, 27799, 27799, 27799, 27799, 27799, 27799, 27799, 27799, 27800, 27800, 27801, 27801, 27801,
+    27801, 27803, 27804, 27808, 27808, 27808, 27808, 27810, 27811, 27814, 27815, 27815, 27815, 27815, 27815, 27815,
+    27816, 27818, 27819, 27822, 27824, 27825, 27826, 27826, 27829, 27831, 27833, 27833, 27834, 27834, 27834, 27834,
+    27834, 27835, 27837, 27837, 27837, 27837, 27837, 27841, 27841, 27842, 27842, 27845, 27845, 27847, 27847, 27852,
+    27852, 27853, 27859, 27859, 27860, 27860, 27861, 27862, 27862, 27863, 27864, 27864, 27865, 27866, 27868, 27868,
+    27868, 27868, 27868, 27868, 27871, 27871, 27872, 27872, 27872, 27872, 27872, 27873, 27874, 27877, 27877, 27877,
+    27877, 27878, 27879, 27879, 27880, 27881, 27882, 27882, 27883, 27884, 27886, 27887, 27888, 27888, 27888, 27888,
+    27888, 27888, 27888, 27888, 27888, 27890, 27891, 27892, 27893, 27897, 27897, 27897, 27897, 27897, 27897, 27897,
+    27898, 27898, 27899, 27899, 27899, 27900, 27901, 27901, 27903, 27904, 27904, 27904, 27907, 27908, 27909, 27909,
+    27909, 27909, 27909, 27911, 27915, 27916, 27917, 27919, 27919, 27920, 27920, 27925, 27925, 27925, 27926, 27926,
+    27926, 27926, 27926, 27926, 27926, 27926, 27927, 27927, 27927, 27927, 27928, 27928, 27928, 27928, 27928, 27929,
+    27933, 27934, 27934, 27937, 27937, 27939, 27941, 27946, 27947, 27952, 27952, 27952, 27953, 27954, 27956, 27956,
+    27960, 27960, 27960, 27971, 27971, 27971, 27975, 27979, 27979, 27980, 27984, 27985, 27985, 27985, 27985, 27986,
+    27986, 27990, 27994, 27996, 28000, 28001, 28001, 28001, 28002, 28002, 28002, 28003, 28003, 28003, 28004, 28005,
+    28014, 28015, 28016, 28018, 28019, 28019, 28019, 28019, 28019, 28019, 28019, 28021, 28023, 28023, 28024, 28025,
+    28025, 28025, 28025, 28025, 28027, 28027, 28028, 28031, 28031, 28031, 28031, 28031, 28031, 28032, 28032, 28034,
+    28035, 28035, 28036, 28036, 28037, 28037, 28038, 28040, 28043, 28044, 28044, 28044, 28044, 28044, 28049, 28050,
+    28050, 28050, 28050, 28051, 28052, 28053, 28056, 28056, 28056, 28057, 28060, 28060, 28061, 28061, 28062, 28064,
+    28064, 28065, 28066, 28066, 28067, 28067, 28067, 28067, 28069, 28070, 28075, 28078, 28078, 28080, 28082, 28083,
+    28085, 28085, 28093, 28096, 28096, 28099, 28102, 28104, 28105, 28105, 28106, 28107, 28108, 28108, 28109, 28109,
+    28109, 28110, 28110, 28111, 28111, 28112, 28112, 28113, 28113, 28116, 28116, 28117, 28118, 28121, 28125, 28126,
+    28128, 28128, 28132, 28135, 28135, 28135, 28136, 28136, 28137, 28140, 28141, 28142, 28142, 28143, 28143, 28144,
+    28145, 28147, 28148, 28148, 28148, 28148, 28151, 28151, 28152, 28154, 28155, 28156, 28158, 28158, 28159, 28160,
+    28161, 28161, 28161, 28161, 28162, 28162, 28162, 28162, 28162, 28162, 28162, 28162, 28162, 28167, 28167, 28167,
+    28167, 28167, 28167, 28168, 28169, 28169, 28173, 28176, 28176, 28176, 28176, 28177, 28177, 28177, 28177, 28180,
+    28180, 28187, 28187, 28187, 28189, 28190, 28190, 28191, 28191, 28191, 28191, 28192, 28192, 28192, 28192, 28193,
+    28193, 28194, 28194, 28194, 28194, 28194, 28194, 28194, 28195, 28197, 28200, 28204, 28204, 28205, 28205, 28206,
+    28207, 28207, 28207, 28208, 28209, 28210, 28211, 28212, 28212, 28212, 28212, 28212, 28212, 28212, 28212, 28212,
+    28213, 28213, 28214, 28214, 28214, 28215, 28215, 28215, 28215, 28215, 28215, 28215, 28215, 28216, 28216, 28217,
+    28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28217, 28221,
+    28221, 28221, 28221, 28222, 28222, 28222, 28222, 28222, 28222, 28222, 28222, 28222, 28222, 28222, 28222, 28222,
+    28223, 28223, 28224, 28224, 28225, 28225, 28225, 28225, 28225, 28225, 28225, 28226, 28227, 28227, 28228, 28229,
+    28231, 28233, 28233, 28234, 28234, 28235, 28236, 28237, 28237, 28237, 28237, 28239, 28239, 28241, 28242, 28242,
+    28242, 28242, 28242, 28243, 28248, 28250, 28250, 28250, 28250, 28251, 28251, 28255, 28257, 28257, 28257, 28257,
+    28257, 28261, 28261, 28262, 28263, 28264, 28266, 28267, 28267, 28268, 28269, 28269, 28269, 28269, 28269, 28269,
+    28269, 28269, 28269, 28269, 28270, 28270, 28270, 28270, 28270, 28271, 28274, 28274, 28274, 28274, 28277, 28278,
+    28279, 28279, 28287, 28287, 28288, 28289, 28292, 28292, 28293, 28295, 28295, 28298, 28299, 28299, 28299, 28299,
+    28299, 28300, 28300, 28300, 28301, 28301, 28301, 28302, 28302, 28303, 28303, 28303, 28303, 28303, 28303, 28303,
+    28304, 28304, 28306, 28310, 28310, 28310, 28310, 28311, 28311, 28311, 28312, 28312, 28313, 28314, 28316, 28316,
+    28317, 28319, 28320, 28320, 28320, 28320, 28320, 28320, 28322, 28322, 28322, 28325, 28325, 28325, 28325, 28325,
+    28327, 28328, 28329, 28333, 28334, 28334, 28335, 28335, 28335, 28335, 28335, 28335, 28335, 28336, 28339, 28339,
+    28339, 28339, 28339, 28339, 28339, 28339, 28339, 28339, 28339, 28342, 28343, 28344, 28344, 28345, 28346, 28350,
+    28356, 28356, 28358, 28359, 28359, 28359, 28360, 28362, 28362, 28362, 28362, 28364, 28365, 28365, 28365, 28365,
+    28366, 28367, 28367, 28367, 28368, 28368, 28369, 28369, 28370, 28370, 28370, 28370, 28371, 28371, 28371, 28374,
+    28375, 28376, 28376, 28376, 28377, 28377, 28377, 28377, 28377, 28378, 28378, 28378, 28378, 28379, 28380, 28380,
+    28381, 28381, 28382, 28382, 28383, 28384, 28384, 28384, 28385, 28385, 28385, 28386, 28387, 28387, 28387, 28387,
+    28387, 28387, 28387, 28387, 28387, 28388, 28389, 28392, 28393, 28394, 28395, 28396, 28396, 28396, 28396, 28396,
+    28396, 28396, 28396, 28397, 28399, 28399, 28402, 28404, 28406, 28406, 28406, 28407, 28409, 28415, 28416, 28417,
+    28419, 28419, 28420, 28420, 28423, 28424, 28427, 28428, 28429, 28430, 28431, 28431, 28431, 28431, 28431, 28432,
+    28432, 28432, 28432, 28432, 28432, 28433, 28433, 28433, 28433, 28436, 28436, 28439, 28439, 28439, 28440, 28440,
+    28443, 28443, 28447, 28448, 28448, 28448, 28448, 28448, 28448, 28451, 28452, 28453, 28455, 28455, 28455, 28456,
+    28458, 28462, 28462, 28464, 28464, 28465, 28467, 28467, 28467, 28467, 28467, 28467, 28468, 28469, 28469, 28469,
+    28469, 28472, 28473, 28474, 28475, 28475, 28477, 28477, 28478, 28479, 28479, 28479, 28479, 28479, 28480, 28480,
+    28480, 28480, 28480, 28483, 28483, 28483, 28483, 28484, 28484, 28484, 28484, 28484, 28484, 28484, 28485, 28485,
+    28485, 28485, 28485, 28485, 28485, 28485, 28486, 28486, 28486, 28486, 28486, 28486, 28487, 28487, 28487, 28487,
+    28487, 28487, 28487, 28488, 28488, 28490, 28492, 28492, 28492, 28494, 28495, 28496, 28496, 28502, 28502, 28503,
+    28506, 28509, 28509, 28509, 28510, 28510, 28510, 28511, 28512, 28513, 28517, 28517, 28521, 28523, 28523, 28523,
+    28524, 28525, 28525, 28526, 28527, 28528, 28530, 28530, 28530, 28531, 28532, 28534, 28534, 28537, 28540, 28542,
+    28542, 28543, 28544, 28544, 28547, 28548, 28549, 28550, 28551, 28552, 28553, 28554, 28554, 28555, 28556, 28556,
+    28556, 28558, 28558, 28559, 28559, 28559, 28559, 28559, 28559, 28559, 28559, 28559, 28560, 28562, 28564, 28565,
+    28565, 28571, 28571, 28571, 28571, 28572, 28574, 28574, 28579, 28580, 28580, 28580, 28580, 28581, 28582, 28583,
+    28583, 28583, 28583, 28583, 28583, 28583, 28586, 28588, 28588, 28591, 28592, 28592, 28593, 28601, 28602, 28603,
+    28605, 28608, 28609, 28610, 28612, 28614, 28617, 28617, 28617, 28617, 28618, 28618, 28619, 28619, 28619, 28619,
+    28620, 28620, 28620, 28623, 28623, 28624, 28624, 28626, 28630, 28630, 28630, 28630, 28630, 28630, 28631, 28631,
+    28631, 28631, 28631, 28631, 28632, 28633, 28634, 28634, 28635, 28637, 28637, 28638, 28639, 28639, 28640, 28641,
+    28642, 28642, 28643, 28643, 28644, 28644, 28644, 28644, 28645, 28648, 28652, 28653, 28653, 28653, 28653, 28653,
+    28653, 28653, 28653, 28654, 28654, 28654, 28654, 28654, 28654, 28654, 28654, 28654, 28654, 28654, 28654, 28654,
+    28654, 28654, 28654, 28657, 28657, 28662, 28663, 28663, 28663, 28663, 28663, 28663, 28664, 28664, 28664, 28664,
+    28664, 28665, 28667, 28668, 28668, 28668, 28668, 28668, 28668, 28670, 28670, 28670, 28671, 28672, 28672, 28672,
+    28676, 28678, 28678, 28679, 28680, 28680, 28681, 28681, 28681, 28682, 28683, 28683, 28683, 28683, 28683, 28684,
+    28685, 28685, 28685, 28685, 28685, 28686, 28687, 28689, 28690, 28690, 28690, 28693, 28694, 28694, 28694, 28694,
+    28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28694, 28695, 28695,
+    28695, 28698, 28699, 28699, 28699, 28701, 28702, 28702, 28702, 28702, 28702, 28702, 28703, 28704, 28704, 28704,
+    28704, 28704, 28705, 28708, 28708, 28709, 28710, 28710, 28710, 28712, 28714, 28714, 28716, 28717, 28717, 28717,
+    28717, 28721, 28721, 28721, 28724, 28724, 28726, 28726, 28727, 28729, 28729, 28731, 28731, 28732, 28732, 28733,
+    28733, 28733, 28734, 28734, 28734, 28734, 28735, 28736, 28736, 28736, 28736, 28738, 28738, 28738, 28738, 28738,
+    28740, 28741, 28743, 28744, 28744, 28745, 28747, 28747, 28747, 28749, 28751, 28752, 28753, 28754, 28755, 28761,
+    28761, 28762, 28763, 28763, 28766, 28766, 28770, 28772, 28773, 28774, 28777, 28779, 28788, 28788, 28795, 28795,
+    28795, 28795, 28801, 28801, 28802, 28803, 28804, 28804, 28804, 28804, 28805, 28805, 28807, 28807, 28809, 28810,
+    28811, 28813, 28813, 28813, 28813, 28814, 28814, 28814, 28815, 28815, 28817, 28817, 28817, 28819, 28820, 28821,
+    28823, 28823, 28823, 28823, 28823, 28827, 28827, 28827, 28828, 28829, 28830, 28832, 28833, 28833, 28836, 28837,
+    28838, 28838, 28838, 28839, 28840, 28841, 28841, 28842, 28842, 28842, 28842, 28842, 28842, 28842, 28842, 28842,
+    28842, 28842, 28842, 28842, 28842, 28842, 28843, 28845, 28845, 28845, 28845, 28846, 28846, 28846, 28846, 28846,
+    28846, 28846, 28846, 28846, 28846, 28847, 28847, 28847, 28847, 28847, 28848, 28849, 28849, 28850, 28850, 28851,
+    28851, 28852, 28853, 28853, 28853, 28853, 28855, 28855, 28858, 28859, 28859, 28859, 28859, 28859, 28859, 28859,
+    28859, 28859, 28859, 28859, 28860, 28860, 28861, 28861, 28861, 28861, 28861, 28861, 28861, 28861, 28861, 28861,
+    28861, 28863, 28863, 28863, 28863, 28863, 28863, 28863, 28863, 28864, 28865, 28866, 28867, 28867, 28867, 28867,
+    28867, 28867, 28867, 28867, 28867, 28867, 28867, 28867, 28867, 28867, 28867, 28867, 28867, 28868, 28869, 28869,
+    28870, 28870, 28870, 28870, 28870, 28871, 28871, 28873, 28873, 28873, 28873, 28873, 28873, 28873, 28873, 28873,
+    28873, 28874, 28875, 28875, 28875, 28875, 28875, 28875, 28875, 28875, 28876, 28877, 28877, 28877, 28878, 28878,
+    28878, 28878, 28878, 28878, 28879, 28879, 28879, 28879, 28879, 28879, 28879, 28879, 28879, 28879, 28879, 28880,
+    28881, 28881, 28882, 28883, 28884, 28884, 28884, 28884, 28885, 28885, 28885, 28885, 28887, 28892, 28894, 28898,
+    28899, 28899, 28903, 28905, 28908, 28908, 28908, 28910, 28910, 28910, 28911, 28911, 28911, 28914, 28916, 28919,
+    28919, 28920, 28922, 28927, 28929, 28929, 28929, 28931, 28932, 28933, 28938, 28940, 28941, 28942, 28946, 28948,
+    28948, 28949, 28951, 28956, 28957, 28959, 28960, 28961, 28961, 28963, 28967, 28969, 28969, 28969, 28969, 28969,
+    28970, 28971, 28971, 28971, 28972, 28974, 28974, 28974, 28974, 28975, 28976, 28978, 28979, 28980, 28981, 28981,
+    28981, 28981, 28981, 28981, 28982, 28982, 28982, 28984, 28984, 28985, 28985, 28988, 28988, 28988, 28989, 28989,
+    28990, 28990, 28991, 28991, 28992, 28992, 28993, 28993, 28993, 28993, 28993, 28993, 28995, 28995, 28996, 28996,
+    28996, 28997, 28997, 28997, 28998, 28999, 28999, 29000, 29001, 29001, 29002, 29003, 29004, 29006, 29006, 29006,
+    29006, 29006, 29006, 29007, 29008, 29008, 29008, 29008, 29009, 29010, 29012, 29012, 29013, 29013, 29013, 29013,
+    29013, 29013, 29014, 29014, 29014, 29014, 29014, 29014, 29014, 29014, 29015, 29016, 29016, 29018, 29020, 29020,
+    29020, 29020, 29021, 29021, 29021, 29021, 29021, 29021, 29021, 29021, 29022, 29022, 29022, 29022, 29022, 29022,
+    29022, 29022, 29022, 29022, 29022, 29022, 29022, 29022, 29025, 29025, 29025, 29025, 29025, 29025, 29025, 29026,
+    29027, 29029, 29029, 29029, 29029, 29029, 29030, 29030, 29030, 29030, 29030, 29030, 29031, 29031, 29032, 29032,
+    29032, 29032, 29032, 29032, 29032, 29032, 29033, 29033, 29033, 29034, 29034, 29034, 29035, 29037, 29037, 29038,
+    29040, 29040, 29040, 29040, 29041, 29042, 29042, 29042, 29042, 29042, 29042, 29042, 29042, 29042, 29044, 29044,
+    29044, 29044, 29048, 29049, 29049, 29049, 29049, 29049, 29049, 29050, 29050, 29050, 29050, 29050, 29051, 29051,
+    29051, 29053, 29053, 29055, 29055, 29055, 29057, 29057, 29057, 29057, 29058, 29058, 29058, 29059, 29059, 29060,
+    29060, 29060, 29060, 29060, 29060, 29060, 29061, 29061, 29061, 29062, 29063, 29064, 29065, 29065, 29065, 29065,
+    29065, 29065, 29065, 29066, 29066, 29066, 29067, 29067, 29067, 29067, 29067, 29067, 29067, 29067, 29067, 29068,
+    29069, 29069, 29069, 29069, 29069, 29069, 29070, 29071, 29071, 29071, 29071, 29072, 29072, 29072, 29072, 29072,
+    29074, 29074, 29074, 29075, 29077, 29077, 29077, 29077, 29077, 29077, 29080, 29080, 29081, 29082, 29082, 29082,
+    29082, 29082, 29082, 29082, 29082, 29082, 29084, 29084, 29084, 29084, 29085, 29085, 29085, 29085, 29085, 29085,
+    29085, 29085, 29085, 29085, 29085, 29085, 29085, 29085, 29086, 29086, 29086, 29087, 29087, 29087, 29087, 29089,
+    29089, 29090, 29090, 29090, 29090, 29091, 29091, 29091, 29091, 29092, 29092, 29092, 29092, 29092, 29092, 29093,
+    29094, 29094, 29094, 29094, 29094, 29095, 29095, 29095, 29097, 29098, 29098, 29098, 29098, 29099, 29099, 29100,
+    29100, 29101, 29101, 29101, 29101, 29102, 29103, 29103, 29103, 29103, 29103, 29103, 29104, 29104, 29104, 29104,
+    29106, 29106, 29106, 29106, 29106, 29106, 29106, 29107, 29107, 29107, 29107, 29107, 29108, 29108, 29108, 29108,
+    29108, 29108, 29108, 29108, 29108, 29109, 29109, 29109, 29109, 29109, 29111, 29119, 29120, 29120, 29120, 29120,
+    29120, 29121, 29121, 29121, 29121, 29121, 29122, 29129, 29130, 29131, 29131, 29131, 29131, 29131, 29131, 29131,
+    29131, 29131, 29131, 29131, 29131, 29131, 29131, 29131, 29132, 29134, 29134, 29134, 29134, 29134, 29134, 29135,
+    29136, 29138, 29139, 29139, 29139, 29142, 29142, 29143, 29144, 29144, 29145, 29145, 29149, 29150, 29150, 29150,
+    29152, 29155, 29155, 29155, 29156, 29157, 29157, 29157, 29157, 29157, 29159, 29159, 29160, 29160, 29160, 29160,
+    29161, 29161, 29163, 29164, 29164, 29164, 29164, 29165, 29166, 29166, 29166, 29166, 29166, 29166, 29167, 29168,
+    29168, 29168, 29168, 29168, 29170, 29170, 29171, 29171, 29171, 29171, 29171, 29171, 29171, 29171, 29173, 29173,
+    29173, 29173, 29173, 29173, 29173, 29173, 29174, 29174, 29174, 29175, 29175, 29175, 29176, 29176, 29176, 29176,
+    29176, 29176, 29176, 29176, 29176, 29176, 29176, 29176, 29176, 29177, 29177, 29177, 29180, 29184, 29185, 29185,
+    29185, 29185, 29185, 29185, 29185, 29185, 29185, 29187, 29187, 29188, 29190, 29190, 29190, 29190, 29191, 29191,
+    29192, 29193, 29193, 29194, 29195, 29195, 29195, 29196, 29197, 29197, 29197, 29198, 29199, 29199, 29200, 29202,
+    29202, 29202, 29202, 29202, 29202, 29202, 29203, 29203, 29204, 29204, 29204, 29204, 29207, 29208, 29208, 29208,
+    29209, 29209, 29210, 29210, 29211, 29212, 29213, 29213, 29215, 29215, 29215, 29215, 29216, 29219, 29220, 29220,
+    29220, 29220, 29222, 29222, 29222, 29222, 29222, 29222, 29222, 29222, 29222, 29222, 29224, 29224, 29224, 29224,
+    29224, 29224, 29224, 29224, 29224, 29224, 29225, 29225, 29225, 29225, 29226, 29226, 29226, 29226, 29226, 29226,
+    29227, 29228, 29229, 29229, 29230, 29231, 29231, 29232, 29236, 29236, 29238, 29240, 29241, 29241, 29241, 29241,
+    29241, 29241, 29242, 29243, 29245, 29245, 29245, 29245, 29245, 29245, 29246, 29246, 29247, 29247, 29247, 29248,
+    29249, 29249, 29249, 29249, 29249, 29249, 29249, 29249, 29250, 29251, 29251, 29252, 29252, 29252, 29254, 29255,
+    29256, 29257, 29257, 29257, 29258, 29259, 29259, 29260, 29260, 29260, 29260, 29260, 29260, 29260, 29260, 29260,
+    29261, 29262, 29262, 29263, 29263, 29263, 29263, 29263, 29263, 29264, 29264, 29264, 29265, 29266, 29267, 29267,
+    29267, 29268, 29270, 29270, 29270, 29270, 29270, 29270, 29270, 29270, 29270, 29270, 29271, 29271, 29272, 29272,
+    29272, 29273, 29273, 29273, 29274, 29274, 29274, 29275, 29275, 29275, 29275, 29276, 29276, 29276, 29276, 29277,
+    29278, 29281, 29281, 29281, 29281, 29282, 29282, 29282, 29282, 29282, 29282, 29283, 29283, 29283, 29283, 29284,
+    29285, 29285, 29286, 29287, 29289, 29289, 29290, 29290, 29291, 29291, 29291, 29291, 29291, 29291, 29292, 29293,
+    29294, 29294, 29295, 29295, 29295, 29296, 29297, 29298, 29298, 29298, 29298, 29298, 29298, 29298, 29298, 29298,
+    29298, 29298, 29298, 29298, 29299, 29300, 29301, 29302, 29303, 29304, 29306, 29306, 29306, 29306, 29307, 29307,
+    29307, 29308, 29308, 29308, 29308, 29310, 29311, 29312, 29312, 29314, 29315, 29316, 29316, 29316, 29317, 29317,
+    29317, 29317, 29318, 29318, 29318, 29318, 29318, 29319, 29320, 29320, 29320, 29320, 29320, 29320, 29320, 29321,
+    29322, 29324, 29325, 29326, 29328, 29328, 29328, 29330, 29331, 29332, 29333, 29335, 29336, 29336, 29337, 29337,
+    29338, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29339, 29340, 29340,
+    29340, 29340, 29340, 29340, 29340, 29340, 29341, 29341, 29341, 29341, 29341, 29341, 29341, 29341, 29341, 29341,
+    29341, 29341, 29341, 29341, 29342, 29342, 29342, 29342, 29343, 29343, 29348, 29348, 29348, 29348, 29348, 29348,
+    29349, 29349, 29350, 29351, 29351, 29352, 29353, 29353, 29356, 29357, 29358, 29358, 29358, 29358, 29358, 29358,
+    29359, 29359, 29359, 29359, 29359, 29359, 29359, 29359, 29359, 29359, 29360, 29361, 29361, 29361, 29361, 29361,
+    29362, 29362, 29362, 29364, 29364, 29364, 29364, 29364, 29365, 29365, 29365, 29366, 29366, 29366, 29367, 29368,
+    29368, 29369, 29369, 29370, 29370, 29370, 29371, 29372, 29372, 29372, 29372, 29372, 29372, 29372, 29372, 29373,
+    29374, 29375, 29375, 29375, 29375, 29375, 29375, 29375, 29376, 29378, 29378, 29378, 29378, 29378, 29378, 29382,
+    29382, 29383, 29383, 29384, 29385, 29385, 29387, 29388, 29388, 29388, 29388, 29388, 29388, 29390, 29391, 29392,
+    29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392,
+    29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392, 29392,
+    29392, 29395, 29395, 29395, 29395, 29397, 29397, 29398, 29398, 29398, 29398, 29398, 29398, 29398, 29398, 29401,
+    29401, 29401, 29402, 29402, 29402, 29402, 29402, 29402, 29403, 29403, 29404, 29404, 29404, 29405, 29405, 29405,
+    29405, 29405, 29405, 29405, 29405, 29405, 29406, 29406, 29406, 29406, 29406, 29406, 29406, 29406, 29406, 29406,
+    29406, 29406, 29406, 29406, 29406, 29406, 29406, 29407, 29408, 29408, 29408, 29409, 29409, 29409, 29409, 29409,
+    29410, 29411, 29411, 29411, 29411, 29411, 29411, 29411, 29411, 29411, 29413, 29413, 29414, 29414, 29414, 29414,
+    29414, 29414, 29415, 29416, 29416, 29416, 29416, 29417, 29417, 29417, 29417, 29418, 29418, 29418, 29418, 29419,
+    29419, 29420, 29420, 29420, 29420, 29420, 29420, 29420, 29420, 29421, 29421, 29421, 29421, 29421, 29421, 29421,
+    29421, 29421, 29421, 29421, 29421, 29422, 29422, 29423, 29423, 29424, 29424, 29424, 29424, 29424, 29424, 29424,
+    29424, 29424, 29425, 29425, 29425, 29425, 29425, 29425, 29425, 29425, 29425, 29425, 29426, 29426, 29428, 29429,
+    29429, 29429, 29430, 29430, 29431, 29431, 29431, 29431, 29431, 29431, 29431, 29431, 29432, 29432, 29433, 29433,
+    29435, 29435, 29435, 29435, 29436, 29437, 29437, 29437, 29437, 29437, 29437, 29437, 29437, 29440, 29440, 29440,
+    29440, 29440, 29440, 29441, 29442, 29442, 29442, 29442, 29442, 29442, 29442, 29442, 29442, 29442, 29442, 29443,
+    29443, 29443, 29443, 29444, 29444, 29445, 29445, 29445, 29445, 29445, 29445, 29445, 29445, 29445, 29445, 29446,
+    29446, 29446, 29446, 29446, 29447, 29447, 29447, 29448, 29448, 29448, 29449, 29449, 29449, 29449, 29450, 29450,
+    29451, 29451, 29451, 29451, 29451, 29451, 29451, 29451, 29451, 29451, 29452, 29452, 29452, 29452, 29452, 29452,
+    29452, 29452, 29452, 29452, 29452, 29452, 29452, 29452, 29452, 29452, 29452, 29453, 29453, 29453, 29454, 29454,
+    29454, 29454, 29454, 29454, 29454, 29454, 29454, 29454, 29455, 29455, 29455, 29455, 29455, 29455, 29458, 29458,
+    29458, 29458, 29459, 29459, 29460, 29460, 29460, 29460, 29460, 29460, 29460, 29460, 29460, 29460, 29460, 29462,
+    29462, 29463, 29463, 29463, 29463, 29463, 29463, 29464, 29464, 29465, 29465, 29465, 29465, 29465, 29465, 29465,
+    29466, 29467, 29467, 29467, 29467, 29467, 29467, 29467, 29468, 29468, 29468, 29468, 29468, 29468, 29469, 29469,
+    29469, 29469, 29469, 29469, 29469, 29469, 29469, 29470, 29470, 29470, 29471, 29472, 29472, 29472, 29472, 29474,
+    29474, 29474, 29474, 29474, 29478, 29478, 29478, 29478, 29479, 29479, 29479, 29479, 29479, 29479, 29480, 29480,
+    29480, 29480, 29480, 29481, 29481, 29481, 29481, 29481, 29482, 29483, 29484, 29484, 29484, 29484, 29484, 29485,
+    29485, 29485, 29485, 29485, 29486, 29486, 29486, 29486, 29487, 29487, 29487, 29487, 29487, 29488, 29489, 29490,
+    29490, 29490, 29490, 29490, 29490, 29490, 29490, 29490, 29490, 29491, 29491, 29491, 29491, 29491, 29492, 29494,
+    29494, 29495, 29495, 29496, 29496, 29496, 29496, 29497, 29498, 29498, 29498, 29498, 29498, 29498, 29498, 29499,
+    29500, 29500, 29500, 29500, 29500, 29500, 29500, 29500, 29500, 29500, 29501, 29502, 29502, 29502, 29502, 29503,
+    29503, 29503, 29503, 29503, 29503, 29503, 29503, 29503, 29503, 29505, 29506, 29506, 29506, 29506, 29506, 29506,
+    29506, 29506, 29506, 29506, 29506, 29506, 29507, 29508, 29509, 29509, 29509, 29509, 29509, 29509, 29511, 29512,
+    29512, 29513, 29513, 29514, 29514, 29514, 29514, 29514, 29514, 29514, 29514, 29515, 29515, 29516, 29517, 29517,
+    29517, 29517, 29517, 29517, 29517, 29518, 29518, 29519, 29519, 29520, 29520, 29520, 29520, 29525, 29525, 29525,
+    29525, 29525, 29526, 29527, 29527, 29527, 29528, 29528, 29528, 29529, 29530, 29530, 29530, 29530, 29531, 29531,
+    29531, 29531, 29532, 29533, 29533, 29533, 29533, 29534, 29534, 29534, 29534, 29534, 29534, 29534, 29534, 29535,
+    29535, 29535, 29538, 29538, 29541, 29542, 29542, 29542, 29542, 29543, 29543, 29543, 29543, 29543, 29543, 29543,
+    29543, 29544, 29544, 29544, 29544, 29544, 29545, 29545, 29545, 29545, 29546, 29546, 29547, 29549, 29549, 29549,
+    29549, 29549, 29549, 29549, 29549, 29549, 29549, 29549, 29549, 29549, 29549, 29550, 29550, 29550, 29550, 29550,
+    29550, 29550, 29550, 29551, 29551, 29551, 29551, 29553, 29553, 29553, 29553, 29553, 29553, 29553, 29553, 29553,
+    29553, 29554, 29554, 29554, 29554, 29555, 29555, 29555, 29555, 29555, 29555, 29555, 29556, 29556, 29556, 29556,
+    29556, 29557, 29558, 29559, 29559, 29559, 29561, 29561, 29561, 29561, 29561, 29562, 29562, 29563, 29563, 29563,
+    29563, 29563, 29563, 29563, 29563, 29563, 29564, 29566, 29567, 29569, 29570, 29570, 29573, 29574, 29577, 29578,
+    29578, 29578, 29578, 29578, 29579, 29579, 29579, 29579, 29579, 29579, 29580, 29580, 29580, 29580, 29580, 29580,
+    29580, 29580, 29580, 29581, 29581, 29582, 29584, 29585, 29588, 29589, 29590, 29590, 29590, 29590, 29590, 29590,
+    29590, 29590, 29591, 29591, 29591, 29591, 29591, 29591, 29592, 29592, 29593, 29593, 29593, 29593, 29593, 29593,
+    29593, 29594, 29594, 29594, 29594, 29594, 29594, 29594, 29594, 29594, 29594, 29595, 29595, 29595, 29595, 29595,
+    29595, 29595, 29595, 29595, 29595, 29595, 29595, 29595, 29596, 29596, 29596, 29596, 29597, 29597, 29597, 29597,
+    29597, 29597, 29597, 29597, 29597, 29597, 29597, 29597, 29597, 29597, 29598, 29599, 29599, 29600, 29600, 29600,
+    29600, 29601, 29601, 29602, 29602, 29602, 29602, 29603, 29603, 29604, 29604, 29604, 29604, 29604, 29604, 29604,
+    29604, 29604, 29604, 29604, 29604, 29604, 29604, 29604, 29604, 29604, 29604, 29604, 29605, 29606, 29606, 29606,
+    29606, 29606, 29606, 29606, 29607, 29607, 29607, 29607, 29607, 29608, 29608, 29608, 29608, 29609, 29609, 29609,
+    29609, 29609, 29609, 29610, 29611, 29611, 29611, 29611, 29611, 29611, 29611, 29612, 29612, 29614, 29614, 29615,
+    29615, 29617, 29617, 29619, 29620, 29620, 29620, 29620, 29623, 29623, 29623, 29623, 29624, 29624, 29624, 29624,
+    29624, 29624, 29624, 29625, 29625, 29625, 29625, 29625, 29625, 29625, 29625, 29625, 29626, 29626, 29626, 29626,
+    29626, 29627, 29627, 29628, 29629, 29629, 29629, 29630, 29630, 29630, 29632, 29632, 29632, 29633, 29633, 29635,
+    29635, 29636, 29637, 29638, 29639, 29639, 29639, 29639, 29639, 29639, 29640, 29640, 29640, 29640, 29640, 29640,
+    29640, 29640, 29640, 29640, 29641, 29641, 29641, 29641, 29641, 29641, 29641, 29641, 29642, 29642, 29642, 29643,
+    29643, 29643, 29643, 29643, 29643, 29643, 29643, 29643, 29643, 29643, 29644, 29646, 29646, 29646, 29647, 29648,
+    29648, 29648, 29648, 29648, 29649, 29649, 29649, 29650, 29651, 29651, 29651, 29651, 29651, 29651, 29651, 29653,
+    29653, 29653, 29654, 29654, 29654, 29654, 29654, 29655, 29655, 29655, 29655, 29656, 29656, 29656, 29656, 29656,
+    29656, 29656, 29657, 29657, 29657, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658,
+    29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29658, 29659, 29659, 29659,
+    29659, 29659, 29659, 29659, 29659, 29660, 29660, 29660, 29660, 29662, 29662, 29662, 29662, 29662, 29662, 29663,
+    29663, 29664, 29664, 29666, 29666, 29666, 29666, 29667, 29667, 29667, 29667, 29668, 29671, 29671, 29671, 29671,
+    29671, 29671, 29672, 29672, 29673, 29673, 29673, 29673, 29673, 29674, 29675, 29675, 29676, 29677, 29677, 29677,
+    29678, 29679, 29681, 29682, 29682, 29682, 29682, 29682, 29682, 29682, 29682, 29683, 29683, 29683, 29683, 29684,
+    29684, 29685, 29685, 29685, 29685, 29685, 29686, 29687, 29688, 29694, 29694, 29694, 29694, 29697, 29698, 29698,
+    29699, 29700, 29701, 29701, 29701, 29701, 29701, 29701, 29701, 29701, 29701, 29701, 29702, 29702, 29704, 29704,
+    29704, 29704, 29704, 29704, 29705, 29709, 29709, 29711, 29712, 29712, 29712, 29713, 29713, 29713, 29713, 29713,
+    29713, 29713, 29714, 29714, 29714, 29714, 29714, 29714, 29714, 29715, 29715, 29717, 29717, 29718, 29718, 29719,
+    29719, 29719, 29719, 29719, 29719, 29719, 29719, 29719, 29719, 29719, 29719, 29719, 29720, 29720, 29720, 29721,
+    29721, 29724, 29724, 29724, 29724, 29724, 29724, 29724, 29724, 29725, 29725, 29725, 29725, 29725, 29725, 29725,
+    29725, 29725, 29725, 29725, 29726, 29726, 29726, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730,
+    29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730, 29730,
+    29730, 29730, 29730, 29731, 29731, 29731, 29731, 29731, 29731, 29731, 29731, 29731, 29731, 29731, 29731, 29731,
+    29731, 29731, 29731, 29731, 29732, 29732, 29732, 29732, 29733, 29733, 29734, 29735, 29735, 29735, 29736, 29736,
+    29736, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737, 29737,
+    29737, 29737, 29737, 29738, 29738, 29738, 29738, 29739, 29740, 29740, 29740, 29740, 29740, 29741, 29741, 29742,
+    29743, 29743, 29743, 29744, 29744, 29744, 29745, 29745, 29746, 29746, 29746, 29746, 29747, 29747, 29747, 29747,
+    29747, 29747, 29747, 29747, 29747, 29748, 29748, 29748, 29749, 29749, 29749, 29749, 29749, 29749, 29749, 29749,
+    29750, 29750, 29750, 29750, 29753, 29753, 29753, 29753, 29753, 29753, 29753, 29753, 29754, 29756, 29756, 29756,
+    29756, 29756, 29756, 29756, 29756, 29757, 29757, 29757, 29757, 29757, 29757, 29757, 29757, 29758, 29758, 29759,
+    29760, 29760, 29761, 29761, 29761, 29761, 29761, 29761, 29761, 29762, 29762, 29762, 29763, 29764, 29764, 29764,
+    29764, 29765, 29765, 29765, 29765, 29765, 29766, 29766, 29766, 29766, 29768, 29769, 29771, 29771, 29772, 29773,
+    29773, 29773, 29774, 29776, 29777, 29777, 29777, 29777, 29778, 29778, 29778, 29778, 29778, 29778, 29778, 29778,
+    29778, 29779, 29779, 29779, 29779, 29779, 29779, 29779, 29779, 29779, 29780, 29780, 29780, 29780, 29780, 29780,
+    29780, 29780, 29780, 29781, 29781, 29781, 29781, 29781, 29782, 29782, 29782, 29783, 29783, 29783, 29783, 29783,
+    29783, 29784, 29786, 29786, 29786, 29787, 29787, 29788, 29788, 29788, 29788, 29788, 29789, 29789, 29789, 29789,
+    29789, 29789, 29789, 29789, 29790, 29790, 29790, 29790, 29790, 29790, 29790, 29790, 29790, 29791, 29793, 29793,
+    29793, 29793, 29794, 29794, 29794, 29795, 29796, 29796, 29796, 29796, 29796, 29796, 29797, 29797, 29797, 29797,
+    29797, 29799, 29799, 29799, 29799, 29799, 29799, 29799, 29799, 29799, 29800, 29800, 29800, 29800, 29801, 29801,
+    29803, 29804, 29805, 29805, 29805, 29805, 29805, 29805, 29807, 29807, 29807, 29807, 29807, 29808, 29808, 29808,
+    29808, 29808, 29808, 29808, 29808, 29808, 29808, 29808, 29808, 29811, 29811, 29812, 29812, 29812, 29812, 29812,
+    29812, 29814, 29814, 29814, 29814, 29814, 29814, 29814, 29814, 29814, 29814, 29815, 29816, 29816, 29818, 29822,
+    29822, 29823, 29825, 29826, 29826, 29826, 29826, 29826, 29827, 29827, 29828, 29829, 29830, 29831, 29832, 29833,
+    29834, 29834, 29834, 29835, 29839, 29839, 29839, 29839, 29840, 29841, 29841, 29841, 29841, 29841, 29841, 29841,
+    29841, 29841, 29841, 29842, 29843, 29843, 29843, 29844, 29844, 29845, 29845, 29845, 29845, 29845, 29845, 29846,
+    29847, 29847, 29847, 29850, 29850, 29850, 29850, 29850, 29850, 29850, 29851, 29851, 29851, 29851, 29852, 29852,
+    29852, 29852, 29852, 29852, 29852, 29852, 29852, 29852, 29852, 29852, 29852, 29853, 29856, 29856, 29856, 29856,
+    29857, 29858, 29859, 29860, 29860, 29860, 29860, 29860, 29860, 29860, 29861, 29862, 29862, 29862, 29862, 29862,
+    29863, 29865, 29865, 29865, 29865, 29865, 29866, 29866, 29866, 29866, 29866, 29866, 29866, 29866, 29867, 29867,
+    29867, 29867, 29868, 29869, 29870, 29870, 29870, 29870, 29870, 29872, 29872, 29874, 29874, 29877, 29877, 29877,
+    29877, 29877, 29877, 29877, 29877, 29878, 29878, 29878, 29878, 29878, 29879, 29879, 29880, 29880, 29881, 29881,
+    29883, 29888, 29889, 29889, 29889, 29889, 29889, 29889, 29890, 29890, 29890, 29890, 29890, 29890, 29890, 29890,
+    29890, 29890, 29890, 29890, 29891, 29893, 29893, 29893, 29893, 29893, 29893, 29893, 29893, 29893, 29893, 29893,
+    29893, 29893, 29893, 29893, 29893, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894,
+    29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894, 29894,
+    29894, 29894, 29894, 29894, 29894, 29894, 29894, 29895, 29896, 29897, 29897, 29898, 29899, 29900, 29900, 29900,
+    29900, 29900, 29901, 29901, 29901, 29902, 29904, 29904, 29904, 29904, 29904, 29904, 29905, 29906, 29906, 29906,
+    29906, 29907, 29908, 29908, 29908, 29908, 29908, 29910, 29911, 29911, 29911, 29912, 29913, 29913, 29913, 29913,
+    29913, 29913, 29913, 29913, 29913, 29913, 29913, 29914, 29914, 29914, 29917, 29917, 29917, 29917, 29917, 29917,
+    29918, 29920, 29920, 29920, 29923, 29924, 29924, 29925, 29926, 29926, 29926, 29926, 29926, 29926, 29926, 29927,
+    29927, 29927, 29928, 29928, 29928, 29929, 29930, 29930, 29931, 29932, 29934, 29934, 29934, 29935, 29935, 29936,
+    29936, 29938, 29939, 29939, 29939, 29940, 29940, 29940, 29940, 29941, 29941, 29941, 29941, 29941, 29941, 29941,
+    29942, 29942, 29942, 29943, 29944, 29945, 29945, 29945, 29950, 29951, 29951, 29951, 29951, 29951, 29951, 29952,
+    29952, 29952, 29952, 29952, 29952, 29952, 29952, 29952, 29952, 29952, 29952, 29952, 29952, 29953, 29953, 29953,
+    29953, 29953, 29953, 29954, 29955, 29955, 29955, 29955, 29956, 29957, 29957, 29957, 29957, 29957, 29957, 29957,
+    29957, 29957, 29957, 29957, 29957, 29957, 29957, 29957, 29957, 29957, 29957, 29957, 29958, 29958, 29958, 29958,
+    29958, 29959, 29959, 29959, 29960, 29961, 29962, 29962, 29962, 29962, 29963, 29964, 29964, 29965, 29965, 29965,
+    29965, 29965, 29965, 29966, 29966, 29972, 29973, 29973, 29973, 29973, 29973, 29973, 29973, 29973, 29973, 29974,
+    29976, 29977, 29977, 29977, 29977, 29979, 29979, 29980, 29980, 29982, 29982, 29983, 29985, 29985, 29985, 29985,
+    29986, 29986, 29986, 29986, 29986, 29987, 29987, 29987, 29988, 29991, 29993, 29994, 29995, 29996, 29996, 29997,
+    29997, 29997, 29997, 29997, 29997, 29998, 29998, 29998, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999,
+    29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 29999, 30000, 30001,
+    30001, 30001, 30002, 30003, 30004, 30005, 30007, 30008, 30008, 30008, 30008, 30008, 30008, 30008, 30008, 30009,
+    30009, 30009, 30010, 30010, 30011, 30011, 30011, 30014, 30015, 30016, 30016, 30016, 30016, 30016, 30016, 30017,
+    30022, 30022, 30022, 30022, 30022, 30022, 30022, 30023, 30023, 30023, 30024, 30026, 30026, 30026, 30026, 30026,
+    30027, 30027, 30027, 30027, 30027, 30027, 30027, 30027, 30027, 30027, 30027, 30028, 30029, 30029, 30029, 30030,
+    30031, 30032, 30032, 30033, 30034, 30034, 30034, 30034, 30035, 30035, 30035, 30035, 30035, 30035, 30035, 30036,
+    30036, 30036, 30037, 30037, 30037, 30037, 30038, 30039, 30039, 30042, 30042, 30042, 30042, 30043, 30043, 30043,
+    30044, 30045, 30045, 30048, 30048, 30049, 30049, 30049, 30051, 30051, 30052, 30052, 30053, 30057, 30058, 30058,
+    30058, 30058, 30058, 30059, 30059, 30059, 30059, 30060, 30061, 30062, 30063, 30063, 30063, 30063, 30064, 30064,
+    30064, 30064, 30064, 30064, 30064, 30064, 30064, 30065, 30066, 30066, 30066, 30066, 30066, 30066, 30066, 30066,
+    30066, 30067, 30067, 30067, 30068, 30068, 30068, 30068, 30070, 30070, 30070, 30070, 30070, 30070, 30070, 30070,
+    30072, 30072, 30072, 30072, 30072, 30072, 30072, 30072, 30073, 30073, 30073, 30076, 30076, 30076, 30076, 30076,
+    30076, 30077, 30077, 30078, 30078, 30078, 30078, 30079, 30079, 30079, 30079, 30079, 30079, 30079, 30079, 30079,
+    30080, 30081, 30081, 30081, 30081, 30081, 30081, 30081, 30081, 30082, 30082, 30083, 30084, 30084, 30084, 30084,
+    30084, 30084, 30084, 30084, 30086, 30086, 30086, 30087, 30087, 30087, 30088, 30088, 30089, 30089, 30089, 30092,
+    30093, 30093, 30093, 30093, 30093, 30093, 30095, 30096, 30096, 30096, 30096, 30096, 30096, 30096, 30096, 30096,
+    30096, 30097, 30097, 30097, 30097, 30097, 30098, 30098, 30098, 30099, 30099, 30099, 30099, 30101, 30102, 30102,
+    30102, 30102, 30102, 30103, 30103, 30104, 30104, 30105, 30105, 30105, 30105, 30105, 30105, 30106, 30106, 30106,
+    30106, 30106, 30106, 30109, 30109, 30109, 30109, 30109, 30109, 30109, 30111, 30112, 30113, 30114, 30114, 30115,
+    30116, 30116, 30117, 30117, 30117, 30117, 30117, 30118, 30118, 30118, 30118, 30118, 30120, 30121, 30121, 30121,
+    30121, 30121, 30122, 30123, 30123, 30125, 30125, 30126, 30126, 30126, 30126, 30126, 30127, 30127, 30127, 30127,
+    30127, 30127, 30127, 30127, 30127, 30127, 30127, 30127, 30127, 30129, 30129, 30129, 30129, 30129, 30130, 30130,
+    30136, 30136, 30136, 30136, 30136, 30136, 30136, 30136, 30137, 30137, 30137, 30137, 30137, 30137, 30139, 30139,
+    30139, 30140, 30140, 30140, 30140, 30140, 30140, 30140, 30140, 30140, 30142, 30143, 30144, 30145, 30145, 30147,
+    30147, 30147, 30147, 30147, 30148, 30148, 30148, 30148, 30148, 30148, 30148, 30148, 30148, 30148, 30148, 30148,
+    30148, 30149, 30149, 30149, 30149, 30149, 30149, 30150, 30151, 30152, 30152, 30152, 30152, 30152, 30153, 30153,
+    30153, 30153, 30153, 30153, 30153, 30153, 30153, 30153, 30154, 30154, 30154, 30155, 30155, 30155, 30156, 30157,
+    30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30157, 30158, 30158,
+    30158, 30158, 30158, 30158, 30158, 30158, 30158, 30158, 30158, 30158, 30158, 30159, 30159, 30159, 30160, 30162,
+    30163, 30166, 30167, 30167, 30167, 30167, 30168, 30168, 30168, 30168, 30168, 30168, 30168, 30168, 30168, 30168,
+    30168, 30168, 30169, 30169, 30170, 30170, 30170, 30171, 30171, 30172, 30172, 30172, 30172, 30172, 30172, 30172,
+    30172, 30172, 30172, 30172, 30172, 30172, 30172, 30172, 30172, 30173, 30173, 30174, 30174, 30174, 30174, 30174,
+    30174, 30174, 30174, 30175, 30175, 30175, 30175, 30175, 30176, 30179, 30180, 30181, 30181, 30181, 30181, 30181,
+    30181, 30182, 30182, 30182, 30183, 30183, 30183, 30183, 30183, 30184, 30184, 30184, 30184, 30185, 30185, 30186,
+    30186, 30187, 30188, 30188, 30188, 30189, 30193, 30193, 30193, 30193, 30193, 30193, 30193, 30194, 30194, 30194,
+    30194, 30194, 30194, 30194, 30194, 30194, 30194, 30194, 30195, 30196, 30197, 30197, 30198, 30203, 30204, 30204,
+    30204, 30205, 30205, 30205, 30205, 30205, 30205, 30205, 30205, 30205, 30205, 30205, 30205, 30207, 30207, 30207,
+    30211, 30211, 30214, 30215, 30216, 30216, 30216, 30216, 30216, 30216, 30217, 30218, 30218, 30219, 30220, 30220,
+    30222, 30222, 30222, 30222, 30222, 30223, 30224, 30224, 30225, 30227, 30227, 30227, 30227, 30227, 30227, 30227,
+    30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227, 30227,
+    30227, 30227, 30227, 30227, 30227, 30229, 30229, 30230, 30230, 30230, 30230, 30230, 30230, 30230, 30230, 30230,
+    30231, 30231, 30231, 30231, 30231, 30231, 30231, 30231, 30232, 30232, 30232, 30233, 30233, 30233, 30233, 30233,
+    30234, 30235, 30235, 30235, 30235, 30235, 30235, 30235, 30235, 30235, 30236, 30236, 30236, 30236, 30237, 30237,
+    30237, 30237, 30237, 30237, 30239, 30240, 30240, 30241, 30242, 30242, 30242, 30242, 30243, 30243, 30243, 30243,
+    30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244, 30244,
+    30244, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30245, 30246, 30246,
+    30247, 30247, 30247, 30247, 30248, 30248, 30248, 30248, 30249, 30249, 30250, 30250, 30251, 30252, 30253, 30253,
+    30253, 30253, 30253, 30253, 30253, 30254, 30254, 30254, 30256, 30259, 30260, 30261, 30261, 30261, 30261, 30261,
+    30261, 30261, 30261, 30261, 30261, 30262, 30262, 30262, 30262, 30262, 30263, 30264, 30264, 30264, 30264, 30265,
+    30267, 30267, 30268, 30268, 30268, 30269, 30269, 30270, 30270, 30270, 30270, 30270, 30270, 30270, 30270, 30270,
+    30270, 30270, 30271, 30272, 30272, 30272, 30272, 30273, 30274, 30274, 30274, 30275, 30276, 30276, 30276, 30276,
+    30277, 30278, 30278, 30278, 30278, 30278, 30278, 30278, 30278, 30278, 30279, 30279, 30279, 30279, 30279, 30279,
+    30279, 30280, 30280, 30280, 30280, 30280, 30280, 30281, 30281, 30281, 30282, 30282, 30282, 30282, 30282, 30282,
+    30284, 30284, 30284, 30284, 30285, 30285, 30287, 30289, 30290, 30291, 30291, 30291, 30291, 30291, 30292, 30292,
+    30293, 30293, 30293, 30293, 30293, 30293, 30293, 30293, 30293, 30293, 30293, 30293, 30294, 30294, 30295, 30295,
+    30295, 30295, 30298, 30299, 30299, 30299, 30302, 30303, 30303, 30303, 30303, 30303, 30303, 30303, 30303, 30303,
+    30303, 30303, 30304, 30305, 30305, 30305, 30305, 30306, 30306, 30306, 30307, 30310, 30312, 30312, 30313, 30314,
+    30316, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30317, 30318, 30321,
+    30321, 30322, 30324, 30324, 30325, 30325, 30329, 30329, 30330, 30331, 30331, 30331, 30331, 30331, 30331, 30331,
+    30331, 30331, 30332, 30333, 30333, 30333, 30334, 30334, 30334, 30334, 30334, 30335, 30335, 30335, 30335, 30337,
+    30337, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338, 30338,
+    30338, 30338, 30339, 30339, 30339, 30339, 30339, 30339, 30339, 30340, 30340, 30340, 30340, 30340, 30341, 30341,
+    30342, 30343, 30343, 30345, 30345, 30345, 30345, 30345, 30345, 30346, 30347, 30347, 30347, 30347, 30347, 30347,
+    30347, 30347, 30347, 30347, 30347, 30348, 30348, 30348, 30348, 30348, 30349, 30350, 30350, 30351, 30352, 30352,
+    30352, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353, 30353,
+    30353, 30353, 30354, 30355, 30355, 30356, 30357, 30358, 30358, 30359, 30359, 30360, 30360, 30360, 30360, 30361,
+    30361, 30361, 30361, 30361, 30361, 30361, 30361, 30361, 30362, 30362, 30362, 30362, 30362, 30362, 30362, 30362,
+    30362, 30363, 30363, 30363, 30363, 30364, 30364, 30364, 30364, 30364, 30365, 30365, 30365, 30365, 30365, 30367,
+    30367, 30367, 30367, 30370, 30371, 30371, 30372, 30372, 30374, 30374, 30375, 30376, 30376, 30376, 30376, 30376,
+    30376, 30376, 30377, 30377, 30377, 30378, 30379, 30379, 30379, 30379, 30379, 30379, 30380, 30381, 30381, 30381,
+    30381, 30381, 30381, 30381, 30381, 30381, 30381, 30381, 30382, 30382, 30382, 30383, 30383, 30383, 30384, 30384,
+    30384, 30384, 30384, 30384, 30384, 30384, 30385, 30385, 30385, 30387, 30387, 30388, 30389, 30390, 30390, 30390,
+    30390, 30390, 30390, 30392, 30392, 30392, 30392, 30392, 30392, 30392, 30392, 30393, 30393, 30393, 30394, 30394,
+    30394, 30394, 30395, 30395, 30395, 30395, 30395, 30396, 30396, 30396, 30396, 30396, 30397, 30397, 30398, 30398,
+    30398, 30398, 30398, 30399, 30401, 30402, 30402, 30402, 30402, 30403, 30404, 30404, 30404, 30404, 30404, 30404,
+    30404, 30404, 30406, 30406, 30406, 30406, 30406, 30406, 30406, 30406, 30406, 30406, 30406, 30406, 30407, 30408,
+    30408, 30408, 30408, 30408, 30409, 30409, 30409, 30409, 30409, 30410, 30412, 30413, 30414, 30414, 30414, 30416,
+    30419, 30420, 30421, 30422, 30424, 30426, 30427, 30428, 30430, 30431, 30432, 30432, 30432, 30432, 30433, 30433,
+    30434, 30434, 30434, 30434, 30434, 30434, 30434, 30434, 30434, 30435, 30435, 30436, 30438, 30439, 30439, 30439,
+    30439, 30439, 30439, 30440, 30440, 30440, 30440, 30440, 30440, 30440, 30440, 30440, 30441, 30441, 30443, 30444,
+    30445, 30446, 30446, 30447, 30448, 30449, 30450, 30450, 30450, 30450, 30450, 30450, 30450, 30450, 30452, 30452,
+    30452, 30452, 30452, 30454, 30454, 30455, 30455, 30455, 30456, 30456, 30456, 30456, 30456, 30458, 30458, 30458,
+    30458, 30458, 30459, 30459, 30459, 30459, 30460, 30460, 30460, 30460, 30460, 30460, 30460, 30460, 30460, 30460,
+    30460, 30460, 30460, 30460, 30462, 30466, 30466, 30466, 30466, 30466, 30466, 30466, 30467, 30467, 30467, 30467,
+    30467, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30468, 30469, 30469,
+    30469, 30469, 30469, 30469, 30469, 30469, 30469, 30469, 30469, 30469, 30470, 30470, 30471, 30471, 30471, 30471,
+    30472, 30474, 30474, 30475, 30476, 30478, 30478, 30478, 30478, 30478, 30478, 30479, 30479, 30479, 30480, 30481,
+    30481, 30481, 30481, 30481, 30481, 30481, 30481, 30482, 30482, 30482, 30482, 30482, 30482, 30482, 30482, 30483,
+    30483, 30483, 30483, 30483, 30483, 30483, 30483, 30483, 30483, 30483, 30483, 30483, 30484, 30484, 30486, 30492,
+    30492, 30492, 30492, 30492, 30492, 30492, 30492, 30492, 30492, 30492, 30492, 30492, 30495, 30495, 30497, 30497,
+    30497, 30497, 30497, 30497, 30497, 30497, 30497, 30497, 30497, 30497, 30499, 30499, 30500, 30500, 30500, 30500,
+    30500, 30500, 30501, 30502, 30503, 30505, 30505, 30505, 30505, 30505, 30506, 30508, 30510, 30510, 30510, 30510,
+    30511, 30511, 30511, 30512, 30513, 30513, 30513, 30513, 30513, 30513, 30513, 30513, 30514, 30516, 30516, 30517,
+    30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30517, 30518, 30518,
+    30518, 30518, 30518, 30518, 30518, 30518, 30518, 30518, 30519, 30520, 30520, 30520, 30520, 30520, 30520, 30520,
+    30520, 30520, 30520, 30520, 30520, 30521, 30522, 30522, 30522, 30523, 30524, 30524, 30525, 30526, 30526, 30526,
+    30526, 30526, 30526, 30526, 30526, 30526, 30526, 30527, 30527, 30528, 30528, 30528, 30529, 30529, 30529, 30529,
+    30529, 30529, 30530, 30530, 30530, 30530, 30531, 30531, 30531, 30531, 30531, 30531, 30531, 30532, 30532, 30532,
+    30532, 30532, 30532, 30532, 30533, 30533, 30533, 30533, 30533, 30533, 30533, 30533, 30533, 30534, 30535, 30535,
+    30535, 30535, 30535, 30535, 30535, 30536, 30536, 30536, 30536, 30537, 30538, 30539, 30540, 30541, 30541, 30541,
+    30541, 30541, 30543, 30543, 30544, 30545, 30545, 30545, 30546, 30547, 30547, 30547, 30547, 30547, 30547, 30548,
+    30548, 30549, 30549, 30549, 30549, 30549, 30550, 30550, 30550, 30550, 30550, 30550, 30550, 30550, 30551, 30551,
+    30551, 30551, 30551, 30551, 30551, 30551, 30551, 30551, 30552, 30552, 30552, 30553, 30554, 30554, 30554, 30554,
+    30554, 30554, 30554, 30554, 30554, 30554, 30554, 30554, 30554, 30554, 30554, 30555, 30555, 30555, 30555, 30555,
+    30555, 30555, 30555, 30556, 30556, 30556, 30556, 30556, 30556, 30556, 30556, 30556, 30556, 30556, 30556, 30557,
+    30557, 30558, 30559, 30559, 30559, 30559, 30559, 30559, 30560, 30560, 30561, 30561, 30562, 30562, 30562, 30563,
+    30563, 30565, 30566, 30566, 30566, 30566, 30566, 30566, 30566, 30566, 30566, 30566, 30567, 30568, 30568, 30568,
+    30568, 30569, 30571, 30571, 30571, 30571, 30571, 30571, 30571, 30572, 30572, 30573, 30573, 30574, 30574, 30575,
+    30575, 30575, 30575, 30575, 30576, 30576, 30576, 30576, 30576, 30576, 30577, 30577, 30579, 30579, 30582, 30583,
+    30583, 30584, 30584, 30584, 30584, 30584, 30585, 30585, 30585, 30586, 30586, 30586, 30586, 30586, 30586, 30586,
+    30586, 30586, 30586, 30586, 30586, 30586, 30586, 30586, 30586, 30586, 30586, 30587, 30587, 30587, 30587, 30587,
+    30587, 30587, 30587, 30587, 30588, 30588, 30588, 30588, 30593, 30593, 30593, 30593, 30593, 30593, 30593, 30594,
+    30599, 30600, 30600, 30601, 30602, 30604, 30609, 30610, 30610, 30610, 30612, 30612, 30613, 30613, 30613, 30613,
+    30614, 30614, 30614, 30614, 30614, 30615, 30615, 30615, 30616, 30616, 30616, 30616, 30616, 30616, 30616, 30616,
+    30616, 30617, 30618, 30618, 30618, 30618, 30618, 30618, 30618, 30618, 30619, 30619, 30619, 30619, 30619, 30619,
+    30619, 30619, 30619, 30619, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620,
+    30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30620, 30621, 30621, 30621, 30622, 30622, 30623, 30624,
+    30624, 30624, 30624, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625,
+    30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30625, 30626, 30627, 30629, 30630, 30630, 30631,
+    30631, 30631, 30631, 30632, 30632, 30632, 30634, 30634, 30634, 30634, 30634, 30634, 30634, 30635, 30635, 30636,
+    30636, 30636, 30636, 30636, 30636, 30637, 30637, 30638, 30638, 30638, 30638, 30638, 30639, 30639, 30639, 30639,
+    30639, 30640, 30641, 30642, 30642, 30642, 30642, 30643, 30643, 30643, 30643, 30643, 30643, 30643, 30643, 30643,
+    30643, 30643, 30643, 30644, 30645, 30646, 30646, 30646, 30646, 30646, 30646, 30647, 30647, 30647, 30647, 30647,
+    30647, 30647, 30647, 30647, 30647, 30647, 30648, 30649, 30649, 30649, 30649, 30649, 30649, 30649, 30650, 30650,
+    30650, 30650, 30651, 30651, 30651, 30652, 30652, 30652, 30653, 30653, 30656, 30656, 30656, 30656, 30656, 30656,
+    30656, 30656, 30657, 30657, 30657, 30657, 30657, 30657, 30657, 30657, 30657, 30658, 30658, 30658, 30658, 30658,
+    30658, 30658, 30658, 30658, 30658, 30660, 30661, 30662, 30663, 30663, 30663, 30664, 30665, 30665, 30665, 30666,
+    30666, 30666, 30667, 30667, 30669, 30669, 30669, 30669, 30669, 30669, 30669, 30669, 30669, 30669, 30670, 30670,
+    30672, 30674, 30674, 30675, 30675, 30678, 30679, 30679, 30680, 30681, 30681, 30683, 30684, 30684, 30684, 30685,
+    30685, 30685, 30685, 30686, 30686, 30686, 30686, 30686, 30686, 30686, 30686, 30687, 30688, 30688, 30688, 30689,
+    30690, 30690, 30690, 30690, 30690, 30690, 30690, 30690, 30690, 30691, 30691, 30691, 30691, 30691, 30691, 30691,
+    30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691, 30691,
+    30691, 30691, 30691, 30692, 30692, 30692, 30692, 30692, 30694, 30694, 30694, 30694, 30694, 30696, 30696, 30697,
+    30697, 30697, 30697, 30697, 30697, 30698, 30698, 30698, 30698, 30698, 30698, 30698, 30698, 30698, 30698, 30699,
+    30699, 30699, 30699, 30701, 30701, 30701, 30701, 30701, 30701, 30701, 30701, 30701, 30701, 30701, 30701, 30702,
+    30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702, 30702,
+    30703, 30703, 30703, 30703, 30704, 30704, 30704, 30704, 30705, 30705, 30705, 30705, 30705, 30705, 30705, 30705,
+    30705, 30705, 30705, 30705, 30705, 30705, 30705, 30705, 30705, 30707, 30707, 30707, 30707, 30708, 30708, 30708,
+    30708, 30708, 30708, 30708, 30708, 30708, 30708, 30708, 30708, 30708, 30709, 30709, 30709, 30709, 30709, 30709,
+    30709, 30709, 30709, 30709, 30709, 30709, 30709, 30709, 30710, 30710, 30710, 30710, 30711, 30711, 30711, 30711,
+    30712, 30712, 30712, 30714, 30714, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715,
+    30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715, 30715,
+    30715, 30715, 30715, 30717, 30718, 30719, 30719, 30719, 30721, 30722, 30722, 30722, 30722, 30722, 30722, 30722,
+    30722, 30722, 30722, 30722, 30722, 30722, 30723, 30724, 30724, 30724, 30724, 30724, 30724, 30724, 30724, 30724,
+    30724, 30724, 30725, 30726, 30727, 30727, 30728, 30728, 30728, 30728, 30728, 30728, 30728, 30729, 30730, 30730,
+    30731, 30731, 30732, 30732, 30733, 30733, 30734, 30735, 30735, 30736, 30736, 30736, 30736, 30736, 30737, 30737,
+    30737, 30737, 30737, 30737, 30737, 30737, 30737, 30737, 30737, 30737, 30737, 30737, 30737, 30738, 30739, 30740,
+    30741, 30742, 30742, 30742, 30742, 30742, 30742, 30742, 30743, 30744, 30744, 30744, 30744, 30744, 30745, 30745,
+    30745, 30745, 30745, 30745, 30745, 30745, 30745, 30745, 30745, 30745, 30746, 30746, 30746, 30746, 30746, 30746,
+    30746, 30747, 30748, 30748, 30749, 30750, 30751, 30752, 30752, 30752, 30753, 30753, 30753, 30754, 30754, 30754,
+    30754, 30754, 30754, 30754, 30754, 30754, 30754, 30754, 30755, 30755, 30755, 30755, 30756, 30756, 30756, 30756,
+    30756, 30756, 30757, 30758, 30760, 30760, 30760, 30760, 30761, 30762, 30762, 30762, 30762, 30763, 30763, 30763,
+    30764, 30765, 30765, 30766, 30767, 30767, 30767, 30769, 30770, 30770, 30770, 30770, 30771, 30771, 30771, 30771,
+    30771, 30771, 30771, 30771, 30771, 30771, 30771, 30771, 30771, 30771, 30772, 30772, 30773, 30773, 30774, 30776,
+    30777, 30778, 30780, 30780, 30782, 30783, 30783, 30783, 30783, 30784, 30784, 30785, 30787, 30787, 30787, 30787,
+    30787, 30787, 30787, 30787, 30787, 30790, 30790, 30791, 30794, 30795, 30795, 30795, 30795, 30795, 30801, 30801,
+    30801, 30801, 30802, 30803, 30803, 30803, 30805, 30805, 30805, 30807, 30807, 30808, 30809, 30809, 30810, 30810,
+    30810, 30811, 30811, 30811, 30812, 30812, 30813, 30813, 30813, 30813, 30813, 30813, 30813, 30813, 30813, 30813,
+    30814, 30814, 30814, 30814, 30814, 30814, 30814, 30815, 30816, 30817, 30817, 30817, 30817, 30817, 30817, 30817,
+    30817, 30818, 30818, 30820, 30820, 30820, 30820, 30820, 30820, 30820, 30820, 30820, 30821, 30821, 30821, 30821,
+    30821, 30821, 30823, 30823, 30824, 30824, 30825, 30825, 30825, 30825, 30825, 30825, 30826, 30827, 30827, 30828,
+    30828, 30828, 30828, 30828, 30828, 30829, 30829, 30829, 30829, 30829, 30829, 30829, 30829, 30829, 30829, 30829,
+    30829, 30831, 30831, 30831, 30831, 30831, 30832, 30832, 30832, 30832, 30832, 30834, 30834, 30834, 30834, 30834,
+    30834, 30834, 30834, 30834, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835,
+    30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30835, 30836,
+    30837, 30838, 30838, 30838, 30838, 30838, 30839, 30839, 30840, 30840, 30840, 30840, 30840, 30841, 30841, 30841,
+    30841, 30843, 30845, 30845, 30845, 30846, 30847, 30849, 30850, 30851, 30852, 30852, 30853, 30853, 30853, 30853,
+    30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853, 30853,
+    30853, 30854, 30854, 30854, 30854, 30855, 30855, 30855, 30855, 30855, 30855, 30855, 30855, 30855, 30855, 30855,
+    30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856,
+    30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30856, 30857, 30858, 30858,
+    30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30858, 30859, 30860,
+    30860, 30860, 30860, 30860, 30860, 30861, 30861, 30862, 30862, 30864, 30864, 30864, 30864, 30865, 30865, 30866,
+    30866, 30868, 30868, 30868, 30868, 30869, 30869, 30869, 30869, 30869, 30870, 30870, 30870, 30870, 30870, 30870,
+    30870, 30870, 30870, 30871, 30871, 30871, 30871, 30873, 30873, 30873, 30873, 30873, 30873, 30873, 30873, 30873,
+    30873, 30874, 30875, 30876, 30877, 30878, 30878, 30879, 30880, 30881, 30881, 30881, 30882, 30882, 30882, 30882,
+    30882, 30882, 30882, 30882, 30882, 30882, 30882, 30882, 30882, 30882, 30882, 30882, 30882, 30883, 30883, 30883,
+    30883, 30884, 30884, 30884, 30885, 30885, 30885, 30885, 30885, 30885, 30885, 30885, 30885, 30885, 30886, 30886,
+    30886, 30886, 30886, 30888, 30888, 30888, 30889, 30890, 30890, 30891, 30891, 30891, 30891, 30891, 30893, 30893,
+    30893, 30893, 30894, 30894, 30894, 30894, 30895, 30895, 30895, 30895, 30895, 30895, 30896, 30896, 30897, 30897,
+    30897, 30897, 30897, 30897, 30898, 30898, 30900, 30900, 30900, 30900, 30900, 30900, 30900, 30900, 30900, 30900,
+    30900, 30901, 30901, 30901, 30901, 30902, 30903, 30903, 30903, 30903, 30904, 30904, 30904, 30904, 30904, 30904,
+    30904, 30904, 30904, 30904, 30904, 30904, 30904, 30904, 30904, 30904, 30904, 30905, 30905, 30905, 30906, 30906,
+    30906, 30906, 30906, 30906, 30906, 30907, 30907, 30907, 30907, 30907, 30907, 30907, 30908, 30908, 30908, 30908,
+    30909, 30909, 30909, 30910, 30910, 30910, 30910, 30910, 30910, 30910, 30912, 30912, 30912, 30913, 30913, 30913,
+    30913, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30914, 30915, 30915,
+    30916, 30917, 30919, 30920, 30920, 30920, 30921, 30921, 30922, 30922, 30922, 30922, 30922, 30922, 30923, 30923,
+    30923, 30924, 30924, 30925, 30925, 30925, 30925, 30925, 30925, 30925, 30926, 30926, 30926, 30926, 30931, 30931,
+    30931, 30932, 30934, 30934, 30935, 30935, 30935, 30936, 30936, 30937, 30939, 30940, 30940, 30942, 30943, 30943,
+    30943, 30943, 30944, 30944, 30945, 30945, 30945, 30945, 30945, 30946, 30947, 30947, 30947, 30947, 30947, 30947,
+    30947, 30948, 30949, 30949, 30949, 30949, 30949, 30949, 30949, 30950, 30951, 30951, 30951, 30951, 30951, 30951,
+    30951, 30951, 30952, 30952, 30952, 30953, 30954, 30954, 30954, 30955, 30955, 30955, 30955, 30955, 30955, 30955,
+    30955, 30955, 30955, 30958, 30959, 30960, 30960, 30960, 30960, 30960, 30960, 30960, 30960, 30960, 30960, 30960,
+    30961, 30961, 30961, 30963, 30963, 30964, 30964, 30964, 30964, 30964, 30964, 30964, 30964, 30964, 30964, 30964,
+    30964, 30964, 30964, 30964, 30964, 30964, 30964, 30964, 30965, 30966, 30966, 30966, 30966, 30966, 30966, 30966,
+    30966, 30966, 30966, 30966, 30966, 30966, 30966, 30967, 30968, 30968, 30968, 30969, 30969, 30969, 30974, 30974,
+    30974, 30974, 30975, 30975, 30975, 30975, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977,
+    30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30977, 30979, 30983, 30983,
+    30984, 30984, 30984, 30984, 30984, 30984, 30984, 30984, 30984, 30984, 30984, 30984, 30985, 30985, 30986, 30986,
+    30987, 30987, 30988, 30989, 30989, 30990, 30990, 30991, 30991, 30991, 30991, 30991, 30991, 30991, 30992, 30992,
+    30992, 30992, 30992, 30993, 30993, 30993, 30993, 30994, 30995, 30996, 30996, 30996, 30997, 30999, 31001, 31001,
+    31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31001, 31002, 31006,
+    31006, 31006, 31006, 31006, 31006, 31006, 31006, 31006, 31006, 31006, 31006, 31006, 31006, 31007, 31007, 31007,
+    31007, 31007, 31007, 31007, 31007, 31007, 31007, 31008, 31008, 31009, 31009, 31009, 31009, 31009, 31009, 31009,
+    31009, 31010, 31010, 31010, 31010, 31010, 31010, 31010, 31010, 31010, 31010, 31010, 31010, 31011, 31011, 31011,
+    31011, 31011, 31011, 31011, 31011, 31011, 31011, 31011, 31011, 31012, 31012, 31012, 31012, 31012, 31012, 31012,
+    31012, 31012, 31012, 31012, 31012, 31012, 31013, 31013, 31013, 31014, 31014, 31016, 31017, 31018, 31020, 31020,
+    31022, 31022, 31022, 31023, 31025, 31027, 31027, 31027, 31027, 31027, 31027, 31027, 31027, 31027, 31027, 31027,
+    31027, 31027, 31027, 31027, 31027, 31027, 31027, 31028, 31028, 31028, 31029, 31029, 31029, 31029, 31029, 31029,
+    31029, 31029, 31029, 31030, 31030, 31030, 31030, 31030, 31030, 31030, 31030, 31030, 31030, 31030, 31030, 31030,
+    31030, 31030, 31031, 31031, 31032, 31032, 31032, 31032, 31032, 31032, 31032, 31032, 31032, 31032, 31032, 31032,
+    31032, 31032, 31033, 31033, 31033, 31034, 31034, 31034, 31034, 31035, 31035, 31035, 31035, 31035, 31035, 31035,
+    31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035, 31035,
+    31035, 31035, 31035, 31035, 31035, 31035, 31037, 31037, 31037, 31037, 31038, 31039, 31039, 31039, 31039, 31039,
+    31039, 31039, 31039, 31039, 31039, 31039, 31040, 31040, 31040, 31040, 31040, 31040, 31041, 31041, 31041, 31042,
+    31042, 31042, 31042, 31042, 31042, 31042, 31042, 31042, 31042, 31042, 31042, 31043, 31043, 31043, 31043, 31043,
+    31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31043, 31044, 31044,
+    31050, 31050, 31050, 31050, 31051, 31051, 31052, 31052, 31052, 31052, 31052, 31052, 31052, 31052, 31052, 31053,
+    31054, 31055, 31056, 31056, 31057, 31058, 31058, 31058, 31058, 31058, 31058, 31058, 31058, 31058, 31058, 31058,
+    31058, 31058, 31058, 31058, 31058, 31058, 31058, 31059, 31059, 31060, 31061, 31061, 31061, 31061, 31061, 31061,
+    31062, 31063, 31063, 31063, 31063, 31063, 31063, 31063, 31064, 31064, 31064, 31064, 31065, 31066, 31066, 31066,
+    31066, 31066, 31066, 31066, 31066, 31066, 31066, 31066, 31068, 31068, 31068, 31068, 31068, 31068, 31070, 31072,
+    31073, 31073, 31073, 31073, 31073, 31073, 31074, 31074, 31074, 31074, 31074, 31074, 31076, 31076, 31077, 31078,
+    31079, 31080, 31080, 31080, 31080, 31080, 31081, 31081, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082,
+    31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082, 31082,
+    31082, 31082, 31082, 31083, 31085, 31086, 31086, 31086, 31086, 31086, 31087, 31087, 31087, 31088, 31088, 31088,
+    31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31088, 31089, 31090,
+    31092, 31092, 31092, 31093, 31093, 31094, 31094, 31094, 31094, 31094, 31094, 31094, 31094, 31094, 31095, 31095,
+    31095, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096, 31096,
+    31096, 31096, 31096, 31096, 31097, 31097, 31098, 31098, 31098, 31098, 31098, 31099, 31099, 31100, 31101, 31101,
+    31101, 31101, 31101, 31101, 31101, 31101, 31101, 31101, 31102, 31102, 31102, 31102, 31102, 31102, 31103, 31103,
+    31103, 31103, 31103, 31103, 31103, 31103, 31106, 31107, 31107, 31107, 31108, 31108, 31109, 31111, 31112, 31112,
+    31112, 31113, 31113, 31113, 31113, 31113, 31114, 31115, 31116, 31117, 31118, 31118, 31118, 31118, 31118, 31118,
+    31118, 31118, 31119, 31119, 31119, 31119, 31120, 31120, 31120, 31120, 31120, 31120, 31120, 31120, 31120, 31121,
+    31121, 31121, 31121, 31122, 31122, 31122, 31122, 31122, 31122, 31124, 31124, 31124, 31125, 31125, 31125, 31126,
+    31127, 31127, 31128, 31130, 31130, 31130, 31134, 31136, 31137, 31137, 31140, 31140, 31140, 31140, 31141, 31141,
+    31141, 31142, 31142, 31146, 31147, 31147, 31147, 31147, 31147, 31147, 31147, 31147, 31147, 31147, 31148, 31148,
+    31148, 31149, 31150, 31150, 31150, 31150, 31150, 31151, 31151, 31152, 31152, 31152, 31152, 31152, 31154, 31154,
+    31154, 31154, 31154, 31154, 31154, 31154, 31155, 31155, 31155, 31156, 31156, 31157, 31157, 31157, 31157, 31157,
+    31157, 31157, 31157, 31157, 31158, 31158, 31159, 31159, 31159, 31159, 31159, 31159, 31159, 31159, 31159, 31159,
+    31159, 31159, 31159, 31160, 31160, 31161, 31161, 31162, 31162, 31162, 31162, 31163, 31164, 31165, 31166, 31166,
+    31166, 31166, 31166, 31167, 31167, 31168, 31168, 31168, 31170, 31170, 31170, 31171, 31172, 31172, 31172, 31172,
+    31172, 31173, 31174, 31175, 31176, 31176, 31177, 31178, 31179, 31180, 31180, 31180, 31180, 31180, 31180, 31180,
+    31180, 31180, 31180, 31180, 31181, 31181, 31181, 31181, 31181, 31181, 31181, 31181, 31181, 31181, 31181, 31182,
+    31182, 31184, 31185, 31185, 31185, 31185, 31185, 31185, 31185, 31185, 31185, 31185, 31185, 31185, 31186, 31186,
+    31186, 31186, 31186, 31186, 31187, 31187, 31187, 31187, 31187, 31188, 31188, 31188, 31188, 31188, 31188, 31188,
+    31188, 31189, 31189, 31189, 31189, 31189, 31189, 31189, 31189, 31189, 31189, 31190, 31190, 31190, 31190, 31190,
+    31190, 31190, 31191, 31192, 31193, 31193, 31193, 31193, 31193, 31193, 31193, 31193, 31193, 31193, 31193, 31193,
+    31193, 31193, 31193, 31193, 31193, 31193, 31196, 31196, 31196, 31196, 31196, 31196, 31196, 31197, 31197, 31197,
+    31197, 31198, 31199, 31199, 31199, 31199, 31199, 31200, 31201, 31201, 31202, 31202, 31202, 31202, 31202, 31202,
+    31202, 31202, 31202, 31202, 31202, 31202, 31203, 31204, 31204, 31204, 31204, 31204, 31204, 31204, 31204, 31204,
+    31204, 31205, 31205, 31206, 31206, 31206, 31206, 31206, 31206, 31206, 31206, 31206, 31206, 31206, 31206, 31206,
+    31206, 31206, 31209, 31210, 31210, 31210, 31210, 31211, 31211, 31211, 31212, 31212, 31212, 31212, 31212, 31212,
+    31213, 31214, 31215, 31215, 31216, 31216, 31216, 31216, 31216, 31216, 31216, 31216, 31216, 31216, 31216, 31216,
+    31216, 31216, 31216, 31216, 31216, 31216, 31217, 31217, 31218, 31218, 31218, 31218, 31218, 31218, 31219, 31219,
+    31220, 31220, 31220, 31220, 31221, 31221, 31221, 31221, 31221, 31221, 31222, 31222, 31222, 31223, 31223, 31223,
+    31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223, 31223,
+    31223, 31223, 31223, 31223, 31223, 31224, 31224, 31225, 31225, 31225, 31226, 31227, 31228, 31229, 31229, 31229,
+    31229, 31229, 31229, 31229, 31229, 31229, 31229, 31229, 31229, 31229, 31229, 31232, 31232, 31232, 31232, 31232,
+    31232, 31232, 31232, 31232, 31232, 31232, 31232, 31232, 31232, 31232, 31232, 31233, 31233, 31233, 31234, 31234,
+    31234, 31234, 31235, 31235, 31235, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236,
+    31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31236, 31238, 31238, 31238, 31238, 31238,
+    31238, 31238, 31239, 31240, 31240, 31242, 31243, 31243, 31245, 31245, 31245, 31245, 31245, 31245, 31245, 31245,
+    31245, 31245, 31245, 31245, 31245, 31245, 31245, 31245, 31246, 31253, 31253, 31253, 31253, 31254, 31254, 31255,
+    31255, 31256, 31256, 31256, 31256, 31257, 31257, 31258, 31258, 31258, 31258, 31258, 31258, 31258, 31258, 31258,
+    31258, 31258, 31259, 31260, 31260, 31262, 31262, 31265, 31265, 31265, 31265, 31265, 31265, 31265, 31266, 31266,
+    31266, 31266, 31266, 31268, 31269, 31270, 31270, 31270, 31270, 31270, 31270, 31270, 31271, 31271, 31272, 31272,
+    31272, 31272, 31272, 31272, 31272, 31272, 31272, 31272, 31272, 31272, 31272, 31272, 31273, 31273, 31273, 31273,
+    31275, 31275, 31275, 31275, 31275, 31275, 31275, 31276, 31276, 31276, 31276, 31276, 31276, 31276, 31276, 31276,
+    31276, 31276, 31276, 31277, 31277, 31278, 31278, 31278, 31278, 31280, 31280, 31280, 31280, 31280, 31280, 31280,
+    31280, 31280, 31280, 31281, 31281, 31281, 31281, 31282, 31282, 31283, 31284, 31284, 31284, 31284, 31284, 31284,
+    31284, 31284, 31284, 31284, 31284, 31284, 31284, 31285, 31285, 31285, 31285, 31285, 31285, 31286, 31287, 31287,
+    31287, 31287, 31287, 31287, 31288, 31288, 31289, 31290, 31291, 31292, 31292, 31293, 31293, 31295, 31295, 31295,
+    31295, 31295, 31295, 31295, 31295, 31297, 31297, 31297, 31297, 31297, 31297, 31298, 31298, 31298, 31298, 31298,
+    31298, 31298, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300, 31300,
+    31300, 31301, 31301, 31301, 31301, 31301, 31301, 31301, 31301, 31301, 31301, 31302, 31302, 31302, 31302, 31302,
+    31303, 31303, 31303, 31303, 31303, 31304, 31304, 31305, 31305, 31305, 31305, 31305, 31305, 31305, 31306, 31306,
+    31306, 31307, 31308, 31308, 31308, 31308, 31308, 31308, 31308, 31309, 31309, 31309, 31309, 31309, 31309, 31309,
+    31310, 31310, 31310, 31310, 31310, 31311, 31312, 31312, 31312, 31313, 31313, 31313, 31313, 31313, 31313, 31314,
+    31314, 31314, 31314, 31314, 31314, 31314, 31314, 31314, 31314, 31314, 31314, 31314, 31315, 31315, 31315, 31317,
+    31319, 31320, 31323, 31324, 31324, 31324, 31324, 31324, 31324, 31325, 31326, 31326, 31326, 31326, 31326, 31326,
+    31326, 31326, 31328, 31328, 31329, 31330, 31331, 31331, 31331, 31332, 31332, 31332, 31332, 31332, 31332, 31332,
+    31332, 31332, 31332, 31332, 31333, 31333, 31333, 31333, 31333, 31334, 31334, 31334, 31334, 31334, 31334, 31334,
+    31334, 31334, 31334, 31334, 31334, 31334, 31334, 31335, 31335, 31335, 31336, 31336, 31337, 31338, 31338, 31339,
+    31339, 31339, 31339, 31340, 31340, 31341, 31341, 31341, 31341, 31341, 31342, 31342, 31343, 31343, 31343, 31343,
+    31343, 31343, 31343, 31343, 31344, 31344, 31344, 31344, 31344, 31344, 31345, 31345, 31345, 31345, 31345, 31345,
+    31345, 31345, 31346, 31346, 31348, 31349, 31349, 31349, 31349, 31351, 31351, 31351, 31351, 31351, 31351, 31351,
+    31351, 31351, 31351, 31351, 31352, 31354, 31354, 31354, 31354, 31355, 31355, 31355, 31355, 31355, 31355, 31355,
+    31357, 31357, 31358, 31358, 31358, 31359, 31359, 31359, 31360, 31360, 31360, 31360, 31360, 31360, 31360, 31360,
+    31360, 31360, 31360, 31360, 31361, 31362, 31362, 31362, 31362, 31362, 31362, 31362, 31362, 31362, 31362, 31362,
+    31362, 31363, 31363, 31363, 31363, 31364, 31364, 31364, 31365, 31365, 31365, 31365, 31365, 31365, 31365, 31365,
+    31365, 31365, 31365, 31365, 31365, 31365, 31365, 31365, 31365, 31367, 31367, 31367, 31367, 31367, 31367, 31368,
+    31368, 31368, 31368, 31370, 31370, 31370, 31370, 31372, 31372, 31373, 31373, 31373, 31373, 31373, 31373, 31373,
+    31373, 31374, 31374, 31377, 31377, 31377, 31377, 31377, 31378, 31379, 31379, 31379, 31379, 31379, 31379, 31381,
+    31381, 31381, 31381, 31381, 31381, 31381, 31381, 31381, 31381, 31382, 31382, 31382, 31382, 31382, 31382, 31382,
+    31382, 31382, 31382, 31383, 31383, 31383, 31383, 31383, 31383, 31383, 31383, 31383, 31383, 31383, 31384, 31384,
+    31384, 31385, 31386, 31387, 31387, 31387, 31387, 31387, 31387, 31387, 31387, 31387, 31387, 31387, 31388, 31388,
+    31388, 31388, 31388, 31389, 31389, 31389, 31389, 31389, 31389, 31390, 31390, 31390, 31392, 31392, 31393, 31394,
+    31395, 31397, 31400, 31400, 31400, 31401, 31401, 31401, 31401, 31401, 31401, 31403, 31403, 31404, 31406, 31407,
+    31407, 31407, 31409, 31410, 31410, 31411, 31411, 31412, 31412, 31412, 31412, 31413, 31413, 31413, 31413, 31413,
+    31413, 31413, 31413, 31413, 31413, 31413, 31413, 31414, 31415, 31415, 31415, 31415, 31415, 31415, 31415, 31415,
+    31416, 31416, 31416, 31416, 31416, 31416, 31416, 31416, 31416, 31417, 31417, 31418, 31419, 31419, 31419, 31421,
+    31421, 31421, 31422, 31422, 31423, 31423, 31423, 31423, 31423, 31424, 31425, 31425, 31425, 31425, 31425, 31425,
+    31425, 31425, 31426, 31426, 31426, 31426, 31427, 31427, 31427, 31427, 31430, 31430, 31431, 31431, 31432, 31433,
+    31433, 31433, 31434, 31435, 31435, 31435, 31435, 31435, 31435, 31435, 31435, 31435, 31436, 31438, 31438, 31438,
+    31438, 31439, 31439, 31439, 31440, 31440, 31441, 31442, 31444, 31444, 31444, 31444, 31444, 31445, 31445, 31445,
+    31445, 31445, 31446, 31446, 31447, 31448, 31448, 31448, 31448, 31448, 31449, 31450, 31450, 31450, 31450, 31450,
+    31451, 31452, 31452, 31453, 31454, 31454, 31455, 31455, 31456, 31456, 31457, 31457, 31457, 31457, 31458, 31459,
+    31460, 31461, 31461, 31462, 31462, 31462, 31462, 31462, 31462, 31462, 31462, 31462, 31462, 31462, 31462, 31462,
+    31462, 31462, 31462, 31462, 31462, 31462, 31462, 31463, 31463, 31463, 31463, 31463, 31463, 31463, 31463, 31465,
+    31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465, 31465,
+    31465, 31466, 31467, 31467, 31467, 31467, 31469, 31470, 31470, 31471, 31471, 31471, 31472, 31472, 31472, 31472,
+    31472, 31472, 31472, 31473, 31474, 31474, 31474, 31474, 31474, 31474, 31475, 31475, 31475, 31475, 31475, 31475,
+    31477, 31477, 31477, 31477, 31478, 31478, 31479, 31479, 31479, 31480, 31480, 31482, 31482, 31482, 31482, 31482,
+    31483, 31483, 31483, 31484, 31484, 31485, 31485, 31485, 31485, 31485, 31485, 31485, 31486, 31487, 31488, 31489,
+    31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31489, 31490, 31491,
+    31492, 31492, 31494, 31500, 31501, 31501, 31501, 31501, 31501, 31501, 31502, 31502, 31502, 31503, 31503, 31503,
+    31503, 31503, 31503, 31503, 31503, 31503, 31504, 31504, 31504, 31504, 31504, 31505, 31505, 31506, 31506, 31506,
+    31506, 31506, 31506, 31506, 31506, 31506, 31506, 31506, 31507, 31508, 31508, 31508, 31508, 31508, 31508, 31508,
+    31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508, 31508,
+    31509, 31509, 31509, 31509, 31509, 31510, 31510, 31510, 31510, 31510, 31510, 31510, 31510, 31510, 31511, 31512,
+    31512, 31512, 31512, 31513, 31514, 31514, 31514, 31514, 31515, 31516, 31516, 31516, 31516, 31516, 31516, 31516,
+    31516, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518, 31518,
+    31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519,
+    31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31519, 31521, 31521, 31521, 31521,
+    31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521, 31521,
+    31521, 31522, 31523, 31524, 31524, 31524, 31525, 31527, 31529, 31529, 31531, 31532, 31533, 31537, 31537, 31537,
+    31539, 31539, 31539, 31539, 31539, 31539, 31540, 31540, 31541, 31541, 31541, 31541, 31541, 31542, 31542, 31542,
+    31542, 31542, 31542, 31542, 31542, 31542, 31543, 31545, 31545, 31545, 31546, 31546, 31546, 31546, 31547, 31547,
+    31548, 31550, 31550, 31550, 31552, 31553, 31554, 31555, 31556, 31556, 31556, 31556, 31556, 31556, 31556, 31556,
+    31556, 31556, 31556, 31556, 31556, 31557, 31558, 31559, 31559, 31559, 31559, 31559, 31560, 31560, 31560, 31560,
+    31560, 31560, 31560, 31561, 31561, 31561, 31562, 31563, 31563, 31563, 31563, 31563, 31563, 31563, 31563, 31564,
+    31565, 31565, 31565, 31565, 31566, 31566, 31566, 31566, 31568, 31568, 31568, 31568, 31568, 31568, 31569, 31569,
+    31569, 31569, 31569, 31569, 31569, 31569, 31570, 31571, 31572, 31573, 31574, 31574, 31574, 31574, 31574, 31574,
+    31574, 31574, 31574, 31574, 31574, 31575, 31575, 31575, 31575, 31575, 31575, 31575, 31575, 31575, 31575, 31575,
+    31575, 31575, 31575, 31575, 31575, 31575, 31576, 31576, 31577, 31577, 31577, 31577, 31577, 31577, 31577, 31577,
+    31577, 31577, 31577, 31579, 31579, 31579, 31579, 31579, 31579, 31579, 31580, 31580, 31581, 31581, 31581, 31581,
+    31581, 31582, 31582, 31582, 31582, 31582, 31583, 31584, 31585, 31585, 31585, 31585, 31586, 31586, 31586, 31586,
+    31587, 31587, 31587, 31587, 31587, 31587, 31587, 31587, 31588, 31588, 31588, 31588, 31588, 31588, 31588, 31588,
+    31590, 31590, 31591, 31591, 31591, 31591, 31591, 31591, 31591, 31591, 31591, 31592, 31592, 31592, 31593, 31593,
+    31593, 31593, 31596, 31596, 31598, 31599, 31602, 31604, 31605, 31606, 31607, 31607, 31607, 31607, 31607, 31607,
+    31608, 31608, 31609, 31611, 31612, 31613, 31614, 31615, 31615, 31615, 31616, 31616, 31617, 31618, 31619, 31620,
+    31620, 31621, 31622, 31624, 31627, 31627, 31627, 31628, 31628, 31628, 31628, 31629, 31633, 31634, 31634, 31634,
+    31634, 31634, 31635, 31635, 31635, 31635, 31635, 31636, 31636, 31636, 31636, 31637, 31637, 31637, 31637, 31637,
+    31637, 31637, 31637, 31637, 31637, 31637, 31639, 31639, 31639, 31639, 31639, 31639, 31639, 31640, 31640, 31640,
+    31640, 31641, 31642, 31644, 31644, 31644, 31644, 31644, 31644, 31644, 31644, 31648, 31649, 31649, 31649, 31649,
+    31649, 31649, 31649, 31649, 31649, 31649, 31650, 31650, 31650, 31650, 31650, 31650, 31650, 31650, 31650, 31650,
+    31650, 31650, 31650, 31651, 31653, 31654, 31654, 31655, 31655, 31655, 31657, 31657, 31657, 31658, 31658, 31658,
+    31658, 31658, 31659, 31659, 31659, 31659, 31661, 31661, 31661, 31662, 31662, 31662, 31662, 31662, 31663, 31664,
+    31664, 31666, 31667, 31667, 31667, 31668, 31668, 31668, 31668, 31669, 31669, 31670, 31670, 31670, 31670, 31670,
+    31670, 31672, 31672, 31672, 31672, 31673, 31673, 31673, 31673, 31673, 31676, 31677, 31677, 31677, 31677, 31677,
+    31678, 31678, 31678, 31679, 31679, 31679, 31679, 31680, 31681, 31681, 31681, 31681, 31681, 31681, 31682, 31682,
+    31682, 31682, 31682, 31682, 31682, 31682, 31682, 31683, 31683, 31683, 31683, 31683, 31684, 31684, 31685, 31685,
+    31687, 31687, 31688, 31688, 31688, 31688, 31689, 31689, 31689, 31689, 31689, 31690, 31690, 31690, 31690, 31691,
+    31691, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31694, 31696,
+    31696, 31696, 31696, 31696, 31696, 31697, 31697, 31697, 31697, 31697, 31697, 31697, 31697, 31697, 31698, 31698,
+    31698, 31698, 31698, 31698, 31698, 31698, 31699, 31699, 31699, 31699, 31700, 31700, 31703, 31703, 31703, 31703,
+    31703, 31703, 31704, 31704, 31704, 31704, 31705, 31705, 31705, 31705, 31705, 31705, 31705, 31706, 31706, 31706,
+    31706, 31706, 31707, 31707, 31707, 31707, 31707, 31707, 31707, 31707, 31708, 31708, 31708, 31708, 31710, 31710,
+    31710, 31710, 31710, 31710, 31711, 31711, 31711, 31711, 31711, 31711, 31711, 31711, 31711, 31711, 31711, 31712,
+    31712, 31713, 31713, 31713, 31714, 31714, 31714, 31714, 31714, 31715, 31715, 31715, 31715, 31715, 31715, 31715,
+    31715, 31715, 31715, 31715, 31715, 31715, 31715, 31715, 31715, 31716, 31716, 31718, 31718, 31718, 31718, 31719,
+    31719, 31720, 31721, 31722, 31723, 31724, 31725, 31725, 31726, 31727, 31728, 31729, 31729, 31729, 31729, 31729,
+    31730, 31730, 31731, 31731, 31731, 31731, 31731, 31731, 31731, 31731, 31732, 31732, 31732, 31732, 31732, 31732,
+    31733, 31733, 31736, 31737, 31738, 31738, 31738, 31738, 31738, 31738, 31738, 31738, 31738, 31738, 31739, 31740,
+    31740, 31740, 31740, 31740, 31740, 31740, 31741, 31741, 31741, 31741, 31741, 31741, 31741, 31741, 31741, 31741,
+    31741, 31741, 31741, 31741, 31741, 31741, 31742, 31742, 31745, 31745, 31745, 31745, 31746, 31746, 31746, 31746,
+    31746, 31746, 31746, 31746, 31746, 31746, 31746, 31746, 31747, 31747, 31747, 31747, 31747, 31751, 31751, 31751,
+    31751, 31752, 31752, 31752, 31752, 31752, 31753, 31753, 31755, 31755, 31755, 31755, 31756, 31756, 31756, 31757,
+    31758, 31758, 31758, 31758, 31759, 31759, 31761, 31761, 31761, 31761, 31763, 31764, 31765, 31766, 31766, 31767,
+    31767, 31768, 31770, 31771, 31771, 31771, 31771, 31771, 31771, 31771, 31771, 31771, 31771, 31773, 31773, 31773,
+    31773, 31773, 31774, 31774, 31774, 31774, 31774, 31774, 31774, 31774, 31774, 31775, 31775, 31775, 31775, 31775,
+    31775, 31775, 31775, 31776, 31776, 31776, 31776, 31776, 31776, 31776, 31776, 31776, 31776, 31776, 31776, 31776,
+    31776, 31776, 31776, 31776, 31776, 31776, 31776, 31777, 31778, 31778, 31779, 31779, 31779, 31779, 31781, 31781,
+    31781, 31782, 31782, 31782, 31782, 31782, 31784, 31784, 31784, 31785, 31785, 31786, 31786, 31786, 31786, 31786,
+    31786, 31786, 31786, 31788, 31789, 31790, 31790, 31790, 31790, 31790, 31790, 31790, 31790, 31790, 31790, 31791,
+    31791, 31791, 31791, 31791, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792,
+    31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792, 31792,
+    31792, 31793, 31793, 31793, 31793, 31793, 31794, 31794, 31794, 31794, 31794, 31794, 31794, 31794, 31794, 31794,
+    31795, 31795, 31796, 31796, 31796, 31796, 31796, 31796, 31796, 31797, 31798, 31798, 31798, 31798, 31798, 31798,
+    31798, 31798, 31798, 31798, 31798, 31798, 31798, 31798, 31798, 31798, 31799, 31800, 31800, 31800, 31801, 31801,
+    31801, 31801, 31801, 31801, 31801, 31801, 31801, 31801, 31801, 31801, 31801, 31805, 31806, 31806, 31806, 31807,
+    31808, 31809, 31809, 31809, 31809, 31809, 31809, 31810, 31810, 31810, 31810, 31810, 31810, 31810, 31811, 31811,
+    31811, 31811, 31811, 31812, 31812, 31813, 31814, 31815, 31816, 31816, 31816, 31816, 31816, 31816, 31816, 31817,
+    31819, 31819, 31819, 31819, 31819, 31819, 31820, 31820, 31820, 31820, 31820, 31821, 31821, 31821, 31822, 31822,
+    31822, 31822, 31822, 31822, 31824, 31824, 31824, 31825, 31825, 31825, 31825, 31825, 31825, 31825, 31825, 31825,
+    31825, 31826, 31826, 31827, 31827, 31827, 31827, 31827, 31828, 31828, 31828, 31828, 31828, 31828, 31828, 31828,
+    31828, 31828, 31828, 31828, 31828, 31828, 31828, 31829, 31830, 31830, 31831, 31831, 31831, 31831, 31831, 31832,
+    31832, 31832, 31832, 31832, 31832, 31832, 31832, 31832, 31832, 31832, 31832, 31833, 31833, 31834, 31834, 31834,
+    31834, 31834, 31834, 31834, 31834, 31834, 31834, 31834, 31834, 31834, 31834, 31834, 31835, 31835, 31836, 31837,
+    31838, 31838, 31838, 31839, 31839, 31839, 31839, 31840, 31840, 31840, 31841, 31841, 31842, 31842, 31842, 31842,
+    31842, 31842, 31842, 31843, 31844, 31844, 31844, 31844, 31845, 31845, 31845, 31845, 31845, 31845, 31845, 31845,
+    31846, 31846, 31847, 31848, 31848, 31848, 31848, 31848, 31848, 31848, 31851, 31851, 31851, 31851, 31851, 31851,
+    31851, 31851, 31851, 31852, 31852, 31856, 31858, 31859, 31859, 31860, 31861, 31861, 31861, 31861, 31861, 31863,
+    31863, 31864, 31864, 31864, 31864, 31864, 31864, 31866, 31866, 31866, 31866, 31866, 31866, 31866, 31866, 31866,
+    31866, 31867, 31867, 31867, 31868, 31868, 31868, 31869, 31869, 31869, 31869, 31869, 31870, 31871, 31875, 31880,
+    31880, 31880, 31880, 31880, 31884, 31884, 31886, 31889, 31890, 31890, 31890, 31890, 31891, 31892, 31892, 31893,
+    31893, 31896, 31897, 31897, 31897, 31897, 31898, 31898, 31899, 31899, 31899, 31900, 31900, 31900, 31900, 31907,
+    31907, 31907, 31908, 31908, 31908, 31910, 31910, 31910, 31910, 31910, 31911, 31911, 31911, 31911, 31912, 31914,
+    31915, 31916, 31916, 31916, 31916, 31916, 31916, 31916, 31916, 31917, 31918, 31918, 31918, 31918, 31918, 31918,
+    31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918, 31918,
+    31918, 31919, 31919, 31920, 31920, 31920, 31920, 31920, 31920, 31920, 31920, 31921, 31921, 31921, 31922, 31922,
+    31922, 31922, 31922, 31922, 31922, 31924, 31924, 31924, 31924, 31924, 31925, 31925, 31925, 31925, 31925, 31925,
+    31926, 31926, 31926, 31926, 31927, 31927, 31928, 31928, 31928, 31928, 31928, 31928, 31930, 31931, 31931, 31931,
+    31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931, 31931,
+    31931, 31932, 31933, 31933, 31933, 31933, 31933, 31934, 31934, 31934, 31937, 31937, 31937, 31937, 31937, 31937,
+    31937, 31937, 31937, 31937, 31938, 31941, 31941, 31941, 31942, 31942, 31943, 31943, 31943, 31944, 31944, 31945,
+    31945, 31945, 31945, 31946, 31946, 31946, 31946, 31948, 31948, 31948, 31949, 31949, 31949, 31949, 31949, 31950,
+    31950, 31950, 31950, 31950, 31950, 31950, 31950, 31950, 31951, 31951, 31951, 31951, 31952, 31952, 31953, 31954,
+    31954, 31954, 31954, 31954, 31954, 31954, 31954, 31954, 31954, 31956, 31956, 31957, 31958, 31958, 31960, 31960,
+    31960, 31960, 31960, 31960, 31961, 31961, 31961, 31961, 31961, 31961, 31961, 31961, 31962, 31962, 31962, 31962,
+    31962, 31962, 31962, 31962, 31964, 31964, 31964, 31964, 31964, 31964, 31964, 31964, 31964, 31964, 31964, 31964,
+    31964, 31965, 31965, 31965, 31965, 31966, 31967, 31967, 31967, 31967, 31967, 31967, 31967, 31967, 31967, 31968,
+    31968, 31968, 31968, 31968, 31969, 31970, 31971, 31971, 31971, 31971, 31971, 31973, 31973, 31973, 31973, 31973,
+    31973, 31973, 31973, 31974, 31975, 31976, 31976, 31977, 31977, 31978, 31978, 31978, 31978, 31978, 31978, 31978,
+    31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978, 31978,
+    31978, 31978, 31978, 31979, 31979, 31980, 31980, 31981, 31981, 31981, 31981, 31981, 31981, 31983, 31984, 31985,
+    31986, 31986, 31986, 31987, 31987, 31987, 31987, 31987, 31987, 31988, 31988, 31988, 31988, 31988, 31988, 31988,
+    31988, 31989, 31990, 31990, 31990, 31991, 31991, 31991, 31991, 31992, 31992, 31993, 31993, 31993, 31993, 31993,
+    31994, 31994, 31994, 31994, 31994, 31994, 31995, 31995, 31995, 31995, 31996, 31997, 31997, 31998, 31998, 31999,
+    32002, 32002, 32002, 32002, 32003, 32003, 32003, 32004, 32006, 32006, 32007, 32007, 32007, 32007, 32007, 32008,
+    32009, 32009, 32009, 32009, 32009, 32009, 32009, 32009, 32009, 32009, 32009, 32011, 32012, 32012, 32012, 32012,
+    32015, 32015, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016, 32016,
+    32016, 32016, 32016, 32016, 32017, 32017, 32017, 32017, 32017, 32017, 32017, 32018, 32018, 32018, 32018, 32018,
+    32019, 32019, 32019, 32020, 32020, 32020, 32020, 32021, 32021, 32021, 32021, 32021, 32021, 32021, 32021, 32021,
+    32021, 32021, 32021, 32022, 32022, 32022, 32023, 32024, 32024, 32024, 32024, 32024, 32024, 32024, 32025, 32025,
+    32026, 32027, 32027, 32027, 32027, 32027, 32027, 32028, 32031, 32031, 32032, 32032, 32032, 32032, 32032, 32032,
+    32032, 32032, 32032, 32033, 32033, 32033, 32034, 32035, 32036, 32036, 32036, 32037, 32039, 32039, 32039, 32039,
+    32039, 32040, 32040, 32041, 32041, 32042, 32042, 32042, 32043, 32043, 32043, 32043, 32043, 32043, 32043, 32043,
+    32043, 32043, 32044, 32044, 32044, 32044, 32044, 32045, 32045, 32045, 32045, 32045, 32046, 32046, 32046, 32046,
+    32047, 32048, 32049, 32049, 32050, 32051, 32052, 32052, 32053, 32053, 32053, 32053, 32053, 32053, 32054, 32054,
+    32055, 32055, 32055, 32056, 32056, 32056, 32056, 32057, 32057, 32059, 32061, 32062, 32069, 32070, 32070, 32070,
+    32071, 32071, 32072, 32072, 32073, 32073, 32073, 32073, 32073, 32073, 32075, 32075, 32075, 32075, 32075, 32075,
+    32076, 32076, 32076, 32076, 32076, 32078, 32079, 32079, 32079, 32079, 32079, 32080, 32081, 32081, 32081, 32084,
+    32084, 32084, 32085, 32085, 32085, 32085, 32085, 32085, 32086, 32086, 32086, 32086, 32086, 32086, 32086, 32087,
+    32088, 32088, 32088, 32088, 32088, 32089, 32089, 32089, 32089, 32089, 32089, 32090, 32091, 32091, 32091, 32092,
+    32092, 32092, 32093, 32093, 32093, 32094, 32094, 32094, 32094, 32095, 32096, 32097, 32097, 32097, 32097, 32098,
+    32099, 32101, 32101, 32101, 32101, 32102, 32102, 32102, 32103, 32103, 32103, 32103, 32103, 32103, 32103, 32103,
+    32103, 32103, 32103, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104,
+    32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32104, 32105, 32105, 32105, 32105, 32105, 32105, 32105,
+    32105, 32105, 32105, 32105, 32105, 32105, 32106, 32107, 32107, 32107, 32107, 32107, 32107, 32107, 32107, 32107,
+    32107, 32107, 32107, 32107, 32107, 32107, 32112, 32112, 32112, 32112, 32112, 32112, 32112, 32112, 32112, 32112,
+    32112, 32112, 32112, 32112, 32112, 32112, 32112, 32113, 32113, 32113, 32113, 32114, 32115, 32115, 32115, 32115,
+    32115, 32115, 32115, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32117, 32118, 32118, 32118,
+    32119, 32120, 32121, 32121, 32122, 32123, 32123, 32124, 32124, 32125, 32129, 32129, 32129, 32129, 32129, 32129,
+    32129, 32130, 32130, 32131, 32131, 32131, 32131, 32131, 32131, 32131, 32132, 32132, 32132, 32132, 32133, 32133,
+    32133, 32133, 32133, 32134, 32135, 32136, 32136, 32136, 32136, 32136, 32136, 32136, 32136, 32137, 32138, 32139,
+    32139, 32139, 32140, 32140, 32140, 32140, 32141, 32142, 32143, 32143, 32143, 32144, 32144, 32144, 32144, 32144,
+    32144, 32144, 32144, 32144, 32144, 32144, 32144, 32144, 32144, 32144, 32145, 32145, 32145, 32145, 32145, 32145,
+    32145, 32145, 32145, 32145, 32145, 32145, 32147, 32151, 32151, 32152, 32152, 32153, 32153, 32154, 32155, 32156,
+    32157, 32157, 32157, 32157, 32157, 32159, 32159, 32159, 32159, 32160, 32160, 32160, 32160, 32160, 32160, 32160,
+    32160, 32161, 32161, 32161, 32161, 32161, 32161, 32164, 32165, 32165, 32165, 32165, 32165, 32165, 32166, 32166,
+    32167, 32168, 32168, 32169, 32170, 32170, 32170, 32170, 32170, 32170, 32170, 32170, 32170, 32170, 32170, 32170,
+    32170, 32170, 32171, 32172, 32173, 32174, 32175, 32175, 32175, 32175, 32176, 32176, 32176, 32176, 32176, 32176,
+    32176, 32180, 32180, 32180, 32180, 32180, 32180, 32180, 32180, 32180, 32181, 32181, 32181, 32181, 32181, 32181,
+    32182, 32183, 32183, 32183, 32183, 32183, 32184, 32185, 32185, 32185, 32185, 32185, 32185, 32185, 32185, 32185,
+    32186, 32186, 32186, 32188, 32188, 32189, 32189, 32189, 32189, 32189, 32190, 32190, 32190, 32190, 32190, 32190,
+    32190, 32190, 32191, 32191, 32191, 32192, 32192, 32192, 32192, 32194, 32194, 32195, 32195, 32195, 32196, 32196,
+    32196, 32196, 32196, 32197, 32198, 32199, 32199, 32201, 32201, 32201, 32201, 32201, 32202, 32202, 32202, 32203,
+    32203, 32204, 32204, 32205, 32205, 32205, 32205, 32207, 32207, 32207, 32207, 32207, 32211, 32211, 32211, 32211,
+    32214, 32214, 32215, 32215, 32215, 32216, 32216, 32216, 32216, 32217, 32217, 32217, 32218, 32219, 32219, 32221,
+    32221, 32221, 32221, 32222, 32222, 32223, 32223, 32223, 32223, 32223, 32224, 32224, 32224, 32225, 32226, 32227,
+    32227, 32227, 32227, 32229, 32229, 32229, 32229, 32230, 32230, 32230, 32230, 32230, 32230, 32230, 32230, 32230,
+    32230, 32230, 32230, 32231, 32231, 32231, 32233, 32233, 32233, 32235, 32236, 32236, 32236, 32239, 32239, 32239,
+    32239, 32239, 32239, 32240, 32240, 32240, 32240, 32240, 32243, 32243, 32243, 32243, 32244, 32244, 32245, 32245,
+    32245, 32245, 32245, 32245, 32246, 32246, 32246, 32247, 32247, 32249, 32249, 32249, 32251, 32251, 32251, 32251,
+    32251, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252, 32252,
+    32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32254, 32257,
+    32257, 32257, 32257, 32257, 32257, 32257, 32257, 32257, 32257, 32257, 32257, 32258, 32258, 32258, 32258, 32258,
+    32258, 32258, 32258, 32258, 32258, 32258, 32258, 32258, 32258, 32258, 32258, 32258, 32259, 32259, 32259, 32259,
+    32260, 32260, 32261, 32261, 32261, 32261, 32261, 32261, 32261, 32261, 32262, 32264, 32264, 32264, 32264, 32264,
+    32264, 32264, 32264, 32264, 32264, 32265, 32265, 32265, 32265, 32266, 32266, 32267, 32267, 32267, 32267, 32267,
+    32268, 32268, 32268, 32268, 32268, 32268, 32270, 32270, 32271, 32271, 32271, 32271, 32271, 32272, 32272, 32272,
+    32273, 32276, 32276, 32277, 32279, 32280, 32280, 32280, 32282, 32284, 32285, 32285, 32286, 32286, 32286, 32286,
+    32286, 32286, 32286, 32286, 32286, 32290, 32290, 32290, 32291, 32292, 32292, 32292, 32292, 32292, 32292, 32292,
+    32292, 32293, 32293, 32293, 32293, 32293, 32293, 32293, 32293, 32293, 32293, 32294, 32295, 32295, 32295, 32295,
+    32295, 32296, 32296, 32297, 32298, 32298, 32298, 32298, 32298, 32299, 32299, 32299, 32300, 32300, 32300, 32300,
+    32300, 32300, 32301, 32301, 32301, 32301, 32301, 32301, 32301, 32302, 32302, 32302, 32302, 32302, 32302, 32302,
+    32302, 32303, 32303, 32303, 32303, 32303, 32303, 32303, 32303, 32303, 32304, 32304, 32304, 32304, 32304, 32304,
+    32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32304, 32305, 32305,
+    32306, 32306, 32306, 32307, 32307, 32308, 32308, 32308, 32309, 32309, 32310, 32310, 32311, 32311, 32311, 32311,
+    32311, 32311, 32311, 32312, 32312, 32313, 32313, 32313, 32313, 32313, 32313, 32316, 32316, 32319, 32321, 32321,
+    32321, 32321, 32321, 32321, 32321, 32323, 32323, 32323, 32323, 32323, 32323, 32326, 32326, 32326, 32326, 32326,
+    32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327, 32327,
+    32327, 32328, 32328, 32328, 32330, 32330, 32330, 32330, 32330, 32330, 32330, 32331, 32331, 32331, 32331, 32331,
+    32331, 32331, 32334, 32334, 32334, 32334, 32334, 32334, 32334, 32334, 32334, 32336, 32336, 32336, 32336, 32336,
+    32336, 32336, 32336, 32336, 32336, 32338, 32339, 32340, 32340, 32340, 32340, 32340, 32340, 32340, 32340, 32340,
+    32340, 32341, 32341, 32341, 32342, 32343, 32343, 32343, 32343, 32343, 32343, 32343, 32343, 32343, 32343, 32344,
+    32344, 32344, 32344, 32344, 32344, 32344, 32345, 32345, 32346, 32346, 32346, 32346, 32346, 32347, 32347, 32347,
+    32347, 32347, 32348, 32349, 32349, 32349, 32350, 32350, 32350, 32351, 32351, 32352, 32352, 32352, 32352, 32352,
+    32353, 32353, 32353, 32353, 32353, 32353, 32354, 32354, 32355, 32355, 32355, 32355, 32355, 32356, 32356, 32357,
+    32357, 32357, 32358, 32358, 32358, 32360, 32361, 32361, 32361, 32361, 32361, 32361, 32361, 32361, 32361, 32361,
+    32361, 32362, 32363, 32363, 32363, 32363, 32363, 32364, 32364, 32365, 32365, 32365, 32365, 32365, 32365, 32365,
+    32365, 32366, 32366, 32366, 32366, 32367, 32367, 32368, 32368, 32369, 32369, 32370, 32371, 32371, 32372, 32372,
+    32373, 32375, 32375, 32375, 32376, 32376, 32376, 32377, 32378, 32378, 32378, 32379, 32380, 32380, 32381, 32381,
+    32382, 32383, 32384, 32385, 32386, 32387, 32387, 32388, 32388, 32388, 32388, 32388, 32389, 32390, 32390, 32390,
+    32391, 32391, 32391, 32391, 32391, 32391, 32391, 32392, 32392, 32392, 32393, 32394, 32394, 32394, 32395, 32396,
+    32396, 32396, 32397, 32397, 32397, 32397, 32397, 32397, 32397, 32397, 32398, 32399, 32399, 32399, 32399, 32399,
+    32400, 32400, 32400, 32400, 32400, 32400, 32400, 32400, 32400, 32402, 32403, 32404, 32405, 32406, 32406, 32406,
+    32406, 32406, 32406, 32407, 32407, 32407, 32407, 32407, 32407, 32407, 32407, 32408, 32408, 32408, 32409, 32409,
+    32409, 32409, 32409, 32409, 32409, 32410, 32410, 32411, 32412, 32413, 32413, 32413, 32413, 32413, 32413, 32413,
+    32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413, 32413,
+    32413, 32415, 32415, 32416, 32417, 32417, 32418, 32418, 32418, 32418, 32418, 32418, 32419, 32419, 32419, 32419,
+    32419, 32419, 32419, 32420, 32420, 32421, 32421, 32423, 32423, 32423, 32423, 32423, 32423, 32423, 32423, 32423,
+    32423, 32423, 32424, 32425, 32425, 32425, 32425, 32425, 32425, 32425, 32425, 32425, 32425, 32425, 32425, 32426,
+    32426, 32426, 32426, 32427, 32427, 32427, 32427, 32427, 32427, 32427, 32427, 32427, 32427, 32428, 32429, 32429,
+    32429, 32429, 32429, 32429, 32429, 32429, 32430, 32430, 32430, 32431, 32432, 32432, 32432, 32432, 32432, 32432,
+    32432, 32432, 32433, 32434, 32434, 32434, 32434, 32434, 32434, 32434, 32435, 32435, 32435, 32435, 32435, 32435,
+    32435, 32435, 32435, 32435, 32436, 32437, 32437, 32437, 32437, 32437, 32437, 32437, 32437, 32437, 32437, 32438,
+    32439, 32439, 32439, 32439, 32439, 32439, 32439, 32439, 32440, 32440, 32440, 32440, 32440, 32440, 32441, 32441,
+    32441, 32441, 32444, 32444, 32444, 32444, 32445, 32445, 32445, 32446, 32446, 32446, 32446, 32446, 32446, 32446,
+    32447, 32447, 32447, 32447, 32447, 32447, 32447, 32447, 32447, 32447, 32447, 32448, 32448, 32448, 32448, 32448,
+    32448, 32448, 32448, 32448, 32448, 32448, 32448, 32448, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32450,
+    32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32451, 32452,
+    32452, 32452, 32453, 32454, 32454, 32454, 32454, 32454, 32454, 32454, 32454, 32454, 32454, 32454, 32455, 32455,
+    32455, 32455, 32455, 32455, 32455, 32455, 32456, 32456, 32456, 32457, 32457, 32458, 32458, 32458, 32458, 32458,
+    32458, 32458, 32458, 32458, 32458, 32459, 32459, 32460, 32460, 32461, 32461, 32461, 32462, 32462, 32462, 32463,
+    32463, 32464, 32464, 32464, 32464, 32464, 32464, 32464, 32464, 32465, 32465, 32465, 32465, 32465, 32466, 32466,
+    32466, 32466, 32466, 32466, 32466, 32466, 32466, 32466, 32466, 32468, 32468, 32468, 32468, 32468, 32468, 32469,
+    32469, 32470, 32471, 32472, 32472, 32472, 32472, 32472, 32472, 32472, 32472, 32472, 32472, 32472, 32473, 32473,
+    32474, 32475, 32475, 32475, 32476, 32477, 32477, 32477, 32477, 32478, 32478, 32479, 32480, 32480, 32481, 32481,
+    32481, 32481, 32481, 32482, 32482, 32483, 32484, 32484, 32484, 32484, 32484, 32484, 32484, 32484, 32484, 32484,
+    32484, 32485, 32485, 32486, 32486, 32486, 32486, 32486, 32486, 32486, 32486, 32486, 32487, 32487, 32487, 32487,
+    32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487, 32487,
+    32487, 32487, 32487, 32487, 32487, 32487, 32488, 32488, 32488, 32489, 32489, 32490, 32490, 32490, 32490, 32490,
+    32490, 32490, 32491, 32491, 32491, 32491, 32491, 32491, 32491, 32492, 32492, 32493, 32493, 32493, 32493, 32493,
+    32493, 32493, 32493, 32493, 32493, 32493, 32494, 32494, 32494, 32494, 32494, 32494, 32495, 32495, 32495, 32496,
+    32496, 32496, 32496, 32496, 32496, 32496, 32496, 32497, 32497, 32497, 32498, 32499, 32499, 32499, 32500, 32500,
+    32500, 32500, 32500, 32501, 32501, 32501, 32501, 32502, 32503, 32504, 32504, 32505, 32505, 32505, 32506, 32506,
+    32507, 32507, 32507, 32507, 32507, 32507, 32507, 32508, 32508, 32508, 32508, 32508, 32508, 32508, 32508, 32508,
+    32509, 32509, 32509, 32510, 32510, 32510, 32510, 32511, 32511, 32511, 32511, 32511, 32513, 32513, 32513, 32513,
+    32513, 32513, 32513, 32513, 32514, 32514, 32514, 32514, 32515, 32515, 32515, 32515, 32515, 32515, 32516, 32516,
+    32517, 32517, 32517, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518,
+    32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32518, 32519, 32519, 32519,
+    32519, 32519, 32519, 32519, 32520, 32520, 32520, 32520, 32520, 32520, 32520, 32520, 32521, 32521, 32522, 32522,
+    32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32522, 32523, 32523,
+    32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524, 32524,
+    32525, 32525, 32525, 32525, 32526, 32526, 32526, 32526, 32526, 32527, 32527, 32527, 32527, 32527, 32527, 32527,
+    32527, 32528, 32528, 32528, 32528, 32528, 32528, 32528, 32528, 32528, 32529, 32529, 32529, 32529, 32529, 32529,
+    32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32529, 32530, 32530,
+    32530, 32530, 32530, 32530, 32530, 32530, 32530, 32530, 32530, 32530, 32530, 32530, 32531, 32531, 32531, 32531,
+    32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531, 32531,
+    32531, 32531, 32531, 32531, 32534, 32534, 32535, 32536, 32536, 32536, 32536, 32537, 32537, 32537, 32537, 32537,
+    32537, 32537, 32537, 32537, 32537, 32538, 32538, 32538, 32538, 32538, 32540, 32540, 32542, 32543, 32543, 32543,
+    32543, 32543, 32546, 32546, 32546, 32546, 32546, 32546, 32547, 32547, 32547, 32548, 32550, 32553, 32553, 32553,
+    32553, 32553, 32553, 32553, 32553, 32554, 32554, 32554, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555,
+    32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32555, 32556, 32556, 32556,
+    32556, 32556, 32556, 32556, 32557, 32557, 32557, 32557, 32557, 32557, 32557, 32557, 32557, 32557, 32557, 32557,
+    32558, 32559, 32559, 32559, 32560, 32561, 32561, 32561, 32561, 32561, 32561, 32561, 32561, 32561, 32561, 32561,
+    32561, 32561, 32561, 32562, 32563, 32563, 32563, 32563, 32564, 32565, 32565, 32567, 32567, 32567, 32567, 32567,
+    32567, 32567, 32567, 32568, 32568, 32568, 32568, 32568, 32569, 32569, 32569, 32571, 32572, 32572, 32572, 32572,
+    32572, 32572, 32572, 32572, 32572, 32572, 32572, 32572, 32572, 32572, 32573, 32573, 32573, 32573, 32573, 32573,
+    32573, 32573, 32573, 32573, 32573, 32573, 32573, 32573, 32573, 32573, 32573, 32573, 32574, 32574, 32574, 32574,
+    32574, 32574, 32574, 32574, 32575, 32575, 32575, 32575, 32575, 32577, 32579, 32579, 32579, 32579, 32580, 32580,
+    32581, 32581, 32581, 32581, 32582, 32582, 32582, 32582, 32584, 32584, 32584, 32584, 32584, 32584, 32584, 32584,
+    32584, 32585, 32585, 32585, 32585, 32585, 32585, 32585, 32585, 32585, 32586, 32587, 32587, 32587, 32587, 32587,
+    32587, 32587, 32587, 32590, 32590, 32590, 32590, 32591, 32591, 32591, 32591, 32592, 32592, 32592, 32592, 32593,
+    32593, 32593, 32594, 32594, 32594, 32594, 32594, 32594, 32594, 32594, 32594, 32594, 32594, 32595, 32595, 32595,
+    32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595, 32595,
+    32595, 32597, 32597, 32598, 32598, 32599, 32599, 32599, 32600, 32600, 32600, 32601, 32601, 32601, 32601, 32602,
+    32603, 32604, 32604, 32604, 32604, 32604, 32604, 32604, 32604, 32604, 32604, 32604, 32604, 32605, 32605, 32605,
+    32605, 32605, 32605, 32605, 32605, 32605, 32606, 32606, 32606, 32607, 32608, 32608, 32608, 32608, 32608, 32608,
+    32608, 32608, 32608, 32608, 32609, 32609, 32610, 32610, 32611, 32611, 32612, 32612, 32612, 32612, 32612, 32612,
+    32612, 32612, 32612, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613,
+    32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32613, 32614, 32614, 32614, 32614, 32614,
+    32614, 32614, 32614, 32614, 32615, 32616, 32617, 32618, 32619, 32620, 32621, 32623, 32624, 32625, 32626, 32626,
+    32626, 32626, 32626, 32626, 32627, 32627, 32628, 32628, 32628, 32628, 32628, 32628, 32628, 32628, 32628, 32629,
+    32629, 32629, 32629, 32629, 32629, 32629, 32629, 32629, 32629, 32629, 32629, 32630, 32631, 32631, 32631, 32631,
+    32631, 32631, 32631, 32631, 32631, 32632, 32633, 32634, 32634, 32635, 32635, 32635, 32636, 32636, 32636, 32636,
+    32637, 32638, 32638, 32638, 32638, 32638, 32638, 32638, 32639, 32640, 32641, 32643, 32643, 32644, 32644, 32645,
+    32645, 32645, 32646, 32647, 32647, 32647, 32647, 32647, 32647, 32647, 32647, 32647, 32647, 32647, 32647, 32647,
+    32648, 32648, 32648, 32648, 32648, 32648, 32648, 32648, 32648, 32649, 32649, 32650, 32650, 32651, 32651, 32651,
+    32651, 32652, 32652, 32654, 32655, 32655, 32655, 32655, 32656, 32656, 32656, 32656, 32656, 32656, 32656, 32656,
+    32657, 32657, 32657, 32657, 32657, 32657, 32657, 32657, 32657, 32657, 32657, 32658, 32659, 32659, 32660, 32660,
+    32660, 32660, 32660, 32660, 32661, 32661, 32661, 32661, 32661, 32661, 32662, 32662, 32662, 32662, 32662, 32662,
+    32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663, 32663,
+    32663, 32663, 32663, 32663, 32663, 32663, 32664, 32665, 32666, 32666, 32666, 32666, 32666, 32666, 32667, 32667,
+    32667, 32667, 32667, 32667, 32667, 32668, 32668, 32668, 32669, 32670, 32670, 32670, 32670, 32670, 32670, 32671,
+    32672, 32672, 32672, 32673, 32673, 32673, 32673, 32673, 32673, 32674, 32674, 32675, 32675, 32675, 32675, 32675,
+    32675, 32675, 32675, 32675, 32675, 32675, 32675, 32675, 32675, 32676, 32676, 32676, 32677, 32677, 32677, 32677,
+    32678, 32678, 32678, 32678, 32678, 32678, 32678, 32679, 32679, 32679, 32679, 32680, 32680, 32681, 32681, 32681,
+    32681, 32681, 32681, 32681, 32682, 32683, 32683, 32683, 32683, 32684, 32684, 32685, 32686, 32686, 32686, 32687,
+    32687, 32687, 32687, 32687, 32687, 32687, 32688, 32688, 32689, 32689, 32689, 32689, 32690, 32690, 32690, 32690,
+    32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32690, 32692, 32693,
+    32693, 32693, 32694, 32694, 32694, 32694, 32694, 32694, 32694, 32694, 32694, 32694, 32694, 32695, 32695, 32695,
+    32695, 32696, 32696, 32696, 32696, 32696, 32696, 32696, 32696, 32696, 32696, 32697, 32697, 32697, 32698, 32698,
+    32699, 32699, 32699, 32699, 32699, 32699, 32699, 32699, 32700, 32700, 32701, 32701, 32704, 32705, 32706, 32706,
+    32706, 32706, 32706, 32706, 32706, 32706, 32706, 32706, 32706, 32706, 32706, 32706, 32706, 32707, 32707, 32707,
+    32707, 32707, 32708, 32708, 32708, 32708, 32708, 32708, 32708, 32708, 32708, 32708, 32708, 32708, 32709, 32709,
+    32709, 32709, 32709, 32709, 32709, 32709, 32710, 32710, 32710, 32710, 32710, 32710, 32710, 32710, 32711, 32712,
+    32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712,
+    32712, 32712, 32712, 32712, 32712, 32712, 32712, 32712, 32713, 32713, 32713, 32714, 32714, 32714, 32715, 32715,
+    32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716, 32716,
+    32716, 32716, 32716, 32716, 32718, 32718, 32718, 32718, 32718, 32718, 32719, 32719, 32719, 32719, 32719, 32720,
+    32720, 32720, 32720, 32720, 32720, 32720, 32720, 32720, 32720, 32720, 32721, 32721, 32721, 32722, 32723, 32723,
+    32723, 32723, 32723, 32724, 32724, 32724, 32726, 32726, 32726, 32726, 32726, 32726, 32729, 32729, 32729, 32729,
+    32729, 32729, 32729, 32729, 32729, 32730, 32730, 32730, 32731, 32731, 32731, 32731, 32732, 32732, 32732, 32732,
+    32733, 32733, 32733, 32733, 32733, 32734, 32735, 32735, 32735, 32735, 32735, 32735, 32735, 32735, 32735, 32735,
+    32735, 32736, 32736, 32737, 32737, 32738, 32738, 32738, 32738, 32739, 32739, 32739, 32739, 32739, 32739, 32739,
+    32739, 32739, 32739, 32739, 32739, 32739, 32739, 32740, 32740, 32740, 32740, 32741, 32742, 32742, 32742, 32742,
+    32743, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32744, 32745, 32745,
+    32745, 32745, 32745, 32745, 32745, 32746, 32746, 32746, 32747, 32748, 32748, 32749, 32749, 32749, 32749, 32749,
+    32751, 32751, 32751, 32751, 32753, 32753, 32753, 32753, 32754, 32754, 32754, 32754, 32754, 32754, 32754, 32755,
+    32755, 32755, 32756, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757,
+    32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32757, 32758, 32758,
+    32758, 32758, 32758, 32758, 32758, 32758, 32758, 32758, 32758, 32758, 32758, 32758, 32758, 32759, 32761, 32761,
+    32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761, 32761,
+    32761, 32762, 32762, 32763, 32763, 32763, 32764, 32764, 32765, 32765, 32765, 32765, 32766, 32766, 32767, 32767,
+    32767, 32767, 32768, 32768, 32769, 32770, 32770, 32770, 32770, 32770, 32770, 32770, 32770, 32770, 32770, 32770,
+    32770, 32770, 32770, 32770, 32770, 32770, 32770, 32771, 32771, 32771, 32771, 32771, 32772, 32772, 32772, 32773,
+    32774, 32774, 32775, 32775, 32777, 32777, 32778, 32778, 32778, 32778, 32778, 32778, 32778, 32778, 32778, 32778,
+    32778, 32778, 32778, 32778, 32779, 32780, 32781, 32782, 32782, 32782, 32782, 32782, 32782, 32782, 32782, 32782,
+    32782, 32782, 32782, 32783, 32783, 32784, 32784, 32784, 32784, 32784, 32785, 32786, 32786, 32786, 32787, 32788,
+    32788, 32789, 32789, 32790, 32790, 32790, 32790, 32790, 32790, 32791, 32791, 32791, 32791, 32791, 32791, 32791,
+    32791, 32792, 32793, 32793, 32794, 32794, 32794, 32795, 32795, 32795, 32795, 32795, 32795, 32795, 32795, 32795,
+    32795, 32796, 32797, 32798, 32798, 32798, 32798, 32798, 32798, 32798, 32798, 32798, 32798, 32798, 32798, 32799,
+    32799, 32799, 32800, 32800, 32800, 32800, 32801, 32801, 32801, 32801, 32801, 32801, 32801, 32801, 32801, 32801,
+    32801, 32802, 32802, 32802, 32802, 32803, 32803, 32803, 32803, 32803, 32803, 32803, 32803, 32803, 32803, 32803,
+    32804, 32804, 32804, 32804, 32805, 32805, 32805, 32805, 32805, 32805, 32805, 32805, 32805, 32805, 32805, 32805,
+    32805, 32805, 32805, 32805, 32805, 32805, 32805, 32805, 32806, 32806, 32806, 32806, 32807, 32808, 32808, 32808,
+    32809, 32810, 32810, 32810, 32810, 32811, 32811, 32811, 32811, 32811, 32811, 32811, 32812, 32812, 32812, 32812,
+    32812, 32812, 32812, 32812, 32812, 32812, 32812, 32813, 32813, 32813, 32813, 32813, 32813, 32814, 32815, 32815,
+    32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32816, 32817,
+    32817, 32817, 32817, 32817, 32817, 32817, 32817, 32817, 32817, 32818, 32819, 32819, 32819, 32819, 32819, 32820,
+    32821, 32821, 32821, 32821, 32821, 32821, 32821, 32821, 32822, 32823, 32823, 32823, 32823, 32823, 32823, 32823,
+    32823, 32823, 32824, 32824, 32825, 32825, 32826, 32827, 32827, 32827, 32828, 32828, 32829, 32829, 32829, 32829,
+    32829, 32829, 32829, 32829, 32829, 32829, 32829, 32829, 32830, 32830, 32830, 32830, 32830, 32830, 32830, 32830,
+    32831, 32831, 32832, 32832, 32832, 32833, 32833, 32833, 32833, 32833, 32833, 32834, 32835, 32836, 32836, 32836,
+    32840, 32840, 32840, 32840, 32841, 32841, 32841, 32841, 32841, 32841, 32841, 32841, 32841, 32841, 32841, 32842,
+    32843, 32843, 32843, 32843, 32843, 32843, 32844, 32844, 32844, 32844, 32844, 32844, 32844, 32844, 32844, 32844,
+    32844, 32844, 32844, 32845, 32845, 32845, 32845, 32845, 32846, 32846, 32846, 32846, 32847, 32847, 32847, 32847,
+    32847, 32847, 32848, 32848, 32849, 32849, 32849, 32849, 32849, 32849, 32849, 32850, 32850, 32850, 32850, 32850,
+    32850, 32851, 32852, 32852, 32852, 32852, 32852, 32852, 32852, 32852, 32853, 32853, 32853, 32853, 32853, 32853,
+    32853, 32853, 32853, 32854, 32855, 32855, 32855, 32855, 32856, 32856, 32856, 32856, 32857, 32857, 32857, 32857,
+    32857, 32858, 32858, 32858, 32858, 32858, 32858, 32858, 32858, 32858, 32858, 32858, 32860, 32860, 32860, 32860,
+    32860, 32860, 32860, 32860, 32861, 32861, 32861, 32861, 32861, 32861, 32861, 32861, 32862, 32862, 32862, 32862,
+    32863, 32864, 32864, 32864, 32864, 32864, 32864, 32864, 32864, 32864, 32864, 32864, 32864, 32865, 32865, 32866,
+    32866, 32866, 32867, 32867, 32867, 32867, 32867, 32867, 32868, 32868, 32868, 32868, 32868, 32868, 32868, 32868,
+    32868, 32868, 32868, 32868, 32868, 32868, 32868, 32868, 32868, 32869, 32869, 32869, 32869, 32869, 32869, 32869,
+    32869, 32869, 32869, 32869, 32870, 32870, 32871, 32871, 32871, 32871, 32871, 32872, 32872, 32872, 32872, 32872,
+    32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872, 32872,
+    32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873, 32873,
+    32875, 32875, 32875, 32875, 32875, 32875, 32875, 32875, 32875, 32875, 32876, 32876, 32876, 32876, 32876, 32876,
+    32876, 32877, 32877, 32877, 32877, 32877, 32877, 32878, 32878, 32878, 32878, 32878, 32879, 32879, 32879, 32880,
+    32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880, 32880,
+    32880, 32880, 32880, 32880, 32880, 32881, 32881, 32881, 32881, 32881, 32881, 32882, 32882, 32882, 32882, 32882,
+    32882, 32882, 32883, 32883, 32883, 32883, 32883, 32884, 32885, 32885, 32885, 32885, 32886, 32886, 32887, 32887,
+    32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887, 32887,
+    32887, 32887, 32888, 32888, 32888, 32888, 32888, 32888, 32888, 32888, 32889, 32890, 32891, 32891, 32892, 32892,
+    32892, 32892, 32893, 32893, 32893, 32893, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895,
+    32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895, 32895,
+    32895, 32895, 32896, 32897, 32898, 32898, 32899, 32899, 32899, 32899, 32899, 32899, 32899, 32900, 32900, 32901,
+    32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901, 32901,
+    32901, 32901, 32902, 32902, 32902, 32903, 32903, 32903, 32907, 32907, 32908, 32909, 32910, 32911, 32911, 32912,
+    32912, 32912, 32912, 32913, 32914, 32914, 32914, 32914, 32914, 32914, 32914, 32914, 32914, 32914, 32914, 32914,
+    32914, 32914, 32914, 32914, 32914, 32914, 32914, 32915, 32915, 32916, 32916, 32916, 32916, 32916, 32916, 32916,
+    32916, 32916, 32916, 32916, 32916, 32916, 32916, 32916, 32916, 32917, 32917, 32917, 32917, 32918, 32918, 32919,
+    32919, 32919, 32919, 32919, 32920, 32920, 32920, 32920, 32920, 32920, 32920, 32920, 32920, 32920, 32922, 32922,
+    32922, 32922, 32922, 32922, 32922, 32922, 32922, 32922, 32922, 32922, 32925, 32925, 32925, 32925, 32925, 32925,
+    32925, 32925, 32925, 32925, 32925, 32925, 32925, 32925, 32925, 32925, 32925, 32926, 32926, 32926, 32926, 32927,
+    32927, 32927, 32927, 32927, 32927, 32927, 32928, 32928, 32929, 32929, 32930, 32931, 32931, 32931, 32932, 32932,
+    32932, 32933, 32933, 32933, 32933, 32933, 32933, 32933, 32933, 32933, 32933, 32933, 32933, 32934, 32934, 32934,
+    32934, 32934, 32934, 32934, 32934, 32934, 32934, 32934, 32934, 32935, 32935, 32936, 32936, 32937, 32937, 32938,
+    32938, 32938, 32938, 32938, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939,
+    32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32939, 32940, 32940, 32940, 32940, 32940, 32940, 32940,
+    32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940, 32940,
+    32941, 32941, 32941, 32941, 32941, 32941, 32941, 32941, 32941, 32942, 32942, 32942, 32942, 32943, 32943, 32945,
+    32945, 32945, 32945, 32946, 32946, 32946, 32946, 32946, 32947, 32948, 32948, 32948, 32948, 32948, 32948, 32948,
+    32948, 32948, 32948, 32948, 32948, 32951, 32951, 32951, 32951, 32951, 32951, 32951, 32951, 32951, 32951, 32951,
+    32951, 32951, 32951, 32951, 32951, 32951, 32951, 32951, 32953, 32953, 32953, 32953, 32953, 32953, 32953, 32953,
+    32953, 32953, 32953, 32953, 32953, 32953, 32953, 32953, 32953, 32954, 32954, 32954, 32955, 32955, 32956, 32956,
+    32956, 32956, 32956, 32956, 32956, 32956, 32956, 32957, 32957, 32957, 32957, 32957, 32957, 32957, 32957, 32957,
+    32957, 32957, 32957, 32957, 32957, 32957, 32958, 32958, 32958, 32958, 32959, 32959, 32959, 32960, 32960, 32960,
+    32960, 32960, 32960, 32960, 32960, 32960, 32961, 32961, 32961, 32962, 32962, 32962, 32962, 32962, 32962, 32963,
+    32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32963, 32964, 32964,
+    32964, 32964, 32964, 32964, 32964, 32964, 32964, 32964, 32965, 32965, 32965, 32965, 32965, 32966, 32966, 32966,
+    32966, 32967, 32968, 32969, 32969, 32970, 32970, 32970, 32971, 32971, 32971, 32973, 32973, 32974, 32975, 32975,
+    32975, 32975, 32975, 32975, 32975, 32976, 32976, 32977, 32977, 32978, 32978, 32979, 32980, 32981, 32983, 32984,
+    32984, 32984, 32984, 32984, 32984, 32985, 32986, 32986, 32987, 32989, 32989, 32989, 32989, 32989, 32990, 32990,
+    32990, 32990, 32990, 32991, 32992, 32992, 32992, 32992, 32992, 32993, 32993, 32993, 32994, 32995, 32995, 32995,
+    32995, 32995, 32995, 32995, 32995, 32995, 32995, 32996, 32997, 32997, 32997, 32997, 32997, 32997, 32997, 32997,
+    32998, 32998, 32998, 32998, 32998, 32998, 32998, 32998, 32998, 32998, 32998, 32999, 33001, 33001, 33003, 33003,
+    33003, 33005, 33005, 33005, 33005, 33005, 33005, 33005, 33005, 33006, 33006, 33006, 33006, 33006, 33006, 33007,
+    33007, 33008, 33008, 33008, 33008, 33008, 33008, 33008, 33008, 33008, 33008, 33008, 33008, 33009, 33010, 33010,
+    33010, 33010, 33010, 33010, 33011, 33011, 33011, 33011, 33011, 33011, 33013, 33013, 33013, 33014, 33014, 33014,
+    33015, 33015, 33015, 33015, 33015, 33015, 33015, 33015, 33016, 33016, 33016, 33016, 33016, 33016, 33016, 33016,
+    33017, 33018, 33019, 33019, 33019, 33020, 33020, 33021, 33021, 33022, 33023, 33023, 33023, 33023, 33024, 33024,
+    33026, 33026, 33026, 33026, 33026, 33027, 33027, 33028, 33029, 33029, 33029, 33029, 33029, 33029, 33029, 33030,
+    33031, 33032, 33033, 33034, 33034, 33035, 33037, 33038, 33038, 33040, 33040, 33041, 33042, 33042, 33043, 33043,
+    33043, 33044, 33044, 33045, 33045, 33046, 33046, 33046, 33046, 33047, 33047, 33047, 33047, 33047, 33047, 33048,
+    33048, 33048, 33048, 33048, 33048, 33048, 33048, 33048, 33048, 33048, 33048, 33048, 33049, 33049, 33049, 33049,
+    33049, 33049, 33049, 33049, 33049, 33049, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050,
+    33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33050, 33051, 33051, 33051,
+    33051, 33052, 33052, 33052, 33052, 33052, 33052, 33052, 33052, 33052, 33052, 33053, 33054, 33055, 33055, 33055,
+    33055, 33055, 33055, 33055, 33055, 33055, 33055, 33055, 33055, 33055, 33056, 33056, 33057, 33057, 33057, 33057,
+    33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057,
+    33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33057, 33058,
+    33059, 33059, 33059, 33059, 33059, 33059, 33059, 33059, 33059, 33059, 33060, 33060, 33060, 33060, 33060, 33060,
+    33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33060, 33061, 33061,
+    33061, 33061, 33061, 33061, 33061, 33062, 33062, 33062, 33062, 33062, 33062, 33062, 33062, 33062, 33062, 33063,
+    33063, 33063, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064, 33064,
+    33064, 33064, 33064, 33064, 33064, 33065, 33065, 33065, 33065, 33065, 33065, 33065, 33065, 33065, 33066, 33066,
+    33066, 33066, 33066, 33066, 33066, 33066, 33066, 33066, 33066, 33066, 33066, 33066, 33066, 33067, 33067, 33067,
+    33067, 33068, 33068, 33068, 33068, 33068, 33068, 33068, 33068, 33068, 33068, 33068, 33068, 33069, 33069, 33069,
+    33070, 33070, 33070, 33071, 33071, 33071, 33071, 33071, 33071, 33071, 33071, 33071, 33071, 33071, 33072, 33072,
+    33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072, 33072,
+    33073, 33073, 33073, 33074, 33074, 33074, 33075, 33075, 33075, 33075, 33075, 33075, 33075, 33075, 33076, 33076,
+    33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33076, 33077,
+    33077, 33077, 33077, 33077, 33077, 33077, 33077, 33077, 33077, 33077, 33077, 33077, 33078, 33078, 33078, 33078,
+    33078, 33078, 33078, 33078, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080,
+    33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33080, 33081, 33082, 33082, 33082, 33082,
+    33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082, 33082,
+    33082, 33083, 33083, 33084, 33084, 33084, 33085, 33085, 33085, 33085, 33085, 33085, 33085, 33085, 33085, 33085,
+    33085, 33085, 33085, 33085, 33085, 33086, 33086, 33087, 33088, 33088, 33088, 33088, 33088, 33088, 33089, 33089,
+    33089, 33089, 33089, 33089, 33089, 33090, 33091, 33092, 33092, 33092, 33092, 33092, 33092, 33092, 33092, 33092,
+    33092, 33092, 33092, 33092, 33092, 33092, 33093, 33094, 33094, 33095, 33096, 33096, 33096, 33096, 33096, 33097,
+    33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33097, 33098, 33098,
+    33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33098, 33099,
+    33099, 33099, 33099, 33099, 33100, 33100, 33100, 33100, 33100, 33100, 33101, 33101, 33102, 33102, 33102, 33102,
+    33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102,
+    33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33102, 33103, 33103, 33103, 33103,
+    33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103, 33103,
+    33103, 33104, 33104, 33104, 33104, 33104, 33105, 33105, 33105, 33105, 33105, 33105, 33105, 33105, 33106, 33107,
+    33107, 33107, 33108, 33108, 33108, 33108, 33108, 33108, 33108, 33108, 33108, 33108, 33109, 33109, 33109, 33109,
+    33110, 33110, 33110, 33110, 33110, 33111, 33111, 33111, 33111, 33112, 33113, 33113, 33113, 33113, 33113, 33113,
+    33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113, 33113,
+    33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114, 33114,
+    33115, 33115, 33115, 33115, 33115, 33115, 33115, 33115, 33115, 33115, 33115, 33116, 33117, 33117, 33118, 33118,
+    33119, 33119, 33119, 33119, 33119, 33119, 33120, 33121, 33122, 33123, 33124, 33125, 33125, 33125, 33126, 33126,
+    33127, 33128, 33128, 33129, 33129, 33129, 33130, 33130, 33130, 33130, 33130, 33130, 33130, 33130, 33131, 33131,
+    33131, 33131, 33131, 33131, 33131, 33131, 33131, 33131, 33131, 33131, 33132, 33132, 33132, 33132, 33132, 33133,
+    33133, 33133, 33134, 33134, 33135, 33135, 33135, 33135, 33135, 33136, 33137, 33137, 33137, 33137, 33137, 33138,
+    33138, 33138, 33138, 33139, 33139, 33139, 33140, 33140, 33140, 33140, 33140, 33140, 33141, 33141, 33141, 33141,
+    33141, 33141, 33141, 33141, 33141, 33142, 33142, 33142, 33143, 33143, 33143, 33143, 33143, 33143, 33145, 33145,
+    33146, 33146, 33146, 33147, 33147, 33147, 33147, 33147, 33148, 33148, 33150, 33150, 33151, 33151, 33151, 33152,
+    33152, 33152, 33152, 33152, 33153, 33153, 33153, 33153, 33153, 33154, 33154, 33154, 33154, 33154, 33155, 33155,
+    33156, 33157, 33158, 33158, 33158, 33158, 33158,
+};
+
+static const uint16_t hyph_deNodeLevels[33158] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 1, 4, 0, 1, 0, 0, 1, 0,
+    0, 0, 0, 9, 1, 0, 0, 12, 16, 1, 12, 1, 19, 12, 1, 1,
+    1, 22, 12, 0, 27, 12, 31, 0, 31, 36, 22, 41, 27, 31, 44, 12,
+    47, 0, 36, 12, 52, 12, 27, 0, 12, 56, 60, 36, 0, 0, 0, 65,
+    1, 9, 69, 0, 1, 1, 16, 0, 1, 16, 69, 69, 65, 9, 12, 73,
+    9, 27, 65, 1, 41, 1, 78, 41, 44, 0, 36, 9, 81, 41, 86, 22,
+    22, 41, 12, 36, 81, 91, 96, 0, 91, 12, 52, 12, 12, 41, 22, 27,
+    65, 96, 0, 1, 0, 12, 1, 0, 1, 9, 1, 1, 0, 0, 101, 1,
+    0, 1, 0, 105, 1, 108, 0, 0, 1, 0, 1, 1, 0, 112, 1, 12,
+    117, 1, 121, 125, 41, 81, 12, 128, 41, 27, 96, 96, 41, 12, 133, 69,
+    96, 91, 41, 138, 12, 69, 27, 27, 41, 12, 27, 0, 27, 41, 41, 41,
+    41, 0, 36, 12, 9, 0, 31, 27, 12, 0, 12, 143, 148, 22, 1, 0,
+    128, 12, 52, 151, 12, 0, 12, 12, 0, 91, 0, 0, 0, 0, 128, 12,
+    128, 0, 128, 128, 22, 0, 12, 36, 105, 12, 9, 0, 128, 1, 105, 105,
+    27, 0, 12, 156, 0, 12, 0, 41, 65, 16, 1, 12, 9, 1, 0, 9,
+    12, 12, 148, 1, 12, 0, 0, 0, 12, 0, 12, 0, 0, 0, 91, 12,
+    12, 12, 27, 1, 9, 1, 0, 161, 16, 0, 0, 0, 16, 12, 41, 138,
+    101, 128, 0, 138, 91, 36, 0, 101, 36, 44, 12, 69, 41, 22, 101, 69,
+    105, 27, 0, 101, 12, 91, 41, 41, 41, 0, 27, 12, 27, 41, 27, 12,
+    91, 41, 108, 12, 27, 12, 105, 41, 12, 12, 91, 27, 27, 0, 22, 108,
+    9, 41, 12, 41, 0, 41, 0, 41, 22, 9, 12, 41, 36, 22, 36, 41,
+    12, 133, 81, 12, 91, 41, 27, 12, 91, 27, 12, 41, 12, 22, 165, 22,
+    41, 41, 41, 41, 41, 138, 12, 27, 41, 12, 27, 96, 41, 12, 27, 91,
+    22, 27, 41, 138, 12, 168, 27, 27, 41, 22, 101, 0, 27, 41, 165, 0,
+    0, 91, 1, 9, 1, 22, 0, 12, 0, 9, 12, 12, 9, 9, 0, 0,
+    0, 12, 0, 0, 12, 0, 1, 12, 1, 0, 91, 9, 1, 1, 1, 22,
+    12, 0, 12, 101, 22, 0, 0, 91, 41, 0, 12, 22, 73, 91, 22, 65,
+    12, 69, 12, 12, 41, 12, 12, 173, 22, 41, 41, 0, 0, 44, 0, 27,
+    105, 27, 41, 27, 27, 161, 41, 12, 27, 12, 27, 105, 0, 81, 12, 12,
+    27, 27, 41, 12, 12, 27, 41, 12, 1, 0, 1, 41, 41, 0, 41, 41,
+    138, 41, 96, 41, 138, 138, 12, 41, 101, 22, 22, 91, 91, 41, 178, 12,
+    138, 183, 1, 41, 96, 12, 187, 22, 41, 41, 41, 41, 41, 41, 138, 27,
+    143, 41, 191, 81, 1, 41, 12, 138, 96, 138, 138, 41, 128, 12, 196, 9,
+    27, 41, 81, 108, 201, 12, 41, 41, 41, 9, 9, 12, 105, 12, 12, 0,
+    12, 1, 9, 1, 0, 1, 0, 19, 9, 0, 1, 0, 9, 12, 128, 36,
+    1, 12, 0, 12, 12, 0, 0, 121, 0, 12, 12, 22, 178, 36, 12, 12,
+    0, 12, 22, 12, 22, 41, 12, 148, 9, 12, 0, 12, 12, 12, 0, 12,
+    16, 22, 12, 12, 0, 12, 0, 16, 12, 12, 12, 9, 0, 12, 16, 27,
+    12, 0, 12, 12, 16, 0, 0, 1, 36, 9, 27, 41, 27, 12, 12, 0,
+    12, 22, 206, 12, 12, 0, 27, 1, 12, 96, 27, 41, 9, 12, 9, 12,
+    22, 0, 1, 1, 161, 1, 121, 1, 1, 211, 1, 121, 1, 0, 0, 0,
+    12, 1, 1, 0, 121, 0, 1, 1, 1, 121, 0, 0, 138, 101, 91, 0,
+    138, 128, 22, 0, 12, 133, 22, 22, 91, 0, 138, 12, 96, 133, 12, 19,
+    12, 148, 0, 27, 148, 0, 0, 128, 36, 12, 22, 41, 36, 91, 12, 41,
+    12, 128, 12, 12, 22, 91, 22, 1, 91, 128, 12, 0, 12, 12, 22, 12,
+    22, 36, 1, 1, 1, 1, 0, 1, 12, 0, 1, 0, 9, 1, 1, 0,
+    0, 0, 0, 0, 41, 0, 0, 0, 0, 1, 41, 1, 1, 41, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 121, 121, 1, 121, 1,
+    215, 41, 1, 19, 0, 1, 1, 1, 1, 41, 1, 0, 0, 0, 16, 1,
+    0, 19, 9, 0, 0, 1, 121, 1, 1, 1, 41, 9, 0, 148, 0, 1,
+    0, 121, 0, 0, 9, 0, 0, 0, 9, 1, 1, 12, 0, 0, 218, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0,
+    0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 227, 0, 0, 0, 227, 0, 0, 0, 0, 0, 224, 0, 0, 221, 0,
+    0, 0, 224, 0, 221, 0, 0, 224, 0, 227, 0, 0, 0, 0, 221, 0,
+    0, 0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 221, 0, 0,
+    221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0,
+    0, 0, 224, 224, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 224, 0, 0, 0, 224,
+    0, 221, 0, 0, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218,
+    0, 0, 0, 0, 0, 0, 218, 0, 0, 221, 0, 0, 1, 19, 0, 0,
+    0, 121, 1, 230, 41, 0, 101, 9, 0, 41, 0, 41, 41, 41, 9, 41,
+    19, 41, 9, 78, 0, 0, 9, 41, 9, 165, 19, 9, 9, 101, 19, 0,
+    0, 12, 0, 12, 0, 9, 9, 0, 19, 41, 0, 9, 105, 105, 165, 0,
+    0, 0, 9, 9, 0, 234, 240, 41, 65, 148, 16, 148, 148, 16, 0, 148,
+    246, 148, 0, 0, 16, 148, 9, 9, 0, 9, 250, 9, 0, 0, 0, 0,
+    9, 9, 9, 9, 227, 0, 0, 0, 255, 9, 148, 0, 9, 9, 9, 9,
+    1, 12, 121, 0, 0, 0, 0, 105, 0, 1, 19, 1, 1, 260, 9, 264,
+    9, 0, 268, 224, 264, 0, 0, 105, 0, 0, 224, 0, 0, 221, 9, 0,
+    9, 9, 9, 12, 27, 0, 250, 0, 9, 12, 9, 0, 1, 41, 105, 108,
+    1, 0, 0, 9, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    105, 0, 1, 272, 9, 148, 0, 9, 0, 9, 9, 0, 0, 0, 156, 0,
+    9, 9, 16, 0, 41, 0, 0, 9, 41, 0, 41, 91, 9, 0, 41, 0,
+    0, 0, 0, 41, 0, 0, 9, 41, 0, 0, 12, 1, 224, 78, 1, 1,
+    276, 0, 105, 9, 0, 16, 0, 9, 250, 148, 0, 0, 9, 0, 281, 101,
+    16, 9, 1, 41, 201, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 1,
+    9, 9, 0, 0, 9, 9, 0, 9, 0, 1, 272, 16, 9, 0, 108, 0,
+    0, 0, 0, 272, 0, 0, 9, 0, 0, 16, 16, 16, 105, 105, 148, 0,
+    0, 108, 0, 165, 0, 0, 0, 0, 0, 0, 0, 125, 9, 285, 9, 105,
+    0, 9, 0, 9, 78, 112, 9, 0, 0, 105, 105, 19, 234, 234, 0, 0,
+    9, 9, 9, 9, 9, 0, 148, 0, 9, 16, 0, 0, 148, 0, 12, 0,
+    0, 221, 78, 148, 211, 148, 246, 117, 0, 224, 165, 0, 0, 0, 12, 0,
+    0, 16, 0, 12, 0, 0, 165, 0, 0, 121, 0, 125, 0, 0, 148, 227,
+    0, 0, 41, 165, 165, 201, 0, 0, 224, 291, 0, 0, 165, 165, 41, 41,
+    19, 0, 0, 60, 165, 0, 165, 295, 91, 295, 0, 299, 218, 299, 302, 148,
+    0, 0, 165, 0, 0, 246, 0, 165, 0, 291, 0, 9, 0, 16, 0, 16,
+    0, 0, 165, 0, 221, 44, 121, 148, 291, 227, 12, 0, 0, 0, 0, 0,
+    1, 0, 0, 165, 295, 0, 9, 0, 0, 0, 0, 0, 165, 308, 165, 0,
+    125, 0, 0, 0, 215, 0, 0, 221, 148, 0, 0, 0, 16, 0, 299, 260,
+    125, 44, 221, 312, 0, 246, 148, 0, 0, 0, 0, 0, 291, 224, 299, 60,
+    295, 12, 16, 0, 16, 0, 246, 9, 12, 9, 19, 0, 224, 148, 246, 291,
+    19, 0, 165, 9, 0, 0, 0, 0, 317, 1, 321, 125, 9, 41, 0, 9,
+    19, 9, 0, 0, 221, 201, 0, 41, 19, 105, 0, 9, 9, 9, 0, 9,
+    9, 9, 0, 9, 9, 326, 332, 326, 215, 9, 337, 105, 9, 0, 9, 105,
+    41, 9, 41, 0, 41, 0, 105, 0, 19, 0, 0, 0, 341, 41, 105, 19,
+    9, 9, 9, 41, 9, 9, 9, 41, 9, 250, 9, 250, 345, 9, 250, 105,
+    9, 41, 9, 9, 41, 9, 19, 291, 9, 0, 0, 227, 41, 125, 125, 165,
+    148, 351, 0, 224, 0, 0, 165, 0, 0, 0, 0, 0, 302, 0, 221, 125,
+    148, 44, 16, 0, 357, 0, 9, 148, 246, 0, 221, 165, 19, 12, 1, 1,
+    1, 1, 0, 0, 0, 0, 165, 0, 12, 105, 0, 317, 0, 0, 165, 1,
+    0, 0, 125, 125, 125, 125, 299, 125, 0, 362, 19, 0, 367, 0, 221, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0, 0, 0,
+    105, 125, 148, 165, 0, 148, 165, 165, 0, 0, 0, 0, 0, 268, 0, 0,
+    0, 281, 291, 125, 125, 0, 78, 78, 299, 221, 373, 1, 1, 12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0, 101, 125, 0, 0,
+    0, 0, 0, 0, 105, 0, 0, 0, 0, 0, 105, 0, 0, 224, 221, 0,
+    0, 0, 16, 0, 0, 16, 376, 78, 221, 224, 0, 125, 125, 125, 0, 0,
+    0, 148, 12, 19, 0, 0, 0, 148, 0, 221, 0, 221, 0, 105, 165, 0,
+    165, 12, 12, 0, 0, 12, 9, 0, 22, 9, 148, 148, 381, 16, 295, 0,
+    9, 0, 125, 148, 0, 148, 0, 0, 218, 0, 0, 0, 0, 0, 16, 9,
+    0, 9, 9, 9, 9, 9, 240, 9, 0, 0, 0, 101, 101, 0, 1, 44,
+    12, 9, 125, 19, 9, 148, 0, 148, 148, 117, 0, 0, 0, 312, 148, 264,
+    0, 19, 16, 291, 0, 224, 1, 0, 0, 1, 78, 16, 0, 387, 0, 317,
+    16, 121, 0, 9, 0, 9, 9, 91, 9, 221, 0, 9, 9, 9, 0, 224,
+    125, 9, 9, 16, 0, 0, 0, 0, 0, 12, 1, 12, 0, 9, 9, 12,
+    0, 221, 234, 12, 19, 1, 1, 0, 1, 285, 0, 215, 16, 19, 0, 0,
+    105, 0, 16, 0, 0, 291, 19, 9, 0, 16, 221, 0, 117, 41, 148, 117,
+    44, 117, 101, 0, 9, 101, 117, 41, 9, 1, 9, 0, 0, 0, 0, 9,
+    0, 0, 9, 9, 264, 0, 0, 12, 9, 0, 12, 9, 1, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 264, 0, 9, 9, 16, 0, 0, 0, 78, 0,
+    9, 0, 0, 0, 0, 0, 272, 0, 392, 0, 272, 12, 1, 398, 19, 0,
+    1, 291, 1, 0, 221, 0, 19, 0, 1, 317, 0, 0, 156, 0, 403, 0,
+    0, 0, 0, 9, 0, 0, 125, 19, 0, 19, 0, 0, 0, 0, 215, 9,
+    0, 0, 221, 0, 0, 78, 0, 0, 0, 9, 0, 0, 1, 0, 0, 0,
+    9, 0, 0, 9, 9, 9, 0, 78, 9, 0, 0, 9, 0, 0, 0, 250,
+    125, 78, 117, 0, 9, 101, 9, 148, 0, 9, 9, 0, 0, 0, 9, 0,
+    9, 0, 125, 317, 264, 9, 9, 0, 105, 0, 78, 0, 187, 0, 12, 0,
+    317, 19, 0, 0, 0, 9, 0, 0, 156, 0, 0, 0, 0, 0, 9, 0,
+    9, 9, 0, 1, 78, 165, 9, 0, 9, 101, 148, 221, 117, 0, 125, 148,
+    148, 148, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 16, 0,
+    125, 0, 308, 0, 148, 0, 0, 125, 0, 165, 0, 148, 0, 0, 0, 0,
+    408, 0, 0, 0, 165, 0, 0, 0, 0, 165, 12, 165, 0, 0, 224, 0,
+    0, 0, 0, 0, 221, 0, 0, 165, 0, 221, 0, 0, 16, 0, 0, 148,
+    148, 0, 0, 0, 0, 295, 0, 9, 0, 44, 0, 0, 0, 0, 125, 215,
+    0, 0, 1, 22, 0, 0, 12, 0, 0, 148, 0, 0, 0, 0, 125, 0,
+    0, 125, 0, 125, 0, 0, 0, 387, 0, 264, 148, 0, 125, 0, 0, 0,
+    260, 125, 221, 0, 341, 0, 0, 291, 0, 125, 165, 165, 16, 0, 1, 0,
+    16, 0, 165, 0, 1, 148, 0, 0, 148, 148, 19, 0, 0, 9, 0, 0,
+    0, 0, 9, 0, 156, 12, 27, 0, 9, 0, 221, 148, 165, 0, 19, 0,
+    221, 0, 0, 19, 0, 0, 0, 0, 19, 0, 148, 0, 0, 0, 221, 0,
+    0, 1, 0, 1, 411, 291, 224, 415, 1, 291, 0, 19, 224, 317, 0, 0,
+    0, 0, 0, 0, 221, 0, 0, 420, 0, 317, 0, 0, 0, 81, 0, 0,
+    299, 148, 260, 44, 221, 105, 148, 148, 0, 19, 425, 221, 16, 19, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 78, 52, 0, 0,
+    9, 1, 9, 295, 0, 0, 165, 9, 69, 9, 9, 9, 148, 9, 9, 9,
+    0, 9, 9, 9, 16, 9, 9, 9, 9, 9, 9, 9, 16, 9, 295, 16,
+    44, 1, 22, 9, 392, 19, 0, 0, 221, 0, 0, 341, 0, 165, 19, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 117, 221, 0, 224, 0, 0, 215, 215,
+    221, 0, 0, 264, 0, 215, 125, 0, 125, 78, 117, 125, 44, 148, 125, 0,
+    19, 0, 148, 22, 12, 0, 0, 0, 0, 148, 148, 78, 0, 0, 12, 0,
+    44, 148, 1, 165, 9, 430, 218, 0, 0, 0, 9, 0, 0, 1, 16, 16,
+    0, 0, 0, 0, 12, 0, 16, 0, 0, 0, 121, 0, 0, 0, 105, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 332, 0, 0, 0, 0,
+    16, 78, 317, 0, 0, 0, 0, 0, 0, 0, 105, 105, 105, 9, 148, 0,
+    0, 0, 16, 148, 9, 246, 148, 0, 0, 0, 0, 0, 125, 0, 224, 264,
+    0, 224, 0, 291, 221, 16, 0, 291, 0, 221, 0, 148, 0, 0, 148, 0,
+    16, 291, 148, 16, 125, 117, 16, 264, 148, 264, 0, 0, 224, 0, 0, 0,
+    0, 291, 16, 0, 0, 0, 9, 156, 0, 9, 0, 0, 16, 0, 0, 0,
+    0, 0, 240, 121, 317, 105, 0, 0, 224, 19, 78, 0, 221, 16, 224, 78,
+    221, 0, 224, 0, 0, 0, 215, 221, 0, 0, 125, 0, 0, 0, 0, 0,
+    0, 0, 0, 224, 0, 272, 0, 19, 0, 436, 0, 0, 221, 0, 215, 224,
+    0, 291, 19, 125, 0, 19, 0, 0, 0, 0, 0, 148, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 165, 1, 165, 156, 148, 117, 0, 117, 0, 0, 0,
+    0, 0, 0, 9, 148, 215, 341, 0, 221, 0, 218, 16, 16, 0, 0, 16,
+    16, 387, 16, 0, 0, 16, 0, 19, 16, 272, 0, 0, 0, 125, 16, 0,
+    0, 0, 0, 0, 148, 0, 0, 0, 16, 125, 19, 0, 0, 1, 0, 1,
+    299, 0, 0, 0, 0, 148, 441, 0, 224, 9, 65, 227, 16, 291, 0, 19,
+    0, 317, 0, 0, 0, 1, 0, 0, 12, 268, 0, 0, 0, 0, 0, 121,
+    0, 0, 0, 78, 78, 148, 0, 1, 0, 0, 224, 0, 0, 16, 0, 117,
+    0, 0, 0, 0, 0, 78, 78, 78, 221, 0, 19, 264, 1, 125, 78, 1,
+    125, 161, 78, 65, 0, 105, 0, 260, 0, 0, 0, 221, 0, 0, 0, 0,
+    16, 1, 9, 148, 0, 9, 221, 0, 9, 9, 0, 0, 9, 0, 221, 1,
+    326, 0, 415, 224, 0, 0, 0, 0, 0, 9, 41, 0, 9, 9, 16, 9,
+    0, 0, 9, 264, 9, 0, 0, 0, 0, 0, 9, 0, 0, 0, 272, 0,
+    321, 0, 9, 1, 19, 148, 264, 16, 16, 0, 0, 0, 221, 16, 272, 16,
+    0, 78, 16, 16, 117, 0, 9, 1, 1, 234, 221, 12, 0, 1, 9, 0,
+    9, 161, 0, 19, 44, 0, 0, 148, 9, 0, 0, 9, 125, 0, 0, 0,
+    0, 9, 1, 125, 1, 117, 0, 9, 0, 9, 9, 105, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 105, 9, 0, 9,
+    0, 0, 105, 125, 446, 221, 0, 0, 0, 0, 0, 16, 0, 272, 16, 0,
+    125, 221, 0, 0, 0, 0, 0, 272, 0, 0, 16, 0, 121, 1, 221, 1,
+    121, 1, 0, 224, 19, 0, 0, 0, 0, 0, 221, 148, 148, 0, 148, 0,
+    0, 78, 78, 148, 218, 148, 218, 341, 0, 148, 0, 0, 0, 165, 0, 0,
+    19, 148, 291, 0, 0, 0, 0, 0, 0, 19, 0, 0, 221, 165, 0, 0,
+    0, 0, 0, 341, 0, 0, 0, 0, 9, 0, 0, 224, 0, 4, 0, 1,
+    0, 0, 0, 0, 0, 0, 345, 9, 0, 0, 0, 0, 0, 22, 218, 0,
+    0, 0, 125, 78, 19, 0, 0, 0, 264, 0, 0, 0, 165, 0, 221, 9,
+    0, 105, 0, 16, 0, 0, 1, 9, 0, 0, 0, 105, 0, 125, 0, 0,
+    125, 0, 0, 0, 0, 0, 0, 0, 165, 16, 0, 0, 16, 0, 1, 165,
+    22, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215,
+    19, 0, 264, 321, 272, 0, 0, 16, 0, 0, 260, 0, 0, 0, 78, 221,
+    0, 78, 0, 125, 0, 19, 0, 165, 148, 0, 0, 0, 0, 0, 0, 0,
+    125, 0, 0, 0, 221, 0, 16, 1, 19, 0, 165, 165, 0, 1, 0, 41,
+    9, 0, 0, 165, 0, 12, 0, 0, 165, 0, 0, 0, 0, 0, 0, 41,
+    16, 0, 224, 0, 0, 0, 0, 0, 148, 0, 0, 0, 125, 0, 16, 125,
+    125, 0, 0, 0, 0, 78, 0, 224, 0, 0, 0, 450, 0, 0, 9, 0,
+    0, 0, 165, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 148, 0, 9,
+    0, 0, 125, 0, 0, 0, 0, 0, 224, 0, 117, 0, 125, 44, 0, 0,
+    105, 0, 0, 454, 19, 0, 0, 165, 0, 78, 0, 0, 148, 0, 0, 0,
+    165, 0, 0, 0, 0, 0, 148, 0, 0, 0, 0, 341, 221, 148, 0, 224,
+    0, 224, 0, 224, 221, 0, 264, 291, 281, 291, 0, 0, 78, 0, 125, 291,
+    0, 0, 0, 19, 221, 0, 0, 0, 291, 0, 264, 0, 0, 0, 221, 117,
+    0, 0, 1, 1, 0, 0, 0, 9, 1, 0, 0, 0, 165, 0, 0, 0,
+    148, 0, 0, 0, 0, 12, 9, 105, 0, 148, 224, 224, 125, 0, 0, 0,
+    0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0,
+    0, 0, 260, 0, 0, 0, 215, 78, 0, 0, 0, 125, 0, 460, 0, 0,
+    466, 0, 12, 0, 0, 0, 178, 105, 9, 0, 0, 165, 218, 125, 78, 19,
+    78, 0, 165, 19, 165, 78, 0, 0, 0, 78, 0, 291, 0, 0, 19, 0,
+    16, 19, 165, 0, 0, 0, 0, 9, 0, 0, 9, 0, 9, 246, 0, 9,
+    148, 0, 9, 472, 9, 0, 105, 105, 9, 0, 408, 9, 165, 221, 1, 0,
+    0, 224, 268, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 165, 0, 0,
+    215, 165, 0, 44, 211, 0, 0, 125, 0, 0, 0, 0, 224, 0, 0, 78,
+    224, 19, 0, 0, 0, 224, 165, 0, 0, 0, 0, 19, 0, 0, 165, 0,
+    227, 12, 9, 0, 0, 0, 0, 0, 0, 268, 0, 78, 0, 0, 0, 0,
+    0, 19, 0, 0, 165, 291, 19, 125, 78, 125, 78, 78, 125, 78, 78, 0,
+    0, 0, 0, 291, 148, 221, 0, 0, 0, 0, 0, 295, 1, 165, 295, 0,
+    0, 0, 165, 295, 478, 0, 0, 165, 0, 0, 22, 19, 0, 0, 16, 0,
+    0, 0, 0, 125, 0, 125, 125, 0, 0, 264, 0, 0, 125, 125, 16, 0,
+    0, 260, 0, 0, 0, 0, 215, 0, 78, 0, 125, 19, 0, 12, 0, 0,
+    165, 0, 308, 0, 0, 221, 0, 227, 0, 291, 246, 0, 0, 9, 12, 9,
+    227, 0, 0, 165, 0, 148, 156, 105, 12, 0, 9, 165, 0, 165, 165, 165,
+    12, 165, 0, 165, 12, 0, 295, 165, 12, 0, 0, 1, 0, 0, 1, 1,
+    165, 165, 1, 165, 0, 224, 0, 0, 0, 16, 0, 299, 0, 19, 0, 0,
+    0, 0, 0, 0, 0, 0, 218, 16, 165, 0, 0, 9, 0, 9, 1, 0,
+    0, 12, 0, 148, 0, 165, 0, 0, 0, 165, 0, 148, 0, 16, 12, 408,
+    165, 165, 0, 0, 224, 125, 0, 148, 44, 291, 0, 272, 117, 0, 264, 0,
+    0, 0, 0, 0, 16, 0, 0, 0, 215, 0, 0, 0, 16, 0, 299, 295,
+    0, 0, 1, 16, 0, 0, 0, 0, 295, 0, 415, 0, 16, 0, 295, 9,
+    291, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 125, 0, 299, 125, 0, 0, 78, 224, 117, 0, 0, 0, 0, 0, 165,
+    0, 0, 19, 156, 0, 1, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    165, 22, 165, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 264, 0, 0, 125, 0, 0, 0, 0, 0, 0,
+    117, 0, 0, 0, 0, 0, 215, 221, 0, 78, 0, 125, 173, 0, 112, 165,
+    165, 221, 165, 12, 165, 224, 0, 0, 44, 165, 9, 9, 425, 165, 165, 165,
+    165, 0, 125, 0, 41, 41, 1, 41, 41, 41, 0, 0, 0, 0, 0, 78,
+    0, 0, 0, 105, 308, 165, 1, 165, 0, 165, 22, 27, 0, 9, 0, 165,
+    9, 9, 332, 27, 27, 16, 65, 165, 483, 0, 165, 41, 0, 215, 215, 0,
+    0, 0, 0, 44, 52, 16, 215, 299, 9, 0, 9, 148, 91, 165, 0, 9,
+    0, 0, 101, 9, 91, 9, 101, 125, 19, 1, 0, 1, 1, 1, 125, 91,
+    0, 0, 0, 9, 0, 9, 224, 101, 125, 0, 44, 0, 125, 488, 260, 9,
+    0, 0, 9, 12, 9, 12, 341, 9, 9, 9, 9, 0, 0, 0, 125, 0,
+    19, 211, 0, 0, 12, 1, 12, 9, 221, 0, 12, 0, 19, 1, 19, 12,
+    1, 9, 121, 125, 1, 1, 148, 0, 0, 0, 148, 148, 0, 0, 148, 0,
+    281, 165, 1, 105, 0, 0, 0, 0, 148, 0, 0, 105, 0, 0, 1, 148,
+    0, 27, 1, 0, 0, 0, 0, 215, 105, 0, 221, 264, 0, 9, 9, 0,
+    9, 291, 9, 101, 291, 0, 9, 227, 0, 0, 0, 78, 41, 291, 9, 41,
+    0, 0, 1, 1, 0, 0, 9, 1, 41, 0, 492, 121, 9, 117, 101, 0,
+    12, 0, 498, 0, 9, 9, 19, 0, 19, 0, 9, 9, 0, 9, 0, 9,
+    9, 0, 12, 9, 9, 9, 234, 0, 101, 0, 0, 125, 12, 16, 91, 9,
+    9, 9, 9, 125, 0, 41, 9, 112, 9, 0, 326, 101, 0, 16, 0, 0,
+    0, 105, 0, 148, 0, 0, 0, 0, 19, 272, 125, 0, 0, 1, 0, 0,
+    12, 504, 509, 0, 0, 148, 0, 9, 9, 0, 16, 125, 16, 9, 148, 9,
+    78, 16, 41, 1, 317, 0, 105, 0, 78, 0, 0, 41, 41, 41, 16, 0,
+    513, 0, 41, 0, 0, 0, 41, 19, 0, 0, 0, 41, 41, 221, 9, 224,
+    41, 450, 121, 0, 0, 0, 9, 41, 227, 0, 187, 41, 0, 41, 0, 0,
+    165, 9, 9, 0, 0, 264, 0, 0, 0, 78, 234, 367, 0, 41, 0, 9,
+    148, 9, 9, 0, 9, 9, 0, 9, 148, 9, 9, 0, 44, 9, 264, 0,
+    165, 9, 227, 9, 12, 341, 0, 221, 0, 0, 41, 16, 0, 148, 165, 0,
+    41, 0, 0, 221, 9, 165, 0, 0, 101, 165, 221, 19, 165, 165, 9, 148,
+    165, 0, 0, 0, 0, 0, 0, 0, 0, 337, 78, 0, 0, 362, 272, 0,
+    78, 0, 264, 0, 215, 224, 0, 387, 0, 0, 0, 41, 215, 9, 0, 105,
+    0, 0, 0, 0, 224, 16, 295, 0, 16, 19, 125, 260, 125, 0, 78, 291,
+    0, 295, 291, 224, 19, 224, 9, 0, 12, 9, 0, 0, 165, 9, 0, 165,
+    0, 0, 78, 425, 165, 165, 165, 0, 0, 148, 41, 9, 0, 41, 1, 1,
+    0, 65, 0, 16, 0, 0, 16, 0, 16, 0, 0, 16, 12, 1, 16, 41,
+    0, 16, 9, 41, 0, 221, 0, 0, 0, 0, 0, 0, 148, 0, 0, 1,
+    0, 1, 16, 1, 0, 0, 0, 0, 0, 0, 224, 0, 0, 16, 165, 0,
+    0, 0, 0, 19, 0, 165, 9, 0, 165, 0, 0, 0, 0, 0, 0, 0,
+    0, 148, 0, 0, 519, 0, 9, 9, 0, 0, 221, 0, 0, 0, 0, 0,
+    0, 148, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 221, 9, 9, 0,
+    9, 0, 9, 0, 9, 0, 9, 0, 0, 0, 0, 16, 0, 165, 105, 0,
+    0, 0, 0, 27, 16, 16, 227, 0, 0, 0, 0, 44, 0, 0, 0, 0,
+    0, 0, 148, 0, 0, 0, 224, 117, 117, 0, 78, 117, 125, 221, 148, 0,
+    291, 0, 0, 0, 291, 0, 291, 0, 0, 0, 224, 0, 78, 291, 0, 221,
+    221, 0, 0, 0, 0, 1, 221, 19, 1, 0, 19, 0, 264, 0, 0, 0,
+    165, 0, 0, 0, 16, 0, 0, 1, 0, 0, 0, 105, 105, 125, 125, 224,
+    0, 0, 0, 0, 215, 125, 0, 221, 19, 0, 0, 148, 221, 0, 148, 221,
+    0, 0, 117, 221, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 125, 148,
+    221, 0, 0, 125, 0, 0, 0, 0, 0, 0, 215, 264, 0, 291, 0, 125,
+    19, 0, 0, 0, 165, 0, 0, 0, 9, 0, 0, 96, 0, 0, 105, 0,
+    117, 0, 0, 0, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 295,
+    105, 105, 9, 105, 0, 9, 9, 12, 0, 0, 148, 9, 0, 0, 156, 165,
+    12, 41, 0, 1, 0, 0, 105, 9, 0, 0, 0, 0, 165, 295, 12, 0,
+    0, 0, 0, 0, 295, 12, 0, 165, 1, 12, 12, 12, 0, 0, 1, 1,
+    0, 148, 0, 0, 9, 0, 12, 44, 9, 108, 9, 16, 9, 9, 0, 0,
+    0, 44, 0, 221, 0, 0, 165, 0, 295, 165, 0, 165, 0, 0, 0, 0,
+    0, 165, 0, 0, 0, 0, 1, 0, 0, 0, 105, 148, 148, 0, 78, 0,
+    525, 105, 125, 125, 108, 0, 529, 221, 308, 268, 308, 0, 0, 0, 0, 165,
+    0, 0, 295, 0, 221, 105, 44, 105, 0, 125, 0, 44, 534, 0, 0, 539,
+    544, 0, 105, 105, 105, 105, 44, 78, 108, 125, 0, 125, 125, 0, 0, 0,
+    0, 0, 0, 165, 0, 22, 19, 0, 0, 165, 0, 165, 101, 0, 0, 165,
+    78, 0, 0, 165, 0, 0, 165, 165, 12, 165, 550, 9, 0, 0, 555, 0,
+    0, 483, 101, 0, 0, 108, 561, 0, 105, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 78, 0, 0, 0, 264, 0, 0, 125, 117, 105, 16, 9, 250,
+    9, 0, 9, 9, 9, 0, 9, 9, 105, 9, 9, 16, 9, 9, 16, 565,
+    367, 148, 9, 9, 9, 285, 65, 65, 0, 0, 571, 173, 165, 0, 22, 12,
+    165, 148, 0, 0, 148, 295, 0, 341, 117, 165, 0, 108, 0, 240, 218, 246,
+    577, 108, 0, 0, 108, 108, 108, 105, 108, 295, 295, 295, 1, 165, 12, 0,
+    108, 9, 12, 295, 0, 148, 121, 156, 12, 12, 12, 483, 165, 341, 165, 295,
+    165, 165, 105, 0, 12, 0, 0, 0, 165, 221, 0, 0, 0, 9, 0, 221,
+    0, 0, 0, 0, 0, 165, 165, 165, 0, 0, 0, 0, 0, 215, 125, 0,
+    125, 0, 0, 165, 450, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    165, 0, 0, 0, 165, 221, 0, 0, 0, 0, 0, 125, 44, 105, 156, 9,
+    69, 9, 65, 9, 250, 544, 250, 65, 9, 466, 9, 234, 0, 9, 16, 9,
+    108, 9, 0, 165, 9, 1, 0, 0, 165, 221, 0, 0, 0, 0, 165, 165,
+    0, 0, 165, 0, 0, 165, 0, 583, 44, 583, 0, 299, 0, 0, 0, 299,
+    0, 165, 0, 0, 19, 308, 0, 165, 0, 165, 165, 454, 165, 0, 165, 165,
+    0, 165, 0, 0, 586, 165, 165, 105, 224, 0, 9, 0, 0, 101, 165, 0,
+    0, 227, 0, 590, 0, 0, 105, 0, 0, 0, 0, 105, 0, 0, 594, 598,
+    272, 215, 125, 0, 16, 0, 0, 0, 125, 0, 0, 0, 0, 0, 291, 0,
+    125, 165, 234, 165, 9, 165, 9, 0, 105, 0, 0, 0, 0, 0, 0, 0,
+    165, 0, 125, 603, 0, 22, 165, 221, 608, 0, 0, 0, 0, 0, 0, 272,
+    105, 19, 105, 16, 165, 9, 0, 332, 0, 27, 9, 0, 148, 16, 0, 9,
+    9, 0, 22, 156, 27, 0, 165, 0, 165, 105, 0, 165, 105, 165, 0, 0,
+    117, 121, 0, 148, 0, 1, 0, 0, 0, 0, 125, 1, 0, 0, 0, 148,
+    0, 0, 0, 0, 19, 0, 1, 0, 1, 117, 148, 0, 0, 0, 0, 16,
+    0, 16, 16, 148, 0, 0, 227, 16, 0, 0, 16, 341, 0, 0, 9, 0,
+    78, 0, 78, 0, 9, 0, 0, 0, 264, 0, 221, 0, 0, 16, 488, 218,
+    0, 0, 0, 16, 16, 148, 613, 9, 9, 9, 0, 224, 16, 19, 9, 0,
+    1, 125, 0, 1, 0, 0, 0, 148, 121, 1, 22, 44, 0, 1, 0, 1,
+    221, 148, 148, 0, 0, 0, 9, 367, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 16, 0, 617, 0, 41, 41, 0, 41, 41, 9, 0, 0,
+    41, 0, 264, 0, 41, 0, 105, 0, 0, 125, 221, 0, 0, 9, 0, 0,
+    0, 41, 221, 41, 230, 0, 41, 16, 9, 0, 121, 125, 0, 221, 0, 121,
+    1, 165, 321, 0, 165, 211, 0, 0, 1, 0, 105, 1, 0, 9, 221, 0,
+    9, 0, 0, 0, 78, 0, 0, 27, 264, 9, 0, 221, 125, 0, 12, 12,
+    221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 78,
+    0, 0, 0, 0, 0, 218, 105, 105, 0, 0, 215, 0, 0, 125, 0, 227,
+    0, 148, 148, 291, 1, 0, 0, 0, 291, 272, 1, 148, 1, 148, 1, 165,
+    12, 19, 268, 0, 0, 0, 0, 317, 215, 12, 0, 264, 78, 0, 78, 291,
+    0, 0, 0, 0, 0, 227, 227, 78, 78, 78, 78, 9, 0, 148, 0, 0,
+    221, 9, 16, 22, 0, 0, 221, 78, 148, 623, 0, 148, 12, 0, 0, 12,
+    341, 0, 227, 1, 0, 295, 1, 148, 148, 148, 0, 117, 218, 0, 148, 41,
+    0, 0, 0, 41, 41, 41, 0, 148, 0, 41, 221, 148, 0, 0, 450, 0,
+    41, 41, 0, 0, 0, 0, 0, 41, 101, 224, 125, 0, 41, 148, 0, 0,
+    0, 628, 0, 0, 221, 0, 201, 41, 0, 0, 221, 125, 148, 117, 117, 148,
+    221, 41, 121, 221, 0, 0, 221, 633, 41, 41, 0, 41, 101, 41, 0, 0,
+    41, 221, 218, 0, 41, 156, 65, 41, 0, 639, 9, 148, 0, 65, 1, 1,
+    1, 224, 36, 9, 148, 1, 16, 0, 12, 12, 19, 9, 295, 78, 0, 221,
+    0, 645, 0, 0, 0, 125, 125, 9, 650, 1, 0, 19, 0, 0, 0, 260,
+    0, 317, 0, 291, 0, 272, 19, 22, 246, 165, 165, 9, 178, 16, 19, 0,
+    121, 0, 0, 246, 221, 78, 0, 125, 16, 148, 16, 16, 0, 0, 16, 0,
+    221, 148, 221, 0, 44, 291, 0, 78, 221, 0, 0, 291, 44, 44, 224, 0,
+    291, 272, 221, 0, 224, 0, 656, 1, 221, 450, 16, 0, 260, 218, 488, 78,
+    221, 0, 117, 125, 125, 221, 0, 148, 341, 117, 488, 0, 0, 0, 221, 117,
+    0, 44, 312, 488, 78, 121, 0, 1, 22, 19, 22, 12, 0, 295, 101, 12,
+    22, 121, 0, 1, 1, 12, 125, 0, 0, 0, 0, 0, 227, 165, 0, 19,
+    317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 519, 0, 0,
+    0, 0, 0, 0, 0, 0, 16, 0, 0, 246, 0, 0, 0, 221, 0, 125,
+    0, 0, 12, 1, 0, 12, 0, 0, 148, 0, 22, 0, 12, 125, 125, 125,
+    0, 125, 0, 0, 0, 0, 0, 291, 125, 78, 224, 165, 224, 0, 264, 0,
+    0, 221, 78, 221, 0, 0, 221, 0, 0, 264, 291, 221, 0, 0, 0, 12,
+    0, 0, 0, 12, 0, 0, 117, 0, 0, 148, 12, 16, 12, 1, 1, 1,
+    0, 156, 12, 1, 9, 483, 165, 0, 22, 12, 12, 22, 12, 0, 0, 0,
+    22, 0, 0, 12, 0, 0, 91, 12, 12, 12, 0, 221, 221, 0, 0, 0,
+    125, 12, 0, 260, 148, 1, 0, 1, 16, 0, 0, 16, 148, 148, 0, 0,
+    0, 78, 78, 148, 0, 272, 221, 0, 260, 148, 260, 0, 65, 65, 19, 101,
+    1, 0, 9, 0, 9, 9, 9, 1, 19, 1, 0, 0, 78, 260, 1, 0,
+    218, 0, 246, 0, 0, 1, 9, 125, 0, 9, 0, 9, 148, 0, 9, 0,
+    156, 661, 0, 91, 0, 0, 9, 0, 9, 1, 291, 1, 0, 0, 0, 420,
+    0, 19, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 9, 41, 19, 1,
+    16, 91, 0, 272, 0, 488, 125, 436, 101, 0, 260, 0, 0, 0, 9, 19,
+    78, 0, 230, 41, 9, 9, 230, 285, 0, 0, 41, 0, 221, 221, 221, 0,
+    148, 260, 246, 0, 0, 0, 218, 0, 41, 0, 78, 0, 260, 260, 1, 0,
+    0, 1, 0, 0, 1, 667, 78, 148, 165, 317, 0, 0, 0, 0, 0, 165,
+    0, 221, 221, 0, 41, 0, 148, 148, 125, 0, 148, 0, 1, 0, 0, 291,
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 317, 0, 0, 0, 224, 16, 9,
+    0, 9, 16, 0, 16, 125, 488, 0, 260, 221, 0, 218, 0, 0, 9, 9,
+    525, 78, 78, 0, 19, 0, 0, 673, 0, 264, 78, 291, 264, 221, 218, 1,
+    272, 0, 0, 260, 78, 16, 0, 0, 272, 148, 260, 16, 291, 291, 1, 268,
+    0, 0, 0, 317, 0, 19, 291, 1, 19, 19, 148, 117, 0, 1, 16, 16,
+    0, 0, 272, 678, 0, 0, 227, 0, 148, 0, 1, 0, 1, 0, 19, 0,
+    0, 0, 0, 683, 221, 148, 0, 0, 148, 0, 148, 0, 0, 0, 0, 260,
+    260, 341, 0, 0, 227, 0, 218, 688, 691, 218, 0, 688, 224, 224, 221, 221,
+    0, 221, 218, 0, 0, 0, 0, 0, 0, 691, 0, 688, 0, 695, 0, 691,
+    691, 0, 688, 0, 0, 0, 0, 0, 688, 0, 0, 699, 688, 224, 224, 218,
+    688, 702, 706, 688, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 224, 0,
+    0, 0, 710, 713, 0, 0, 227, 0, 0, 0, 717, 0, 227, 0, 218, 0,
+    0, 0, 0, 706, 0, 0, 221, 221, 691, 0, 218, 0, 0, 0, 688, 0,
+    221, 0, 0, 221, 0, 691, 0, 0, 688, 721, 0, 0, 227, 710, 227, 688,
+    0, 0, 218, 0, 221, 695, 695, 218, 710, 0, 0, 0, 0, 221, 0, 0,
+    0, 0, 724, 224, 0, 710, 0, 0, 0, 0, 218, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 224, 0, 0, 0, 221, 728, 710, 0, 688, 0, 0,
+    699, 0, 721, 221, 218, 221, 721, 0, 721, 0, 221, 0, 0, 224, 0, 218,
+    0, 0, 0, 688, 0, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0,
+    0, 0, 218, 0, 0, 0, 0, 0, 0, 0, 221, 710, 0, 0, 724, 0,
+    0, 218, 0, 0, 221, 0, 224, 0, 0, 710, 0, 218, 227, 688, 221, 0,
+    221, 0, 688, 218, 0, 710, 710, 0, 221, 0, 0, 0, 699, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 0, 221, 0, 0, 0,
+    0, 0, 0, 221, 227, 0, 0, 0, 0, 0, 710, 0, 0, 0, 0, 0,
+    713, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221,
+    221, 0, 0, 218, 0, 0, 221, 221, 0, 221, 0, 0, 221, 0, 221, 0,
+    0, 721, 721, 0, 688, 706, 688, 688, 688, 691, 218, 688, 218, 0, 218, 0,
+    227, 227, 0, 0, 691, 221, 218, 0, 0, 224, 0, 221, 0, 0, 0, 0,
+    0, 224, 688, 0, 224, 0, 0, 0, 221, 0, 0, 0, 0, 688, 0, 221,
+    221, 218, 710, 148, 121, 148, 1, 0, 16, 246, 218, 218, 0, 710, 691, 695,
+    695, 688, 148, 732, 702, 0, 148, 0, 19, 0, 0, 108, 108, 227, 0, 332,
+    0, 9, 105, 156, 9, 165, 105, 0, 19, 0, 173, 65, 0, 78, 9, 9,
+    65, 65, 295, 148, 295, 105, 16, 9, 215, 9, 736, 741, 688, 78, 0, 165,
+    16, 19, 224, 148, 148, 1, 1, 16, 227, 9, 1, 9, 12, 218, 747, 218,
+    1, 747, 0, 215, 1, 9, 381, 16, 218, 218, 105, 0, 0, 0, 0, 0,
+    9, 105, 16, 16, 148, 0, 272, 165, 753, 9, 272, 9, 0, 125, 125, 0,
+    9, 105, 0, 381, 0, 0, 9, 165, 105, 148, 65, 0, 0, 78, 78, 760,
+    218, 148, 125, 16, 16, 16, 125, 125, 765, 221, 148, 772, 19, 387, 125, 272,
+    272, 0, 775, 224, 246, 221, 0, 0, 221, 1, 260, 0, 227, 9, 78, 9,
+    78, 78, 44, 291, 291, 148, 148, 224, 341, 0, 341, 218, 0, 0, 148, 260,
+    272, 721, 317, 317, 19, 272, 0, 148, 148, 148, 105, 227, 0, 148, 0, 9,
+    165, 272, 16, 0, 78, 215, 0, 0, 44, 215, 0, 260, 260, 44, 0, 0,
+    0, 0, 148, 0, 148, 44, 0, 0, 227, 227, 721, 779, 0, 717, 0, 341,
+    148, 0, 78, 732, 0, 0, 148, 65, 19, 227, 291, 78, 0, 148, 0, 784,
+    788, 1, 148, 221, 792, 19, 125, 78, 0, 695, 0, 218, 148, 221, 1, 594,
+    218, 165, 148, 0, 291, 125, 125, 125, 16, 0, 125, 797, 804, 9, 101, 9,
+    44, 41, 16, 272, 0, 16, 16, 0, 227, 41, 44, 1, 105, 44, 78, 0,
+    9, 0, 0, 9, 246, 0, 9, 148, 9, 16, 9, 221, 165, 9, 0, 19,
+    0, 9, 0, 19, 0, 0, 0, 221, 0, 19, 0, 0, 341, 0, 0, 218,
+    0, 0, 0, 148, 688, 148, 108, 0, 19, 19, 488, 272, 272, 0, 699, 221,
+    0, 105, 272, 0, 224, 9, 165, 0, 41, 0, 0, 0, 0, 0, 0, 218,
+    0, 0, 0, 0, 0, 0, 0, 272, 165, 16, 105, 0, 0, 165, 0, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 41, 148, 695,
+    246, 218, 317, 16, 19, 125, 0, 0, 148, 272, 19, 19, 148, 691, 218, 0,
+    128, 260, 295, 105, 16, 9, 810, 0, 227, 125, 0, 9, 9, 9, 9, 0,
+    0, 0, 0, 688, 148, 699, 0, 44, 0, 9, 78, 78, 105, 165, 291, 78,
+    78, 78, 41, 815, 0, 0, 820, 246, 341, 341, 148, 295, 9, 9, 218, 105,
+    148, 101, 0, 0, 9, 825, 0, 0, 0, 9, 78, 9, 0, 0, 0, 831,
+    699, 105, 291, 125, 0, 838, 0, 105, 0, 0, 9, 0, 78, 9, 44, 0,
+    0, 0, 9, 291, 165, 9, 0, 0, 9, 0, 227, 218, 227, 0, 710, 218,
+    0, 691, 0, 308, 0, 221, 0, 9, 0, 0, 9, 0, 0, 0, 227, 9,
+    9, 0, 9, 41, 9, 0, 78, 9, 9, 9, 218, 19, 9, 9, 721, 125,
+    65, 272, 101, 9, 9, 0, 0, 0, 0, 41, 291, 741, 9, 0, 0, 0,
+    0, 9, 41, 41, 41, 291, 44, 9, 9, 9, 0, 9, 9, 0, 9, 9,
+    9, 9, 9, 9, 9, 9, 148, 41, 201, 710, 688, 125, 224, 291, 16, 125,
+    148, 0, 125, 16, 44, 44, 44, 16, 78, 105, 0, 125, 148, 691, 0, 260,
+    9, 9, 9, 125, 272, 9, 9, 0, 105, 156, 9, 825, 844, 797, 9, 0,
+    0, 0, 0, 246, 148, 16, 851, 688, 0, 0, 0, 0, 105, 0, 0, 218,
+    227, 0, 105, 0, 148, 148, 326, 264, 148, 16, 0, 0, 125, 148, 44, 125,
+    0, 0, 747, 0, 0, 0, 0, 0, 0, 0, 0, 291, 105, 0, 0, 78,
+    105, 317, 19, 125, 218, 688, 387, 16, 721, 0, 0, 0, 0, 9, 78, 291,
+    285, 0, 9, 291, 0, 291, 9, 218, 9, 0, 272, 19, 688, 0, 9, 9,
+    41, 9, 341, 148, 148, 488, 260, 125, 148, 19, 0, 221, 78, 0, 857, 0,
+    215, 215, 775, 0, 0, 0, 148, 44, 224, 215, 117, 436, 9, 0, 9, 0,
+    78, 19, 299, 299, 317, 19, 215, 0, 148, 117, 0, 250, 221, 291, 0, 78,
+    0, 148, 250, 78, 860, 0, 78, 1, 0, 125, 148, 125, 0, 9, 165, 78,
+    0, 341, 864, 0, 218, 125, 0, 0, 0, 272, 148, 16, 125, 0, 0, 0,
+    148, 16, 0, 105, 125, 148, 16, 148, 0, 0, 0, 165, 215, 148, 0, 0,
+    0, 148, 165, 105, 105, 0, 105, 0, 0, 218, 0, 78, 105, 0, 260, 78,
+    148, 0, 148, 148, 341, 341, 0, 78, 0, 0, 105, 0, 695, 291, 148, 125,
+    221, 0, 0, 148, 695, 341, 19, 0, 0, 0, 0, 0, 148, 221, 0, 221,
+    148, 0, 710, 0, 0, 41, 9, 0, 695, 0, 0, 105, 105, 78, 78, 148,
+    218, 0, 0, 78, 0, 0, 0, 227, 691, 788, 0, 291, 221, 0, 148, 78,
+    215, 0, 78, 19, 721, 0, 9, 41, 0, 41, 41, 0, 41, 148, 0, 41,
+    0, 0, 41, 41, 165, 9, 9, 9, 9, 41, 0, 844, 0, 710, 78, 221,
+    688, 0, 710, 691, 0, 218, 148, 0, 125, 16, 148, 148, 1, 710, 699, 218,
+    308, 0, 0, 148, 721, 117, 9, 9, 148, 148, 12, 0, 0, 291, 12, 12,
+    121, 148, 0, 688, 148, 0, 341, 227, 218, 0, 0, 0, 0, 0, 16, 148,
+    221, 295, 291, 9, 1, 0, 9, 0, 221, 869, 876, 9, 1, 0, 0, 0,
+    218, 16, 302, 1, 78, 148, 221, 0, 148, 0, 221, 165, 218, 0, 0, 691,
+    16, 218, 227, 19, 702, 224, 0, 148, 0, 125, 227, 0, 78, 78, 1, 0,
+    0, 710, 317, 221, 0, 0, 12, 0, 0, 0, 218, 0, 881, 0, 695, 0,
+    0, 0, 0, 0, 0, 0, 218, 291, 0, 0, 0, 218, 0, 0, 12, 0,
+    0, 16, 165, 0, 218, 408, 16, 0, 0, 691, 12, 19, 688, 218, 215, 710,
+    0, 0, 0, 0, 0, 0, 0, 215, 0, 148, 291, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 19, 19, 688, 0, 772, 710, 688, 0, 0, 221, 0, 221,
+    0, 0, 78, 0, 0, 0, 148, 9, 12, 221, 1, 12, 0, 12, 12, 699,
+    1, 148, 0, 820, 295, 16, 16, 78, 148, 0, 695, 12, 125, 0, 0, 0,
+    101, 302, 125, 165, 125, 9, 0, 218, 0, 0, 215, 125, 0, 16, 9, 0,
+    16, 16, 308, 125, 308, 9, 16, 165, 12, 0, 165, 710, 699, 373, 0, 218,
+    885, 246, 78, 0, 221, 19, 0, 0, 165, 0, 0, 148, 12, 165, 221, 0,
+    165, 0, 0, 0, 0, 221, 1, 0, 44, 148, 78, 732, 0, 78, 0, 218,
+    148, 221, 215, 101, 561, 890, 0, 0, 9, 0, 101, 101, 9, 0, 9, 0,
+    308, 0, 9, 101, 215, 0, 0, 0, 0, 0, 215, 0, 0, 101, 101, 215,
+    0, 0, 101, 215, 9, 215, 0, 710, 0, 105, 224, 108, 272, 148, 688, 0,
+    688, 215, 148, 125, 221, 0, 713, 0, 117, 125, 16, 224, 215, 148, 272, 117,
+    215, 221, 117, 148, 148, 0, 0, 218, 0, 125, 0, 125, 125, 125, 272, 0,
+    148, 488, 117, 221, 221, 0, 0, 0, 9, 101, 9, 101, 0, 1, 710, 12,
+    227, 16, 291, 9, 0, 0, 148, 148, 0, 341, 148, 0, 9, 9, 721, 0,
+    78, 221, 706, 218, 721, 148, 218, 772, 0, 221, 895, 0, 291, 699, 148, 19,
+    78, 165, 218, 78, 699, 291, 264, 688, 9, 0, 9, 345, 112, 0, 0, 165,
+    0, 0, 0, 0, 695, 0, 0, 41, 9, 9, 0, 0, 0, 0, 0, 0,
+    367, 41, 105, 0, 0, 0, 0, 148, 148, 0, 9, 221, 19, 0, 0, 148,
+    9, 9, 78, 0, 0, 0, 0, 0, 9, 9, 9, 0, 9, 9, 19, 0,
+    19, 78, 165, 148, 19, 688, 900, 1, 41, 234, 234, 148, 178, 9, 221, 9,
+    9, 724, 41, 9, 112, 905, 0, 0, 0, 0, 105, 112, 19, 910, 78, 0,
+    78, 0, 0, 78, 221, 112, 915, 0, 112, 224, 710, 0, 713, 0, 224, 78,
+    0, 78, 691, 19, 148, 792, 0, 281, 0, 0, 148, 19, 0, 44, 218, 218,
+    44, 688, 105, 0, 710, 121, 161, 688, 922, 0, 0, 16, 117, 117, 0, 16,
+    16, 0, 148, 224, 9, 0, 710, 221, 218, 317, 925, 19, 12, 19, 0, 221,
+    691, 27, 12, 928, 78, 19, 0, 721, 16, 27, 295, 1, 9, 0, 928, 165,
+    9, 1, 9, 16, 0, 121, 12, 9, 0, 16, 0, 105, 341, 844, 101, 0,
+    688, 218, 165, 0, 246, 165, 12, 148, 1, 78, 876, 224, 1, 934, 108, 105,
+    0, 0, 0, 165, 9, 691, 939, 101, 9, 0, 945, 221, 221, 221, 0, 78,
+    291, 165, 0, 0, 721, 0, 0, 0, 12, 224, 78, 221, 688, 165, 12, 295,
+    9, 105, 9, 78, 295, 0, 0, 9, 0, 691, 0, 0, 0, 0, 0, 0,
+    695, 0, 0, 12, 0, 0, 0, 12, 16, 0, 688, 0, 0, 148, 0, 0,
+    0, 0, 78, 0, 148, 9, 19, 688, 224, 0, 772, 215, 0, 0, 0, 0,
+    710, 0, 0, 691, 16, 19, 218, 0, 0, 550, 0, 688, 16, 148, 0, 0,
+    227, 341, 688, 0, 148, 165, 0, 78, 0, 0, 101, 12, 19, 0, 78, 0,
+    0, 0, 0, 16, 218, 218, 0, 881, 78, 695, 710, 19, 0, 96, 16, 12,
+    9, 264, 0, 0, 0, 0, 0, 224, 221, 706, 12, 9, 224, 12, 291, 12,
+    165, 12, 0, 12, 12, 101, 12, 246, 0, 0, 728, 78, 121, 0, 0, 12,
+    12, 815, 9, 148, 12, 688, 44, 148, 0, 0, 0, 0, 732, 218, 341, 218,
+    710, 0, 224, 699, 295, 148, 688, 117, 0, 221, 0, 148, 281, 0, 9, 12,
+    268, 12, 12, 0, 12, 699, 16, 9, 16, 710, 281, 9, 218, 699, 78, 246,
+    0, 78, 221, 0, 0, 308, 308, 101, 0, 101, 308, 0, 0, 0, 0, 105,
+    101, 0, 101, 9, 308, 0, 215, 9, 0, 105, 108, 108, 108, 0, 215, 101,
+    215, 308, 215, 613, 215, 215, 165, 215, 215, 0, 9, 0, 308, 101, 125, 125,
+    215, 0, 215, 0, 0, 101, 101, 101, 125, 299, 308, 101, 101, 56, 9, 215,
+    101, 101, 0, 227, 0, 308, 78, 0, 0, 16, 0, 688, 0, 117, 16, 387,
+    221, 272, 19, 0, 0, 0, 0, 224, 272, 16, 952, 125, 16, 272, 0, 0,
+    0, 215, 125, 16, 221, 0, 0, 260, 117, 0, 0, 148, 16, 0, 16, 148,
+    0, 0, 0, 0, 0, 16, 0, 19, 148, 0, 117, 221, 148, 221, 117, 148,
+    299, 0, 78, 78, 44, 958, 148, 0, 78, 373, 148, 117, 0, 19, 218, 19,
+    12, 0, 148, 0, 12, 9, 519, 9, 9, 108, 9, 16, 9, 12, 12, 963,
+    12, 710, 12, 0, 9, 221, 9, 9, 101, 19, 0, 0, 12, 12, 12, 0,
+    472, 0, 224, 688, 148, 12, 12, 12, 9, 78, 688, 341, 0, 721, 148, 215,
+    246, 148, 44, 0, 148, 969, 264, 688, 148, 0, 0, 16, 0, 779, 362, 227,
+    688, 44, 125, 16, 44, 125, 148, 16, 148, 125, 117, 0, 44, 218, 688, 125,
+    691, 974, 721, 125, 125, 218, 218, 125, 221, 9, 9, 9, 0, 9, 148, 0,
+    9, 105, 9, 9, 0, 0, 78, 125, 148, 16, 688, 0, 0, 688, 0, 0,
+    0, 0, 713, 224, 125, 221, 0, 12, 1, 218, 218, 218, 0, 218, 0, 0,
+    1, 227, 227, 691, 224, 0, 0, 9, 148, 0, 0, 688, 221, 0, 125, 0,
+    9, 0, 0, 0, 0, 148, 341, 341, 0, 341, 221, 710, 221, 44, 0, 121,
+    721, 691, 1, 224, 0, 0, 221, 221, 436, 1, 1, 78, 0, 16, 260, 16,
+    218, 221, 260, 78, 0, 0, 1, 78, 218, 19, 0, 688, 0, 1, 980, 78,
+    218, 78, 264, 16, 221, 148, 221, 224, 148, 0, 272, 0, 19, 16, 387, 125,
+    0, 19, 713, 0, 0, 0, 41, 148, 19, 0, 221, 44, 211, 125, 0, 0,
+    44, 44, 78, 78, 0, 0, 16, 16, 317, 0, 0, 148, 0, 0, 227, 16,
+    16, 78, 78, 227, 0, 44, 0, 78, 0, 44, 44, 0, 688, 148, 0, 721,
+    0, 117, 148, 0, 0, 0, 0, 0, 0, 0, 65, 9, 0, 78, 0, 0,
+    688, 0, 19, 0, 78, 78, 78, 221, 221, 815, 0, 0, 0, 227, 19, 78,
+    688, 78, 224, 0, 125, 0, 78, 0, 0, 0, 19, 0, 341, 78, 9, 78,
+    44, 221, 291, 221, 544, 221, 105, 0, 41, 9, 9, 0, 9, 78, 985, 0,
+    9, 9, 9, 9, 0, 0, 221, 221, 9, 0, 9, 695, 0, 695, 688, 0,
+    221, 9, 0, 0, 9, 0, 0, 991, 0, 0, 0, 691, 0, 0, 695, 16,
+    691, 815, 0, 0, 0, 41, 732, 221, 221, 78, 1, 215, 148, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 0, 0, 246, 0, 0, 0, 0, 710, 105, 691,
+    9, 710, 0, 0, 125, 357, 125, 125, 0, 446, 0, 0, 221, 148, 0, 0,
+    0, 0, 19, 9, 272, 317, 0, 9, 272, 272, 221, 9, 0, 0, 0, 691,
+    108, 125, 221, 105, 9, 41, 272, 65, 0, 125, 9, 688, 0, 0, 19, 41,
+    0, 41, 41, 0, 291, 0, 272, 101, 9, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 221, 221, 260, 0, 16, 16, 0, 272, 125, 117, 0, 0, 0,
+    0, 0, 0, 0, 19, 272, 19, 0, 221, 16, 0, 0, 0, 9, 221, 436,
+    0, 0, 0, 0, 0, 41, 41, 0, 227, 148, 387, 16, 0, 117, 0, 0,
+    0, 387, 9, 16, 691, 19, 9, 65, 0, 0, 0, 0, 16, 16, 16, 218,
+    996, 78, 148, 0, 0, 0, 148, 65, 125, 148, 125, 105, 678, 492, 101, 215,
+    105, 78, 19, 905, 224, 678, 0, 19, 9, 0, 317, 291, 0, 41, 0, 0,
+    0, 0, 0, 0, 291, 9, 0, 317, 0, 0, 0, 272, 234, 9, 272, 0,
+    9, 0, 0, 272, 1003, 221, 221, 0, 0, 291, 78, 221, 41, 0, 0, 125,
+    125, 16, 108, 0, 0, 224, 16, 125, 16, 0, 952, 125, 221, 0, 0, 291,
+    0, 0, 688, 260, 272, 260, 16, 78, 0, 272, 387, 0, 108, 221, 0, 0,
+    0, 0, 0, 0, 0, 0, 41, 0, 41, 0, 0, 0, 0, 41, 0, 0,
+    0, 41, 41, 9, 125, 215, 326, 105, 0, 0, 0, 0, 215, 317, 0, 0,
+    78, 78, 688, 78, 78, 117, 1, 1, 1, 1, 1, 1, 1, 1, 1, 125,
+    19, 125, 125, 125, 688, 125, 125, 78, 0, 221, 19, 221, 0, 9, 65, 16,
+    16, 0, 125, 41, 65, 78, 65, 0, 0, 341, 0, 44, 148, 78, 0, 221,
+    125, 0, 0, 0, 221, 1, 1, 16, 0, 0, 1, 16, 0, 0, 0, 608,
+    1, 260, 1, 221, 0, 221, 0, 0, 0, 41, 78, 41, 0, 0, 9, 105,
+    19, 0, 0, 0, 317, 224, 317, 101, 9, 0, 0, 9, 0, 0, 0, 221,
+    0, 224, 0, 0, 0, 0, 0, 0, 218, 0, 0, 78, 0, 125, 108, 272,
+    108, 623, 0, 125, 105, 0, 125, 9, 0, 0, 0, 9, 0, 1008, 9, 0,
+    0, 0, 78, 78, 0, 78, 0, 12, 1, 19, 387, 1, 1, 27, 1, 1,
+    101, 16, 317, 958, 1, 1, 1, 19, 1, 0, 0, 78, 9, 291, 0, 0,
+    281, 78, 78, 0, 0, 78, 0, 0, 0, 0, 0, 105, 0, 0, 1012, 0,
+    165, 0, 260, 0, 0, 19, 19, 317, 19, 272, 0, 221, 9, 224, 19, 224,
+    78, 125, 387, 125, 78, 0, 0, 0, 125, 0, 376, 0, 0, 221, 19, 0,
+    117, 688, 260, 0, 0, 148, 0, 0, 0, 436, 0, 78, 0, 272, 0, 0,
+    488, 488, 78, 215, 78, 148, 221, 0, 0, 16, 117, 0, 0, 125, 9, 0,
+    250, 78, 9, 9, 9, 0, 9, 0, 0, 148, 0, 0, 0, 0, 44, 1,
+    125, 1017, 125, 19, 0, 19, 0, 710, 221, 101, 9, 0, 0, 44, 148, 221,
+    0, 0, 148, 221, 0, 221, 9, 125, 628, 41, 0, 78, 78, 16, 221, 699,
+    0, 387, 148, 0, 0, 0, 0, 221, 44, 227, 0, 78, 227, 0, 246, 0,
+    246, 0, 295, 125, 0, 41, 148, 19, 0, 0, 0, 148, 0, 0, 221, 0,
+    341, 0, 0, 0, 710, 19, 1021, 148, 0, 291, 221, 125, 78, 125, 125, 125,
+    376, 125, 9, 221, 376, 0, 688, 291, 0, 16, 695, 41, 0, 0, 78, 710,
+    221, 221, 281, 0, 148, 148, 341, 16, 125, 221, 0, 0, 9, 16, 0, 0,
+    125, 221, 125, 221, 16, 9, 78, 16, 16, 19, 9, 9, 16, 272, 41, 9,
+    156, 0, 41, 9, 9, 16, 44, 0, 221, 125, 272, 0, 0, 1026, 0, 9,
+    9, 1032, 9, 295, 1026, 9, 0, 0, 148, 148, 78, 0, 0, 218, 121, 148,
+    0, 295, 78, 78, 0, 0, 0, 0, 1, 295, 0, 9, 0, 0, 472, 9,
+    105, 1, 9, 9, 472, 0, 125, 1038, 0, 101, 101, 264, 78, 148, 215, 148,
+    215, 12, 125, 0, 148, 699, 688, 0, 0, 16, 148, 341, 19, 22, 0, 16,
+    0, 1, 341, 0, 0, 341, 0, 688, 341, 16, 224, 12, 227, 0, 148, 148,
+    0, 1, 148, 16, 19, 0, 16, 0, 710, 0, 0, 0, 0, 0, 0, 16,
+    16, 341, 148, 0, 148, 22, 165, 0, 9, 0, 0, 317, 117, 78, 125, 19,
+    387, 221, 272, 272, 221, 148, 0, 218, 16, 0, 0, 78, 78, 125, 125, 19,
+    0, 78, 211, 0, 341, 0, 0, 688, 218, 148, 78, 148, 721, 0, 0, 0,
+    0, 148, 1043, 246, 0, 218, 0, 78, 0, 148, 9, 295, 12, 688, 78, 16,
+    221, 12, 78, 78, 44, 0, 291, 0, 291, 22, 221, 246, 688, 0, 717, 710,
+    0, 702, 125, 0, 125, 0, 0, 0, 299, 101, 215, 0, 721, 125, 215, 125,
+    308, 0, 613, 187, 215, 187, 221, 41, 187, 187, 0, 215, 308, 105, 125, 125,
+    105, 215, 299, 0, 221, 221, 148, 221, 1048, 706, 148, 0, 0, 0, 0, 710,
+    148, 108, 0, 165, 0, 0, 0, 221, 224, 125, 0, 101, 101, 224, 0, 299,
+    125, 0, 9, 125, 125, 9, 9, 0, 9, 101, 0, 308, 101, 218, 221, 9,
+    890, 125, 41, 101, 9, 1055, 215, 221, 125, 215, 9, 187, 688, 272, 608, 78,
+    387, 0, 215, 215, 0, 215, 387, 0, 221, 272, 224, 387, 117, 125, 125, 148,
+    0, 16, 117, 0, 0, 0, 0, 0, 78, 0, 0, 224, 0, 0, 0, 0,
+    272, 148, 215, 0, 19, 148, 0, 19, 317, 125, 221, 0, 19, 0, 0, 0,
+    0, 0, 0, 272, 0, 215, 19, 272, 78, 260, 0, 0, 0, 78, 0, 0,
+    291, 688, 218, 78, 16, 0, 710, 0, 272, 721, 0, 12, 710, 22, 0, 12,
+    9, 9, 0, 0, 101, 0, 0, 0, 0, 0, 0, 12, 9, 0, 12, 9,
+    0, 1061, 0, 9, 9, 215, 246, 221, 1, 0, 0, 78, 9, 9, 0, 78,
+    9, 156, 19, 408, 148, 148, 221, 12, 0, 12, 0, 121, 0, 0, 590, 12,
+    1, 9, 691, 9, 0, 12, 9, 0, 295, 9, 688, 9, 19, 1, 78, 12,
+    165, 16, 9, 295, 291, 12, 291, 221, 0, 78, 12, 16, 0, 0, 688, 691,
+    0, 291, 221, 9, 224, 227, 12, 101, 16, 0, 12, 12, 688, 688, 224, 148,
+    16, 16, 16, 16, 851, 0, 148, 16, 148, 16, 148, 221, 0, 0, 165, 78,
+    78, 0, 27, 224, 224, 78, 165, 0, 291, 0, 12, 760, 12, 44, 16, 699,
+    19, 148, 9, 0, 0, 0, 218, 0, 0, 0, 0, 691, 221, 0, 1065, 27,
+    78, 215, 78, 16, 0, 0, 0, 695, 218, 0, 0, 78, 0, 19, 19, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 291, 0, 317, 16, 0, 165, 0, 0,
+    78, 0, 0, 688, 291, 78, 0, 218, 594, 4, 264, 78, 221, 224, 0, 125,
+    125, 0, 295, 295, 78, 688, 148, 218, 341, 246, 218, 0, 0, 688, 0, 148,
+    0, 12, 0, 9, 9, 78, 12, 0, 9, 12, 12, 9, 148, 9, 0, 221,
+    78, 44, 27, 12, 0, 12, 12, 0, 0, 0, 101, 165, 101, 125, 108, 125,
+    101, 9, 0, 125, 108, 9, 125, 16, 9, 295, 16, 9, 16, 105, 16, 105,
+    16, 9, 295, 16, 16, 16, 16, 16, 16, 16, 16, 9, 16, 101, 9, 108,
+    16, 0, 0, 9, 9, 1, 215, 9, 613, 44, 0, 125, 0, 0, 16, 16,
+    215, 1068, 215, 227, 125, 0, 0, 78, 9, 221, 0, 78, 221, 0, 165, 221,
+    165, 9, 710, 0, 9, 221, 9, 12, 218, 688, 12, 291, 0, 215, 0, 101,
+    101, 699, 0, 234, 0, 0, 613, 215, 101, 0, 1003, 101, 0, 0, 215, 0,
+    215, 0, 125, 125, 101, 221, 215, 9, 0, 0, 215, 0, 9, 9, 101, 710,
+    0, 215, 0, 101, 125, 101, 0, 308, 165, 101, 165, 9, 0, 125, 9, 101,
+    215, 678, 0, 1003, 678, 125, 148, 0, 224, 291, 125, 0, 221, 215, 488, 710,
+    488, 246, 0, 0, 0, 78, 699, 215, 958, 224, 215, 0, 78, 221, 291, 125,
+    78, 0, 0, 224, 125, 488, 0, 0, 0, 117, 488, 0, 0, 0, 0, 78,
+    0, 0, 0, 125, 78, 0, 78, 78, 78, 125, 0, 44, 221, 0, 78, 0,
+    19, 732, 9, 710, 0, 19, 221, 165, 221, 12, 0, 22, 101, 9, 221, 9,
+    710, 12, 0, 699, 218, 78, 78, 0, 44, 227, 0, 218, 0, 221, 0, 0,
+    9, 221, 221, 125, 221, 9, 121, 1, 9, 0, 0, 0, 0, 688, 121, 0,
+    221, 0, 16, 16, 16, 165, 9, 268, 230, 0, 0, 9, 0, 78, 105, 0,
+    0, 16, 12, 16, 9, 9, 16, 0, 713, 0, 9, 0, 9, 9, 9, 0,
+    9, 295, 148, 148, 148, 260, 9, 16, 0, 0, 0, 0, 0, 0, 539, 224,
+    706, 0, 218, 148, 125, 246, 9, 688, 0, 0, 623, 0, 0, 0, 0, 0,
+    0, 688, 78, 246, 78, 78, 0, 0, 221, 0, 148, 268, 221, 317, 16, 0,
+    0, 9, 0, 1075, 9, 165, 148, 78, 0, 215, 1, 1, 1, 148, 9, 105,
+    0, 0, 1, 0, 0, 0, 16, 78, 0, 0, 78, 9, 148, 12, 165, 78,
+    165, 101, 16, 691, 0, 0, 0, 0, 0, 0, 732, 691, 78, 78, 78, 78,
+    121, 688, 16, 0, 688, 16, 0, 0, 0, 0, 0, 16, 78, 710, 0, 0,
+    0, 264, 105, 78, 291, 0, 0, 0, 78, 221, 264, 78, 218, 148, 0, 317,
+    9, 0, 688, 0, 221, 0, 699, 710, 688, 148, 0, 1, 19, 0, 291, 0,
+    0, 0, 246, 1079, 0, 0, 9, 0, 215, 0, 0, 0, 0, 1, 1, 285,
+    691, 78, 691, 0, 78, 44, 78, 44, 688, 44, 78, 250, 78, 0, 699, 221,
+    41, 9, 221, 148, 121, 0, 0, 19, 221, 0, 341, 0, 16, 148, 221, 0,
+    1, 1, 0, 1, 125, 218, 125, 125, 695, 0, 0, 125, 125, 16, 16, 16,
+    0, 16, 16, 1084, 19, 125, 125, 0, 0, 0, 0, 0, 0, 0, 148, 125,
+    125, 0, 0, 1, 1, 16, 1, 125, 125, 125, 125, 125, 125, 125, 881, 0,
+    0, 125, 0, 0, 125, 221, 125, 0, 0, 125, 125, 78, 227, 125, 215, 215,
+    215, 215, 221, 125, 125, 215, 0, 0, 218, 706, 260, 0, 16, 724, 0, 125,
+    44, 78, 0, 0, 16, 16, 16, 19, 16, 16, 78, 291, 0, 0, 688, 16,
+    0, 19, 44, 0, 246, 1090, 0, 105, 815, 0, 0, 246, 341, 246, 148, 148,
+    815, 0, 165, 695, 218, 688, 0, 218, 9, 165, 221, 105, 710, 105, 105, 105,
+    105, 105, 105, 19, 221, 9, 19, 876, 9, 12, 688, 0, 688, 78, 148, 105,
+    9, 78, 105, 1095, 0, 221, 291, 78, 317, 161, 1, 0, 78, 0, 125, 16,
+    125, 125, 19, 0, 0, 125, 0, 1102, 224, 272, 16, 125, 125, 224, 125, 0,
+    0, 125, 125, 321, 0, 215, 0, 224, 125, 0, 0, 0, 44, 0, 218, 218,
+    0, 0, 688, 148, 0, 0, 148, 0, 0, 0, 125, 0, 125, 125, 376, 215,
+    0, 387, 0, 0, 16, 272, 0, 0, 0, 44, 260, 221, 0, 0, 0, 0,
+    0, 0, 0, 16, 0, 387, 148, 0, 0, 0, 19, 16, 0, 0, 0, 16,
+    0, 0, 0, 1, 0, 121, 1, 1, 0, 0, 1, 0, 16, 0, 608, 148,
+    0, 0, 1003, 608, 16, 608, 450, 436, 16, 215, 0, 317, 387, 0, 0, 0,
+    0, 0, 224, 0, 0, 0, 125, 272, 0, 0, 215, 608, 272, 1108, 0, 688,
+    272, 699, 272, 0, 0, 19, 0, 0, 44, 0, 78, 0, 260, 0, 0, 0,
+    0, 218, 341, 148, 0, 688, 125, 221, 0, 16, 341, 0, 148, 246, 784, 148,
+    148, 246, 341, 1, 1, 341, 699, 695, 148, 779, 688, 0, 688, 148, 695, 148,
+    148, 291, 1, 12, 1, 0, 9, 688, 1, 1, 9, 1, 691, 0, 78, 148,
+    0, 0, 148, 1043, 246, 221, 0, 688, 0, 227, 0, 0, 0, 0, 710, 688,
+    1, 148, 9, 0, 9, 0, 78, 408, 125, 710, 215, 125, 0, 0, 125, 78,
+    224, 215, 0, 148, 16, 125, 1114, 1120, 125, 1120, 0, 125, 125, 0, 125, 125,
+    1126, 125, 125, 0, 218, 125, 125, 1120, 1079, 125, 1131, 148, 125, 125, 125, 221,
+    952, 0, 125, 125, 125, 125, 125, 78, 125, 69, 215, 125, 78, 16, 291, 218,
+    710, 125, 215, 376, 41, 125, 78, 0, 0, 0, 0, 724, 272, 0, 16, 272,
+    0, 0, 125, 0, 0, 0, 0, 0, 0, 148, 699, 227, 227, 1, 1, 227,
+    772, 218, 1, 1137, 0, 0, 1, 227, 227, 19, 125, 227, 688, 78, 148, 117,
+    317, 125, 19, 148, 16, 41, 9, 0, 0, 0, 125, 0, 9, 65, 227, 721,
+    16, 9, 44, 125, 0, 341, 148, 0, 0, 148, 0, 148, 0, 78, 148, 0,
+    0, 695, 221, 246, 0, 227, 0, 148, 264, 218, 0, 0, 695, 0, 1142, 695,
+    16, 710, 0, 928, 0, 1147, 688, 221, 125, 125, 125, 16, 125, 1153, 125, 0,
+    125, 125, 0, 125, 125, 117, 125, 125, 221, 0, 78, 125, 125, 125, 125, 125,
+    691, 0, 16, 710, 710, 688, 1, 19, 0, 0, 0, 691, 148, 0, 16, 16,
+    0, 0, 0, 227, 0, 0, 0, 0, 0, 1, 0, 0, 221, 272, 341, 19,
+    44, 272, 16, 272, 0, 337, 0, 0, 246, 0, 221, 0, 710, 161, 1, 1,
+    78, 78, 78, 0, 732, 0, 0, 227, 0, 0, 19, 227, 0, 695, 0, 0,
+    0, 0, 0, 0, 0, 16, 0, 0, 44, 0, 44, 215, 227, 0, 78, 0,
+    78, 0, 291, 78, 0, 78, 0, 16, 299, 227, 0, 224, 227, 0, 16, 1,
+    0, 19, 0, 0, 0, 0, 272, 125, 16, 221, 272, 16, 272, 724, 713, 0,
+    0, 125, 125, 19, 227, 0, 0, 125, 0, 16, 0, 717, 0, 227, 0, 0,
+    78, 16, 78, 0, 78, 0, 0, 221, 272, 16, 125, 19, 16, 16, 16, 272,
+    272, 0, 0, 0, 0, 272, 224, 0, 148, 0, 688, 227, 148, 317, 0, 19,
+    0, 0, 0, 0, 19, 0, 246, 0, 702, 148, 0, 0, 710, 0, 272, 0,
+    0, 41, 0, 0, 0, 0, 19, 148, 148, 148, 272, 125, 19, 0, 0, 264,
+    16, 0, 19, 125, 0, 0, 0, 16, 688, 218, 148, 0, 0, 44, 0, 41,
+    16, 0, 16, 16, 0, 148, 0, 0, 0, 16, 387, 16, 0, 0, 41, 148,
+    272, 608, 0, 221, 0, 221, 291, 691, 688, 148, 0, 78, 317, 19, 488, 0,
+    19, 148, 0, 0, 260, 9, 688, 78, 221, 9, 0, 0, 9, 78, 291, 0,
+    317, 125, 0, 0, 148, 0, 0, 0, 148, 19, 221, 0, 41, 105, 0, 148,
+    0, 0, 0, 9, 246, 9, 9, 0, 9, 688, 0, 0, 291, 0, 105, 0,
+    105, 0, 0, 19, 0, 19, 227, 623, 272, 9, 0, 0, 0, 221, 9, 44,
+    0, 0, 291, 9, 78, 9, 221, 367, 218, 9, 215, 0, 0, 0, 291, 221,
+    221, 0, 272, 148, 19, 317, 224, 1159, 125, 125, 78, 125, 125, 0, 691, 0,
+    125, 125, 0, 1163, 16, 211, 125, 125, 125, 221, 317, 125, 125, 125, 125, 78,
+    0, 221, 272, 221, 260, 125, 224, 125, 125, 148, 125, 0, 0, 0, 78, 227,
+    44, 78, 148, 0, 148, 218, 221, 221, 125, 101, 125, 688, 246, 0, 125, 9,
+    0, 224, 148, 218, 613, 0, 246, 0, 0, 0, 815, 0, 0, 148, 246, 148,
+    41, 0, 0, 148, 0, 792, 291, 148, 0, 317, 713, 19, 125, 0, 148, 221,
+    125, 16, 16, 0, 16, 218, 227, 0, 0, 0, 713, 0, 0, 148, 117, 221,
+    387, 0, 227, 215, 215, 78, 9, 9, 272, 65, 165, 1169, 16, 0, 295, 19,
+    19, 0, 0, 0, 78, 0, 0, 0, 148, 0, 0, 224, 0, 1159, 78, 0,
+    0, 1, 125, 0, 16, 272, 0, 0, 317, 19, 0, 0, 125, 19, 0, 272,
+    9, 0, 221, 0, 0, 0, 272, 299, 16, 299, 16, 299, 41, 0, 1021, 0,
+    0, 0, 19, 299, 272, 317, 148, 0, 78, 0, 0, 0, 148, 341, 341, 0,
+    0, 0, 0, 0, 19, 0, 0, 0, 710, 0, 341, 0, 272, 688, 688, 0,
+    218, 272, 272, 272, 19, 16, 272, 19, 0, 224, 0, 218, 1174, 0, 125, 16,
+    272, 148, 272, 16, 272, 117, 19, 0, 0, 221, 0, 19, 608, 0, 117, 224,
+    16, 0, 1, 218, 1, 0, 148, 44, 695, 1, 1, 0, 291, 78, 699, 373,
+    221, 19, 0, 0, 218, 341, 732, 0, 0, 246, 691, 218, 815, 218, 44, 688,
+    317, 688, 148, 221, 246, 0, 0, 78, 264, 221, 218, 1179, 78, 12, 9, 0,
+    9, 9, 9, 9, 91, 12, 12, 9, 9, 0, 12, 91, 165, 9, 268, 19,
+    691, 721, 12, 19, 19, 0, 268, 0, 0, 218, 0, 295, 0, 0, 0, 148,
+    16, 0, 9, 695, 221, 9, 0, 710, 9, 0, 12, 0, 78, 105, 0, 165,
+    165, 0, 9, 16, 0, 16, 291, 16, 12, 0, 16, 0, 688, 16, 295, 699,
+    221, 44, 246, 165, 78, 0, 0, 291, 732, 1184, 0, 0, 691, 224, 221, 0,
+    148, 9, 688, 688, 148, 0, 0, 12, 12, 0, 148, 12, 415, 688, 148, 695,
+    710, 0, 0, 815, 0, 215, 148, 148, 148, 12, 16, 227, 710, 0, 0, 0,
+    0, 0, 148, 0, 0, 691, 148, 16, 19, 0, 16, 9, 0, 0, 772, 0,
+    0, 16, 0, 1, 0, 0, 688, 341, 857, 148, 1, 0, 446, 710, 44, 148,
+    19, 0, 22, 724, 695, 218, 44, 221, 156, 264, 16, 9, 148, 0, 221, 268,
+    268, 285, 78, 9, 165, 0, 12, 0, 9, 16, 16, 1191, 218, 12, 78, 224,
+    22, 221, 218, 688, 710, 710, 105, 12, 688, 215, 0, 0, 108, 0, 125, 9,
+    0, 0, 101, 101, 9, 0, 16, 9, 295, 16, 16, 16, 0, 0, 101, 101,
+    706, 9, 308, 125, 0, 224, 16, 16, 16, 0, 9, 9, 16, 9, 9, 0,
+    215, 12, 0, 0, 101, 9, 613, 215, 227, 9, 0, 613, 9, 613, 0, 215,
+    0, 9, 9, 857, 101, 373, 148, 101, 0, 9, 224, 22, 691, 224, 0, 721,
+    291, 78, 706, 108, 44, 0, 221, 695, 0, 148, 9, 112, 0, 747, 0, 9,
+    291, 0, 12, 0, 0, 12, 78, 218, 0, 0, 44, 148, 165, 125, 0, 78,
+    224, 691, 0, 78, 148, 101, 101, 215, 0, 0, 215, 215, 613, 0, 101, 0,
+    101, 105, 0, 0, 125, 125, 125, 9, 101, 0, 9, 0, 710, 0, 108, 215,
+    215, 215, 215, 9, 125, 9, 101, 215, 9, 215, 0, 9, 291, 125, 221, 0,
+    16, 291, 16, 16, 710, 387, 272, 19, 0, 19, 387, 16, 78, 387, 272, 272,
+    78, 148, 16, 608, 19, 125, 16, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 125, 0, 16, 0, 272, 0, 125, 19, 19, 387, 272, 0, 0, 724,
+    0, 0, 16, 608, 0, 0, 0, 148, 0, 272, 0, 0, 44, 0, 78, 224,
+    0, 227, 0, 224, 317, 125, 0, 0, 0, 218, 19, 148, 224, 12, 78, 291,
+    291, 105, 0, 221, 9, 101, 713, 436, 0, 710, 1196, 9, 9, 12, 0, 0,
+    0, 12, 148, 0, 12, 0, 0, 148, 246, 148, 9, 218, 1, 12, 12, 341,
+    721, 165, 224, 78, 295, 291, 9, 9, 0, 105, 105, 9, 0, 1200, 9, 302,
+    0, 9, 0, 9, 9, 16, 19, 0, 0, 12, 9, 0, 291, 9, 12, 9,
+    22, 295, 148, 0, 227, 218, 695, 148, 165, 341, 218, 0, 105, 0, 218, 732,
+    710, 112, 688, 0, 16, 268, 0, 218, 0, 165, 105, 16, 0, 0, 9, 0,
+    16, 12, 0, 148, 295, 0, 9, 0, 0, 9, 12, 1, 12, 844, 0, 9,
+    0, 483, 12, 148, 121, 0, 0, 9, 0, 710, 218, 0, 0, 148, 876, 165,
+    16, 0, 105, 0, 16, 9, 0, 9, 148, 483, 0, 69, 44, 0, 291, 594,
+    101, 9, 221, 0, 221, 0, 0, 148, 0, 0, 41, 0, 44, 0, 78, 0,
+    710, 125, 0, 0, 0, 710, 0, 0, 1206, 0, 272, 0, 0, 78, 16, 125,
+    117, 125, 117, 0, 0, 78, 78, 44, 78, 44, 78, 78, 224, 272, 125, 224,
+    0, 0, 125, 125, 0, 218, 0, 218, 691, 227, 218, 1179, 148, 16, 16, 221,
+    272, 272, 272, 1174, 221, 0, 125, 272, 125, 0, 0, 0, 0, 0, 0, 0,
+    16, 19, 0, 16, 16, 221, 148, 0, 0, 0, 211, 0, 78, 78, 78, 772,
+    78, 272, 272, 0, 125, 19, 19, 148, 78, 148, 0, 148, 0, 0, 148, 291,
+    12, 0, 0, 148, 721, 224, 148, 0, 0, 105, 105, 0, 16, 0, 12, 165,
+    691, 0, 0, 44, 16, 0, 165, 0, 9, 295, 148, 0, 16, 16, 0, 0,
+    717, 9, 218, 148, 215, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221,
+    19, 165, 165, 81, 165, 772, 16, 272, 0, 0, 1, 0, 0, 688, 218, 0,
+    0, 0, 0, 0, 0, 12, 341, 12, 215, 0, 224, 264, 699, 78, 0, 922,
+    165, 105, 9, 0, 0, 221, 0, 0, 105, 1209, 16, 12, 0, 0, 295, 0,
+    0, 125, 272, 227, 0, 148, 0, 0, 78, 211, 211, 0, 0, 44, 44, 0,
+    0, 148, 688, 699, 125, 218, 0, 0, 0, 148, 211, 211, 0, 165, 148, 0,
+    0, 0, 699, 0, 105, 148, 291, 12, 44, 165, 0, 0, 0, 0, 0, 0,
+    224, 0, 0, 221, 0, 0, 221, 221, 1179, 9, 165, 9, 221, 0, 0, 12,
+    12, 0, 12, 0, 0, 0, 12, 78, 12, 9, 44, 173, 165, 165, 291, 0,
+    492, 12, 0, 148, 710, 165, 224, 436, 732, 717, 78, 0, 291, 221, 0, 78,
+    105, 0, 0, 246, 0, 117, 125, 0, 0, 0, 0, 211, 0, 44, 0, 260,
+    688, 0, 218, 0, 0, 272, 0, 0, 0, 0, 710, 0, 125, 0, 272, 0,
+    0, 0, 125, 0, 148, 0, 0, 0, 0, 19, 16, 78, 0, 19, 272, 125,
+    0, 0, 0, 0, 221, 221, 688, 19, 0, 19, 16, 436, 272, 0, 0, 387,
+    0, 0, 0, 0, 688, 0, 272, 387, 688, 0, 272, 0, 16, 0, 710, 291,
+    1065, 291, 16, 0, 0, 221, 0, 16, 688, 44, 165, 16, 165, 0, 9, 121,
+    16, 0, 148, 44, 148, 0, 0, 221, 27, 224, 108, 246, 408, 215, 91, 0,
+    721, 0, 341, 9, 0, 9, 0, 165, 12, 12, 0, 1215, 105, 105, 844, 44,
+    44, 165, 0, 0, 0, 148, 224, 221, 0, 148, 148, 0, 19, 125, 125, 775,
+    0, 0, 227, 710, 291, 125, 387, 148, 0, 16, 0, 688, 0, 387, 0, 0,
+    19, 221, 0, 78, 272, 0, 0, 0, 148, 16, 0, 0, 260, 0, 148, 0,
+    148, 221, 16, 0, 0, 0, 148, 0, 0, 125, 19, 272, 117, 0, 117, 16,
+    710, 0, 19, 0, 272, 0, 0, 272, 0, 221, 19, 0, 0, 0, 148, 0,
+    0, 0, 0, 211, 125, 608, 0, 0, 218, 1174, 387, 0, 221, 0, 0, 0,
+    0, 0, 260, 0, 0, 0, 0, 125, 19, 272, 0, 19, 19, 19, 775, 19,
+    688, 688, 148, 148, 12, 9, 78, 0, 341, 0, 246, 218, 148, 246, 0, 148,
+    19, 0, 221, 0, 9, 710, 9, 9, 12, 9, 9, 16, 9, 12, 78, 12,
+    9, 12, 12, 0, 12, 9, 12, 9, 9, 16, 0, 148, 1, 148, 1, 44,
+    9, 148, 0, 178, 341, 246, 0, 9, 732, 0, 148, 9, 78, 0, 272, 272,
+    16, 272, 16, 0, 221, 0, 0, 272, 224, 608, 0, 272, 0, 0, 16, 16,
+    16, 12, 9, 41, 12, 0, 9, 341, 9, 9, 9, 41, 9, 9, 101, 12,
+    165, 165, 165, 0, 0, 227, 0, 9, 16, 101, 9, 9, 0, 9, 0, 9,
+    9, 16, 0, 148, 0, 0, 0, 12, 1222, 525, 16, 221, 0, 12, 0, 78,
+    264, 12, 0, 19, 0, 0, 12, 0, 0, 291, 0, 0, 16, 218, 710, 165,
+    0, 218, 0, 9, 0, 695, 0, 0, 691, 16, 0, 9, 586, 0, 0, 721,
+    9, 9, 12, 148, 0, 9, 691, 173, 291, 16, 492, 105, 0, 0, 291, 1,
+    264, 221, 291, 0, 0, 732, 0, 0, 0, 0, 0, 0, 0, 148, 392, 165,
+    550, 218, 0, 0, 19, 221, 0, 0, 0, 688, 224, 16, 387, 0, 221, 16,
+    688, 0, 291, 272, 19, 0, 165, 0, 19, 1228, 0, 12, 721, 0, 0, 0,
+    12, 12, 804, 0, 0, 0, 688, 691, 0, 0, 165, 688, 165, 0, 695, 0,
+    12, 22, 0, 0, 0, 0, 0, 695, 0, 0, 0, 9, 9, 22, 308, 19,
+    0, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    78, 78, 0, 0, 78, 148, 0, 291, 221, 699, 227, 19, 148, 78, 0, 78,
+    9, 0, 0, 0, 0, 227, 0, 165, 0, 0, 0, 264, 78, 148, 291, 0,
+    0, 291, 105, 608, 12, 9, 0, 0, 0, 0, 0, 9, 78, 291, 0, 78,
+    0, 165, 165, 165, 165, 165, 165, 148, 0, 699, 221, 0, 0, 148, 688, 246,
+    148, 148, 691, 0, 341, 105, 218, 16, 272, 272, 0, 0, 0, 272, 387, 272,
+    0, 0, 0, 0, 221, 272, 0, 0, 218, 0, 0, 0, 710, 78, 291, 78,
+    291, 0, 78, 16, 148, 218, 19, 688, 0, 148, 9, 12, 78, 148, 148, 9,
+    0, 221, 218, 341, 218, 221, 0, 0, 221, 706, 0, 19, 148, 112, 12, 9,
+    19, 0, 710, 218, 691, 0, 78, 373, 224, 688, 0, 0, 713, 0, 218, 148,
+    0, 0, 0, 0, 125, 0, 78, 0, 16, 16, 215, 19, 125, 16, 688, 215,
+    1233, 775, 0, 0, 221, 0, 775, 215, 221, 0, 148, 0, 148, 16, 0, 148,
+    211, 211, 117, 125, 44, 0, 775, 19, 19, 221, 19, 0, 387, 0, 0, 0,
+    0, 0, 272, 272, 608, 16, 272, 387, 221, 0, 0, 19, 19, 260, 16, 148,
+    0, 341, 0, 0, 19, 0, 272, 19, 0, 78, 165, 0, 165, 215, 165, 1,
+    0, 0, 27, 0, 78, 105, 105, 688, 446, 341, 148, 246, 148, 0, 0, 0,
+    224, 0, 710, 19, 12, 227, 12, 0, 221, 264, 0, 688, 1, 0, 0, 0,
+    0, 0, 125, 165, 246, 0, 148, 1238, 246, 148, 1245, 0, 105, 0, 27, 27,
+    81, 105, 0, 221, 0, 27, 121, 264, 341, 108, 108, 221, 1, 27, 16, 148,
+    165, 0, 105, 165, 215, 815, 0, 16, 215, 710, 688, 0, 0, 0, 0, 691,
+    148, 9, 148, 0, 165, 0, 264, 295, 1, 0, 12, 101, 332, 108, 952, 0,
+    108, 108, 105, 9, 108, 108, 295, 105, 108, 9, 1250, 0, 9, 0, 211, 78,
+    0, 0, 0, 148, 0, 165, 341, 9, 16, 16, 302, 16, 0, 16, 0, 9,
+    291, 215, 0, 16, 133, 0, 0, 105, 78, 0, 0, 148, 105, 221, 1257, 105,
+    408, 295, 0, 710, 0, 0, 0, 688, 260, 125, 1264, 0, 125, 218, 688, 608,
+    227, 148, 125, 272, 0, 125, 0, 125, 19, 16, 0, 0, 125, 16, 0, 0,
+    0, 218, 0, 1270, 0, 721, 0, 16, 227, 16, 0, 0, 19, 0, 0, 0,
+    260, 0, 0, 0, 260, 0, 0, 78, 78, 224, 0, 0, 148, 148, 165, 78,
+    78, 148, 12, 224, 165, 165, 19, 0, 688, 688, 717, 218, 16, 436, 9, 12,
+    224, 121, 224, 121, 165, 108, 165, 105, 0, 0, 0, 0, 105, 0, 148, 12,
+    691, 218, 1, 291, 165, 16, 1209, 165, 550, 16, 27, 1, 108, 12, 105, 215,
+    1276, 16, 16, 0, 0, 16, 0, 16, 732, 16, 851, 16, 0, 820, 0, 0,
+    732, 16, 16, 0, 246, 148, 148, 710, 165, 0, 9, 148, 0, 710, 215, 19,
+    0, 0, 688, 1, 797, 1, 165, 16, 1281, 0, 0, 0, 0, 0, 710, 0,
+    16, 0, 12, 0, 16, 0, 0, 250, 699, 0, 0, 0, 0, 0, 0, 0,
+    0, 148, 78, 215, 22, 0, 227, 0, 695, 16, 12, 688, 295, 0, 117, 0,
+    44, 117, 117, 148, 215, 0, 44, 227, 0, 246, 0, 78, 387, 19, 272, 0,
+    221, 0, 387, 0, 0, 211, 0, 211, 218, 78, 272, 0, 0, 0, 0, 78,
+    488, 0, 148, 148, 0, 19, 0, 0, 0, 0, 0, 78, 16, 0, 0, 272,
+    0, 221, 78, 710, 19, 295, 148, 16, 264, 101, 218, 19, 702, 0, 0, 148,
+    0, 19, 815, 0, 0, 148, 0, 0, 721, 0, 165, 148, 0, 246, 695, 291,
+    291, 108, 165, 16, 295, 9, 9, 165, 9, 831, 165, 295, 9, 108, 260, 108,
+    295, 148, 78, 78, 0, 0, 1, 0, 0, 341, 0, 148, 695, 341, 148, 165,
+    148, 221, 165, 695, 0, 0, 272, 0, 125, 0, 0, 0, 0, 0, 0, 221,
+    0, 0, 0, 148, 221, 19, 16, 0, 0, 0, 0, 148, 0, 0, 0, 0,
+    0, 221, 0, 0, 78, 0, 0, 148, 148, 0, 291, 0, 0, 0, 0, 227,
+    0, 16, 221, 0, 272, 272, 16, 16, 0, 0, 218, 0, 0, 0, 0, 16,
+    0, 16, 125, 0, 0, 0, 0, 0, 148, 148, 0, 221, 16, 16, 221, 0,
+    78, 291, 710, 281, 148, 272, 0, 19, 0, 373, 0, 9, 0, 392, 0, 78,
+    148, 148, 9, 16, 0, 101, 221, 215, 125, 0, 156, 1287, 165, 221, 1, 710,
+    1, 9, 295, 0, 148, 1, 165, 221, 9, 0, 291, 12, 165, 295, 408, 165,
+    12, 165, 295, 713, 78, 373, 246, 0, 221, 0, 0, 218, 0, 0, 148, 148,
+    0, 221, 699, 721, 688, 0, 0, 0, 0, 221, 0, 0, 387, 0, 291, 0,
+    0, 221, 221, 0, 0, 148, 148, 0, 44, 19, 148, 0, 0, 0, 0, 0,
+    0, 0, 272, 0, 0, 19, 125, 0, 0, 125, 0, 0, 0, 0, 0, 117,
+    0, 387, 19, 44, 0, 272, 0, 0, 125, 16, 117, 16, 0, 688, 0, 0,
+    148, 0, 0, 148, 0, 0, 125, 148, 19, 0, 16, 0, 272, 0, 1294, 0,
+    0, 0, 0, 0, 0, 227, 788, 19, 0, 0, 0, 44, 0, 0, 0, 721,
+    218, 0, 0, 78, 125, 44, 44, 218, 0, 0, 0, 0, 710, 688, 0, 0,
+    227, 0, 0, 0, 0, 260, 0, 78, 221, 125, 0, 227, 19, 272, 0, 895,
+    699, 688, 148, 148, 165, 105, 78, 148, 0, 16, 148, 101, 105, 105, 9, 165,
+    9, 12, 12, 105, 101, 105, 27, 1299, 27, 125, 9, 218, 105, 105, 105, 148,
+    525, 218, 221, 78, 78, 0, 0, 341, 125, 732, 125, 0, 0, 387, 221, 16,
+    16, 221, 16, 272, 0, 0, 0, 117, 221, 0, 19, 0, 0, 78, 16, 272,
+    19, 0, 0, 272, 272, 16, 16, 16, 16, 165, 148, 165, 27, 148, 0, 0,
+    148, 16, 105, 173, 105, 227, 488, 0, 78, 0, 78, 291, 227, 488, 488, 299,
+    117, 148, 148, 0, 9, 9, 101, 9, 0, 9, 16, 9, 9, 224, 19, 0,
+    1306, 844, 148, 156, 19, 0, 9, 291, 78, 221, 78, 0, 221, 706, 224, 215,
+    227, 1, 0, 218, 218, 227, 218, 227, 710, 1, 227, 691, 0, 125, 125, 0,
+    0, 78, 148, 125, 1294, 0, 713, 0, 125, 101, 218, 9, 101, 0, 16, 224,
+    16, 78, 227, 44, 125, 224, 125, 221, 317, 317, 0, 19, 387, 272, 387, 272,
+    0, 101, 91, 387, 0, 341, 0, 0, 246, 148, 246, 688, 695, 148, 0, 695,
+    78, 78, 44, 78, 44, 0, 0, 0, 0, 78, 221, 0, 78, 78, 272, 272,
+    218, 0, 272, 0, 0, 0, 148, 0, 699, 78, 148, 224, 0, 291, 0, 0,
+    125, 0, 125, 0, 0, 125, 227, 0, 78, 0, 148, 148, 41, 0, 0, 148,
+    41, 341, 0, 0, 387, 691, 0, 0, 0, 0, 78, 44, 215, 16, 1, 688,
+    19, 161, 0, 691, 78, 218, 0, 0, 295, 224, 148, 19, 0, 148, 341, 0,
+    710, 0, 148, 117, 317, 0, 0, 0, 0, 246, 44, 148, 105, 272, 0, 688,
+    227, 779, 0, 148, 0, 246, 227, 710, 0, 148, 246, 0, 695, 0, 165, 0,
+    78, 148, 0, 0, 0, 0, 148, 227, 0, 291, 0, 264, 0, 815, 0, 0,
+    148, 148, 19, 16, 0, 0, 0, 272, 0, 0, 125, 272, 16, 272, 272, 16,
+    0, 215, 0, 706, 0, 125, 0, 78, 221, 165, 260, 0, 78, 78, 16, 0,
+    291, 218, 125, 0, 19, 0, 0, 148, 0, 0, 227, 0, 317, 125, 16, 218,
+    0, 221, 713, 0, 0, 148, 0, 224, 691, 0, 246, 0, 0, 215, 0, 41,
+    710, 0, 0, 291, 125, 16, 0, 0, 218, 710, 227, 0, 0, 732, 227, 0,
+    78, 0, 148, 0, 9, 125, 9, 0, 19, 148, 246, 148, 148, 218, 44, 695,
+    148, 341, 0, 732, 148, 0, 0, 710, 0, 0, 1311, 9, 1, 12, 19, 12,
+    1, 9, 12, 0, 9, 246, 16, 0, 0, 148, 148, 125, 1008, 0, 688, 0,
+    260, 78, 0, 0, 44, 41, 246, 9, 308, 78, 16, 9, 1, 285, 0, 121,
+    0, 1, 148, 0, 78, 9, 1, 0, 9, 12, 221, 9, 148, 9, 105, 9,
+    0, 0, 41, 900, 9, 0, 218, 9, 9, 221, 387, 0, 299, 0, 221, 0,
+    0, 0, 272, 0, 272, 0, 0, 264, 0, 0, 0, 148, 148, 9, 9, 9,
+    0, 105, 0, 1316, 9, 9, 291, 224, 221, 0, 0, 0, 0, 0, 0, 0,
+    78, 1323, 272, 0, 0, 0, 608, 125, 272, 224, 291, 78, 264, 78, 78, 78,
+    78, 0, 0, 0, 0, 0, 0, 0, 148, 148, 19, 0, 488, 299, 16, 291,
+    0, 19, 78, 688, 227, 260, 0, 148, 227, 0, 148, 221, 0, 148, 117, 148,
+    44, 215, 215, 156, 156, 215, 148, 0, 699, 0, 148, 0, 117, 0, 0, 0,
+    0, 815, 148, 246, 44, 227, 0, 246, 0, 0, 0, 0, 16, 19, 211, 0,
+    272, 272, 125, 125, 0, 221, 272, 16, 227, 0, 125, 0, 0, 221, 125, 260,
+    16, 148, 16, 387, 148, 710, 710, 0, 0, 227, 0, 78, 0, 0, 0, 0,
+    0, 0, 227, 227, 0, 227, 0, 246, 0, 221, 246, 0, 922, 268, 44, 78,
+    0, 0, 0, 688, 710, 0, 0, 291, 165, 691, 969, 9, 125, 695, 0, 125,
+    713, 308, 0, 0, 721, 0, 272, 0, 688, 19, 78, 91, 19, 78, 19, 268,
+    0, 165, 302, 291, 41, 9, 165, 246, 0, 218, 0, 710, 710, 0, 710, 9,
+    9, 178, 0, 0, 688, 688, 0, 224, 41, 9, 65, 218, 0, 41, 9, 0,
+    691, 0, 178, 1184, 9, 0, 218, 221, 291, 0, 44, 227, 224, 1328, 513, 41,
+    513, 12, 0, 0, 224, 224, 699, 41, 41, 148, 27, 9, 41, 16, 9, 0,
+    9, 165, 815, 710, 165, 0, 218, 0, 0, 165, 341, 0, 0, 0, 0, 341,
+    0, 0, 78, 688, 19, 0, 0, 0, 165, 0, 41, 688, 0, 341, 41, 291,
+    0, 1333, 148, 224, 272, 16, 16, 19, 272, 19, 0, 608, 272, 105, 16, 16,
+    221, 0, 775, 0, 44, 387, 0, 221, 0, 0, 78, 78, 260, 16, 19, 44,
+    78, 78, 78, 78, 16, 16, 272, 688, 0, 0, 1340, 1, 12, 0, 0, 0,
+    0, 16, 16, 9, 0, 224, 218, 165, 105, 710, 695, 0, 218, 688, 710, 19,
+    148, 165, 78, 78, 165, 0, 165, 0, 165, 0, 895, 0, 78, 148, 0, 78,
+    9, 221, 291, 221, 0, 0, 108, 1, 0, 215, 221, 101, 227, 221, 215, 691,
+    101, 9, 308, 215, 221, 165, 148, 78, 165, 0, 0, 78, 0, 691, 0, 9,
+    688, 19, 0, 19, 148, 78, 0, 710, 218, 0, 688, 0, 148, 165, 221, 0,
+    0, 341, 165, 78, 272, 0, 16, 19, 218, 19, 0, 1346, 0, 19, 1351, 0,
+    16, 19, 78, 260, 16, 0, 260, 1356, 264, 221, 78, 373, 775, 41, 41, 9,
+    9, 165, 1360, 9, 41, 41, 0, 101, 41, 224, 9, 713, 0, 713, 41, 165,
+    9, 1367, 308, 165, 0, 0, 41, 41, 41, 41, 165, 41, 165, 41, 41, 41,
+    9, 9, 19, 148, 19, 44, 125, 0, 148, 117, 44, 148, 125, 125, 125, 105,
+    148, 148, 221, 264, 1233, 488, 775, 0, 0, 105, 775, 0, 0, 1371, 0, 221,
+    215, 221, 44, 224, 19, 19, 0, 0, 148, 148, 341, 0, 0, 9, 0, 105,
+    221, 221, 105, 148, 0, 221, 246, 281, 221, 721, 224, 0, 688, 0, 246, 148,
+    44, 695, 148, 691, 0, 0, 41, 148, 9, 9, 78, 272, 0, 0, 9, 0,
+    9, 9, 9, 187, 9, 0, 156, 1184, 9, 101, 41, 9, 16, 16, 148, 0,
+    16, 215, 688, 0, 165, 165, 0, 165, 165, 446, 1008, 148, 0, 688, 218, 0,
+    0, 9, 0, 105, 148, 16, 41, 0, 590, 1, 112, 105, 78, 9, 0, 101,
+    78, 9, 1377, 0, 0, 0, 9, 165, 215, 900, 695, 308, 0, 215, 0, 0,
+    0, 215, 125, 246, 165, 148, 0, 0, 16, 16, 9, 0, 12, 0, 9, 0,
+    0, 9, 0, 0, 0, 105, 12, 0, 0, 12, 9, 9, 0, 41, 9, 0,
+    9, 9, 0, 0, 645, 9, 16, 851, 0, 16, 688, 9, 9, 215, 221, 0,
+    0, 0, 0, 215, 227, 0, 0, 9, 221, 224, 0, 105, 105, 0, 0, 9,
+    1095, 165, 165, 105, 0, 0, 721, 125, 272, 125, 0, 148, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 148, 148, 0, 0, 0,
+    0, 341, 0, 148, 224, 224, 224, 0, 321, 218, 218, 218, 881, 0, 227, 148,
+    16, 272, 387, 0, 19, 0, 125, 16, 0, 922, 0, 0, 0, 125, 775, 0,
+    0, 0, 16, 125, 19, 0, 44, 44, 211, 291, 291, 0, 78, 221, 272, 688,
+    221, 0, 332, 0, 341, 341, 227, 0, 0, 0, 165, 78, 105, 9, 165, 165,
+    165, 105, 165, 165, 0, 27, 78, 0, 0, 148, 881, 341, 148, 16, 16, 9,
+    16, 0, 9, 0, 165, 1, 0, 0, 332, 105, 16, 0, 9, 221, 9, 0,
+    16, 78, 16, 9, 688, 215, 105, 0, 0, 16, 0, 0, 234, 215, 16, 0,
+    0, 408, 0, 165, 148, 165, 165, 0, 0, 0, 0, 16, 148, 19, 78, 165,
+    9, 0, 105, 165, 308, 688, 12, 12, 688, 12, 1, 0, 1, 1, 12, 221,
+    19, 0, 0, 1281, 1, 12, 392, 308, 148, 0, 165, 0, 0, 9, 0, 165,
+    0, 0, 0, 0, 691, 9, 0, 12, 105, 108, 0, 0, 148, 9, 9, 125,
+    0, 117, 78, 0, 0, 0, 211, 44, 125, 608, 0, 125, 0, 44, 44, 0,
+    148, 341, 148, 224, 721, 387, 272, 272, 0, 272, 0, 0, 0, 0, 387, 117,
+    0, 0, 1383, 0, 0, 0, 0, 0, 148, 260, 16, 260, 260, 260, 362, 125,
+    78, 272, 0, 0, 0, 0, 0, 78, 264, 78, 0, 78, 78, 272, 16, 0,
+    125, 16, 299, 9, 9, 0, 9, 9, 706, 9, 9, 221, 9, 0, 227, 78,
+    0, 19, 0, 0, 0, 0, 44, 0, 341, 19, 0, 0, 0, 19, 341, 0,
+    0, 341, 148, 218, 0, 148, 105, 0, 408, 227, 105, 0, 0, 148, 0, 148,
+    9, 0, 9, 9, 221, 221, 1, 291, 12, 0, 12, 0, 105, 105, 9, 0,
+    12, 12, 9, 12, 148, 221, 0, 0, 0, 0, 125, 732, 125, 165, 732, 221,
+    367, 688, 0, 408, 0, 272, 0, 148, 0, 0, 0, 16, 125, 713, 0, 125,
+    272, 0, 0, 148, 148, 373, 16, 125, 125, 0, 16, 125, 0, 0, 0, 0,
+    148, 148, 0, 148, 0, 0, 1386, 246, 0, 148, 221, 0, 272, 16, 148, 125,
+    0, 272, 0, 0, 221, 125, 125, 125, 0, 221, 699, 221, 0, 0, 0, 16,
+    272, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 16, 0, 148, 0, 0,
+    0, 0, 0, 227, 78, 291, 221, 148, 221, 125, 0, 0, 224, 221, 0, 0,
+    16, 78, 78, 215, 0, 0, 221, 272, 0, 299, 450, 148, 215, 16, 16, 125,
+    125, 148, 0, 272, 272, 291, 264, 221, 291, 291, 291, 291, 19, 221, 9, 221,
+    41, 0, 9, 0, 0, 260, 9, 78, 105, 221, 165, 227, 105, 165, 148, 78,
+    19, 221, 78, 0, 0, 218, 9, 105, 0, 9, 0, 9, 218, 105, 0, 165,
+    105, 165, 688, 0, 19, 317, 19, 9, 41, 9, 0, 9, 0, 148, 0, 221,
+    78, 291, 281, 0, 0, 0, 108, 0, 78, 0, 0, 218, 0, 78, 148, 165,
+    0, 408, 148, 0, 16, 44, 0, 699, 78, 218, 148, 0, 0, 0, 148, 0,
+    0, 148, 125, 0, 0, 0, 691, 0, 0, 218, 0, 148, 148, 19, 0, 387,
+    148, 0, 148, 78, 0, 0, 221, 272, 0, 221, 0, 0, 221, 0, 0, 0,
+    125, 215, 148, 148, 0, 148, 148, 0, 0, 215, 0, 211, 215, 775, 0, 0,
+    125, 488, 0, 0, 0, 0, 246, 148, 125, 44, 148, 125, 211, 0, 125, 0,
+    0, 272, 260, 125, 0, 0, 19, 0, 272, 0, 0, 717, 125, 0, 0, 0,
+    713, 688, 0, 0, 0, 78, 260, 0, 0, 125, 16, 688, 0, 0, 148, 1174,
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 272, 0,
+    224, 78, 0, 0, 0, 895, 710, 221, 0, 0, 148, 148, 710, 221, 0, 246,
+    165, 12, 165, 19, 108, 108, 108, 148, 108, 0, 108, 105, 12, 9, 221, 27,
+    0, 81, 0, 27, 12, 105, 105, 0, 108, 105, 9, 78, 227, 1391, 148, 221,
+    0, 148, 0, 710, 218, 1396, 246, 0, 341, 148, 0, 218, 0, 125, 0, 0,
+    16, 125, 0, 0, 0, 0, 16, 16, 0, 221, 0, 0, 19, 0, 721, 148,
+    260, 0, 78, 148, 0, 0, 0, 16, 0, 148, 19, 165, 165, 165, 16, 78,
+    19, 148, 688, 0, 0, 105, 105, 221, 105, 9, 246, 148, 9, 78, 221, 1,
+    165, 16, 227, 16, 41, 165, 105, 19, 0, 0, 227, 105, 218, 105, 148, 125,
+    148, 105, 0, 148, 108, 221, 27, 0, 16, 12, 12, 22, 165, 44, 108, 268,
+    16, 165, 221, 12, 0, 224, 121, 16, 1179, 688, 224, 148, 221, 165, 105, 105,
+    295, 608, 165, 165, 0, 165, 1, 165, 0, 1, 165, 0, 0, 408, 27, 1401,
+    0, 16, 91, 101, 608, 295, 0, 0, 101, 165, 0, 101, 156, 101, 101, 0,
+    108, 9, 44, 148, 148, 218, 165, 308, 165, 108, 295, 16, 0, 0, 16, 0,
+    0, 125, 16, 105, 1386, 221, 12, 36, 36, 0, 27, 221, 0, 125, 302, 101,
+    9, 221, 148, 0, 165, 165, 165, 302, 9, 0, 165, 0, 9, 9, 148, 148,
+    0, 0, 0, 9, 9, 9, 9, 9, 108, 105, 0, 105, 105, 9, 221, 9,
+    9, 9, 0, 9, 215, 0, 0, 0, 105, 9, 0, 105, 1407, 215, 9, 0,
+    9, 16, 0, 295, 0, 717, 0, 0, 78, 0, 0, 408, 0, 81, 0, 881,
+    148, 0, 0, 695, 218, 108, 224, 0, 148, 224, 227, 0, 0, 218, 0, 227,
+    218, 246, 0, 9, 12, 0, 0, 27, 0, 16, 1, 12, 295, 0, 105, 16,
+    341, 295, 0, 0, 0, 16, 0, 16, 688, 221, 221, 0, 108, 215, 165, 16,
+    0, 0, 16, 308, 295, 148, 165, 0, 732, 0, 221, 0, 215, 0, 688, 0,
+    0, 691, 1, 165, 695, 0, 0, 0, 0, 78, 1413, 1, 0, 1, 590, 264,
+    0, 78, 0, 0, 221, 121, 0, 0, 148, 165, 165, 27, 0, 317, 408, 9,
+    0, 16, 16, 105, 0, 105, 0, 0, 0, 0, 295, 0, 105, 0, 165, 165,
+    16, 224, 108, 108, 105, 295, 0, 308, 148, 9, 0, 0, 260, 9, 0, 0,
+    895, 0, 815, 0, 224, 246, 0, 0, 0, 246, 246, 721, 246, 218, 695, 148,
+    341, 0, 221, 165, 1, 165, 12, 0, 165, 264, 12, 12, 0, 12, 415, 0,
+    12, 12, 12, 12, 710, 710, 9, 165, 148, 295, 815, 0, 121, 246, 695, 308,
+    148, 0, 0, 221, 148, 721, 881, 108, 125, 0, 108, 0, 108, 108, 108, 0,
+    0, 105, 165, 105, 295, 295, 295, 125, 105, 227, 165, 0, 108, 105, 105, 105,
+    108, 0, 105, 105, 108, 125, 108, 688, 0, 105, 713, 125, 165, 0, 16, 0,
+    308, 125, 0, 125, 125, 125, 295, 695, 0, 0, 221, 710, 224, 0, 56, 101,
+    1419, 105, 108, 78, 121, 165, 224, 121, 165, 0, 12, 165, 78, 165, 165, 78,
+    0, 291, 96, 221, 221, 710, 0, 9, 12, 165, 218, 1, 101, 688, 0, 19,
+    0, 148, 165, 0, 44, 16, 534, 105, 27, 27, 0, 165, 688, 1, 211, 105,
+    0, 9, 9, 0, 221, 0, 9, 0, 0, 9, 295, 165, 101, 9, 0, 0,
+    695, 0, 105, 308, 9, 125, 0, 16, 1424, 376, 108, 165, 9, 108, 105, 105,
+    295, 108, 105, 9, 105, 9, 16, 108, 105, 0, 9, 0, 108, 0, 105, 0,
+    0, 0, 0, 295, 0, 165, 0, 9, 9, 165, 0, 9, 9, 308, 9, 9,
+    165, 9, 9, 0, 0, 0, 0, 221, 0, 0, 0, 0, 272, 0, 0, 0,
+    0, 227, 0, 0, 215, 688, 215, 16, 0, 19, 227, 0, 0, 125, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 710, 125, 215, 0, 0, 125,
+    0, 0, 0, 0, 221, 221, 148, 125, 0, 0, 125, 0, 125, 0, 148, 9,
+    165, 0, 148, 308, 0, 9, 308, 9, 0, 0, 41, 0, 0, 0, 0, 0,
+    0, 105, 105, 0, 0, 608, 9, 295, 41, 16, 16, 9, 9, 0, 9, 1430,
+    101, 295, 19, 16, 105, 0, 260, 78, 16, 9, 9, 0, 0, 65, 9, 101,
+    69, 65, 0, 9, 0, 608, 105, 0, 9, 9, 0, 0, 9, 41, 9, 0,
+    0, 105, 105, 0, 0, 0, 0, 105, 9, 9, 41, 0, 0, 0, 0, 41,
+    0, 41, 41, 224, 41, 0, 308, 9, 165, 9, 165, 260, 0, 0, 0, 9,
+    65, 9, 0, 105, 65, 105, 105, 165, 165, 105, 105, 590, 0, 0, 0, 101,
+    9, 165, 9, 41, 165, 0, 41, 19, 760, 105, 44, 0, 148, 78, 19, 0,
+    291, 218, 341, 16, 9, 0, 165, 717, 295, 0, 0, 165, 12, 0, 44, 27,
+    0, 27, 12, 12, 9, 9, 695, 148, 710, 165, 12, 1, 341, 1, 291, 44,
+    78, 0, 0, 688, 105, 105, 105, 105, 44, 108, 105, 0, 108, 16, 105, 105,
+    295, 108, 108, 27, 108, 295, 165, 105, 0, 408, 105, 0, 12, 9, 0, 105,
+    9, 105, 0, 9, 0, 105, 101, 483, 105, 101, 105, 105, 0, 165, 1, 9,
+    0, 721, 1, 0, 121, 291, 1437, 148, 165, 165, 105, 1, 1, 148, 0, 27,
+    539, 81, 0, 0, 291, 713, 0, 224, 317, 22, 0, 12, 0, 0, 9, 295,
+    148, 0, 695, 165, 0, 0, 0, 0, 165, 0, 0, 148, 165, 165, 0, 0,
+    165, 1, 22, 9, 165, 0, 0, 105, 0, 9, 215, 165, 0, 108, 1, 0,
+    1, 9, 1, 0, 0, 0, 36, 78, 215, 9, 148, 0, 0, 148, 9, 9,
+    16, 0, 218, 317, 165, 0, 16, 12, 0, 9, 148, 12, 295, 78, 165, 373,
+    27, 0, 165, 215, 0, 165, 215, 125, 0, 148, 0, 9, 0, 0, 105, 12,
+    165, 1, 165, 0, 105, 105, 27, 0, 0, 0, 224, 125, 125, 221, 218, 125,
+    645, 227, 688, 0, 688, 218, 78, 78, 9, 78, 165, 78, 78, 224, 165, 215,
+    0, 16, 9, 12, 0, 19, 699, 0, 218, 165, 9, 12, 165, 165, 1, 165,
+    165, 165, 165, 0, 688, 295, 688, 9, 148, 1, 218, 0, 710, 165, 425, 1441,
+    1441, 0, 0, 165, 0, 165, 0, 165, 0, 165, 165, 1441, 148, 341, 165, 165,
+    16, 0, 148, 9, 0, 0, 218, 148, 857, 717, 0, 0, 710, 0, 148, 710,
+    691, 0, 0, 0, 148, 218, 78, 221, 9, 22, 0, 688, 308, 215, 0, 165,
+    218, 0, 0, 688, 0, 0, 218, 0, 165, 0, 0, 215, 0, 0, 710, 1448,
+    215, 0, 105, 0, 398, 0, 221, 0, 0, 0, 148, 295, 0, 105, 165, 165,
+    1454, 12, 0, 148, 148, 0, 165, 1460, 22, 22, 105, 0, 12, 0, 0, 0,
+    308, 295, 105, 0, 0, 125, 108, 41, 165, 101, 101, 101, 215, 0, 41, 165,
+    0, 0, 165, 0, 0, 101, 101, 125, 101, 688, 101, 125, 125, 101, 0, 227,
+    101, 1184, 125, 9, 9, 56, 9, 105, 148, 78, 0, 291, 0, 165, 19, 16,
+    0, 0, 0, 710, 9, 341, 19, 1228, 0, 0, 19, 105, 165, 78, 268, 0,
+    0, 0, 0, 0, 0, 0, 148, 227, 0, 0, 165, 0, 78, 710, 148, 148,
+    0, 105, 165, 9, 221, 165, 0, 108, 281, 12, 0, 1, 0, 105, 0, 16,
+    0, 1, 1, 78, 27, 0, 0, 264, 0, 0, 19, 0, 0, 0, 78, 12,
+    148, 12, 710, 0, 148, 221, 550, 19, 78, 250, 0, 0, 0, 341, 732, 148,
+    0, 0, 16, 0, 0, 0, 699, 0, 0, 0, 0, 688, 44, 373, 16, 78,
+    9, 221, 1, 165, 0, 0, 0, 0, 0, 101, 224, 105, 78, 105, 105, 0,
+    9, 0, 9, 165, 341, 0, 688, 0, 0, 78, 165, 0, 0, 0, 165, 483,
+    215, 105, 1, 215, 0, 876, 0, 408, 0, 215, 0, 44, 16, 0, 148, 221,
+    291, 221, 105, 165, 165, 0, 165, 688, 148, 0, 78, 19, 221, 408, 165, 0,
+    0, 308, 0, 590, 165, 408, 0, 0, 0, 583, 56, 9, 105, 105, 101, 165,
+    105, 101, 0, 108, 215, 0, 0, 215, 0, 0, 0, 108, 101, 215, 0, 1448,
+    0, 0, 215, 0, 215, 56, 221, 0, 165, 695, 0, 165, 215, 0, 0, 0,
+    165, 215, 0, 0, 408, 165, 165, 101, 105, 105, 688, 0, 590, 0, 101, 105,
+    408, 9, 165, 0, 105, 0, 0, 105, 108, 9, 583, 165, 165, 165, 0, 101,
+    215, 0, 78, 125, 387, 0, 0, 0, 16, 291, 1464, 16, 148, 0, 0, 387,
+    221, 16, 19, 0, 0, 0, 272, 272, 0, 221, 387, 16, 387, 608, 0, 19,
+    0, 0, 488, 0, 125, 125, 272, 221, 0, 0, 0, 16, 117, 16, 0, 0,
+    16, 0, 0, 1470, 0, 0, 0, 148, 215, 0, 0, 0, 78, 0, 16, 19,
+    0, 19, 148, 19, 148, 775, 0, 148, 224, 775, 0, 0, 0, 125, 0, 0,
+    16, 0, 1245, 78, 260, 0, 215, 0, 0, 0, 0, 227, 0, 78, 0, 0,
+    227, 0, 291, 317, 19, 0, 78, 0, 0, 0, 0, 221, 165, 0, 0, 0,
+    148, 221, 165, 0, 165, 108, 101, 12, 101, 9, 295, 101, 0, 101, 12, 101,
+    165, 12, 12, 165, 101, 0, 0, 12, 165, 121, 125, 108, 12, 12, 0, 227,
+    0, 695, 688, 0, 0, 165, 246, 44, 148, 148, 0, 148, 148, 78, 0, 224,
+    0, 148, 19, 78, 19, 19, 387, 0, 0, 724, 0, 1102, 221, 387, 0, 0,
+    260, 148, 0, 0, 0, 0, 19, 19, 19, 125, 105, 105, 105, 12, 1, 0,
+    165, 0, 148, 9, 0, 105, 9, 9, 165, 105, 9, 1, 0, 165, 0, 165,
+    227, 165, 165, 430, 165, 105, 165, 165, 105, 224, 1, 398, 1, 1, 688, 1,
+    1, 1, 0, 1, 148, 1, 1, 1, 1474, 148, 1, 1, 398, 221, 1, 688,
+    125, 0, 1, 0, 78, 699, 148, 221, 221, 221, 0, 0, 221, 0, 0, 0,
+    148, 44, 0, 125, 0, 78, 0, 16, 16, 260, 0, 44, 0, 0, 341, 148,
+    688, 264, 227, 1, 1, 218, 218, 218, 0, 1137, 0, 0, 1, 227, 227, 218,
+    0, 1137, 0, 695, 0, 713, 0, 688, 0, 0, 148, 16, 78, 125, 148, 820,
+    215, 148, 710, 0, 148, 125, 1480, 125, 688, 0, 117, 710, 148, 0, 779, 688,
+    691, 688, 691, 0, 0, 125, 1079, 0, 0, 695, 0, 0, 691, 341, 221, 148,
+    0, 148, 19, 125, 125, 19, 125, 125, 221, 436, 125, 221, 19, 19, 272, 0,
+    272, 0, 0, 272, 78, 224, 0, 272, 16, 0, 16, 221, 0, 0, 373, 0,
+    0, 0, 691, 16, 272, 272, 387, 0, 387, 272, 0, 272, 19, 19, 125, 19,
+    0, 0, 0, 0, 148, 0, 148, 264, 78, 387, 16, 19, 0, 0, 488, 215,
+    775, 224, 78, 78, 125, 224, 19, 125, 0, 0, 78, 260, 0, 0, 0, 0,
+    16, 0, 0, 691, 227, 19, 0, 148, 19, 227, 0, 250, 246, 148, 44, 19,
+    0, 19, 215, 0, 125, 0, 221, 0, 784, 218, 713, 0, 713, 148, 0, 0,
+    0, 732, 688, 0, 221, 19, 125, 19, 0, 148, 221, 224, 0, 0, 148, 0,
+    272, 0, 224, 0, 221, 19, 221, 0, 78, 148, 0, 78, 291, 148, 691, 221,
+    688, 221, 16, 272, 227, 148, 0, 0, 0, 492, 0, 218, 148, 221, 19, 16,
+    272, 387, 0, 0, 272, 317, 125, 0, 125, 272, 0, 0, 0, 0, 0, 0,
+    19, 0, 260, 0, 0, 0, 0, 0, 0, 0, 260, 387, 272, 9, 41, 148,
+    148, 117, 260, 16, 0, 1485, 78, 9, 148, 41, 9, 41, 9, 0, 41, 0,
+    460, 0, 0, 41, 41, 710, 221, 221, 0, 0, 724, 0, 820, 78, 0, 0,
+    0, 772, 0, 148, 148, 721, 125, 295, 695, 148, 41, 148, 0, 117, 65, 815,
+    0, 0, 0, 0, 691, 0, 688, 688, 1492, 16, 224, 148, 9, 0, 78, 1306,
+    78, 78, 0, 105, 105, 78, 78, 105, 78, 218, 9, 165, 125, 0, 165, 105,
+    291, 221, 148, 125, 876, 710, 125, 1, 1, 1, 688, 699, 148, 16, 645, 148,
+    44, 148, 721, 1480, 0, 0, 446, 44, 16, 0, 0, 387, 0, 78, 260, 0,
+    0, 272, 291, 699, 78, 78, 0, 0, 0, 221, 272, 0, 0, 218, 246, 0,
+    0, 218, 0, 0, 227, 0, 695, 221, 0, 0, 0, 78, 0, 0, 0, 291,
+    0, 881, 78, 0, 0, 0, 0, 0, 0, 9, 0, 78, 0, 0, 710, 815,
+    0, 148, 0, 710, 341, 148, 19, 317, 19, 291, 488, 0, 0, 0, 0, 1464,
+    0, 125, 1294, 272, 272, 0, 125, 0, 0, 16, 125, 16, 0, 0, 0, 78,
+    78, 19, 125, 16, 19, 0, 19, 16, 0, 16, 16, 0, 0, 0, 0, 0,
+    0, 148, 0, 78, 1, 0, 165, 16, 125, 0, 1233, 0, 272, 272, 221, 0,
+    317, 125, 0, 125, 0, 125, 713, 0, 148, 117, 69, 272, 688, 0, 260, 260,
+    16, 16, 16, 0, 0, 0, 125, 0, 0, 710, 0, 0, 78, 0, 0, 0,
+    291, 0, 78, 281, 688, 221, 16, 224, 0, 0, 0, 341, 19, 16, 16, 688,
+    710, 16, 0, 272, 148, 221, 78, 19, 224, 221, 148, 9, 9, 9, 9, 1,
+    12, 815, 0, 246, 0, 0, 732, 695, 341, 78, 78, 0, 78, 9, 16, 9,
+    688, 78, 1, 78, 78, 78, 78, 9, 0, 221, 78, 78, 0, 78, 78, 218,
+    0, 691, 688, 710, 695, 78, 218, 688, 0, 710, 695, 78, 285, 285, 0, 699,
+    148, 78, 732, 78, 0, 0, 148, 148, 713, 341, 0, 0, 148, 688, 44, 472,
+    925, 12, 78, 710, 291, 291, 148, 221, 699, 16, 148, 224, 78, 0, 148, 221,
+    0, 218, 688, 218, 78, 688, 218, 710, 221, 16, 1, 0, 0, 148, 9, 9,
+    9, 0, 0, 41, 0, 373, 246, 78, 0, 0, 9, 0, 0, 78, 713, 688,
+    0, 165, 78, 0, 125, 9, 41, 0, 617, 41, 0, 78, 221, 78, 218, 78,
+    341, 0, 246, 148, 246, 0, 0, 721, 148, 341, 0, 732, 44, 815, 246, 218,
+    0, 0, 0, 9, 0, 0, 695, 165, 0, 0, 0, 0, 0, 0, 713, 691,
+    0, 0, 291, 0, 779, 0, 688, 0, 0, 9, 0, 0, 221, 0, 148, 617,
+    341, 44, 9, 0, 0, 0, 9, 41, 218, 0, 41, 0, 221, 0, 9, 0,
+    0, 218, 688, 721, 0, 281, 148, 41, 78, 0, 221, 78, 0, 0, 41, 0,
+    218, 218, 246, 688, 0, 732, 218, 0, 0, 0, 0, 221, 105, 0, 221, 0,
+    9, 221, 0, 0, 0, 41, 0, 19, 221, 710, 804, 16, 1, 295, 16, 691,
+    16, 16, 9, 688, 688, 0, 688, 121, 44, 218, 0, 148, 341, 691, 148, 221,
+    148, 900, 148, 691, 218, 148, 161, 710, 688, 0, 125, 125, 0, 387, 0, 272,
+    0, 0, 272, 688, 16, 0, 215, 0, 0, 272, 272, 125, 710, 16, 1, 16,
+    221, 1, 260, 16, 218, 710, 224, 16, 713, 221, 125, 148, 925, 218, 317, 387,
+    221, 125, 688, 16, 19, 272, 272, 224, 710, 0, 0, 0, 699, 148, 224, 224,
+    721, 221, 224, 1, 16, 1496, 19, 387, 272, 272, 218, 221, 227, 0, 148, 0,
+    721, 44, 19, 221, 224, 78, 78, 117, 272, 16, 16, 699, 688, 691, 218, 78,
+    0, 0, 105, 165, 16, 534, 9, 78, 9, 0, 295, 9, 710, 0, 44, 165,
+    9, 9, 295, 0, 148, 710, 221, 148, 165, 321, 101, 165, 125, 12, 0, 227,
+    688, 0, 0, 0, 721, 12, 121, 710, 221, 78, 1501, 688, 12, 1043, 165, 341,
+    218, 0, 0, 0, 710, 341, 688, 688, 341, 0, 12, 408, 0, 0, 0, 218,
+    246, 0, 0, 0, 224, 295, 0, 0, 0, 0, 0, 0, 0, 0, 295, 12,
+    0, 688, 0, 0, 12, 12, 0, 227, 148, 0, 0, 148, 9, 22, 148, 0,
+    0, 12, 19, 0, 0, 16, 721, 78, 0, 0, 0, 0, 0, 19, 221, 688,
+    9, 702, 12, 221, 12, 1, 0, 12, 0, 224, 0, 9, 12, 688, 22, 0,
+    291, 0, 710, 19, 1396, 0, 227, 221, 125, 148, 702, 0, 695, 0, 9, 78,
+    295, 12, 688, 0, 221, 272, 0, 0, 148, 0, 0, 0, 78, 78, 78, 125,
+    125, 125, 0, 0, 710, 148, 1179, 0, 0, 1507, 148, 0, 12, 78, 12, 221,
+    12, 0, 9, 9, 221, 9, 9, 12, 221, 0, 221, 710, 710, 1, 9, 12,
+    9, 0, 78, 264, 12, 12, 12, 12, 12, 0, 224, 224, 218, 1, 9, 9,
+    9, 9, 1, 234, 12, 9, 9, 0, 12, 12, 12, 12, 16, 224, 0, 0,
+    0, 16, 1, 9, 1, 0, 148, 695, 488, 44, 272, 699, 881, 0, 78, 12,
+    9, 295, 9, 227, 148, 148, 12, 1480, 0, 148, 148, 0, 0, 218, 0, 0,
+    218, 1, 392, 0, 0, 815, 224, 721, 710, 688, 19, 1, 9, 1, 1, 218,
+    16, 0, 0, 1, 717, 272, 224, 148, 721, 44, 291, 702, 227, 0, 218, 44,
+    0, 775, 0, 19, 227, 291, 78, 78, 41, 0, 78, 1, 0, 1, 0, 16,
+    44, 688, 148, 710, 341, 0, 148, 78, 0, 0, 0, 0, 221, 221, 148, 713,
+    227, 688, 285, 1200, 148, 0, 291, 246, 148, 221, 1511, 446, 341, 221, 0, 0,
+    148, 148, 341, 44, 44, 0, 0, 272, 387, 148, 221, 148, 148, 221, 78, 0,
+    78, 221, 0, 0, 221, 19, 19, 221, 78, 688, 148, 0, 148, 224, 148, 706,
+    78, 148, 148, 218, 881, 0, 218, 117, 240, 221, 148, 246, 221, 41, 44, 218,
+    227, 227, 691, 221, 688, 19, 246, 0, 815, 218, 0, 341, 246, 148, 0, 44,
+    0, 148, 246, 148, 721, 78, 218, 148, 218, 1061, 221, 78, 699, 101, 9, 291,
+    125, 125, 125, 148, 0, 221, 148, 0, 0, 260, 227, 16, 221, 125, 0, 227,
+    0, 721, 148, 148, 0, 0, 724, 1516, 710, 78, 125, 0, 19, 19, 44, 0,
+    19, 224, 246, 710, 227, 78, 0, 78, 78, 78, 221, 0, 221, 78, 78, 148,
+    699, 218, 732, 246, 148, 272, 272, 387, 272, 713, 0, 0, 246, 148, 16, 148,
+    221, 688, 221, 78, 221, 0, 0, 19, 0, 125, 341, 148, 717, 78, 148, 78,
+    724, 148, 148, 710, 721, 148, 218, 0, 0, 721, 215, 246, 1, 218, 0, 0,
+    0, 0, 221, 221, 0, 272, 0, 688, 148, 0, 16, 0, 0, 732, 272, 0,
+    19, 16, 688, 0, 0, 19, 78, 78, 221, 291, 19, 0, 221, 224, 488, 0,
+    815, 0, 0, 148, 688, 148, 0, 0, 272, 272, 148, 148, 218, 0, 0, 246,
+    78, 78, 78, 0, 148, 688, 148, 218, 148, 272, 387, 148, 148, 0, 221, 688,
+    688, 78, 78, 78, 78, 0, 224, 221, 0, 341, 148, 0, 717, 691, 224, 881,
+    227, 218, 246, 341, 221, 446, 148, 691, 0, 272, 218, 224, 0, 0, 148, 291,
+    148, 710, 218, 227, 721, 688, 0, 218, 0, 0, 1520, 221, 1524, 1527, 699, 0,
+    0, 227, 0, 1524, 688, 218, 0, 0, 699, 691, 0, 0, 221, 0, 0, 221,
+    1531, 224, 218, 1524, 1531, 1534, 1524, 0, 688, 695, 691, 0, 0, 224, 699, 1531,
+    702, 0, 706, 0, 0, 0, 1537, 0, 221, 1531, 218, 0, 0, 0, 218, 688,
+    218, 224, 221, 710, 227, 1527, 1527, 721, 699, 691, 721, 1531, 1524, 221, 1520, 706,
+    224, 218, 221, 221, 721, 0, 221, 1065, 224, 0, 706, 721, 224, 221, 221, 0,
+    0, 724, 1524, 0, 0, 221, 0, 0, 721, 0, 0, 0, 218, 922, 218, 1540,
+    218, 0, 0, 0, 1537, 688, 221, 221, 721, 0, 688, 0, 1527, 218, 0, 695,
+    691, 695, 691, 218, 710, 695, 1531, 0, 0, 1527, 0, 218, 218, 0, 0, 0,
+    218, 721, 1524, 699, 0, 224, 0, 218, 691, 218, 1537, 1537, 706, 218, 218, 0,
+    0, 1537, 0, 1531, 218, 218, 1531, 224, 0, 691, 721, 0, 0, 0, 221, 1520,
+    0, 0, 710, 218, 710, 221, 710, 1534, 691, 218, 218, 0, 1524, 0, 688, 221,
+    0, 218, 688, 0, 688, 227, 1531, 695, 224, 699, 0, 1524, 710, 710, 0, 0,
+    1531, 702, 221, 713, 0, 218, 218, 1531, 224, 1524, 0, 218, 218, 688, 0, 0,
+    1544, 0, 0, 0, 1537, 0, 224, 0, 218, 695, 221, 721, 1527, 0, 0, 0,
+    218, 0, 1537, 699, 0, 0, 0, 218, 221, 221, 710, 721, 218, 227, 218, 224,
+    699, 1531, 1531, 0, 0, 688, 0, 0, 0, 0, 218, 721, 706, 221, 713, 1534,
+    0, 218, 721, 227, 224, 221, 0, 1524, 1524, 0, 0, 224, 221, 0, 688, 218,
+    218, 1537, 1537, 710, 710, 691, 0, 0, 695, 717, 728, 1537, 710, 925, 0, 0,
+    0, 0, 0, 0, 1527, 1534, 0, 0, 0, 0, 0, 1531, 721, 0, 221, 0,
+    0, 688, 78, 148, 19, 148, 9, 9, 19, 695, 19, 19, 1548, 0, 41, 16,
+    125, 980, 980, 980, 713, 0, 19, 695, 215, 125, 215, 550, 9, 16, 44, 44,
+    41, 688, 1, 0, 218, 218, 1501, 227, 16, 0, 16, 125, 227, 1147, 9, 0,
+    695, 0, 0, 218, 0, 0, 724, 0, 0, 0, 717, 1, 125, 16, 221, 0,
+    710, 19, 125, 221, 1531, 227, 691, 710, 218, 0, 0, 224, 250, 78, 78, 0,
+    44, 713, 0, 16, 78, 148, 900, 0, 148, 784, 0, 148, 148, 0, 0, 108,
+    0, 16, 0, 702, 706, 0, 0, 44, 44, 44, 44, 78, 291, 44, 0, 0,
+    0, 19, 78, 16, 227, 1553, 446, 0, 0, 218, 699, 721, 78, 218, 0, 148,
+    0, 710, 0, 0, 221, 0, 0, 900, 341, 148, 148, 688, 0, 0, 0, 272,
+    19, 815, 148, 221, 9, 9, 224, 9, 9, 9, 105, 148, 19, 78, 19, 105,
+    16, 19, 19, 125, 78, 125, 148, 250, 16, 19, 19, 713, 44, 721, 78, 165,
+    0, 148, 218, 148, 0, 688, 0, 224, 221, 117, 488, 295, 108, 165, 0, 16,
+    148, 0, 19, 105, 272, 272, 272, 0, 260, 19, 1559, 272, 0, 1174, 16, 78,
+    148, 78, 165, 148, 19, 0, 19, 272, 19, 1537, 148, 148, 41, 710, 148, 341,
+    341, 815, 341, 78, 44, 165, 0, 0, 78, 148, 0, 148, 148, 148, 148, 0,
+    0, 221, 221, 19, 19, 165, 148, 1524, 78, 0, 78, 0, 148, 148, 341, 78,
+    227, 0, 0, 148, 148, 227, 0, 148, 732, 246, 0, 19, 148, 148, 0, 16,
+    0, 691, 272, 16, 728, 215, 44, 9, 0, 148, 148, 148, 688, 148, 148, 9,
+    9, 1565, 699, 156, 0, 44, 148, 44, 0, 341, 44, 148, 1570, 1570, 44, 1537,
+    19, 0, 732, 44, 299, 224, 1573, 224, 78, 9, 1209, 0, 218, 0, 0, 688,
+    341, 0, 221, 0, 221, 341, 148, 78, 165, 215, 221, 0, 148, 0, 105, 0,
+    19, 9, 218, 0, 0, 41, 148, 341, 9, 41, 41, 341, 0, 9, 148, 218,
+    1306, 9, 0, 0, 218, 488, 488, 264, 215, 148, 341, 148, 148, 9, 0, 148,
+    148, 218, 0, 820, 218, 148, 218, 218, 688, 9, 165, 41, 148, 44, 0, 702,
+    221, 125, 78, 0, 78, 227, 0, 41, 224, 246, 165, 78, 9, 0, 1531, 0,
+    41, 710, 148, 1043, 148, 148, 165, 41, 9, 0, 250, 78, 78, 78, 218, 211,
+    125, 125, 272, 272, 260, 221, 148, 246, 148, 105, 0, 9, 9, 9, 246, 218,
+    218, 9, 9, 148, 688, 148, 148, 0, 19, 19, 19, 125, 1534, 16, 16, 56,
+    299, 0, 691, 688, 16, 1577, 16, 16, 16, 148, 218, 221, 78, 691, 0, 78,
+    0, 1520, 19, 221, 148, 341, 0, 148, 0, 148, 148, 224, 148, 695, 221, 0,
+    0, 148, 78, 341, 165, 341, 341, 0, 221, 148, 148, 221, 44, 0, 221, 218,
+    341, 246, 1583, 246, 148, 9, 0, 148, 218, 0, 0, 9, 125, 148, 0, 706,
+    78, 710, 260, 0, 211, 16, 9, 125, 19, 19, 299, 224, 702, 0, 78, 688,
+    19, 721, 0, 78, 215, 148, 221, 0, 0, 0, 78, 148, 148, 78, 0, 78,
+    78, 78, 1, 0, 44, 221, 221, 0, 44, 78, 78, 44, 0, 218, 0, 78,
+    688, 19, 19, 19, 19, 148, 78, 125, 0, 19, 295, 295, 224, 0, 0, 1531,
+    0, 221, 0, 78, 211, 1137, 218, 0, 215, 1524, 221, 221, 721, 105, 0, 0,
+    165, 221, 19, 710, 16, 78, 260, 44, 78, 0, 0, 165, 44, 446, 0, 44,
+    44, 105, 246, 148, 221, 373, 78, 246, 710, 341, 341, 148, 148, 148, 710, 148,
+    148, 148, 148, 148, 221, 0, 148, 0, 78, 721, 227, 9, 9, 0, 227, 148,
+    0, 41, 0, 9, 221, 105, 105, 105, 221, 688, 0, 148, 0, 1587, 148, 148,
+    148, 44, 44, 148, 0, 341, 0, 148, 0, 9, 446, 9, 0, 148, 148, 227,
+    148, 0, 0, 695, 688, 9, 688, 1386, 0, 0, 44, 341, 125, 0, 16, 148,
+    341, 0, 0, 1520, 699, 12, 0, 341, 148, 148, 148, 341, 78, 148, 0, 710,
+    1524, 0, 218, 699, 0, 221, 218, 724, 0, 221, 221, 221, 221, 1, 246, 148,
+    0, 246, 218, 148, 291, 0, 218, 218, 224, 0, 224, 0, 0, 227, 227, 691,
+    710, 1531, 78, 78, 125, 688, 1524, 9, 22, 19, 0, 19, 19, 19, 1537, 148,
+    772, 12, 0, 691, 12, 19, 19, 218, 688, 881, 688, 78, 78, 78, 332, 341,
+    0, 148, 710, 218, 0, 218, 246, 218, 224, 148, 9, 0, 218, 44, 44, 78,
+    0, 0, 0, 221, 44, 0, 1524, 165, 12, 9, 0, 9, 218, 710, 12, 101,
+    218, 246, 148, 691, 900, 221, 0, 0, 0, 0, 165, 0, 0, 0, 0, 218,
+    691, 1, 165, 0, 688, 688, 688, 218, 221, 0, 44, 44, 341, 341, 264, 221,
+    218, 710, 0, 218, 0, 1531, 688, 0, 710, 0, 264, 78, 221, 721, 688, 1537,
+    721, 0, 688, 165, 148, 148, 246, 221, 44, 0, 148, 105, 148, 713, 78, 221,
+    0, 16, 125, 16, 16, 1593, 215, 101, 9, 125, 0, 9, 101, 125, 9, 695,
+    9, 165, 9, 1524, 9, 125, 165, 0, 699, 16, 78, 218, 148, 148, 772, 221,
+    221, 713, 221, 317, 246, 221, 706, 148, 44, 0, 0, 44, 0, 221, 1524, 101,
+    0, 101, 0, 125, 1537, 101, 0, 221, 0, 101, 215, 221, 125, 9, 215, 101,
+    215, 125, 101, 224, 1520, 101, 1534, 221, 78, 488, 688, 0, 0, 148, 125, 125,
+    272, 19, 19, 0, 19, 19, 717, 227, 0, 446, 227, 125, 0, 16, 215, 215,
+    44, 215, 0, 0, 44, 218, 260, 78, 215, 148, 0, 1531, 1524, 148, 0, 706,
+    0, 623, 699, 0, 221, 125, 1534, 0, 148, 227, 1537, 0, 1537, 772, 721, 227,
+    895, 221, 0, 165, 721, 19, 105, 105, 105, 165, 165, 0, 221, 1537, 41, 9,
+    0, 721, 0, 0, 19, 165, 0, 165, 19, 0, 165, 9, 0, 221, 0, 721,
+    0, 0, 0, 0, 969, 925, 1600, 218, 105, 0, 9, 9, 112, 112, 112, 41,
+    41, 9, 688, 0, 19, 710, 691, 19, 19, 78, 105, 0, 165, 148, 0, 148,
+    112, 9, 9, 19, 710, 19, 105, 9, 224, 0, 0, 221, 148, 0, 0, 1524,
+    148, 234, 19, 0, 105, 221, 0, 0, 9, 688, 721, 221, 44, 148, 0, 221,
+    221, 0, 1524, 117, 117, 224, 148, 362, 721, 148, 0, 710, 148, 22, 9, 1,
+    27, 0, 148, 44, 0, 9, 16, 108, 221, 713, 221, 9, 16, 9, 9, 148,
+    221, 713, 1537, 713, 713, 224, 221, 221, 710, 148, 221, 101, 0, 78, 78, 44,
+    148, 148, 148, 148, 0, 105, 105, 688, 0, 105, 9, 775, 221, 341, 0, 78,
+    0, 227, 0, 9, 9, 148, 1531, 9, 9, 165, 221, 1531, 713, 341, 221, 221,
+    713, 0, 221, 0, 78, 12, 221, 815, 0, 0, 221, 0, 0, 1524, 148, 0,
+    0, 0, 0, 9, 105, 12, 218, 9, 9, 9, 0, 9, 688, 218, 688, 246,
+    1606, 221, 27, 9, 900, 0, 0, 215, 0, 341, 215, 16, 0, 0, 148, 1531,
+    0, 0, 44, 44, 12, 12, 227, 44, 148, 760, 148, 12, 78, 0, 148, 44,
+    148, 78, 710, 0, 0, 19, 0, 0, 227, 341, 0, 148, 19, 22, 1531, 148,
+    148, 0, 688, 16, 706, 724, 44, 78, 0, 78, 0, 291, 0, 721, 0, 699,
+    291, 688, 1611, 702, 1520, 78, 148, 44, 148, 148, 148, 0, 268, 246, 0, 699,
+    0, 19, 148, 148, 221, 148, 148, 1537, 0, 78, 1537, 699, 713, 713, 221, 221,
+    221, 706, 221, 0, 224, 702, 0, 224, 224, 525, 148, 1534, 221, 9, 125, 125,
+    721, 101, 9, 101, 215, 9, 9, 215, 215, 308, 221, 101, 308, 215, 1537, 105,
+    215, 9, 0, 299, 105, 215, 215, 613, 308, 9, 9, 105, 9, 308, 101, 101,
+    215, 101, 221, 0, 272, 775, 78, 0, 16, 0, 0, 710, 215, 0, 16, 272,
+    0, 272, 272, 272, 16, 272, 19, 272, 272, 16, 272, 148, 215, 215, 117, 117,
+    117, 19, 0, 19, 272, 272, 0, 148, 125, 16, 215, 16, 0, 125, 125, 0,
+    215, 215, 0, 44, 44, 0, 44, 0, 44, 211, 148, 0, 19, 148, 221, 1534,
+    215, 1531, 19, 148, 0, 224, 221, 0, 16, 688, 224, 12, 218, 221, 9, 0,
+    218, 1534, 12, 0, 1537, 125, 1524, 16, 125, 125, 215, 0, 1531, 125, 117, 1617,
+    218, 691, 215, 341, 0, 215, 215, 1524, 1537, 221, 215, 227, 0, 221, 0, 0,
+    1524, 1531, 710, 78, 78, 44, 125, 44, 0, 218, 218, 0, 0, 695, 218, 78,
+    0, 16, 227, 227, 1624, 0, 16, 227, 224, 0, 0, 0, 1583, 0, 0, 165,
+    221, 0, 1537, 721, 1544, 688, 218, 0, 125, 148, 44, 341, 246, 148, 699, 78,
+    0, 721, 117, 710, 688, 227, 218, 1, 227, 0, 1492, 1524, 291, 221, 148, 710,
+    19, 16, 0, 16, 60, 16, 925, 0, 165, 272, 0, 78, 78, 148, 148, 148,
+    0, 0, 221, 724, 0, 221, 0, 44, 221, 44, 732, 0, 44, 706, 44, 221,
+    44, 1524, 19, 0, 125, 19, 16, 125, 19, 19, 125, 19, 0, 0, 227, 272,
+    1553, 0, 19, 246, 0, 0, 281, 227, 221, 688, 148, 0, 78, 717, 148, 148,
+    0, 721, 44, 227, 19, 227, 19, 19, 16, 0, 148, 148, 44, 710, 148, 0,
+    0, 0, 721, 19, 221, 9, 9, 0, 234, 9, 9, 44, 0, 9, 9, 9,
+    9, 148, 148, 224, 221, 264, 78, 148, 688, 148, 0, 1527, 148, 148, 148, 341,
+    0, 341, 1516, 218, 148, 44, 688, 732, 1629, 732, 0, 0, 148, 0, 0, 148,
+    0, 9, 0, 215, 16, 246, 1, 0, 165, 0, 0, 215, 16, 0, 0, 0,
+    165, 78, 0, 0, 41, 291, 221, 0, 19, 148, 148, 41, 815, 148, 148, 148,
+    148, 44, 0, 0, 148, 148, 0, 44, 0, 446, 341, 148, 148, 227, 0, 148,
+    246, 900, 0, 1079, 688, 221, 148, 78, 221, 0, 246, 125, 19, 0, 436, 16,
+    775, 272, 215, 272, 221, 291, 78, 268, 19, 218, 0, 0, 78, 78, 688, 0,
+    0, 0, 272, 101, 125, 221, 112, 101, 699, 0, 0, 272, 125, 688, 19, 0,
+    19, 16, 19, 19, 272, 0, 272, 19, 19, 688, 272, 1174, 221, 0, 19, 125,
+    221, 0, 0, 0, 721, 218, 19, 691, 0, 373, 0, 44, 0, 221, 78, 148,
+    41, 148, 218, 78, 0, 19, 16, 125, 221, 0, 221, 0, 148, 0, 710, 0,
+    0, 688, 78, 78, 78, 291, 148, 0, 148, 19, 16, 272, 272, 19, 1634, 19,
+    165, 148, 16, 0, 0, 272, 19, 215, 295, 221, 691, 125, 19, 125, 41, 218,
+    721, 341, 78, 699, 0, 148, 148, 488, 1524, 215, 125, 148, 691, 215, 215, 215,
+    721, 215, 78, 215, 215, 291, 78, 78, 221, 215, 56, 215, 710, 488, 105, 688,
+    78, 488, 215, 148, 221, 148, 0, 9, 0, 148, 0, 0, 0, 691, 691, 218,
+    291, 0, 16, 148, 0, 0, 215, 215, 268, 224, 16, 0, 775, 108, 148, 272,
+    0, 16, 41, 16, 16, 272, 0, 105, 221, 272, 19, 272, 272, 272, 1233, 272,
+    19, 16, 19, 41, 41, 291, 0, 224, 218, 0, 291, 78, 19, 19, 488, 0,
+    0, 148, 148, 0, 0, 9, 0, 0, 221, 221, 148, 224, 105, 19, 0, 78,
+    148, 0, 148, 41, 0, 0, 148, 78, 0, 0, 221, 326, 0, 688, 0, 281,
+    0, 0, 291, 688, 0, 9, 9, 41, 0, 148, 41, 41, 44, 41, 341, 0,
+    41, 41, 0, 0, 0, 215, 41, 0, 0, 688, 221, 227, 78, 1, 0, 65,
+    9, 1524, 65, 148, 721, 148, 221, 148, 16, 125, 125, 16, 16, 488, 710, 78,
+    125, 1, 0, 0, 260, 148, 224, 1520, 0, 16, 16, 78, 78, 78, 125, 78,
+    125, 78, 1, 125, 16, 78, 1, 1, 78, 688, 78, 0, 221, 221, 78, 688,
+    0, 9, 9, 0, 0, 0, 1531, 148, 218, 0, 117, 317, 19, 19, 1640, 1640,
+    19, 105, 0, 16, 0, 16, 1537, 775, 19, 16, 215, 125, 125, 699, 0, 0,
+    125, 19, 9, 9, 78, 272, 16, 16, 0, 1147, 0, 19, 16, 9, 9, 19,
+    268, 221, 1233, 173, 0, 78, 105, 0, 0, 0, 0, 0, 0, 148, 0, 688,
+    688, 710, 41, 9, 0, 9, 9, 0, 78, 9, 16, 488, 221, 1644, 710, 108,
+    19, 16, 272, 19, 19, 19, 16, 165, 9, 78, 41, 9, 9, 0, 0, 105,
+    78, 0, 0, 0, 0, 0, 0, 227, 221, 221, 78, 78, 78, 688, 41, 9,
+    78, 0, 1524, 0, 221, 78, 0, 0, 0, 1065, 78, 227, 688, 78, 0, 0,
+    148, 105, 688, 691, 1649, 488, 19, 1524, 78, 0, 0, 19, 215, 148, 260, 0,
+    148, 148, 148, 78, 78, 291, 125, 148, 78, 78, 0, 0, 44, 19, 260, 0,
+    0, 721, 148, 0, 1653, 688, 148, 0, 221, 148, 218, 148, 125, 211, 0, 148,
+    16, 0, 117, 125, 341, 0, 0, 41, 0, 148, 341, 148, 0, 78, 78, 0,
+    0, 227, 0, 1, 1, 1501, 1, 0, 148, 0, 1, 215, 0, 0, 148, 215,
+    1, 16, 0, 41, 227, 260, 0, 0, 0, 0, 148, 260, 78, 0, 148, 317,
+    44, 19, 721, 775, 218, 1544, 0, 0, 488, 16, 215, 215, 16, 19, 221, 221,
+    0, 1524, 215, 0, 78, 260, 44, 0, 148, 148, 44, 900, 148, 246, 688, 0,
+    221, 148, 148, 1583, 44, 341, 710, 0, 699, 710, 0, 78, 78, 78, 148, 148,
+    0, 291, 0, 148, 148, 218, 1531, 224, 724, 44, 148, 44, 218, 148, 446, 0,
+    1531, 224, 125, 148, 19, 19, 268, 1306, 0, 772, 0, 0, 1524, 148, 272, 16,
+    218, 1553, 148, 0, 1090, 148, 0, 148, 1, 0, 408, 0, 16, 221, 0, 0,
+    221, 148, 688, 221, 713, 0, 0, 699, 221, 706, 706, 713, 221, 721, 12, 1,
+    0, 1531, 1524, 78, 1658, 0, 16, 12, 0, 12, 218, 221, 0, 221, 156, 9,
+    341, 148, 0, 688, 0, 218, 0, 691, 728, 1531, 101, 16, 0, 16, 101, 101,
+    148, 148, 0, 148, 9, 218, 1661, 900, 148, 165, 215, 0, 0, 215, 0, 0,
+    16, 0, 215, 215, 215, 215, 0, 1531, 16, 710, 688, 0, 0, 724, 721, 44,
+    702, 0, 0, 922, 0, 272, 0, 721, 19, 19, 221, 0, 218, 78, 721, 980,
+    341, 148, 148, 341, 148, 44, 221, 221, 0, 221, 710, 1665, 218, 0, 218, 0,
+    148, 44, 148, 299, 215, 215, 125, 0, 613, 1531, 224, 125, 9, 0, 187, 699,
+    0, 9, 44, 218, 218, 291, 44, 148, 78, 0, 0, 0, 0, 224, 0, 221,
+    706, 1544, 218, 0, 125, 41, 125, 215, 125, 215, 699, 215, 1544, 9, 9, 9,
+    0, 215, 215, 724, 78, 16, 0, 0, 0, 775, 1021, 272, 272, 0, 272, 117,
+    16, 16, 148, 78, 16, 125, 125, 0, 16, 44, 0, 78, 78, 78, 0, 19,
+    317, 19, 19, 78, 19, 19, 221, 19, 19, 19, 19, 19, 775, 0, 19, 272,
+    272, 387, 1470, 215, 215, 211, 78, 215, 78, 44, 0, 44, 1537, 0, 0, 0,
+    0, 0, 19, 19, 721, 0, 12, 221, 221, 706, 221, 1531, 44, 221, 713, 221,
+    341, 0, 221, 0, 713, 1, 0, 148, 0, 224, 9, 9, 688, 710, 78, 148,
+    12, 218, 12, 12, 148, 78, 218, 713, 0, 221, 0, 713, 9, 16, 12, 9,
+    12, 218, 0, 373, 44, 44, 1629, 0, 0, 0, 0, 772, 218, 922, 260, 78,
+    0, 1524, 1534, 1537, 78, 19, 19, 12, 0, 688, 12, 218, 0, 221, 699, 721,
+    0, 78, 156, 9, 0, 0, 148, 881, 218, 688, 218, 688, 688, 218, 218, 710,
+    44, 446, 44, 732, 44, 44, 44, 0, 0, 0, 221, 0, 0, 0, 78, 148,
+    0, 218, 218, 9, 695, 772, 9, 218, 44, 221, 900, 246, 0, 1480, 9, 0,
+    221, 0, 0, 0, 772, 218, 12, 148, 148, 0, 0, 1, 0, 1524, 246, 0,
+    246, 78, 224, 695, 710, 1669, 218, 0, 0, 1, 224, 221, 165, 1537, 688, 688,
+    44, 218, 227, 221, 925, 148, 148, 44, 148, 221, 101, 9, 9, 1674, 713, 1520,
+    295, 12, 215, 108, 0, 105, 0, 165, 125, 101, 125, 125, 101, 9, 9, 0,
+    9, 250, 221, 9, 1531, 295, 218, 0, 221, 44, 0, 221, 221, 224, 101, 0,
+    0, 699, 706, 224, 224, 221, 101, 721, 9, 0, 125, 9, 101, 0, 101, 125,
+    125, 101, 218, 0, 0, 101, 0, 0, 108, 108, 221, 0, 221, 706, 101, 215,
+    101, 9, 215, 688, 699, 125, 215, 215, 215, 215, 488, 78, 488, 215, 688, 1153,
+    0, 117, 117, 224, 125, 215, 125, 215, 125, 1323, 688, 488, 1245, 0, 148, 0,
+    215, 117, 1573, 125, 488, 1524, 688, 125, 125, 0, 125, 0, 125, 688, 1, 148,
+    125, 125, 125, 125, 0, 215, 215, 224, 0, 0, 0, 125, 44, 721, 44, 19,
+    19, 19, 1537, 16, 1531, 12, 221, 221, 721, 0, 0, 713, 221, 224, 0, 218,
+    224, 0, 224, 221, 0, 218, 0, 148, 1524, 148, 688, 1, 44, 695, 1, 224,
+    221, 0, 0, 121, 148, 221, 0, 0, 706, 221, 0, 0, 224, 221, 221, 0,
+    0, 1437, 148, 148, 16, 221, 706, 721, 148, 0, 221, 1, 44, 221, 1, 218,
+    16, 224, 148, 710, 221, 1, 221, 221, 224, 0, 702, 148, 125, 1, 1, 0,
+    12, 1, 1, 221, 221, 16, 0, 0, 0, 221, 105, 702, 148, 0, 691, 0,
+    885, 78, 19, 125, 78, 148, 218, 148, 148, 341, 291, 0, 148, 0, 224, 148,
+    148, 0, 0, 721, 224, 1531, 0, 19, 19, 1649, 721, 341, 246, 227, 148, 125,
+    148, 0, 0, 44, 221, 44, 0, 44, 44, 0, 1537, 0, 1043, 0, 9, 0,
+    1531, 688, 218, 218, 1, 101, 125, 691, 148, 105, 1480, 148, 900, 0, 0, 148,
+    0, 0, 321, 0, 9, 0, 1, 0, 0, 218, 1480, 44, 44, 44, 218, 218,
+    218, 0, 0, 713, 1, 0, 1065, 148, 1531, 165, 0, 1661, 1531, 148, 0, 78,
+    721, 1531, 695, 1544, 221, 211, 125, 78, 78, 78, 373, 16, 78, 1624, 713, 713,
+    221, 0, 78, 148, 148, 691, 1531, 221, 0, 19, 19, 1, 125, 16, 299, 0,
+    0, 148, 0, 148, 706, 44, 16, 148, 0, 0, 19, 215, 215, 710, 125, 19,
+    221, 215, 125, 125, 0, 44, 148, 218, 291, 0, 0, 373, 0, 0, 16, 215,
+    0, 125, 125, 218, 688, 221, 717, 125, 125, 125, 125, 215, 125, 78, 78, 44,
+    224, 0, 0, 678, 0, 0, 0, 224, 0, 272, 0, 44, 1531, 148, 0, 721,
+    148, 695, 218, 105, 341, 341, 125, 0, 148, 148, 148, 221, 148, 1682, 148, 148,
+    0, 78, 148, 218, 0, 1, 148, 44, 78, 0, 1, 78, 117, 215, 0, 125,
+    125, 488, 0, 0, 1537, 0, 148, 0, 148, 721, 0, 148, 148, 1531, 1531, 272,
+    215, 0, 19, 215, 0, 0, 215, 215, 215, 1, 341, 0, 0, 148, 341, 148,
+    148, 446, 78, 148, 148, 900, 148, 0, 221, 221, 0, 221, 19, 0, 272, 16,
+    215, 16, 16, 260, 16, 0, 775, 272, 0, 125, 0, 0, 0, 272, 272, 16,
+    272, 272, 19, 272, 16, 16, 16, 117, 688, 260, 0, 488, 148, 0, 16, 19,
+    16, 0, 272, 272, 125, 125, 0, 44, 125, 16, 16, 0, 16, 0, 376, 260,
+    1, 1, 1, 0, 78, 16, 16, 16, 0, 0, 44, 1531, 78, 1, 260, 148,
+    16, 0, 16, 215, 16, 78, 117, 125, 78, 260, 16, 125, 125, 0, 0, 19,
+    317, 16, 272, 0, 272, 19, 272, 272, 0, 0, 0, 0, 272, 16, 0, 0,
+    0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 1233, 775, 1233, 0, 215, 0,
+    125, 44, 78, 215, 488, 16, 215, 78, 125, 488, 78, 78, 78, 215, 78, 16,
+    260, 1470, 0, 1470, 260, 260, 78, 148, 148, 1687, 148, 0, 148, 0, 1527, 1531,
+    0, 221, 0, 0, 0, 0, 272, 341, 44, 1692, 341, 341, 148, 0, 341, 148,
+    148, 246, 691, 218, 710, 221, 706, 0, 713, 221, 221, 148, 0, 221, 16, 1,
+    1, 0, 16, 148, 148, 0, 713, 78, 125, 1524, 16, 148, 218, 218, 117, 125,
+    125, 78, 125, 0, 0, 1698, 125, 117, 125, 117, 688, 0, 688, 148, 815, 1524,
+    148, 148, 815, 221, 713, 215, 19, 272, 272, 16, 148, 272, 272, 0, 227, 16,
+    16, 260, 260, 78, 260, 148, 44, 260, 260, 0, 227, 221, 218, 218, 357, 0,
+    0, 713, 0, 0, 0, 221, 117, 710, 215, 724, 0, 221, 105, 0, 0, 227,
+    218, 688, 148, 246, 148, 732, 0, 148, 721, 246, 341, 148, 227, 688, 0, 148,
+    148, 784, 224, 148, 702, 224, 224, 341, 19, 815, 227, 0, 148, 215, 0, 1524,
+    688, 900, 44, 218, 218, 227, 224, 44, 227, 125, 117, 0, 125, 0, 148, 732,
+    125, 125, 125, 623, 623, 1131, 218, 691, 1131, 0, 623, 0, 125, 125, 44, 148,
+    148, 0, 0, 0, 291, 148, 1, 125, 16, 0, 0, 688, 218, 1524, 148, 0,
+    264, 44, 0, 221, 922, 19, 44, 148, 148, 148, 148, 0, 0, 44, 215, 246,
+    148, 1043, 732, 246, 221, 218, 815, 260, 19, 272, 19, 148, 148, 0, 19, 44,
+    44, 78, 148, 246, 446, 900, 148, 0, 688, 341, 148, 732, 148, 218, 688, 218,
+    148, 16, 19, 260, 0, 0, 19, 224, 0, 0, 221, 0, 19, 272, 215, 488,
+    211, 78, 44, 16, 221, 44, 0, 44, 0, 44, 732, 78, 264, 1524, 19, 19,
+    221, 0, 16, 78, 775, 0, 19, 78, 19, 272, 221, 1703, 1553, 1553, 1147, 16,
+    1137, 272, 16, 0, 211, 44, 44, 272, 268, 16, 44, 78, 0, 0, 246, 221,
+    215, 291, 19, 19, 0, 16, 19, 125, 0, 0, 0, 0, 78, 688, 148, 19,
+    16, 19, 272, 0, 19, 1147, 1553, 0, 19, 148, 224, 721, 246, 1709, 1531, 272,
+    0, 19, 125, 125, 221, 0, 291, 148, 341, 341, 227, 148, 148, 0, 224, 1524,
+    148, 148, 227, 148, 260, 19, 16, 0, 272, 272, 0, 0, 272, 16, 19, 16,
+    16, 272, 272, 272, 890, 16, 272, 16, 272, 148, 1537, 221, 78, 78, 78, 19,
+    221, 125, 0, 148, 78, 78, 16, 16, 148, 78, 221, 148, 148, 9, 0, 9,
+    0, 0, 41, 41, 224, 218, 41, 0, 16, 0, 16, 0, 218, 299, 0, 148,
+    0, 0, 215, 218, 41, 341, 341, 341, 148, 227, 246, 0, 291, 78, 78, 148,
+    0, 0, 41, 9, 9, 695, 218, 125, 0, 41, 0, 224, 0, 710, 0, 148,
+    41, 78, 1531, 221, 1531, 9, 148, 9, 9, 0, 844, 0, 224, 0, 0, 41,
+    0, 148, 9, 41, 1537, 0, 105, 78, 0, 1531, 78, 218, 246, 44, 148, 710,
+    373, 125, 218, 218, 148, 148, 44, 44, 1245, 224, 710, 710, 341, 148, 148, 341,
+    1583, 224, 148, 0, 44, 1524, 710, 0, 706, 215, 775, 78, 78, 688, 0, 117,
+    0, 16, 16, 0, 0, 0, 0, 688, 218, 0, 732, 0, 1714, 148, 721, 0,
+    19, 16, 272, 1559, 0, 1520, 165, 0, 19, 19, 16, 19, 148, 16, 446, 44,
+    0, 0, 221, 78, 218, 78, 148, 44, 691, 221, 1, 1, 710, 1534, 1, 221,
+    1, 44, 224, 0, 1, 44, 78, 78, 721, 19, 19, 721, 19, 218, 78, 221,
+    19, 317, 19, 125, 16, 19, 148, 724, 0, 16, 1544, 0, 16, 0, 0, 148,
+    775, 125, 0, 215, 218, 1719, 1531, 224, 78, 78, 78, 215, 44, 78, 78, 260,
+    78, 227, 760, 1723, 148, 218, 1043, 148, 44, 0, 0, 0, 0, 221, 0, 19,
+    148, 16, 0, 19, 900, 221, 19, 224, 19, 19, 272, 218, 0, 19, 0, 19,
+    721, 19, 16, 721, 0, 16, 0, 272, 16, 980, 211, 0, 688, 1520, 688, 221,
+    0, 0, 1544, 702, 148, 44, 1729, 1520, 221, 22, 688, 1531, 12, 105, 1520, 148,
+    148, 446, 0, 0, 713, 706, 688, 12, 148, 341, 0, 224, 224, 1386, 148, 9,
+    9, 9, 9, 12, 16, 0, 0, 12, 12, 9, 9, 691, 1, 0, 221, 1137,
+    16, 1, 12, 44, 0, 148, 165, 0, 713, 0, 16, 12, 9, 9, 148, 148,
+    148, 688, 221, 980, 710, 9, 227, 78, 732, 227, 0, 156, 341, 341, 1732, 688,
+    218, 218, 218, 815, 1537, 0, 0, 0, 148, 218, 0, 0, 688, 688, 0, 218,
+    691, 0, 218, 0, 9, 12, 218, 12, 12, 9, 9, 148, 148, 0, 900, 0,
+    0, 221, 0, 9, 0, 0, 16, 0, 0, 221, 0, 0, 19, 101, 0, 16,
+    9, 1, 0, 392, 148, 221, 221, 446, 44, 218, 0, 0, 721, 9, 688, 0,
+    12, 12, 721, 1544, 1531, 12, 12, 224, 9, 1, 1, 125, 221, 125, 125, 221,
+    218, 16, 125, 308, 215, 16, 9, 688, 9, 1729, 1524, 16, 221, 613, 9, 706,
+    9, 1531, 688, 218, 148, 922, 1531, 0, 78, 221, 221, 221, 0, 148, 0, 1736,
+    706, 9, 148, 148, 0, 125, 9, 101, 101, 9, 101, 9, 9, 101, 1741, 125,
+    101, 9, 0, 1537, 9, 101, 125, 215, 165, 101, 775, 148, 148, 148, 0, 148,
+    272, 272, 148, 16, 16, 16, 16, 16, 16, 16, 117, 148, 148, 148, 16, 0,
+    1593, 44, 148, 0, 16, 44, 16, 0, 16, 16, 16, 125, 16, 148, 19, 19,
+    19, 148, 224, 218, 78, 19, 775, 1544, 16, 721, 227, 44, 0, 19, 272, 218,
+    16, 19, 221, 78, 19, 78, 16, 1524, 713, 0, 211, 78, 260, 215, 699, 78,
+    221, 1537, 44, 221, 221, 19, 16, 0, 224, 221, 218, 0, 1534, 221, 148, 688,
+    699, 221, 0, 691, 0, 221, 156, 165, 148, 105, 264, 148, 148, 16, 1531, 165,
+    341, 16, 148, 148, 148, 148, 165, 148, 721, 713, 41, 148, 710, 44, 78, 78,
+    44, 44, 221, 0, 0, 706, 148, 0, 0, 1520, 9, 16, 148, 1, 9, 713,
+    221, 341, 717, 341, 148, 0, 0, 9, 12, 710, 125, 44, 373, 44, 1386, 148,
+    148, 0, 0, 0, 44, 0, 44, 221, 44, 246, 224, 218, 1746, 0, 221, 0,
+    706, 0, 41, 0, 706, 1537, 0, 221, 0, 218, 9, 295, 12, 0, 9, 9,
+    9, 9, 9, 12, 9, 9, 9, 221, 710, 16, 291, 699, 0, 0, 0, 0,
+    0, 1351, 272, 117, 16, 387, 78, 0, 0, 699, 1531, 19, 215, 0, 218, 218,
+    125, 227, 291, 78, 260, 19, 19, 488, 78, 0, 1753, 16, 272, 387, 272, 224,
+    0, 0, 125, 0, 0, 19, 117, 117, 1553, 0, 218, 1553, 0, 268, 272, 44,
+    16, 16, 373, 44, 16, 224, 1524, 0, 246, 699, 148, 0, 341, 227, 699, 105,
+    691, 0, 699, 0, 721, 721, 16, 16, 215, 148, 148, 105, 0, 9, 16, 0,
+    0, 1, 0, 215, 221, 224, 0, 0, 9, 78, 9, 0, 78, 78, 9, 148,
+    341, 165, 165, 148, 44, 760, 732, 1687, 9, 0, 1, 0, 341, 0, 0, 0,
+    0, 0, 1, 0, 0, 218, 9, 12, 0, 9, 0, 108, 9, 12, 148, 148,
+    900, 148, 900, 706, 0, 148, 0, 0, 0, 12, 16, 16, 16, 0, 9, 16,
+    16, 0, 0, 16, 9, 1, 16, 218, 0, 9, 0, 308, 295, 0, 215, 1,
+    688, 148, 215, 0, 234, 0, 221, 221, 221, 78, 12, 224, 221, 148, 19, 0,
+    221, 19, 19, 156, 156, 148, 0, 0, 0, 699, 1531, 78, 9, 148, 165, 148,
+    0, 16, 0, 19, 78, 78, 78, 148, 246, 688, 1524, 0, 16, 1524, 44, 688,
+    148, 0, 148, 0, 19, 0, 19, 78, 1653, 78, 721, 0, 0, 713, 0, 224,
+    148, 78, 1524, 221, 0, 1653, 1524, 1524, 78, 12, 148, 148, 148, 148, 373, 227,
+    0, 688, 148, 16, 16, 0, 9, 9, 12, 9, 0, 78, 9, 9, 148, 218,
+    218, 1570, 44, 0, 148, 148, 721, 148, 1534, 125, 19, 125, 19, 691, 78, 211,
+    78, 148, 373, 1527, 44, 16, 148, 16, 125, 125, 218, 291, 125, 148, 0, 0,
+    0, 19, 19, 215, 78, 0, 19, 0, 19, 218, 19, 19, 148, 221, 125, 224,
+    0, 0, 125, 221, 148, 0, 0, 0, 0, 0, 19, 0, 16, 272, 215, 19,
+    16, 19, 215, 608, 341, 78, 148, 148, 688, 1760, 317, 19, 125, 19, 19, 78,
+    0, 272, 272, 272, 0, 19, 19, 19, 78, 215, 19, 78, 688, 688, 224, 0,
+    148, 148, 148, 44, 713, 218, 221, 291, 44, 148, 148, 44, 218, 695, 78, 710,
+    16, 688, 1531, 775, 215, 148, 78, 125, 125, 125, 710, 710, 0, 0, 1531, 125,
+    148, 19, 16, 16, 16, 16, 16, 16, 16, 19, 148, 16, 148, 0, 0, 16,
+    272, 117, 125, 125, 1729, 44, 0, 16, 0, 125, 125, 125, 125, 125, 0, 215,
+    0, 148, 44, 16, 0, 44, 44, 1570, 260, 0, 44, 148, 78, 148, 19, 19,
+    19, 215, 0, 1764, 721, 19, 19, 260, 78, 1537, 125, 19, 19, 272, 775, 218,
+    0, 0, 0, 0, 0, 117, 0, 0, 0, 148, 775, 148, 125, 215, 44, 1524,
+    125, 215, 215, 1233, 721, 78, 78, 78, 78, 78, 221, 900, 0, 341, 291, 148,
+    0, 713, 724, 721, 721, 815, 148, 1537, 218, 19, 1537, 41, 221, 0, 341, 148,
+    702, 713, 0, 713, 724, 706, 0, 1653, 0, 44, 44, 1043, 148, 1531, 1043, 148,
+    446, 0, 78, 19, 16, 0, 1553, 19, 1174, 1531, 148, 0, 1, 1768, 148, 117,
+    16, 362, 148, 0, 688, 0, 688, 78, 688, 148, 148, 148, 148, 148, 148, 148,
+    0, 148, 148, 148, 0, 0, 702, 148, 221, 227, 148, 246, 148, 234, 16, 44,
+    699, 218, 9, 246, 148, 22, 148, 36, 148, 221, 0, 148, 16, 0, 224, 12,
+    165, 16, 12, 9, 221, 9, 1, 105, 221, 221, 721, 0, 221, 221, 12, 0,
+    224, 224, 0, 224, 224, 224, 900, 148, 117, 0, 215, 9, 0, 218, 218, 710,
+    0, 9, 221, 1531, 691, 1524, 699, 218, 78, 272, 78, 148, 1520, 0, 44, 0,
+    0, 0, 0, 295, 295, 0, 341, 0, 148, 9, 148, 1524, 9, 0, 148, 221,
+    0, 22, 0, 732, 218, 44, 218, 12, 1537, 0, 218, 148, 221, 0, 221, 1524,
+    215, 0, 9, 0, 78, 1772, 0, 900, 0, 0, 0, 78, 0, 0, 1544, 215,
+    218, 0, 710, 0, 148, 105, 221, 227, 234, 0, 724, 221, 221, 19, 78, 699,
+    0, 0, 221, 148, 218, 78, 732, 721, 0, 0, 221, 224, 221, 341, 148, 148,
+    148, 1537, 710, 221, 0, 16, 12, 148, 1537, 221, 9, 221, 721, 1520, 732, 12,
+    1537, 78, 0, 0, 0, 148, 19, 268, 772, 688, 272, 19, 19, 227, 19, 0,
+    224, 148, 0, 1714, 0, 218, 925, 224, 1524, 218, 19, 19, 272, 19, 218, 881,
+    772, 78, 78, 1537, 215, 721, 341, 0, 0, 221, 148, 218, 710, 695, 688, 218,
+    148, 148, 221, 148, 706, 221, 0, 0, 221, 218, 0, 272, 227, 0, 19, 19,
+    78, 0, 260, 260, 44, 0, 78, 721, 215, 1003, 775, 215, 148, 19, 16, 16,
+    16, 125, 125, 125, 16, 373, 19, 78, 78, 19, 19, 19, 0, 19, 272, 0,
+    272, 272, 1777, 272, 272, 272, 272, 272, 19, 1531, 78, 0, 291, 0, 78, 0,
+    218, 78, 0, 713, 0, 1783, 0, 44, 534, 446, 105, 710, 227, 0, 1537, 710,
+    1534, 221, 0, 713, 148, 699, 0, 0, 0, 148, 224, 0, 0, 0, 408, 78,
+    1583, 148, 19, 148, 78, 224, 148, 218, 44, 12, 218, 148, 218, 0, 0, 1531,
+    227, 227, 218, 148, 691, 221, 16, 772, 16, 148, 78, 332, 488, 81, 148, 224,
+    710, 44, 227, 108, 9, 16, 0, 148, 1, 148, 221, 16, 148, 221, 16, 16,
+    0, 713, 27, 224, 148, 1531, 148, 732, 227, 148, 105, 224, 0, 221, 105, 105,
+    105, 105, 105, 16, 105, 108, 105, 105, 0, 221, 691, 125, 215, 16, 16, 16,
+    19, 272, 78, 78, 16, 0, 272, 215, 0, 721, 0, 0, 0, 0, 299, 0,
+    148, 299, 0, 0, 0, 221, 721, 16, 19, 1065, 16, 608, 227, 260, 44, 260,
+    78, 16, 16, 16, 16, 260, 0, 148, 16, 0, 688, 148, 264, 78, 9, 9,
+    1789, 78, 0, 105, 165, 165, 105, 105, 105, 105, 1524, 105, 105, 78, 44, 44,
+    713, 0, 373, 0, 27, 27, 27, 1, 27, 27, 1, 27, 27, 27, 815, 218,
+    710, 1537, 148, 27, 0, 27, 27, 1, 0, 691, 218, 691, 1797, 27, 105, 105,
+    586, 27, 105, 408, 27, 108, 105, 728, 148, 148, 900, 148, 246, 148, 264, 148,
+    148, 246, 16, 148, 688, 0, 9, 148, 148, 0, 0, 165, 9, 165, 108, 408,
+    16, 16, 12, 1, 16, 0, 12, 12, 1, 16, 12, 0, 165, 148, 0, 688,
+    1, 19, 148, 221, 148, 341, 78, 341, 341, 341, 1804, 19, 148, 218, 1810, 105,
+    148, 483, 227, 341, 156, 22, 760, 732, 78, 44, 218, 218, 218, 0, 713, 0,
+    148, 1524, 117, 0, 148, 224, 317, 19, 19, 272, 19, 117, 272, 1524, 0, 299,
+    0, 0, 272, 0, 0, 695, 218, 148, 16, 44, 125, 148, 44, 19, 260, 44,
+    260, 78, 218, 44, 1687, 44, 0, 1524, 0, 0, 1419, 105, 691, 78, 78, 0,
+    0, 221, 1649, 91, 9, 218, 148, 0, 224, 148, 148, 0, 0, 148, 221, 148,
+    710, 148, 16, 78, 44, 44, 148, 0, 78, 148, 105, 78, 221, 0, 0, 0,
+    19, 221, 215, 19, 19, 0, 218, 16, 19, 16, 19, 0, 224, 0, 0, 0,
+    0, 19, 16, 19, 272, 0, 125, 0, 260, 78, 125, 44, 44, 16, 16, 1174,
+    16, 1531, 19, 272, 44, 215, 260, 16, 78, 260, 16, 78, 148, 78, 221, 148,
+    148, 44, 0, 0, 0, 221, 148, 227, 148, 0, 148, 148, 0, 19, 19, 218,
+    221, 688, 221, 16, 16, 272, 218, 148, 215, 125, 224, 218, 148, 0, 0, 0,
+    148, 148, 0, 148, 0, 688, 221, 724, 488, 721, 218, 19, 44, 0, 148, 272,
+    0, 16, 148, 16, 165, 165, 1524, 710, 78, 148, 44, 148, 148, 148, 272, 78,
+    264, 224, 165, 0, 1719, 688, 156, 699, 9, 148, 0, 881, 0, 1783, 148, 148,
+    246, 246, 221, 1531, 1537, 695, 721, 0, 125, 272, 16, 44, 16, 0, 16, 117,
+    125, 44, 710, 688, 16, 0, 0, 1524, 125, 0, 1548, 0, 1649, 148, 16, 16,
+    0, 16, 272, 19, 16, 272, 0, 0, 19, 0, 272, 16, 16, 16, 16, 148,
+    688, 0, 16, 148, 16, 1531, 78, 215, 224, 221, 117, 117, 148, 125, 0, 16,
+    775, 148, 0, 148, 688, 44, 148, 1573, 0, 44, 44, 0, 16, 16, 0, 0,
+    227, 0, 1527, 125, 16, 0, 0, 0, 148, 0, 44, 211, 125, 0, 125, 16,
+    0, 44, 0, 0, 695, 125, 211, 44, 148, 44, 148, 44, 272, 0, 148, 272,
+    0, 0, 775, 221, 148, 218, 0, 19, 0, 117, 19, 117, 125, 1496, 117, 16,
+    218, 125, 16, 775, 272, 0, 387, 224, 0, 1531, 0, 44, 44, 44, 44, 44,
+    44, 218, 1817, 221, 1174, 0, 710, 78, 44, 1356, 721, 1524, 488, 488, 1537, 1573,
+    1531, 1537, 0, 215, 0, 44, 19, 78, 78, 1573, 0, 299, 0, 0, 44, 16,
+    125, 221, 0, 373, 0, 44, 713, 1531, 108, 78, 0, 0, 272, 264, 125, 702,
+    0, 0, 0, 0, 272, 19, 0, 0, 0, 218, 19, 695, 221, 710, 16, 272,
+    19, 16, 16, 0, 1061, 78, 78, 224, 19, 260, 224, 1520, 125, 215, 0, 41,
+    0, 0, 78, 78, 78, 215, 688, 688, 710, 1501, 227, 227, 688, 0, 710, 688,
+    695, 16, 16, 0, 215, 218, 218, 1534, 0, 713, 218, 1524, 148, 16, 775, 19,
+    0, 341, 41, 218, 218, 218, 695, 44, 221, 44, 78, 78, 148, 19, 19, 1531,
+    713, 0, 1534, 0, 221, 272, 317, 19, 78, 19, 19, 125, 721, 125, 125, 1606,
+    980, 900, 78, 227, 78, 1531, 1386, 688, 446, 227, 78, 218, 699, 44, 148, 148,
+    0, 1531, 78, 44, 148, 710, 0, 0, 221, 1531, 710, 224, 78, 19, 44, 1544,
+    1524, 148, 446, 341, 148, 0, 0, 688, 148, 148, 19, 272, 272, 691, 19, 148,
+    0, 246, 0, 1583, 221, 772, 218, 246, 341, 148, 341, 218, 341, 815, 1386, 341,
+    148, 0, 0, 691, 218, 19, 0, 221, 78, 0, 148, 221, 387, 19, 19, 0,
+    0, 0, 272, 272, 1233, 19, 125, 299, 19, 980, 710, 16, 980, 1537, 19, 78,
+    19, 272, 272, 317, 215, 0, 78, 0, 16, 218, 688, 78, 148, 0, 148, 0,
+    218, 78, 19, 0, 148, 1544, 125, 272, 19, 0, 19, 16, 0, 19, 19, 125,
+    78, 148, 721, 215, 215, 78, 215, 148, 215, 165, 688, 291, 16, 19, 78, 44,
+    148, 1537, 710, 688, 0, 688, 710, 341, 900, 0, 0, 0, 0, 227, 221, 148,
+    19, 221, 695, 1709, 16, 19, 78, 148, 218, 19, 0, 78, 221, 148, 16, 260,
+    78, 41, 721, 488, 44, 291, 1823, 688, 215, 688, 0, 78, 260, 0, 227, 148,
+    148, 0, 710, 148, 0, 341, 148, 691, 387, 19, 19, 1537, 1531, 117, 699, 117,
+    317, 148, 218, 9, 78, 9, 699, 78, 78, 108, 0, 125, 19, 224, 16, 732,
+    148, 0, 0, 341, 0, 148, 148, 710, 1658, 815, 148, 148, 373, 44, 78, 691,
+    221, 19, 341, 341, 688, 341, 148, 710, 0, 779, 148, 148, 0, 760, 0, 218,
+    0, 341, 710, 19, 0, 125, 0, 1830, 1559, 148, 44, 148, 78, 125, 44, 148,
+    1835, 0, 148, 148, 0, 341, 221, 148, 148, 44, 227, 44, 44, 0, 710, 44,
+    227, 688, 0, 0, 0, 148, 78, 148, 881, 78, 446, 0, 218, 0, 218, 218,
+    148, 125, 272, 19, 19, 125, 775, 775, 695, 775, 724, 0, 775, 1840, 224, 0,
+    19, 1846, 775, 215, 78, 78, 0, 125, 78, 44, 78, 78, 78, 246, 78, 221,
+    221, 148, 0, 78, 0, 148, 760, 148, 0, 1852, 44, 264, 44, 264, 19, 19,
+    148, 148, 0, 148, 1524, 1524, 0, 1534, 0, 0, 699, 1553, 272, 272, 272, 272,
+    224, 721, 221, 713, 221, 221, 0, 221, 148, 732, 224, 148, 0, 1531, 218, 695,
+    41, 9, 772, 0, 221, 0, 0, 0, 9, 9, 0, 41, 0, 224, 1856, 218,
+    105, 41, 41, 165, 0, 713, 9, 78, 9, 710, 0, 44, 1386, 341, 148, 148,
+    688, 710, 691, 710, 688, 148, 218, 78, 44, 691, 1863, 760, 688, 430, 1869, 688,
+    0, 41, 218, 688, 9, 1531, 221, 218, 148, 688, 1531, 699, 895, 165, 41, 0,
+    9, 9, 165, 78, 0, 688, 0, 699, 19, 78, 19, 19, 125, 0, 16, 1719,
+    0, 0, 19, 1577, 19, 44, 44, 78, 0, 1, 1544, 724, 1544, 112, 1534, 699,
+    9, 44, 721, 221, 0, 0, 221, 148, 0, 721, 165, 165, 691, 78, 0, 165,
+    688, 341, 218, 148, 341, 688, 721, 221, 341, 341, 19, 0, 221, 165, 0, 165,
+    44, 0, 268, 148, 227, 246, 699, 19, 0, 1531, 224, 272, 775, 215, 78, 78,
+    221, 165, 9, 0, 0, 9, 41, 721, 0, 925, 218, 105, 227, 688, 165, 9,
+    227, 125, 125, 0, 215, 215, 1846, 775, 0, 775, 775, 1233, 78, 221, 125, 19,
+    148, 221, 1719, 221, 148, 78, 78, 341, 1386, 0, 44, 0, 0, 925, 0, 341,
+    41, 221, 0, 148, 221, 16, 148, 784, 12, 0, 148, 0, 148, 44, 9, 165,
+    148, 165, 772, 0, 218, 341, 925, 1524, 264, 0, 688, 148, 117, 9, 148, 732,
+    227, 0, 710, 0, 0, 78, 148, 699, 0, 101, 101, 9, 105, 218, 218, 1874,
+    721, 148, 148, 0, 0, 702, 165, 710, 0, 121, 148, 148, 148, 16, 215, 215,
+    295, 721, 165, 9, 0, 41, 16, 1531, 699, 211, 218, 221, 221, 16, 16, 9,
+    688, 16, 1, 0, 0, 1, 9, 16, 148, 148, 221, 156, 308, 1537, 78, 218,
+    78, 108, 148, 218, 0, 78, 148, 215, 125, 224, 9, 221, 148, 341, 125, 44,
+    91, 373, 9, 9, 218, 165, 695, 218, 0, 713, 9, 1881, 9, 9, 9, 9,
+    9, 221, 9, 9, 9, 9, 699, 925, 0, 16, 16, 218, 19, 16, 19, 19,
+    0, 1888, 0, 688, 215, 125, 691, 0, 0, 16, 688, 218, 760, 16, 0, 125,
+    125, 260, 125, 78, 16, 148, 78, 78, 0, 44, 148, 148, 44, 1, 1, 357,
+    218, 691, 0, 148, 1537, 19, 19, 16, 148, 215, 272, 16, 721, 0, 224, 218,
+    0, 0, 0, 218, 272, 19, 19, 78, 224, 78, 16, 373, 148, 0, 78, 78,
+    218, 218, 0, 105, 9, 9, 148, 16, 0, 148, 148, 1537, 78, 0, 0, 0,
+    0, 0, 165, 105, 0, 165, 691, 691, 12, 688, 688, 9, 0, 0, 9, 105,
+    108, 0, 0, 980, 0, 105, 0, 9, 9, 9, 0, 9, 105, 1544, 78, 1524,
+    373, 148, 105, 16, 9, 9, 0, 0, 221, 341, 78, 9, 105, 105, 699, 0,
+    9, 44, 78, 732, 12, 165, 218, 221, 0, 9, 0, 0, 1524, 1531, 0, 688,
+    9, 9, 12, 0, 12, 12, 9, 9, 0, 0, 221, 332, 148, 9, 22, 221,
+    295, 0, 161, 341, 16, 0, 215, 295, 221, 0, 9, 221, 221, 0, 221, 295,
+    295, 939, 0, 16, 9, 1, 12, 108, 27, 12, 148, 0, 1, 1, 586, 12,
+    218, 16, 9, 221, 16, 0, 9, 0, 295, 221, 44, 78, 0, 760, 165, 165,
+    221, 105, 105, 19, 0, 234, 341, 148, 148, 0, 0, 78, 12, 710, 16, 0,
+    0, 78, 0, 0, 44, 0, 16, 0, 272, 0, 218, 224, 221, 0, 0, 0,
+    0, 16, 0, 16, 16, 16, 148, 260, 44, 16, 260, 16, 78, 125, 78, 221,
+    44, 221, 221, 221, 224, 221, 0, 9, 218, 148, 148, 44, 221, 19, 0, 148,
+    148, 78, 105, 900, 699, 105, 706, 1537, 691, 78, 1531, 78, 721, 224, 44, 19,
+    218, 0, 218, 148, 148, 0, 0, 96, 0, 148, 148, 0, 148, 148, 148, 148,
+    224, 224, 0, 0, 9, 699, 221, 295, 221, 0, 221, 9, 221, 221, 221, 0,
+    12, 1, 295, 0, 221, 0, 295, 105, 0, 78, 0, 165, 291, 1531, 9, 0,
+    702, 117, 0, 706, 0, 224, 713, 706, 19, 19, 19, 0, 0, 0, 0, 272,
+    44, 44, 44, 16, 268, 78, 260, 16, 78, 148, 148, 148, 78, 0, 0, 0,
+    148, 0, 0, 0, 148, 710, 44, 148, 221, 299, 387, 260, 0, 148, 78, 1075,
+    721, 221, 19, 19, 272, 0, 19, 260, 16, 16, 0, 688, 0, 224, 148, 16,
+    272, 272, 272, 227, 710, 1531, 16, 0, 0, 1520, 317, 215, 16, 44, 125, 272,
+    44, 78, 16, 78, 488, 775, 488, 78, 148, 215, 215, 19, 19, 148, 775, 0,
+    775, 775, 775, 215, 0, 224, 218, 78, 900, 148, 688, 165, 148, 0, 1524, 1531,
+    148, 148, 0, 0, 1692, 264, 148, 0, 0, 702, 713, 246, 148, 148, 218, 688,
+    0, 713, 224, 19, 1892, 148, 148, 44, 732, 148, 246, 148, 688, 221, 78, 0,
+    221, 688, 19, 299, 299, 221, 221, 710, 221, 148, 148, 218, 78, 221, 78, 78,
+    125, 215, 775, 215, 488, 78, 215, 78, 78, 44, 215, 0, 125, 272, 16, 148,
+    224, 16, 19, 16, 19, 16, 19, 148, 117, 125, 148, 148, 215, 211, 44, 215,
+    0, 0, 0, 44, 215, 0, 0, 0, 16, 0, 0, 0, 1531, 148, 125, 16,
+    16, 16, 44, 44, 215, 125, 44, 0, 16, 19, 221, 78, 0, 691, 272, 148,
+    117, 272, 19, 19, 78, 0, 19, 1896, 16, 0, 16, 224, 1520, 0, 721, 0,
+    0, 19, 19, 0, 0, 0, 0, 19, 19, 16, 691, 16, 78, 148, 272, 488,
+    299, 227, 215, 215, 0, 0, 0, 78, 1900, 488, 78, 0, 125, 16, 688, 44,
+    221, 78, 0, 148, 148, 0, 0, 19, 246, 272, 260, 19, 19, 44, 1534, 0,
+    148, 688, 699, 0, 19, 108, 724, 0, 1531, 1531, 221, 9, 125, 0, 221, 1,
+    713, 224, 148, 44, 446, 0, 724, 0, 0, 0, 299, 299, 125, 721, 78, 1537,
+    148, 16, 299, 19, 0, 221, 272, 272, 272, 19, 272, 272, 272, 19, 148, 702,
+    117, 16, 125, 699, 165, 710, 9, 0, 1524, 148, 1531, 165, 148, 148, 586, 148,
+    721, 224, 0, 148, 148, 246, 148, 78, 218, 0, 341, 0, 221, 1906, 81, 81,
+    0, 183, 105, 224, 224, 0, 0, 0, 721, 148, 165, 0, 215, 224, 218, 0,
+    108, 125, 221, 78, 105, 148, 221, 0, 227, 128, 44, 148, 125, 108, 408, 0,
+    108, 0, 221, 1537, 165, 108, 105, 105, 221, 105, 0, 108, 224, 0, 691, 165,
+    295, 0, 105, 0, 0, 0, 215, 0, 215, 165, 16, 105, 710, 710, 215, 0,
+    165, 0, 0, 0, 0, 0, 0, 9, 9, 0, 9, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 688, 691, 0, 688, 688, 688, 0, 0, 0, 165, 9, 105,
+    218, 0, 227, 78, 22, 12, 0, 12, 148, 246, 0, 78, 688, 78, 227, 688,
+    1179, 19, 96, 148, 148, 0, 341, 218, 728, 148, 12, 218, 0, 218, 590, 9,
+    0, 1095, 0, 105, 101, 9, 9, 9, 9, 105, 0, 0, 9, 101, 688, 81,
+    78, 227, 148, 91, 105, 148, 9, 117, 12, 148, 218, 12, 44, 78, 44, 218,
+    12, 695, 1537, 0, 0, 341, 0, 44, 16, 0, 215, 16, 1531, 688, 9, 105,
+    27, 0, 105, 218, 27, 9, 9, 218, 0, 218, 148, 779, 218, 0, 0, 900,
+    0, 590, 215, 16, 1, 16, 9, 408, 0, 16, 0, 108, 22, 1, 295, 9,
+    0, 44, 221, 44, 0, 105, 148, 12, 19, 0, 0, 128, 148, 81, 78, 0,
+    246, 695, 0, 1524, 218, 695, 0, 1531, 16, 224, 148, 16, 221, 699, 19, 148,
+    224, 341, 148, 148, 341, 1531, 0, 148, 1537, 221, 224, 0, 699, 0, 706, 1531,
+    699, 0, 12, 16, 44, 0, 148, 148, 148, 148, 0, 148, 105, 108, 0, 105,
+    0, 224, 221, 16, 108, 295, 165, 221, 165, 221, 721, 218, 218, 218, 0, 1531,
+    101, 44, 341, 221, 0, 724, 218, 148, 148, 27, 22, 295, 699, 1537, 78, 16,
+    9, 9, 165, 9, 16, 0, 165, 9, 101, 0, 9, 0, 165, 9, 105, 165,
+    105, 0, 16, 295, 1, 0, 9, 16, 9, 9, 215, 165, 105, 373, 16, 16,
+    16, 0, 105, 295, 9, 16, 9, 308, 105, 0, 586, 101, 16, 0, 16, 9,
+    105, 105, 105, 0, 9, 165, 9, 16, 105, 165, 9, 165, 295, 105, 0, 688,
+    0, 1537, 224, 0, 218, 218, 299, 44, 0, 16, 215, 16, 215, 148, 215, 215,
+    148, 215, 148, 125, 78, 721, 710, 125, 0, 688, 0, 215, 221, 125, 0, 19,
+    0, 148, 0, 0, 0, 0, 44, 0, 0, 0, 0, 218, 291, 16, 16, 0,
+    272, 0, 19, 148, 148, 148, 125, 16, 125, 0, 1524, 215, 78, 125, 117, 0,
+    44, 0, 0, 0, 125, 125, 148, 44, 16, 16, 19, 165, 9, 0, 0, 9,
+    105, 165, 165, 308, 165, 9, 101, 215, 1131, 9, 19, 19, 317, 41, 9, 215,
+    9, 215, 9, 215, 905, 0, 9, 1537, 19, 215, 215, 0, 105, 215, 215, 860,
+    215, 215, 215, 1524, 125, 9, 165, 0, 215, 9, 9, 308, 0, 215, 1233, 105,
+    0, 19, 706, 9, 19, 165, 9, 0, 9, 125, 125, 148, 9, 9, 0, 0,
+    165, 299, 224, 0, 1912, 0, 317, 56, 706, 0, 0, 0, 0, 105, 0, 218,
+    0, 0, 0, 308, 308, 41, 105, 19, 16, 44, 41, 9, 0, 16, 16, 9,
+    308, 0, 9, 19, 215, 125, 16, 230, 9, 215, 0, 19, 19, 215, 19, 9,
+    41, 221, 0, 105, 215, 56, 218, 958, 9, 105, 215, 9, 561, 9, 9, 9,
+    9, 215, 691, 105, 9, 9, 108, 0, 56, 165, 105, 105, 9, 0, 41, 41,
+    0, 165, 9, 215, 105, 0, 9, 9, 0, 9, 0, 561, 187, 613, 9, 125,
+    125, 308, 0, 0, 9, 9, 9, 215, 9, 165, 9, 105, 105, 56, 0, 9,
+    105, 78, 9, 844, 9, 9, 78, 41, 9, 9, 260, 105, 9, 9, 218, 772,
+    250, 105, 250, 295, 1531, 165, 101, 105, 105, 308, 105, 105, 165, 9, 148, 148,
+    0, 19, 165, 148, 148, 0, 125, 125, 148, 148, 125, 9, 16, 101, 101, 0,
+    1524, 0, 1, 710, 215, 215, 215, 148, 0, 0, 295, 1918, 108, 1524, 246, 165,
+    9, 22, 9, 1, 105, 148, 148, 105, 815, 1537, 0, 721, 224, 0, 19, 19,
+    78, 148, 1653, 16, 78, 227, 78, 218, 105, 105, 0, 0, 148, 221, 0, 0,
+    0, 1544, 1565, 12, 148, 815, 221, 1, 218, 710, 586, 121, 699, 0, 1, 218,
+    105, 44, 218, 221, 0, 0, 0, 0, 16, 221, 27, 295, 16, 105, 0, 0,
+    9, 9, 9, 16, 1, 0, 12, 713, 105, 148, 0, 165, 16, 9, 78, 9,
+    218, 16, 165, 0, 165, 430, 0, 16, 148, 341, 710, 16, 105, 16, 148, 608,
+    0, 295, 1, 224, 221, 165, 101, 0, 224, 900, 148, 227, 1764, 148, 165, 341,
+    148, 165, 713, 165, 221, 221, 0, 0, 105, 105, 125, 1524, 108, 12, 165, 9,
+    16, 105, 108, 1, 105, 9, 108, 613, 105, 148, 0, 691, 0, 1527, 22, 9,
+    165, 148, 148, 1524, 148, 148, 19, 148, 148, 227, 221, 0, 16, 16, 0, 0,
+    1, 1, 0, 148, 218, 227, 78, 227, 227, 0, 9, 0, 148, 721, 148, 108,
+    227, 148, 0, 218, 218, 105, 148, 0, 691, 218, 148, 148, 341, 341, 691, 0,
+    815, 0, 9, 44, 44, 732, 44, 44, 218, 218, 56, 27, 857, 56, 695, 815,
+    148, 148, 218, 710, 1537, 0, 0, 27, 688, 0, 44, 227, 732, 148, 218, 688,
+    0, 1, 105, 218, 108, 108, 0, 12, 56, 105, 9, 688, 691, 148, 19, 688,
+    0, 246, 691, 0, 12, 12, 0, 688, 165, 900, 148, 0, 1881, 165, 165, 165,
+    148, 215, 218, 0, 218, 0, 0, 0, 1925, 16, 16, 0, 0, 78, 0, 9,
+    0, 0, 215, 215, 16, 0, 1929, 0, 9, 215, 0, 215, 215, 16, 1524, 218,
+    446, 0, 691, 12, 0, 772, 218, 691, 688, 0, 148, 12, 218, 0, 0, 0,
+    0, 156, 148, 105, 165, 688, 78, 224, 0, 0, 688, 688, 165, 16, 165, 16,
+    125, 1933, 308, 9, 215, 9, 215, 215, 125, 215, 1534, 125, 101, 108, 1520, 125,
+    0, 218, 0, 215, 215, 9, 165, 688, 148, 105, 0, 218, 165, 0, 165, 221,
+    148, 721, 721, 165, 0, 148, 691, 148, 96, 0, 148, 148, 148, 44, 291, 0,
+    148, 44, 148, 0, 148, 0, 148, 148, 148, 9, 900, 699, 0, 78, 78, 148,
+    246, 699, 713, 702, 721, 165, 415, 12, 713, 221, 221, 12, 148, 295, 125, 108,
+    0, 0, 16, 221, 148, 1534, 0, 165, 44, 0, 148, 221, 291, 218, 268, 148,
+    710, 148, 148, 0, 1531, 148, 688, 0, 221, 0, 1524, 221, 0, 1938, 0, 710,
+    125, 165, 0, 1830, 446, 224, 0, 9, 721, 0, 148, 44, 148, 450, 0, 732,
+    148, 148, 148, 44, 227, 16, 108, 0, 148, 148, 78, 0, 105, 0, 0, 148,
+    27, 218, 1, 105, 831, 44, 148, 1531, 0, 101, 408, 0, 9, 0, 165, 583,
+    9, 108, 590, 0, 721, 308, 105, 105, 125, 590, 221, 0, 105, 215, 215, 9,
+    125, 221, 125, 215, 105, 408, 105, 105, 215, 308, 105, 105, 101, 101, 215, 108,
+    101, 105, 125, 215, 408, 0, 125, 9, 101, 165, 125, 215, 221, 215, 721, 101,
+    165, 215, 408, 0, 0, 221, 105, 9, 590, 218, 0, 408, 125, 105, 218, 108,
+    105, 1537, 0, 0, 0, 583, 0, 105, 0, 221, 105, 105, 105, 105, 218, 165,
+    218, 165, 9, 1537, 125, 125, 408, 125, 221, 408, 105, 1, 9, 105, 105, 108,
+    227, 227, 0, 165, 0, 19, 0, 16, 148, 215, 775, 78, 0, 125, 125, 0,
+    125, 148, 0, 125, 125, 19, 148, 272, 0, 19, 16, 272, 125, 78, 1524, 16,
+    0, 0, 19, 272, 0, 117, 16, 16, 19, 19, 16, 125, 125, 117, 488, 0,
+    117, 117, 16, 148, 44, 0, 16, 215, 78, 0, 0, 215, 0, 16, 0, 0,
+    125, 125, 215, 0, 215, 44, 0, 0, 299, 0, 44, 408, 688, 19, 0, 0,
+    221, 215, 16, 148, 19, 19, 19, 19, 272, 224, 0, 0, 699, 16, 224, 0,
+    44, 0, 221, 148, 224, 221, 1714, 148, 488, 215, 215, 148, 44, 215, 16, 148,
+    148, 148, 148, 0, 44, 19, 19, 721, 148, 19, 0, 148, 78, 117, 148, 0,
+    19, 1719, 0, 12, 221, 221, 0, 688, 221, 165, 125, 165, 710, 9, 156, 9,
+    165, 341, 148, 148, 815, 148, 0, 341, 44, 820, 779, 148, 1537, 0, 688, 0,
+    0, 215, 19, 272, 775, 148, 0, 0, 148, 0, 19, 1163, 19, 710, 19, 148,
+    221, 16, 0, 125, 1, 0, 0, 0, 688, 117, 0, 1942, 117, 117, 218, 688,
+    0, 221, 0, 272, 0, 724, 721, 0, 1524, 19, 78, 44, 78, 78, 260, 148,
+    1531, 0, 1, 227, 16, 227, 0, 125, 218, 227, 227, 0, 221, 221, 1531, 0,
+    0, 0, 16, 0, 221, 0, 1949, 0, 721, 1544, 1524, 218, 1524, 0, 148, 0,
+    1531, 221, 0, 221, 221, 710, 0, 148, 0, 0, 0, 0, 0, 148, 125, 0,
+    125, 0, 224, 0, 125, 218, 1729, 125, 125, 0, 125, 44, 221, 1524, 78, 0,
+    125, 16, 16, 272, 0, 0, 148, 272, 19, 148, 0, 0, 688, 227, 0, 44,
+    148, 0, 16, 272, 16, 16, 16, 0, 1544, 272, 272, 16, 16, 272, 0, 0,
+    215, 215, 78, 16, 0, 16, 78, 16, 78, 78, 0, 0, 44, 44, 0, 224,
+    264, 78, 78, 264, 0, 148, 218, 148, 0, 0, 0, 1952, 44, 148, 0, 0,
+    0, 710, 699, 341, 0, 341, 148, 0, 148, 688, 44, 148, 221, 19, 980, 19,
+    19, 227, 0, 148, 44, 341, 148, 148, 221, 148, 218, 44, 19, 19, 19, 16,
+    16, 16, 215, 215, 272, 16, 272, 699, 0, 688, 272, 19, 125, 272, 19, 688,
+    19, 19, 19, 148, 221, 0, 0, 148, 44, 732, 41, 446, 148, 341, 148, 246,
+    16, 688, 218, 44, 78, 0, 148, 148, 688, 148, 148, 105, 9, 218, 218, 341,
+    78, 78, 78, 148, 688, 215, 0, 710, 148, 148, 0, 0, 41, 41, 148, 41,
+    218, 224, 0, 78, 78, 78, 341, 148, 148, 688, 148, 0, 221, 341, 710, 0,
+    0, 0, 724, 0, 1531, 117, 224, 260, 1537, 0, 44, 44, 125, 221, 272, 851,
+    224, 125, 19, 148, 925, 19, 224, 125, 78, 0, 44, 218, 260, 0, 19, 19,
+    16, 224, 0, 0, 0, 1496, 721, 148, 16, 19, 148, 148, 0, 0, 0, 148,
+    148, 0, 19, 218, 16, 0, 0, 0, 148, 221, 0, 1537, 148, 148, 19, 1531,
+    550, 148, 1524, 341, 446, 148, 710, 78, 148, 0, 148, 218, 341, 148, 341, 221,
+    775, 215, 16, 148, 78, 0, 0, 125, 0, 125, 0, 125, 0, 0, 0, 0,
+    272, 16, 19, 272, 0, 19, 19, 16, 0, 272, 117, 117, 19, 125, 211, 148,
+    0, 341, 710, 221, 710, 148, 0, 0, 148, 148, 148, 1, 78, 0, 1, 0,
+    0, 291, 0, 0, 16, 16, 16, 16, 16, 272, 148, 16, 19, 19, 19, 19,
+    688, 16, 721, 0, 0, 0, 78, 221, 710, 0, 16, 688, 215, 78, 16, 1958,
+    0, 78, 148, 224, 775, 224, 218, 772, 148, 0, 221, 148, 341, 218, 148, 0,
+    0, 44, 1531, 44, 446, 0, 0, 699, 1534, 9, 446, 78, 78, 44, 44, 0,
+    78, 9, 0, 710, 0, 691, 44, 218, 44, 0, 772, 218, 721, 691, 713, 1531,
+    1531, 0, 1386, 148, 0, 246, 1527, 713, 0, 221, 0, 44, 373, 0, 1, 148,
+    221, 78, 0, 0, 1531, 1441, 0, 713, 721, 148, 706, 0, 148, 713, 0, 224,
+    0, 1565, 0, 221, 691, 710, 0, 699, 78, 710, 221, 0, 1768, 699, 688, 0,
+    446, 0, 688, 710, 0, 221, 710, 218, 0, 221, 1524, 0, 0, 218, 0, 706,
+    772, 1964, 0, 1714, 1531, 224, 721, 224, 702, 0, 221, 221, 0, 0, 772, 221,
+    688, 41, 0, 41, 1531, 221, 0, 706, 221, 1531, 732, 41, 713, 41, 221, 706,
+    221, 221, 0, 221, 713, 0, 221, 1653, 0, 0, 221, 724, 1531, 224, 1969, 721,
+    221, 721, 0, 19, 691, 221, 702, 0, 1974, 706, 221, 0, 221, 0, 710, 41,
+    41, 148, 1981, 0, 1661, 221, 0, 699, 0, 702, 1544, 0, 218, 710, 721, 1524,
+    0, 221, 713, 221, 41, 218, 710, 221, 710, 41, 148, 148, 341, 148, 224, 0,
+    148, 1524, 19, 215, 1553, 221, 1147, 1520, 260, 16, 78, 125, 1537, 78, 125, 1537,
+    1537, 19, 148, 218, 721, 1531, 148, 44, 215, 218, 0, 9, 221, 1537, 221, 691,
+    1534, 227, 22, 22, 1537, 218, 1524, 78, 272, 224, 16, 0, 218, 1524, 713, 0,
+    224, 221, 688, 156, 9, 148, 341, 341, 22, 218, 0, 1544, 218, 218, 1531, 446,
+    44, 218, 291, 1537, 0, 215, 9, 44, 0, 688, 0, 16, 721, 9, 9, 0,
+    221, 148, 19, 900, 16, 0, 215, 0, 12, 12, 16, 101, 0, 16, 165, 0,
+    0, 9, 0, 0, 0, 16, 1985, 1531, 0, 0, 224, 0, 1, 221, 108, 221,
+    78, 44, 44, 221, 0, 221, 221, 19, 772, 9, 706, 1531, 688, 1649, 688, 148,
+    0, 713, 721, 19, 78, 218, 732, 227, 221, 221, 0, 0, 922, 1524, 148, 1531,
+    0, 221, 0, 0, 224, 1531, 78, 215, 1537, 775, 775, 0, 211, 211, 78, 688,
+    148, 0, 44, 44, 227, 1531, 9, 12, 0, 12, 156, 9, 221, 1524, 16, 9,
+    0, 165, 9, 16, 9, 19, 19, 710, 9, 0, 710, 12, 9, 221, 16, 326,
+    945, 221, 699, 710, 702, 713, 221, 221, 710, 1524, 706, 264, 264, 0, 925, 0,
+    373, 148, 0, 221, 0, 688, 218, 0, 1732, 0, 218, 0, 41, 246, 710, 16,
+    16, 19, 0, 699, 0, 148, 44, 227, 78, 78, 0, 688, 0, 0, 227, 148,
+    710, 721, 1531, 1524, 0, 699, 713, 19, 19, 702, 0, 721, 1534, 218, 1527, 0,
+    341, 221, 148, 1537, 78, 272, 16, 117, 1553, 688, 1147, 1147, 148, 148, 117, 19,
+    0, 272, 1991, 1531, 16, 1084, 1991, 16, 16, 16, 0, 218, 224, 218, 713, 710,
+    1153, 227, 16, 125, 688, 117, 16, 272, 78, 1565, 0, 221, 221, 721, 272, 272,
+    16, 1147, 1147, 221, 0, 0, 1527, 218, 221, 341, 221, 148, 16, 221, 272, 218,
+    0, 78, 148, 0, 0, 1661, 341, 16, 688, 721, 1524, 1544, 221, 713, 0, 721,
+    710, 218, 772, 224, 224, 0, 710, 0, 710, 695, 1997, 224, 0, 702, 224, 224,
+    702, 2000, 0, 218, 1649, 0, 1649, 710, 1997, 224, 0, 721, 721, 224, 224, 0,
+    710, 710, 710, 695, 1524, 0, 224, 0, 224, 2003, 224, 224, 0, 224, 0, 224,
+    224, 0, 224, 702, 0, 0, 702, 2009, 721, 710, 218, 224, 224, 1524, 1649, 772,
+    0, 0, 1524, 224, 721, 218, 0, 218, 0, 224, 224, 710, 702, 1997, 710, 224,
+    0, 224, 702, 218, 0, 710, 0, 710, 0, 1524, 0, 0, 1534, 224, 702, 0,
+    0, 1520, 2015, 0, 218, 218, 0, 0, 710, 922, 0, 0, 721, 0, 1534, 0,
+    0, 0, 0, 0, 0, 710, 0, 1524, 1649, 1649, 224, 0, 0, 1534, 224, 0,
+    224, 2020, 224, 224, 721, 710, 0, 224, 710, 0, 0, 710, 710, 0, 0, 710,
+    710, 2000, 1524, 1649, 710, 1649, 710, 1997, 224, 0, 0, 702, 78, 125, 224, 215,
+    890, 890, 890, 215, 710, 218, 710, 224, 0, 0, 0, 0, 0, 224, 2000, 218,
+    710, 215, 0, 224, 224, 224, 1524, 224, 224, 224, 0, 702, 264, 0, 224, 710,
+    732, 732, 44, 1524, 0, 1524, 0, 0, 0, 224, 224, 224, 125, 373, 1524, 224,
+    1524, 44, 2023, 732, 732, 218, 2000, 78, 488, 125, 710, 710, 2029, 224, 78, 218,
+    0, 732, 0, 0, 1534, 0, 44, 2034, 732, 224, 224, 0, 44, 44, 218, 732,
+    224, 218, 0, 732, 0, 224, 0, 710, 215, 215, 44, 105, 772, 732, 2023, 732,
+    218, 0, 0, 732, 44, 2040, 165, 218, 710, 165, 218, 224, 732, 218, 0, 1524,
+    1524, 1524, 0, 488, 218, 218, 721, 218, 44, 218, 1065, 44, 0, 0, 224, 218,
+    224, 224, 215, 215, 2044, 0, 215, 488, 0, 0, 218, 721, 78, 44, 732, 218,
+    264, 0, 0, 1524, 695, 218, 721, 710, 224, 0, 224, 224, 44, 218, 44, 218,
+    218, 125, 1649, 218, 0, 105, 165, 44, 218, 218, 224, 732, 218, 224, 0, 0,
+    732, 732, 732, 218, 44, 165, 224, 0, 2050, 732, 2000, 2056, 2060, 0, 732, 702,
+    702, 0, 224, 224, 224, 0, 2000, 218, 0, 224, 732, 1524, 1524, 224, 224, 0,
+    710, 218, 2065, 373, 732, 44, 44, 702, 224, 105, 0, 721, 224, 732, 44, 224,
+    224, 710, 702, 224, 721, 224, 224, 0, 1524, 218, 2015, 224, 125, 44, 0, 2000,
+    218, 44, 2069, 218, 784, 732, 2000, 732, 224, 710, 721, 224, 224, 224, 0, 1520,
+    2003, 0, 0, 710, 215, 857, 1191, 218, 218, 215, 488, 1534, 44, 2000, 721, 702,
+    1524, 224, 224, 224, 218, 78, 1534, 1534, 0, 165, 0, 264, 78, 224, 105, 224,
+    224, 105, 105, 539, 0, 105, 0, 165, 0, 165, 44, 0, 105, 105, 0, 2074,
+    0, 44, 224, 224, 2000, 224, 78, 108, 0, 224, 1534, 264, 78, 0, 224, 732,
+    1524, 78, 1524, 721, 702, 224, 702, 218, 2000, 732, 105, 555, 721, 710, 0, 2081,
+    0, 0, 0, 78, 732, 44, 2023, 732, 264, 264, 1534, 218, 1524, 0, 1524, 0,
+    0, 105, 218, 0, 710, 218, 224, 1534, 0, 78, 0, 0, 224, 0, 78, 224,
+    1524, 721, 0, 224, 0, 0, 78, 264, 44, 732, 732, 732, 44, 224, 1524, 224,
+    0, 224, 0, 772, 78, 215, 215, 44, 721, 78, 215, 0, 78, 215, 299, 211,
+    215, 299, 488, 224, 732, 1534, 44, 44, 2087, 732, 211, 1524, 44, 224, 1997, 224,
+    702, 44, 218, 218, 44, 0, 772, 218, 0, 695, 0, 215, 224, 695, 710, 710,
+    224, 0, 710, 2023, 702, 2000, 44, 702, 0, 224, 0, 1061, 1534, 1524, 215, 488,
+    710, 218, 218, 44, 44, 0, 224, 224, 732, 224, 44, 0, 2000, 105, 0, 732,
+    218, 44, 44, 44, 218, 218, 0, 218, 2023, 0, 0, 44, 44, 0, 224, 224,
+    224, 165, 0, 224, 165, 165, 0, 0, 0, 224, 0, 44, 732, 0, 732, 0,
+    224, 710, 44, 44, 1524, 710, 0, 218, 218, 2023, 78, 215, 78, 732, 1524, 1524,
+    78, 78, 0, 125, 1649, 215, 0, 2093, 215, 488, 710, 0, 224, 218, 44, 44,
+    218, 218, 373, 0, 1658, 218, 784, 0, 44, 373, 732, 1524, 1524, 0, 2099, 0,
+    44, 44, 0, 721, 1649, 44, 44, 710, 2023, 264, 218, 695, 224, 125, 215, 105,
+    215, 44, 488, 44, 215, 488, 488, 105, 44, 1520, 218, 218, 0, 218, 218, 732,
+    2050, 218, 732, 0, 218, 125, 78, 373, 1534, 218, 224, 0, 224, 0, 732, 218,
+    44, 44, 224, 44, 165, 732, 224, 105, 165, 218, 732, 44, 732, 0, 2000, 0,
+    215, 710, 78, 125, 215, 165, 721, 2023, 218, 1524, 224, 78, 224, 488, 78, 0,
+    78, 78, 78, 0, 218, 215, 215, 215, 0, 721, 215, 710, 105, 215, 710, 105,
+    0, 721, 224, 732, 105, 165, 105, 105, 105, 2107, 105, 165, 105, 105, 165, 165,
+    165, 1524, 732, 732, 44, 44, 44, 165, 125, 224, 1649, 105, 78, 0, 105, 224,
+    105, 732, 2023, 2050, 44, 44, 215, 165, 44, 732, 78, 0, 44, 2015, 224, 224,
+    721, 710, 218, 44, 215, 1997, 1524, 224, 218, 44, 44, 1524, 721, 44, 44, 215,
+    215, 215, 215, 0, 732, 0, 0, 732, 2050, 732, 0, 218, 373, 125, 218, 44,
+    710, 710, 702, 215, 0, 1534, 44, 44, 710, 721, 2000, 0, 0, 732, 1997, 732,
+    44, 0, 721, 710, 44, 44, 1520, 0, 125, 702, 0, 0, 0, 224, 702, 224,
+    1649, 224, 78, 1524, 0, 1061, 702, 0, 105, 108, 44, 224, 44, 108, 732, 218,
+    2050, 224, 2065, 2081, 224, 224, 1520, 721, 721, 1534, 1534, 218, 0, 78, 218, 224,
+    224, 218, 2087, 0, 1534, 1534, 44, 2087, 2000, 224, 224, 772, 1772, 224, 702, 0,
+    0, 702, 224, 0, 0, 215, 215, 215, 125, 125, 488, 215, 215, 78, 44, 44,
+    44, 44, 0, 0, 2000, 44, 218, 0, 0, 224, 2000, 710, 105, 710, 373, 44,
+    590, 215, 0, 702, 721, 224, 2040, 0, 710, 702, 2000, 0, 44, 218, 44, 732,
+    1534, 218, 224, 105, 108, 218, 1524, 105, 732, 0, 1524, 44, 224, 78, 44, 44,
+    44, 2050, 732, 1524, 224, 1524, 2081, 125, 224, 2081, 218, 0, 138, 732, 78, 732,
+    732, 44, 44, 0, 2111, 2000, 702, 218, 0, 0, 125, 721, 710, 0, 1534, 0,
+    125, 710, 218, 0, 215, 1573, 44, 0, 215, 44, 125, 44, 218, 215, 211, 44,
+    0, 224, 215, 218, 218, 105, 2020, 224, 1520, 721, 0, 2015, 710, 2060, 1649, 1524,
+    224, 224, 0, 224, 224, 224, 0, 224, 224, 2000, 0, 695, 224, 224, 0, 224,
+    224, 0, 224, 224, 218, 218, 732, 224, 224, 224, 224, 224, 0, 702, 125, 702,
+    224, 211, 218, 218, 44, 44, 218, 44, 2000, 224, 224, 224, 218, 44, 224, 539,
+    0, 44, 0, 44, 0, 1524, 1524, 0, 1524, 224, 0, 224, 125, 78, 0, 0,
+    0, 224, 224, 1649, 125, 224, 1997, 488, 215, 2115, 218, 710, 0, 218, 125, 125,
+    1524, 710, 721, 488, 2000, 0, 2000, 78, 2000, 0, 44, 224, 44, 710, 710, 44,
+    215, 215, 721, 0, 215, 0, 710, 0, 125, 0, 215, 732, 78, 218, 224, 488,
+    215, 215, 0, 224, 224, 488, 44, 215, 211, 125, 488, 125, 78, 218, 215, 211,
+    211, 44, 218, 488, 44, 44, 264, 218, 488, 488, 0, 215, 488, 488, 215, 488,
+    488, 215, 215, 0, 0, 78, 0, 78, 0, 0, 0, 0, 0, 78, 78, 78,
+    215, 125, 78, 0, 215, 0, 299, 1470, 44, 732, 44, 732, 264, 78, 0, 732,
+    218, 732, 732, 44, 1534, 1534, 2000, 2009, 224, 702, 0, 0, 125, 125, 125, 125,
+    125, 211, 224, 218, 0, 0, 0, 218, 0, 1997, 224, 0, 224, 224, 710, 0,
+    0, 224, 44, 218, 44, 44, 1524, 0, 0, 0, 0, 224, 0, 2015, 0, 1524,
+    1524, 0, 0, 224, 125, 44, 732, 1534, 732, 224, 702, 218, 218, 218, 2040, 0,
+    721, 732, 732, 732, 218, 224, 44, 732, 0, 215, 0, 224, 0, 710, 44, 78,
+    0, 1997, 0, 0, 211, 218, 732, 0, 211, 373, 218, 2023, 224, 215, 215, 710,
+    710, 215, 215, 702, 488, 44, 44, 78, 925, 224, 218, 2000, 224, 0, 721, 958,
+    44, 488, 488, 78, 710, 2121, 165, 732, 702, 0, 702, 165, 732, 710, 2050, 0,
+    165, 224, 165, 105, 224, 44, 732, 218, 165, 105, 44, 44, 78, 44, 44, 2087,
+    2087, 215, 215, 2127, 721, 0, 0, 215, 721, 215, 2044, 721, 215, 0, 215, 721,
+    215, 215, 44, 215, 0, 702, 488, 2000, 218, 218, 78, 218, 215, 215, 0, 0,
+    218, 218, 0, 224, 224, 224, 224, 2000, 218, 732, 0, 710, 2000, 215, 702, 224,
+    224, 2000, 1997, 44, 218, 224, 224, 224, 0, 721, 105, 0, 224, 1649, 710, 0,
+    1649, 218, 44, 44, 1524, 2081, 0, 105, 105, 105, 0, 357, 0, 224, 78, 218,
+    105, 215, 125, 0, 0, 1524, 125, 357, 125, 224, 108, 0, 224, 224, 0, 224,
+    710, 105, 721, 1534, 224, 0, 1997, 2000, 224, 224, 2000, 0, 710, 215, 488, 215,
+    215, 215, 215, 488, 224, 2000, 1997, 710, 224, 224, 44, 224, 721, 0, 0, 218,
+    1524, 0, 44, 218, 165, 710, 702, 702, 224, 224, 702, 2000, 0, 710, 224, 224,
+    0, 488, 488, 224, 218, 2020, 721, 721, 215, 224, 0, 215, 488, 0, 2093, 0,
+    710, 218, 2065, 2134, 224, 224, 224, 0, 710, 0, 108, 0, 0, 0, 224, 721,
+    1520, 224, 105, 105, 105, 105, 44, 105, 224, 224, 702, 224, 0, 2081, 218, 105,
+    555, 0, 710, 125, 2023, 732, 44, 44, 1658, 44, 125, 215, 165, 0, 215, 215,
+    308, 108, 1524, 215, 105, 0, 308, 224, 224, 224, 224, 224, 125, 1534, 0, 224,
+    224, 78, 215, 224, 1997, 710, 710, 2138, 165, 224, 710, 732, 224, 224, 224, 105,
+    78, 44, 710, 224, 125, 44, 78, 0, 215, 721, 0, 215, 215, 0, 710, 0,
+    215, 488, 488, 78, 224, 264, 215, 44, 215, 215, 211, 488, 78, 1997, 215, 215,
+    215, 125, 732, 0, 215, 488, 2000, 125, 125, 0, 710, 78, 224, 710, 0, 710,
+    710, 218, 732, 2000, 224, 710, 224, 2003, 224, 0, 721, 732, 1524, 0, 488, 224,
+    1997, 78, 0, 710, 44, 0, 710, 44, 218, 215, 721, 0, 1997, 224, 732, 732,
+    44, 218, 224, 1437, 0, 710, 1997, 0, 264, 1534, 702, 0, 78, 2081, 224, 0,
+    224, 224, 1065, 702, 0, 0, 710, 721, 44, 224, 224, 108, 1524, 1524, 105, 224,
+    0, 721, 0, 44, 0, 2000, 224, 224, 0, 1524, 1687, 44, 44, 2087, 772, 224,
+    224, 215, 215, 224, 224, 224, 0, 2000, 224, 732, 218, 218, 732, 2023, 488, 0,
+    0, 215, 488, 215, 215, 215, 215, 488, 78, 264, 218, 44, 224, 0, 108, 224,
+    224, 224, 1997, 2040, 2000, 125, 721, 0, 0, 732, 0, 2050, 44, 732, 1997, 2000,
+    105, 44, 710, 0, 224, 78, 1649, 0, 224, 721, 215, 215, 299, 1997, 0, 224,
+    958, 0, 0, 44, 925, 224, 224, 224, 44, 224, 224, 108, 108, 408, 105, 108,
+    108, 105, 224, 224, 224, 1524, 1524, 1524, 1524, 1524, 224, 721, 695, 0, 721, 224,
+    78, 710, 44, 1524, 1383, 224, 44, 224, 264, 218, 218, 44, 0, 0, 224, 721,
+    710, 78, 224, 215, 710, 488, 224, 78, 215, 78, 44, 44, 732, 721, 218, 224,
+    710, 710, 0, 44, 710, 78, 44, 2000, 224, 218, 78, 0, 1997, 0, 44, 125,
+    215, 0, 215, 0, 0, 215, 215, 78, 710, 44, 78, 488, 215, 78, 224, 1997,
+    125, 488, 215, 215, 488, 78, 0, 215, 125, 218, 215, 0, 44, 215, 0, 0,
+    44, 0, 125, 0, 215, 0, 44, 215, 215, 44, 1570, 44, 710, 224, 215, 215,
+    215, 78, 224, 0, 0, 0, 0, 1534, 673, 44, 78, 44, 78, 488, 44, 224,
+    702, 224, 2142, 2000, 0, 2093, 215, 78, 710, 0, 0, 215, 105, 0, 721, 224,
+    0, 1524, 0, 702, 218, 44, 2000, 710, 0, 44, 732, 44, 224, 1534, 44, 125,
+    0, 0, 732, 0, 218, 710, 0, 2050, 732, 732, 44, 732, 224, 78, 215, 710,
+    0, 0, 0, 44, 488, 710, 44, 218, 772, 772, 732, 732, 721, 218, 0, 1649,
+    710, 0, 218, 732, 125, 0, 44, 218, 732, 2023, 218, 44, 44, 2147, 218, 732,
+    218, 218, 44, 732, 0, 732, 44, 732, 721, 721, 218, 218, 2023, 732, 2023, 1524,
+    2023, 78, 1534, 0, 1658, 218, 218, 218, 224, 215, 78, 224, 218, 78, 44, 44,
+    224, 224, 710, 710, 224, 44, 702, 0, 732, 218, 44, 0, 0, 702, 224, 0,
+    2000, 710, 732, 218, 0, 1534, 702, 1524, 224, 215, 215, 0, 2153, 224, 224, 224,
+    2000, 165, 165, 165, 165, 224, 0, 224, 224, 218, 224, 721, 0, 0, 1649, 0,
+    710, 1524, 2000, 2000, 218, 78, 2060, 44, 732, 218, 224, 2000, 218, 44, 0, 218,
+    1524, 78, 732, 44, 784, 44, 732, 224, 0, 0, 218, 224, 702, 925, 0, 0,
+    224, 56, 211, 44, 702, 702, 224, 0, 0, 925, 224, 224, 224, 218, 218, 78,
+    218, 0, 218, 0, 488, 0, 0, 215, 695, 0, 488, 0, 721, 1649, 44, 732,
+    224, 224, 105, 224, 105, 165, 215, 0, 165, 772, 218, 710, 1709, 2020, 44, 0,
+    710, 0, 105, 2000, 0, 224, 224, 224, 105, 224, 0, 0, 0, 165, 125, 0,
+    702, 108, 105, 108, 215, 308, 215, 224, 108, 590, 125, 44, 224, 224, 0, 0,
+    105, 224, 224, 215, 44, 0, 224, 224, 44, 224, 224, 215, 1524, 215, 224, 78,
+    710, 702, 0, 1649, 958, 224, 215, 0, 165, 1524, 78, 0, 224, 224, 44, 44,
+    224, 0, 721, 0, 108, 224, 215, 1061, 2087, 44, 0, 218, 165, 1524, 215, 1520,
+    0, 0, 44, 44, 732, 44, 732, 44, 732, 218, 732, 732, 44, 1649, 224, 215,
+    702, 488, 0, 2000, 44, 224, 224, 0, 165, 1534, 224, 0, 224, 224, 721, 2127,
+    0, 215, 488, 215, 218, 218, 215, 215, 215, 1383, 1383, 0, 44, 2158, 218, 211,
+    218, 218, 125, 218, 1524, 488, 125, 44, 488, 1524, 488, 78, 215, 2093, 488, 0,
+    0, 488, 710, 44, 78, 78, 78, 78, 218, 732, 224, 2000, 0, 224, 0, 702,
+    44, 0, 2000, 215, 224, 1524, 488, 0, 44, 408, 108, 44, 224, 125, 721, 224,
+    224, 165, 105, 732, 224, 702, 721, 165, 0, 218, 105, 105, 105, 2162, 105, 583,
+    583, 583, 1407, 0, 105, 0, 105, 105, 224, 105, 0, 105, 105, 105, 105, 105,
+    105, 105, 105, 105, 105, 105, 105, 108, 218, 105, 105, 710, 105, 224, 105, 0,
+    105, 105, 1524, 710, 218, 1524, 44, 108, 710, 1534, 105, 710, 215, 105, 105, 0,
+    105, 218, 44, 105, 44, 44, 44, 1772, 105, 0, 105, 105, 105, 224, 218, 125,
+    0, 732, 732, 105, 108, 125, 105, 2081, 218, 78, 78, 0, 721, 710, 0, 710,
+    1524, 224, 218, 125, 695, 721, 721, 2000, 44, 732, 165, 224, 105, 224, 218, 218,
+    224, 78, 165, 215, 0, 105, 105, 105, 105, 1524, 0, 105, 165, 105, 165, 224,
+    218, 0, 78, 215, 44, 218, 0, 0, 78, 44, 710, 0, 78, 0, 710, 710,
+    488, 1534, 125, 2000, 211, 125, 211, 211, 125, 125, 105, 105, 218, 78, 105, 2170,
+    108, 0, 2179, 105, 105, 105, 105, 105, 710, 0, 215, 0, 224, 0, 488, 215,
+    215, 0, 165, 308, 78, 0, 308, 710, 215, 925, 224, 105, 105, 105, 105, 105,
+    44, 710, 105, 299, 105, 105, 105, 2182, 105, 2040, 165, 215, 105, 44, 105, 710,
+    1534, 2000, 2000, 0, 2000, 0, 125, 224, 1524, 732, 218, 44, 0, 44, 0, 702,
+    721, 721, 702, 710, 710, 44, 105, 224, 224, 215, 105, 105, 44, 165, 165, 165,
+    165, 0, 308, 224, 2000, 165, 695, 0, 2000, 0, 0, 2000, 0, 125, 0, 44,
+    218, 218, 0, 0, 44, 218, 165, 105, 108, 710, 105, 264, 732, 44, 44, 44,
+    108, 732, 44, 224, 108, 108, 0, 721, 0, 555, 224, 105, 108, 125, 732, 732,
+    44, 44, 732, 1534, 1534, 732, 44, 44, 0, 857, 857, 857, 0, 215, 0, 215,
+    215, 215, 215, 0, 218, 1658, 165, 165, 105, 224, 224, 224, 215, 0, 215, 215,
+    215, 215, 215, 108, 215, 105, 224, 218, 224, 0, 1163, 44, 702, 1997, 218, 218,
+    2023, 105, 224, 224, 44, 224, 732, 44, 224, 125, 2000, 224, 224, 44, 0, 1534,
+    1534, 44, 44, 44, 44, 0, 2020, 0, 224, 0, 0, 702, 1524, 0, 44, 224,
+    0, 218, 218, 218, 224, 125, 224, 224, 224, 105, 408, 772, 0, 583, 408, 224,
+    721, 224, 224, 224, 224, 105, 224, 710, 0, 224, 0, 215, 0, 2044, 0, 215,
+    710, 215, 224, 0, 125, 44, 78, 44, 78, 215, 215, 215, 488, 215, 125, 44,
+    211, 211, 215, 215, 44, 215, 488, 78, 0, 1772, 224, 224, 215, 215, 215, 224,
+    732, 2065, 224, 108, 1061, 1524, 218, 44, 224, 44, 2000, 2187, 488, 215, 488, 0,
+    2065, 44, 165, 78, 211, 44, 218, 702, 0, 488, 488, 44, 0, 224, 0, 721,
+    218, 215, 0, 224, 721, 224, 224, 0, 0, 224, 44, 732, 125, 2191, 264, 125,
+    2050, 1524, 1524, 1524, 0, 218, 1593, 224, 1520, 125, 125, 1649, 215, 215, 215, 44,
+    732, 218, 2015, 1524, 215, 224, 710, 0, 488, 78, 224, 224, 44, 44, 732, 218,
+    1524, 44, 224, 125, 125, 44, 1687, 44, 0, 224, 710, 0, 218, 0, 218, 218,
+    488, 165, 1520, 925, 224, 224, 0, 1524, 1524, 710, 1997, 2000, 44, 218, 218, 218,
+    218, 1520, 710, 224, 1534, 0, 215, 215, 224, 0, 218, 2000, 0, 44, 44, 44,
+    218, 215, 215, 125, 215, 0, 2044, 721, 0, 215, 215, 218, 224, 218, 0, 78,
+    2196, 373, 218, 1524, 44, 44, 218, 78, 211, 1570, 215, 224, 1008, 0, 224, 224,
+    44, 44, 44, 44, 218, 732, 44, 0, 44, 1437, 78, 224, 0, 224, 224, 44,
+    2199, 0, 0, 2000, 0, 1665, 1997, 0, 224, 224, 0, 224, 0, 0, 224, 44,
+    78, 2087, 44, 78, 0, 78, 0, 702, 0, 218, 1534, 0, 0, 0, 0, 2000,
+    224, 702, 1534, 1534, 0, 0, 224, 1540, 0, 224, 702, 224, 721, 0, 224, 1524,
+    1772, 224, 0, 0, 1534, 224, 224, 224, 0, 710, 710, 0, 0, 1649, 44, 44,
+    215, 2009, 78, 702, 702, 702, 0, 0, 105, 105, 224, 702, 108, 215, 224, 0,
+    224, 224, 105, 224, 224, 1772, 224, 108, 702, 710, 0, 0, 224, 0, 224, 224,
+    2000, 2009, 78, 1065, 224, 224, 105, 721, 2000, 702, 78, 218, 44, 105, 0, 105,
+    0, 1687, 125, 44, 1534, 710, 721, 218, 218, 772, 710, 224, 0, 0, 218, 44,
+    44, 44, 44, 224, 1534, 710, 125, 1524, 2044, 1997, 218, 218, 0, 215, 224, 0,
+    224, 224, 218, 2040, 1997, 2023, 710, 0, 2202, 2199, 2206, 2210, 922, 2214, 2219, 0,
+    0, 1729, 922, 772, 0, 2199, 0, 2219, 0, 0, 922, 1938, 2210, 0, 2219, 0,
+    2222, 2020, 1658, 2206, 925, 1729, 0, 0, 772, 2225, 2199, 2219, 2229, 925, 0, 0,
+    0, 0, 0, 2219, 0, 0, 0, 1729, 0, 922, 0, 2236, 922, 0, 1065, 772,
+    0, 2210, 0, 1065, 0, 922, 1065, 922, 0, 1729, 1729, 1065, 1065, 925, 0, 922,
+    1570, 2241, 922, 1729, 772, 1065, 1065, 772, 772, 772, 922, 0, 1729, 857, 1729, 1065,
+    772, 2199, 2210, 373, 373, 0, 1570, 373, 1065, 2199, 2245, 922, 1065, 1658, 922, 1065,
+    2241, 1570, 1065, 2210, 2251, 1938, 2255, 1570, 1938, 373, 583, 922, 0, 2260, 583, 583,
+    0, 922, 1570, 772, 1065, 1065, 2210, 1065, 1729, 1570, 0, 0, 583, 925, 1065, 373,
+    925, 1729, 2199, 2020, 1065, 922, 857, 2267, 1658, 1065, 1065, 0, 1065, 1065, 772, 408,
+    1065, 2272, 772, 1729, 1065, 408, 1065, 1065, 1570, 2278, 2199, 2241, 772, 2282, 857, 925,
+    925, 2222, 373, 1729, 1729, 922, 772, 922, 925, 1065, 772, 922, 373, 925, 0, 0,
+    772, 925, 925, 772, 772, 772, 772, 1729, 1729, 0, 1065, 1065, 2199, 2199, 1570, 1065,
+    1065, 1065, 2210, 925, 1065, 2199, 1065, 1065, 1065, 922, 2288, 772, 1570, 0, 1065, 1729,
+    2199, 1570, 2278, 1065, 2219, 1065, 1065, 583, 925, 1065, 1065, 925, 1065, 1570, 0, 1065,
+    2210, 0, 922, 1938, 2294, 922, 1570, 857, 772, 1065, 1065, 1065, 1065, 1065, 2210, 2206,
+    2210, 2219, 1065, 1570, 0, 1570, 583, 2272, 299, 2219, 1938, 1729, 2241, 0, 1570, 1065,
+    922, 2300, 922, 922, 857, 2210, 922, 2199, 857, 857, 922, 922, 0, 857, 2306, 857,
+    373, 857, 1570, 1570, 772, 1729, 2278, 2300, 1065, 2222, 1065, 1065, 0, 922, 1729, 0,
+    1729, 1729, 0, 1729, 1729, 1938, 1658, 2245, 857, 1065, 373, 1570, 857, 0, 299, 922,
+    857, 1570, 1065, 772, 2300, 922, 1570, 857, 2310, 299, 857, 2300, 1065, 1570, 857, 0,
+    1065, 1570, 0, 2251, 1065, 0, 2318, 2206, 1065, 2272, 1729, 857, 2210, 0, 1065, 2210,
+    1065, 922, 2210, 2210, 2210, 2210, 2202, 1065, 925, 2300, 2306, 2199, 1065, 2020, 0, 1065,
+    1065, 1938, 1065, 408, 583, 2323, 2199, 2219, 373, 2327, 857, 0, 1570, 1570, 922, 922,
+    1065, 2278, 772, 0, 925, 925, 1065, 1065, 1065, 1065, 2199, 2288, 583, 925, 2210, 922,
+    2245, 2332, 772, 2338, 2272, 1570, 922, 2294, 1065, 373, 0, 0, 1570, 1065, 1065, 925,
+    925, 1658, 922, 2300, 925, 772, 1065, 2245, 2332, 2306, 922, 922, 1658, 1570, 2219, 925,
+    0, 925, 0, 857, 772, 0, 772, 2342, 2342, 772, 922, 2210, 857, 922, 1065, 857,
+    373, 922, 925, 2199, 0, 2267, 0, 0, 1065, 772, 1729, 2199, 1938, 2222, 772, 1729,
+    857, 1729, 1729, 772, 772, 0, 0, 2199, 1065, 1065, 1065, 922, 1065, 1658, 925, 922,
+    1938, 1065, 2210, 2346, 925, 0, 0, 922, 0, 0, 2199, 2199, 2210, 583, 0, 922,
+    2219, 1065, 1065, 1065, 2332, 2199, 2332, 2199, 408, 857, 857, 2210, 922, 0, 2210, 1065,
+    2251, 2210, 373, 2219, 1570, 1065, 1065, 1065, 1065, 857, 772, 2267, 857, 857, 0, 922,
+    1570, 2020, 1065, 0, 922, 1065, 772, 583, 583, 0, 922, 0, 583, 1065, 373, 1938,
+    2323, 922, 2219, 922, 1065, 922, 922, 1065, 583, 1729, 1938, 1065, 857, 583, 583, 1570,
+    2210, 583, 1065, 1065, 922, 2245, 1658, 1065, 1065, 1065, 1065, 2020, 1065, 1065, 922, 373,
+    1065, 1065, 1065, 1065, 583, 583, 857, 583, 857, 1065, 1065, 1065, 1065, 1065, 1570, 922,
+    0, 2255, 2210, 1729, 299, 0, 1065, 2219, 373, 857, 2306, 2210, 922, 0, 0, 2210,
+    2210, 0, 1065, 1065, 1570, 1729, 1570, 857, 857, 373, 2219, 0, 1658, 922, 1570, 0,
+    925, 925, 772, 1065, 0, 1065, 1065, 1065, 0, 0, 925, 1065, 1065, 2219, 2332, 373,
+    772, 2199, 2219, 922, 922, 1065, 1065, 2332, 408, 1065, 1065, 2199, 2210, 2245, 2210, 0,
+    1065, 2020, 922, 1065, 2245, 1729, 1065, 1065, 1065, 2251, 1065, 2210, 1065, 1065, 2219, 0,
+    772, 772, 1658, 2351, 2351, 1729, 2245, 2219, 2357, 2360, 0, 0, 2360, 0, 1949, 0,
+    2363, 2363, 2366, 2360, 2363, 0, 0, 0, 0, 0, 2372, 2372, 2372, 0, 2372, 0,
+    0, 2363, 2375, 2360, 2360, 0, 2360, 2378, 2360, 2357, 2357, 2381, 2357, 0, 2360, 2385,
+    2388, 2394, 2400, 2403, 1949, 2406, 2372, 2394, 1206, 0, 2363, 2363, 2385, 2357, 0, 2372,
+    2410, 0, 1949, 0, 2360, 2400, 2363, 2406, 0, 0, 2378, 2414, 1206, 2179, 0, 2363,
+    2363, 2357, 2375, 2357, 2363, 0, 2400, 2410, 2406, 2357, 2363, 0, 2363, 2417, 2375, 2363,
+    1206, 2421, 2372, 2357, 2375, 2363, 2363, 0, 2363, 2388, 2363, 2426, 2360, 0, 2430, 0,
+    2436, 2196, 0, 2375, 2406, 2439, 2372, 0, 2445, 0, 2378, 0, 2357, 2363, 0, 2406,
+    2357, 2436, 2445, 0, 1206, 2357, 2357, 2360, 0, 2449, 2372, 2436, 2360, 0, 2357, 0,
+    0, 0, 2360, 2360, 2363, 2360,
+};
+
+static const uint8_t hyph_deLevels[2453] = {
+    0, 1, 1, 1, 0, 3, 2, 1, 1, 0, 1, 2, 0, 2, 2, 1,
+    1, 1, 2, 2, 1, 1, 0, 3, 2, 1, 2, 0, 2, 4, 1, 0,
+    3, 2, 5, 4, 0, 3, 2, 1, 4, 0, 1, 1, 2, 1, 4, 0,
+    3, 4, 5, 2, 1, 2, 2, 4, 0, 2, 4, 5, 0, 3, 3, 2,
+    1, 0, 2, 1, 2, 1, 2, 2, 2, 0, 3, 1, 2, 2, 2, 1,
+    3, 0, 3, 4, 1, 2, 0, 3, 2, 1, 6, 0, 3, 2, 3, 2,
+    0, 3, 4, 3, 2, 0, 2, 2, 3, 0, 1, 4, 0, 2, 4, 3,
+    0, 3, 2, 0, 1, 1, 2, 3, 2, 1, 2, 1, 2, 1, 1, 3,
+    0, 3, 2, 3, 4, 0, 3, 4, 1, 4, 0, 3, 4, 3, 4, 0,
+    3, 4, 5, 4, 2, 1, 2, 0, 3, 4, 2, 1, 0, 3, 2, 0,
+    2, 1, 2, 1, 4, 0, 1, 3, 0, 3, 6, 3, 2, 0, 3, 3,
+    0, 1, 0, 3, 1, 0, 2, 0, 2, 6, 1, 0, 2, 1, 4, 0,
+    3, 6, 3, 6, 0, 3, 1, 2, 4, 0, 3, 1, 0, 1, 0, 3,
+    4, 2, 2, 1, 2, 3, 4, 1, 1, 4, 3, 1, 3, 3, 1, 2,
+    3, 1, 4, 3, 1, 1, 0, 2, 2, 2, 0, 4, 2, 0, 0, 2,
+    0, 4, 2, 0, 2, 1, 2, 2, 2, 3, 0, 3, 2, 0, 3, 0,
+    3, 2, 2, 1, 1, 2, 2, 3, 2, 2, 3, 4, 2, 2, 1, 4,
+    1, 2, 2, 1, 1, 3, 1, 0, 5, 2, 2, 5, 2, 0, 4, 2,
+    0, 3, 2, 2, 2, 3, 2, 0, 2, 3, 2, 1, 1, 5, 0, 4,
+    3, 0, 0, 2, 0, 2, 3, 4, 1, 3, 3, 0, 1, 2, 2, 1,
+    2, 1, 3, 1, 0, 2, 0, 4, 2, 0, 0, 4, 0, 3, 4, 0,
+    2, 2, 2, 2, 4, 2, 2, 2, 1, 0, 4, 2, 0, 1, 2, 0,
+    4, 3, 0, 2, 2, 1, 3, 3, 0, 4, 1, 3, 2, 0, 4, 0,
+    4, 2, 0, 3, 4, 2, 1, 5, 1, 3, 3, 0, 2, 0, 4, 4,
+    0, 0, 1, 1, 3, 2, 1, 2, 0, 4, 2, 1, 0, 2, 1, 3,
+    1, 2, 1, 1, 3, 3, 2, 4, 0, 1, 5, 1, 2, 1, 3, 1,
+    3, 1, 0, 1, 1, 3, 2, 3, 4, 0, 3, 3, 0, 2, 0, 4,
+    3, 0, 0, 3, 1, 3, 2, 3, 2, 0, 3, 2, 2, 3, 2, 2,
+    4, 1, 2, 2, 2, 2, 0, 4, 3, 0, 0, 4, 0, 4, 4, 0,
+    2, 3, 0, 4, 1, 0, 2, 2, 0, 4, 2, 1, 0, 3, 0, 3,
+    3, 2, 2, 0, 3, 2, 0, 4, 1, 2, 4, 3, 0, 4, 4, 0,
+    0, 2, 0, 4, 1, 0, 3, 4, 0, 3, 2, 2, 2, 0, 2, 4,
+    4, 0, 4, 1, 0, 0, 4, 0, 4, 2, 1, 2, 1, 2, 2, 4,
+    2, 0, 3, 5, 4, 1, 0, 3, 4, 0, 4, 0, 3, 4, 0, 3,
+    0, 4, 4, 0, 3, 2, 0, 3, 3, 0, 3, 0, 4, 4, 3, 0,
+    4, 0, 2, 2, 4, 0, 4, 4, 4, 3, 2, 0, 4, 3, 0, 2,
+    3, 0, 4, 3, 0, 4, 3, 0, 1, 6, 0, 2, 5, 2, 0, 2,
+    5, 4, 2, 2, 5, 4, 1, 3, 1, 0, 4, 1, 3, 5, 0, 2,
+    1, 3, 2, 0, 2, 0, 2, 2, 5, 0, 4, 1, 0, 0, 2, 1,
+    3, 3, 0, 3, 0, 3, 1, 0, 4, 0, 4, 1, 0, 4, 1, 0,
+    4, 1, 2, 3, 2, 1, 3, 2, 0, 1, 0, 4, 2, 3, 0, 4,
+    1, 3, 1, 1, 2, 0, 4, 2, 0, 2, 5, 0, 4, 1, 2, 0,
+    3, 1, 3, 4, 3, 4, 1, 3, 4, 3, 2, 1, 3, 1, 2, 3,
+    4, 1, 2, 3, 2, 3, 2, 3, 2, 3, 4, 4, 1, 1, 3, 2,
+    4, 3, 3, 2, 2, 3, 4, 1, 4, 3, 2, 2, 1, 3, 2, 1,
+    2, 4, 1, 3, 3, 2, 4, 1, 3, 2, 5, 2, 2, 2, 4, 3,
+    0, 3, 1, 0, 5, 0, 4, 1, 0, 3, 2, 0, 4, 2, 0, 0,
+    3, 0, 5, 4, 3, 2, 2, 3, 2, 3, 4, 0, 2, 0, 5, 3,
+    2, 0, 2, 1, 3, 1, 5, 1, 2, 4, 1, 2, 3, 2, 3, 2,
+    2, 2, 4, 5, 3, 2, 3, 6, 2, 3, 3, 0, 3, 0, 5, 2,
+    0, 0, 3, 4, 1, 4, 2, 0, 3, 2, 2, 3, 4, 4, 1, 2,
+    3, 2, 1, 2, 2, 3, 2, 0, 4, 0, 4, 2, 0, 0, 1, 0,
+    5, 4, 0, 0, 0, 2, 0, 4, 3, 2, 1, 4, 0, 5, 2, 0,
+    0, 0, 2, 1, 4, 2, 0, 0, 4, 1, 1, 6, 1, 2, 4, 2,
+    1, 3, 5, 2, 3, 0, 5, 2, 1, 0, 0, 4, 1, 3, 1, 0,
+    3, 3, 2, 1, 4, 2, 3, 3, 0, 2, 1, 3, 4, 0, 3, 2,
+    3, 3, 2, 3, 2, 3, 2, 0, 2, 0, 3, 4, 0, 1, 0, 3,
+    3, 0, 4, 0, 5, 2, 0, 1, 0, 3, 4, 1, 6, 4, 1, 5,
+    1, 4, 1, 0, 0, 2, 2, 3, 3, 2, 2, 0, 4, 2, 3, 0,
+    2, 0, 5, 2, 1, 0, 0, 3, 1, 4, 3, 0, 0, 2, 1, 3,
+    4, 0, 4, 0, 4, 2, 3, 0, 3, 2, 3, 3, 0, 4, 1, 4,
+    3, 0, 5, 4, 2, 3, 1, 0, 2, 0, 4, 1, 0, 2, 3, 1,
+    3, 4, 2, 1, 0, 5, 1, 0, 0, 0, 4, 1, 3, 4, 0, 2,
+    3, 2, 5, 4, 2, 3, 1, 2, 1, 1, 2, 1, 6, 2, 3, 1,
+    0, 1, 0, 4, 2, 1, 0, 5, 0, 4, 2, 1, 2, 5, 0, 3,
+    3, 0, 5, 2, 3, 2, 1, 4, 0, 5, 3, 0, 0, 0, 3, 0,
+    4, 1, 4, 0, 2, 3, 2, 4, 5, 3, 1, 6, 0, 5, 2, 0,
+    0, 4, 3, 2, 2, 2, 5, 2, 3, 2, 3, 4, 1, 4, 2, 0,
+    0, 1, 2, 3, 2, 0, 3, 0, 5, 2, 0, 0, 3, 2, 1, 4,
+    3, 0, 2, 3, 1, 4, 2, 1, 6, 3, 1, 4, 3, 2, 1, 2,
+    1, 4, 3, 0, 3, 4, 1, 3, 5, 0, 3, 1, 4, 3, 0, 3,
+    2, 1, 3, 2, 0, 3, 1, 3, 2, 2, 1, 1, 4, 2, 0, 0,
+    2, 1, 4, 3, 0, 0, 4, 2, 2, 3, 6, 1, 4, 3, 0, 0,
+    3, 2, 3, 2, 2, 3, 1, 3, 2, 1, 4, 2, 3, 3, 2, 1,
+    0, 5, 2, 0, 0, 0, 4, 2, 3, 3, 4, 3, 3, 2, 4, 4,
+    0, 4, 2, 0, 2, 3, 3, 1, 7, 0, 4, 3, 0, 3, 2, 0,
+    5, 4, 1, 0, 3, 2, 0, 4, 2, 1, 2, 4, 2, 3, 3, 4,
+    1, 1, 3, 4, 1, 2, 0, 5, 4, 3, 0, 0, 2, 2, 3, 2,
+    0, 1, 0, 5, 4, 3, 0, 0, 4, 0, 5, 5, 0, 0, 0, 1,
+    1, 4, 3, 0, 4, 3, 1, 4, 3, 2, 0, 1, 1, 3, 2, 4,
+    3, 1, 4, 1, 0, 0, 4, 0, 5, 3, 0, 0, 2, 3, 1, 3,
+    3, 2, 3, 0, 5, 3, 2, 0, 0, 4, 0, 3, 1, 0, 3, 1,
+    3, 3, 0, 5, 0, 5, 4, 0, 0, 0, 1, 2, 3, 3, 0, 1,
+    2, 3, 5, 4, 2, 0, 5, 1, 0, 0, 5, 2, 0, 4, 3, 0,
+    0, 1, 2, 3, 2, 2, 1, 1, 3, 4, 1, 4, 1, 2, 2, 5,
+    0, 5, 2, 0, 0, 0, 1, 0, 2, 7, 4, 1, 4, 4, 1, 0,
+    1, 0, 4, 3, 0, 1, 4, 1, 1, 7, 2, 3, 4, 1, 2, 0,
+    3, 5, 0, 3, 2, 3, 4, 1, 4, 1, 4, 1, 0, 3, 4, 0,
+    4, 4, 0, 0, 3, 0, 4, 5, 4, 0, 3, 0, 3, 3, 2, 3,
+    0, 4, 3, 2, 0, 4, 0, 5, 4, 0, 0, 2, 1, 3, 2, 6,
+    3, 0, 5, 3, 0, 0, 0, 4, 1, 4, 4, 0, 0, 2, 0, 4,
+    3, 0, 1, 2, 1, 2, 1, 1, 1, 4, 2, 1, 2, 3, 1, 2,
+    4, 5, 1, 4, 1, 0, 5, 4, 2, 3, 4, 3, 2, 0, 5, 2,
+    0, 2, 1, 4, 3, 2, 2, 2, 2, 3, 1, 0, 3, 1, 4, 2,
+    0, 1, 4, 2, 2, 3, 1, 2, 3, 3, 4, 4, 3, 2, 2, 4,
+    4, 2, 3, 4, 5, 1, 4, 4, 2, 2, 1, 5, 1, 2, 5, 1,
+    3, 5, 1, 1, 3, 2, 3, 3, 4, 2, 3, 2, 3, 3, 2, 0,
+    2, 1, 4, 2, 1, 0, 2, 1, 4, 2, 1, 0, 4, 3, 3, 2,
+    1, 2, 2, 1, 6, 1, 2, 5, 4, 1, 4, 2, 1, 0, 3, 4,
+    2, 4, 1, 2, 4, 2, 1, 2, 1, 1, 5, 3, 0, 0, 0, 4,
+    0, 4, 2, 0, 1, 4, 2, 3, 1, 0, 4, 0, 4, 2, 1, 0,
+    1, 1, 5, 2, 0, 0, 0, 2, 3, 3, 2, 0, 1, 2, 3, 4,
+    0, 4, 1, 4, 4, 1, 4, 3, 0, 2, 6, 3, 3, 3, 3, 2,
+    1, 4, 2, 4, 3, 3, 3, 4, 1, 2, 5, 1, 5, 4, 2, 2,
+    3, 4, 2, 4, 4, 2, 3, 3, 0, 6, 0, 6, 3, 0, 0, 0,
+    0, 1, 1, 3, 1, 2, 2, 2, 3, 4, 3, 4, 2, 4, 2, 1,
+    0, 2, 1, 3, 3, 2, 1, 1, 4, 2, 1, 4, 2, 3, 3, 3,
+    4, 3, 3, 3, 4, 3, 2, 3, 2, 2, 5, 2, 4, 4, 3, 2,
+    1, 5, 1, 6, 3, 2, 7, 4, 3, 3, 4, 0, 2, 3, 3, 1,
+    2, 4, 0, 5, 2, 0, 0, 2, 1, 1, 5, 2, 0, 0, 0, 7,
+    4, 2, 5, 6, 1, 2, 5, 2, 4, 2, 4, 2, 3, 3, 4, 3,
+    4, 1, 4, 2, 3, 2, 1, 2, 4, 2, 0, 0, 2, 0, 6, 2,
+    0, 0, 0, 0, 2, 0, 5, 5, 2, 0, 3, 2, 0, 4, 4, 1,
+    0, 2, 0, 5, 4, 1, 0, 0, 3, 1, 4, 4, 1, 0, 4, 1,
+    5, 1, 0, 0, 3, 4, 3, 3, 1, 0, 2, 2, 3, 6, 3, 2,
+    2, 4, 2, 0, 3, 2, 1, 4, 4, 1, 0, 2, 4, 2, 2, 5,
+    0, 5, 1, 0, 0, 0, 1, 2, 4, 4, 0, 0, 1, 3, 3, 3,
+    2, 3, 0, 5, 3, 4, 0, 5, 4, 0, 5, 3, 0, 0, 0, 2,
+    4, 2, 5, 2, 3, 2, 6, 1, 4, 2, 1, 4, 1, 4, 3, 0,
+    0, 1, 1, 4, 2, 0, 3, 4, 2, 4, 2, 0, 0, 4, 0, 5,
+    3, 2, 0, 3, 2, 0, 2, 7, 2, 0, 2, 2, 6, 1, 3, 4,
+    0, 1, 4, 2, 6, 5, 1, 5, 3, 0, 0, 0, 2, 5, 1, 7,
+    2, 4, 2, 3, 0, 3, 2, 4, 3, 0, 0, 2, 3, 3, 5, 0,
+    4, 3, 3, 4, 1, 4, 0, 5, 1, 0, 0, 2, 5, 4, 2, 2,
+    4, 0, 4, 2, 1, 0, 4, 1, 4, 2, 0, 0, 3, 6, 1, 3,
+    6, 1, 4, 3, 4, 4, 3, 0, 4, 3, 4, 4, 0, 0, 4, 3,
+    3, 3, 0, 4, 6, 1, 5, 2, 4, 4, 3, 0, 4, 0, 3, 3,
+    4, 3, 2, 4, 4, 3, 0, 5, 5, 2, 3, 4, 1, 4, 4, 0,
+    0, 3, 2, 4, 4, 0, 0, 4, 4, 2, 7, 4, 2, 3, 4, 0,
+    3, 5, 2, 4, 3, 3, 3, 4, 0, 4, 0, 5, 4, 0, 3, 0,
+    4, 0, 4, 4, 0, 0, 4, 2, 4, 4, 0, 0, 3, 1, 4, 4,
+    0, 0, 4, 0, 6, 3, 0, 0, 0, 0, 4, 5, 2, 6, 3, 4,
+    2, 4, 5, 1, 4, 6, 3, 0, 4, 1, 4, 4, 3, 0, 4, 1,
+    5, 4, 0, 0, 3, 4, 4, 2, 7, 6, 5, 2, 4, 5, 4, 3,
+    3, 0, 4, 2, 4, 4, 0, 0, 5, 4, 3, 4, 0, 4, 2, 2,
+    4, 4, 0, 6, 4, 0, 0, 3, 0, 5, 0, 7, 4, 3, 0, 0,
+    0, 0, 4, 0, 1, 7, 0, 3, 3, 0, 6, 4, 2, 5, 4, 1,
+    3, 3, 4, 3, 6, 1, 7, 6, 1, 6, 6, 2, 6, 5, 3, 2,
+    5, 6, 3, 2, 6, 5, 4, 3, 6, 5, 6, 7, 1, 6, 7, 1,
+    5, 5, 2, 6, 5, 3, 5, 6, 0, 0, 0, 6, 5, 3, 5, 0,
+    6, 2, 2, 5, 6, 3, 4, 6, 0, 0, 6, 0, 2, 6, 5, 2,
+    3, 6, 0, 5, 0, 5, 6, 0, 0, 0, 6, 1, 3, 6, 0, 5,
+    2, 4, 6, 0, 0, 6, 2, 2, 6, 5, 1, 4, 6, 5, 0, 6,
+    0, 4, 6, 0, 0, 6, 4, 4, 6, 0, 0, 6, 1, 4, 6, 0,
+    0, 6, 1, 2, 6, 5, 1, 6, 6, 0, 0, 0, 0, 6, 1, 3,
+    5, 0, 6, 0, 2, 5, 6, 2, 3, 5, 0, 6, 3, 4, 6, 5,
+    0, 6, 6, 2, 5, 6, 1, 2, 5, 6, 3, 3, 6, 5, 6, 1,
+    4, 6, 0, 0, 5, 5, 1, 8, 3, 1, 8, 4, 1, 8, 3, 4,
+    8, 0, 0, 8, 7, 1, 8, 8, 1, 8, 4, 1, 7, 4, 2, 7,
+    8, 6, 1, 8, 3, 4, 8, 7, 0, 8, 4, 4, 8, 7, 0, 8,
+    1, 1, 8, 7, 1, 7, 4, 2, 8, 7, 1, 2, 8, 7, 2, 1,
+    8, 3, 2, 8, 7, 1, 3, 8, 0, 8, 7, 2, 7, 8, 5, 4,
+    8, 7, 0, 8, 9, 1, 8, 3, 4, 8, 0, 0, 7, 5, 2, 8,
+    7, 6, 2, 8, 7,
+};
+
+static const HyphenationPatterns hyph_de = {
+    "de",
+    hyph_deLetters,
+    83,
+    hyph_deNodeChars,
+    hyph_deNodeFirstChild,
+    hyph_deNodeLevels,
+    hyph_deLevels,
+    33158,
+    2,
+    2,
+};
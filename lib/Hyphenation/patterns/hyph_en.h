@@ -0,0 +1,3447 @@
+/**
+ * generated by hyphenconvert.py
+ * name: hyph_en
+ * language: en
+ * patterns: 5901
+ * nodes: 15794
+ */
+#pragma once
+#include "HyphenationPatterns.h"
+
+static const HyphenationLetter hyph_enLetters[52] = {
+    { 0x41, 1 }, // A
+    { 0x42, 2 }, // B
+    { 0x43, 3 }, // C
+    { 0x44, 4 }, // D
+    { 0x45, 5 }, // E
+    { 0x46, 6 }, // F
+    { 0x47, 7 }, // G
+    { 0x48, 8 }, // H
+    { 0x49, 9 }, // I
+    { 0x4A, 10 }, // J
+    { 0x4B, 11 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 13 }, // M
+    { 0x4E, 14 }, // N
+    { 0x4F, 15 }, // O
+    { 0x50, 16 }, // P
+    { 0x51, 17 }, // Q
+    { 0x52, 18 }, // R
+    { 0x53, 19 }, // S
+    { 0x54, 20 }, // T
+    { 0x55, 21 }, // U
+    { 0x56, 22 }, // V
+    { 0x57, 23 }, // W
+    { 0x58, 24 }, // X
+    { 0x59, 25 }, // Y
+    { 0x5A, 26 }, // Z
+    { 0x61, 1 }, // a
+    { 0x62, 2 }, // b
+    { 0x63, 3 }, // c
+    { 0x64, 4 }, // d
+    { 0x65, 5 }, // e
+    { 0x66, 6 }, // f
+    { 0x67, 7 }, // g
+    { 0x68, 8 }, // h
+    { 0x69, 9 }, // i
+    { 0x6A, 10 }, // j
+    { 0x6B, 11 }, // k
+    { 0x6C, 12 }, // l
+    { 0x6D, 13 }, // m
+    { 0x6E, 14 }, // n
+    { 0x6F, 15 }, // o
+    { 0x70, 16 }, // p
+    { 0x71, 17 }, // q
+    { 0x72, 18 }, // r
+    { 0x73, 19 }, // s
+    { 0x74, 20 }, // t
+    { 0x75, 21 }, // u
+    { 0x76, 22 }, // v
+    { 0x77, 23 }, // w
+    { 0x78, 24 }, // x
+    { 0x79, 25 }, // y
+    { 0x7A, 26 }, // z
+};
+
+static const uint8_t hyph_enNodeChars[15794] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 1,
+    2, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20,
+    21, 22, 23, 25, 1, 3, 5, 8, 9, 11, 12, 14, 15, 17, 18, 19,
+    20, 21, 25, 26, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 25, 1, 2, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 1, 2, 4, 5, 6, 8, 9, 12, 13, 14, 15, 16,
+    18, 19, 20, 21, 25, 1, 2, 4, 5, 7, 8, 9, 12, 13, 14, 15,
+    16, 18, 19, 20, 21, 23, 25, 1, 2, 5, 6, 8, 9, 11, 12, 13,
+    14, 15, 16, 18, 19, 20, 21, 23, 25, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 1, 5, 15, 21, 1, 2, 5, 6, 8, 9, 11, 12, 13,
+    14, 15, 18, 19, 20, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 25, 1, 2, 3,
+    5, 6, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 23, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 25, 26, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25,
+    1, 2, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19,
+    20, 21, 23, 21, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 25, 1, 2, 3, 4, 5,
+    6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 25, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 16,
+    18, 19, 20, 21, 22, 23, 25, 26, 1, 2, 3, 4, 5, 6, 7, 9,
+    10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 24, 26, 1, 5,
+    9, 15, 22, 25, 1, 2, 5, 8, 9, 11, 12, 14, 15, 16, 18, 19,
+    20, 25, 1, 3, 5, 8, 9, 15, 16, 20, 21, 24, 1, 2, 3, 4,
+    5, 7, 8, 9, 12, 13, 14, 15, 16, 18, 19, 20, 23, 1, 2, 5,
+    9, 12, 13, 15, 20, 26, 3, 4, 5, 6, 7, 12, 13, 14, 16, 18,
+    19, 20, 21, 22, 23, 1, 5, 9, 12, 15, 18, 21, 1, 5, 8, 9,
+    15, 18, 21, 25, 26, 1, 5, 9, 15, 18, 21, 25, 1, 2, 3, 5,
+    7, 9, 12, 14, 16, 17, 18, 19, 20, 21, 22, 24, 25, 1, 5, 9,
+    12, 15, 18, 21, 1, 5, 8, 9, 14, 15, 18, 1, 5, 9, 15, 21,
+    25, 3, 4, 7, 12, 13, 14, 18, 19, 20, 1, 5, 9, 21, 1, 5,
+    9, 15, 18, 1, 5, 9, 15, 21, 1, 5, 9, 14, 15, 21, 1, 5,
+    9, 15, 21, 2, 4, 5, 6, 12, 13, 14, 16, 18, 19, 20, 21, 22,
+    24, 1, 5, 6, 8, 9, 12, 15, 18, 19, 21, 25, 21, 1, 5, 8,
+    9, 15, 21, 25, 1, 3, 5, 8, 9, 11, 12, 13, 14, 15, 16, 17,
+    20, 21, 23, 25, 1, 5, 8, 9, 15, 18, 21, 25, 11, 14, 16, 18,
+    19, 1, 5, 9, 15, 19, 1, 5, 8, 9, 15, 18, 22, 24, 5, 9,
+    5, 0, 1, 5, 9, 12, 15, 18, 21, 1, 5, 8, 9, 18, 20, 21,
+    4, 5, 9, 12, 15, 18, 19, 21, 18, 6, 1, 5, 9, 12, 14, 15,
+    21, 25, 1, 5, 12, 15, 1, 3, 12, 14, 20, 5, 1, 4, 5, 9,
+    12, 13, 15, 25, 1, 5, 9, 15, 16, 1, 4, 5, 7, 9, 11, 14,
+    15, 19, 20, 21, 1, 5, 8, 9, 12, 15, 19, 21, 21, 1, 2, 3,
+    4, 5, 6, 9, 13, 15, 16, 17, 18, 19, 0, 1, 8, 9, 11, 12,
+    15, 16, 19, 20, 21, 1, 5, 8, 9, 15, 18, 19, 20, 21, 25, 2,
+    7, 12, 14, 18, 19, 20, 1, 5, 9, 15, 1, 9, 12, 19, 9, 1,
+    5, 19, 9, 26, 0, 4, 7, 12, 14, 18, 19, 20, 26, 5, 9, 0,
+    1, 4, 7, 12, 13, 14, 19, 20, 23, 25, 2, 4, 5, 6, 12, 14,
+    15, 20, 1, 5, 9, 15, 21, 5, 4, 5, 12, 13, 14, 15, 18, 19,
+    20, 21, 9, 15, 15, 12, 15, 18, 6, 7, 12, 13, 14, 18, 19, 20,
+    0, 19, 2, 3, 4, 7, 8, 12, 14, 16, 18, 19, 20, 22, 8, 9,
+    15, 0, 4, 9, 12, 14, 16, 18, 19, 20, 23, 0, 1, 5, 9, 15,
+    20, 1, 3, 5, 6, 9, 12, 13, 14, 15, 16, 19, 20, 26, 9, 1,
+    5, 9, 25, 1, 5, 7, 9, 12, 13, 14, 16, 18, 19, 22, 23, 26,
+    1, 5, 9, 15, 21, 1, 5, 9, 21, 23, 4, 6, 9, 12, 13, 14,
+    16, 18, 19, 20, 5, 0, 2, 3, 6, 7, 13, 14, 18, 20, 22, 25,
+    0, 1, 2, 3, 4, 5, 9, 12, 13, 14, 16, 17, 18, 19, 20, 22,
+    25, 1, 5, 9, 25, 0, 1, 3, 4, 5, 6, 7, 12, 14, 15, 16,
+    18, 19, 20, 22, 1, 5, 15, 21, 25, 0, 4, 5, 6, 7, 12, 13,
+    14, 15, 16, 18, 19, 21, 22, 24, 1, 5, 9, 15, 21, 25, 16, 23,
+    25, 8, 1, 3, 5, 7, 12, 13, 14, 16, 14, 19, 2, 3, 4, 7,
+    12, 13, 14, 18, 19, 20, 22, 5, 9, 18, 1, 3, 5, 9, 12, 15,
+    18, 20, 21, 1, 4, 5, 9, 15, 18, 21, 3, 4, 6, 12, 13, 14,
+    16, 19, 20, 24, 5, 6, 9, 15, 21, 1, 5, 9, 14, 15, 21, 25,
+    5, 3, 4, 7, 13, 14, 18, 20, 21, 9, 12, 1, 5, 6, 9, 12,
+    15, 19, 20, 21, 1, 2, 5, 9, 14, 15, 16, 21, 25, 1, 3, 4,
+    5, 9, 14, 15, 19, 20, 21, 25, 26, 6, 7, 9, 12, 16, 18, 19,
+    20, 21, 23, 1, 5, 8, 12, 15, 18, 19, 20, 21, 21, 1, 2, 3,
+    5, 8, 9, 13, 14, 15, 19, 20, 21, 23, 1, 3, 5, 8, 9, 11,
+    13, 15, 16, 19, 20, 21, 23, 1, 5, 8, 9, 14, 15, 18, 21, 25,
+    26, 14, 16, 18, 19, 20, 1, 5, 9, 15, 21, 1, 5, 8, 9, 16,
+    3, 5, 19, 2, 3, 7, 9, 12, 13, 18, 20, 21, 0, 1, 2, 3,
+    4, 12, 13, 14, 18, 22, 5, 9, 12, 25, 1, 3, 4, 7, 12, 14,
+    19, 5, 9, 15, 25, 14, 18, 19, 1, 5, 9, 15, 15, 25, 5, 7,
+    13, 14, 18, 19, 20, 6, 12, 13, 14, 18, 19, 20, 26, 0, 4, 5,
+    12, 14, 15, 18, 19, 20, 22, 5, 12, 15, 9, 15, 20, 0, 1, 3,
+    5, 12, 13, 14, 15, 18, 19, 21, 22, 26, 1, 5, 9, 15, 25, 1,
+    5, 9, 15, 0, 2, 5, 7, 9, 14, 15, 18, 19, 22, 1, 5, 9,
+    15, 21, 20, 8, 1, 5, 9, 14, 19, 20, 14, 18, 2, 3, 5, 7,
+    12, 13, 14, 16, 18, 19, 21, 26, 1, 3, 4, 12, 13, 14, 15, 16,
+    18, 19, 20, 21, 1, 3, 7, 12, 13, 14, 15, 16, 18, 19, 20, 22,
+    1, 15, 5, 4, 7, 12, 13, 14, 15, 18, 19, 21, 22, 5, 15, 8,
+    1, 5, 25, 7, 13, 14, 19, 20, 1, 16, 19, 12, 13, 14, 16, 19,
+    20, 5, 9, 12, 15, 18, 21, 1, 3, 5, 8, 9, 12, 15, 18, 20,
+    21, 1, 4, 5, 9, 12, 15, 18, 21, 4, 7, 12, 14, 18, 19, 20,
+    0, 5, 6, 9, 12, 20, 1, 5, 8, 9, 12, 15, 18, 21, 1, 5,
+    6, 9, 12, 14, 15, 20, 21, 22, 1, 5, 9, 14, 15, 21, 0, 1,
+    3, 4, 5, 7, 9, 11, 12, 14, 15, 19, 20, 21, 25, 0, 7, 12,
+    13, 14, 16, 18, 19, 20, 21, 5, 8, 9, 18, 21, 21, 1, 4, 5,
+    7, 9, 13, 15, 21, 0, 1, 3, 5, 6, 8, 9, 11, 12, 13, 15,
+    16, 19, 20, 21, 1, 5, 8, 9, 15, 18, 20, 21, 26, 5, 9, 15,
+    15, 1, 9, 15, 3, 16, 18, 19, 23, 16, 4, 0, 2, 7, 9, 12,
+    4, 5, 7, 12, 14, 18, 19, 20, 0, 3, 12, 13, 14, 16, 19, 5,
+    25, 5, 15, 18, 19, 21, 15, 3, 12, 25, 2, 3, 4, 7, 13, 14,
+    18, 19, 20, 22, 9, 5, 9, 5, 9, 18, 1, 2, 6, 7, 13, 14,
+    16, 18, 19, 22, 25, 18, 1, 5, 15, 1, 2, 3, 4, 6, 7, 11,
+    12, 13, 14, 15, 17, 19, 20, 22, 26, 1, 1, 5, 9, 15, 5, 9,
+    15, 0, 2, 3, 6, 7, 13, 14, 15, 16, 18, 19, 20, 21, 22, 1,
+    8, 9, 12, 18, 3, 5, 9, 1, 5, 8, 9, 18, 21, 1, 2, 3,
+    5, 6, 9, 13, 15, 16, 19, 20, 5, 1, 2, 13, 14, 19, 2, 3,
+    7, 8, 9, 12, 14, 16, 18, 19, 20, 1, 9, 0, 4, 7, 12, 13,
+    14, 15, 18, 19, 20, 22, 0, 1, 4, 7, 12, 14, 15, 19, 20, 26,
+    1, 1, 9, 15, 3, 4, 7, 9, 11, 12, 13, 14, 18, 19, 20, 21,
+    22, 1, 5, 8, 9, 15, 20, 25, 8, 9, 12, 13, 14, 16, 21, 2,
+    3, 7, 11, 12, 13, 14, 18, 19, 20, 21, 22, 1, 5, 8, 9, 15,
+    18, 21, 1, 5, 9, 21, 23, 0, 1, 2, 3, 4, 7, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 22, 23, 1, 5, 8, 9, 12, 15, 19, 21,
+    25, 1, 5, 1, 2, 4, 5, 6, 7, 11, 13, 14, 15, 19, 20, 5,
+    9, 12, 5, 5, 9, 2, 3, 4, 5, 7, 9, 12, 13, 14, 16, 18,
+    19, 20, 21, 22, 23, 9, 18, 21, 1, 3, 5, 9, 12, 13, 15, 16,
+    20, 1, 5, 9, 18, 19, 21, 1, 4, 5, 6, 9, 13, 14, 15, 20,
+    13, 16, 1, 4, 12, 18, 19, 20, 1, 5, 9, 18, 21, 5, 8, 9,
+    12, 15, 18, 20, 21, 4, 9, 15, 21, 12, 14, 18, 20, 22, 9, 1,
+    5, 9, 12, 14, 18, 21, 25, 1, 3, 4, 6, 7, 12, 14, 19, 20,
+    5, 9, 1, 4, 5, 6, 9, 12, 15, 16, 20, 21, 22, 25, 1, 2,
+    5, 9, 13, 15, 16, 1, 3, 4, 5, 7, 9, 11, 15, 19, 20, 21,
+    22, 4, 11, 16, 18, 19, 1, 5, 8, 9, 15, 18, 21, 25, 1, 5,
+    7, 9, 13, 14, 15, 16, 18, 19, 20, 21, 25, 1, 3, 9, 12, 15,
+    16, 20, 1, 5, 8, 9, 15, 2, 3, 5, 12, 14, 22, 5, 9, 15,
+    4, 5, 9, 14, 15, 1, 3, 4, 7, 9, 12, 14, 16, 18, 20, 22,
+    25, 0, 1, 3, 4, 5, 11, 12, 14, 15, 18, 20, 0, 1, 5, 9,
+    12, 15, 19, 20, 21, 25, 1, 3, 4, 5, 7, 12, 14, 15, 20, 1,
+    9, 15, 21, 3, 4, 5, 7, 9, 12, 14, 16, 18, 19, 20, 21, 1,
+    5, 15, 1, 5, 9, 15, 5, 8, 9, 1, 5, 8, 9, 21, 23, 2,
+    5, 6, 12, 13, 14, 18, 19, 20, 1, 5, 2, 3, 6, 9, 12, 13,
+    14, 16, 18, 19, 20, 21, 22, 26, 1, 9, 15, 5, 8, 9, 21, 1,
+    9, 0, 1, 2, 3, 4, 6, 7, 9, 12, 14, 15, 16, 18, 19, 20,
+    21, 22, 23, 21, 25, 5, 9, 12, 15, 21, 0, 1, 1, 2, 3, 4,
+    5, 7, 12, 13, 14, 15, 16, 17, 19, 20, 22, 5, 12, 5, 9, 15,
+    1, 5, 9, 25, 1, 5, 9, 15, 21, 2, 3, 5, 6, 11, 12, 13,
+    14, 15, 16, 18, 19, 20, 22, 24, 5, 8, 9, 15, 5, 9, 15, 25,
+    1, 3, 5, 8, 9, 15, 16, 23, 1, 5, 9, 18, 19, 1, 5, 7,
+    9, 13, 14, 19, 20, 5, 9, 15, 3, 14, 20, 2, 3, 9, 12, 14,
+    16, 20, 21, 22, 23, 1, 5, 8, 9, 12, 15, 21, 0, 1, 3, 4,
+    7, 9, 12, 13, 14, 16, 18, 19, 21, 22, 23, 24, 0, 5, 9, 15,
+    23, 2, 3, 4, 7, 12, 14, 15, 18, 19, 20, 21, 22, 26, 5, 9,
+    1, 5, 9, 1, 5, 9, 15, 3, 6, 12, 13, 14, 16, 18, 22, 1,
+    5, 8, 9, 12, 15, 21, 1, 3, 5, 9, 12, 14, 16, 20, 21, 23,
+    0, 1, 5, 8, 9, 12, 15, 18, 23, 25, 1, 2, 7, 9, 12, 13,
+    14, 18, 15, 3, 12, 14, 18, 0, 2, 3, 4, 6, 9, 12, 13, 14,
+    16, 18, 19, 20, 21, 22, 23, 24, 8, 0, 1, 3, 4, 5, 7, 12,
+    13, 14, 15, 16, 18, 19, 20, 21, 24, 25, 0, 1, 5, 9, 12, 15,
+    19, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 17, 19, 20, 21,
+    22, 26, 1, 5, 15, 5, 2, 3, 4, 6, 7, 9, 13, 14, 18, 19,
+    21, 23, 1, 5, 9, 15, 21, 3, 8, 23, 5, 15, 21, 1, 2, 4,
+    5, 6, 9, 13, 14, 16, 18, 19, 1, 9, 15, 1, 12, 16, 5, 2,
+    3, 14, 18, 20, 22, 5, 9, 12, 1, 9, 12, 18, 21, 25, 4, 5,
+    9, 15, 19, 21, 14, 18, 1, 12, 8, 9, 12, 14, 18, 20, 22, 1,
+    3, 4, 5, 7, 9, 12, 13, 15, 19, 20, 21, 22, 1, 2, 9, 15,
+    16, 1, 5, 9, 19, 20, 21, 25, 26, 18, 19, 21, 5, 9, 12, 16,
+    20, 1, 2, 3, 4, 5, 6, 9, 12, 14, 15, 16, 19, 20, 21, 1,
+    3, 5, 9, 12, 16, 19, 20, 21, 1, 5, 9, 12, 15, 19, 13, 21,
+    5, 0, 2, 3, 7, 12, 13, 14, 16, 18, 20, 0, 4, 7, 12, 14,
+    18, 19, 20, 1, 4, 6, 7, 11, 12, 14, 15, 16, 18, 19, 20, 22,
+    0, 9, 11, 12, 13, 18, 20, 2, 3, 7, 9, 12, 13, 18, 19, 20,
+    22, 1, 4, 5, 12, 18, 19, 22, 9, 12, 14, 18, 19, 20, 26, 5,
+    9, 15, 13, 22, 1, 9, 8, 12, 16, 20, 3, 7, 13, 16, 19, 3,
+    4, 18, 9, 21, 1, 3, 4, 13, 2, 1, 5, 9, 1, 3, 18, 20,
+    5, 8, 15, 5, 18, 19, 20, 9, 1, 12, 15, 21, 2, 5, 16, 3,
+    4, 7, 9, 24, 4, 7, 13, 14, 19, 5, 9, 15, 20, 21, 1, 9,
+    15, 18, 3, 5, 9, 15, 19, 20, 21, 8, 9, 2, 18, 14, 16, 18,
+    20, 12, 19, 13, 15, 5, 25, 1, 3, 8, 18, 21, 4, 18, 18, 20,
+    18, 5, 7, 12, 20, 1, 16, 1, 3, 5, 7, 9, 14, 15, 20, 5,
+    15, 16, 3, 11, 19, 20, 3, 16, 19, 20, 25, 8, 13, 15, 16, 20,
+    4, 6, 19, 20, 9, 15, 14, 3, 7, 14, 18, 19, 20, 1, 2, 4,
+    8, 13, 18, 19, 22, 2, 4, 7, 12, 15, 20, 1, 9, 15, 21, 12,
+    15, 18, 19, 20, 9, 15, 21, 4, 6, 14, 18, 19, 20, 26, 3, 12,
+    13, 14, 16, 18, 20, 21, 12, 1, 5, 9, 12, 15, 7, 14, 20, 1,
+    3, 4, 5, 7, 8, 11, 12, 13, 14, 16, 18, 19, 20, 21, 23, 1,
+    15, 25, 6, 14, 19, 2, 20, 5, 3, 13, 20, 1, 3, 6, 12, 13,
+    15, 18, 19, 1, 3, 6, 10, 18, 19, 12, 18, 20, 21, 5, 9, 15,
+    1, 3, 13, 15, 14, 19, 18, 19, 15, 18, 7, 10, 4, 5, 9, 1,
+    4, 7, 19, 20, 9, 19, 21, 7, 18, 19, 8, 12, 19, 1, 5, 16,
+    17, 20, 5, 3, 12, 2, 18, 19, 7, 14, 1, 5, 15, 21, 18, 5,
+    9, 15, 14, 12, 19, 21, 26, 14, 15, 19, 15, 1, 2, 7, 15, 18,
+    20, 1, 5, 9, 15, 21, 4, 9, 12, 13, 14, 18, 20, 9, 12, 13,
+    16, 18, 19, 20, 24, 2, 5, 16, 5, 11, 12, 13, 14, 18, 20, 21,
+    22, 2, 4, 16, 15, 5, 9, 12, 15, 14, 12, 1, 13, 16, 3, 4,
+    5, 6, 11, 16, 19, 20, 21, 18, 9, 15, 9, 3, 14, 16, 22, 18,
+    19, 14, 18, 4, 14, 18, 25, 12, 18, 9, 15, 3, 13, 14, 18, 20,
+    1, 7, 9, 14, 16, 20, 21, 22, 6, 7, 13, 14, 15, 16, 17, 20,
+    2, 7, 10, 14, 15, 17, 21, 22, 3, 3, 7, 11, 12, 14, 18, 19,
+    20, 24, 4, 7, 18, 20, 3, 4, 12, 13, 14, 19, 5, 4, 12, 14,
+    18, 19, 4, 12, 20, 3, 13, 19, 15, 16, 20, 23, 3, 5, 10, 12,
+    20, 4, 5, 14, 15, 18, 20, 22, 3, 20, 12, 19, 4, 18, 6, 20,
+    9, 14, 15, 5, 1, 3, 4, 5, 20, 20, 8, 20, 5, 9, 4, 7,
+    9, 12, 18, 20, 4, 5, 14, 20, 1, 5, 9, 15, 20, 3, 5, 15,
+    16, 18, 20, 1, 5, 21, 9, 12, 13, 18, 19, 20, 5, 9, 15, 5,
+    25, 2, 18, 15, 20, 1, 9, 2, 3, 4, 6, 13, 14, 20, 22, 1,
+    3, 4, 5, 6, 9, 13, 14, 16, 19, 20, 21, 23, 9, 5, 7, 14,
+    20, 2, 15, 17, 19, 21, 23, 4, 4, 12, 18, 20, 21, 1, 5, 8,
+    9, 18, 25, 3, 12, 13, 14, 16, 18, 19, 20, 22, 1, 15, 21, 4,
+    7, 14, 15, 25, 14, 15, 15, 12, 22, 1, 5, 8, 9, 15, 18, 21,
+    1, 5, 15, 18, 21, 2, 13, 16, 18, 19, 9, 13, 14, 2, 6, 11,
+    12, 16, 18, 21, 3, 12, 13, 14, 18, 19, 20, 24, 1, 5, 9, 12,
+    13, 14, 12, 13, 14, 15, 16, 17, 21, 25, 1, 5, 9, 15, 18, 16,
+    18, 1, 3, 4, 5, 6, 9, 11, 15, 21, 5, 1, 7, 21, 14, 18,
+    3, 4, 5, 9, 12, 19, 22, 9, 16, 4, 8, 12, 18, 19, 22, 1,
+    2, 5, 9, 18, 5, 9, 4, 12, 14, 18, 19, 20, 12, 18, 1, 5,
+    9, 9, 19, 14, 1, 9, 12, 14, 18, 1, 20, 1, 12, 15, 12, 18,
+    15, 18, 5, 5, 14, 15, 15, 9, 12, 13, 9, 18, 1, 3, 5, 15,
+    20, 21, 5, 23, 1, 21, 3, 13, 9, 2, 14, 12, 15, 21, 7, 14,
+    5, 12, 0, 25, 9, 15, 5, 14, 2, 4, 18, 9, 14, 15, 1, 5,
+    5, 9, 7, 0, 19, 20, 26, 2, 7, 18, 19, 20, 18, 3, 6, 12,
+    14, 14, 18, 5, 7, 12, 18, 20, 5, 9, 12, 15, 5, 14, 19, 21,
+    9, 12, 3, 5, 6, 13, 14, 15, 16, 19, 20, 21, 12, 9, 20, 1,
+    3, 14, 16, 20, 21, 1, 9, 15, 18, 23, 1, 12, 18, 18, 20, 18,
+    5, 9, 12, 14, 20, 3, 12, 18, 19, 5, 5, 3, 4, 12, 13, 14,
+    16, 20, 21, 22, 23, 1, 8, 9, 18, 1, 5, 14, 19, 9, 12, 1,
+    5, 13, 14, 15, 26, 9, 4, 14, 15, 5, 1, 8, 2, 14, 9, 1,
+    2, 3, 20, 9, 3, 8, 8, 5, 18, 18, 2, 3, 12, 16, 3, 7,
+    14, 18, 19, 22, 5, 15, 0, 1, 2, 3, 6, 15, 20, 7, 13, 16,
+    19, 15, 11, 1, 5, 8, 1, 5, 12, 18, 8, 21, 4, 9, 5, 8,
+    7, 14, 14, 18, 5, 7, 3, 18, 25, 25, 3, 4, 12, 5, 9, 7,
+    5, 1, 4, 5, 9, 2, 9, 19, 18, 14, 11, 20, 1, 5, 9, 9,
+    21, 9, 15, 9, 21, 16, 20, 9, 18, 23, 15, 14, 18, 9, 1, 4,
+    5, 7, 21, 9, 18, 21, 26, 20, 0, 14, 19, 19, 14, 7, 9, 9,
+    2, 1, 0, 1, 4, 5, 9, 1, 8, 15, 14, 20, 20, 18, 6, 1,
+    9, 9, 20, 5, 9, 19, 20, 1, 9, 15, 9, 12, 8, 5, 1, 12,
+    15, 4, 5, 9, 20, 25, 5, 15, 20, 25, 8, 9, 1, 1, 1, 13,
+    14, 21, 0, 5, 0, 12, 3, 5, 9, 20, 1, 1, 19, 20, 1, 2,
+    14, 1, 4, 12, 13, 14, 18, 14, 15, 20, 26, 9, 2, 18, 18, 9,
+    1, 9, 1, 5, 7, 15, 14, 5, 8, 9, 20, 9, 18, 13, 3, 13,
+    7, 18, 14, 9, 15, 5, 1, 5, 7, 20, 1, 9, 12, 2, 15, 5,
+    5, 1, 5, 9, 19, 20, 1, 4, 20, 22, 6, 14, 19, 20, 16, 19,
+    4, 2, 14, 18, 3, 13, 18, 20, 9, 20, 1, 5, 9, 9, 25, 1,
+    9, 19, 9, 18, 8, 7, 4, 11, 25, 9, 15, 5, 6, 9, 15, 1,
+    9, 15, 0, 6, 9, 15, 0, 9, 15, 1, 15, 20, 21, 1, 9, 21,
+    8, 13, 14, 19, 0, 3, 15, 20, 21, 15, 9, 20, 2, 1, 5, 20,
+    14, 5, 1, 1, 5, 9, 7, 12, 5, 20, 9, 20, 9, 0, 4, 19,
+    5, 1, 9, 15, 9, 1, 9, 4, 16, 20, 7, 9, 1, 14, 2, 12,
+    16, 23, 16, 1, 5, 20, 12, 5, 2, 5, 5, 16, 20, 9, 5, 5,
+    15, 5, 4, 1, 3, 5, 9, 11, 20, 16, 19, 20, 5, 8, 9, 21,
+    5, 9, 15, 12, 14, 20, 4, 14, 1, 19, 2, 6, 13, 20, 1, 21,
+    12, 13, 14, 18, 5, 1, 5, 12, 18, 19, 1, 2, 3, 13, 20, 26,
+    12, 14, 9, 12, 9, 9, 25, 1, 20, 25, 18, 3, 12, 14, 20, 18,
+    19, 12, 18, 2, 3, 14, 20, 0, 19, 12, 18, 18, 12, 2, 6, 7,
+    19, 4, 5, 8, 25, 4, 14, 1, 0, 3, 14, 20, 23, 24, 1, 2,
+    3, 4, 7, 14, 18, 19, 2, 3, 5, 7, 13, 14, 15, 19, 22, 1,
+    15, 3, 7, 16, 8, 1, 4, 7, 3, 7, 14, 12, 20, 3, 5, 7,
+    14, 19, 26, 9, 7, 14, 9, 12, 14, 13, 14, 8, 9, 1, 5, 13,
+    18, 19, 20, 23, 3, 5, 12, 15, 19, 20, 21, 26, 7, 19, 22, 23,
+    1, 8, 1, 6, 0, 1, 5, 15, 15, 20, 9, 14, 12, 14, 20, 5,
+    9, 5, 15, 8, 9, 20, 9, 2, 14, 18, 20, 12, 8, 0, 1, 3,
+    9, 12, 13, 14, 17, 19, 20, 1, 3, 5, 14, 15, 20, 21, 22, 9,
+    15, 2, 3, 18, 21, 5, 5, 12, 23, 20, 1, 7, 1, 18, 21, 3,
+    14, 18, 1, 5, 3, 4, 7, 13, 14, 19, 21, 9, 9, 12, 14, 5,
+    9, 18, 9, 1, 9, 15, 18, 18, 2, 14, 15, 15, 3, 4, 14, 18,
+    20, 14, 1, 5, 9, 15, 1, 13, 15, 5, 9, 18, 16, 19, 1, 12,
+    14, 18, 4, 12, 14, 22, 3, 7, 5, 12, 14, 20, 0, 12, 18, 5,
+    14, 12, 1, 9, 20, 1, 8, 15, 12, 19, 20, 1, 20, 9, 15, 4,
+    18, 19, 5, 14, 19, 25, 0, 1, 5, 9, 19, 21, 5, 8, 9, 12,
+    25, 1, 4, 5, 7, 14, 20, 19, 14, 18, 4, 20, 1, 5, 9, 20,
+    20, 1, 19, 12, 12, 12, 9, 5, 9, 9, 19, 1, 0, 9, 15, 5,
+    15, 9, 15, 14, 19, 8, 9, 26, 9, 25, 1, 9, 15, 25, 13, 25,
+    9, 8, 15, 25, 18, 21, 14, 21, 15, 18, 9, 15, 14, 19, 5, 0,
+    7, 19, 12, 12, 4, 19, 2, 7, 18, 0, 20, 14, 15, 14, 19, 1,
+    4, 9, 9, 15, 0, 4, 9, 14, 16, 25, 14, 19, 20, 6, 5, 18,
+    20, 1, 12, 8, 13, 20, 21, 1, 3, 4, 7, 9, 11, 20, 12, 20,
+    1, 4, 12, 16, 20, 19, 14, 1, 4, 18, 1, 15, 9, 12, 15, 16,
+    1, 18, 1, 2, 5, 14, 15, 25, 16, 5, 14, 15, 8, 5, 1, 14,
+    12, 15, 16, 18, 5, 19, 8, 14, 18, 20, 9, 19, 5, 1, 5, 1,
+    5, 1, 25, 4, 14, 1, 9, 20, 21, 5, 16, 19, 5, 5, 14, 16,
+    18, 14, 19, 9, 11, 20, 20, 18, 5, 8, 5, 3, 9, 20, 5, 19,
+    9, 18, 21, 18, 1, 14, 20, 9, 9, 14, 13, 16, 18, 19, 25, 21,
+    15, 4, 14, 16, 25, 3, 1, 25, 5, 21, 12, 13, 15, 18, 9, 14,
+    1, 19, 1, 5, 15, 20, 21, 5, 13, 23, 15, 5, 1, 4, 1, 5,
+    14, 20, 0, 3, 20, 18, 5, 18, 3, 5, 2, 18, 20, 2, 12, 14,
+    20, 18, 20, 5, 9, 18, 2, 4, 13, 18, 7, 18, 22, 1, 2, 15,
+    19, 20, 26, 1, 17, 25, 18, 7, 18, 14, 20, 4, 12, 14, 20, 9,
+    14, 12, 21, 22, 5, 12, 5, 18, 19, 1, 5, 9, 12, 15, 21, 0,
+    1, 15, 19, 20, 3, 19, 20, 5, 21, 0, 8, 19, 5, 18, 1, 5,
+    9, 8, 9, 8, 9, 15, 18, 18, 3, 5, 12, 1, 5, 9, 2, 3,
+    5, 4, 6, 12, 19, 9, 4, 19, 20, 26, 9, 7, 14, 12, 7, 18,
+    19, 8, 18, 1, 15, 2, 4, 19, 20, 1, 19, 13, 9, 25, 1, 5,
+    1, 5, 9, 12, 18, 19, 0, 2, 7, 13, 14, 20, 18, 19, 1, 3,
+    7, 12, 13, 15, 19, 13, 14, 1, 25, 1, 4, 12, 0, 12, 14, 18,
+    12, 15, 20, 18, 20, 18, 14, 17, 19, 20, 7, 19, 9, 4, 20, 25,
+    12, 15, 0, 4, 5, 7, 8, 25, 19, 8, 14, 9, 15, 9, 5, 25,
+    14, 15, 4, 5, 20, 7, 9, 5, 1, 5, 9, 1, 14, 18, 19, 9,
+    9, 20, 0, 7, 1, 0, 3, 5, 20, 8, 18, 1, 5, 7, 9, 15,
+    3, 17, 19, 1, 5, 5, 18, 19, 7, 13, 18, 19, 20, 9, 9, 15,
+    19, 20, 21, 25, 1, 5, 9, 5, 6, 12, 1, 8, 18, 2, 9, 15,
+    16, 1, 5, 9, 11, 7, 16, 0, 9, 5, 12, 20, 23, 1, 3, 7,
+    12, 14, 20, 14, 17, 21, 23, 20, 14, 4, 14, 1, 9, 9, 15, 21,
+    5, 7, 9, 4, 5, 9, 13, 1, 9, 15, 0, 5, 15, 20, 1, 14,
+    20, 2, 1, 9, 14, 20, 5, 7, 14, 14, 18, 9, 5, 19, 18, 18,
+    8, 9, 14, 4, 1, 9, 14, 18, 19, 20, 14, 20, 5, 15, 5, 1,
+    8, 12, 9, 14, 4, 4, 9, 12, 20, 9, 9, 12, 22, 3, 5, 20,
+    5, 8, 9, 20, 12, 14, 22, 0, 9, 25, 15, 20, 15, 1, 4, 5,
+    9, 19, 20, 14, 19, 20, 1, 5, 8, 18, 1, 7, 9, 12, 1, 4,
+    5, 7, 20, 21, 20, 5, 12, 20, 8, 18, 14, 18, 15, 19, 5, 5,
+    5, 7, 9, 15, 25, 1, 5, 16, 8, 6, 19, 18, 20, 1, 1, 5,
+    14, 18, 19, 18, 19, 21, 22, 18, 1, 20, 21, 0, 1, 20, 5, 9,
+    20, 9, 3, 9, 11, 3, 5, 9, 12, 13, 3, 20, 1, 15, 19, 20,
+    5, 18, 19, 1, 5, 9, 14, 20, 21, 9, 14, 19, 2, 6, 20, 26,
+    3, 18, 5, 18, 21, 11, 1, 5, 1, 9, 9, 15, 5, 15, 1, 5,
+    9, 18, 0, 16, 20, 23, 9, 5, 2, 12, 14, 18, 1, 2, 14, 20,
+    1, 22, 8, 13, 2, 14, 16, 1, 12, 9, 18, 9, 18, 9, 5, 7,
+    0, 20, 8, 9, 15, 18, 18, 20, 14, 20, 1, 22, 12, 12, 5, 19,
+    9, 15, 9, 15, 25, 1, 9, 15, 1, 3, 5, 20, 1, 14, 5, 12,
+    5, 2, 20, 19, 4, 7, 3, 5, 9, 1, 2, 18, 2, 5, 6, 14,
+    16, 15, 13, 14, 6, 14, 20, 5, 9, 18, 5, 4, 5, 20, 9, 2,
+    18, 12, 14, 12, 5, 6, 12, 1, 4, 1, 5, 9, 15, 12, 18, 5,
+    3, 15, 18, 3, 7, 1, 20, 18, 20, 14, 15, 18, 5, 19, 20, 25,
+    9, 15, 9, 14, 2, 5, 5, 6, 5, 7, 20, 13, 15, 20, 5, 14,
+    5, 14, 19, 5, 18, 19, 20, 9, 1, 3, 4, 6, 12, 14, 15, 19,
+    20, 22, 9, 7, 18, 12, 2, 13, 14, 19, 8, 12, 20, 5, 12, 14,
+    18, 20, 1, 3, 4, 14, 5, 7, 14, 9, 18, 3, 14, 9, 15, 14,
+    19, 21, 3, 15, 19, 21, 5, 4, 13, 16, 21, 5, 9, 13, 1, 5,
+    9, 9, 4, 20, 4, 18, 1, 5, 14, 20, 14, 19, 0, 7, 12, 14,
+    1, 9, 19, 23, 21, 1, 3, 12, 14, 15, 20, 21, 9, 5, 6, 21,
+    5, 8, 5, 20, 8, 25, 13, 12, 5, 15, 18, 5, 20, 21, 1, 15,
+    1, 9, 14, 12, 18, 19, 5, 9, 3, 6, 19, 19, 12, 8, 20, 3,
+    4, 14, 18, 19, 20, 12, 5, 12, 19, 9, 1, 5, 20, 1, 14, 1,
+    5, 20, 25, 21, 1, 4, 5, 9, 5, 8, 18, 18, 5, 9, 4, 1,
+    9, 1, 3, 20, 14, 1, 9, 13, 14, 15, 20, 21, 22, 5, 9, 18,
+    14, 18, 19, 3, 5, 14, 19, 26, 2, 14, 18, 14, 9, 25, 1, 5,
+    9, 3, 14, 18, 15, 0, 4, 15, 14, 8, 21, 14, 19, 1, 5, 7,
+    14, 9, 13, 0, 13, 20, 14, 25, 9, 25, 19, 1, 14, 18, 4, 12,
+    14, 18, 20, 19, 25, 3, 5, 6, 12, 18, 19, 20, 22, 5, 14, 19,
+    3, 6, 12, 19, 20, 2, 2, 13, 18, 3, 18, 5, 18, 20, 22, 0,
+    18, 20, 9, 8, 12, 6, 20, 15, 5, 9, 5, 7, 9, 15, 5, 8,
+    3, 5, 9, 9, 20, 1, 5, 9, 2, 7, 6, 14, 14, 1, 5, 2,
+    20, 13, 12, 1, 5, 14, 12, 14, 18, 22, 23, 18, 15, 18, 5, 9,
+    1, 5, 9, 25, 9, 20, 9, 21, 20, 9, 15, 21, 9, 15, 21, 0,
+    16, 19, 20, 5, 9, 18, 20, 1, 5, 9, 15, 8, 18, 20, 3, 14,
+    19, 20, 14, 12, 2, 7, 1, 1, 5, 9, 15, 5, 14, 18, 20, 1,
+    9, 9, 1, 9, 15, 16, 1, 4, 5, 7, 8, 12, 0, 3, 8, 16,
+    1, 5, 9, 21, 5, 9, 20, 5, 9, 4, 7, 19, 3, 14, 18, 14,
+    15, 20, 18, 12, 18, 20, 25, 3, 19, 20, 22, 21, 12, 18, 5, 9,
+    5, 5, 5, 9, 16, 1, 5, 9, 20, 13, 20, 5, 9, 9, 15, 16,
+    19, 8, 25, 1, 5, 1, 14, 18, 20, 14, 3, 6, 15, 19, 15, 22,
+    14, 19, 19, 20, 3, 18, 19, 22, 1, 2, 14, 3, 7, 2, 14, 15,
+    2, 4, 5, 7, 12, 19, 22, 9, 15, 8, 12, 14, 12, 14, 16, 11,
+    20, 3, 9, 12, 14, 18, 19, 25, 3, 22, 7, 11, 18, 20, 1, 13,
+    15, 20, 3, 4, 1, 9, 21, 15, 14, 16, 22, 4, 9, 19, 15, 5,
+    14, 5, 9, 6, 16, 21, 19, 23, 15, 20, 5, 12, 18, 5, 6, 22,
+    5, 15, 1, 3, 4, 5, 7, 9, 20, 1, 0, 12, 15, 22, 8, 20,
+    13, 5, 9, 18, 22, 14, 15, 16, 22, 12, 14, 18, 3, 5, 9, 14,
+    5, 25, 1, 5, 7, 14, 1, 9, 20, 14, 20, 20, 12, 14, 12, 14,
+    20, 12, 5, 20, 1, 4, 9, 22, 0, 1, 7, 8, 3, 4, 9, 9,
+    14, 14, 15, 18, 5, 15, 12, 14, 15, 25, 14, 18, 20, 1, 19, 12,
+    14, 19, 20, 5, 12, 9, 5, 18, 7, 12, 13, 14, 16, 20, 4, 18,
+    23, 5, 0, 1, 3, 5, 6, 14, 18, 5, 3, 13, 14, 16, 18, 1,
+    9, 25, 12, 19, 20, 9, 15, 9, 12, 15, 9, 15, 12, 1, 5, 9,
+    11, 12, 15, 15, 4, 20, 5, 12, 1, 3, 5, 9, 5, 25, 9, 21,
+    14, 9, 5, 4, 20, 5, 20, 9, 5, 9, 0, 9, 19, 1, 1, 3,
+    4, 5, 20, 5, 3, 4, 9, 14, 22, 0, 19, 8, 14, 1, 9, 20,
+    3, 12, 14, 4, 15, 18, 2, 20, 11, 15, 21, 9, 14, 25, 21, 12,
+    16, 21, 1, 5, 9, 3, 14, 1, 5, 13, 15, 16, 20, 12, 1, 1,
+    5, 14, 0, 4, 19, 20, 18, 15, 18, 3, 1, 2, 25, 1, 15, 25,
+    1, 9, 18, 20, 1, 2, 3, 19, 22, 6, 13, 1, 3, 13, 22, 13,
+    14, 16, 19, 22, 9, 19, 19, 18, 9, 9, 0, 5, 9, 15, 25, 19,
+    5, 8, 1, 9, 1, 4, 9, 20, 12, 18, 14, 5, 2, 20, 5, 18,
+    19, 22, 3, 5, 19, 20, 14, 9, 5, 19, 20, 9, 5, 14, 9, 7,
+    13, 1, 5, 2, 20, 8, 5, 14, 9, 1, 14, 19, 1, 9, 5, 9,
+    18, 21, 12, 2, 9, 12, 14, 18, 20, 18, 13, 14, 19, 22, 23, 1,
+    5, 19, 18, 1, 14, 15, 9, 21, 0, 7, 19, 5, 1, 5, 18, 6,
+    14, 15, 20, 26, 9, 15, 19, 5, 9, 5, 5, 8, 9, 4, 14, 16,
+    9, 1, 1, 3, 9, 12, 5, 18, 18, 2, 20, 0, 12, 14, 12, 14,
+    15, 19, 26, 6, 7, 13, 14, 21, 9, 21, 5, 9, 15, 21, 15, 9,
+    9, 9, 0, 12, 15, 25, 15, 21, 4, 5, 9, 13, 19, 20, 0, 20,
+    5, 25, 12, 14, 5, 9, 14, 9, 1, 3, 4, 7, 12, 18, 21, 15,
+    9, 15, 21, 9, 18, 25, 1, 5, 20, 22, 9, 1, 9, 25, 1, 5,
+    12, 5, 15, 20, 0, 20, 20, 5, 5, 18, 20, 14, 20, 22, 12, 20,
+    12, 4, 7, 5, 8, 19, 14, 5, 20, 5, 5, 15, 21, 9, 15, 12,
+    9, 5, 9, 14, 3, 4, 18, 5, 13, 20, 6, 1, 15, 1, 8, 3,
+    5, 19, 4, 18, 3, 1, 13, 1, 3, 15, 19, 1, 18, 9, 3, 15,
+    12, 4, 21, 15, 25, 16, 1, 5, 9, 5, 15, 5, 15, 24, 5, 15,
+    5, 20, 8, 3, 12, 21, 13, 19, 9, 13, 5, 9, 18, 12, 20, 5,
+    8, 20, 1, 9, 25, 8, 9, 15, 5, 18, 13, 14, 5, 15, 13, 1,
+    18, 12, 20, 15, 9, 11, 1, 4, 11, 15, 5, 8, 14, 3, 9, 18,
+    23, 1, 2, 1, 13, 20, 9, 12, 21, 9, 7, 19, 12, 13, 18, 23,
+    13, 14, 14, 14, 5, 15, 11, 12, 14, 20, 21, 23, 14, 19, 1, 6,
+    7, 3, 9, 19, 20, 26, 8, 15, 12, 5, 16, 3, 1, 1, 9, 15,
+    20, 1, 5, 12, 1, 14, 16, 18, 13, 19, 1, 3, 12, 15, 12, 1,
+    17, 18, 19, 8, 5, 14, 5, 5, 12, 21, 16, 6, 7, 19, 20, 25,
+    5, 14, 5, 1, 18, 15, 14, 3, 19, 16, 6, 5, 20, 5, 15, 3,
+    8, 20, 19, 1, 5, 12, 12, 9, 1, 5, 9, 15, 1, 9, 3, 12,
+    8, 20, 6, 11, 5, 16, 20, 12, 3, 6, 2, 3, 6, 22, 13, 16,
+    14, 2, 16, 1, 12, 20, 20, 9, 20, 14, 19, 5, 11, 3, 13, 20,
+    13, 15, 5, 12, 18, 14, 20, 9, 15, 9, 5, 1, 25, 5, 20, 14,
+    18, 12, 21, 18, 5, 12, 18, 13, 20, 21, 9, 7, 13, 4, 18, 23,
+    15, 13, 19, 20, 5, 5, 22, 14, 11, 1, 15, 19, 5, 20, 4, 7,
+    13, 19, 20, 5, 19, 1, 13, 20, 14, 19, 9, 5, 20, 21, 14, 1,
+    6, 18, 6, 9, 4, 11, 2, 12, 3, 14, 9, 19, 9, 15, 1, 13,
+    15, 1, 2, 18, 16, 6, 11, 11, 15, 5, 15, 5, 15, 19, 2, 14,
+    5, 18, 5, 8, 15, 14, 1, 15, 15, 12, 9, 15, 9, 7, 21, 5,
+    9, 9, 21, 9, 18, 21, 20, 5, 20, 1, 5, 7, 20, 14, 11, 21,
+    1, 1, 5, 21, 7, 15, 19, 12, 14, 19, 14, 15, 20, 19, 14, 9,
+    25, 5, 3, 4, 3, 5, 8, 6, 5, 3, 20, 11, 5, 20, 1, 8,
+    15, 5, 14, 19, 21, 8, 15, 5, 2, 7, 11, 21, 9, 5, 1, 2,
+    15, 18, 1, 5, 5, 1, 15, 1, 3, 19, 21, 7, 11, 20, 19, 8,
+    20, 23, 9, 1, 3, 1, 5, 8, 18, 18, 1, 12, 5, 9, 5, 9,
+    11, 14, 21, 3, 5, 15, 20, 13, 5, 5, 1, 5, 15, 20, 15, 3,
+    17, 18, 20, 1, 8, 5, 8, 6, 14, 8, 2, 19, 5, 19, 20, 13,
+    16, 18, 5, 20, 1, 5, 9, 16, 19, 21, 26, 18, 5, 15, 23, 5,
+    12, 3, 9, 20, 19, 12, 5, 7, 9, 13, 14, 18, 14, 20, 15, 8,
+    12, 18, 4, 4, 5, 14, 1, 5, 1, 8, 1, 22, 1, 20, 5, 9,
+    18, 6, 14, 12, 14, 19, 20, 8, 1, 14, 5, 1, 3, 14, 20, 1,
+    7, 14, 20, 25, 5, 15, 20, 20, 5, 15, 1, 4, 6, 12, 13, 16,
+    19, 20, 23, 5, 3, 7, 8, 10, 11, 13, 16, 19, 20, 22, 23, 21,
+    3, 5, 7, 14, 8, 4, 9, 19, 14, 2, 8, 9, 6, 19, 20, 8,
+    9, 5, 9, 12, 18, 9, 15, 20, 9, 21, 3, 4, 15, 21, 3, 13,
+    9, 1, 8, 15, 18, 20, 18, 19, 9, 18, 14, 13, 8, 7, 21, 15,
+    6, 20, 14, 4, 2, 5, 9, 13, 20, 19, 5, 5, 20, 14, 5, 9,
+    14, 15, 18, 23, 5, 21, 20, 18, 6, 12, 1, 5, 9, 20, 7, 9,
+    15, 22, 17, 21, 5, 16, 5, 16, 18, 23, 24, 5, 14, 7, 21, 19,
+    21, 11, 18, 5, 21, 5, 3, 3, 12, 14, 5, 9, 3, 14, 11, 18,
+    9, 5, 2, 14, 18, 20, 1, 5, 18, 3, 11, 1, 5, 9, 15, 16,
+    20, 4, 5, 14, 19, 20, 13, 5, 18, 7, 22, 17, 13, 16, 3, 12,
+    6, 5, 11, 5, 16, 2, 8, 5, 12, 16, 1, 14, 21, 1, 20, 18,
+    20, 12, 18, 18, 5, 15, 7, 11, 3, 1, 1, 12, 9, 15, 21, 19,
+    15, 9, 14, 22, 1, 2, 5, 16, 21, 11, 14, 1, 15, 1, 20, 5,
+    5, 18, 18, 14, 21, 4, 4, 1, 5, 20, 1, 9, 20, 9, 20, 12,
+    21, 9, 3, 1, 4, 18, 12, 13, 20, 5, 16, 12, 11, 7, 14, 11,
+    14, 20, 5, 3, 20, 5, 9, 12, 3, 7, 20, 19, 3, 6, 4, 11,
+    16, 20, 9, 9, 20, 7, 12, 20, 4, 1, 20, 9, 7, 4, 15, 21,
+    20, 2, 6, 14, 0, 1, 18, 14, 5, 12, 9, 18, 14, 14, 4, 20,
+    0, 22, 3, 0, 20, 1, 3, 9, 15, 1, 25, 15, 9, 14, 5, 25,
+    3, 9, 9, 19, 19, 23, 20, 5, 19, 5, 9, 5, 8, 9, 26, 8,
+    15, 15, 18, 12, 5, 15, 18, 12, 1, 21, 1, 9, 20, 19, 20, 5,
+    9, 5, 7, 9, 12, 1, 14, 19, 20, 19, 12, 14, 20, 1, 9, 20,
+    0, 14, 1, 12, 15, 8, 15, 0, 1, 14, 20, 13, 14, 13, 14, 21,
+    9, 16, 7, 1, 2, 14, 15, 1, 14, 25, 18, 18, 5, 1, 9, 1,
+    9, 1, 7, 18, 26, 26, 18, 20, 18, 15, 1, 8, 16, 20, 3, 9,
+    20, 4, 8, 5, 9, 5, 5, 15, 14, 14, 20, 1, 9, 3, 19, 26,
+    25, 18, 13, 5, 9, 22, 12, 16, 20, 14, 13, 9, 9, 16, 15, 9,
+    5, 0, 19, 5, 9, 3, 20, 13, 0, 3, 1, 9, 26, 1, 5, 3,
+    18, 18, 3, 14, 20, 0, 9, 20, 1, 9, 12, 15, 5, 7, 20, 21,
+    9, 25, 9, 21, 2, 1, 9, 5, 22, 22, 20, 14, 14, 12, 13, 5,
+    17, 3, 12, 14, 18, 18, 9, 9, 9, 18, 12, 13, 20, 0, 26, 9,
+    0, 19, 18, 26, 20, 15, 18, 12, 18, 0, 19, 5, 5, 18, 18, 21,
+    18, 19, 3, 12, 5, 14, 9, 6, 14, 0, 19, 3, 19, 9, 25, 5,
+    13, 19, 13, 16, 3, 1, 15, 13, 14, 1, 1, 15, 5, 9, 5, 9,
+    5, 5, 7, 20, 9, 4, 9, 1, 18, 1, 5, 0, 1, 18, 9, 7,
+    8, 2, 0, 1, 1, 18, 5, 9, 8, 19, 26, 9, 1, 15, 20, 5,
+    3, 15, 9, 20, 18, 19, 8, 7, 5, 18, 12, 3, 20, 9, 3, 4,
+    8, 2, 2, 1, 12, 19, 4, 9, 5, 12, 15, 14, 0, 15, 1, 3,
+    5, 20, 19, 20, 11, 14, 18, 5, 1, 19, 20, 26, 20, 18, 21, 5,
+    14, 18, 3, 20, 22, 14, 5, 14, 20, 14, 21, 1, 18, 18, 5, 2,
+    14, 7, 13, 14, 15, 21, 18, 4, 4, 5, 15, 9, 1, 3, 6, 7,
+    19, 12, 20, 12, 15, 7, 9, 2, 7, 5, 19, 8, 5, 20, 8, 5,
+    0, 12, 14, 20, 14, 18, 1, 5, 12, 20, 9, 9, 19, 5, 5, 20,
+    25, 20, 1, 3, 14, 20, 19, 26, 22, 14, 19, 26, 20, 26, 20, 1,
+    0, 14, 5, 9, 20, 15, 26, 21, 1, 8, 19, 4, 13, 9, 25, 0,
+    5, 15, 26, 5, 14, 19, 5, 5, 5, 5, 14, 20, 9, 25, 20, 16,
+    1, 1, 21, 4, 18, 5, 12, 5, 9, 26, 18, 20, 19, 5, 14, 5,
+    12, 9, 15, 14, 5, 20, 20, 22, 9, 1, 20, 0, 5, 0, 1, 1,
+    1, 1, 1, 3, 12, 14, 18, 21, 9, 15, 14, 0, 1, 9, 5, 1,
+    20, 2, 5, 25, 20, 1, 5, 9, 1, 12, 18, 9, 1, 19, 14, 9,
+    5, 9, 25, 18, 20, 18, 1, 6, 4, 20, 5, 5, 21, 14, 0, 14,
+    14, 16, 9, 14, 5, 12, 14, 19, 0, 25, 1, 9, 1, 9, 1, 11,
+    12, 13, 13, 20, 12, 0, 0, 19, 0, 5, 15, 20, 9, 25, 0, 5,
+    19, 3, 12, 20, 5, 14, 12, 22, 5, 9, 20, 0, 2, 15, 0, 18,
+    9, 15, 15, 18, 0, 18, 18, 20, 1, 12, 1, 5, 3, 18, 1, 21,
+    20, 7, 12, 3, 18, 26, 0, 20, 5, 21, 20, 16, 4, 7, 5, 1,
+    19, 1, 0, 9, 5, 9, 14, 7, 14, 9, 25, 1, 19, 26, 14, 26,
+    25, 5, 19, 26, 7, 1, 5, 14, 3, 5, 21, 5, 1, 9, 12, 9,
+    9, 25, 1, 5, 5, 12, 18, 9, 18, 25, 1, 5, 19, 20, 5, 1,
+    19, 26, 12, 0, 0, 25, 1, 9, 19, 19, 9, 9, 19, 18, 9, 18,
+    1, 20, 9, 20, 9, 12, 13, 5, 0, 15, 12, 19, 18, 20, 20, 26,
+    2, 18, 3, 5, 5, 9, 3, 26, 0, 1, 15, 18, 15, 12, 5, 9,
+    7, 3, 26, 7, 26, 12, 2, 18, 12, 3, 9, 2, 19, 18, 5, 7,
+    12, 5, 5, 19, 5, 7, 20, 13, 3, 20, 20, 18, 1, 5, 4, 20,
+    5, 20, 9, 15, 5, 26, 19, 18, 20, 5, 14, 5, 18, 19, 3, 5,
+    0, 7, 0, 8, 5, 9, 5, 9, 5, 9, 1, 19, 18, 0, 1, 9,
+    14, 5, 15, 12, 20, 25, 9, 25, 9, 14, 6, 1, 14, 18, 7, 9,
+    9, 7, 12, 8, 20, 1, 25, 7, 14, 9, 25, 16, 9, 15, 25, 20,
+    12, 20, 5, 0, 19, 19, 0, 1, 5, 9, 5, 14, 19, 20, 9, 18,
+    20, 14, 20, 12, 25, 2, 7, 9, 12, 19, 18, 9, 25, 9, 12, 1,
+    3, 5, 14, 8, 0, 2, 7, 19, 1, 5, 9, 14, 26, 9, 15, 0,
+    7, 20, 5, 9, 5, 1, 1, 20, 18, 2, 20, 20, 1, 9, 5, 9,
+    15, 13, 1, 1, 5, 19, 5, 20, 15, 1, 9, 5, 18, 5, 9, 5,
+    9, 20, 15, 5, 18, 25, 6, 12, 15, 9, 12, 5, 5, 7, 18, 18,
+    7, 18, 1, 12, 13, 5, 19, 20, 3, 18, 19, 1, 5, 14, 19, 9,
+    9, 1, 18, 18, 26, 9, 9, 12, 12, 18, 12, 12, 7, 19, 4, 5,
+    18, 3, 20, 14, 26, 14, 5, 0, 5, 9, 2, 4, 18, 3, 18, 12,
+    20, 14, 8, 19, 7, 12, 18, 0, 20, 12, 19, 1, 12, 3, 5, 5,
+    12, 20, 0, 7, 20, 9, 18, 0, 8, 4, 18, 9, 12, 25, 20, 16,
+    12, 25, 14, 9, 0, 20, 5, 9, 18, 5, 15, 18, 20, 4, 25, 18,
+    12, 20, 4, 14, 4, 12, 15, 14, 4, 20, 0, 19, 26, 1, 0, 1,
+    15, 5, 7, 8, 12, 8, 4, 2, 3, 9, 25, 4, 18, 7, 12, 7,
+    0, 18, 25, 14, 1, 9, 4, 0, 14, 15, 1, 11, 7, 11, 1, 5,
+    5, 4, 20, 25, 4, 14, 5, 12, 15, 14, 9, 7, 5, 1, 18, 26,
+    3, 18, 19, 20, 9, 18, 20, 14, 19, 1, 5, 19, 26, 9, 0, 5,
+    19, 20, 19, 0, 1, 11, 5, 9, 9, 15, 9, 12, 0, 5, 9, 14,
+    0, 0, 1, 12, 20, 5, 26, 18, 8, 9, 20, 5, 9, 5, 9, 19,
+    9, 9, 25, 8, 16, 19, 19, 14, 15, 7, 0, 20, 4, 19, 5, 12,
+    14, 26, 18, 9, 5, 18, 7, 8, 18, 2, 19, 19, 1, 25, 7, 15,
+    8, 2, 18, 19, 19, 7, 18, 2, 20, 18, 9, 14, 18, 19, 5, 5,
+    14, 18, 9, 9, 5, 7, 14, 1, 12, 5, 26, 5, 9, 13, 5, 0,
+    12, 14, 19, 5, 9, 5, 8, 5, 18, 9, 0, 4, 14, 19, 20, 26,
+    20, 2, 5, 18, 18, 9, 8, 9, 5, 14, 1, 20, 26, 4, 20, 2,
+    12, 18, 20, 1, 14, 5, 19, 14, 12, 21, 2, 18, 2, 14, 19, 18,
+    14, 1, 2, 14, 7, 5, 8, 25, 18, 15, 22, 1, 4, 8, 14, 18,
+    19, 9, 12, 8, 14, 5, 9, 1, 14, 5, 5, 7, 19, 3, 18, 15,
+    16, 3, 18, 19, 19, 9, 1, 18, 13, 14, 18, 18, 19, 12, 18, 14,
+    12, 25, 9, 8, 5, 1, 9, 15, 1, 22, 15, 15, 5, 9, 14, 6,
+    5, 8, 1, 1, 5, 8, 5, 1, 4, 4, 4, 16, 13, 19, 5, 15,
+    15, 12, 14, 19, 17, 16, 5, 5, 11, 5, 9, 5, 9, 23, 5, 16,
+    5, 18, 5, 2, 20, 2, 12, 23, 18, 19, 14, 9, 3, 1, 12, 20,
+    15, 20, 14, 8, 12, 18, 5, 18, 21, 19, 12, 19, 1, 14, 18, 9,
+    13, 1, 5, 15, 20, 21, 15, 5, 18, 20, 18, 18, 12, 15, 19, 5,
+    3, 13, 14, 19, 18, 11, 15, 19, 20, 12, 9, 15, 18, 11, 8, 19,
+    25, 5, 2, 16, 19, 12, 1, 9, 14, 23, 3, 19, 3, 9, 19, 22,
+    5, 12, 9, 18, 19, 14, 18, 1, 18, 9, 8, 12, 12, 8, 20, 5,
+    5, 12, 5, 15, 13, 5, 15, 8, 5, 15, 25, 14, 8, 20, 9, 19,
+    12, 5, 9, 5, 5, 15, 20, 22, 14, 14, 14, 12, 14, 18, 1, 19,
+    19, 20, 1, 9, 1, 12, 9, 21, 9, 19, 18, 20, 5, 13, 7, 9,
+    3, 18, 5, 9, 3, 25, 8, 2, 12, 14, 15, 20, 20, 3, 24, 13,
+    19, 20, 5, 5, 20, 8, 18, 12, 20, 14, 15, 6, 12, 4, 19, 6,
+    22, 8, 16, 4, 13, 1, 19, 12, 19, 20, 23, 12, 9, 9, 5, 8,
+    15, 15, 9, 4, 7, 16, 18, 20, 1, 9, 5, 9, 4, 19, 15, 12,
+    23, 1, 4, 14, 15, 20, 25, 5, 5, 4, 18, 15, 18, 5, 5, 20,
+    15, 12, 7, 19, 20, 18, 17, 5, 14, 4, 14, 2, 14, 1, 20, 1,
+    7, 18, 9, 20, 4, 22, 5, 8, 18, 5, 15, 1, 14, 19, 13, 1,
+    9, 13, 1, 19, 5, 15, 20, 9, 14, 5, 8, 5, 5, 14, 1, 19,
+    5, 18, 8, 12, 14, 5, 5, 15, 19, 15, 20, 21, 2, 19, 5, 3,
+    9, 15, 20, 19, 1, 5, 1, 1, 19, 19, 19, 5, 19, 15, 12, 9,
+    16, 25, 8, 12, 19, 9, 15, 20, 9, 1, 5, 5, 5, 3, 15, 6,
+    12, 14, 2, 6, 12, 16, 19, 20, 13, 18, 1, 15, 25, 15, 15, 6,
+    1, 9, 15, 3, 19, 19, 15, 5, 20, 8, 18, 7, 9, 15, 12, 3,
+    18, 25, 3, 5, 9, 16, 19, 20, 18, 14, 15, 21, 15, 9, 2, 18,
+    19, 22, 9, 1, 5, 18, 19, 3, 19, 12, 26, 5, 15, 15, 12, 8,
+    13, 18, 13, 17, 20, 21, 19, 19, 13, 14, 5, 4, 16, 23, 9, 13,
+    5, 18, 7, 6, 20, 9, 15, 15, 16, 1, 2, 15, 1, 7, 15, 16,
+    15, 22, 9, 9, 18, 12, 20, 18, 20, 2, 3, 4, 6, 7, 12, 13,
+    15, 12, 9, 12, 1, 20, 15, 6, 15, 25, 1, 15, 5, 16, 15, 1,
+    9, 4, 12, 14, 1, 20, 5, 19, 9, 3, 5, 1, 4, 5, 7, 16,
+    19, 7, 5, 21, 1, 1, 8, 19, 21, 14, 13, 13, 9, 5, 15, 1,
+    18, 2, 5, 16, 20, 18, 19, 5, 21, 5, 18, 9, 5, 1, 9, 5,
+    3, 20, 5, 15, 9, 5, 4, 8, 19, 5, 7, 1, 4, 18, 14, 9,
+    20, 9, 1, 15, 9, 8, 19, 15, 14, 11, 12, 18, 16, 7, 1, 18,
+    3, 8, 21, 18, 7, 8, 16, 20, 9, 18, 19, 9, 1, 15, 9, 15,
+    1, 5, 18, 1, 9, 15, 1, 20, 12, 20, 20, 4, 5, 19, 5, 15,
+    1, 1, 12, 18, 15, 5, 4, 13, 26, 1, 15, 20, 15, 1, 5, 20,
+    8, 5, 5, 16, 19, 4, 8, 18, 19, 20, 5, 5, 5, 5, 15, 21,
+    16, 18, 1, 5, 19, 12, 5, 8, 21, 19, 1, 12, 16, 3, 14, 5,
+    11, 14, 20, 18, 5, 9, 12, 21, 4, 18, 14, 9, 15, 5, 20, 7,
+    1, 12, 4, 20, 9, 12, 16, 5, 8, 5, 14, 16, 20, 20, 16, 14,
+    9, 20, 9, 24, 15, 3, 1, 1, 18, 5, 5, 5, 21, 13, 20, 8,
+    5, 18, 15, 1, 19, 1, 5, 14, 7, 11, 18, 5, 15, 14, 5, 18,
+    14, 2, 1, 8, 12, 23, 1, 13, 21, 19, 8, 19, 11, 7, 9, 5,
+    20, 20, 19, 5, 3, 5, 21, 20, 12, 2, 5, 1, 12, 7, 9, 20,
+    18, 18, 9, 19, 5, 5, 5, 12, 9, 5, 18, 1, 8, 20, 8, 1,
+    1, 16, 5, 3, 9, 19, 6, 5, 5, 7, 12, 15, 9, 15, 14, 8,
+    19, 26, 5, 8, 12, 8, 5, 19, 9, 8, 19, 19, 5, 8, 6, 19,
+    1, 8, 1, 3, 9, 20, 9, 14, 5, 25, 1, 19, 2, 26, 9, 19,
+    0, 1, 19, 20, 15, 22, 14, 5, 20, 1, 1, 26, 18, 7, 18, 14,
+    18, 7, 1, 2, 3, 19, 0, 19, 0, 20, 3, 19, 0, 19, 6, 26,
+    15, 14, 9, 1, 3, 5, 5, 20, 19, 0, 22, 1, 2, 1, 15, 18,
+    5, 19, 20, 1, 0, 5, 0, 19, 0, 19, 1, 14, 1, 5, 1, 3,
+    15, 22, 5, 14, 1, 0, 5, 9, 25, 0, 18, 14, 18, 19, 18, 26,
+    5, 3, 1, 14, 18, 14, 0, 15, 1, 25, 19, 22, 18, 12, 0, 5,
+    19, 9, 9, 0, 1, 19, 26, 5, 18, 1, 19, 9, 15, 8, 0, 1,
+    14, 5, 1, 3, 5, 9, 25, 0, 25, 20, 20, 13, 20, 2, 20, 0,
+    9, 1, 0, 9, 1, 9, 9, 25, 12, 12, 9, 1, 0, 19, 22, 18,
+    14, 15, 26, 26, 5, 25, 4, 18, 7, 26, 5, 0, 9, 22, 9, 7,
+    9, 18, 5, 12, 5, 3, 3, 12, 20, 12, 9, 16, 20, 3, 14, 20,
+    4, 14, 14, 0, 20, 12, 16, 0, 9, 2, 12, 0, 19, 20, 21, 3,
+    0, 0, 19, 0, 5, 18, 8, 1, 3, 26, 12, 4, 9, 21, 19, 9,
+    19, 7, 19, 1, 20, 3, 20, 26, 14, 5, 3, 20, 9, 20, 5, 14,
+    19, 19, 1, 5, 20, 0, 0, 20, 3, 7, 5, 26, 1, 20, 4, 3,
+    14, 5, 14, 15, 15, 12, 13, 1, 25, 1, 14, 12, 12, 1, 16, 20,
+    15, 14, 18, 17, 8, 20, 18, 19, 25, 20, 5, 12, 5, 15, 15, 21,
+    5, 15, 15, 5, 4, 20, 13, 16, 22, 14, 19, 18, 14, 20, 9, 12,
+    14, 20, 8, 15, 16, 5, 2, 7, 1, 1, 15, 21, 5, 15, 4, 3,
+    5, 21, 9, 9, 13, 19, 5, 21, 14, 7, 4, 3, 18, 9, 0, 19,
+    15, 9, 6, 19, 15, 2, 20, 4, 25, 1, 16, 5, 5, 5, 18, 5,
+    5, 1, 12, 14, 9, 9, 23, 21, 5, 18, 5, 8, 18, 19, 14, 4,
+    15, 1, 8, 18, 1, 8, 2, 8, 18, 20, 15, 6, 5, 18, 5, 15,
+    18, 11, 20, 5, 7, 5, 9, 15, 19, 5, 5, 15, 5, 9, 3, 0,
+    14, 14, 2, 14, 18, 14, 14, 18, 20, 18, 18, 5, 18, 9, 9, 1,
+    9, 16, 16, 18, 1, 9, 7, 5, 11, 3, 19, 4, 8, 15, 15, 9,
+    6, 13, 22, 23, 9, 15, 8, 12, 12, 1, 1, 20, 15, 18, 14, 9,
+    1, 20, 5, 18, 0, 1, 3, 15, 15, 1, 20, 5, 0, 18, 1, 9,
+    19, 5, 5, 5, 19, 1, 18, 4, 5, 0, 12, 9, 3, 24, 16, 14,
+    13, 19, 3, 22, 15, 18, 19, 3, 0, 0, 19, 16, 16, 16, 1, 15,
+    3, 5, 1, 5, 25, 9, 3, 20, 9, 0, 5, 9, 19, 14, 19, 15,
+    9, 14, 1, 15, 3, 9, 5, 12, 1, 12, 4, 8, 15, 18, 4, 8,
+    20, 18, 19, 15, 4, 12, 5, 19, 20, 9, 25, 5, 9, 20, 19, 20,
+    20, 18, 5, 15, 12, 19, 22, 15, 14, 18, 9, 9, 21, 13, 19, 1,
+    15, 5, 12, 12, 1, 0, 20, 9, 16, 15, 1, 20, 14, 17, 5, 21,
+    16, 20, 14, 5, 12, 8, 8, 9, 16, 20, 19, 5, 0, 16, 5, 1,
+    9, 5, 15, 13, 19, 8, 18, 4, 19, 0, 20, 5, 14, 12, 8, 7,
+    19, 18, 25, 5, 15, 5, 21, 13, 9, 15, 1, 9, 9, 19, 5, 12,
+    18, 4, 7, 22, 12, 9, 21, 15, 15, 5, 15, 18, 23, 18, 5, 3,
+    9, 14, 1, 20, 19, 18, 19, 20, 18, 14, 15, 23, 14, 3, 19, 20,
+    19, 3, 14, 15, 5, 4, 19, 18, 3, 20, 16, 20, 6, 23, 19, 1,
+    16, 19, 8, 4, 7, 15, 0, 14, 19, 8, 3, 9, 20, 0, 20, 0,
+    5, 12, 14, 18, 1, 5, 1, 3, 14, 22, 15, 3, 13, 19, 12, 1,
+    3, 1, 9, 15, 15, 15, 1, 8, 20, 1, 16, 13, 14, 4, 12, 16,
+    5, 6, 15, 19, 20, 7, 12, 7, 18, 23, 0, 25, 23, 1, 19, 5,
+    9, 19, 1, 14, 12, 21, 3, 12, 8, 14, 4, 8, 15, 16, 20, 15,
+    5, 9, 23, 9, 15, 6, 16, 21, 9, 16, 9, 5, 26, 23, 9, 4,
+    1, 20, 5, 19, 7, 20, 13, 9, 5, 5, 9, 5, 21, 8, 3, 15,
+    5, 15, 9, 18, 23, 9, 9, 20, 2, 15, 1, 1, 5, 5, 14, 1,
+    16, 18, 20, 19, 6, 14, 21, 15, 4, 11, 14, 9, 3, 14, 1, 5,
+    9, 13, 20, 15, 8, 9, 12, 18, 5, 12, 1, 5, 9, 15, 7, 19,
+    20, 7, 12, 22, 9, 12, 13, 12, 4, 14, 20, 19, 13, 8, 7, 15,
+    12, 19, 15, 9, 8, 2, 8, 1, 1, 14, 1, 18, 14, 1, 14, 20,
+    1, 15, 25, 0, 8, 19, 20, 18, 12, 19, 2, 13, 21, 3, 18, 20,
+    1, 2, 3, 18, 1, 18, 9, 15, 25, 14, 12, 25, 1, 20, 4, 19,
+    18, 14, 1, 2, 3, 18, 14, 19, 12, 9, 1, 25, 19, 12, 20, 14,
+    18, 19, 15, 5, 19, 3, 19, 25, 7, 9, 1, 9, 21, 20, 5, 8,
+    18, 19, 20, 5, 20, 11, 7, 19, 1, 11, 14, 15, 21, 15, 1, 18,
+    14, 14, 5, 9, 15, 3, 13, 5, 12, 12, 19, 1, 9, 14, 20, 18,
+    2, 6, 2, 0, 5, 16, 20, 3, 14, 5, 5, 0, 9, 19, 15, 20,
+    18, 3, 23, 14, 14, 20, 16, 12, 11, 12, 19, 21, 13, 15, 21, 12,
+    20, 4, 2, 18, 9, 18, 9, 9, 20, 18, 8, 20, 5, 9, 15, 9,
+    9, 11, 9, 13, 1, 16, 13, 9, 0, 19, 5, 2, 1, 20, 9, 4,
+    25, 5, 20, 23, 7, 5, 0, 18, 9, 19, 5, 15, 5, 5, 19, 15,
+    5, 9, 14, 20, 15, 7, 12, 18, 19, 9, 19, 8, 13, 1, 12, 19,
+    20, 12, 15, 1, 19, 7, 8, 1, 3, 20, 7, 4, 7, 6, 16, 4,
+    18, 2, 2, 4, 5, 13, 18, 19, 9, 5, 9, 15, 18, 0, 1, 22,
+    20, 20, 21, 18, 9, 18, 9, 15, 18, 18, 19, 5, 15, 5, 2, 5,
+    5, 9, 13, 15, 22, 20, 5, 26, 9, 18, 19, 19, 1, 15, 3, 7,
+    16, 22, 18, 8, 19, 20, 8, 5, 1, 25, 18, 0, 18, 14, 1, 9,
+    5, 20, 18, 22, 12, 14, 9, 19, 19, 0, 8, 0, 9, 12, 1, 16,
+    5, 14, 3, 12, 18, 19, 23, 21, 5, 14, 11, 7, 9, 20, 20, 5,
+    18, 5, 3, 5, 19, 16, 1, 5, 16, 3, 14, 3, 9, 16, 18, 15,
+    18, 8, 20, 8, 18, 4, 18, 15, 14, 3, 18, 5, 18, 19, 9, 1,
+    5, 9, 18, 3, 18, 7, 7, 3, 9, 25, 5, 0, 9, 5, 26, 22,
+    20, 19, 9, 26, 1, 5, 5, 26, 1, 0, 9, 9, 25, 20, 13, 12,
+    13, 3, 5, 5, 12, 1, 8, 13, 4, 1, 21, 5, 1, 15, 5, 9,
+    19, 18, 18, 9, 25, 18, 12, 13, 3, 22, 4, 4, 15, 9, 25, 5,
+    5, 5, 9, 7, 1, 9, 1, 15, 1, 1, 15, 15, 15, 18, 19, 8,
+    0, 19, 21, 5, 12, 20, 13, 13, 7, 21, 21, 18, 1, 16, 5, 14,
+    5, 3, 19, 11, 21, 7, 4, 11, 6, 15, 0, 7, 20, 5, 20, 20,
+    12, 8, 9, 20, 16, 0, 19, 18, 19, 18, 19, 19, 9, 20, 12, 14,
+    15, 0, 19, 1, 9, 5, 19, 0, 19, 0, 19, 1, 0, 20, 7, 0,
+    18, 2, 15, 0, 19, 13, 5, 5, 5, 8, 18, 9, 12, 18, 18, 19,
+    20, 5, 9, 8, 18, 0, 19, 13, 20, 20, 6, 3, 1, 7, 0, 19,
+    5, 5, 9, 19, 1, 4, 5, 15, 1, 13, 9, 19, 21, 2, 7, 20,
+    7, 19, 15, 14, 19, 5, 19, 5, 1, 8, 9, 1, 22, 7, 14, 15,
+    9, 9, 5, 14, 19, 21, 15, 6, 19, 20, 1, 3, 1, 1, 20, 18,
+    1, 13, 1, 20, 20, 18, 3, 18, 19, 1, 21, 2, 8, 19, 9, 19,
+    20, 12, 7, 19, 1, 20, 9, 25, 19, 20, 9, 9, 4, 9, 20, 12,
+    1, 21, 15, 20, 15, 8, 18, 8, 4, 18, 13, 5, 0, 13, 20, 14,
+    12, 1, 8, 15, 2, 4, 14, 0, 1, 9, 18, 6, 7, 18, 14, 8,
+    14, 12, 12, 2, 9, 1, 9, 1, 3, 19, 1, 21, 8, 9, 4, 1,
+    12, 9, 15, 14, 9, 9, 5, 0, 20, 1, 5, 9, 9, 5, 18, 15,
+    18, 16, 19, 3, 9, 4, 0, 19, 9, 5, 15, 14, 1, 23, 14, 21,
+    14, 9, 5, 18, 25, 6, 22, 1, 14, 25, 15, 7, 21, 18, 19, 1,
+    18, 11, 13, 15, 9, 5, 3, 8, 9, 0, 3, 15, 18, 20, 4, 3,
+    13, 15, 20, 5, 1, 0, 19, 20, 8, 12, 1, 1, 1, 18, 0, 1,
+    14, 18, 18, 19, 9, 1, 26, 13, 14, 20, 20, 20, 14, 12, 9, 9,
+    1, 9, 5, 9, 15, 3, 3, 13, 18, 16, 1, 19, 25, 19, 18, 1,
+    0, 14, 19, 0, 21, 9, 5, 15, 7, 4, 5, 1, 11, 20, 1, 20,
+    1, 0, 9, 25, 16, 20, 18, 20, 19, 25, 18, 1, 25, 6, 5, 9,
+    3, 1, 19, 9, 9, 18, 13, 0, 20, 5, 9, 1, 18, 8, 3, 1,
+    4, 15, 12, 19, 21, 18, 1, 9, 2, 8, 1, 0, 12, 9, 18, 21,
+    20, 4, 12, 18, 14, 15, 1, 2, 19, 16, 5, 0, 9, 1, 5, 15,
+    3, 14, 9, 18, 15, 20, 5, 5, 9, 18, 9, 5, 13, 19, 16, 15,
+    18, 19, 5, 0, 13, 9, 9, 12, 8, 5, 18, 5, 0, 20, 12, 1,
+    12, 18, 14, 1, 19, 0, 20, 13, 1, 12, 19, 3, 1, 12, 12, 9,
+    19, 20, 0, 16, 0, 20, 3, 5, 5, 5, 19, 18, 0, 20, 18, 9,
+    5, 12, 13, 21, 15, 6, 15, 9, 14, 4, 8, 5, 20, 3, 20, 12,
+    4, 5, 4, 15, 5, 15, 4, 6, 4, 20, 21, 15, 5, 9, 5, 0,
+    7, 14, 19, 14, 15, 5, 12, 21, 7, 13, 21, 1, 7, 5, 7, 4,
+    20, 12, 21, 5, 8, 9, 25, 15, 5, 19, 1, 16, 5, 1, 5, 20,
+    5, 15, 5, 9, 15, 18, 6, 1, 9, 18, 14, 1, 12, 15, 21, 14,
+    0, 19, 18, 7, 4, 3, 5, 8, 13, 14, 14, 15, 0, 25, 1, 1,
+    0, 12, 2, 13, 18, 1, 9, 3, 12, 20, 19, 4, 9, 14, 3, 20,
+    20, 9, 16, 16, 5, 21, 19, 1, 9, 25, 13, 9, 20, 25, 5, 3,
+    5, 19, 12, 21, 7, 12, 20, 1, 25, 3, 21, 19, 4, 6, 7, 14,
+    23, 4, 0, 5, 0, 1, 15, 14, 20, 12, 16, 16, 5, 17, 25, 1,
+    5, 13, 20, 15, 18, 19, 18, 18, 18, 8, 3, 5, 1, 21, 13, 3,
+    14, 15, 9, 7, 3, 2, 0, 1, 1, 5, 9, 5, 19, 19, 20, 20,
+    1, 21, 9, 12, 0, 0, 16, 5, 5, 14, 15, 1, 3, 0, 16, 1,
+    7, 12, 15, 20, 5, 9, 1, 9, 18, 15, 8, 12, 5, 16, 26, 3,
+    20, 9, 9, 1, 26, 4, 20, 14, 14, 1, 0, 19, 15, 5, 6, 18,
+    13, 14, 13, 9, 3, 2, 14, 9, 5, 16, 0, 12, 12, 2, 18, 6,
+    9, 16, 0, 5, 9, 5, 19, 1, 3, 20, 12, 9, 0, 19, 9, 0,
+    21, 18, 14, 11, 8, 9, 5, 25, 0, 19, 13, 16, 23, 22, 3, 23,
+    20, 9, 12, 9, 20, 8, 5, 7, 19, 19, 5, 1, 7, 8, 5, 5,
+    8, 5, 1, 6, 18, 5, 9, 12, 12, 5, 7, 1, 9, 25, 0, 12,
+    8, 14, 13, 15, 9, 5, 9, 18, 12, 9, 19, 1, 14, 2, 0, 19,
+    1, 19, 0, 4, 4, 21, 9, 14, 4, 21, 5, 1, 1, 19, 5, 20,
+    1, 15, 0, 0, 18, 5, 18, 1, 5, 19, 5, 13, 25, 20, 24, 4,
+    0, 19, 15, 1, 9, 3, 14, 14, 1, 0, 9, 7, 9, 12, 0, 19,
+    0, 14, 0, 12, 18, 18, 0, 7, 8, 15, 0, 20, 1, 9, 20, 18,
+    19, 5, 0, 19, 7, 12, 5, 21, 0, 18, 8, 22, 9, 16, 18, 13,
+    19, 1, 18, 8, 19, 18, 1, 1, 15, 18, 15, 5, 8, 0, 4, 0,
+    25, 14, 4, 8, 15, 20, 15, 26, 26, 3, 5, 0, 9, 0, 19, 4,
+    9, 20, 0, 0, 9, 3, 15, 9, 5, 18, 9, 9, 14, 13, 14, 0,
+    4, 19, 19, 13, 15, 19, 5, 0, 9, 15, 9, 25, 12, 15, 9, 15,
+    19, 3, 24, 16, 4, 12, 0, 19, 14, 19, 5, 19, 3, 2, 18, 14,
+    20, 7, 13, 13, 20, 15, 3, 5, 0, 20, 0, 1, 1, 9, 15, 15,
+    2, 18, 14, 16, 1, 4, 20, 19, 5, 20, 1, 0, 0, 14, 12, 5,
+    0, 0, 19, 21, 18, 19, 18, 0, 0, 19, 5, 5, 3, 8, 15, 0,
+    0, 20, 0, 20, 0, 14, 5, 12, 0, 19, 7, 13, 14, 3, 18, 20,
+    0, 0, 18, 0, 0, 4, 9, 12, 14, 0, 5, 15, 1, 5, 0, 19,
+    15, 4, 15, 25, 1, 20, 20, 21, 14, 5, 0, 20, 5, 5, 20, 15,
+    9, 18, 19, 14, 0, 12, 1, 1, 0, 14, 9, 14, 12, 2, 1, 9,
+    5, 19, 3, 21, 8, 9, 9, 9, 14, 20, 9, 14, 0, 18, 19, 1,
+    12, 20, 5, 18, 11, 18, 26, 18, 1, 5, 12, 14, 7, 12, 5, 8,
+    13, 1, 2, 20, 9, 5, 2, 9, 20, 9, 9, 15, 20, 1, 19, 14,
+    7, 21, 0, 20, 20, 16, 1, 5, 5, 0, 18, 0, 19, 5, 19, 0,
+    3, 9, 1, 1, 5, 3, 5, 19, 5, 1, 12, 20, 13, 16, 0, 19,
+    16, 0, 5, 18, 6, 9, 9, 0, 19, 9, 5, 5, 0, 1, 14, 9,
+    14, 12, 0, 7, 20, 20, 4, 20, 0, 25, 19, 18, 5, 25, 1, 21,
+    12, 14, 0, 1, 18, 1, 3, 2, 14, 9, 7, 0, 4, 9, 20, 21,
+    4, 15, 3, 19, 5, 14, 5, 3, 3, 18, 9, 16, 13, 9, 3, 18,
+    5, 5, 0, 5, 2, 19, 3, 14, 1, 3, 19, 4, 11, 8, 4, 12,
+    5, 5, 3, 5, 0, 14, 5, 9, 9, 0, 21, 15, 9, 9, 2, 12,
+    15, 0, 1, 18, 1, 9, 20, 0, 5, 15, 11, 25, 18, 1, 20, 4,
+    0, 5, 15, 5, 1, 20, 19, 12, 1, 16, 3, 0, 19, 0, 16, 4,
+    7, 1, 15, 3, 1, 5, 18, 3, 5, 20, 19, 12, 5, 0, 20, 14,
+    9, 1, 5, 13, 9, 25, 18, 11, 0, 5, 9, 4, 0, 5, 8, 1,
+    0, 19, 11, 0, 5, 7, 0, 9, 14, 5, 0, 2, 5, 16, 5, 19,
+    0, 16, 0, 19, 5, 5, 16, 20, 9, 14, 12, 0, 9, 14, 11, 3,
+    0, 20, 20, 1, 9, 25, 0, 1, 20, 14, 21, 0, 15, 14, 5, 16,
+    1, 20, 7, 9, 12, 1, 5, 21, 20, 0, 4, 5, 9, 14, 8, 5,
+    9, 13, 7, 18, 2, 12, 25, 8, 0, 19, 13, 20, 14, 12, 15, 20,
+    3, 7, 6, 18, 18, 0, 20, 1, 5, 5, 16, 11, 15, 20, 0, 20,
+    22, 25, 3, 14, 1, 5, 19, 14, 15, 18, 8, 5, 25, 3, 9, 15,
+    9, 15, 12, 13, 15, 0, 19, 3, 9, 5, 8, 3, 12, 4, 0, 19,
+    0, 5, 9, 5, 20, 8, 14, 14, 20, 20, 9, 8, 7, 22, 12, 9,
+    15, 4, 20, 15, 0, 10, 5, 9, 19, 18, 9, 11, 15, 4, 19, 0,
+    0, 5, 19, 12, 19, 16, 0, 9, 0, 19, 1, 12, 14, 18, 20, 23,
+    0, 11, 19, 15, 0, 0, 19, 1, 9, 15, 20, 13, 5, 15, 16, 1,
+    12, 14, 9, 8, 18, 9, 14, 14, 0, 14, 5, 0, 14, 21, 11, 14,
+    8, 14, 12, 12, 8, 12, 16, 0, 19, 3, 18, 1, 6, 13, 20, 19,
+    0, 19, 5, 9, 19, 5, 16, 0, 19, 3, 0, 5, 5, 18, 20, 0,
+    25, 9, 9, 0, 15, 25, 14, 18, 14, 19, 5, 12, 15, 9, 12, 1,
+    0, 5, 1, 0, 5, 14, 20, 5, 5, 0, 12, 19, 20, 18, 0, 16,
+    19, 18, 0, 14, 5, 0, 13, 20, 0, 19, 15, 14, 21, 0, 19, 15,
+    5, 9, 20, 12, 5, 5, 15, 14, 16, 5, 9, 19, 0, 9, 9, 15,
+    18, 25, 15, 5, 14, 14, 18, 7, 9, 21, 1, 12, 5, 15, 18, 19,
+    21, 16, 4, 19, 15, 1, 16, 9, 19, 25, 9, 1, 0, 12, 11, 12,
+    19, 1, 1, 7, 3, 26, 12, 21, 20, 12, 20, 20, 0, 19, 14, 13,
+    1, 5, 9, 0, 5, 19, 2, 20, 20, 5, 5, 0, 18, 9, 21, 4,
+    0, 19, 0, 19, 2, 0, 5, 13, 0, 12, 15, 18, 20, 1, 7, 9,
+    9, 12, 8, 5, 8, 5, 19, 14, 3, 19, 14, 0, 25, 7, 18, 0,
+    18, 18, 9, 5, 15, 7, 16, 12, 0, 5, 20, 4, 3, 5, 25, 5,
+    12, 9, 20, 20, 8, 16, 16, 0, 16, 16, 15, 1, 9, 4, 0, 7,
+    19, 0, 19, 7, 5, 18, 4, 19, 0, 0, 1, 5, 15, 5, 1, 5,
+    18, 12, 19, 15, 14, 9, 9, 3, 18, 20, 3, 14, 14, 5, 9, 1,
+    19, 15, 18, 19, 18, 5, 5, 0, 19, 2, 5, 5, 18, 15, 3, 5,
+    0, 12, 1, 7, 1, 13, 14, 20, 12, 18, 22, 9, 25, 9, 1, 3,
+    16, 5, 15, 0, 18, 5, 5, 0, 20, 7, 7, 20, 19, 12, 14, 13,
+    20, 23, 0, 19, 16, 13, 15, 9, 5, 18, 18, 19, 1, 18, 1, 12,
+    0, 19, 0, 5, 15, 0, 21, 16, 1, 8, 7, 4, 14, 12, 5, 7,
+    21, 15, 5, 25, 15, 9, 0, 5, 23, 0, 20, 4, 0, 19, 25, 0,
+    0, 0, 8, 9, 9, 7, 9, 1, 5, 4, 1, 5, 0, 19, 20, 14,
+    5, 1, 3, 1, 14, 3, 21, 19, 21, 4, 0, 0, 5, 7, 0, 18,
+    19, 22, 0, 5, 4, 21, 14, 5, 21, 19, 18, 9, 3, 19, 1, 14,
+    25, 9, 9, 0, 0, 0, 0, 1, 19, 16, 1, 19, 22, 13, 5, 0,
+    5, 12, 3, 18, 5, 9, 5, 0, 5, 1, 5, 9, 5, 1, 0, 7,
+    20, 14, 0, 0, 1, 12, 0, 19, 3, 20, 5, 5, 5, 1, 9, 14,
+    12, 18, 1, 5, 19, 0, 15, 19, 14, 21, 5, 5, 4, 15, 20, 5,
+    0, 3, 19, 0, 19, 18, 16, 7, 5, 14, 0, 18, 1, 0, 5, 0,
+    0, 13, 1, 9, 13, 14, 0, 0, 20, 18, 5, 0, 9, 0, 0, 11,
+    0, 0, 4, 0, 19, 12, 5, 9, 25, 14, 4, 14, 12, 0, 16, 0,
+    19, 23, 0, 12, 15, 5, 19, 5, 18, 5, 20, 18, 5, 9, 1, 0,
+    0, 5, 0, 19, 20, 0, 4, 21, 20, 12, 9, 12, 2, 19, 20, 19,
+    0, 5, 20, 20, 20, 15, 15, 19, 4, 0, 13, 20, 0, 19, 5, 6,
+    5, 3, 18, 1, 0, 19, 13, 1, 5, 21, 16, 0, 19, 15, 4, 18,
+    9, 25, 0, 19, 0, 19, 16, 20, 12, 9, 22, 0, 12, 17, 9, 15,
+    22, 3, 13, 0, 9, 19, 0, 0, 4, 8, 20, 5, 14, 1, 12, 18,
+    0, 9, 25, 0, 19, 20, 8, 3, 0, 0, 18, 19, 19, 20, 13, 19,
+    21, 0, 5, 8, 0, 9, 25, 14, 9, 0, 1, 3, 0, 14, 0, 4,
+    0, 20, 0, 1, 0, 5, 0, 15, 5, 9, 9, 19, 0, 0, 9, 0,
+    19, 0, 0, 13, 5, 7, 14, 20, 18, 15, 12, 7, 1, 8, 5, 5,
+    9, 25, 19, 0, 19, 14, 0, 0, 18, 0, 18, 0, 0, 0, 19, 3,
+    8, 1, 19, 8, 9, 23, 19, 4, 0, 5, 12, 14, 12, 5, 0, 12,
+    9, 5, 18, 0, 5, 9, 0, 19, 5, 0, 19, 9, 18, 14, 5, 19,
+    16, 0, 19, 9, 9, 12, 0, 15, 14, 13, 1, 18, 0, 0, 19, 0,
+    16, 19, 20, 9, 9, 5, 15, 18, 19, 9, 20, 1, 16, 8, 18, 0,
+    1, 0, 9, 9, 20, 4, 5, 2, 12, 19, 21, 0, 18, 25, 3, 1,
+    23, 25, 1, 2, 2, 20, 1, 3, 0, 9, 25, 9, 0, 16, 19, 22,
+    5, 14, 0, 5, 19, 0, 19, 0, 18, 12, 18, 5, 19, 20, 5, 0,
+    0, 18, 1, 5, 5, 0, 19, 5, 7, 5, 5, 9, 26, 25, 16, 26,
+    0, 4, 25, 1, 3, 14, 0, 24, 9, 13, 5, 8, 16, 0, 14, 18,
+    19, 9, 0, 0, 20, 1, 0, 19, 19, 3, 19, 20, 0, 19, 21, 0,
+    9, 19, 9, 12, 5, 3, 5, 13, 20, 13, 5, 9, 5, 9, 14, 5,
+    8, 1, 20, 21, 14, 5, 16, 19, 16, 15, 9, 12, 1, 0, 15, 0,
+    0, 19, 7, 18, 0, 19, 0, 4, 13, 7, 15, 0, 19, 0, 5, 9,
+    14, 6, 5, 21, 0, 0, 0, 5, 19, 0, 5, 3, 18, 20, 5, 5,
+    19, 0, 0, 3, 0, 5, 5, 0, 20, 8, 0, 19, 1, 13, 5, 1,
+    5, 4, 18, 15, 8, 18, 11, 16, 7, 20, 0, 4, 5, 18, 0, 0,
+    4, 0, 9, 25, 5, 15, 3, 0, 14, 15, 20, 1, 18, 0, 19, 0,
+    12, 0, 0, 0, 3, 9, 5, 0, 19, 20, 18, 8, 12, 9, 5, 3,
+    25, 9, 20, 20, 9, 5, 19, 0, 19, 13, 9, 0, 20, 15, 1, 16,
+    18, 9, 8, 0, 0, 9, 16, 19, 9, 5, 0, 0, 0, 19, 14, 0,
+    0, 16, 0, 5, 0, 9, 0, 15, 25, 25, 12, 19, 26, 21, 0, 0,
+    9, 15, 25, 5, 1, 20, 0, 5, 21, 16, 0, 12, 0, 19, 2, 4,
+    7, 0, 19, 19, 18, 25, 0, 20, 9, 5, 19, 1, 3, 19, 1, 9,
+    0, 20, 20, 15, 0, 18, 18, 14, 20, 1, 0, 19, 18, 18, 7, 1,
+    0, 19, 1, 0, 5, 6, 14, 18, 1, 15, 13, 18, 12, 3, 7, 1,
+    5, 0, 3, 18, 20, 5, 4, 12, 0, 20, 9, 15, 9, 9, 15, 20,
+    15, 1, 22, 5, 0, 19, 16, 25, 12, 12, 0, 18, 20, 5, 9, 1,
+    5, 12, 0, 9, 5, 5, 9, 0, 0, 5, 14, 0, 4, 19, 15, 4,
+    0, 12, 9, 0, 20, 0, 4, 15, 1, 19, 5, 0, 0, 12, 18, 1,
+    5, 12, 14, 9, 5, 21, 9, 6, 14, 16, 18, 18, 9, 1, 3, 7,
+    8, 3, 9, 0, 0, 9, 5, 0, 14, 3, 20, 0, 19, 12, 12, 18,
+    0, 19, 5, 8, 4, 0, 0, 5, 14, 5, 9, 3, 5, 0, 19, 5,
+    1, 5, 4, 3, 14, 0, 19, 14, 0, 0, 0, 18, 9, 0, 1, 19,
+    0, 14, 18, 13, 12, 19, 1, 9, 9, 8, 14, 7, 3, 12, 8, 1,
+    9, 8, 5, 7, 13, 5, 19, 20, 12, 0, 20, 20, 18, 19, 0, 5,
+    19, 0, 9, 0, 19, 9, 19, 1, 14, 12, 20, 5, 15, 18, 0, 0,
+    19, 5, 5, 0, 14, 14, 8, 8, 20, 20, 9, 5, 19, 25, 8, 20,
+    8, 0, 1, 1, 16, 5, 19, 0, 8, 5, 21, 22, 19, 5, 19, 20,
+    2, 12, 9, 14, 1, 0, 19, 21, 14, 8, 14, 5, 12, 12, 20, 12,
+    13, 21, 14, 22, 19, 0, 21, 14, 9, 5, 5, 5, 0, 0, 20, 6,
+    14, 5, 1, 9, 18, 5, 3, 1, 0, 5, 0, 19, 1, 6, 8, 6,
+    0, 9, 14, 5, 14, 0, 12, 1, 0, 9, 0, 5, 8, 5, 18, 5,
+    0, 7, 20, 0, 14, 1, 3, 14, 0, 0, 14, 19, 12, 0, 9, 25,
+    18, 0, 1, 15, 19, 1, 15, 21, 0, 21, 19, 19, 19, 19, 12, 0,
+    19, 3, 1, 7, 0, 0, 19, 20, 12, 5, 0, 5, 0, 19, 0, 19,
+    18, 18, 20, 3, 15, 5, 5, 2, 0, 4, 9, 14, 9, 0, 19, 18,
+    19, 9, 9, 3, 18, 9, 25, 0, 11, 25, 8, 0, 0, 4, 0, 0,
+    19, 16, 14, 1, 12, 14, 19, 18, 19, 0, 19, 0, 19, 18, 3, 0,
+    20, 0, 9, 0, 5, 0, 0, 15, 0, 0, 19, 8, 0, 5, 0, 14,
+    19, 5, 0, 19, 1, 18, 8, 9, 0, 19, 12, 20, 18, 0, 9, 0,
+    19, 13, 23, 5, 12, 5, 12, 20, 25, 0, 19, 5, 9, 5, 1, 14,
+    14, 0, 5, 16, 0, 0, 0, 20, 0, 19, 8, 0, 13, 0, 0, 2,
+    0, 4, 19, 19, 15, 0, 22, 0, 1, 5, 0, 0, 0, 0, 19, 5,
+    9, 5, 15, 5, 5, 21, 19, 14, 5, 0, 9, 19, 5, 15, 0, 0,
+    19, 20, 1, 5, 9, 18, 5, 3, 11, 0, 5, 0, 0, 0, 19, 5,
+    0, 19, 0, 0, 0, 19, 0, 19, 19, 5, 3, 15, 5, 0, 5, 14,
+    14, 0, 1, 19, 5, 0, 9, 14, 0, 18, 0, 14, 14, 0, 6, 0,
+    0, 19, 0, 0, 0, 19, 2, 16, 5, 25, 19, 0, 20, 18, 18, 19,
+    5, 0, 0, 0, 1, 0, 0, 19, 0, 0, 19, 9, 12, 13, 1, 16,
+    0, 0, 0, 0, 5, 9, 4, 0, 19, 25, 5, 0, 5, 0, 19, 19,
+    0, 0, 19, 0, 1, 0, 19, 0, 19, 19, 5, 5, 5, 14, 1, 15,
+    4, 0, 1, 13, 0, 0, 8, 9, 9, 3, 19, 20, 20, 13, 20, 15,
+    9, 13, 8, 19, 1, 3, 20, 3, 9, 21, 0, 19, 12, 25, 9, 3,
+    0, 19, 0, 9, 3, 5, 0, 12, 12, 12, 18, 12, 0, 5, 0, 0,
+    20, 0, 0, 0, 0, 0, 19, 0, 13, 0, 5, 0, 18, 0, 0, 18,
+    0, 3, 0, 19, 14, 0, 0, 19, 8, 19, 18, 14, 0, 9, 0, 8,
+    5, 0, 0, 0, 11, 15, 0, 19, 0, 18, 20, 20, 0, 4, 5, 3,
+    9, 0, 12, 0, 0, 0, 13, 5, 0, 1, 3, 0, 12, 5, 0, 19,
+    8, 20, 0, 0, 15, 0, 4, 15, 0, 19, 20, 15, 18, 5, 14, 0,
+    3, 15, 18, 8, 0, 5, 19, 0, 9, 0, 21, 0, 0, 0, 0, 5,
+    5, 5, 14, 0, 0, 4, 14, 5, 9, 19, 19, 19, 0, 20, 1, 0,
+    5, 0, 19, 0, 0, 0, 18, 0, 0, 1, 0, 14, 5, 14, 18, 19,
+    5, 16, 3, 0, 13, 5, 8, 4, 1, 5, 18, 25, 0, 5, 19, 0,
+    14, 5, 5, 0, 19, 19, 9, 20, 15, 0, 25, 0, 4, 0, 19, 0,
+    8, 15, 5, 0, 19, 20, 0, 12, 26, 1, 0, 3, 19, 0, 0, 0,
+    0, 8, 14, 14, 8, 15, 19, 9, 3, 8, 5, 3, 0, 0, 7, 5,
+    0, 19, 21, 0, 12, 5, 20, 1, 19, 3, 21, 0, 14, 20, 9, 0,
+    19, 19, 20, 7, 0, 12, 0, 0, 0, 19, 9, 0, 9, 14, 4, 5,
+    12, 5, 0, 2, 22, 5, 9, 0, 21, 25, 0, 19, 7, 15, 14, 0,
+    0, 19, 0, 19, 21, 12, 0, 12, 19, 6, 9, 3, 16, 21, 0, 19,
+    4, 9, 5, 0, 19, 1, 0, 19, 5, 5, 7, 0, 19, 5, 0, 22,
+    14, 3, 4, 20, 9, 19, 14, 9, 14, 8, 8, 0, 5, 5, 0, 5,
+    0, 4, 13, 19, 20, 14, 0, 19, 1, 15, 0, 0, 15, 14, 3, 0,
+    0, 14, 0, 5, 15, 5, 0, 19, 14, 0, 14, 18, 5, 11, 14, 14,
+    1, 0, 12, 0, 19, 20, 3, 20, 7, 6, 5, 0, 12, 3, 8, 5,
+    5, 8, 20, 1, 0, 19, 9, 20, 8, 0, 5, 5, 0, 0, 13, 1,
+    1, 0, 7, 18, 14, 8, 14, 0, 0, 3, 18, 5, 11, 7, 0, 0,
+    19, 0, 6, 12, 0, 0, 19, 1, 5, 25, 20, 18, 20, 5, 0, 5,
+    0, 12, 19, 25, 1, 16, 3, 5, 19, 5, 0, 19, 18, 5, 0, 4,
+    0, 0, 5, 19, 18, 0, 22, 0, 19, 0, 14, 14, 25, 9, 19, 21,
+    15, 0, 0, 19, 0, 19, 0, 5, 5, 9, 9, 12, 0, 0, 12, 20,
+    8, 0, 19, 14, 0, 19, 18, 11, 9, 18, 19, 5, 19, 14, 1, 9,
+    12, 0, 19, 5, 0, 13, 0, 18, 4, 9, 0, 4, 25, 9, 25, 9,
+    5, 5, 14, 7, 0, 19, 19, 20, 14, 18, 18, 0, 19, 0, 19, 20,
+    0, 0, 14, 18, 0, 4, 5, 4, 18, 0, 4, 20, 1, 20, 14, 4,
+    0, 19, 4, 25, 18, 6, 0, 25, 0, 19, 5, 9, 0, 8, 0, 19,
+    5, 12, 8, 0, 5, 13, 20, 0, 3, 19, 0, 9, 25, 20, 18, 0,
+    18, 14, 20, 19, 0, 0, 0, 0, 0, 0, 1, 14, 15, 0, 0, 19,
+    0, 0, 0, 8, 0, 0, 19, 0, 19, 9, 0, 21, 18, 0, 19, 12,
+    0, 1, 0, 5, 0, 9, 19, 14, 19, 8, 0, 19, 5, 0, 9, 0,
+    5, 0, 0, 8, 20, 20, 0, 5, 0, 25, 0, 0, 0, 0, 19, 1,
+    0, 20, 19, 18, 0, 5, 9, 18, 0, 22, 0, 0, 16, 0, 1, 3,
+    0, 0, 9, 0, 19, 15, 0, 0, 9, 18, 9, 0, 5, 0, 19, 0,
+    0, 4, 2, 0, 4, 19, 2, 0, 19, 9, 14, 12, 0, 0, 0, 5,
+    9, 0, 19, 12, 0, 0, 0, 5, 14, 1, 13, 16, 19, 0, 0, 4,
+    19, 15, 0, 14, 0, 0, 1, 13, 0, 1, 19, 0, 19, 1, 0, 20,
+    14, 0, 12, 2, 0, 4, 19, 22, 0, 18, 5, 9, 0, 19, 0, 0,
+    0, 0, 0, 0, 5, 0, 19, 8, 18, 19, 21, 5, 3, 20, 12, 0,
+    0, 15, 0, 25, 1, 7, 20, 0, 0, 15, 9, 25, 0, 0, 9, 0,
+    0, 19, 0, 20, 19, 12, 0, 0, 3, 0, 0, 6, 20, 0, 19, 1,
+    0, 0, 0, 3, 14, 0, 20, 0, 14, 0, 0, 0, 0, 0, 13, 0,
+    0, 3, 7, 9, 12, 21, 9, 19, 3, 0, 8, 8, 8, 1, 9, 14,
+    3, 21, 5, 9, 25, 0, 19, 20, 5, 25, 11, 15, 12, 0, 5, 0,
+    13, 20, 0, 16, 20, 5, 0, 5, 25, 5, 9, 0, 19, 0, 0, 0,
+    0, 0, 19, 0, 19, 5, 9, 0, 5, 0, 20, 0, 0, 7, 1, 5,
+    19, 0, 0, 13, 13, 0, 5, 0, 19, 15, 20, 9, 5, 0, 0, 19,
+    0, 19, 7, 1, 9, 0, 0, 15, 1, 14, 0, 14, 0, 5, 1, 13,
+    16, 0, 19, 9, 20, 15, 0, 5, 19, 18, 9, 19, 19, 18, 0, 20,
+    7, 0, 7, 0, 19, 3, 0, 0, 0, 5, 2, 14, 0, 0, 19, 14,
+    0, 20, 3, 9, 19, 1, 8, 15, 0, 12, 18, 18, 15, 14, 0, 19,
+    0, 19, 0, 19, 20, 3, 20, 9, 20, 0, 0, 0, 19, 15, 20, 0,
+    0, 0, 25, 20, 18, 13, 9, 1, 1, 5, 18, 0, 19, 1, 0, 9,
+    9, 16, 20, 19, 0, 19, 20, 0, 0, 18, 20, 19, 0, 12, 14, 0,
+    19, 20, 0, 0, 19, 5, 5, 3, 0, 0, 0, 19, 12, 5, 15, 1,
+    14, 20, 0, 19, 0, 0, 12, 5, 0, 19, 3, 19, 0, 0, 0, 0,
+    4, 0, 0, 1, 0, 0, 0, 5, 20, 5, 8, 16, 0, 0, 19, 3,
+    0, 0, 14, 0, 0, 18, 9, 0, 0, 19, 1, 15, 1, 21, 8, 15,
+    0, 7, 1, 3, 20, 14, 25, 0, 18, 0, 4, 19, 0, 5, 0, 9,
+    25, 3, 0, 18, 14, 14, 20, 5, 0, 19, 0, 14, 4, 0, 0, 5,
+    0, 19, 0, 19, 0, 19, 0, 0, 0, 12, 0, 0, 1, 5, 9, 0,
+    5, 14, 4, 8, 5, 18, 18, 9, 26, 20, 0, 20, 0, 5, 0, 4,
+    9, 14, 12, 0, 19, 0, 7, 0, 19, 5, 9, 0, 19, 0, 0, 19,
+    0, 0, 20, 0, 15, 14, 14, 0, 0, 5, 0, 5, 18, 0, 25, 0,
+    0, 19, 8, 0, 0, 19, 18, 0, 0, 0, 0, 14, 9, 0, 19, 1,
+    20, 3, 1, 0, 3, 8, 19, 14, 0, 0, 0, 18, 3, 3, 25, 1,
+    0, 0, 20, 4, 0, 0, 9, 3, 1, 0, 18, 0, 3, 12, 20, 5,
+    0, 19, 9, 0, 0, 19, 17, 0, 0, 5, 0, 1, 0, 9, 7, 5,
+    0, 0, 0, 12, 0, 19, 0, 0, 0, 5, 9, 0, 0, 19, 0, 0,
+    19, 0, 0, 0, 0, 6, 0, 7, 0, 19, 0, 0, 19, 0, 0, 20,
+    4, 0, 0, 19, 20, 0, 0, 12, 5, 0, 19, 0, 9, 0, 1, 13,
+    5, 0, 9, 16, 0, 0, 9, 0, 12, 0, 0, 19, 0, 9, 0, 0,
+    3, 19, 15, 0, 5, 14, 18, 14, 9, 7, 0, 5, 9, 0, 19, 16,
+    0, 9, 25, 9, 9, 0, 0, 0, 12, 25, 0, 25, 0, 19, 3, 19,
+    0, 9, 9, 25, 14, 0, 22, 0, 14, 19, 0, 19, 20, 0, 0, 0,
+    9, 12, 0, 0, 12, 0, 19, 20, 5, 4, 14, 0, 5, 19, 0, 19,
+    11, 0, 8, 0, 0, 0, 14, 0, 22, 0, 12, 0, 0, 14, 8, 0,
+    19, 25, 12, 0, 0, 5, 0, 0, 4, 14, 0, 19, 0, 1, 5, 0,
+    18, 0, 5, 0, 12, 14, 0, 18, 0, 0, 14, 5, 0, 14, 0, 0,
+    0, 0, 0, 20, 0, 0, 14, 11, 0, 0, 19, 0, 9, 0, 19, 25,
+    20, 0, 19, 3, 19, 0, 0, 19, 0, 0, 0, 12, 3, 0, 19, 9,
+    19, 18, 3, 0, 9, 25, 9, 19, 0, 0, 14, 1, 0, 1, 21, 12,
+    9, 0, 19, 0, 0, 0, 3, 0, 0, 0, 4, 19, 14, 0, 19, 0,
+    0, 14, 4, 0, 9, 25, 0, 19, 18, 0, 18, 20, 1, 19, 0, 0,
+    5, 12, 20, 19, 13, 9, 0, 19, 14, 9, 25, 18, 0, 19, 21, 14,
+    4, 0, 0, 19, 1, 21, 0, 12, 0, 19, 9, 0, 19, 0, 0, 0,
+    4, 12, 0, 0, 5, 9, 25, 1, 0, 14, 9, 13, 25, 8, 9, 0,
+    4, 0, 0, 0, 0, 19, 5, 0, 1, 9, 20, 12, 15, 12, 15, 0,
+    0, 19, 14, 20, 0, 25, 0, 12, 14, 1, 9, 0, 19, 3, 0, 0,
+    0, 19, 0, 0, 9, 5, 0, 9, 0, 0, 0, 0, 0, 5, 0, 18,
+    14, 7, 5, 9, 0, 5, 0, 12, 0, 0, 0, 9, 7, 18, 5, 19,
+    5, 0, 19, 0, 0, 0, 1, 3, 0, 12, 18, 12, 1, 0, 14, 21,
+    12, 5, 9, 1, 0, 0, 0, 0, 14, 5, 0, 5, 0, 0, 0, 0,
+    1, 5, 19, 0, 0, 0, 0, 19, 0, 0, 0, 1, 12, 18, 14, 14,
+    9, 0, 18, 5, 0, 0, 0, 12, 0, 0, 19, 5, 20, 0, 15, 9,
+    9, 0, 0, 0, 0, 4, 14, 0, 0, 0, 14, 0, 0, 18, 18, 0,
+    0, 5, 9, 0, 0, 20, 15, 0, 20, 0, 19, 5, 0, 0, 0, 0,
+    0, 0, 19, 0, 19, 19, 0, 13, 9, 1, 0, 1, 19, 0, 19, 9,
+    25, 0, 19, 5, 0, 0, 14, 0, 21, 18, 20, 14, 0, 14, 9, 0,
+    18, 14, 0, 0, 20, 0, 0, 0, 0, 5, 20, 0, 19, 25, 0, 0,
+    3, 12, 0, 19, 22, 8, 15, 0, 0, 16, 0, 0, 19, 0, 0, 20,
+    7, 15, 22, 0, 18, 14, 0, 0, 3, 19, 19, 1, 3, 0, 0, 0,
+    0, 0, 1, 13, 12, 5, 0, 5, 5, 0, 5, 0, 25, 12, 5, 5,
+    20, 0, 19, 0, 0, 7, 0, 0, 0, 9, 0, 0, 19, 5, 0, 0,
+    19, 1, 0, 0, 5, 0, 0, 7, 0, 14, 19, 20, 0, 9, 19, 0,
+    25, 0, 25, 0, 19, 19, 0, 0, 0, 0, 17, 0, 0, 5, 9, 0,
+    0, 13, 0, 0, 9, 0, 20, 0, 0, 19, 0, 5, 0, 3, 0, 0,
+    20, 12, 18, 9, 3, 0, 0, 19, 0, 0, 7, 0, 0, 0, 3, 0,
+    0, 0, 6, 19, 14, 0, 0, 19, 0, 12, 25, 9, 9, 21, 0, 0,
+    19, 3, 0, 9, 13, 18, 0, 0, 0, 0, 13, 25, 0, 3, 0, 0,
+    5, 25, 0, 3, 0, 14, 0, 3, 16, 0, 15, 14, 9, 0, 0, 0,
+    3, 0, 19, 15, 12, 2, 12, 13, 9, 9, 0, 5, 5, 0, 3, 0,
+    8, 0, 3, 0, 15, 9, 0, 19, 0, 19, 0, 18, 14, 0, 25, 14,
+    5, 5, 0, 12, 0, 18, 0, 12, 0, 5, 13, 0, 12, 1, 12, 0,
+    0, 19, 1, 14, 20, 19, 0, 20, 4, 0, 19, 0, 0, 0, 7, 14,
+    3, 5, 18, 4, 0, 0, 9, 12, 3, 19, 1, 0, 7, 0, 19, 0,
+    0, 19, 0, 3, 9, 14, 9, 0, 0, 0, 0, 0, 13, 3, 16, 12,
+    5, 0, 5, 0, 0, 0, 19, 5, 5, 0, 5, 5, 0, 3, 0, 7,
+    12, 0, 0, 0, 0, 0, 12, 0, 5, 9, 14, 0, 19, 9, 5, 0,
+    14, 5, 0, 7, 1, 3, 20, 12, 19, 12, 0, 12, 19, 0, 19, 0,
+    0, 0, 9, 0, 0, 0, 19, 0, 0, 1, 0, 18, 0, 14, 0, 0,
+    9, 15, 9, 9, 1, 0, 0, 0, 0, 20, 21, 0, 3, 0, 20, 25,
+    0, 19, 0, 1, 15, 0, 5, 14, 0, 0, 0, 0, 19, 0, 0, 0,
+    19, 0, 25, 0, 19, 14, 13, 0, 0, 19, 19, 0, 19, 5, 0, 0,
+    0, 0, 0, 0, 3, 0, 1, 21, 5, 14, 0, 0, 7, 21, 5, 21,
+    0, 19, 15, 9, 0, 0, 5, 0, 14, 3, 0, 0, 0, 7, 0, 0,
+    19, 0, 14, 25, 0, 0, 19, 14, 1, 0, 18, 1, 0, 12, 0, 0,
+    19, 0, 9, 0, 0, 0, 9, 0, 14, 0, 19, 0, 3, 15, 1, 13,
+    14, 0, 0, 0, 0, 1, 0, 19, 15, 15, 0, 21, 0, 0, 19, 19,
+    0, 0, 0, 4, 18, 8, 0, 9, 25, 0, 19, 3, 1, 0, 19, 18,
+    0, 0, 0, 12, 8, 25, 0, 0, 12, 5, 0, 0, 20, 0, 0, 0,
+    19, 5, 3, 1, 19, 3, 12, 9, 1, 0, 25, 0, 0, 12, 18, 0,
+    19, 1, 0, 0, 0, 0, 5, 0, 0, 5, 0, 0, 5, 3, 20, 0,
+    7, 25, 5, 14, 5, 15, 14, 14, 0, 0, 8, 0, 0, 20, 0, 0,
+    3, 20, 12, 25, 18, 0, 0, 15, 7, 0, 0, 0, 7, 12, 0, 19,
+    0, 12, 0, 14, 14, 18, 0, 0, 0, 20, 11, 3, 0, 0, 0, 18,
+    0, 0, 0, 5, 12, 25, 0, 25, 0, 0, 1, 3, 0, 0, 0, 20,
+    22, 0, 12, 25, 0, 18, 0, 0, 19, 0, 20, 0, 0, 0, 14, 26,
+    14, 12, 0, 0, 21, 9, 5, 0, 0, 0, 0, 14, 0, 9, 0, 0,
+    0, 0, 19, 9, 1, 5, 5, 8, 25, 0, 5, 0, 0, 12, 15, 21,
+    5, 25, 0, 25, 0, 0, 5, 5, 5, 5, 14, 1, 0, 19, 0, 3,
+    0, 21, 13, 0, 9, 0, 0, 0, 0, 21, 20, 18, 0, 0, 0, 14,
+    0, 0, 7, 12, 0, 1, 13, 0, 20, 19, 0, 0, 19, 5, 0, 0,
+    12, 0, 19, 20, 0, 0, 0, 20, 9, 8, 3, 5, 0, 15, 18, 9,
+    5, 0,
+};
+
+static const uint16_t hyph_enNodeFirstChild[15795] = {
+    1, 28, 54, 79, 100, 116, 139, 164, 181, 199, 217, 243, 247, 262, 285, 303,
+    328, 352, 371, 372, 395, 418, 440, 462, 468, 482, 492, 509, 518, 533, 540, 549,
+    556, 573, 580, 587, 593, 602, 606, 611, 616, 622, 627, 641, 652, 653, 660, 676,
+    684, 689, 694, 700, 702, 704, 705, 713, 720, 728, 729, 730, 738, 742, 747, 747,
+    748, 756, 761, 772, 772, 780, 781, 794, 805, 815, 822, 826, 830, 831, 834, 836,
+    845, 847, 847, 858, 858, 858, 866, 866, 866, 871, 871, 872, 882, 882, 884, 885,
+    888, 896, 896, 896, 898, 910, 913, 923, 929, 942, 943, 947, 947, 960, 960, 965,
+    965, 970, 980, 980, 981, 992, 992, 992, 992, 1009, 1009, 1013, 1013, 1028, 1028, 1028,
+    1033, 1033, 1033, 1048, 1048, 1054, 1057, 1058, 1066, 1066, 1066, 1068, 1079, 1082, 1091, 1098,
+    1108, 1113, 1120, 1121, 1128, 1129, 1131, 1140, 1149, 1161, 1171, 1180, 1181, 1194, 1207, 1217,
+    1222, 1227, 1231, 1232, 1235, 1244, 1244, 1244, 1254, 1258, 1258, 1265, 1269, 1269, 1269, 1272,
+    1272, 1276, 1276, 1278, 1285, 1285, 1293, 1293, 1293, 1303, 1306, 1309, 1322, 1326, 1327, 1331,
+    1341, 1341, 1346, 1347, 1348, 1354, 1354, 1356, 1368, 1368, 1380, 1380, 1380, 1392, 1392, 1394,
+    1395, 1395, 1405, 1405, 1407, 1408, 1411, 1416, 1417, 1419, 1425, 1431, 1441, 1449, 1456, 1462,
+    1470, 1470, 1470, 1470, 1470, 1480, 1486, 1501, 1511, 1516, 1517, 1525, 1540, 1549, 1549, 1552,
+    1552, 1553, 1553, 1556, 1558, 1561, 1562, 1563, 1568, 1568, 1576, 1576, 1576, 1583, 1583, 1585,
+    1585, 1587, 1590, 1591, 1594, 1594, 1594, 1604, 1605, 1607, 1610, 1621, 1622, 1625, 1625, 1641,
+    1641, 1642, 1646, 1649, 1649, 1663, 1668, 1668, 1671, 1677, 1688, 1689, 1689, 1694, 1705, 1707,
+    1707, 1718, 1718, 1718, 1728, 1728, 1728, 1729, 1732, 1745, 1752, 1752, 1754, 1754, 1759, 1759,
+    1771, 1771, 1778, 1783, 1800, 1800, 1809, 1811, 1823, 1823, 1826, 1826, 1827, 1829, 1845, 1847,
+    1847, 1848, 1857, 1863, 1872, 1872, 1872, 1874, 1875, 1880, 1885, 1893, 1897, 1902, 1903, 1911,
+    1912, 1920, 1920, 1922, 1934, 1941, 1953, 1958, 1966, 1966, 1979, 1986, 1991, 1997, 2000, 2005,
+    2006, 2017, 2017, 2017, 2028, 2028, 2028, 2038, 2047, 2047, 2051, 2051, 2051, 2063, 2066, 2070,
+    2073, 2079, 2088, 2088, 2090, 2104, 2107, 2111, 2113, 2131, 2133, 2138, 2140, 2155, 2155, 2157,
+    2160, 2164, 2169, 2184, 2188, 2192, 2200, 2205, 2213, 2216, 2216, 2219, 2229, 2229, 2236, 2236,
+    2252, 2252, 2252, 2257, 2270, 2272, 2275, 2279, 2279, 2287, 2293, 2294, 2294, 2304, 2314, 2322,
+    2322, 2323, 2327, 2344, 2344, 2345, 2345, 2362, 2362, 2362, 2369, 2386, 2389, 2390, 2390, 2402,
+    2402, 2407, 2410, 2413, 2424, 2424, 2427, 2430, 2431, 2437, 2440, 2446, 2452, 2454, 2456, 2458,
+    2463, 2463, 2463, 2476, 2481, 2489, 2492, 2497, 2511, 2520, 2526, 2527, 2527, 2528, 2529, 2539,
+    2547, 2560, 2567, 2567, 2567, 2577, 2577, 2584, 2585, 2591, 2591, 2593, 2594, 2596, 2596, 2598,
+    2602, 2602, 2602, 2607, 2607, 2610, 2612, 2616, 2617, 2619, 2620, 2621, 2621, 2624, 2624, 2627,
+    2627, 2631, 2632, 2632, 2632, 2636, 2639, 2644, 2649, 2654, 2658, 2665, 2667, 2667, 2669, 2669,
+    2673, 2675, 2675, 2675, 2677, 2678, 2679, 2684, 2686, 2687, 2688, 2689, 2693, 2695, 2703, 2706,
+    2710, 2715, 2720, 2724, 2726, 2727, 2733, 2741, 2747, 2751, 2756, 2759, 2766, 2774, 2775, 2780,
+    2783, 2799, 2802, 2805, 2807, 2808, 2811, 2819, 2825, 2829, 2832, 2836, 2838, 2840, 2840, 2841,
+    2842, 2842, 2844, 2847, 2852, 2854, 2855, 2857, 2858, 2859, 2861, 2863, 2866, 2867, 2869, 2872,
+    2874, 2878, 2879, 2882, 2883, 2887, 2890, 2891, 2894, 2895, 2897, 2902, 2909, 2917, 2920, 2929,
+    2930, 2932, 2933, 2937, 2938, 2939, 2942, 2951, 2952, 2954, 2955, 2959, 2960, 2961, 2963, 2966,
+    2967, 2968, 2969, 2971, 2976, 2984, 2992, 3000, 3001, 3010, 3014, 3020, 3021, 3026, 3029, 3032,
+    3036, 3041, 3048, 3050, 3052, 3053, 3054, 3056, 3057, 3058, 3059, 3060, 3065, 3066, 3067, 3068,
+    3069, 3070, 3076, 3080, 3081, 3085, 3091, 3094, 3100, 3103, 3105, 3107, 3109, 3111, 3119, 3132,
+    3133, 3137, 3143, 3144, 3145, 3149, 3155, 3164, 3167, 3170, 3172, 3173, 3174, 3175, 3177, 3183,
+    3184, 3189, 3194, 3195, 3197, 3204, 3212, 3215, 3218, 3226, 3230, 3231, 3232, 3233, 3242, 3242,
+    3243, 3244, 3246, 3248, 3255, 3256, 3257, 3263, 3268, 3270, 3276, 3278, 3280, 3281, 3282, 3283,
+    3284, 3286, 3286, 3288, 3289, 3291, 3292, 3293, 3294, 3295, 3296, 3298, 3299, 3302, 3303, 3304,
+    3306, 3307, 3308, 3314, 3315, 3316, 3317, 3318, 3320, 3321, 3321, 3323, 3326, 3326, 3326, 3326,
+    3328, 3330, 3330, 3330, 3330, 3330, 3330, 3330, 3331, 3332, 3334, 3335, 3336, 3339, 3340, 3342,
+    3344, 3346, 3346, 3347, 3351, 3356, 3357, 3361, 3363, 3364, 3368, 3372, 3376, 3378, 3388, 3389,
+    3390, 3391, 3397, 3402, 3405, 3407, 3408, 3410, 3413, 3413, 3417, 3418, 3418, 3419, 3429, 3430,
+    3431, 3433, 3437, 3439, 3445, 3446, 3449, 3449, 3449, 3450, 3452, 3452, 3454, 3455, 3459, 3460,
+    3460, 3461, 3462, 3463, 3465, 3466, 3470, 3476, 3478, 3485, 3489, 3490, 3491, 3494, 3498, 3498,
+    3498, 3500, 3500, 3501, 3501, 3502, 3504, 3506, 3508, 3510, 3512, 3513, 3513, 3514, 3514, 3516,
+    3517, 3517, 3517, 3518, 3519, 3519, 3520, 3521, 3522, 3525, 3527, 3528, 3528, 3528, 3529, 3530,
+    3530, 3532, 3535, 3537, 3539, 3539, 3541, 3543, 3546, 3546, 3547, 3547, 3547, 3549, 3549, 3550,
+    3553, 3555, 3559, 3560, 3563, 3564, 3564, 3565, 3566, 3567, 3567, 3568, 3569, 3570, 3570, 3575,
+    3575, 3578, 3579, 3580, 3581, 3582, 3582, 3582, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3591,
+    3594, 3594, 3594, 3596, 3597, 3598, 3598, 3598, 3601, 3606, 3607, 3608, 3610, 3612, 3613, 3614,
+    3615, 3618, 3618, 3620, 3620, 3622, 3626, 3626, 3627, 3630, 3631, 3631, 3631, 3633, 3639, 3643,
+    3643, 3644, 3646, 3646, 3647, 3648, 3648, 3650, 3650, 3654, 3655, 3658, 3659, 3660, 3660, 3660,
+    3661, 3662, 3664, 3664, 3665, 3665, 3666, 3667, 3669, 3670, 3674, 3677, 3679, 3680, 3681, 3682,
+    3684, 3686, 3690, 3694, 3696, 3697, 3699, 3700, 3702, 3703, 3703, 3703, 3703, 3704, 3706, 3709,
+    3709, 3711, 3713, 3714, 3716, 3716, 3716, 3716, 3717, 3717, 3717, 3717, 3718, 3721, 3723, 3724,
+    3724, 3724, 3725, 3727, 3730, 3730, 3731, 3732, 3734, 3737, 3741, 3744, 3744, 3748, 3753, 3754,
+    3755, 3755, 3755, 3756, 3756, 3756, 3756, 3757, 3760, 3760, 3761, 3761, 3762, 3763, 3766, 3767,
+    3768, 3770, 3772, 3773, 3773, 3773, 3776, 3776, 3776, 3776, 3776, 3777, 3777, 3777, 3777, 3780,
+    3781, 3783, 3784, 3785, 3785, 3785, 3786, 3786, 3786, 3788, 3790, 3792, 3794, 3795, 3795, 3795,
+    3795, 3795, 3795, 3795, 3798, 3799, 3799, 3800, 3801, 3801, 3802, 3802, 3804, 3804, 3805, 3806,
+    3807, 3809, 3810, 3811, 3817, 3820, 3824, 3827, 3829, 3830, 3830, 3832, 3833, 3834, 3838, 3840,
+    3844, 3845, 3847, 3848, 3848, 3848, 3850, 3856, 3858, 3859, 3860, 3860, 3861, 3861, 3863, 3863,
+    3864, 3864, 3865, 3866, 3866, 3867, 3867, 3871, 3872, 3873, 3874, 3875, 3879, 3879, 3881, 3883,
+    3883, 3884, 3884, 3884, 3885, 3886, 3889, 3890, 3893, 3894, 3895, 3896, 3902, 3910, 3910, 3919,
+    3921, 3924, 3925, 3926, 3928, 3931, 3931, 3933, 3939, 3940, 3942, 3943, 3945, 3945, 3947, 3948,
+    3949, 3956, 3964, 3964, 3967, 3968, 3970, 3972, 3973, 3973, 3973, 3973, 3973, 3973, 3974, 3976,
+    3976, 3977, 3978, 3978, 3980, 3983, 3984, 3985, 3985, 3987, 3988, 3989, 3990, 3991, 3995, 3996,
+    3997, 4007, 4007, 4015, 4015, 4017, 4021, 4022, 4025, 4026, 4027, 4028, 4031, 4034, 4036, 4043,
+    4044, 4045, 4047, 4050, 4051, 4055, 4056, 4056, 4057, 4059, 4060, 4065, 4065, 4066, 4070, 4071,
+    4072, 4072, 4072, 4072, 4073, 4073, 4076, 4078, 4082, 4086, 4087, 4087, 4088, 4089, 4089, 4092,
+    4092, 4092, 4093, 4093, 4095, 4096, 4096, 4097, 4098, 4100, 4101, 4104, 4105, 4105, 4107, 4107,
+    4109, 4109, 4110, 4111, 4112, 4113, 4113, 4114, 4117, 4118, 4118, 4118, 4124, 4125, 4126, 4129,
+    4134, 4135, 4136, 4137, 4138, 4138, 4140, 4144, 4144, 4145, 4147, 4148, 4149, 4149, 4149, 4150,
+    4150, 4151, 4152, 4153, 4155, 4156, 4156, 4159, 4161, 4163, 4164, 4165, 4167, 4167, 4167, 4167,
+    4168, 4170, 4174, 4175, 4176, 4177, 4180, 4180, 4181, 4182, 4182, 4183, 4184, 4185, 4185, 4186,
+    4188, 4190, 4190, 4191, 4194, 4194, 4195, 4196, 4196, 4196, 4196, 4198, 4198, 4200, 4201, 4201,
+    4202, 4203, 4205, 4206, 4206, 4206, 4206, 4206, 4207, 4210, 4210, 4212, 4213, 4213, 4218, 4220,
+    4221, 4221, 4222, 4223, 4223, 4224, 4224, 4225, 4225, 4225, 4225, 4225, 4226, 4227, 4228, 4230,
+    4231, 4232, 4232, 4238, 4240, 4245, 4246, 4247, 4248, 4250, 4251, 4252, 4255, 4256, 4257, 4258,
+    4258, 4264, 4265, 4266, 4266, 4267, 4268, 4269, 4269, 4270, 4271, 4272, 4272, 4276, 4278, 4279,
+    4279, 4280, 4281, 4282, 4284, 4285, 4287, 4289, 4291, 4293, 4297, 4299, 4300, 4301, 4302, 4304,
+    4304, 4305, 4307, 4307, 4307, 4308, 4310, 4311, 4311, 4312, 4314, 4314, 4314, 4315, 4318, 4319,
+    4320, 4323, 4324, 4327, 4328, 4328, 4329, 4330, 4335, 4336, 4337, 4337, 4340, 4341, 4342, 4344,
+    4346, 4350, 4352, 4352, 4354, 4359, 4360, 4362, 4362, 4363, 4364, 4365, 4366, 4370, 4371, 4373,
+    4373, 4373, 4374, 4376, 4378, 4378, 4378, 4379, 4380, 4381, 4385, 4385, 4387, 4388, 4390, 4394,
+    4397, 4397, 4403, 4404, 4404, 4405, 4406, 4407, 4407, 4409, 4411, 4415, 4416, 4417, 4418, 4418,
+    4420, 4421, 4422, 4425, 4431, 4436, 4436, 4436, 4436, 4439, 4441, 4443, 4444, 4444, 4444, 4446,
+    4446, 4446, 4449, 4450, 4451, 4451, 4454, 4455, 4455, 4456, 4457, 4458, 4459, 4462, 4464, 4465,
+    4469, 4470, 4474, 4475, 4477, 4478, 4478, 4481, 4482, 4483, 4483, 4485, 4489, 4489, 4490, 4491,
+    4492, 4494, 4496, 4501, 4502, 4508, 4510, 4510, 4517, 4519, 4521, 4521, 4524, 4525, 4528, 4531,
+    4533, 4533, 4534, 4534, 4535, 4536, 4536, 4537, 4538, 4538, 4538, 4539, 4539, 4539, 4539, 4540,
+    4540, 4540, 4540, 4540, 4541, 4542, 4542, 4543, 4544, 4544, 4544, 4546, 4546, 4550, 4550, 4551,
+    4552, 4552, 4553, 4553, 4553, 4554, 4554, 4555, 4555, 4555, 4555, 4557, 4558, 4560, 4561, 4562,
+    4565, 4567, 4568, 4571, 4572, 4573, 4573, 4573, 4574, 4575, 4576, 4576, 4577, 4578, 4580, 4581,
+    4585, 4587, 4592, 4595, 4597, 4598, 4598, 4599, 4600, 4600, 4605, 4606, 4612, 4615, 4618, 4621,
+    4621, 4621, 4625, 4629, 4630, 4630, 4631, 4633, 4634, 4634, 4636, 4637, 4643, 4644, 4647, 4648,
+    4649, 4651, 4651, 4652, 4653, 4653, 4656, 4657, 4659, 4660, 4663, 4666, 4670, 4671, 4673, 4673,
+    4674, 4676, 4678, 4678, 4678, 4678, 4678, 4679, 4681, 4683, 4684, 4686, 4686, 4687, 4687, 4688,
+    4690, 4691, 4691, 4692, 4695, 4696, 4696, 4698, 4698, 4700, 4700, 4700, 4701, 4702, 4703, 4703,
+    4706, 4708, 4708, 4709, 4713, 4714, 4714, 4717, 4720, 4723, 4724, 4727, 4727, 4730, 4730, 4732,
+    4733, 4739, 4740, 4741, 4742, 4746, 4746, 4746, 4746, 4748, 4748, 4750, 4756, 4757, 4760, 4761,
+    4761, 4762, 4762, 4763, 4763, 4764, 4764, 4765, 4766, 4766, 4767, 4768, 4773, 4774, 4776, 4777,
+    4779, 4779, 4780, 4781, 4782, 4787, 4791, 4792, 4792, 4792, 4792, 4794, 4794, 4794, 4794, 4794,
+    4795, 4798, 4799, 4799, 4801, 4802, 4805, 4810, 4812, 4814, 4816, 4817, 4818, 4819, 4822, 4824,
+    4825, 4825, 4825, 4827, 4828, 4832, 4834, 4835, 4835, 4836, 4837, 4838, 4838, 4840, 4842, 4844,
+    4845, 4845, 4846, 4846, 4850, 4854, 4855, 4856, 4856, 4857, 4860, 4861, 4864, 4865, 4866, 4867,
+    4868, 4868, 4869, 4869, 4871, 4873, 4874, 4875, 4876, 4877, 4877, 4878, 4880, 4880, 4882, 4886,
+    4888, 4889, 4889, 4890, 4890, 4892, 4893, 4894, 4894, 4894, 4895, 4896, 4898, 4901, 4903, 4904,
+    4905, 4908, 4909, 4910, 4911, 4912, 4912, 4913, 4913, 4915, 4915, 4916, 4918, 4918, 4918, 4919,
+    4921, 4922, 4923, 4924, 4929, 4930, 4930, 4931, 4931, 4931, 4932, 4933, 4935, 4937, 4937, 4937,
+    4938, 4938, 4938, 4938, 4938, 4939, 4940, 4942, 4943, 4945, 4946, 4947, 4947, 4948, 4948, 4949,
+    4951, 4952, 4953, 4956, 4957, 4959, 4960, 4962, 4963, 4964, 4964, 4965, 4965, 4966, 4966, 4967,
+    4969, 4972, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984, 4984, 4985, 4987, 4990,
+    4991, 4992, 4993, 4995, 4996, 4999, 5000, 5010, 5011, 5013, 5014, 5014, 5018, 5018, 5018, 5021,
+    5023, 5026, 5030, 5031, 5033, 5035, 5037, 5038, 5039, 5041, 5042, 5046, 5047, 5049, 5051, 5053,
+    5054, 5055, 5057, 5057, 5058, 5059, 5060, 5060, 5062, 5064, 5066, 5068, 5068, 5068, 5068, 5072,
+    5076, 5077, 5084, 5085, 5086, 5088, 5089, 5090, 5092, 5094, 5095, 5095, 5096, 5099, 5102, 5102,
+    5102, 5104, 5106, 5107, 5110, 5112, 5115, 5116, 5117, 5118, 5119, 5119, 5121, 5121, 5123, 5125,
+    5126, 5127, 5129, 5129, 5130, 5130, 5130, 5133, 5133, 5134, 5135, 5135, 5139, 5140, 5144, 5147,
+    5147, 5147, 5147, 5148, 5148, 5150, 5151, 5151, 5153, 5156, 5157, 5165, 5167, 5167, 5168, 5171,
+    5176, 5176, 5179, 5179, 5179, 5179, 5179, 5180, 5182, 5185, 5187, 5188, 5189, 5192, 5193, 5195,
+    5197, 5201, 5202, 5203, 5203, 5204, 5206, 5206, 5207, 5208, 5209, 5209, 5210, 5211, 5212, 5213,
+    5214, 5219, 5220, 5221, 5229, 5232, 5237, 5237, 5237, 5238, 5239, 5239, 5239, 5240, 5241, 5241,
+    5241, 5241, 5241, 5242, 5242, 5242, 5243, 5243, 5246, 5247, 5250, 5251, 5253, 5255, 5255, 5256,
+    5258, 5262, 5264, 5267, 5267, 5268, 5269, 5271, 5272, 5274, 5276, 5276, 5277, 5279, 5281, 5282,
+    5283, 5286, 5286, 5291, 5292, 5294, 5296, 5300, 5301, 5302, 5304, 5305, 5305, 5308, 5311, 5315,
+    5318, 5319, 5323, 5324, 5324, 5324, 5326, 5330, 5330, 5331, 5331, 5331, 5332, 5334, 5335, 5339,
+    5340, 5343, 5345, 5346, 5350, 5354, 5354, 5356, 5356, 5360, 5364, 5366, 5367, 5369, 5370, 5372,
+    5372, 5373, 5375, 5378, 5378, 5379, 5383, 5387, 5388, 5388, 5389, 5390, 5390, 5392, 5393, 5394,
+    5397, 5401, 5403, 5405, 5407, 5409, 5411, 5413, 5413, 5417, 5417, 5418, 5418, 5422, 5424, 5426,
+    5427, 5428, 5428, 5432, 5433, 5434, 5435, 5435, 5435, 5437, 5440, 5447, 5449, 5450, 5450, 5452,
+    5453, 5454, 5455, 5457, 5458, 5459, 5464, 5466, 5466, 5466, 5467, 5467, 5467, 5470, 5470, 5474,
+    5476, 5476, 5479, 5479, 5480, 5480, 5483, 5486, 5487, 5489, 5491, 5494, 5494, 5494, 5496, 5498,
+    5500, 5501, 5501, 5504, 5506, 5513, 5514, 5518, 5520, 5521, 5522, 5523, 5523, 5523, 5525, 5529,
+    5532, 5532, 5532, 5533, 5535, 5536, 5538, 5541, 5542, 5543, 5543, 5544, 5544, 5544, 5544, 5545,
+    5546, 5547, 5547, 5548, 5550, 5552, 5553, 5554, 5555, 5556, 5560, 5560, 5563, 5564, 5566, 5567,
+    5569, 5572, 5574, 5577, 5578, 5581, 5582, 5583, 5583, 5587, 5589, 5590, 5590, 5591, 5591, 5592,
+    5592, 5592, 5598, 5601, 5602, 5609, 5610, 5615, 5618, 5618, 5618, 5619, 5619, 5619, 5621, 5621,
+    5622, 5622, 5622, 5622, 5622, 5622, 5623, 5624, 5624, 5626, 5627, 5628, 5628, 5629, 5635, 5636,
+    5638, 5640, 5644, 5646, 5648, 5649, 5649, 5649, 5650, 5651, 5651, 5653, 5655, 5656, 5656, 5658,
+    5661, 5662, 5667, 5667, 5668, 5673, 5675, 5676, 5676, 5676, 5676, 5676, 5677, 5680, 5683, 5683,
+    5686, 5686, 5688, 5688, 5691, 5692, 5693, 5694, 5695, 5696, 5698, 5701, 5703, 5703, 5709, 5710,
+    5710, 5711, 5713, 5714, 5718, 5718, 5718, 5718, 5719, 5720, 5720, 5721, 5722, 5725, 5728, 5730,
+    5730, 5732, 5733, 5737, 5739, 5743, 5748, 5750, 5750, 5750, 5750, 5751, 5751, 5751, 5752, 5753,
+    5753, 5753, 5753, 5753, 5753, 5754, 5755, 5759, 5759, 5759, 5760, 5760, 5760, 5760, 5762, 5762,
+    5762, 5762, 5764, 5768, 5768, 5768, 5770, 5771, 5772, 5772, 5774, 5775, 5775, 5775, 5775, 5775,
+    5778, 5782, 5783, 5784, 5784, 5787, 5788, 5788, 5788, 5789, 5790, 5791, 5792, 5793, 5794, 5795,
+    5797, 5798, 5799, 5800, 5801, 5804, 5806, 5806, 5806, 5807, 5810, 5811, 5811, 5812, 5814, 5815,
+    5816, 5816, 5817, 5818, 5822, 5823, 5825, 5825, 5825, 5825, 5826, 5826, 5826, 5827, 5829, 5829,
+    5830, 5832, 5835, 5836, 5836, 5836, 5837, 5839, 5844, 5845, 5846, 5847, 5849, 5850, 5853, 5853,
+    5856, 5857, 5858, 5860, 5861, 5861, 5862, 5864, 5865, 5867, 5870, 5875, 5875, 5880, 5880, 5880,
+    5880, 5880, 5880, 5880, 5882, 5883, 5886, 5887, 5888, 5889, 5890, 5890, 5890, 5890, 5890, 5894,
+    5896, 5902, 5904, 5906, 5908, 5910, 5910, 5911, 5911, 5912, 5916, 5919, 5919, 5920, 5923, 5926,
+    5926, 5926, 5926, 5926, 5930, 5931, 5934, 5936, 5937, 5937, 5939, 5940, 5941, 5941, 5942, 5943,
+    5944, 5945, 5947, 5948, 5950, 5951, 5951, 5952, 5952, 5952, 5953, 5955, 5955, 5956, 5957, 5957,
+    5958, 5959, 5959, 5959, 5960, 5960, 5961, 5961, 5961, 5962, 5962, 5963, 5964, 5964, 5964, 5964,
+    5965, 5965, 5967, 5968, 5968, 5968, 5968, 5969, 5971, 5971, 5972, 5974, 5974, 5974, 5974, 5974,
+    5974, 5975, 5976, 5978, 5978, 5979, 5979, 5979, 5979, 5979, 5980, 5980, 5980, 5981, 5981, 5982,
+    5983, 5983, 5983, 5984, 5984, 5984, 5984, 5984, 5986, 5986, 5988, 5988, 5989, 5990, 5990, 5991,
+    5992, 5992, 5992, 5992, 5992, 5995, 5995, 5995, 5996, 5997, 5998, 5999, 5999, 5999, 5999, 5999,
+    6000, 6000, 6000, 6000, 6000, 6001, 6001, 6001, 6002, 6003, 6003, 6005, 6006, 6009, 6010, 6011,
+    6012, 6013, 6014, 6016, 6017, 6017, 6018, 6019, 6021, 6021, 6022, 6022, 6024, 6025, 6026, 6028,
+    6029, 6031, 6032, 6034, 6035, 6035, 6037, 6037, 6038, 6040, 6042, 6044, 6045, 6046, 6047, 6048,
+    6049, 6049, 6050, 6051, 6052, 6052, 6053, 6053, 6054, 6054, 6057, 6058, 6059, 6060, 6061, 6062,
+    6065, 6066, 6067, 6068, 6070, 6071, 6073, 6074, 6076, 6077, 6080, 6081, 6082, 6083, 6084, 6085,
+    6086, 6088, 6089, 6090, 6091, 6091, 6092, 6094, 6095, 6096, 6097, 6098, 6100, 6101, 6102, 6104,
+    6105, 6107, 6108, 6109, 6113, 6115, 6116, 6117, 6120, 6122, 6125, 6126, 6127, 6128, 6129, 6130,
+    6131, 6132, 6133, 6133, 6134, 6135, 6136, 6138, 6139, 6143, 6144, 6146, 6147, 6148, 6149, 6150,
+    6151, 6153, 6154, 6155, 6156, 6157, 6158, 6159, 6160, 6162, 6163, 6165, 6166, 6167, 6168, 6170,
+    6172, 6172, 6174, 6175, 6176, 6178, 6179, 6180, 6181, 6183, 6184, 6186, 6186, 6187, 6188, 6190,
+    6192, 6193, 6193, 6194, 6195, 6196, 6198, 6199, 6201, 6203, 6203, 6204, 6205, 6205, 6207, 6208,
+    6209, 6210, 6212, 6212, 6213, 6214, 6215, 6216, 6217, 6218, 6219, 6221, 6222, 6223, 6224, 6225,
+    6226, 6227, 6228, 6228, 6229, 6230, 6231, 6232, 6233, 6234, 6235, 6237, 6238, 6240, 6241, 6244,
+    6245, 6247, 6248, 6249, 6250, 6251, 6252, 6253, 6254, 6259, 6260, 6261, 6261, 6261, 6262, 6263,
+    6263, 6264, 6266, 6267, 6268, 6270, 6271, 6272, 6274, 6275, 6276, 6278, 6280, 6281, 6282, 6284,
+    6286, 6287, 6289, 6289, 6289, 6290, 6291, 6292, 6293, 6295, 6296, 6297, 6299, 6301, 6302, 6303,
+    6304, 6304, 6305, 6306, 6309, 6310, 6312, 6313, 6313, 6314, 6316, 6317, 6318, 6319, 6321, 6322,
+    6323, 6323, 6325, 6325, 6326, 6327, 6328, 6329, 6331, 6331, 6333, 6334, 6335, 6336, 6337, 6338,
+    6339, 6340, 6341, 6341, 6342, 6343, 6344, 6346, 6348, 6349, 6350, 6351, 6353, 6354, 6356, 6357,
+    6359, 6360, 6361, 6362, 6362, 6362, 6363, 6364, 6364, 6366, 6368, 6369, 6370, 6371, 6372, 6373,
+    6374, 6375, 6376, 6377, 6378, 6379, 6380, 6381, 6382, 6383, 6386, 6388, 6389, 6391, 6395, 6398,
+    6399, 6401, 6402, 6403, 6404, 6405, 6409, 6410, 6411, 6412, 6414, 6419, 6423, 6424, 6425, 6426,
+    6430, 6431, 6433, 6434, 6435, 6436, 6437, 6438, 6439, 6441, 6442, 6444, 6446, 6446, 6447, 6448,
+    6449, 6450, 6451, 6452, 6459, 6460, 6461, 6463, 6464, 6465, 6466, 6467, 6468, 6468, 6469, 6470,
+    6471, 6472, 6473, 6474, 6476, 6478, 6478, 6478, 6479, 6480, 6481, 6481, 6481, 6482, 6483, 6484,
+    6485, 6486, 6488, 6489, 6490, 6491, 6492, 6494, 6497, 6498, 6499, 6500, 6503, 6504, 6505, 6505,
+    6506, 6507, 6508, 6508, 6511, 6512, 6513, 6514, 6516, 6517, 6519, 6520, 6522, 6531, 6532, 6543,
+    6544, 6545, 6546, 6547, 6548, 6549, 6552, 6553, 6554, 6554, 6556, 6557, 6558, 6559, 6561, 6563,
+    6565, 6568, 6570, 6572, 6574, 6576, 6577, 6578, 6581, 6582, 6583, 6584, 6586, 6587, 6588, 6589,
+    6590, 6591, 6592, 6593, 6593, 6594, 6595, 6596, 6596, 6597, 6601, 6602, 6603, 6604, 6605, 6606,
+    6612, 6613, 6614, 6615, 6616, 6618, 6621, 6621, 6622, 6626, 6627, 6628, 6629, 6630, 6634, 6635,
+    6636, 6637, 6638, 6639, 6640, 6641, 6642, 6643, 6645, 6646, 6647, 6650, 6652, 6654, 6656, 6657,
+    6658, 6662, 6665, 6667, 6671, 6673, 6678, 6679, 6681, 6683, 6684, 6685, 6686, 6687, 6688, 6689,
+    6690, 6691, 6692, 6693, 6694, 6695, 6697, 6698, 6701, 6702, 6703, 6704, 6705, 6706, 6707, 6708,
+    6708, 6710, 6712, 6713, 6714, 6715, 6716, 6718, 6719, 6720, 6721, 6724, 6725, 6728, 6729, 6731,
+    6733, 6734, 6735, 6736, 6737, 6738, 6739, 6740, 6740, 6740, 6740, 6740, 6740, 6741, 6742, 6743,
+    6746, 6747, 6748, 6749, 6751, 6752, 6753, 6754, 6755, 6756, 6757, 6758, 6759, 6760, 6761, 6762,
+    6763, 6764, 6765, 6767, 6770, 6771, 6773, 6774, 6776, 6778, 6779, 6780, 6781, 6782, 6784, 6785,
+    6786, 6787, 6788, 6789, 6790, 6791, 6792, 6792, 6792, 6793, 6793, 6794, 6795, 6796, 6797, 6797,
+    6799, 6800, 6800, 6801, 6801, 6801, 6801, 6802, 6803, 6803, 6803, 6804, 6805, 6805, 6806, 6807,
+    6807, 6807, 6807, 6807, 6807, 6808, 6808, 6808, 6808, 6809, 6809, 6809, 6810, 6810, 6810, 6810,
+    6811, 6812, 6812, 6812, 6812, 6813, 6813, 6814, 6814, 6814, 6814, 6814, 6814, 6816, 6816, 6817,
+    6817, 6818, 6819, 6820, 6820, 6821, 6821, 6821, 6821, 6821, 6822, 6823, 6825, 6826, 6826, 6826,
+    6827, 6828, 6828, 6829, 6830, 6831, 6832, 6834, 6835, 6836, 6837, 6837, 6838, 6838, 6838, 6839,
+    6839, 6840, 6840, 6840, 6841, 6841, 6843, 6844, 6844, 6844, 6845, 6845, 6845, 6846, 6847, 6848,
+    6848, 6849, 6849, 6850, 6850, 6851, 6852, 6853, 6853, 6853, 6853, 6853, 6853, 6853, 6853, 6853,
+    6854, 6855, 6855, 6856, 6856, 6858, 6858, 6859, 6860, 6861, 6862, 6862, 6863, 6865, 6865, 6866,
+    6867, 6867, 6868, 6868, 6868, 6868, 6869, 6870, 6871, 6871, 6872, 6872, 6873, 6874, 6874, 6874,
+    6876, 6877, 6877, 6878, 6878, 6878, 6878, 6878, 6879, 6879, 6879, 6879, 6879, 6879, 6880, 6880,
+    6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6882, 6882, 6883, 6884, 6884, 6885, 6885, 6886,
+    6887, 6888, 6890, 6891, 6891, 6893, 6894, 6894, 6894, 6894, 6894, 6894, 6895, 6896, 6896, 6897,
+    6897, 6897, 6898, 6898, 6899, 6899, 6899, 6899, 6899, 6899, 6900, 6900, 6900, 6900, 6901, 6902,
+    6902, 6902, 6902, 6903, 6906, 6907, 6907, 6907, 6907, 6907, 6907, 6907, 6907, 6907, 6908, 6908,
+    6909, 6909, 6909, 6910, 6910, 6910, 6911, 6912, 6913, 6913, 6914, 6914, 6914, 6914, 6914, 6914,
+    6914, 6914, 6914, 6914, 6915, 6915, 6915, 6916, 6917, 6917, 6917, 6917, 6917, 6917, 6918, 6919,
+    6919, 6920, 6921, 6921, 6922, 6922, 6923, 6923, 6924, 6924, 6924, 6925, 6925, 6926, 6926, 6926,
+    6927, 6928, 6929, 6929, 6929, 6929, 6929, 6929, 6929, 6929, 6929, 6930, 6930, 6931, 6931, 6932,
+    6932, 6932, 6932, 6933, 6933, 6934, 6935, 6935, 6935, 6936, 6936, 6937, 6937, 6937, 6938, 6939,
+    6941, 6941, 6941, 6941, 6944, 6945, 6945, 6946, 6947, 6949, 6949, 6949, 6950, 6951, 6951, 6951,
+    6952, 6952, 6953, 6953, 6954, 6954, 6954, 6954, 6954, 6954, 6954, 6955, 6955, 6956, 6956, 6956,
+    6956, 6957, 6958, 6958, 6959, 6960, 6961, 6963, 6965, 6965, 6965, 6965, 6965, 6965, 6965, 6965,
+    6966, 6966, 6966, 6967, 6968, 6969, 6969, 6969, 6969, 6969, 6970, 6972, 6973, 6975, 6975, 6975,
+    6975, 6975, 6975, 6976, 6976, 6977, 6978, 6978, 6978, 6978, 6978, 6978, 6979, 6979, 6979, 6980,
+    6980, 6980, 6980, 6980, 6980, 6981, 6983, 6984, 6984, 6985, 6985, 6985, 6985, 6985, 6986, 6988,
+    6989, 6989, 6989, 6991, 6991, 6992, 6993, 6993, 6994, 6994, 6996, 6996, 6996, 6996, 6996, 6996,
+    6997, 6998, 6999, 7001, 7001, 7001, 7001, 7001, 7001, 7001, 7002, 7002, 7002, 7002, 7003, 7004,
+    7005, 7006, 7007, 7007, 7007, 7009, 7009, 7009, 7011, 7013, 7014, 7014, 7015, 7015, 7015, 7015,
+    7015, 7015, 7015, 7016, 7016, 7016, 7016, 7016, 7018, 7018, 7018, 7019, 7019, 7019, 7020, 7020,
+    7020, 7020, 7020, 7021, 7021, 7022, 7023, 7023, 7023, 7023, 7024, 7024, 7024, 7024, 7024, 7024,
+    7026, 7026, 7026, 7026, 7027, 7028, 7029, 7029, 7029, 7029, 7029, 7030, 7030, 7031, 7031, 7031,
+    7031, 7031, 7031, 7032, 7032, 7033, 7035, 7035, 7035, 7036, 7036, 7036, 7036, 7036, 7037, 7038,
+    7039, 7040, 7041, 7041, 7041, 7041, 7042, 7044, 7044, 7045, 7045, 7045, 7045, 7046, 7047, 7048,
+    7048, 7049, 7049, 7049, 7051, 7051, 7051, 7051, 7052, 7052, 7053, 7053, 7055, 7055, 7056, 7057,
+    7058, 7058, 7060, 7061, 7063, 7064, 7065, 7065, 7066, 7066, 7066, 7066, 7066, 7067, 7067, 7067,
+    7067, 7067, 7067, 7067, 7068, 7068, 7068, 7068, 7068, 7068, 7068, 7069, 7070, 7070, 7072, 7072,
+    7073, 7074, 7074, 7074, 7074, 7074, 7075, 7075, 7075, 7075, 7075, 7075, 7075, 7075, 7075, 7075,
+    7075, 7076, 7076, 7076, 7076, 7076, 7077, 7077, 7077, 7077, 7077, 7078, 7079, 7079, 7080, 7080,
+    7081, 7081, 7081, 7082, 7082, 7082, 7082, 7083, 7085, 7086, 7087, 7087, 7088, 7088, 7089, 7089,
+    7090, 7090, 7090, 7090, 7091, 7091, 7091, 7091, 7091, 7091, 7091, 7092, 7092, 7092, 7093, 7093,
+    7094, 7096, 7098, 7098, 7099, 7099, 7100, 7100, 7101, 7101, 7102, 7103, 7104, 7105, 7105, 7105,
+    7105, 7106, 7108, 7109, 7109, 7110, 7110, 7110, 7110, 7111, 7111, 7111, 7111, 7111, 7111, 7111,
+    7111, 7112, 7113, 7113, 7113, 7113, 7114, 7114, 7115, 7115, 7115, 7115, 7116, 7116, 7117, 7118,
+    7118, 7118, 7121, 7122, 7122, 7123, 7124, 7126, 7126, 7127, 7127, 7128, 7128, 7129, 7129, 7130,
+    7131, 7132, 7133, 7134, 7138, 7138, 7140, 7140, 7140, 7141, 7143, 7144, 7144, 7144, 7144, 7145,
+    7148, 7148, 7148, 7148, 7148, 7148, 7149, 7150, 7150, 7150, 7150, 7151, 7152, 7153, 7153, 7153,
+    7154, 7155, 7157, 7157, 7158, 7158, 7159, 7160, 7160, 7160, 7161, 7161, 7162, 7162, 7163, 7164,
+    7165, 7166, 7167, 7168, 7169, 7171, 7172, 7174, 7175, 7175, 7176, 7176, 7177, 7177, 7178, 7179,
+    7179, 7180, 7181, 7181, 7181, 7183, 7185, 7185, 7185, 7185, 7185, 7186, 7186, 7186, 7187, 7187,
+    7189, 7191, 7192, 7192, 7192, 7192, 7192, 7192, 7192, 7192, 7192, 7193, 7193, 7193, 7193, 7193,
+    7193, 7193, 7194, 7194, 7195, 7196, 7196, 7197, 7197, 7198, 7198, 7199, 7199, 7199, 7199, 7199,
+    7200, 7200, 7200, 7200, 7201, 7201, 7201, 7201, 7204, 7206, 7208, 7208, 7208, 7209, 7210, 7210,
+    7211, 7211, 7211, 7211, 7211, 7211, 7211, 7212, 7213, 7213, 7214, 7215, 7215, 7217, 7218, 7218,
+    7219, 7219, 7219, 7220, 7220, 7220, 7220, 7221, 7221, 7221, 7221, 7221, 7221, 7221, 7221, 7221,
+    7222, 7222, 7224, 7224, 7224, 7224, 7224, 7225, 7225, 7228, 7228, 7229, 7230, 7230, 7230, 7230,
+    7230, 7230, 7230, 7230, 7230, 7230, 7230, 7230, 7231, 7231, 7231, 7232, 7232, 7232, 7233, 7234,
+    7234, 7235, 7235, 7235, 7235, 7236, 7236, 7236, 7236, 7236, 7236, 7237, 7237, 7237, 7237, 7237,
+    7237, 7238, 7238, 7239, 7240, 7240, 7241, 7241, 7241, 7242, 7242, 7242, 7243, 7243, 7243, 7243,
+    7244, 7244, 7244, 7244, 7244, 7244, 7244, 7244, 7245, 7247, 7248, 7250, 7251, 7251, 7252, 7252,
+    7252, 7254, 7255, 7256, 7257, 7258, 7258, 7258, 7258, 7258, 7258, 7260, 7260, 7260, 7262, 7262,
+    7262, 7263, 7263, 7264, 7265, 7266, 7266, 7267, 7267, 7267, 7268, 7268, 7268, 7268, 7269, 7269,
+    7270, 7270, 7270, 7270, 7270, 7271, 7271, 7272, 7272, 7273, 7273, 7274, 7274, 7274, 7275, 7275,
+    7275, 7275, 7275, 7275, 7275, 7275, 7276, 7277, 7278, 7278, 7279, 7279, 7280, 7281, 7281, 7282,
+    7283, 7283, 7283, 7283, 7284, 7285, 7285, 7285, 7286, 7286, 7286, 7287, 7287, 7287, 7287, 7287,
+    7287, 7288, 7289, 7289, 7291, 7291, 7291, 7293, 7293, 7293, 7293, 7293, 7293, 7295, 7295, 7295,
+    7295, 7295, 7295, 7296, 7297, 7297, 7297, 7297, 7297, 7297, 7298, 7299, 7299, 7299, 7299, 7299,
+    7300, 7301, 7301, 7303, 7303, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7304,
+    7304, 7304, 7305, 7305, 7305, 7305, 7306, 7307, 7307, 7308, 7308, 7308, 7309, 7310, 7310, 7310,
+    7310, 7310, 7310, 7310, 7310, 7310, 7310, 7310, 7311, 7311, 7312, 7312, 7312, 7312, 7312, 7312,
+    7312, 7313, 7313, 7313, 7314, 7314, 7314, 7314, 7315, 7316, 7317, 7317, 7318, 7319, 7320, 7320,
+    7320, 7320, 7321, 7321, 7321, 7323, 7324, 7324, 7325, 7326, 7326, 7327, 7327, 7328, 7328, 7328,
+    7328, 7328, 7328, 7328, 7331, 7331, 7331, 7331, 7331, 7332, 7332, 7332, 7332, 7332, 7332, 7333,
+    7334, 7334, 7334, 7334, 7334, 7334, 7334, 7334, 7335, 7335, 7335, 7335, 7335, 7336, 7338, 7338,
+    7338, 7338, 7339, 7339, 7339, 7339, 7339, 7340, 7340, 7341, 7341, 7342, 7342, 7343, 7343, 7343,
+    7343, 7343, 7343, 7343, 7344, 7346, 7346, 7346, 7346, 7347, 7348, 7348, 7349, 7349, 7349, 7350,
+    7352, 7353, 7353, 7353, 7354, 7355, 7355, 7355, 7356, 7356, 7356, 7356, 7356, 7358, 7358, 7358,
+    7360, 7360, 7361, 7361, 7361, 7362, 7362, 7362, 7363, 7363, 7364, 7364, 7364, 7364, 7365, 7366,
+    7368, 7369, 7369, 7369, 7371, 7371, 7371, 7372, 7372, 7372, 7374, 7374, 7374, 7374, 7374, 7375,
+    7375, 7375, 7375, 7375, 7376, 7377, 7377, 7377, 7377, 7377, 7377, 7377, 7378, 7378, 7378, 7378,
+    7378, 7378, 7378, 7379, 7380, 7381, 7381, 7381, 7381, 7382, 7383, 7384, 7384, 7384, 7386, 7386,
+    7386, 7386, 7386, 7386, 7386, 7387, 7387, 7387, 7388, 7388, 7388, 7388, 7389, 7389, 7389, 7389,
+    7389, 7390, 7390, 7391, 7391, 7392, 7392, 7392, 7392, 7392, 7392, 7393, 7393, 7394, 7394, 7395,
+    7396, 7396, 7397, 7397, 7397, 7397, 7398, 7398, 7399, 7399, 7399, 7400, 7400, 7401, 7402, 7402,
+    7402, 7402, 7402, 7403, 7403, 7404, 7404, 7404, 7404, 7405, 7406, 7406, 7406, 7406, 7406, 7406,
+    7406, 7406, 7406, 7406, 7407, 7408, 7409, 7409, 7409, 7410, 7410, 7410, 7411, 7411, 7412, 7412,
+    7412, 7413, 7413, 7414, 7414, 7415, 7415, 7415, 7416, 7417, 7418, 7418, 7419, 7420, 7420, 7420,
+    7421, 7421, 7421, 7421, 7421, 7422, 7422, 7422, 7422, 7423, 7423, 7424, 7424, 7425, 7425, 7426,
+    7426, 7426, 7426, 7426, 7426, 7426, 7426, 7428, 7428, 7428, 7429, 7429, 7429, 7429, 7429, 7429,
+    7429, 7430, 7430, 7431, 7431, 7431, 7431, 7433, 7434, 7435, 7438, 7440, 7441, 7441, 7442, 7442,
+    7442, 7442, 7442, 7444, 7444, 7444, 7445, 7445, 7445, 7447, 7447, 7448, 7448, 7448, 7449, 7450,
+    7450, 7450, 7451, 7452, 7452, 7453, 7454, 7455, 7455, 7456, 7458, 7458, 7458, 7460, 7460, 7460,
+    7460, 7461, 7462, 7462, 7462, 7462, 7463, 7463, 7465, 7465, 7466, 7466, 7467, 7467, 7468, 7469,
+    7469, 7470, 7471, 7474, 7475, 7476, 7477, 7478, 7478, 7478, 7478, 7478, 7480, 7480, 7481, 7481,
+    7482, 7482, 7482, 7482, 7483, 7484, 7485, 7485, 7485, 7486, 7487, 7487, 7487, 7487, 7487, 7488,
+    7489, 7489, 7490, 7491, 7492, 7492, 7492, 7492, 7492, 7492, 7492, 7492, 7493, 7494, 7495, 7496,
+    7496, 7496, 7496, 7497, 7497, 7498, 7500, 7500, 7500, 7501, 7501, 7501, 7502, 7502, 7502, 7502,
+    7502, 7502, 7502, 7502, 7502, 7502, 7502, 7503, 7503, 7503, 7504, 7504, 7504, 7504, 7504, 7506,
+    7506, 7506, 7506, 7506, 7506, 7506, 7506, 7507, 7507, 7507, 7507, 7508, 7510, 7510, 7510, 7510,
+    7510, 7510, 7510, 7510, 7510, 7510, 7510, 7510, 7510, 7510, 7510, 7510, 7511, 7511, 7512, 7513,
+    7513, 7513, 7514, 7514, 7515, 7516, 7516, 7517, 7517, 7517, 7517, 7518, 7518, 7519, 7519, 7519,
+    7520, 7520, 7521, 7523, 7523, 7523, 7524, 7525, 7526, 7528, 7528, 7528, 7528, 7528, 7528, 7529,
+    7529, 7530, 7530, 7531, 7531, 7531, 7531, 7531, 7531, 7531, 7532, 7532, 7533, 7533, 7534, 7534,
+    7536, 7536, 7537, 7538, 7538, 7539, 7539, 7539, 7539, 7539, 7539, 7540, 7540, 7540, 7541, 7541,
+    7541, 7541, 7541, 7542, 7542, 7543, 7543, 7543, 7544, 7544, 7546, 7546, 7547, 7548, 7549, 7550,
+    7551, 7551, 7551, 7551, 7552, 7552, 7552, 7554, 7554, 7556, 7557, 7557, 7557, 7557, 7557, 7557,
+    7557, 7558, 7558, 7558, 7558, 7558, 7559, 7560, 7560, 7561, 7561, 7562, 7562, 7563, 7564, 7565,
+    7565, 7565, 7565, 7566, 7566, 7566, 7567, 7567, 7567, 7567, 7568, 7569, 7569, 7569, 7570, 7570,
+    7572, 7574, 7574, 7575, 7576, 7576, 7576, 7576, 7577, 7577, 7577, 7577, 7577, 7578, 7578, 7578,
+    7579, 7580, 7581, 7581, 7583, 7583, 7584, 7585, 7586, 7586, 7586, 7587, 7587, 7587, 7588, 7588,
+    7588, 7589, 7589, 7589, 7589, 7589, 7589, 7590, 7591, 7592, 7593, 7593, 7594, 7595, 7595, 7595,
+    7595, 7595, 7595, 7595, 7595, 7595, 7596, 7597, 7598, 7599, 7599, 7599, 7600, 7600, 7600, 7601,
+    7602, 7603, 7603, 7605, 7605, 7605, 7605, 7606, 7606, 7606, 7606, 7607, 7607, 7607, 7607, 7607,
+    7608, 7608, 7608, 7609, 7609, 7611, 7611, 7611, 7611, 7611, 7612, 7612, 7612, 7615, 7615, 7615,
+    7615, 7616, 7618, 7618, 7619, 7621, 7621, 7622, 7622, 7625, 7625, 7625, 7625, 7625, 7626, 7626,
+    7627, 7627, 7627, 7630, 7630, 7631, 7631, 7632, 7632, 7633, 7633, 7633, 7633, 7633, 7635, 7635,
+    7635, 7636, 7637, 7637, 7637, 7639, 7640, 7641, 7642, 7643, 7645, 7646, 7647, 7647, 7649, 7649,
+    7649, 7650, 7651, 7651, 7652, 7652, 7655, 7656, 7658, 7658, 7658, 7659, 7659, 7659, 7660, 7661,
+    7662, 7663, 7663, 7664, 7664, 7664, 7665, 7666, 7666, 7666, 7668, 7668, 7668, 7669, 7669, 7669,
+    7669, 7669, 7669, 7669, 7670, 7670, 7670, 7670, 7670, 7670, 7671, 7671, 7671, 7672, 7672, 7673,
+    7673, 7673, 7673, 7674, 7674, 7674, 7674, 7675, 7676, 7676, 7676, 7676, 7676, 7676, 7677, 7677,
+    7677, 7677, 7677, 7677, 7678, 7679, 7681, 7682, 7683, 7684, 7684, 7686, 7687, 7687, 7687, 7688,
+    7689, 7690, 7691, 7691, 7692, 7692, 7692, 7692, 7692, 7692, 7692, 7692, 7693, 7693, 7695, 7695,
+    7695, 7695, 7695, 7695, 7696, 7696, 7697, 7697, 7697, 7698, 7698, 7699, 7700, 7700, 7700, 7701,
+    7702, 7702, 7703, 7704, 7705, 7705, 7706, 7707, 7708, 7708, 7708, 7708, 7710, 7710, 7710, 7711,
+    7711, 7711, 7711, 7711, 7711, 7712, 7713, 7713, 7713, 7714, 7714, 7714, 7715, 7717, 7718, 7718,
+    7720, 7721, 7722, 7722, 7722, 7723, 7723, 7723, 7723, 7725, 7726, 7727, 7727, 7727, 7727, 7727,
+    7727, 7728, 7729, 7731, 7732, 7733, 7734, 7735, 7736, 7738, 7739, 7740, 7740, 7740, 7740, 7740,
+    7741, 7741, 7741, 7741, 7741, 7741, 7741, 7741, 7742, 7742, 7744, 7744, 7745, 7747, 7747, 7747,
+    7748, 7748, 7749, 7750, 7750, 7750, 7751, 7752, 7752, 7752, 7752, 7753, 7754, 7754, 7754, 7754,
+    7754, 7755, 7757, 7758, 7759, 7761, 7761, 7761, 7761, 7762, 7762, 7762, 7763, 7763, 7763, 7764,
+    7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765, 7765,
+    7766, 7767, 7768, 7769, 7769, 7769, 7770, 7770, 7771, 7772, 7772, 7772, 7773, 7774, 7774, 7774,
+    7775, 7775, 7776, 7776, 7776, 7777, 7777, 7778, 7779, 7779, 7780, 7780, 7780, 7780, 7781, 7781,
+    7781, 7781, 7781, 7781, 7782, 7783, 7784, 7784, 7784, 7784, 7784, 7784, 7785, 7785, 7785, 7786,
+    7786, 7786, 7786, 7787, 7787, 7790, 7791, 7791, 7791, 7792, 7792, 7792, 7792, 7792, 7792, 7793,
+    7793, 7794, 7794, 7795, 7796, 7796, 7797, 7798, 7798, 7798, 7798, 7799, 7799, 7800, 7800, 7801,
+    7801, 7801, 7801, 7801, 7802, 7802, 7803, 7803, 7804, 7805, 7805, 7805, 7805, 7805, 7805, 7805,
+    7805, 7806, 7806, 7806, 7806, 7807, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7809, 7810, 7810, 7810, 7811, 7811, 7812, 7814, 7814, 7814, 7814, 7814, 7815, 7815,
+    7815, 7815, 7816, 7816, 7816, 7816, 7816, 7816, 7816, 7816, 7817, 7817, 7818, 7818, 7820, 7821,
+    7822, 7822, 7822, 7822, 7823, 7823, 7824, 7824, 7825, 7825, 7827, 7827, 7828, 7829, 7829, 7829,
+    7829, 7830, 7831, 7831, 7831, 7832, 7832, 7833, 7833, 7833, 7833, 7833, 7835, 7835, 7835, 7835,
+    7835, 7835, 7836, 7836, 7836, 7837, 7837, 7837, 7838, 7838, 7838, 7838, 7838, 7838, 7839, 7839,
+    7839, 7840, 7841, 7841, 7842, 7843, 7843, 7844, 7845, 7845, 7845, 7846, 7847, 7847, 7848, 7848,
+    7850, 7851, 7851, 7851, 7851, 7852, 7852, 7852, 7853, 7853, 7853, 7854, 7855, 7856, 7856, 7857,
+    7860, 7861, 7861, 7861, 7861, 7861, 7861, 7861, 7862, 7863, 7864, 7864, 7864, 7865, 7865, 7866,
+    7866, 7866, 7867, 7868, 7868, 7869, 7870, 7871, 7871, 7871, 7871, 7871, 7872, 7872, 7872, 7873,
+    7874, 7874, 7875, 7876, 7877, 7877, 7877, 7877, 7877, 7878, 7878, 7878, 7878, 7878, 7879, 7880,
+    7880, 7880, 7881, 7882, 7882, 7882, 7882, 7885, 7886, 7886, 7886, 7887, 7888, 7888, 7890, 7891,
+    7891, 7893, 7893, 7894, 7896, 7896, 7897, 7897, 7898, 7898, 7898, 7898, 7898, 7898, 7898, 7898,
+    7899, 7899, 7900, 7900, 7901, 7901, 7901, 7902, 7902, 7902, 7902, 7902, 7902, 7903, 7903, 7903,
+    7903, 7904, 7904, 7904, 7904, 7905, 7906, 7907, 7907, 7907, 7907, 7907, 7907, 7907, 7909, 7909,
+    7909, 7909, 7911, 7911, 7911, 7912, 7912, 7915, 7915, 7916, 7916, 7917, 7917, 7920, 7920, 7920,
+    7921, 7923, 7924, 7925, 7925, 7925, 7925, 7925, 7925, 7925, 7926, 7926, 7926, 7927, 7927, 7927,
+    7927, 7927, 7927, 7927, 7927, 7928, 7928, 7928, 7928, 7928, 7929, 7930, 7931, 7931, 7931, 7931,
+    7931, 7932, 7932, 7932, 7934, 7934, 7934, 7934, 7934, 7934, 7934, 7935, 7936, 7937, 7937, 7938,
+    7938, 7938, 7938, 7939, 7939, 7940, 7941, 7942, 7942, 7942, 7942, 7943, 7944, 7945, 7947, 7948,
+    7948, 7949, 7949, 7949, 7949, 7949, 7950, 7951, 7952, 7952, 7952, 7952, 7952, 7953, 7953, 7953,
+    7954, 7956, 7956, 7957, 7957, 7958, 7959, 7960, 7960, 7960, 7960, 7960, 7960, 7961, 7962, 7962,
+    7963, 7963, 7963, 7963, 7963, 7964, 7964, 7964, 7964, 7964, 7965, 7966, 7967, 7968, 7968, 7968,
+    7968, 7968, 7968, 7968, 7968, 7969, 7969, 7970, 7970, 7970, 7970, 7970, 7970, 7970, 7971, 7972,
+    7974, 7975, 7975, 7975, 7975, 7975, 7976, 7976, 7976, 7977, 7977, 7977, 7978, 7978, 7978, 7978,
+    7979, 7979, 7980, 7980, 7981, 7981, 7981, 7982, 7983, 7983, 7987, 7988, 7989, 7990, 7991, 7991,
+    7992, 7993, 7993, 7994, 7994, 7998, 7998, 7998, 8000, 8000, 8000, 8000, 8000, 8000, 8000, 8000,
+    8000, 8001, 8001, 8001, 8001, 8001, 8001, 8001, 8001, 8001, 8001, 8001, 8002, 8002, 8002, 8002,
+    8003, 8003, 8004, 8004, 8004, 8004, 8004, 8004, 8004, 8005, 8006, 8007, 8007, 8007, 8007, 8007,
+    8007, 8008, 8009, 8009, 8009, 8009, 8009, 8009, 8010, 8011, 8011, 8011, 8011, 8012, 8012, 8012,
+    8012, 8012, 8012, 8013, 8014, 8015, 8015, 8015, 8015, 8015, 8015, 8015, 8016, 8017, 8017, 8018,
+    8018, 8019, 8019, 8019, 8019, 8019, 8019, 8019, 8019, 8020, 8020, 8020, 8020, 8020, 8021, 8021,
+    8021, 8021, 8022, 8023, 8024, 8025, 8026, 8027, 8028, 8029, 8030, 8031, 8032, 8033, 8034, 8035,
+    8036, 8037, 8037, 8038, 8039, 8040, 8041, 8041, 8042, 8043, 8044, 8044, 8049, 8050, 8051, 8052,
+    8053, 8055, 8056, 8057, 8058, 8058, 8059, 8061, 8062, 8063, 8064, 8065, 8066, 8067, 8068, 8068,
+    8069, 8070, 8071, 8072, 8075, 8076, 8077, 8077, 8078, 8079, 8080, 8081, 8082, 8083, 8084, 8085,
+    8088, 8089, 8090, 8091, 8091, 8091, 8092, 8093, 8094, 8095, 8096, 8097, 8098, 8099, 8101, 8102,
+    8103, 8104, 8105, 8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115, 8116, 8117, 8118,
+    8119, 8120, 8121, 8122, 8123, 8125, 8126, 8127, 8128, 8129, 8130, 8131, 8131, 8132, 8133, 8134,
+    8135, 8136, 8138, 8139, 8140, 8140, 8141, 8142, 8144, 8145, 8146, 8147, 8148, 8149, 8150, 8151,
+    8152, 8153, 8153, 8154, 8155, 8156, 8157, 8158, 8159, 8160, 8161, 8166, 8167, 8169, 8170, 8171,
+    8172, 8175, 8176, 8178, 8179, 8180, 8181, 8182, 8183, 8184, 8185, 8186, 8187, 8188, 8189, 8190,
+    8191, 8192, 8193, 8194, 8196, 8197, 8198, 8200, 8201, 8202, 8203, 8204, 8207, 8207, 8208, 8208,
+    8209, 8210, 8211, 8212, 8213, 8215, 8216, 8217, 8218, 8219, 8220, 8221, 8222, 8223, 8224, 8225,
+    8226, 8227, 8227, 8228, 8229, 8230, 8231, 8232, 8232, 8233, 8234, 8235, 8236, 8237, 8238, 8238,
+    8239, 8239, 8240, 8241, 8243, 8244, 8245, 8246, 8248, 8249, 8249, 8250, 8251, 8253, 8254, 8255,
+    8256, 8258, 8259, 8260, 8261, 8262, 8263, 8264, 8265, 8266, 8267, 8268, 8269, 8270, 8271, 8272,
+    8273, 8274, 8276, 8278, 8279, 8281, 8282, 8283, 8284, 8285, 8287, 8288, 8289, 8290, 8290, 8291,
+    8291, 8292, 8293, 8295, 8296, 8297, 8298, 8299, 8301, 8302, 8303, 8304, 8305, 8306, 8307, 8308,
+    8309, 8310, 8311, 8315, 8316, 8317, 8317, 8318, 8319, 8320, 8321, 8322, 8323, 8324, 8327, 8328,
+    8330, 8332, 8333, 8334, 8334, 8335, 8336, 8337, 8338, 8340, 8341, 8342, 8343, 8343, 8344, 8345,
+    8346, 8347, 8348, 8349, 8350, 8352, 8353, 8354, 8355, 8356, 8356, 8357, 8358, 8359, 8360, 8361,
+    8362, 8363, 8363, 8364, 8365, 8366, 8367, 8368, 8370, 8371, 8372, 8374, 8375, 8377, 8378, 8379,
+    8380, 8381, 8382, 8383, 8384, 8385, 8386, 8387, 8388, 8390, 8391, 8392, 8393, 8394, 8395, 8396,
+    8397, 8397, 8398, 8399, 8400, 8401, 8402, 8402, 8404, 8405, 8406, 8407, 8408, 8409, 8410, 8410,
+    8411, 8412, 8414, 8415, 8416, 8417, 8418, 8419, 8420, 8421, 8422, 8423, 8424, 8425, 8426, 8427,
+    8428, 8429, 8430, 8430, 8431, 8432, 8434, 8434, 8434, 8435, 8436, 8437, 8438, 8440, 8441, 8442,
+    8443, 8444, 8445, 8447, 8450, 8450, 8456, 8458, 8461, 8462, 8463, 8464, 8466, 8467, 8468, 8469,
+    8470, 8471, 8472, 8473, 8474, 8475, 8476, 8477, 8478, 8479, 8480, 8481, 8482, 8488, 8489, 8490,
+    8491, 8492, 8493, 8494, 8495, 8496, 8497, 8498, 8499, 8500, 8502, 8503, 8504, 8505, 8506, 8507,
+    8508, 8509, 8510, 8511, 8512, 8514, 8518, 8519, 8520, 8521, 8522, 8523, 8524, 8525, 8526, 8527,
+    8528, 8529, 8530, 8531, 8532, 8533, 8535, 8535, 8536, 8537, 8538, 8540, 8541, 8542, 8543, 8544,
+    8545, 8545, 8546, 8547, 8548, 8549, 8550, 8551, 8553, 8560, 8561, 8562, 8563, 8564, 8565, 8565,
+    8566, 8567, 8568, 8570, 8572, 8573, 8574, 8575, 8577, 8578, 8578, 8579, 8580, 8581, 8582, 8583,
+    8584, 8585, 8586, 8587, 8593, 8594, 8596, 8597, 8601, 8602, 8603, 8604, 8605, 8606, 8607, 8607,
+    8609, 8612, 8613, 8614, 8615, 8617, 8619, 8620, 8621, 8622, 8623, 8624, 8626, 8628, 8629, 8630,
+    8631, 8632, 8633, 8634, 8635, 8636, 8638, 8639, 8640, 8641, 8642, 8643, 8644, 8645, 8646, 8646,
+    8647, 8648, 8649, 8650, 8651, 8652, 8653, 8654, 8655, 8656, 8657, 8658, 8659, 8660, 8661, 8662,
+    8663, 8664, 8665, 8666, 8667, 8668, 8670, 8672, 8674, 8675, 8677, 8678, 8679, 8680, 8681, 8681,
+    8682, 8683, 8683, 8684, 8684, 8685, 8686, 8687, 8688, 8689, 8690, 8691, 8692, 8693, 8694, 8695,
+    8697, 8698, 8700, 8701, 8703, 8703, 8704, 8705, 8706, 8706, 8707, 8708, 8709, 8714, 8715, 8716,
+    8717, 8718, 8719, 8720, 8721, 8722, 8724, 8725, 8726, 8727, 8728, 8729, 8730, 8731, 8732, 8733,
+    8734, 8735, 8736, 8737, 8738, 8739, 8740, 8741, 8742, 8744, 8745, 8746, 8747, 8748, 8749, 8750,
+    8751, 8752, 8753, 8754, 8755, 8756, 8757, 8758, 8759, 8760, 8761, 8762, 8765, 8766, 8767, 8768,
+    8769, 8770, 8771, 8772, 8773, 8774, 8775, 8776, 8777, 8778, 8779, 8780, 8781, 8782, 8783, 8784,
+    8785, 8786, 8787, 8788, 8789, 8790, 8791, 8792, 8795, 8796, 8797, 8798, 8799, 8800, 8801, 8802,
+    8803, 8806, 8807, 8808, 8809, 8810, 8810, 8810, 8810, 8811, 8812, 8812, 8813, 8813, 8815, 8816,
+    8816, 8817, 8818, 8819, 8820, 8821, 8823, 8824, 8825, 8826, 8827, 8828, 8829, 8830, 8831, 8832,
+    8832, 8833, 8834, 8835, 8836, 8837, 8838, 8839, 8840, 8841, 8842, 8843, 8844, 8845, 8846, 8847,
+    8848, 8849, 8850, 8851, 8852, 8853, 8854, 8855, 8856, 8857, 8859, 8860, 8862, 8863, 8864, 8865,
+    8866, 8867, 8868, 8869, 8870, 8871, 8872, 8872, 8873, 8874, 8875, 8876, 8877, 8878, 8879, 8880,
+    8882, 8883, 8884, 8886, 8888, 8889, 8890, 8891, 8892, 8892, 8893, 8893, 8894, 8894, 8894, 8894,
+    8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894, 8894,
+    8895, 8895, 8895, 8895, 8895, 8895, 8895, 8895, 8896, 8896, 8896, 8896, 8896, 8896, 8896, 8896,
+    8896, 8896, 8896, 8896, 8896, 8896, 8896, 8897, 8897, 8897, 8897, 8897, 8897, 8897, 8897, 8897,
+    8897, 8897, 8897, 8897, 8897, 8897, 8897, 8897, 8898, 8898, 8898, 8898, 8898, 8898, 8898, 8898,
+    8898, 8899, 8900, 8900, 8902, 8902, 8903, 8904, 8904, 8904, 8904, 8904, 8904, 8904, 8905, 8905,
+    8905, 8905, 8905, 8905, 8905, 8905, 8905, 8905, 8905, 8905, 8906, 8906, 8906, 8906, 8906, 8907,
+    8907, 8908, 8908, 8908, 8908, 8908, 8908, 8908, 8908, 8908, 8908, 8908, 8908, 8909, 8910, 8910,
+    8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910, 8910,
+    8910, 8910, 8910, 8910, 8911, 8911, 8911, 8911, 8911, 8911, 8911, 8911, 8911, 8912, 8912, 8912,
+    8912, 8912, 8912, 8912, 8913, 8914, 8914, 8914, 8915, 8915, 8915, 8915, 8916, 8918, 8918, 8918,
+    8918, 8918, 8918, 8918, 8920, 8920, 8921, 8921, 8921, 8921, 8921, 8921, 8921, 8921, 8922, 8922,
+    8922, 8922, 8922, 8922, 8922, 8922, 8922, 8923, 8923, 8923, 8923, 8923, 8923, 8923, 8923, 8923,
+    8923, 8923, 8923, 8924, 8924, 8924, 8924, 8924, 8924, 8924, 8924, 8924, 8924, 8924, 8924, 8924,
+    8924, 8924, 8925, 8925, 8926, 8926, 8926, 8927, 8928, 8928, 8928, 8928, 8928, 8929, 8929, 8929,
+    8929, 8929, 8929, 8929, 8929, 8929, 8930, 8930, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931,
+    8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8931, 8932, 8934, 8934,
+    8934, 8934, 8934, 8934, 8935, 8935, 8935, 8935, 8935, 8935, 8935, 8935, 8935, 8935, 8935, 8935,
+    8936, 8937, 8938, 8938, 8938, 8938, 8938, 8939, 8939, 8940, 8940, 8940, 8940, 8940, 8940, 8941,
+    8941, 8941, 8941, 8941, 8941, 8941, 8942, 8942, 8942, 8942, 8942, 8942, 8943, 8943, 8943, 8943,
+    8944, 8944, 8944, 8944, 8944, 8944, 8944, 8944, 8945, 8946, 8946, 8946, 8946, 8946, 8947, 8948,
+    8948, 8948, 8948, 8948, 8948, 8948, 8948, 8948, 8949, 8949, 8949, 8949, 8949, 8949, 8949, 8949,
+    8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950, 8950,
+    8952, 8952, 8952, 8952, 8954, 8955, 8955, 8956, 8957, 8958, 8958, 8958, 8958, 8958, 8959, 8959,
+    8959, 8959, 8959, 8959, 8959, 8959, 8960, 8960, 8960, 8960, 8960, 8960, 8962, 8962, 8962, 8962,
+    8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962, 8962,
+    8962, 8962, 8962, 8962, 8963, 8963, 8963, 8963, 8963, 8963, 8963, 8964, 8964, 8964, 8964, 8964,
+    8964, 8964, 8964, 8964, 8964, 8964, 8964, 8964, 8965, 8965, 8965, 8965, 8965, 8965, 8965, 8965,
+    8965, 8965, 8965, 8965, 8965, 8965, 8965, 8965, 8965, 8965, 8969, 8970, 8970, 8970, 8970, 8970,
+    8970, 8971, 8971, 8971, 8971, 8971, 8971, 8971, 8971, 8972, 8973, 8973, 8973, 8974, 8974, 8974,
+    8974, 8974, 8974, 8974, 8974, 8974, 8974, 8974, 8975, 8975, 8975, 8975, 8975, 8975, 8975, 8975,
+    8975, 8975, 8976, 8976, 8976, 8976, 8976, 8977, 8977, 8978, 8978, 8978, 8978, 8978, 8978, 8978,
+    8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978, 8978,
+    8978, 8978, 8978, 8978, 8978, 8979, 8979, 8979, 8979, 8979, 8979, 8979, 8980, 8981, 8981, 8981,
+    8982, 8983, 8984, 8984, 8985, 8985, 8986, 8987, 8987, 8987, 8987, 8987, 8987, 8987, 8987, 8987,
+    8987, 8987, 8987, 8988, 8988, 8989, 8989, 8989, 8989, 8989, 8989, 8990, 8990, 8990, 8990, 8990,
+    8990, 8990, 8990, 8990, 8990, 8990, 8990, 8990, 8991, 8991, 8991, 8991, 8991, 8992, 8992, 8992,
+    8992, 8993, 8993, 8993, 8993, 8993, 8993, 8994, 8994, 8994, 8994, 8995, 8995, 8995, 8995, 8995,
+    8998, 8999, 8999, 8999, 8999, 8999, 8999, 8999, 9000, 9000, 9000, 9000, 9001, 9003, 9003, 9003,
+    9004, 9004, 9004, 9004, 9004, 9004, 9004, 9004, 9005, 9005, 9005, 9005, 9006, 9006, 9006, 9006,
+    9006, 9007, 9007, 9007, 9008, 9008, 9009, 9009, 9009, 9009, 9009, 9009, 9009, 9009, 9009, 9010,
+    9010, 9010, 9010, 9010, 9011, 9011, 9011, 9011, 9011, 9011, 9011, 9011, 9011, 9011, 9011, 9011,
+    9011, 9013, 9013, 9013, 9013, 9013, 9015, 9016, 9016, 9017, 9017, 9018, 9018, 9019, 9019, 9019,
+    9019, 9021, 9021, 9021, 9021, 9021, 9021, 9022, 9022, 9022, 9022, 9022, 9023, 9023, 9023, 9023,
+    9024, 9024, 9024, 9024, 9024, 9024, 9024, 9025, 9025, 9025, 9025, 9025, 9025, 9026, 9027, 9028,
+    9028, 9028, 9028, 9028, 9028, 9028, 9028, 9029, 9029, 9029, 9029, 9029, 9029, 9029, 9029, 9029,
+    9029, 9030, 9030, 9030, 9030, 9030, 9031, 9031, 9032, 9032, 9032, 9032, 9033, 9033, 9033, 9033,
+    9033, 9034, 9034, 9034, 9034, 9034, 9034, 9034, 9034, 9034, 9035, 9035, 9036, 9036, 9036, 9036,
+    9038, 9038, 9038, 9039, 9039, 9039, 9039, 9039, 9039, 9039, 9040, 9040, 9041, 9041, 9041, 9041,
+    9041, 9041, 9041, 9041, 9041, 9041, 9042, 9042, 9043, 9043, 9044, 9044, 9045, 9046, 9046, 9046,
+    9046, 9047, 9047, 9047, 9047, 9047, 9047, 9047, 9047, 9048, 9048, 9048, 9049, 9049, 9049, 9049,
+    9049, 9050, 9051, 9051, 9051, 9052, 9052, 9052, 9052, 9052, 9052, 9052, 9053, 9054, 9054, 9054,
+    9055, 9055, 9055, 9056, 9056, 9056, 9057, 9057, 9057, 9057, 9057, 9058, 9059, 9059, 9059, 9059,
+    9059, 9059, 9059, 9059, 9059, 9059, 9060, 9061, 9061, 9061, 9061, 9061, 9062, 9062, 9063, 9063,
+    9063, 9063, 9063, 9063, 9063, 9063, 9064, 9064, 9065, 9066, 9066, 9066, 9066, 9066, 9066, 9066,
+    9066, 9066, 9067, 9067, 9067, 9067, 9068, 9068, 9068, 9068, 9068, 9068, 9068, 9068, 9069, 9069,
+    9069, 9069, 9069, 9070, 9070, 9070, 9070, 9071, 9071, 9071, 9071, 9072, 9072, 9072, 9073, 9074,
+    9074, 9074, 9074, 9074, 9074, 9074, 9074, 9074, 9074, 9075, 9075, 9075, 9075, 9075, 9076, 9076,
+    9076, 9076, 9076, 9077, 9078, 9079, 9079, 9079, 9079, 9079, 9080, 9080, 9080, 9080, 9080, 9081,
+    9081, 9082, 9083, 9083, 9083, 9083, 9083, 9083, 9083, 9083, 9086, 9086, 9087, 9087, 9087, 9087,
+    9087, 9087, 9087, 9087, 9087, 9087, 9087, 9087, 9087, 9087, 9088, 9088, 9089, 9091, 9091, 9091,
+    9091, 9091, 9091, 9091, 9091, 9092, 9092, 9092, 9092, 9093, 9093, 9093, 9093, 9093, 9093, 9094,
+    9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094, 9094,
+    9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095, 9095,
+    9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096,
+    9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9096, 9098, 9098, 9098, 9098, 9098, 9099,
+    9099, 9099, 9099, 9099, 9100, 9100, 9100, 9100, 9100, 9101, 9101, 9101, 9101, 9101, 9101, 9101,
+    9101, 9101, 9101, 9102, 9102, 9102, 9102, 9103, 9104, 9104, 9104, 9105, 9105, 9105, 9105, 9105,
+    9105, 9105, 9105, 9105, 9105, 9105, 9105, 9105, 9105, 9105, 9106, 9107, 9107, 9108, 9109, 9109,
+    9109, 9109, 9109, 9109, 9109, 9109, 9109, 9109, 9110, 9112, 9112, 9113, 9113, 9113, 9114, 9115,
+    9115, 9115, 9115, 9116, 9117, 9117, 9117, 9117, 9117, 9117, 9118, 9119, 9121, 9121, 9122, 9123,
+    9123, 9123, 9123, 9123, 9124, 9124, 9124, 9124, 9125, 9125, 9125, 9125, 9125, 9125, 9125, 9125,
+    9125, 9125, 9125, 9126, 9126, 9126, 9126, 9126, 9126, 9126, 9126, 9126, 9126, 9126, 9126, 9126,
+    9126, 9126, 9126, 9127, 9127, 9127, 9127, 9128, 9128, 9128, 9128, 9129, 9130, 9130, 9130, 9130,
+    9130, 9130, 9131, 9131, 9132, 9132, 9132, 9133, 9134, 9134, 9134, 9134, 9135, 9135, 9135, 9135,
+    9135, 9135, 9136, 9136, 9136, 9137, 9137, 9137, 9137, 9137, 9137, 9137, 9137, 9137, 9137, 9137,
+    9137, 9137, 9137, 9137, 9137, 9137, 9138, 9138, 9139, 9139, 9139, 9139, 9140, 9140, 9140, 9141,
+    9142, 9142, 9142, 9142, 9142, 9142, 9143, 9144, 9145, 9146, 9147, 9148, 9148, 9149, 9150, 9151,
+    9152, 9153, 9154, 9155, 9156, 9157, 9158, 9159, 9160, 9161, 9162, 9163, 9164, 9165, 9166, 9168,
+    9169, 9169, 9170, 9171, 9172, 9173, 9174, 9177, 9178, 9179, 9179, 9180, 9181, 9182, 9183, 9183,
+    9185, 9186, 9187, 9188, 9189, 9190, 9191, 9192, 9193, 9194, 9196, 9198, 9199, 9200, 9201, 9202,
+    9203, 9204, 9206, 9207, 9208, 9209, 9210, 9211, 9212, 9213, 9214, 9215, 9215, 9216, 9217, 9218,
+    9219, 9220, 9221, 9222, 9223, 9224, 9225, 9226, 9227, 9228, 9229, 9230, 9231, 9232, 9233, 9234,
+    9235, 9236, 9237, 9238, 9239, 9240, 9241, 9242, 9243, 9244, 9246, 9247, 9248, 9248, 9249, 9250,
+    9251, 9252, 9253, 9253, 9253, 9254, 9255, 9255, 9256, 9257, 9258, 9259, 9260, 9261, 9262, 9264,
+    9265, 9267, 9268, 9269, 9270, 9271, 9272, 9273, 9274, 9275, 9276, 9277, 9278, 9279, 9280, 9281,
+    9282, 9284, 9285, 9286, 9287, 9288, 9289, 9290, 9291, 9292, 9293, 9294, 9295, 9297, 9298, 9299,
+    9300, 9301, 9302, 9303, 9304, 9305, 9307, 9308, 9310, 9311, 9312, 9313, 9314, 9316, 9317, 9318,
+    9319, 9320, 9321, 9322, 9323, 9324, 9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332, 9332, 9333,
+    9334, 9335, 9336, 9337, 9338, 9339, 9340, 9341, 9342, 9344, 9345, 9346, 9347, 9348, 9349, 9350,
+    9351, 9352, 9353, 9354, 9355, 9356, 9358, 9359, 9359, 9360, 9361, 9362, 9364, 9365, 9366, 9367,
+    9368, 9369, 9370, 9371, 9372, 9373, 9374, 9374, 9375, 9376, 9377, 9378, 9380, 9381, 9382, 9383,
+    9384, 9385, 9389, 9390, 9391, 9392, 9393, 9394, 9395, 9396, 9397, 9398, 9399, 9400, 9401, 9402,
+    9403, 9404, 9405, 9406, 9407, 9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415, 9416, 9417, 9419,
+    9420, 9421, 9422, 9424, 9425, 9426, 9427, 9428, 9429, 9431, 9432, 9433, 9434, 9435, 9437, 9438,
+    9439, 9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448, 9449, 9450, 9451, 9452, 9452, 9453, 9454,
+    9455, 9456, 9458, 9459, 9460, 9461, 9462, 9463, 9464, 9465, 9466, 9467, 9467, 9468, 9469, 9470,
+    9471, 9472, 9473, 9474, 9475, 9477, 9478, 9478, 9479, 9480, 9481, 9482, 9483, 9484, 9485, 9486,
+    9487, 9488, 9489, 9490, 9491, 9493, 9494, 9495, 9496, 9498, 9499, 9499, 9500, 9501, 9502, 9503,
+    9504, 9505, 9508, 9509, 9510, 9511, 9512, 9513, 9514, 9515, 9516, 9517, 9518, 9519, 9520, 9521,
+    9522, 9523, 9524, 9525, 9526, 9527, 9528, 9529, 9530, 9531, 9532, 9533, 9534, 9535, 9536, 9537,
+    9538, 9539, 9539, 9540, 9541, 9542, 9543, 9544, 9546, 9548, 9549, 9550, 9551, 9552, 9553, 9554,
+    9555, 9556, 9557, 9558, 9559, 9560, 9561, 9562, 9563, 9564, 9565, 9566, 9567, 9568, 9569, 9570,
+    9571, 9572, 9573, 9574, 9575, 9576, 9577, 9578, 9579, 9579, 9580, 9581, 9582, 9583, 9584, 9585,
+    9586, 9587, 9588, 9589, 9590, 9591, 9592, 9593, 9594, 9595, 9595, 9597, 9598, 9599, 9600, 9604,
+    9605, 9606, 9607, 9608, 9609, 9610, 9612, 9613, 9615, 9616, 9617, 9618, 9619, 9619, 9620, 9621,
+    9622, 9623, 9624, 9625, 9626, 9627, 9629, 9631, 9632, 9633, 9634, 9635, 9636, 9637, 9640, 9640,
+    9641, 9642, 9643, 9644, 9645, 9646, 9647, 9648, 9649, 9650, 9651, 9652, 9653, 9654, 9655, 9656,
+    9657, 9658, 9659, 9660, 9661, 9662, 9663, 9664, 9665, 9666, 9667, 9668, 9669, 9670, 9671, 9672,
+    9673, 9674, 9675, 9676, 9677, 9678, 9679, 9680, 9681, 9682, 9683, 9684, 9685, 9686, 9687, 9687,
+    9688, 9691, 9692, 9693, 9694, 9695, 9696, 9697, 9698, 9699, 9700, 9701, 9702, 9703, 9704, 9706,
+    9710, 9711, 9711, 9712, 9713, 9714, 9714, 9716, 9717, 9719, 9720, 9723, 9724, 9725, 9726, 9728,
+    9729, 9730, 9731, 9732, 9733, 9734, 9735, 9736, 9737, 9738, 9739, 9740, 9741, 9742, 9744, 9747,
+    9750, 9751, 9752, 9753, 9754, 9755, 9756, 9757, 9758, 9759, 9760, 9761, 9762, 9763, 9764, 9765,
+    9766, 9768, 9769, 9770, 9771, 9772, 9773, 9774, 9776, 9777, 9778, 9779, 9780, 9781, 9782, 9784,
+    9785, 9786, 9788, 9789, 9791, 9793, 9794, 9795, 9797, 9798, 9799, 9800, 9801, 9802, 9805, 9806,
+    9811, 9812, 9813, 9814, 9815, 9816, 9817, 9818, 9819, 9820, 9821, 9822, 9823, 9824, 9825, 9826,
+    9827, 9828, 9829, 9830, 9831, 9832, 9833, 9834, 9834, 9835, 9836, 9837, 9838, 9839, 9840, 9841,
+    9842, 9843, 9844, 9845, 9846, 9847, 9848, 9849, 9850, 9851, 9854, 9855, 9856, 9857, 9859, 9860,
+    9861, 9862, 9863, 9864, 9865, 9866, 9867, 9868, 9869, 9870, 9871, 9872, 9873, 9874, 9876, 9878,
+    9879, 9880, 9881, 9882, 9883, 9884, 9886, 9887, 9888, 9890, 9891, 9892, 9893, 9893, 9894, 9895,
+    9896, 9898, 9899, 9900, 9901, 9902, 9903, 9904, 9905, 9906, 9908, 9909, 9910, 9911, 9912, 9913,
+    9914, 9915, 9916, 9917, 9918, 9919, 9920, 9922, 9923, 9924, 9925, 9926, 9927, 9928, 9929, 9931,
+    9932, 9933, 9933, 9934, 9935, 9936, 9937, 9938, 9939, 9940, 9941, 9942, 9943, 9944, 9945, 9946,
+    9947, 9948, 9949, 9950, 9951, 9952, 9953, 9954, 9955, 9957, 9958, 9960, 9961, 9962, 9963, 9964,
+    9965, 9966, 9967, 9968, 9969, 9970, 9971, 9972, 9973, 9974, 9975, 9976, 9977, 9978, 9978, 9979,
+    9980, 9981, 9982, 9983, 9984, 9985, 9986, 9987, 9988, 9989, 9990, 9991, 9992, 9993, 9994, 9995,
+    9996, 9997, 9998, 10002, 10003, 10004, 10005, 10006, 10007, 10008, 10009, 10010, 10011, 10012, 10013, 10014,
+    10015, 10015, 10016, 10017, 10018, 10019, 10020, 10020, 10021, 10022, 10023, 10024, 10025, 10026, 10027, 10028,
+    10029, 10030, 10031, 10032, 10033, 10034, 10035, 10036, 10038, 10039, 10040, 10041, 10042, 10043, 10044, 10045,
+    10046, 10047, 10048, 10049, 10050, 10051, 10052, 10053, 10054, 10055, 10056, 10057, 10058, 10059, 10060, 10061,
+    10062, 10063, 10064, 10065, 10066, 10067, 10068, 10069, 10070, 10071, 10072, 10073, 10074, 10074, 10074, 10074,
+    10074, 10074, 10075, 10075, 10076, 10076, 10076, 10076, 10076, 10076, 10076, 10077, 10077, 10077, 10077, 10077,
+    10077, 10077, 10077, 10077, 10077, 10077, 10077, 10077, 10078, 10078, 10079, 10079, 10079, 10079, 10079, 10079,
+    10079, 10079, 10079, 10079, 10079, 10080, 10080, 10080, 10081, 10081, 10081, 10081, 10081, 10081, 10081, 10081,
+    10081, 10081, 10081, 10082, 10082, 10082, 10082, 10082, 10082, 10082, 10082, 10082, 10082, 10082, 10082, 10082,
+    10082, 10082, 10082, 10082, 10082, 10082, 10082, 10083, 10084, 10084, 10084, 10084, 10084, 10084, 10084, 10084,
+    10084, 10084, 10084, 10085, 10086, 10086, 10087, 10087, 10087, 10087, 10087, 10087, 10087, 10087, 10087, 10087,
+    10087, 10087, 10087, 10088, 10088, 10088, 10088, 10088, 10088, 10088, 10088, 10088, 10088, 10088, 10090, 10090,
+    10090, 10091, 10092, 10092, 10092, 10092, 10092, 10092, 10092, 10092, 10093, 10093, 10093, 10093, 10093, 10094,
+    10094, 10095, 10095, 10095, 10096, 10097, 10098, 10098, 10098, 10098, 10099, 10100, 10100, 10100, 10100, 10100,
+    10100, 10100, 10100, 10100, 10100, 10100, 10100, 10100, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101,
+    10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10101, 10102, 10102, 10102,
+    10102, 10102, 10102, 10102, 10102, 10102, 10102, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103,
+    10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103, 10103,
+    10104, 10104, 10104, 10104, 10104, 10104, 10104, 10104, 10104, 10104, 10104, 10105, 10105, 10105, 10105, 10105,
+    10105, 10105, 10105, 10105, 10105, 10105, 10105, 10105, 10105, 10105, 10106, 10106, 10106, 10106, 10107, 10107,
+    10107, 10107, 10107, 10107, 10107, 10107, 10107, 10109, 10110, 10111, 10113, 10114, 10115, 10116, 10117, 10118,
+    10119, 10120, 10121, 10122, 10123, 10124, 10125, 10126, 10128, 10129, 10130, 10131, 10133, 10134, 10135, 10136,
+    10137, 10138, 10139, 10140, 10141, 10142, 10143, 10144, 10145, 10147, 10148, 10149, 10150, 10152, 10153, 10154,
+    10155, 10156, 10157, 10158, 10159, 10160, 10162, 10163, 10164, 10165, 10166, 10167, 10168, 10169, 10170, 10171,
+    10172, 10173, 10174, 10175, 10176, 10177, 10178, 10179, 10180, 10181, 10182, 10183, 10184, 10185, 10186, 10186,
+    10187, 10188, 10189, 10190, 10191, 10192, 10193, 10194, 10195, 10196, 10197, 10199, 10201, 10203, 10204, 10205,
+    10206, 10207, 10208, 10209, 10210, 10211, 10212, 10213, 10214, 10215, 10217, 10219, 10220, 10221, 10222, 10223,
+    10224, 10225, 10226, 10227, 10229, 10230, 10231, 10232, 10233, 10234, 10235, 10236, 10237, 10238, 10239, 10240,
+    10241, 10242, 10243, 10244, 10245, 10246, 10247, 10247, 10248, 10249, 10250, 10251, 10252, 10253, 10254, 10256,
+    10256, 10257, 10258, 10259, 10260, 10261, 10262, 10263, 10264, 10265, 10266, 10267, 10268, 10269, 10270, 10271,
+    10272, 10273, 10274, 10275, 10275, 10276, 10277, 10278, 10279, 10280, 10281, 10282, 10283, 10284, 10285, 10286,
+    10287, 10288, 10289, 10290, 10291, 10292, 10293, 10294, 10295, 10296, 10297, 10298, 10299, 10300, 10301, 10302,
+    10303, 10304, 10305, 10306, 10307, 10307, 10308, 10309, 10310, 10310, 10311, 10312, 10313, 10313, 10314, 10315,
+    10316, 10317, 10318, 10319, 10321, 10322, 10323, 10324, 10325, 10326, 10326, 10328, 10329, 10330, 10331, 10332,
+    10333, 10334, 10335, 10336, 10337, 10338, 10339, 10340, 10341, 10341, 10341, 10342, 10343, 10344, 10345, 10346,
+    10347, 10348, 10349, 10351, 10352, 10353, 10354, 10355, 10356, 10357, 10357, 10358, 10359, 10360, 10361, 10362,
+    10363, 10364, 10365, 10366, 10367, 10368, 10369, 10370, 10371, 10372, 10373, 10375, 10376, 10378, 10378, 10379,
+    10380, 10381, 10382, 10383, 10384, 10385, 10387, 10388, 10389, 10390, 10391, 10392, 10393, 10394, 10395, 10396,
+    10397, 10399, 10400, 10401, 10402, 10403, 10404, 10405, 10406, 10408, 10409, 10410, 10411, 10412, 10413, 10414,
+    10415, 10416, 10417, 10418, 10419, 10420, 10420, 10421, 10423, 10424, 10425, 10426, 10427, 10428, 10429, 10430,
+    10431, 10432, 10433, 10434, 10435, 10436, 10437, 10438, 10439, 10440, 10441, 10442, 10443, 10443, 10444, 10445,
+    10446, 10447, 10448, 10449, 10450, 10451, 10452, 10453, 10455, 10456, 10456, 10457, 10458, 10459, 10460, 10461,
+    10462, 10463, 10464, 10465, 10466, 10467, 10468, 10469, 10470, 10471, 10472, 10473, 10474, 10475, 10476, 10477,
+    10478, 10479, 10480, 10481, 10482, 10484, 10485, 10486, 10487, 10488, 10489, 10490, 10491, 10492, 10493, 10494,
+    10495, 10496, 10497, 10498, 10499, 10500, 10501, 10502, 10503, 10504, 10505, 10506, 10507, 10508, 10509, 10510,
+    10511, 10512, 10513, 10516, 10517, 10518, 10519, 10520, 10521, 10522, 10523, 10524, 10525, 10526, 10527, 10528,
+    10529, 10530, 10531, 10532, 10533, 10534, 10535, 10535, 10536, 10537, 10538, 10539, 10540, 10541, 10541, 10542,
+    10542, 10543, 10544, 10545, 10546, 10547, 10548, 10549, 10550, 10551, 10552, 10553, 10554, 10555, 10556, 10557,
+    10558, 10559, 10560, 10561, 10562, 10563, 10564, 10565, 10566, 10567, 10568, 10569, 10570, 10571, 10573, 10575,
+    10576, 10578, 10579, 10580, 10582, 10583, 10584, 10585, 10586, 10587, 10588, 10588, 10589, 10590, 10591, 10592,
+    10594, 10595, 10596, 10597, 10598, 10599, 10600, 10601, 10602, 10603, 10604, 10605, 10606, 10607, 10609, 10610,
+    10611, 10612, 10613, 10614, 10615, 10616, 10617, 10618, 10619, 10620, 10621, 10622, 10623, 10624, 10625, 10626,
+    10627, 10628, 10629, 10630, 10631, 10632, 10633, 10634, 10635, 10636, 10637, 10638, 10639, 10640, 10641, 10642,
+    10643, 10644, 10645, 10646, 10647, 10648, 10649, 10650, 10651, 10652, 10653, 10654, 10655, 10656, 10657, 10658,
+    10659, 10660, 10661, 10662, 10663, 10664, 10665, 10666, 10667, 10668, 10669, 10670, 10671, 10672, 10673, 10674,
+    10675, 10676, 10677, 10678, 10679, 10680, 10682, 10683, 10684, 10685, 10686, 10687, 10689, 10690, 10691, 10692,
+    10693, 10695, 10696, 10697, 10698, 10699, 10700, 10701, 10702, 10703, 10704, 10705, 10706, 10708, 10709, 10710,
+    10711, 10712, 10713, 10714, 10715, 10716, 10717, 10718, 10719, 10720, 10722, 10723, 10724, 10725, 10726, 10727,
+    10728, 10729, 10730, 10731, 10731, 10732, 10733, 10734, 10735, 10736, 10737, 10738, 10739, 10740, 10741, 10742,
+    10743, 10744, 10745, 10746, 10747, 10748, 10749, 10750, 10751, 10752, 10753, 10754, 10755, 10756, 10757, 10758,
+    10759, 10760, 10762, 10763, 10764, 10765, 10766, 10767, 10770, 10771, 10772, 10773, 10774, 10775, 10776, 10777,
+    10778, 10779, 10780, 10785, 10786, 10787, 10788, 10789, 10790, 10791, 10792, 10793, 10795, 10796, 10797, 10798,
+    10799, 10801, 10803, 10805, 10806, 10807, 10808, 10809, 10810, 10811, 10812, 10813, 10814, 10815, 10816, 10817,
+    10818, 10819, 10820, 10821, 10822, 10823, 10824, 10825, 10826, 10827, 10828, 10829, 10830, 10831, 10832, 10832,
+    10833, 10834, 10835, 10836, 10836, 10837, 10839, 10840, 10841, 10842, 10843, 10844, 10844, 10845, 10846, 10847,
+    10848, 10849, 10850, 10851, 10852, 10853, 10854, 10855, 10856, 10857, 10858, 10859, 10860, 10861, 10862, 10863,
+    10865, 10866, 10867, 10868, 10869, 10870, 10871, 10872, 10873, 10874, 10876, 10877, 10878, 10879, 10880, 10881,
+    10882, 10883, 10884, 10885, 10886, 10887, 10888, 10889, 10890, 10890, 10891, 10892, 10893, 10894, 10895, 10896,
+    10897, 10898, 10899, 10900, 10901, 10902, 10903, 10903, 10904, 10905, 10906, 10907, 10908, 10910, 10911, 10912,
+    10913, 10914, 10915, 10916, 10917, 10918, 10919, 10920, 10922, 10925, 10926, 10928, 10929, 10930, 10931, 10932,
+    10933, 10934, 10935, 10936, 10937, 10938, 10939, 10940, 10941, 10942, 10943, 10945, 10946, 10947, 10948, 10949,
+    10950, 10951, 10952, 10953, 10954, 10955, 10956, 10958, 10959, 10960, 10961, 10962, 10963, 10964, 10964, 10965,
+    10966, 10967, 10968, 10969, 10970, 10971, 10972, 10973, 10974, 10976, 10977, 10978, 10979, 10980, 10981, 10982,
+    10983, 10984, 10985, 10986, 10987, 10988, 10989, 10990, 10991, 10992, 10993, 10994, 10995, 10996, 10997, 10998,
+    10999, 11000, 11001, 11002, 11003, 11004, 11004, 11005, 11007, 11008, 11010, 11011, 11011, 11012, 11013, 11014,
+    11015, 11016, 11017, 11018, 11019, 11020, 11021, 11022, 11023, 11024, 11024, 11025, 11025, 11026, 11028, 11029,
+    11030, 11031, 11032, 11033, 11034, 11035, 11036, 11037, 11038, 11039, 11041, 11042, 11044, 11045, 11046, 11047,
+    11048, 11049, 11050, 11051, 11052, 11054, 11055, 11056, 11057, 11059, 11060, 11061, 11062, 11063, 11064, 11065,
+    11066, 11067, 11068, 11069, 11070, 11071, 11072, 11073, 11074, 11075, 11076, 11076, 11076, 11076, 11076, 11077,
+    11078, 11078, 11079, 11079, 11079, 11079, 11079, 11079, 11079, 11080, 11080, 11080, 11080, 11081, 11081, 11081,
+    11081, 11081, 11081, 11081, 11081, 11081, 11081, 11081, 11081, 11081, 11081, 11082, 11083, 11084, 11085, 11087,
+    11088, 11089, 11090, 11091, 11092, 11093, 11094, 11095, 11096, 11098, 11099, 11100, 11101, 11102, 11103, 11106,
+    11107, 11108, 11109, 11110, 11111, 11112, 11113, 11114, 11116, 11117, 11118, 11119, 11120, 11121, 11123, 11124,
+    11125, 11126, 11128, 11130, 11131, 11132, 11133, 11134, 11135, 11136, 11137, 11138, 11139, 11141, 11142, 11143,
+    11144, 11144, 11145, 11146, 11147, 11148, 11151, 11152, 11153, 11154, 11155, 11156, 11157, 11158, 11159, 11160,
+    11161, 11162, 11163, 11164, 11165, 11166, 11167, 11168, 11169, 11171, 11172, 11172, 11173, 11174, 11175, 11176,
+    11178, 11179, 11180, 11181, 11182, 11183, 11183, 11184, 11185, 11186, 11187, 11188, 11189, 11190, 11191, 11192,
+    11194, 11195, 11195, 11196, 11197, 11198, 11199, 11200, 11200, 11201, 11201, 11202, 11203, 11203, 11204, 11205,
+    11205, 11206, 11208, 11209, 11209, 11210, 11211, 11212, 11213, 11214, 11216, 11217, 11218, 11219, 11220, 11221,
+    11222, 11223, 11224, 11225, 11226, 11227, 11227, 11228, 11229, 11230, 11231, 11232, 11233, 11235, 11236, 11236,
+    11237, 11238, 11239, 11240, 11241, 11242, 11243, 11244, 11245, 11246, 11248, 11249, 11250, 11251, 11252, 11253,
+    11254, 11255, 11256, 11257, 11258, 11259, 11260, 11261, 11262, 11263, 11264, 11265, 11266, 11267, 11268, 11269,
+    11270, 11271, 11272, 11273, 11274, 11275, 11276, 11277, 11278, 11279, 11280, 11281, 11282, 11283, 11284, 11285,
+    11286, 11287, 11288, 11289, 11290, 11291, 11292, 11293, 11294, 11295, 11296, 11297, 11298, 11299, 11300, 11301,
+    11302, 11303, 11304, 11305, 11306, 11307, 11309, 11311, 11312, 11313, 11314, 11315, 11316, 11317, 11320, 11321,
+    11322, 11323, 11324, 11326, 11328, 11329, 11330, 11331, 11332, 11333, 11334, 11335, 11337, 11337, 11338, 11339,
+    11340, 11342, 11343, 11344, 11345, 11346, 11347, 11348, 11348, 11349, 11350, 11351, 11352, 11353, 11354, 11355,
+    11356, 11357, 11358, 11360, 11361, 11362, 11363, 11364, 11365, 11366, 11367, 11368, 11369, 11370, 11371, 11372,
+    11373, 11374, 11375, 11376, 11377, 11378, 11379, 11380, 11380, 11381, 11382, 11383, 11384, 11385, 11386, 11387,
+    11388, 11389, 11390, 11391, 11392, 11393, 11394, 11394, 11395, 11396, 11397, 11398, 11399, 11400, 11401, 11402,
+    11403, 11404, 11405, 11406, 11407, 11408, 11409, 11410, 11411, 11412, 11413, 11414, 11415, 11416, 11417, 11418,
+    11419, 11420, 11421, 11422, 11423, 11424, 11425, 11427, 11428, 11429, 11429, 11430, 11431, 11432, 11433, 11434,
+    11435, 11436, 11437, 11438, 11439, 11440, 11440, 11441, 11443, 11444, 11445, 11446, 11447, 11448, 11449, 11449,
+    11450, 11451, 11453, 11454, 11455, 11456, 11457, 11458, 11459, 11460, 11461, 11462, 11463, 11464, 11465, 11466,
+    11467, 11468, 11469, 11470, 11471, 11472, 11473, 11474, 11475, 11476, 11478, 11479, 11480, 11481, 11482, 11483,
+    11484, 11484, 11485, 11486, 11486, 11487, 11488, 11490, 11491, 11492, 11493, 11494, 11497, 11498, 11499, 11500,
+    11501, 11502, 11502, 11504, 11505, 11506, 11508, 11509, 11510, 11511, 11512, 11513, 11514, 11515, 11516, 11517,
+    11518, 11519, 11520, 11521, 11522, 11523, 11524, 11526, 11526, 11527, 11528, 11529, 11530, 11531, 11532, 11533,
+    11534, 11535, 11536, 11537, 11538, 11539, 11540, 11541, 11542, 11543, 11544, 11545, 11545, 11546, 11547, 11549,
+    11550, 11551, 11552, 11553, 11554, 11555, 11556, 11557, 11558, 11559, 11560, 11561, 11561, 11562, 11564, 11565,
+    11566, 11567, 11568, 11569, 11570, 11571, 11572, 11573, 11574, 11575, 11576, 11577, 11578, 11579, 11580, 11581,
+    11582, 11583, 11584, 11585, 11585, 11586, 11587, 11588, 11590, 11591, 11592, 11593, 11594, 11594, 11595, 11597,
+    11598, 11599, 11600, 11602, 11603, 11604, 11604, 11605, 11607, 11608, 11609, 11610, 11611, 11612, 11613, 11614,
+    11616, 11617, 11619, 11619, 11620, 11620, 11621, 11622, 11623, 11624, 11625, 11626, 11627, 11627, 11628, 11629,
+    11630, 11631, 11632, 11633, 11634, 11635, 11636, 11637, 11638, 11639, 11640, 11641, 11642, 11643, 11644, 11645,
+    11646, 11647, 11648, 11651, 11652, 11653, 11654, 11655, 11656, 11658, 11659, 11660, 11661, 11662, 11663, 11664,
+    11664, 11665, 11666, 11667, 11668, 11669, 11671, 11674, 11675, 11676, 11677, 11678, 11679, 11680, 11681, 11682,
+    11683, 11685, 11686, 11687, 11688, 11690, 11691, 11692, 11693, 11694, 11695, 11696, 11697, 11698, 11699, 11700,
+    11701, 11702, 11703, 11705, 11706, 11707, 11708, 11709, 11711, 11712, 11714, 11716, 11717, 11718, 11719, 11721,
+    11722, 11722, 11723, 11724, 11725, 11726, 11727, 11728, 11729, 11730, 11731, 11734, 11735, 11735, 11736, 11737,
+    11738, 11738, 11739, 11740, 11741, 11742, 11743, 11744, 11745, 11746, 11747, 11748, 11749, 11750, 11751, 11752,
+    11753, 11756, 11757, 11758, 11760, 11761, 11762, 11763, 11764, 11765, 11766, 11767, 11768, 11770, 11771, 11772,
+    11773, 11775, 11776, 11778, 11779, 11780, 11781, 11783, 11784, 11785, 11787, 11788, 11789, 11790, 11792, 11793,
+    11794, 11795, 11796, 11796, 11797, 11797, 11798, 11799, 11800, 11802, 11803, 11804, 11806, 11808, 11809, 11810,
+    11811, 11812, 11813, 11814, 11815, 11816, 11817, 11818, 11819, 11820, 11822, 11823, 11824, 11824, 11825, 11826,
+    11827, 11828, 11829, 11830, 11832, 11833, 11834, 11834, 11835, 11836, 11838, 11839, 11840, 11841, 11842, 11843,
+    11846, 11847, 11848, 11849, 11850, 11850, 11850, 11851, 11852, 11853, 11854, 11855, 11856, 11858, 11858, 11860,
+    11861, 11862, 11863, 11864, 11865, 11866, 11867, 11868, 11869, 11870, 11871, 11872, 11873, 11874, 11875, 11876,
+    11877, 11878, 11879, 11880, 11881, 11882, 11883, 11884, 11885, 11886, 11887, 11887, 11888, 11889, 11890, 11891,
+    11892, 11893, 11894, 11895, 11896, 11897, 11898, 11899, 11900, 11901, 11902, 11902, 11903, 11904, 11905, 11906,
+    11907, 11908, 11909, 11909, 11910, 11911, 11912, 11913, 11914, 11915, 11916, 11917, 11918, 11918, 11919, 11920,
+    11920, 11921, 11923, 11924, 11925, 11926, 11927, 11928, 11929, 11929, 11930, 11931, 11932, 11933, 11934, 11935,
+    11937, 11938, 11939, 11940, 11941, 11942, 11943, 11944, 11945, 11946, 11947, 11948, 11949, 11950, 11951, 11952,
+    11953, 11954, 11956, 11957, 11958, 11959, 11961, 11962, 11963, 11964, 11965, 11966, 11967, 11968, 11969, 11969,
+    11970, 11971, 11972, 11973, 11976, 11977, 11978, 11979, 11981, 11982, 11983, 11984, 11985, 11986, 11987, 11987,
+    11988, 11989, 11990, 11990, 11991, 11992, 11993, 11994, 11995, 11996, 11997, 11998, 11999, 12000, 12001, 12002,
+    12004, 12005, 12006, 12006, 12006, 12007, 12008, 12009, 12010, 12012, 12013, 12014, 12015, 12016, 12018, 12020,
+    12021, 12021, 12022, 12023, 12024, 12025, 12026, 12027, 12028, 12029, 12029, 12030, 12031, 12032, 12033, 12033,
+    12034, 12034, 12035, 12035, 12036, 12037, 12038, 12038, 12039, 12040, 12041, 12041, 12042, 12043, 12044, 12046,
+    12047, 12048, 12049, 12049, 12050, 12051, 12052, 12053, 12054, 12054, 12055, 12056, 12057, 12058, 12059, 12060,
+    12062, 12063, 12064, 12065, 12066, 12067, 12068, 12069, 12070, 12071, 12072, 12073, 12074, 12075, 12075, 12076,
+    12076, 12077, 12078, 12079, 12080, 12080, 12080, 12080, 12080, 12080, 12080, 12081, 12081, 12082, 12082, 12083,
+    12084, 12085, 12086, 12086, 12086, 12087, 12088, 12089, 12090, 12091, 12092, 12094, 12096, 12097, 12098, 12099,
+    12099, 12100, 12101, 12102, 12105, 12106, 12107, 12108, 12108, 12109, 12110, 12111, 12112, 12113, 12114, 12115,
+    12116, 12118, 12119, 12121, 12124, 12125, 12126, 12126, 12127, 12128, 12129, 12130, 12131, 12133, 12134, 12136,
+    12138, 12139, 12140, 12141, 12142, 12143, 12144, 12145, 12146, 12146, 12148, 12148, 12149, 12150, 12152, 12153,
+    12154, 12155, 12156, 12157, 12158, 12159, 12160, 12163, 12164, 12165, 12166, 12167, 12167, 12167, 12168, 12169,
+    12170, 12170, 12170, 12171, 12172, 12173, 12174, 12175, 12175, 12175, 12176, 12177, 12178, 12180, 12181, 12182,
+    12182, 12182, 12183, 12183, 12184, 12184, 12185, 12186, 12187, 12187, 12188, 12189, 12190, 12191, 12192, 12193,
+    12194, 12194, 12194, 12195, 12195, 12195, 12197, 12198, 12199, 12201, 12201, 12202, 12203, 12204, 12205, 12205,
+    12206, 12207, 12209, 12210, 12211, 12212, 12213, 12214, 12215, 12216, 12217, 12217, 12218, 12219, 12220, 12221,
+    12222, 12223, 12224, 12225, 12226, 12226, 12228, 12229, 12230, 12230, 12231, 12232, 12233, 12234, 12236, 12237,
+    12239, 12240, 12242, 12243, 12244, 12245, 12246, 12247, 12248, 12249, 12250, 12251, 12252, 12252, 12254, 12255,
+    12256, 12257, 12258, 12259, 12260, 12262, 12263, 12265, 12266, 12267, 12269, 12270, 12271, 12272, 12274, 12276,
+    12278, 12279, 12280, 12281, 12282, 12283, 12284, 12285, 12286, 12287, 12289, 12290, 12291, 12294, 12295, 12296,
+    12297, 12298, 12299, 12299, 12300, 12301, 12302, 12303, 12304, 12305, 12305, 12307, 12307, 12308, 12309, 12310,
+    12310, 12311, 12312, 12313, 12314, 12315, 12316, 12317, 12318, 12319, 12320, 12321, 12322, 12323, 12324, 12324,
+    12325, 12327, 12327, 12328, 12329, 12330, 12331, 12332, 12332, 12333, 12334, 12336, 12337, 12337, 12338, 12339,
+    12340, 12341, 12342, 12342, 12343, 12344, 12345, 12346, 12348, 12348, 12349, 12350, 12351, 12353, 12354, 12355,
+    12356, 12357, 12358, 12358, 12359, 12360, 12361, 12362, 12363, 12364, 12365, 12366, 12366, 12367, 12368, 12370,
+    12371, 12373, 12374, 12375, 12376, 12377, 12378, 12379, 12380, 12381, 12383, 12384, 12385, 12386, 12387, 12388,
+    12389, 12390, 12391, 12391, 12392, 12393, 12394, 12395, 12396, 12397, 12398, 12400, 12401, 12402, 12403, 12404,
+    12406, 12407, 12408, 12409, 12411, 12411, 12412, 12413, 12414, 12415, 12415, 12416, 12417, 12418, 12419, 12420,
+    12421, 12422, 12422, 12423, 12424, 12425, 12426, 12427, 12427, 12428, 12429, 12431, 12432, 12433, 12435, 12436,
+    12437, 12437, 12438, 12439, 12440, 12441, 12442, 12443, 12444, 12445, 12446, 12447, 12447, 12448, 12448, 12449,
+    12451, 12452, 12453, 12454, 12455, 12456, 12458, 12459, 12460, 12461, 12462, 12463, 12464, 12465, 12465, 12466,
+    12467, 12468, 12469, 12470, 12471, 12472, 12473, 12475, 12476, 12476, 12477, 12478, 12479, 12479, 12480, 12481,
+    12482, 12482, 12483, 12484, 12484, 12485, 12486, 12486, 12487, 12488, 12489, 12489, 12490, 12491, 12492, 12493,
+    12494, 12494, 12495, 12495, 12496, 12497, 12498, 12499, 12500, 12501, 12503, 12504, 12504, 12505, 12506, 12507,
+    12508, 12508, 12509, 12510, 12511, 12512, 12513, 12513, 12514, 12515, 12516, 12517, 12517, 12518, 12519, 12520,
+    12521, 12522, 12523, 12524, 12525, 12526, 12527, 12528, 12529, 12530, 12530, 12531, 12532, 12533, 12534, 12536,
+    12537, 12540, 12542, 12543, 12546, 12548, 12549, 12550, 12551, 12551, 12553, 12554, 12556, 12557, 12558, 12559,
+    12560, 12561, 12562, 12563, 12564, 12565, 12565, 12566, 12567, 12568, 12569, 12570, 12571, 12572, 12573, 12573,
+    12574, 12575, 12576, 12578, 12579, 12580, 12582, 12583, 12584, 12585, 12586, 12587, 12589, 12590, 12592, 12593,
+    12594, 12595, 12596, 12597, 12598, 12601, 12601, 12602, 12603, 12604, 12605, 12606, 12607, 12608, 12609, 12609,
+    12610, 12610, 12611, 12612, 12613, 12614, 12615, 12616, 12617, 12618, 12620, 12621, 12622, 12623, 12624, 12625,
+    12626, 12627, 12628, 12629, 12630, 12630, 12631, 12632, 12633, 12634, 12635, 12636, 12637, 12638, 12639, 12640,
+    12640, 12640, 12641, 12642, 12644, 12645, 12646, 12646, 12647, 12647, 12648, 12649, 12650, 12651, 12652, 12653,
+    12655, 12655, 12656, 12657, 12658, 12658, 12658, 12659, 12660, 12661, 12662, 12663, 12665, 12666, 12667, 12668,
+    12669, 12670, 12671, 12672, 12673, 12674, 12675, 12676, 12677, 12677, 12678, 12679, 12679, 12681, 12682, 12683,
+    12684, 12685, 12686, 12687, 12688, 12689, 12690, 12691, 12691, 12692, 12693, 12694, 12695, 12696, 12697, 12698,
+    12699, 12699, 12700, 12702, 12703, 12704, 12705, 12706, 12706, 12707, 12708, 12708, 12709, 12710, 12713, 12714,
+    12714, 12715, 12716, 12717, 12717, 12718, 12719, 12723, 12724, 12725, 12726, 12727, 12728, 12729, 12730, 12731,
+    12732, 12732, 12734, 12735, 12735, 12736, 12737, 12739, 12740, 12741, 12741, 12742, 12743, 12744, 12745, 12745,
+    12746, 12747, 12748, 12748, 12749, 12750, 12750, 12751, 12752, 12752, 12753, 12754, 12755, 12756, 12756, 12757,
+    12758, 12759, 12760, 12761, 12762, 12764, 12765, 12766, 12767, 12768, 12770, 12771, 12773, 12773, 12774, 12775,
+    12776, 12778, 12779, 12780, 12781, 12782, 12783, 12785, 12786, 12787, 12788, 12789, 12790, 12791, 12792, 12793,
+    12794, 12795, 12796, 12797, 12798, 12799, 12800, 12801, 12803, 12804, 12805, 12806, 12807, 12807, 12808, 12809,
+    12810, 12811, 12812, 12813, 12814, 12815, 12816, 12817, 12818, 12820, 12821, 12822, 12823, 12823, 12824, 12825,
+    12826, 12827, 12830, 12831, 12831, 12832, 12833, 12834, 12835, 12837, 12838, 12839, 12839, 12840, 12841, 12842,
+    12843, 12843, 12844, 12844, 12845, 12846, 12846, 12847, 12849, 12849, 12850, 12851, 12852, 12853, 12854, 12855,
+    12856, 12857, 12858, 12859, 12860, 12861, 12862, 12863, 12864, 12865, 12866, 12867, 12867, 12868, 12869, 12870,
+    12870, 12871, 12872, 12873, 12874, 12875, 12877, 12878, 12879, 12879, 12880, 12882, 12883, 12884, 12885, 12886,
+    12887, 12888, 12889, 12891, 12892, 12893, 12895, 12896, 12896, 12897, 12898, 12899, 12900, 12901, 12903, 12903,
+    12904, 12905, 12905, 12906, 12907, 12908, 12909, 12912, 12913, 12913, 12913, 12914, 12915, 12916, 12917, 12918,
+    12919, 12920, 12921, 12922, 12923, 12924, 12925, 12926, 12927, 12928, 12929, 12930, 12931, 12932, 12933, 12934,
+    12935, 12936, 12937, 12938, 12939, 12940, 12941, 12942, 12942, 12943, 12944, 12945, 12946, 12947, 12949, 12950,
+    12951, 12951, 12952, 12953, 12954, 12955, 12956, 12957, 12958, 12959, 12961, 12962, 12963, 12964, 12965, 12966,
+    12967, 12968, 12969, 12970, 12970, 12971, 12972, 12973, 12973, 12974, 12975, 12976, 12977, 12978, 12979, 12980,
+    12981, 12982, 12983, 12983, 12984, 12985, 12986, 12987, 12988, 12989, 12990, 12991, 12992, 12994, 12995, 12996,
+    12997, 12997, 12998, 12998, 12999, 13000, 13000, 13001, 13002, 13003, 13004, 13005, 13006, 13007, 13008, 13009,
+    13010, 13011, 13012, 13013, 13014, 13015, 13016, 13016, 13017, 13018, 13018, 13019, 13020, 13020, 13021, 13022,
+    13022, 13022, 13022, 13023, 13024, 13025, 13026, 13027, 13028, 13029, 13030, 13031, 13032, 13032, 13033, 13034,
+    13036, 13037, 13038, 13039, 13040, 13041, 13042, 13043, 13044, 13045, 13047, 13047, 13047, 13048, 13049, 13049,
+    13050, 13051, 13052, 13052, 13053, 13054, 13055, 13056, 13057, 13058, 13059, 13060, 13061, 13062, 13063, 13064,
+    13065, 13066, 13067, 13068, 13068, 13068, 13068, 13068, 13069, 13070, 13072, 13073, 13074, 13075, 13076, 13077,
+    13077, 13079, 13080, 13081, 13082, 13083, 13084, 13085, 13085, 13086, 13087, 13089, 13090, 13091, 13092, 13092,
+    13093, 13095, 13096, 13096, 13096, 13097, 13098, 13098, 13099, 13100, 13102, 13104, 13105, 13106, 13107, 13108,
+    13109, 13110, 13111, 13112, 13114, 13115, 13115, 13116, 13117, 13118, 13119, 13120, 13121, 13122, 13123, 13124,
+    13125, 13125, 13127, 13128, 13128, 13129, 13130, 13131, 13132, 13134, 13135, 13135, 13137, 13138, 13138, 13139,
+    13139, 13139, 13140, 13141, 13142, 13143, 13145, 13145, 13145, 13147, 13149, 13150, 13150, 13151, 13151, 13151,
+    13152, 13152, 13152, 13153, 13153, 13154, 13155, 13156, 13157, 13158, 13159, 13160, 13161, 13163, 13163, 13164,
+    13164, 13165, 13166, 13166, 13167, 13168, 13169, 13170, 13172, 13173, 13174, 13175, 13176, 13178, 13179, 13180,
+    13180, 13180, 13181, 13181, 13182, 13183, 13183, 13185, 13186, 13187, 13188, 13189, 13190, 13191, 13192, 13193,
+    13194, 13194, 13195, 13197, 13198, 13199, 13200, 13201, 13202, 13203, 13203, 13204, 13205, 13205, 13206, 13207,
+    13208, 13210, 13211, 13212, 13213, 13213, 13214, 13215, 13216, 13219, 13220, 13221, 13221, 13222, 13223, 13224,
+    13225, 13226, 13227, 13227, 13228, 13228, 13229, 13231, 13233, 13234, 13235, 13236, 13236, 13237, 13238, 13239,
+    13240, 13241, 13244, 13245, 13245, 13246, 13247, 13247, 13247, 13249, 13250, 13253, 13254, 13255, 13256, 13257,
+    13258, 13258, 13259, 13260, 13260, 13261, 13263, 13264, 13265, 13265, 13265, 13266, 13267, 13268, 13270, 13272,
+    13273, 13274, 13274, 13275, 13276, 13276, 13277, 13278, 13279, 13280, 13280, 13281, 13284, 13284, 13285, 13285,
+    13286, 13286, 13287, 13287, 13288, 13288, 13289, 13289, 13290, 13291, 13292, 13293, 13294, 13294, 13294, 13295,
+    13295, 13296, 13296, 13296, 13297, 13298, 13299, 13300, 13302, 13303, 13304, 13306, 13307, 13308, 13309, 13310,
+    13312, 13313, 13314, 13315, 13315, 13316, 13317, 13317, 13317, 13318, 13318, 13320, 13320, 13320, 13320, 13321,
+    13323, 13324, 13325, 13326, 13327, 13328, 13329, 13330, 13331, 13331, 13332, 13333, 13334, 13335, 13337, 13337,
+    13338, 13339, 13340, 13341, 13341, 13343, 13344, 13344, 13345, 13347, 13347, 13348, 13349, 13351, 13353, 13354,
+    13355, 13356, 13356, 13357, 13358, 13359, 13360, 13360, 13361, 13362, 13363, 13364, 13365, 13365, 13365, 13366,
+    13366, 13367, 13368, 13369, 13370, 13371, 13372, 13373, 13374, 13375, 13376, 13377, 13378, 13379, 13380, 13381,
+    13381, 13382, 13382, 13383, 13384, 13385, 13386, 13388, 13389, 13390, 13391, 13392, 13392, 13394, 13395, 13396,
+    13397, 13398, 13399, 13400, 13401, 13402, 13403, 13404, 13405, 13405, 13406, 13407, 13408, 13408, 13409, 13410,
+    13411, 13412, 13413, 13413, 13415, 13416, 13416, 13417, 13417, 13418, 13419, 13420, 13421, 13422, 13423, 13424,
+    13424, 13424, 13425, 13426, 13428, 13429, 13429, 13430, 13432, 13433, 13434, 13435, 13436, 13438, 13439, 13440,
+    13441, 13441, 13442, 13443, 13444, 13445, 13446, 13446, 13447, 13448, 13449, 13450, 13451, 13452, 13452, 13453,
+    13454, 13455, 13456, 13456, 13456, 13457, 13459, 13459, 13460, 13461, 13462, 13463, 13464, 13464, 13465, 13466,
+    13466, 13467, 13468, 13469, 13470, 13472, 13473, 13474, 13475, 13476, 13477, 13479, 13480, 13481, 13483, 13484,
+    13485, 13486, 13487, 13488, 13489, 13490, 13491, 13492, 13493, 13494, 13495, 13496, 13497, 13498, 13498, 13499,
+    13499, 13499, 13500, 13501, 13502, 13502, 13503, 13503, 13504, 13505, 13506, 13507, 13507, 13508, 13508, 13510,
+    13511, 13512, 13513, 13514, 13515, 13515, 13515, 13515, 13516, 13517, 13517, 13518, 13519, 13520, 13521, 13523,
+    13524, 13525, 13525, 13525, 13526, 13526, 13527, 13528, 13528, 13529, 13530, 13530, 13531, 13532, 13533, 13534,
+    13535, 13536, 13537, 13538, 13539, 13540, 13541, 13542, 13543, 13544, 13545, 13545, 13546, 13547, 13548, 13548,
+    13548, 13549, 13549, 13551, 13552, 13553, 13554, 13555, 13555, 13557, 13558, 13559, 13560, 13561, 13561, 13562,
+    13562, 13563, 13563, 13563, 13563, 13564, 13565, 13567, 13567, 13568, 13569, 13570, 13571, 13572, 13573, 13574,
+    13575, 13576, 13577, 13578, 13579, 13580, 13581, 13582, 13582, 13583, 13584, 13585, 13585, 13586, 13587, 13588,
+    13589, 13590, 13591, 13592, 13592, 13592, 13593, 13594, 13595, 13596, 13597, 13597, 13597, 13597, 13598, 13599,
+    13599, 13599, 13600, 13600, 13601, 13601, 13602, 13602, 13603, 13604, 13605, 13606, 13607, 13608, 13609, 13609,
+    13609, 13610, 13611, 13612, 13613, 13614, 13615, 13615, 13617, 13618, 13619, 13619, 13620, 13620, 13621, 13622,
+    13623, 13624, 13624, 13625, 13626, 13627, 13628, 13628, 13629, 13630, 13631, 13632, 13633, 13634, 13635, 13636,
+    13637, 13637, 13639, 13640, 13641, 13641, 13642, 13644, 13645, 13646, 13647, 13647, 13648, 13650, 13652, 13653,
+    13654, 13654, 13655, 13656, 13656, 13657, 13658, 13659, 13660, 13661, 13662, 13664, 13665, 13666, 13667, 13668,
+    13669, 13670, 13670, 13672, 13673, 13674, 13675, 13677, 13678, 13678, 13679, 13680, 13681, 13682, 13683, 13684,
+    13685, 13686, 13687, 13688, 13689, 13689, 13690, 13691, 13692, 13693, 13694, 13694, 13695, 13696, 13700, 13701,
+    13702, 13704, 13705, 13705, 13706, 13707, 13708, 13709, 13709, 13709, 13710, 13711, 13711, 13712, 13713, 13714,
+    13715, 13715, 13716, 13717, 13717, 13718, 13718, 13719, 13720, 13721, 13723, 13724, 13724, 13724, 13725, 13726,
+    13727, 13728, 13729, 13730, 13731, 13733, 13734, 13735, 13736, 13737, 13738, 13739, 13740, 13741, 13742, 13743,
+    13744, 13745, 13746, 13747, 13747, 13747, 13748, 13750, 13750, 13751, 13752, 13753, 13753, 13754, 13755, 13756,
+    13757, 13757, 13758, 13759, 13760, 13761, 13761, 13761, 13762, 13763, 13764, 13765, 13766, 13767, 13767, 13768,
+    13769, 13770, 13771, 13772, 13773, 13774, 13774, 13775, 13777, 13777, 13777, 13777, 13778, 13779, 13779, 13780,
+    13781, 13781, 13782, 13783, 13785, 13786, 13787, 13788, 13789, 13790, 13791, 13792, 13794, 13795, 13796, 13797,
+    13798, 13799, 13800, 13801, 13802, 13804, 13805, 13806, 13807, 13808, 13808, 13809, 13810, 13811, 13812, 13812,
+    13813, 13814, 13814, 13815, 13815, 13816, 13817, 13818, 13819, 13820, 13821, 13822, 13823, 13824, 13825, 13825,
+    13825, 13826, 13827, 13828, 13828, 13830, 13831, 13832, 13833, 13834, 13835, 13836, 13837, 13838, 13839, 13840,
+    13841, 13842, 13842, 13843, 13844, 13846, 13847, 13848, 13848, 13849, 13850, 13851, 13852, 13853, 13854, 13855,
+    13856, 13857, 13859, 13860, 13861, 13862, 13862, 13863, 13864, 13865, 13866, 13867, 13868, 13869, 13871, 13872,
+    13873, 13874, 13875, 13876, 13877, 13878, 13878, 13879, 13880, 13881, 13882, 13883, 13885, 13885, 13885, 13887,
+    13888, 13889, 13890, 13891, 13892, 13893, 13894, 13895, 13896, 13896, 13897, 13897, 13898, 13899, 13900, 13901,
+    13902, 13902, 13903, 13904, 13906, 13907, 13907, 13908, 13909, 13909, 13910, 13910, 13911, 13912, 13914, 13916,
+    13917, 13917, 13918, 13920, 13920, 13921, 13922, 13923, 13924, 13924, 13924, 13925, 13927, 13928, 13928, 13930,
+    13931, 13933, 13933, 13934, 13935, 13936, 13937, 13938, 13939, 13939, 13940, 13941, 13942, 13943, 13944, 13945,
+    13945, 13946, 13947, 13948, 13949, 13949, 13949, 13950, 13952, 13953, 13954, 13954, 13955, 13955, 13956, 13956,
+    13957, 13959, 13961, 13962, 13963, 13964, 13965, 13967, 13968, 13968, 13969, 13970, 13971, 13972, 13972, 13973,
+    13974, 13975, 13976, 13977, 13978, 13980, 13981, 13982, 13982, 13983, 13984, 13985, 13985, 13985, 13986, 13986,
+    13986, 13987, 13988, 13989, 13990, 13991, 13992, 13993, 13994, 13995, 13995, 13996, 13996, 13997, 13999, 14000,
+    14000, 14001, 14001, 14002, 14002, 14003, 14003, 14003, 14004, 14004, 14004, 14005, 14007, 14007, 14008, 14008,
+    14009, 14010, 14011, 14011, 14012, 14013, 14014, 14015, 14016, 14016, 14017, 14018, 14019, 14021, 14021, 14022,
+    14022, 14023, 14024, 14025, 14026, 14027, 14028, 14029, 14031, 14032, 14032, 14033, 14034, 14035, 14038, 14039,
+    14041, 14042, 14042, 14043, 14044, 14044, 14044, 14044, 14045, 14045, 14046, 14049, 14049, 14051, 14051, 14051,
+    14052, 14052, 14053, 14054, 14056, 14057, 14057, 14058, 14058, 14060, 14061, 14061, 14061, 14061, 14061, 14062,
+    14065, 14066, 14067, 14068, 14069, 14070, 14071, 14072, 14075, 14077, 14077, 14078, 14079, 14080, 14081, 14081,
+    14081, 14082, 14083, 14084, 14087, 14088, 14089, 14090, 14092, 14093, 14093, 14094, 14094, 14094, 14094, 14095,
+    14096, 14096, 14097, 14097, 14097, 14097, 14098, 14098, 14099, 14101, 14103, 14104, 14105, 14106, 14106, 14107,
+    14108, 14110, 14110, 14111, 14112, 14113, 14113, 14114, 14115, 14115, 14116, 14116, 14117, 14118, 14118, 14119,
+    14119, 14119, 14120, 14120, 14120, 14120, 14121, 14122, 14124, 14125, 14126, 14127, 14127, 14128, 14130, 14131,
+    14132, 14133, 14133, 14133, 14133, 14134, 14134, 14134, 14135, 14135, 14135, 14136, 14137, 14138, 14139, 14140,
+    14141, 14141, 14141, 14141, 14141, 14143, 14144, 14145, 14145, 14146, 14147, 14148, 14148, 14149, 14149, 14150,
+    14151, 14151, 14151, 14152, 14152, 14153, 14153, 14154, 14154, 14155, 14156, 14157, 14158, 14159, 14160, 14162,
+    14163, 14164, 14164, 14165, 14166, 14166, 14166, 14167, 14168, 14169, 14170, 14171, 14172, 14173, 14174, 14175,
+    14176, 14177, 14178, 14181, 14182, 14184, 14185, 14186, 14187, 14188, 14189, 14189, 14190, 14191, 14192, 14193,
+    14194, 14194, 14195, 14195, 14196, 14197, 14198, 14198, 14199, 14201, 14202, 14203, 14204, 14204, 14205, 14205,
+    14205, 14206, 14206, 14206, 14206, 14206, 14206, 14207, 14207, 14208, 14208, 14209, 14209, 14211, 14211, 14211,
+    14213, 14213, 14215, 14215, 14216, 14217, 14217, 14217, 14218, 14219, 14220, 14221, 14222, 14222, 14223, 14223,
+    14225, 14226, 14226, 14226, 14226, 14227, 14228, 14228, 14229, 14229, 14230, 14231, 14233, 14233, 14234, 14235,
+    14236, 14237, 14237, 14238, 14238, 14238, 14238, 14240, 14242, 14242, 14243, 14244, 14244, 14245, 14246, 14246,
+    14247, 14248, 14249, 14249, 14249, 14250, 14250, 14251, 14252, 14252, 14254, 14255, 14256, 14257, 14259, 14260,
+    14260, 14261, 14262, 14263, 14265, 14265, 14266, 14267, 14267, 14268, 14268, 14269, 14269, 14269, 14269, 14269,
+    14270, 14271, 14272, 14273, 14273, 14273, 14274, 14275, 14277, 14278, 14279, 14280, 14281, 14281, 14282, 14283,
+    14283, 14284, 14284, 14285, 14285, 14285, 14285, 14287, 14287, 14287, 14288, 14288, 14289, 14290, 14291, 14292,
+    14293, 14294, 14295, 14296, 14296, 14298, 14299, 14300, 14301, 14302, 14304, 14306, 14307, 14307, 14308, 14309,
+    14309, 14311, 14313, 14314, 14314, 14315, 14316, 14317, 14318, 14319, 14319, 14320, 14320, 14321, 14321, 14322,
+    14322, 14323, 14324, 14325, 14325, 14326, 14327, 14327, 14328, 14330, 14331, 14331, 14332, 14333, 14333, 14333,
+    14333, 14333, 14334, 14335, 14336, 14337, 14338, 14339, 14340, 14341, 14342, 14343, 14344, 14344, 14344, 14345,
+    14346, 14346, 14347, 14348, 14348, 14350, 14351, 14353, 14354, 14355, 14356, 14357, 14357, 14358, 14359, 14360,
+    14360, 14361, 14362, 14364, 14365, 14365, 14366, 14366, 14366, 14366, 14367, 14368, 14368, 14369, 14370, 14371,
+    14372, 14373, 14374, 14374, 14375, 14376, 14378, 14379, 14379, 14380, 14381, 14381, 14382, 14383, 14384, 14385,
+    14385, 14385, 14386, 14386, 14387, 14388, 14389, 14389, 14390, 14391, 14392, 14393, 14394, 14395, 14396, 14396,
+    14397, 14399, 14400, 14401, 14401, 14402, 14403, 14403, 14404, 14405, 14406, 14407, 14407, 14408, 14410, 14410,
+    14411, 14412, 14413, 14414, 14415, 14416, 14417, 14418, 14419, 14421, 14422, 14423, 14423, 14424, 14425, 14425,
+    14428, 14428, 14429, 14430, 14431, 14433, 14434, 14434, 14435, 14436, 14437, 14437, 14437, 14438, 14439, 14440,
+    14440, 14440, 14442, 14442, 14443, 14444, 14445, 14445, 14446, 14447, 14447, 14448, 14450, 14452, 14454, 14455,
+    14456, 14457, 14457, 14458, 14458, 14459, 14460, 14461, 14463, 14464, 14465, 14466, 14466, 14467, 14468, 14469,
+    14470, 14471, 14472, 14473, 14474, 14474, 14475, 14476, 14477, 14478, 14478, 14479, 14480, 14480, 14480, 14481,
+    14482, 14483, 14483, 14485, 14486, 14487, 14488, 14489, 14489, 14489, 14491, 14493, 14494, 14496, 14497, 14497,
+    14497, 14498, 14498, 14499, 14500, 14500, 14500, 14501, 14502, 14503, 14504, 14506, 14507, 14508, 14509, 14509,
+    14510, 14510, 14511, 14512, 14513, 14514, 14515, 14516, 14517, 14518, 14519, 14519, 14520, 14521, 14522, 14522,
+    14523, 14523, 14523, 14524, 14525, 14527, 14527, 14528, 14528, 14529, 14529, 14530, 14531, 14532, 14533, 14534,
+    14535, 14536, 14536, 14536, 14537, 14537, 14538, 14538, 14539, 14540, 14541, 14542, 14543, 14543, 14543, 14544,
+    14545, 14546, 14546, 14547, 14548, 14548, 14549, 14550, 14551, 14552, 14553, 14554, 14555, 14556, 14557, 14558,
+    14559, 14560, 14560, 14561, 14562, 14562, 14563, 14563, 14564, 14566, 14567, 14567, 14568, 14569, 14570, 14571,
+    14572, 14573, 14574, 14575, 14576, 14576, 14577, 14578, 14579, 14580, 14582, 14583, 14583, 14584, 14584, 14585,
+    14587, 14587, 14587, 14588, 14590, 14590, 14591, 14593, 14594, 14595, 14595, 14596, 14597, 14598, 14599, 14600,
+    14602, 14602, 14603, 14605, 14606, 14607, 14608, 14608, 14609, 14609, 14610, 14611, 14612, 14612, 14613, 14613,
+    14614, 14615, 14616, 14617, 14617, 14619, 14620, 14621, 14621, 14623, 14624, 14624, 14625, 14626, 14627, 14628,
+    14628, 14629, 14630, 14631, 14632, 14632, 14632, 14632, 14632, 14632, 14632, 14633, 14634, 14636, 14636, 14636,
+    14637, 14637, 14637, 14637, 14638, 14638, 14638, 14639, 14639, 14640, 14641, 14641, 14642, 14643, 14643, 14644,
+    14645, 14645, 14646, 14646, 14647, 14647, 14648, 14649, 14650, 14651, 14653, 14653, 14654, 14655, 14655, 14656,
+    14656, 14657, 14657, 14657, 14659, 14660, 14661, 14661, 14662, 14662, 14663, 14663, 14663, 14663, 14663, 14664,
+    14665, 14665, 14666, 14667, 14668, 14668, 14670, 14672, 14673, 14673, 14674, 14674, 14674, 14676, 14676, 14677,
+    14678, 14678, 14678, 14679, 14679, 14680, 14681, 14681, 14681, 14682, 14684, 14685, 14685, 14686, 14686, 14687,
+    14687, 14687, 14688, 14690, 14690, 14691, 14692, 14693, 14693, 14694, 14695, 14696, 14697, 14697, 14697, 14697,
+    14698, 14699, 14699, 14700, 14701, 14701, 14701, 14701, 14702, 14704, 14705, 14706, 14707, 14708, 14708, 14708,
+    14709, 14710, 14711, 14711, 14712, 14712, 14712, 14713, 14714, 14714, 14715, 14716, 14716, 14717, 14718, 14718,
+    14719, 14721, 14721, 14722, 14723, 14723, 14724, 14725, 14726, 14726, 14727, 14729, 14730, 14730, 14731, 14731,
+    14731, 14731, 14731, 14731, 14731, 14732, 14732, 14733, 14734, 14735, 14736, 14737, 14738, 14739, 14740, 14741,
+    14741, 14741, 14742, 14742, 14743, 14744, 14745, 14746, 14746, 14746, 14747, 14748, 14749, 14749, 14749, 14750,
+    14750, 14750, 14751, 14751, 14752, 14753, 14754, 14754, 14754, 14755, 14755, 14755, 14756, 14757, 14757, 14758,
+    14759, 14759, 14759, 14759, 14760, 14761, 14761, 14763, 14763, 14764, 14764, 14764, 14764, 14764, 14764, 14765,
+    14765, 14765, 14767, 14768, 14769, 14770, 14771, 14773, 14774, 14776, 14776, 14777, 14778, 14779, 14780, 14781,
+    14783, 14784, 14785, 14786, 14787, 14788, 14788, 14790, 14791, 14792, 14793, 14794, 14795, 14796, 14796, 14797,
+    14797, 14798, 14799, 14799, 14800, 14801, 14803, 14803, 14804, 14805, 14806, 14807, 14807, 14808, 14808, 14808,
+    14808, 14808, 14808, 14809, 14809, 14810, 14812, 14813, 14813, 14815, 14815, 14816, 14816, 14816, 14817, 14818,
+    14819, 14820, 14820, 14820, 14822, 14824, 14824, 14825, 14825, 14826, 14827, 14828, 14829, 14830, 14830, 14830,
+    14831, 14831, 14832, 14833, 14834, 14835, 14835, 14835, 14836, 14837, 14838, 14838, 14839, 14839, 14840, 14841,
+    14843, 14844, 14844, 14845, 14846, 14847, 14848, 14848, 14849, 14850, 14852, 14854, 14855, 14856, 14858, 14858,
+    14859, 14861, 14861, 14862, 14862, 14863, 14864, 14864, 14864, 14864, 14865, 14866, 14867, 14867, 14867, 14868,
+    14869, 14869, 14870, 14871, 14872, 14873, 14874, 14875, 14876, 14876, 14877, 14878, 14879, 14880, 14881, 14881,
+    14882, 14882, 14883, 14883, 14884, 14886, 14887, 14888, 14889, 14890, 14890, 14890, 14890, 14891, 14892, 14893,
+    14893, 14893, 14893, 14894, 14895, 14896, 14897, 14898, 14899, 14900, 14901, 14902, 14902, 14903, 14904, 14904,
+    14905, 14906, 14907, 14909, 14910, 14910, 14911, 14912, 14912, 14912, 14914, 14915, 14916, 14916, 14917, 14918,
+    14918, 14919, 14920, 14920, 14920, 14921, 14922, 14923, 14924, 14924, 14924, 14924, 14925, 14926, 14927, 14928,
+    14929, 14930, 14932, 14932, 14933, 14933, 14933, 14934, 14936, 14936, 14937, 14938, 14939, 14939, 14939, 14939,
+    14939, 14940, 14940, 14940, 14941, 14941, 14941, 14941, 14942, 14943, 14944, 14945, 14947, 14947, 14947, 14948,
+    14949, 14949, 14949, 14950, 14950, 14950, 14951, 14952, 14952, 14952, 14953, 14954, 14955, 14956, 14957, 14958,
+    14959, 14959, 14960, 14961, 14962, 14963, 14964, 14965, 14965, 14966, 14966, 14967, 14968, 14968, 14969, 14969,
+    14970, 14971, 14972, 14972, 14973, 14974, 14975, 14979, 14980, 14980, 14981, 14981, 14982, 14983, 14983, 14983,
+    14984, 14984, 14985, 14985, 14986, 14986, 14987, 14987, 14987, 14987, 14988, 14988, 14988, 14989, 14990, 14991,
+    14991, 14992, 14993, 14995, 14996, 14997, 14998, 14999, 15000, 15001, 15003, 15003, 15004, 15004, 15005, 15005,
+    15006, 15007, 15008, 15009, 15009, 15010, 15010, 15011, 15011, 15012, 15014, 15015, 15015, 15016, 15016, 15016,
+    15017, 15017, 15017, 15018, 15018, 15019, 15020, 15021, 15021, 15021, 15022, 15022, 15023, 15024, 15024, 15025,
+    15025, 15025, 15026, 15027, 15027, 15027, 15028, 15029, 15029, 15029, 15029, 15029, 15030, 15031, 15031, 15032,
+    15033, 15035, 15036, 15037, 15037, 15038, 15039, 15040, 15041, 15041, 15041, 15041, 15043, 15045, 15046, 15047,
+    15048, 15048, 15048, 15049, 15050, 15050, 15050, 15051, 15052, 15053, 15053, 15055, 15055, 15057, 15059, 15060,
+    15061, 15061, 15062, 15063, 15063, 15063, 15064, 15065, 15065, 15065, 15066, 15066, 15067, 15067, 15068, 15069,
+    15070, 15070, 15070, 15070, 15071, 15071, 15072, 15072, 15072, 15072, 15073, 15074, 15074, 15074, 15075, 15075,
+    15075, 15076, 15076, 15076, 15076, 15076, 15077, 15077, 15078, 15078, 15079, 15079, 15079, 15080, 15080, 15080,
+    15081, 15082, 15082, 15082, 15083, 15085, 15085, 15085, 15086, 15087, 15087, 15088, 15088, 15089, 15089, 15090,
+    15091, 15092, 15092, 15093, 15094, 15094, 15094, 15095, 15095, 15096, 15096, 15096, 15097, 15097, 15098, 15098,
+    15098, 15099, 15100, 15101, 15101, 15102, 15103, 15104, 15105, 15107, 15108, 15108, 15109, 15110, 15110, 15111,
+    15112, 15112, 15114, 15115, 15116, 15117, 15117, 15117, 15117, 15118, 15119, 15119, 15120, 15120, 15121, 15123,
+    15124, 15124, 15125, 15126, 15127, 15128, 15128, 15129, 15129, 15130, 15131, 15131, 15132, 15133, 15133, 15133,
+    15133, 15134, 15135, 15135, 15135, 15136, 15136, 15137, 15139, 15140, 15141, 15142, 15142, 15143, 15144, 15144,
+    15145, 15146, 15146, 15147, 15147, 15147, 15147, 15149, 15149, 15150, 15150, 15151, 15151, 15151, 15153, 15154,
+    15154, 15155, 15156, 15157, 15157, 15157, 15158, 15158, 15158, 15159, 15160, 15160, 15161, 15161, 15162, 15164,
+    15164, 15167, 15167, 15168, 15168, 15169, 15170, 15170, 15171, 15171, 15171, 15172, 15173, 15173, 15174, 15174,
+    15174, 15174, 15174, 15174, 15175, 15175, 15175, 15176, 15177, 15177, 15177, 15178, 15178, 15179, 15179, 15180,
+    15181, 15183, 15183, 15184, 15185, 15186, 15186, 15186, 15187, 15187, 15187, 15187, 15188, 15189, 15189, 15190,
+    15191, 15192, 15194, 15195, 15195, 15196, 15197, 15198, 15199, 15199, 15199, 15200, 15201, 15201, 15202, 15203,
+    15204, 15205, 15205, 15206, 15206, 15206, 15206, 15208, 15208, 15208, 15208, 15209, 15210, 15211, 15211, 15212,
+    15212, 15212, 15213, 15214, 15214, 15215, 15216, 15216, 15217, 15218, 15218, 15219, 15220, 15221, 15222, 15222,
+    15222, 15224, 15226, 15227, 15228, 15229, 15230, 15230, 15231, 15233, 15234, 15235, 15236, 15236, 15237, 15238,
+    15239, 15240, 15240, 15240, 15241, 15242, 15243, 15243, 15244, 15244, 15245, 15246, 15246, 15247, 15247, 15247,
+    15247, 15248, 15250, 15250, 15250, 15251, 15252, 15253, 15254, 15254, 15255, 15256, 15257, 15258, 15259, 15260,
+    15260, 15261, 15261, 15261, 15261, 15261, 15262, 15263, 15263, 15264, 15265, 15267, 15268, 15269, 15270, 15271,
+    15271, 15271, 15272, 15273, 15274, 15274, 15275, 15275, 15276, 15277, 15278, 15279, 15279, 15280, 15281, 15281,
+    15281, 15281, 15282, 15282, 15282, 15283, 15284, 15284, 15285, 15285, 15285, 15285, 15285, 15285, 15286, 15286,
+    15288, 15290, 15291, 15292, 15293, 15293, 15294, 15294, 15295, 15295, 15295, 15295, 15296, 15297, 15298, 15300,
+    15301, 15302, 15302, 15303, 15303, 15303, 15303, 15304, 15305, 15305, 15306, 15307, 15308, 15309, 15309, 15310,
+    15311, 15312, 15314, 15315, 15316, 15316, 15316, 15316, 15316, 15317, 15318, 15318, 15319, 15319, 15319, 15319,
+    15319, 15320, 15321, 15322, 15322, 15322, 15322, 15322, 15323, 15323, 15323, 15323, 15324, 15325, 15326, 15327,
+    15328, 15329, 15329, 15330, 15331, 15331, 15331, 15331, 15332, 15332, 15332, 15333, 15334, 15335, 15335, 15336,
+    15338, 15339, 15339, 15339, 15339, 15339, 15340, 15341, 15341, 15341, 15341, 15343, 15343, 15343, 15344, 15346,
+    15346, 15346, 15347, 15348, 15348, 15348, 15349, 15350, 15350, 15351, 15351, 15352, 15353, 15353, 15353, 15353,
+    15353, 15353, 15353, 15354, 15354, 15355, 15356, 15356, 15357, 15358, 15359, 15359, 15360, 15361, 15361, 15362,
+    15363, 15364, 15364, 15365, 15367, 15367, 15367, 15368, 15368, 15369, 15370, 15371, 15372, 15372, 15373, 15374,
+    15374, 15375, 15376, 15376, 15376, 15377, 15377, 15377, 15377, 15377, 15378, 15379, 15379, 15380, 15381, 15381,
+    15381, 15382, 15383, 15383, 15384, 15385, 15386, 15387, 15387, 15387, 15389, 15389, 15389, 15390, 15390, 15390,
+    15391, 15392, 15393, 15394, 15394, 15395, 15396, 15396, 15396, 15397, 15398, 15399, 15400, 15401, 15401, 15401,
+    15401, 15401, 15401, 15402, 15403, 15404, 15405, 15405, 15407, 15408, 15408, 15409, 15409, 15410, 15411, 15412,
+    15413, 15415, 15415, 15416, 15416, 15416, 15417, 15417, 15417, 15417, 15418, 15418, 15418, 15419, 15420, 15420,
+    15420, 15421, 15422, 15422, 15422, 15423, 15423, 15423, 15424, 15424, 15426, 15427, 15428, 15428, 15429, 15430,
+    15430, 15431, 15431, 15432, 15432, 15433, 15434, 15434, 15434, 15434, 15434, 15435, 15435, 15435, 15436, 15437,
+    15437, 15437, 15438, 15438, 15438, 15439, 15439, 15440, 15440, 15440, 15441, 15441, 15442, 15442, 15444, 15444,
+    15444, 15445, 15446, 15447, 15448, 15449, 15449, 15449, 15450, 15450, 15450, 15451, 15451, 15451, 15451, 15453,
+    15453, 15453, 15453, 15454, 15455, 15457, 15457, 15457, 15458, 15458, 15459, 15460, 15461, 15462, 15463, 15463,
+    15463, 15464, 15466, 15466, 15467, 15469, 15470, 15470, 15470, 15470, 15470, 15471, 15472, 15472, 15473, 15473,
+    15473, 15474, 15475, 15475, 15476, 15476, 15477, 15477, 15478, 15479, 15479, 15480, 15481, 15482, 15482, 15482,
+    15482, 15483, 15483, 15484, 15485, 15486, 15487, 15488, 15489, 15490, 15491, 15491, 15492, 15493, 15493, 15494,
+    15494, 15495, 15495, 15496, 15496, 15497, 15498, 15498, 15499, 15499, 15500, 15500, 15501, 15502, 15502, 15503,
+    15505, 15506, 15507, 15507, 15508, 15508, 15509, 15509, 15511, 15511, 15512, 15513, 15513, 15514, 15515, 15516,
+    15516, 15516, 15517, 15518, 15519, 15521, 15522, 15522, 15523, 15524, 15524, 15525, 15525, 15525, 15525, 15526,
+    15527, 15528, 15529, 15531, 15532, 15532, 15532, 15533, 15534, 15535, 15536, 15537, 15537, 15538, 15538, 15539,
+    15539, 15539, 15540, 15540, 15541, 15542, 15544, 15545, 15545, 15545, 15545, 15545, 15545, 15546, 15547, 15548,
+    15549, 15551, 15551, 15552, 15552, 15552, 15552, 15553, 15554, 15555, 15555, 15556, 15557, 15557, 15558, 15558,
+    15559, 15560, 15560, 15560, 15560, 15560, 15560, 15561, 15561, 15563, 15564, 15565, 15565, 15566, 15567, 15568,
+    15568, 15569, 15570, 15570, 15571, 15572, 15573, 15574, 15575, 15576, 15577, 15577, 15578, 15579, 15579, 15580,
+    15580, 15580, 15580, 15581, 15581, 15581, 15581, 15582, 15582, 15582, 15583, 15583, 15585, 15585, 15586, 15586,
+    15586, 15587, 15588, 15589, 15590, 15591, 15591, 15591, 15591, 15591, 15592, 15593, 15593, 15594, 15594, 15595,
+    15596, 15596, 15597, 15597, 15598, 15599, 15599, 15601, 15602, 15602, 15602, 15602, 15602, 15603, 15603, 15603,
+    15603, 15604, 15604, 15605, 15605, 15606, 15607, 15608, 15608, 15608, 15609, 15610, 15610, 15611, 15612, 15612,
+    15612, 15612, 15612, 15612, 15612, 15613, 15613, 15614, 15615, 15616, 15617, 15617, 15617, 15618, 15619, 15620,
+    15621, 15621, 15622, 15623, 15624, 15624, 15624, 15625, 15625, 15626, 15627, 15627, 15627, 15627, 15628, 15628,
+    15628, 15629, 15629, 15630, 15631, 15631, 15631, 15632, 15634, 15635, 15635, 15636, 15637, 15637, 15638, 15638,
+    15638, 15639, 15639, 15640, 15640, 15640, 15640, 15641, 15641, 15642, 15642, 15643, 15643, 15644, 15645, 15646,
+    15648, 15649, 15649, 15649, 15649, 15649, 15650, 15650, 15651, 15652, 15653, 15653, 15654, 15654, 15654, 15655,
+    15656, 15656, 15656, 15656, 15657, 15658, 15659, 15659, 15660, 15661, 15661, 15662, 15663, 15664, 15664, 15665,
+    15666, 15666, 15666, 15666, 15667, 15668, 15669, 15669, 15669, 15670, 15671, 15671, 15671, 15672, 15672, 15672,
+    15672, 15673, 15674, 15675, 15676, 15677, 15678, 15679, 15680, 15681, 15681, 15682, 15682, 15682, 15683, 15684,
+    15684, 15685, 15686, 15686, 15686, 15686, 15686, 15687, 15687, 15687, 15689, 15689, 15689, 15690, 15691, 15692,
+    15692, 15693, 15694, 15695, 15696, 15697, 15698, 15699, 15700, 15700, 15700, 15701, 15701, 15701, 15702, 15702,
+    15702, 15703, 15704, 15705, 15706, 15707, 15707, 15707, 15708, 15709, 15709, 15709, 15709, 15710, 15711, 15711,
+    15712, 15712, 15713, 15713, 15715, 15716, 15717, 15717, 15717, 15717, 15718, 15719, 15720, 15720, 15720, 15720,
+    15721, 15721, 15721, 15721, 15722, 15723, 15724, 15724, 15725, 15725, 15725, 15726, 15727, 15727, 15727, 15727,
+    15728, 15729, 15729, 15730, 15731, 15731, 15732, 15732, 15732, 15733, 15733, 15734, 15734, 15734, 15734, 15735,
+    15736, 15737, 15738, 15738, 15738, 15739, 15740, 15742, 15742, 15742, 15742, 15742, 15743, 15743, 15744, 15744,
+    15744, 15744, 15744, 15745, 15746, 15747, 15748, 15749, 15750, 15751, 15751, 15752, 15752, 15752, 15753, 15754,
+    15755, 15756, 15757, 15757, 15758, 15758, 15758, 15759, 15760, 15761, 15762, 15763, 15764, 15764, 15765, 15765,
+    15766, 15766, 15767, 15768, 15768, 15769, 15769, 15769, 15769, 15769, 15770, 15771, 15773, 15773, 15773, 15773,
+    15774, 15774, 15774, 15775, 15776, 15776, 15777, 15778, 15778, 15779, 15780, 15780, 15780, 15781, 15782, 15782,
+    15782, 15783, 15783, 15784, 15785, 15785, 15785, 15785, 15786, 15787, 15788, 15789, 15790, 15790, 15791, 15792,
+    15793, 15794, 15794,
+};
+
+static const uint16_t hyph_enNodeLevels[15794] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 4, 7, 0,
+    0, 0, 1, 10, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 21, 0, 25, 28, 0, 7, 32, 35, 21, 28, 0, 10, 0, 39, 25,
+    0, 7, 44, 0, 48, 51, 0, 25, 48, 54, 57, 62, 48, 7, 0, 65,
+    17, 0, 48, 0, 70, 7, 62, 74, 0, 21, 0, 78, 0, 7, 82, 0,
+    7, 86, 48, 7, 48, 91, 0, 48, 7, 7, 1, 0, 17, 0, 0, 0,
+    7, 0, 74, 4, 7, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 10,
+    0, 0, 0, 0, 48, 44, 10, 0, 21, 10, 48, 96, 10, 10, 48, 44,
+    0, 100, 25, 104, 48, 48, 51, 32, 0, 107, 0, 0, 4, 7, 0, 48,
+    51, 48, 4, 0, 0, 51, 48, 0, 7, 0, 7, 7, 0, 10, 86, 21,
+    17, 0, 44, 112, 107, 0, 0, 7, 0, 17, 0, 0, 25, 117, 0, 25,
+    51, 122, 51, 10, 0, 0, 0, 25, 25, 0, 10, 0, 0, 7, 25, 44,
+    0, 10, 0, 127, 48, 0, 0, 0, 7, 0, 51, 32, 7, 32, 7, 7,
+    0, 0, 0, 107, 62, 7, 0, 17, 107, 25, 0, 25, 86, 100, 0, 10,
+    0, 7, 25, 91, 0, 25, 21, 91, 10, 0, 0, 17, 48, 48, 21, 44,
+    0, 21, 25, 0, 10, 21, 7, 21, 48, 21, 28, 107, 10, 48, 10, 48,
+    86, 0, 0, 0, 51, 0, 86, 0, 7, 130, 21, 62, 107, 0, 74, 7,
+    7, 91, 7, 0, 78, 74, 0, 10, 10, 0, 0, 0, 0, 0, 0, 78,
+    4, 62, 25, 0, 0, 1, 4, 0, 7, 0, 0, 0, 4, 0, 0, 0,
+    48, 21, 32, 0, 10, 10, 0, 0, 135, 140, 21, 100, 0, 21, 4, 91,
+    17, 0, 51, 4, 0, 7, 7, 0, 0, 7, 4, 32, 0, 51, 0, 7,
+    7, 0, 0, 7, 74, 130, 0, 0, 0, 7, 0, 4, 44, 0, 44, 0,
+    28, 100, 1, 0, 4, 78, 17, 74, 48, 0, 0, 7, 25, 0, 48, 10,
+    4, 145, 48, 17, 10, 21, 0, 17, 21, 0, 0, 25, 21, 91, 48, 21,
+    0, 107, 65, 48, 10, 32, 48, 10, 0, 0, 0, 0, 0, 0, 0, 148,
+    62, 10, 0, 0, 0, 0, 0, 0, 25, 0, 51, 78, 0, 0, 48, 0,
+    0, 0, 112, 145, 0, 7, 0, 0, 4, 145, 0, 0, 153, 62, 0, 0,
+    10, 32, 7, 158, 7, 7, 51, 51, 51, 78, 7, 32, 0, 7, 7, 7,
+    0, 0, 28, 7, 0, 0, 0, 74, 0, 0, 0, 0, 7, 54, 10, 25,
+    17, 127, 10, 48, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 165,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0,
+    165, 0, 0, 0, 0, 0, 0, 168, 0, 168, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 165, 165, 0, 0, 0, 0, 0, 0, 165, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 165, 0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 168, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 165, 165, 0, 0, 0, 0, 0, 0, 0,
+    162, 0, 0, 165, 162, 162, 165, 165, 0, 0, 0, 0, 0, 0, 168, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0,
+    0, 10, 0, 165, 0, 0, 0, 10, 0, 0, 0, 0, 174, 0, 0, 0,
+    0, 0, 25, 0, 0, 0, 0, 10, 32, 162, 0, 0, 54, 112, 54, 1,
+    0, 145, 51, 51, 32, 51, 62, 0, 0, 178, 0, 0, 0, 0, 25, 54,
+    0, 10, 0, 0, 10, 0, 0, 1, 0, 0, 10, 0, 25, 0, 0, 0,
+    162, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 51, 0, 0, 0, 0,
+    0, 0, 0, 54, 0, 0, 4, 182, 0, 0, 10, 0, 0, 0, 0, 32,
+    0, 0, 0, 0, 0, 1, 0, 10, 0, 0, 7, 0, 0, 1, 1, 32,
+    0, 185, 0, 182, 0, 0, 1, 0, 54, 0, 0, 182, 0, 162, 0, 0,
+    162, 162, 0, 0, 127, 0, 0, 0, 0, 0, 0, 48, 32, 1, 0, 10,
+    0, 130, 0, 48, 189, 0, 194, 104, 182, 0, 4, 32, 104, 100, 48, 0,
+    0, 4, 0, 0, 0, 145, 0, 0, 104, 32, 0, 0, 0, 104, 0, 200,
+    0, 0, 0, 0, 0, 32, 145, 51, 0, 0, 0, 0, 32, 0, 0, 0,
+    127, 162, 0, 0, 0, 194, 206, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 25, 0, 104, 0, 48, 104, 0, 0, 162, 162, 10, 0, 165, 0, 210,
+    0, 104, 216, 0, 0, 10, 0, 25, 25, 0, 0, 0, 17, 127, 182, 0,
+    0, 0, 162, 0, 165, 25, 162, 0, 0, 0, 0, 0, 0, 171, 0, 0,
+    0, 0, 165, 0, 0, 0, 1, 0, 0, 145, 219, 145, 145, 0, 0, 104,
+    0, 0, 48, 222, 162, 127, 226, 0, 10, 25, 231, 0, 0, 104, 200, 127,
+    25, 0, 0, 0, 17, 0, 0, 0, 145, 48, 54, 51, 0, 165, 54, 54,
+    10, 145, 0, 54, 1, 127, 235, 0, 104, 0, 7, 0, 0, 7, 48, 0,
+    165, 171, 0, 240, 44, 0, 100, 44, 25, 104, 0, 127, 206, 145, 0, 0,
+    0, 0, 0, 145, 104, 0, 32, 104, 0, 162, 0, 0, 0, 10, 32, 145,
+    145, 1, 245, 4, 0, 32, 0, 0, 32, 10, 127, 0, 74, 0, 171, 0,
+    32, 0, 0, 0, 0, 4, 4, 0, 0, 51, 0, 0, 7, 4, 0, 0,
+    7, 0, 7, 13, 249, 0, 10, 10, 0, 0, 4, 0, 4, 0, 4, 0,
+    254, 258, 0, 62, 0, 48, 0, 0, 0, 0, 0, 0, 216, 0, 0, 127,
+    0, 62, 216, 165, 0, 0, 0, 0, 0, 0, 0, 7, 0, 4, 4, 0,
+    0, 0, 0, 0, 0, 216, 7, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+    0, 0, 10, 10, 0, 0, 0, 0, 249, 62, 4, 262, 51, 0, 7, 162,
+    145, 0, 62, 1, 0, 0, 0, 7, 0, 0, 0, 0, 0, 54, 25, 0,
+    0, 54, 54, 267, 0, 25, 54, 0, 10, 0, 74, 4, 78, 10, 7, 0,
+    0, 0, 7, 25, 0, 0, 32, 0, 0, 0, 0, 10, 0, 0, 0, 0,
+    216, 62, 51, 0, 162, 0, 0, 0, 7, 0, 62, 7, 0, 51, 0, 48,
+    127, 0, 162, 0, 0, 10, 0, 0, 0, 127, 0, 0, 10, 0, 32, 0,
+    25, 0, 0, 0, 171, 162, 0, 0, 0, 1, 182, 0, 0, 0, 0, 25,
+    0, 0, 0, 0, 271, 127, 4, 219, 0, 0, 165, 0, 145, 1, 0, 10,
+    0, 0, 0, 0, 0, 162, 0, 25, 0, 0, 0, 0, 10, 25, 25, 0,
+    0, 48, 48, 0, 0, 0, 32, 1, 0, 162, 0, 0, 0, 127, 276, 7,
+    0, 162, 0, 0, 127, 104, 0, 32, 127, 104, 162, 48, 0, 104, 145, 32,
+    0, 7, 7, 104, 219, 127, 281, 0, 165, 127, 0, 0, 171, 0, 0, 0,
+    145, 0, 0, 168, 32, 25, 0, 104, 104, 112, 286, 0, 0, 0, 0, 0,
+    0, 32, 0, 0, 0, 0, 0, 127, 0, 0, 145, 0, 0, 4, 0, 219,
+    0, 7, 32, 162, 0, 0, 0, 291, 0, 0, 0, 32, 0, 0, 0, 4,
+    0, 1, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145,
+    0, 0, 145, 32, 0, 0, 0, 32, 0, 0, 4, 1, 162, 1, 0, 0,
+    0, 162, 0, 7, 62, 7, 0, 0, 0, 0, 10, 25, 0, 0, 21, 0,
+    0, 0, 216, 0, 1, 0, 0, 145, 1, 0, 0, 0, 0, 0, 0, 51,
+    10, 0, 0, 0, 51, 10, 0, 0, 0, 10, 178, 1, 0, 0, 7, 0,
+    216, 54, 0, 10, 0, 0, 0, 182, 0, 0, 54, 0, 0, 1, 25, 0,
+    0, 10, 25, 0, 25, 10, 10, 25, 17, 25, 0, 54, 10, 10, 0, 7,
+    32, 0, 0, 0, 145, 0, 0, 162, 0, 182, 0, 0, 0, 7, 0, 0,
+    0, 54, 0, 0, 0, 25, 0, 296, 10, 104, 0, 0, 112, 0, 0, 1,
+    54, 301, 0, 1, 0, 25, 25, 7, 0, 0, 10, 0, 0, 0, 0, 0,
+    32, 0, 162, 0, 0, 32, 0, 0, 168, 32, 0, 104, 51, 62, 0, 162,
+    1, 48, 32, 0, 0, 7, 162, 0, 127, 306, 0, 145, 0, 32, 162, 0,
+    10, 0, 70, 216, 0, 51, 0, 145, 32, 145, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 0, 162, 51, 1, 162, 51, 4, 0, 0, 0, 0, 0,
+    0, 0, 165, 0, 104, 62, 62, 0, 168, 0, 0, 0, 0, 0, 0, 104,
+    310, 0, 0, 0, 315, 0, 7, 0, 7, 168, 0, 1, 4, 32, 0, 0,
+    0, 104, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0,
+    0, 0, 145, 62, 145, 1, 0, 0, 7, 0, 0, 7, 165, 216, 0, 0,
+    0, 162, 0, 0, 182, 10, 0, 48, 0, 10, 10, 0, 0, 319, 25, 0,
+    0, 25, 0, 0, 0, 10, 0, 0, 0, 0, 0, 10, 25, 4, 0, 4,
+    48, 0, 0, 25, 0, 32, 127, 182, 0, 162, 0, 0, 0, 1, 0, 1,
+    0, 32, 0, 32, 0, 325, 0, 0, 10, 0, 0, 0, 4, 165, 0, 0,
+    4, 0, 0, 0, 1, 0, 0, 1, 145, 62, 0, 104, 165, 10, 32, 91,
+    0, 0, 162, 0, 0, 1, 0, 145, 1, 1, 0, 0, 0, 0, 0, 0,
+    7, 7, 0, 7, 0, 0, 0, 25, 0, 4, 4, 25, 0, 0, 0, 48,
+    104, 0, 4, 7, 48, 0, 32, 32, 0, 0, 0, 0, 0, 0, 0, 7,
+    1, 162, 162, 222, 0, 32, 0, 0, 0, 162, 7, 7, 32, 0, 1, 0,
+    0, 7, 162, 162, 0, 0, 0, 65, 104, 10, 0, 0, 0, 32, 10, 0,
+    0, 0, 48, 0, 0, 162, 0, 162, 0, 32, 1, 0, 1, 182, 0, 0,
+    0, 0, 0, 4, 0, 32, 0, 54, 32, 0, 0, 0, 145, 329, 51, 0,
+    162, 162, 51, 168, 0, 0, 0, 0, 0, 0, 7, 51, 0, 7, 162, 0,
+    0, 0, 0, 0, 0, 0, 0, 334, 0, 145, 0, 51, 0, 51, 1, 0,
+    7, 0, 145, 0, 0, 0, 48, 0, 0, 0, 0, 162, 0, 0, 0, 0,
+    0, 0, 7, 4, 0, 0, 4, 0, 0, 0, 4, 0, 4, 1, 0, 0,
+    1, 0, 0, 0, 0, 54, 54, 25, 0, 0, 0, 0, 0, 182, 0, 0,
+    0, 0, 32, 0, 0, 0, 1, 0, 25, 0, 0, 7, 54, 219, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 4, 0, 32, 1,
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 32, 0, 216, 0, 0, 0,
+    0, 0, 54, 0, 145, 54, 0, 145, 0, 145, 145, 0, 54, 0, 0, 162,
+    104, 10, 329, 4, 13, 145, 162, 0, 0, 0, 0, 4, 10, 0, 0, 0,
+    4, 0, 10, 182, 127, 48, 182, 0, 145, 0, 0, 0, 4, 339, 0, 0,
+    0, 0, 0, 32, 0, 0, 344, 0, 0, 0, 32, 349, 48, 145, 0, 0,
+    1, 0, 0, 0, 0, 0, 1, 32, 0, 0, 1, 1, 0, 0, 145, 168,
+    162, 162, 0, 32, 4, 0, 127, 4, 0, 0, 25, 0, 0, 1, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 165, 32, 1, 0, 0, 0, 0,
+    4, 25, 0, 0, 0, 13, 0, 0, 0, 0, 0, 54, 0, 353, 0, 0,
+    165, 165, 0, 162, 145, 0, 0, 7, 0, 51, 10, 0, 182, 145, 0, 0,
+    0, 0, 0, 0, 0, 54, 0, 145, 1, 0, 0, 0, 0, 162, 0, 358,
+    0, 1, 0, 145, 0, 0, 0, 162, 51, 0, 1, 32, 0, 165, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 219, 0, 363, 0, 51, 0, 0, 0, 0,
+    7, 32, 1, 7, 7, 0, 7, 62, 0, 0, 7, 0, 0, 182, 0, 0,
+    0, 0, 4, 0, 0, 32, 0, 51, 32, 0, 182, 17, 0, 127, 0, 0,
+    7, 0, 162, 0, 127, 0, 0, 165, 0, 0, 0, 7, 10, 32, 0, 315,
+    4, 127, 0, 0, 0, 0, 0, 74, 0, 127, 0, 127, 25, 0, 0, 162,
+    10, 54, 0, 0, 0, 0, 17, 48, 4, 48, 0, 127, 48, 127, 10, 0,
+    0, 1, 0, 51, 0, 0, 0, 0, 0, 0, 104, 0, 145, 0, 10, 25,
+    0, 0, 0, 0, 0, 0, 7, 367, 0, 7, 145, 145, 0, 4, 0, 216,
+    25, 0, 0, 0, 4, 0, 0, 32, 249, 1, 0, 371, 375, 0, 145, 4,
+    4, 4, 10, 10, 104, 0, 0, 104, 25, 0, 0, 194, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 162, 25, 0, 145, 10, 0, 0, 17, 48, 162, 0,
+    0, 0, 48, 32, 0, 0, 0, 104, 104, 10, 25, 0, 4, 0, 10, 0,
+    25, 48, 148, 0, 0, 0, 165, 25, 0, 48, 17, 48, 127, 0, 0, 32,
+    48, 48, 62, 0, 62, 162, 182, 0, 0, 25, 0, 0, 0, 0, 0, 165,
+    0, 0, 48, 0, 0, 0, 0, 145, 162, 145, 0, 62, 162, 54, 0, 165,
+    10, 194, 379, 104, 0, 0, 0, 104, 21, 0, 10, 10, 25, 0, 32, 10,
+    162, 0, 0, 7, 162, 32, 74, 0, 51, 0, 0, 51, 51, 145, 216, 0,
+    0, 0, 0, 145, 0, 0, 104, 51, 0, 0, 0, 32, 0, 0, 168, 7,
+    0, 0, 32, 0, 4, 0, 249, 74, 10, 0, 51, 216, 0, 0, 7, 0,
+    4, 0, 1, 7, 267, 0, 162, 216, 216, 0, 62, 7, 7, 0, 51, 182,
+    0, 7, 0, 162, 54, 0, 0, 0, 4, 0, 0, 0, 0, 0, 51, 0,
+    165, 0, 0, 0, 54, 0, 0, 1, 0, 0, 107, 384, 0, 162, 32, 168,
+    32, 127, 388, 0, 162, 0, 0, 0, 0, 0, 104, 10, 10, 168, 0, 0,
+    0, 96, 0, 0, 0, 51, 0, 162, 25, 7, 0, 32, 0, 0, 0, 104,
+    127, 162, 104, 0, 0, 0, 0, 0, 25, 0, 0, 0, 162, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 0, 51, 162, 165, 0, 162, 0, 0, 219, 0,
+    0, 145, 171, 0, 162, 162, 51, 32, 0, 393, 0, 0, 168, 145, 219, 0,
+    1, 0, 165, 162, 216, 216, 0, 0, 145, 0, 0, 51, 182, 62, 397, 62,
+    1, 51, 0, 62, 7, 162, 32, 62, 51, 0, 51, 62, 0, 162, 0, 0,
+    216, 216, 0, 127, 216, 403, 162, 0, 145, 0, 182, 51, 0, 62, 0, 0,
+    51, 32, 32, 158, 0, 145, 162, 54, 0, 0, 0, 82, 165, 32, 32, 7,
+    162, 145, 145, 32, 0, 162, 145, 0, 0, 407, 0, 0, 0, 0, 0, 171,
+    0, 0, 0, 0, 168, 0, 0, 0, 219, 0, 407, 0, 0, 0, 407, 0,
+    0, 0, 0, 0, 219, 0, 168, 171, 171, 0, 0, 0, 0, 0, 0, 0,
+    171, 0, 0, 0, 162, 0, 407, 0, 162, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0,
+    0, 162, 0, 0, 0, 0, 0, 0, 0, 407, 0, 0, 219, 0, 0, 0,
+    0, 168, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 413, 0, 0, 0, 0, 416, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 162, 0, 0, 162,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 416, 416, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    413, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 168, 0, 0, 0,
+    410, 0, 165, 0, 168, 0, 0, 219, 162, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0,
+    0, 0, 0, 407, 413, 0, 0, 419, 0, 162, 0, 165, 168, 0, 0, 162,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0,
+    0, 0, 0, 0, 0, 168, 171, 0, 168, 0, 416, 416, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0,
+    0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 410, 0, 0, 0, 0, 0, 410, 0, 0, 0, 0, 0, 162, 0,
+    0, 0, 0, 162, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407,
+    0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 0, 0, 171, 0, 0, 219, 219, 168, 416, 219, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 62, 62, 0, 219, 0, 0, 0, 0, 182, 145,
+    0, 54, 0, 51, 54, 51, 0, 0, 182, 32, 0, 0, 51, 0, 0, 51,
+    51, 62, 32, 182, 0, 32, 51, 216, 0, 145, 162, 0, 162, 10, 104, 0,
+    0, 216, 51, 216, 0, 219, 0, 54, 216, 182, 145, 10, 0, 422, 0, 162,
+    0, 0, 0, 145, 10, 127, 104, 216, 182, 0, 0, 0, 0, 182, 216, 0,
+    54, 62, 0, 0, 0, 0, 51, 0, 0, 0, 54, 0, 62, 51, 0, 51,
+    0, 54, 384, 0, 427, 0, 0, 182, 51, 0, 182, 51, 0, 0, 216, 4,
+    0, 32, 4, 32, 0, 0, 0, 10, 4, 32, 182, 182, 62, 407, 216, 0,
+    0, 10, 0, 182, 0, 413, 0, 0, 0, 0, 413, 0, 0, 182, 0, 0,
+    168, 32, 62, 431, 407, 0, 0, 0, 32, 0, 51, 0, 0, 32, 32, 0,
+    0, 32, 0, 182, 4, 4, 436, 0, 51, 407, 32, 4, 32, 0, 407, 0,
+    51, 51, 440, 168, 145, 216, 32, 0, 54, 0, 0, 216, 0, 216, 219, 0,
+    0, 0, 0, 216, 0, 32, 10, 62, 436, 54, 182, 0, 0, 145, 1, 145,
+    145, 0, 32, 0, 216, 32, 216, 216, 182, 0, 416, 182, 219, 0, 0, 54,
+    182, 62, 0, 0, 0, 182, 216, 7, 104, 32, 32, 32, 216, 0, 219, 0,
+    32, 171, 0, 162, 168, 0, 0, 0, 51, 0, 407, 416, 182, 182, 182, 182,
+    216, 54, 182, 0, 216, 182, 0, 0, 216, 182, 216, 216, 32, 0, 0, 162,
+    0, 0, 216, 0, 182, 0, 62, 0, 145, 407, 0, 51, 0, 219, 168, 0,
+    0, 162, 127, 21, 219, 127, 127, 62, 413, 32, 0, 10, 0, 407, 0, 32,
+    182, 407, 0, 182, 0, 0, 127, 10, 0, 62, 0, 54, 407, 0, 0, 0,
+    10, 219, 162, 0, 0, 407, 0, 0, 0, 10, 32, 0, 0, 413, 162, 0,
+    407, 0, 10, 0, 127, 104, 104, 319, 10, 104, 0, 10, 0, 219, 393, 249,
+    0, 0, 10, 0, 0, 0, 0, 301, 127, 104, 165, 32, 446, 219, 10, 0,
+    32, 104, 145, 0, 7, 127, 407, 10, 182, 0, 0, 0, 10, 162, 10, 407,
+    216, 32, 0, 219, 127, 0, 162, 145, 168, 219, 182, 0, 32, 10, 0, 162,
+    407, 219, 219, 216, 0, 0, 0, 127, 0, 162, 219, 145, 407, 0, 0, 0,
+    162, 162, 0, 51, 0, 0, 162, 0, 127, 0, 4, 51, 32, 182, 216, 0,
+    0, 0, 0, 10, 407, 168, 413, 413, 10, 0, 10, 219, 413, 0, 0, 0,
+    0, 0, 10, 216, 0, 216, 127, 0, 0, 0, 182, 0, 182, 182, 407, 4,
+    145, 127, 0, 219, 1, 54, 446, 0, 32, 4, 0, 358, 219, 0, 145, 104,
+    379, 182, 0, 48, 0, 127, 219, 32, 54, 0, 127, 450, 1, 104, 104, 0,
+    216, 32, 407, 0, 0, 0, 407, 168, 162, 44, 0, 10, 0, 127, 162, 407,
+    162, 10, 0, 7, 0, 0, 216, 51, 0, 32, 32, 219, 51, 0, 32, 0,
+    0, 0, 62, 168, 162, 0, 0, 219, 165, 216, 51, 416, 0, 0, 0, 455,
+    0, 219, 219, 0, 145, 145, 145, 0, 413, 0, 145, 0, 182, 162, 0, 0,
+    1, 0, 0, 1, 0, 0, 32, 145, 384, 162, 51, 182, 0, 182, 54, 219,
+    145, 410, 145, 145, 168, 168, 32, 32, 407, 32, 0, 145, 407, 0, 104, 0,
+    0, 10, 407, 216, 32, 0, 459, 145, 145, 54, 62, 407, 216, 51, 51, 7,
+    0, 162, 168, 182, 62, 145, 162, 32, 145, 145, 0, 0, 145, 0, 51, 0,
+    127, 145, 0, 62, 384, 7, 0, 0, 0, 0, 62, 0, 51, 1, 465, 10,
+    407, 62, 216, 0, 4, 32, 62, 216, 145, 145, 62, 1, 145, 0, 162, 0,
+    471, 145, 182, 0, 162, 0, 182, 145, 168, 0, 0, 0, 0, 62, 62, 182,
+    0, 0, 0, 51, 0, 62, 62, 51, 0, 182, 62, 127, 162, 145, 182, 32,
+    0, 0, 182, 216, 51, 0, 182, 0, 32, 62, 51, 0, 62, 0, 0, 407,
+    145, 0, 51, 32, 0, 145, 0, 162, 0, 182, 0, 32, 182, 25, 0, 0,
+    0, 0, 0, 0, 162, 0, 407, 476, 0, 0, 0, 7, 10, 32, 162, 0,
+    182, 216, 62, 162, 54, 0, 0, 10, 182, 162, 0, 0, 1, 51, 216, 1,
+    0, 0, 51, 0, 1, 1, 0, 367, 363, 0, 162, 0, 32, 1, 1, 0,
+    0, 0, 0, 0, 0, 130, 25, 1, 162, 0, 51, 0, 54, 0, 407, 62,
+    0, 0, 51, 51, 0, 0, 182, 216, 182, 407, 0, 216, 482, 1, 62, 0,
+    0, 54, 182, 162, 145, 162, 62, 145, 62, 413, 0, 51, 127, 182, 168, 32,
+    407, 0, 112, 0, 0, 182, 0, 10, 0, 407, 0, 10, 127, 182, 32, 165,
+    127, 145, 145, 0, 367, 145, 100, 0, 0, 162, 10, 182, 0, 0, 219, 0,
+    10, 127, 482, 4, 486, 162, 0, 0, 407, 0, 0, 162, 0, 0, 162, 0,
+    162, 62, 0, 407, 413, 216, 0, 216, 182, 407, 162, 10, 127, 104, 182, 0,
+    62, 0, 10, 491, 407, 416, 0, 407, 0, 10, 0, 0, 10, 10, 182, 145,
+    127, 413, 10, 32, 51, 413, 182, 0, 32, 219, 0, 145, 413, 0, 0, 222,
+    0, 495, 162, 51, 0, 127, 162, 51, 168, 145, 0, 1, 145, 145, 182, 499,
+    0, 182, 0, 0, 127, 0, 145, 410, 0, 10, 162, 0, 10, 407, 62, 0,
+    504, 216, 358, 407, 162, 162, 62, 182, 0, 0, 162, 0, 162, 0, 168, 219,
+    0, 165, 0, 0, 0, 219, 407, 168, 48, 104, 0, 510, 267, 0, 62, 162,
+    407, 219, 145, 0, 0, 51, 0, 51, 446, 0, 216, 32, 413, 0, 145, 0,
+    162, 182, 162, 162, 0, 162, 0, 407, 0, 407, 0, 62, 407, 0, 397, 32,
+    416, 162, 216, 104, 407, 0, 0, 0, 216, 162, 171, 48, 0, 413, 0, 0,
+    145, 54, 216, 0, 0, 162, 515, 0, 182, 182, 0, 10, 168, 194, 216, 407,
+    0, 0, 145, 0, 216, 182, 0, 182, 367, 62, 10, 127, 10, 413, 145, 407,
+    10, 62, 0, 1, 145, 367, 127, 145, 32, 410, 0, 32, 216, 51, 145, 0,
+    0, 162, 0, 62, 182, 54, 216, 51, 145, 182, 216, 162, 519, 416, 491, 162,
+    62, 0, 7, 51, 7, 0, 0, 32, 0, 51, 219, 0, 0, 51, 182, 182,
+    182, 182, 216, 62, 219, 54, 267, 0, 367, 0, 51, 54, 407, 182, 4, 182,
+    0, 25, 4, 0, 182, 32, 216, 145, 0, 0, 10, 0, 0, 0, 10, 32,
+    51, 0, 455, 10, 0, 0, 51, 0, 0, 10, 10, 10, 0, 10, 10, 62,
+    145, 182, 54, 0, 262, 162, 145, 182, 0, 25, 117, 62, 407, 4, 0, 0,
+    168, 216, 168, 216, 62, 32, 145, 0, 32, 524, 182, 51, 0, 0, 162, 145,
+    219, 0, 145, 529, 145, 216, 0, 32, 0, 535, 0, 162, 0, 216, 216, 182,
+    413, 182, 182, 0, 0, 182, 162, 62, 0, 0, 10, 0, 4, 32, 0, 0,
+    0, 54, 54, 0, 0, 216, 10, 0, 145, 540, 51, 51, 0, 32, 10, 174,
+    182, 0, 1, 25, 10, 546, 10, 0, 216, 0, 62, 182, 10, 0, 0, 0,
+    0, 216, 54, 0, 455, 10, 0, 162, 219, 0, 127, 407, 216, 358, 0, 32,
+    145, 413, 145, 0, 0, 162, 62, 10, 62, 407, 219, 0, 145, 407, 145, 182,
+    162, 168, 104, 0, 0, 162, 168, 162, 0, 0, 0, 363, 407, 0, 216, 145,
+    32, 413, 127, 127, 0, 10, 104, 0, 48, 182, 32, 0, 162, 104, 222, 145,
+    0, 127, 104, 51, 0, 10, 416, 145, 32, 4, 0, 32, 0, 216, 0, 0,
+    10, 0, 145, 51, 51, 0, 104, 0, 145, 32, 0, 104, 0, 0, 168, 32,
+    262, 145, 349, 168, 0, 216, 162, 1, 0, 0, 51, 162, 145, 62, 51, 51,
+    51, 358, 358, 551, 0, 0, 62, 62, 0, 145, 407, 0, 32, 0, 62, 104,
+    0, 127, 162, 413, 0, 168, 51, 407, 0, 0, 127, 0, 0, 162, 32, 0,
+    25, 219, 51, 62, 0, 51, 145, 216, 0, 407, 0, 168, 0, 407, 0, 182,
+    407, 182, 182, 216, 32, 127, 0, 168, 407, 0, 62, 557, 216, 182, 62, 4,
+    0, 32, 0, 127, 413, 10, 0, 0, 0, 0, 0, 0, 168, 0, 162, 171,
+    127, 416, 0, 563, 62, 0, 162, 10, 0, 567, 0, 162, 571, 162, 0, 10,
+    162, 407, 104, 216, 0, 0, 32, 54, 0, 145, 162, 162, 0, 145, 162, 104,
+    0, 0, 162, 145, 407, 0, 219, 0, 10, 0, 145, 10, 32, 410, 0, 182,
+    0, 0, 0, 0, 0, 0, 0, 182, 416, 62, 104, 0, 51, 0, 162, 0,
+    384, 62, 216, 0, 0, 0, 413, 32, 0, 127, 145, 10, 32, 62, 0, 32,
+    10, 0, 0, 0, 407, 168, 10, 168, 162, 62, 162, 0, 0, 0, 0, 104,
+    162, 413, 0, 51, 0, 0, 54, 32, 0, 145, 62, 0, 162, 82, 7, 51,
+    62, 162, 4, 51, 168, 127, 0, 127, 32, 0, 216, 32, 10, 32, 0, 1,
+    575, 162, 25, 10, 25, 10, 0, 62, 145, 51, 0, 0, 216, 51, 54, 62,
+    145, 407, 216, 145, 416, 182, 32, 182, 32, 216, 32, 4, 62, 0, 0, 162,
+    127, 0, 145, 0, 0, 182, 0, 51, 182, 407, 0, 162, 162, 62, 407, 0,
+    580, 0, 0, 32, 182, 0, 219, 0, 0, 10, 162, 219, 216, 104, 0, 416,
+    0, 216, 0, 455, 419, 407, 145, 32, 62, 0, 162, 0, 62, 0, 165, 0,
+    162, 0, 0, 216, 0, 51, 584, 54, 62, 182, 0, 416, 162, 0, 219, 427,
+    62, 162, 1, 182, 0, 416, 145, 0, 145, 0, 416, 0, 0, 0, 0, 0,
+    182, 168, 416, 0, 62, 32, 0, 546, 0, 0, 62, 145, 51, 589, 182, 82,
+    0, 145, 219, 25, 413, 0, 0, 407, 0, 51, 0, 62, 0, 0, 0, 51,
+    216, 145, 0, 171, 182, 0, 51, 32, 51, 0, 0, 358, 62, 0, 62, 0,
+    0, 62, 0, 0, 162, 216, 182, 0, 182, 62, 216, 219, 0, 4, 32, 0,
+    0, 145, 51, 0, 62, 54, 0, 0, 145, 182, 0, 32, 51, 0, 216, 51,
+    0, 32, 54, 51, 54, 62, 0, 0, 0, 0, 407, 0, 267, 216, 413, 219,
+    219, 168, 51, 413, 219, 54, 0, 0, 0, 51, 62, 0, 62, 455, 0, 0,
+    219, 182, 0, 407, 32, 44, 0, 62, 54, 7, 0, 51, 4, 165, 62, 0,
+    216, 104, 32, 407, 0, 32, 62, 182, 32, 0, 62, 363, 0, 162, 32, 32,
+    4, 0, 145, 0, 0, 145, 0, 515, 0, 51, 51, 219, 182, 0, 216, 0,
+    165, 32, 0, 51, 0, 393, 0, 182, 0, 219, 32, 32, 162, 0, 407, 162,
+    0, 0, 182, 32, 0, 0, 104, 178, 4, 0, 0, 0, 104, 104, 162, 32,
+    0, 0, 145, 0, 216, 0, 145, 0, 145, 168, 0, 216, 171, 0, 0, 0,
+    0, 32, 0, 54, 127, 0, 0, 104, 104, 0, 162, 407, 0, 32, 62, 182,
+    127, 104, 182, 0, 182, 145, 407, 145, 407, 51, 4, 104, 0, 168, 0, 10,
+    162, 407, 162, 127, 216, 593, 410, 0, 32, 32, 171, 32, 127, 0, 145, 62,
+    51, 51, 51, 0, 0, 0, 0, 0, 0, 168, 0, 0, 168, 200, 0, 162,
+    0, 0, 168, 0, 171, 145, 580, 168, 162, 168, 162, 127, 182, 0, 219, 25,
+    104, 104, 182, 0, 62, 0, 162, 32, 0, 1, 0, 0, 145, 216, 0, 0,
+    219, 407, 0, 0, 162, 0, 0, 0, 145, 145, 162, 1, 407, 51, 0, 262,
+    32, 416, 145, 162, 0, 407, 54, 182, 0, 127, 32, 0, 0, 0, 54, 0,
+    0, 4, 182, 32, 0, 216, 54, 216, 0, 0, 0, 54, 145, 407, 216, 145,
+    0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 32, 182, 51, 51, 162,
+    62, 62, 162, 10, 162, 32, 168, 0, 145, 10, 145, 0, 0, 54, 216, 0,
+    127, 0, 0, 219, 104, 0, 1, 162, 162, 162, 127, 4, 145, 162, 51, 162,
+    0, 0, 0, 4, 0, 168, 51, 32, 0, 1, 145, 145, 219, 51, 0, 0,
+    145, 51, 145, 51, 145, 62, 51, 62, 476, 51, 51, 145, 168, 182, 54, 0,
+    0, 0, 0, 162, 162, 0, 162, 0, 0, 48, 127, 0, 0, 168, 216, 0,
+    162, 0, 32, 32, 0, 145, 0, 0, 51, 0, 162, 162, 145, 0, 162, 162,
+    407, 407, 407, 0, 51, 0, 182, 598, 62, 262, 416, 0, 145, 51, 0, 219,
+    216, 162, 0, 51, 0, 0, 145, 51, 0, 32, 267, 182, 32, 182, 0, 413,
+    0, 62, 0, 0, 51, 0, 0, 51, 51, 162, 0, 127, 0, 51, 0, 162,
+    216, 162, 104, 0, 216, 0, 168, 0, 0, 162, 413, 145, 10, 145, 145, 222,
+    0, 413, 145, 407, 0, 0, 407, 219, 375, 104, 363, 62, 168, 54, 127, 127,
+    10, 0, 0, 10, 162, 0, 219, 0, 0, 602, 21, 145, 162, 0, 216, 219,
+    519, 0, 162, 54, 127, 54, 182, 104, 413, 0, 416, 407, 62, 0, 127, 0,
+    162, 10, 1, 0, 51, 127, 219, 0, 51, 0, 51, 0, 0, 416, 407, 62,
+    0, 0, 32, 416, 0, 606, 0, 127, 222, 407, 162, 0, 219, 219, 216, 127,
+    162, 0, 206, 25, 1, 413, 407, 0, 10, 145, 145, 407, 10, 0, 416, 51,
+    0, 0, 62, 145, 0, 32, 0, 0, 1, 1, 0, 0, 262, 0, 145, 0,
+    165, 51, 145, 62, 7, 145, 51, 0, 127, 7, 0, 0, 0, 145, 0, 0,
+    0, 10, 54, 216, 416, 168, 219, 0, 0, 0, 10, 216, 0, 216, 0, 168,
+    10, 0, 0, 216, 0, 0, 0, 216, 162, 10, 10, 0, 162, 216, 0, 0,
+    407, 0, 0, 0, 10, 407, 127, 216, 0, 216, 104, 407, 127, 610, 0, 104,
+    104, 0, 48, 216, 168, 615, 48, 0, 219, 10, 10, 0, 407, 10, 0, 104,
+    0, 10, 0, 0, 10, 0, 32, 0, 10, 145, 621, 127, 104, 216, 127, 0,
+    10, 0, 1, 0, 104, 216, 0, 182, 104, 162, 216, 162, 0, 182, 162, 182,
+    0, 407, 104, 104, 0, 0, 0, 10, 4, 216, 4, 162, 182, 0, 10, 10,
+    4, 0, 127, 10, 0, 168, 0, 407, 0, 219, 162, 127, 0, 25, 162, 0,
+    0, 0, 0, 168, 219, 407, 145, 182, 32, 0, 100, 104, 127, 219, 216, 407,
+    416, 216, 216, 162, 0, 165, 168, 168, 145, 51, 0, 0, 162, 32, 416, 182,
+    0, 407, 7, 0, 216, 62, 145, 32, 145, 407, 0, 0, 0, 216, 0, 7,
+    162, 407, 0, 219, 0, 407, 0, 7, 32, 62, 0, 0, 0, 0, 0, 54,
+    0, 10, 216, 216, 32, 0, 0, 0, 407, 32, 32, 1, 0, 168, 32, 0,
+    0, 145, 0, 62, 0, 0, 0, 407, 10, 145, 145, 32, 0, 0, 32, 51,
+    54, 51, 7, 182, 0, 32, 407, 32, 32, 0, 0, 0, 407, 62, 62, 32,
+    182, 219, 62, 51, 0, 216, 0, 54, 407, 162, 51, 10, 10, 10, 0, 0,
+    0, 145, 626, 216, 219, 0, 62, 145, 0, 168, 32, 0, 219, 171, 216, 0,
+    216, 0, 51, 0, 32, 145, 0, 0, 145, 0, 0, 0, 0, 0, 10, 0,
+    32, 32, 0, 127, 0, 127, 216, 0, 112, 1, 219, 10, 168, 358, 54, 216,
+    0, 182, 182, 10, 168, 10, 32, 62, 127, 104, 219, 0, 407, 32, 32, 0,
+    62, 0, 219, 413, 62, 162, 162, 54, 0, 0, 0, 162, 416, 219, 162, 416,
+    0, 0, 162, 104, 416, 32, 182, 0, 0, 32, 219, 145, 0, 162, 216, 413,
+    216, 145, 0, 0, 0, 168, 216, 162, 407, 407, 145, 0, 0, 416, 0, 216,
+    0, 145, 145, 413, 145, 4, 219, 216, 0, 182, 104, 182, 407, 0, 182, 182,
+    216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 219, 0, 0, 0, 0, 413, 0, 0, 0, 168, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0,
+    0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 407, 0, 0, 0, 0, 0,
+    0, 0, 0, 219, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0,
+    0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 168, 168, 407, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 630, 0, 0, 0, 0, 0, 416, 0, 0, 0, 0, 0, 0, 168, 0,
+    633, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 636, 0, 219,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 416, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 633, 0, 0, 0, 0, 0, 0,
+    0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    162, 0, 0, 0, 0, 0, 630, 0, 413, 0, 0, 0, 0, 0, 413, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 640, 0, 0, 0, 413, 413, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 0, 0, 168, 0,
+    0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0,
+    0, 413, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 416, 0, 0, 0, 630, 630, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 644, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 640, 644, 413, 0, 0, 407, 0, 413, 0, 0, 413,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 168,
+    0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 216, 0, 216, 0, 216, 216, 216, 62,
+    62, 216, 219, 32, 216, 182, 162, 216, 407, 216, 182, 62, 219, 219, 182, 0,
+    32, 216, 10, 62, 626, 219, 216, 0, 403, 216, 216, 162, 413, 219, 182, 104,
+    182, 407, 51, 407, 182, 32, 0, 219, 51, 32, 62, 62, 182, 32, 127, 630,
+    32, 168, 32, 644, 32, 216, 51, 0, 182, 51, 216, 413, 416, 219, 182, 62,
+    0, 0, 407, 0, 644, 0, 0, 216, 182, 62, 216, 182, 51, 0, 62, 182,
+    62, 182, 413, 182, 182, 216, 182, 182, 182, 413, 182, 219, 62, 219, 0, 182,
+    0, 216, 32, 182, 216, 219, 162, 182, 216, 216, 162, 162, 0, 0, 630, 407,
+    162, 162, 216, 216, 219, 182, 647, 216, 182, 584, 651, 630, 127, 407, 168, 162,
+    219, 633, 633, 0, 407, 219, 407, 104, 168, 216, 182, 162, 0, 162, 219, 168,
+    162, 216, 219, 0, 0, 10, 219, 0, 416, 10, 216, 104, 0, 633, 219, 104,
+    216, 182, 182, 0, 127, 0, 104, 168, 62, 10, 10, 10, 168, 0, 127, 182,
+    168, 219, 168, 416, 413, 127, 0, 168, 28, 127, 162, 413, 407, 216, 62, 145,
+    416, 216, 0, 104, 491, 216, 407, 32, 44, 10, 219, 32, 644, 32, 216, 407,
+    657, 104, 216, 0, 630, 32, 0, 0, 168, 182, 168, 32, 0, 104, 216, 413,
+    104, 10, 216, 219, 182, 0, 413, 0, 219, 10, 10, 162, 219, 216, 219, 168,
+    168, 219, 162, 162, 416, 219, 416, 62, 168, 145, 145, 413, 0, 0, 216, 62,
+    145, 145, 145, 0, 145, 182, 219, 145, 32, 182, 182, 216, 455, 127, 51, 0,
+    0, 0, 216, 62, 216, 407, 0, 644, 0, 182, 51, 403, 182, 51, 0, 455,
+    216, 32, 182, 216, 182, 0, 216, 427, 216, 62, 127, 0, 216, 216, 145, 0,
+    182, 216, 216, 216, 182, 216, 182, 0, 0, 168, 216, 216, 51, 0, 145, 145,
+    182, 145, 510, 216, 416, 661, 10, 0, 32, 51, 219, 168, 216, 182, 216, 0,
+    10, 182, 216, 182, 127, 51, 162, 182, 145, 32, 10, 127, 182, 168, 127, 0,
+    216, 216, 216, 0, 0, 219, 0, 0, 0, 62, 182, 216, 182, 0, 32, 524,
+    644, 182, 216, 51, 62, 0, 216, 407, 633, 62, 162, 0, 216, 182, 216, 182,
+    216, 413, 216, 182, 416, 62, 407, 62, 182, 413, 219, 219, 182, 630, 633, 413,
+    62, 28, 51, 0, 51, 182, 127, 127, 216, 630, 0, 162, 62, 168, 162, 216,
+    219, 413, 413, 413, 32, 216, 219, 182, 10, 162, 216, 216, 32, 216, 216, 127,
+    127, 51, 219, 413, 407, 630, 216, 219, 10, 0, 0, 104, 416, 162, 162, 127,
+    0, 413, 567, 162, 182, 216, 416, 162, 0, 0, 32, 62, 0, 162, 219, 416,
+    162, 413, 62, 162, 644, 407, 168, 0, 168, 62, 219, 219, 216, 416, 216, 633,
+    219, 0, 168, 32, 219, 145, 0, 145, 0, 182, 216, 216, 216, 145, 145, 216,
+    182, 371, 182, 216, 168, 216, 162, 219, 51, 216, 219, 10, 182, 416, 145, 219,
+    32, 219, 182, 219, 0, 216, 219, 62, 182, 644, 182, 0, 0, 62, 216, 0,
+    0, 0, 182, 0, 168, 0, 0, 216, 182, 667, 162, 219, 168, 32, 127, 216,
+    182, 219, 0, 644, 0, 32, 644, 32, 32, 162, 0, 162, 182, 62, 182, 626,
+    216, 145, 145, 182, 182, 182, 455, 0, 216, 62, 427, 127, 0, 10, 51, 162,
+    0, 168, 162, 219, 162, 216, 0, 10, 32, 32, 32, 127, 413, 216, 127, 0,
+    0, 32, 127, 32, 10, 219, 168, 0, 32, 162, 168, 0, 0, 168, 62, 0,
+    216, 182, 219, 104, 168, 672, 127, 0, 216, 219, 219, 0, 413, 216, 630, 644,
+    0, 416, 62, 0, 168, 0, 219, 182, 216, 162, 162, 127, 219, 168, 0, 216,
+    162, 216, 182, 0, 455, 127, 182, 219, 219, 162, 630, 162, 62, 104, 168, 216,
+    0, 182, 104, 567, 62, 145, 0, 162, 0, 219, 0, 219, 0, 219, 219, 416,
+    0, 182, 644, 182, 10, 216, 630, 413, 644, 216, 168, 0, 145, 647, 633, 0,
+    216, 216, 644, 162, 219, 182, 0, 168, 145, 62, 62, 51, 0, 0, 32, 219,
+    413, 145, 104, 676, 62, 51, 0, 182, 127, 162, 104, 51, 62, 168, 182, 413,
+    0, 104, 567, 162, 62, 0, 219, 0, 680, 407, 644, 0, 416, 162, 51, 455,
+    0, 168, 162, 567, 413, 216, 51, 145, 182, 0, 127, 0, 182, 62, 216, 0,
+    216, 407, 0, 145, 62, 104, 168, 182, 216, 0, 216, 0, 182, 644, 51, 51,
+    216, 182, 62, 182, 62, 0, 407, 0, 182, 0, 182, 0, 0, 182, 182, 62,
+    0, 162, 630, 104, 216, 182, 32, 182, 644, 644, 630, 104, 62, 62, 182, 145,
+    0, 0, 62, 219, 0, 182, 182, 182, 219, 182, 182, 51, 0, 182, 182, 0,
+    216, 216, 0, 182, 216, 0, 182, 216, 51, 413, 0, 0, 416, 32, 644, 182,
+    216, 127, 51, 168, 162, 0, 0, 219, 219, 162, 216, 0, 216, 0, 407, 644,
+    162, 407, 32, 162, 145, 0, 145, 0, 0, 630, 168, 216, 216, 413, 168, 32,
+    216, 0, 104, 127, 32, 0, 216, 413, 219, 407, 127, 413, 219, 0, 407, 127,
+    219, 168, 0, 162, 51, 104, 0, 685, 416, 51, 0, 416, 168, 0, 0, 407,
+    219, 168, 413, 162, 168, 104, 219, 10, 0, 216, 168, 216, 62, 0, 162, 162,
+    182, 216, 0, 0, 0, 32, 182, 219, 32, 0, 168, 262, 162, 216, 0, 32,
+    0, 0, 182, 32, 524, 182, 216, 32, 168, 0, 216, 0, 182, 219, 127, 32,
+    219, 182, 182, 219, 168, 127, 162, 127, 413, 0, 667, 0, 0, 168, 219, 219,
+    168, 32, 216, 216, 182, 216, 216, 127, 0, 162, 580, 162, 182, 168, 0, 32,
+    219, 62, 216, 182, 162, 219, 162, 216, 644, 407, 145, 416, 407, 145, 145, 0,
+    168, 162, 413, 407, 216, 62, 127, 168, 644, 162, 379, 216, 689, 693, 10, 0,
+    32, 219, 62, 62, 10, 10, 10, 168, 216, 630, 104, 127, 216, 10, 127, 413,
+    104, 216, 216, 630, 633, 127, 647, 32, 182, 0, 62, 407, 104, 216, 0, 62,
+    145, 162, 216, 0, 413, 407, 127, 127, 0, 62, 413, 127, 182, 127, 416, 127,
+    104, 145, 0, 145, 145, 216, 0, 0, 219, 219, 0, 216, 162, 633, 216, 182,
+    10, 32, 162, 219, 407, 216, 168, 104, 10, 0, 0, 168, 0, 0, 51, 413,
+    182, 219, 168, 216, 216, 127, 216, 0, 0, 32, 0, 219, 104, 0, 0, 182,
+    104, 62, 0, 0, 182, 182, 219, 182, 219, 644, 0, 0, 413, 0, 0, 10,
+    219, 413, 10, 0, 168, 32, 168, 0, 145, 403, 51, 216, 182, 182, 162, 162,
+    168, 219, 0, 62, 127, 182, 182, 216, 32, 524, 32, 219, 633, 32, 455, 413,
+    216, 168, 0, 32, 413, 182, 0, 219, 219, 32, 0, 0, 219, 216, 182, 32,
+    32, 0, 407, 0, 51, 182, 0, 0, 219, 216, 216, 0, 168, 168, 62, 127,
+    145, 51, 145, 168, 0, 104, 168, 162, 168, 216, 127, 127, 28, 127, 127, 672,
+    168, 219, 10, 216, 216, 0, 633, 0, 162, 216, 644, 0, 216, 407, 0, 0,
+    630, 182, 216, 182, 51, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    630, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 700, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407, 0, 0, 0,
+    0, 0, 407, 630, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 700, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 703, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 413, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    700, 0, 0, 0, 0, 0, 407, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 510, 436, 145, 145,
+    216, 145, 216, 0, 62, 216, 32, 216, 216, 62, 0, 216, 219, 219, 162, 413,
+    413, 219, 700, 703, 127, 436, 127, 0, 127, 0, 127, 162, 219, 32, 630, 413,
+    32, 413, 127, 216, 0, 216, 145, 0, 413, 145, 216, 216, 216, 216, 630, 407,
+    219, 10, 0, 216, 10, 216, 145, 145, 145, 145, 145, 216, 216, 407, 216, 700,
+    62, 216, 10, 413, 413, 127, 0, 0, 10, 10, 413, 413, 219, 162, 413, 219,
+    219, 32, 0, 0, 407, 0, 62, 127, 630, 162, 708, 216, 219, 10, 145, 10,
+    62, 10, 0, 162, 162, 162, 413, 127, 413, 127, 567, 700, 32, 0, 62, 127,
+    0, 0, 10, 127, 216, 219, 62, 162, 62, 0, 216, 162, 162, 219, 0, 219,
+    0, 630, 216, 0, 0, 0, 711, 32, 413, 0, 0, 630, 216, 216, 216, 413,
+    413, 62, 216, 216, 216, 216, 127, 0, 10, 216, 216, 216, 10, 216, 62, 644,
+    219, 413, 407, 413, 219, 127, 32, 413, 413, 162, 127, 32, 0, 413, 219, 413,
+    162, 162, 708, 216, 62, 219, 0, 216, 32, 413, 216, 422, 216, 216, 219, 219,
+    62, 219, 219, 145, 219, 219, 708, 630, 127, 62, 644, 708, 630, 127, 216, 0,
+    162, 162, 219, 413, 127, 127, 413, 219, 413, 413, 0, 216, 162, 407, 407, 219,
+    718, 219, 127, 219, 219, 162, 32, 700, 162, 0, 216, 219, 630, 0, 219, 219,
+    644, 219, 413, 32, 700, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 700, 0, 0, 0, 0, 0, 0, 0, 0, 723,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 723, 0, 0, 0, 731, 0, 0, 0, 723, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 723, 723, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 723, 0, 0, 0, 0, 0, 0, 723, 0, 734,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0,
+    0, 0, 0, 742, 0, 0, 0, 0, 0, 0, 0, 742, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 734, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 723, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 742, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 630, 0, 0, 0, 0, 0, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 723, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 62, 630, 216, 0, 0,
+    436, 0, 62, 127, 700, 216, 216, 219, 0, 127, 216, 216, 0, 413, 413, 219,
+    216, 127, 630, 216, 700, 219, 219, 127, 127, 219, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 750, 0, 0, 0, 0, 0, 750, 0, 750, 0, 0, 759, 0, 0, 759,
+    0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 759, 0, 0, 0, 0, 0, 0, 0, 0, 777, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 777, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    777, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 777, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0,
+    0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 750, 0, 750, 0, 0, 0, 0, 0, 0, 0, 777, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 795,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0,
+    750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 759, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 700, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 777, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 777, 777, 0, 0, 0, 0, 0, 0, 0, 777, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0,
+    0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0, 0, 750,
+    0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0,
+    0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 759, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    750, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0, 750, 0,
+    759, 0, 750, 0, 0, 0, 759, 0, 0, 0, 768, 0, 0, 0, 0, 0,
+    0, 0, 750, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 759, 0, 759,
+    0, 0, 0, 0, 62, 216, 216, 127, 127, 219, 0, 804, 0, 814, 0, 0,
+    0, 0, 824, 824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 834,
+    0, 0, 0, 0, 0, 0, 0, 804, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 844, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 854, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 854, 0, 0, 0,
+    854, 844, 0, 0, 0, 0, 0, 854, 854, 0, 0, 0, 0, 0, 0, 854,
+    864, 0, 864, 0, 874, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0,
+    854, 854, 0, 814, 874, 0, 0, 0, 0, 814, 0, 0, 0, 0, 844, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 844, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 814, 0, 0, 0, 0, 0, 0, 814, 0, 814, 0, 0, 0, 884,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0,
+    0, 854, 0, 0, 0, 0, 0, 844, 0, 0, 0, 0, 814, 0, 0, 0,
+    0, 0, 864, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 804, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 814, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0,
+    0, 894, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0, 0,
+    854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 894, 0, 904, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 824, 0, 0, 0, 814, 0, 0, 0,
+    854, 0, 0, 814, 0, 0, 874, 0, 0, 0, 824, 0, 0, 0, 0, 0,
+    914, 0, 814, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0,
+    904, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 874, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0, 0, 894, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0, 854, 0,
+    814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854,
+    854, 0, 0, 0, 0, 0, 814, 0, 904, 0, 0, 0, 0, 0, 0, 0,
+    854, 0, 0, 0, 894, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 914, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0,
+    824, 0, 0, 0, 0, 0, 0, 854, 0, 0, 814, 0, 0, 0, 0, 814,
+    0, 0, 0, 924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    904, 0, 0, 854, 0, 0, 0, 0, 0, 874, 0, 0, 0, 0, 854, 0,
+    0, 0, 874, 0, 0, 804, 0, 0, 874, 0, 0, 0, 0, 814, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 824, 0, 0, 0,
+    0, 0, 0, 844, 0, 0, 0, 0, 0, 0, 0, 844, 0, 0, 0, 0,
+    844, 0, 814, 0, 0, 854, 0, 0, 844, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 874, 0, 0, 0, 814,
+    0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 874, 0,
+    0, 864, 0, 0, 0, 0, 0, 0, 804, 814, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0,
+    854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 814, 0, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    814, 0, 854, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 854, 0, 0, 814, 0, 0, 814, 0, 0, 814,
+    854, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 874, 874, 0, 0, 854, 0,
+    0, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 945, 956, 956, 967, 0, 0, 0, 0, 0, 0, 0, 0, 978,
+    0, 0, 0, 0, 0, 0, 0, 989, 0, 0, 0, 0, 0, 0, 1000, 0,
+    0, 0, 989, 1011, 0, 0, 1022, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    934, 0, 0, 1033, 0, 0, 0, 0, 0, 0, 1000, 0, 0, 1033, 0, 1033,
+    934, 0, 0, 0, 0, 0, 956, 956, 0, 0, 0, 934, 0, 1044, 956, 0,
+    1055, 967, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1000, 0, 1044,
+    0, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 934,
+    934, 0, 989, 0, 0, 989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1033, 0, 0, 0, 0, 0, 0, 0, 0, 967, 0, 0, 1022, 0, 0, 0,
+    0, 0, 0, 0, 934, 0, 0, 0, 0, 0, 0, 967, 0, 0, 0, 0,
+    0, 0, 934, 0, 934, 0, 0, 0, 0, 0, 0, 1044, 0, 0, 0, 0,
+    0, 0, 0, 1033, 0, 0, 934, 934, 0, 0, 0, 0, 0, 0, 0, 0,
+    956, 0, 0, 934, 0, 0, 0, 0, 1033, 1033, 0, 0, 0, 0, 0, 0,
+    0, 934, 0, 0, 934, 0, 0, 0, 0, 1066, 0, 0, 1000, 0, 1066, 0,
+    1066, 0, 956, 0, 934, 0, 956, 0, 0, 0, 0, 0, 1066, 956, 0, 934,
+    0, 1022, 1077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 956, 0, 0, 989, 1066, 0, 956, 0, 1088, 1088, 967, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 934, 0, 0, 0, 0, 0, 956, 0,
+    0, 0, 0, 967, 0, 0, 934, 0, 0, 934, 0, 0, 0, 0, 0, 0,
+    0, 1033, 0, 0, 0, 0, 989, 0, 0, 0, 0, 0, 1077, 934, 0, 1099,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 989,
+    0, 967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 956, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 934, 0, 0, 0, 967, 0, 0, 0,
+    0, 0, 1033, 0, 0, 1066, 0, 956, 0, 0, 0, 0, 0, 0, 0, 934,
+    1000, 0, 0, 0, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    989, 0, 0, 0, 0, 0, 989, 0, 0, 0, 0, 0, 0, 1077, 0, 0,
+    0, 0, 1066, 934, 0, 0, 934, 0, 0, 0, 0, 0, 934, 0, 0, 934,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 989, 0, 978,
+    1077, 0, 0, 0, 1044, 0, 1033, 0, 0, 0, 0, 934, 0, 989, 0, 0,
+    0, 0, 0, 0, 934, 989, 1077, 0, 0, 1033, 0, 0, 0, 0, 0, 0,
+    0, 1033, 934, 0, 1033, 0, 0, 1066, 0, 0, 934, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 989, 0, 0, 0, 934, 1033,
+    0, 1033, 0, 0, 0, 0, 0, 967, 0, 0, 0, 0, 0, 934, 0, 934,
+    0, 934, 1033, 989, 0, 0, 0, 1044, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1066, 0, 0, 0, 956, 0, 0, 0, 0,
+    0, 0, 0, 1033, 1066, 0, 0, 0, 0, 0, 956, 1044, 934, 0, 0, 967,
+    956, 0, 1033, 0, 934, 0, 1110, 0, 0, 0, 0, 0, 0, 0, 978, 1121,
+    0, 0, 0, 0, 0, 0, 1066, 0, 0, 0, 1077, 0, 1066, 0, 0, 0,
+    0, 1033, 0, 0, 0, 0, 1055, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1055, 0, 0, 0, 934, 0, 0, 0, 0, 0, 1033, 0, 0, 0, 0, 0,
+    934, 0, 0, 1033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 934, 0, 0, 0, 0, 0, 0, 1132, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1077, 0, 0, 0, 0, 0, 1066, 0, 0, 0, 0, 0,
+    0, 0, 967, 0, 0, 0, 0, 1044, 956, 0, 0, 1000, 0, 0, 0, 0,
+    1000, 0, 0, 956, 0, 967, 0, 0, 0, 0, 0, 989, 934, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1110, 956, 0, 0, 989, 0, 0, 0, 934, 0, 0, 0, 0,
+    1033, 0, 0, 0, 0, 1022, 934, 0, 0, 0, 0, 0, 0, 934, 0, 0,
+    0, 0, 0, 0, 0, 967, 0, 0, 1033, 956, 956, 0, 0, 956, 0, 0,
+    956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1077, 0, 0, 0, 0, 1033, 0,
+    0, 1066, 0, 956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 934, 934,
+    0, 0, 0, 989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1143, 0, 0, 0, 0, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1077, 0, 0, 0, 0, 0, 0, 934, 1110, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 934, 0, 934, 0, 0, 0, 0, 0,
+    956, 0, 0, 0, 0, 1132, 0, 0, 934, 0, 1154, 0, 0, 0, 0, 0,
+    1166, 0, 0, 1178, 0, 0, 0, 0, 1190, 1202, 0, 0, 0, 1214, 0, 0,
+    0, 1154, 0, 0, 0, 0, 0, 0, 1226, 0, 0, 0, 0, 0, 0, 1190,
+    0, 0, 0, 0, 1238, 1238, 0, 0, 0, 0, 1238, 0, 1238, 0, 1214, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1190, 0, 0, 0, 0, 1250, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1166, 0, 0, 0, 1190, 1238, 0, 1262, 1190,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0, 1250, 0, 0, 0, 1274,
+    0, 1166, 0, 1274, 0, 1286, 1262, 0, 1298, 1166, 0, 0, 1310, 0, 1178, 0,
+    0, 0, 1274, 0, 0, 0, 0, 0, 1310, 0, 0, 0, 0, 1190, 0, 1262,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1298, 0, 0, 0, 0, 0, 0,
+    0, 1322, 0, 0, 1190, 1238, 1274, 0, 1154, 0, 0, 1274, 0, 1166, 1190, 0,
+    1262, 0, 0, 0, 0, 1214, 0, 1274, 0, 0, 1262, 1166, 1166, 1166, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1262, 0, 0, 0, 0, 1334, 1262,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1346, 0, 1154, 1358, 1358, 0, 0,
+    1262, 0, 1262, 1154, 1154, 0, 1262, 0, 0, 0, 0, 0, 0, 1190, 0, 0,
+    0, 1202, 0, 0, 0, 1298, 0, 0, 1178, 0, 1238, 0, 0, 1166, 0, 1166,
+    1262, 0, 1274, 1370, 1166, 0, 0, 0, 0, 0, 0, 1382, 0, 0, 0, 0,
+    0, 1262, 1154, 1274, 0, 1394, 1298, 0, 1214, 1262, 0, 0, 0, 0, 0, 0,
+    1274, 1166, 1166, 1178, 0, 0, 0, 1274, 0, 0, 0, 1274, 0, 1166, 0, 0,
+    1166, 1166, 0, 1166, 0, 1262, 0, 1298, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1262, 0, 0, 1166, 1166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1190, 0, 0, 0, 0, 0,
+    1406, 0, 1190, 0, 0, 0, 1286, 0, 0, 0, 0, 0, 1382, 0, 1178, 1262,
+    0, 1322, 1298, 1274, 1346, 1334, 0, 1166, 0, 1166, 0, 1262, 0, 1298, 1298, 0,
+    1346, 0, 1298, 0, 0, 1166, 1166, 0, 0, 0, 0, 0, 1334, 0, 1238, 0,
+    0, 1166, 1238, 1418, 0, 0, 1178, 0, 1322, 0, 0, 0, 1262, 0, 0, 0,
+    0, 1430, 0, 1166, 1166, 1430, 0, 0, 1166, 0, 0, 1166, 0, 0, 1166, 0,
+    0, 0, 1178, 1178, 0, 1178, 0, 0, 1178, 0, 0, 0, 0, 0, 0, 1190,
+    0, 0, 0, 0, 1298, 0, 0, 1262, 0, 1298, 0, 1262, 1298, 1250, 1310, 0,
+    0, 0, 0, 1166, 1166, 0, 0, 0, 0, 0, 0, 0, 1262, 0, 0, 1274,
+    0, 1166, 0, 1166, 1334, 1166, 0, 1274, 1298, 0, 1166, 0, 0, 0, 0, 0,
+    0, 0, 0, 1334, 0, 0, 0, 0, 0, 0, 0, 0, 1334, 0, 0, 1262,
+    0, 0, 0, 1274, 0, 0, 0, 0, 0, 1166, 0, 1442, 0, 1166, 0, 1310,
+    0, 0, 0, 1178, 0, 0, 1166, 0, 0, 0, 1166, 0, 0, 1298, 1298, 1454,
+    1238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1346, 1166, 0, 0,
+    1274, 0, 0, 1178, 0, 0, 0, 0, 0, 0, 0, 1286, 0, 0, 0, 1178,
+    0, 0, 0, 0, 1298, 0, 1334, 1262, 1334, 0, 0, 1430, 0, 0, 0, 0,
+    0, 0, 1154, 0, 0, 0, 0, 1154, 0, 0, 1262, 0, 0, 0, 0, 1334,
+    1382, 0, 1262, 0, 0, 0, 1166, 0, 0, 0, 0, 0, 0, 0, 1178, 0,
+    0, 0, 0, 1274, 0, 0, 1382, 0, 0, 0, 0, 1178, 0, 0, 1346, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1430, 0, 0, 1166, 0,
+    1466, 0, 0, 0, 0, 0, 1262, 0, 0, 0, 1190, 1190, 0, 0, 0, 1466,
+    1466, 0, 1406, 0, 0, 0, 1466, 0, 0, 1274, 0, 0, 0, 0, 0, 0,
+    0, 1298, 0, 1298, 0, 0, 0, 0, 0, 0, 0, 1346, 0, 0, 0, 0,
+    0, 0, 0, 0, 1310, 0, 0, 0, 0, 1166, 0, 0, 1262, 1334, 0, 0,
+    0, 1274, 0, 0, 0, 0, 0, 1166, 1166, 0, 0, 0, 0, 0, 1214, 1298,
+    0, 1382, 0, 0, 1274, 1346, 0, 0, 0, 0, 0, 0, 0, 0, 1274, 0,
+    1166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1478, 0, 0, 0, 1346, 0,
+    1262, 1274, 0, 0, 0, 1334, 0, 1274, 0, 1298, 0, 0, 0, 0, 0, 0,
+    0, 1166, 1154, 0, 1262, 0, 1262, 0, 0, 0, 0, 0, 1262, 1166, 0, 0,
+    0, 1166, 0, 0, 1166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1262, 0, 0, 1346, 0, 1382, 0, 0, 0, 1346, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1262, 0, 0, 0, 0, 0, 0, 1166, 0, 1166, 0, 0,
+    1166, 1166, 0, 0, 1274, 0, 0, 0, 0, 1166, 0, 0, 0, 0, 0, 0,
+    1166, 0, 0, 0, 0, 0, 1490, 0, 1503, 0, 0, 0, 1516, 0, 1516, 0,
+    0, 0, 0, 1529, 0, 0, 0, 1542, 0, 0, 1555, 0, 0, 0, 0, 1568,
+    0, 0, 0, 0, 1581, 1581, 1594, 1529, 1607, 1529, 0, 0, 0, 1555, 1620, 0,
+    1633, 1646, 1555, 0, 1659, 1646, 0, 1646, 0, 0, 1607, 0, 0, 1529, 0, 0,
+    1555, 0, 1490, 0, 1568, 0, 0, 0, 0, 0, 1672, 0, 0, 1672, 0, 1646,
+    0, 1555, 1529, 0, 0, 0, 1685, 0, 1698, 0, 1711, 1724, 1568, 1672, 0, 0,
+    1503, 0, 0, 0, 1724, 0, 0, 0, 1737, 0, 1724, 1503, 0, 1750, 0, 0,
+    1763, 1776, 0, 1789, 0, 0, 1620, 1620, 0, 0, 0, 1620, 0, 1711, 0, 1711,
+    1698, 0, 0, 1711, 0, 0, 0, 1490, 0, 0, 0, 0, 1503, 1802, 1503, 0,
+    0, 1815, 0, 0, 1620, 1620, 1529, 0, 0, 0, 0, 0, 0, 1724, 1555, 0,
+    0, 0, 1555, 0, 1568, 1594, 0, 0, 1828, 0, 0, 1568, 0, 0, 1620, 0,
+    0, 1620, 0, 0, 1711, 0, 0, 0, 1711, 0, 0, 0, 1620, 0, 1841, 1490,
+    1854, 1802, 1620, 1529, 0, 1607, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1542,
+    1867, 0, 1529, 0, 0, 0, 0, 1815, 1724, 0, 0, 0, 1867, 1867, 0, 1503,
+    1724, 0, 1776, 0, 0, 0, 1880, 1620, 0, 1711, 1490, 0, 0, 1503, 0, 0,
+    1776, 1503, 1893, 0, 0, 1724, 0, 1724, 0, 1620, 1880, 1503, 1529, 1529, 0, 1542,
+    1906, 0, 0, 0, 0, 0, 0, 0, 0, 1659, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1724, 0, 0, 0, 0, 0, 0, 0, 1529, 0, 1607,
+    0, 0, 1919, 0, 0, 0, 1542, 0, 0, 0, 0, 1711, 0, 1724, 1698, 1750,
+    1867, 1672, 0, 1854, 0, 0, 0, 1880, 0, 1724, 0, 1880, 1724, 0, 0, 0,
+    0, 1594, 1724, 0, 0, 1711, 0, 1763, 0, 0, 0, 0, 0, 1854, 1568, 0,
+    1568, 0, 0, 0, 0, 1724, 1724, 0, 0, 0, 1815, 0, 1646, 0, 0, 0,
+    0, 1529, 0, 0, 0, 0, 1880, 0, 0, 0, 0, 0, 0, 0, 1724, 0,
+    0, 1724, 0, 1724, 0, 0, 1568, 1568, 1620, 0, 0, 0, 1724, 1854, 0, 0,
+    1711, 0, 0, 0, 0, 0, 0, 0, 1620, 0, 0, 0, 0, 0, 1555, 0,
+    1932, 0, 1516, 0, 0, 0, 0, 0, 0, 1724, 1503, 1854, 0, 0, 0, 1672,
+    1568, 1724, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1945, 0, 0, 1685, 0,
+    0, 0, 0, 0, 1672, 0, 0, 1893, 1854, 0, 0, 0, 1854, 0, 0, 1568,
+    0, 0, 1568, 1672, 0, 0, 0, 0, 1815, 1815, 1724, 0, 0, 0, 0, 0,
+    0, 0, 1698, 0, 1958, 1620, 0, 0, 1711, 0, 0, 0, 1815, 1620, 1620, 1932,
+    0, 1711, 1620, 0, 1958, 1620, 1698, 0, 0, 0, 0, 0, 1815, 1815, 0, 0,
+    1529, 1646, 0, 1711, 1815, 0, 0, 1815, 1815, 0, 0, 0, 0, 0, 0, 0,
+    1880, 0, 0, 0, 0, 0, 0, 1698, 0, 1555, 0, 0, 1789, 0, 1789, 0,
+    0, 0, 1620, 0, 0, 0, 0, 0, 1490, 0, 1555, 0, 0, 1971, 1711, 0,
+    1724, 0, 1503, 0, 1503, 0, 1503, 1503, 1958, 0, 1880, 1503, 0, 0, 0, 1750,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1763, 0, 1815, 0, 1854, 0,
+    0, 0, 0, 1724, 0, 1672, 0, 1503, 0, 0, 0, 1698, 0, 1620, 1503, 0,
+    1854, 1880, 0, 1893, 0, 0, 0, 1672, 1776, 0, 1776, 0, 0, 1503, 0, 1620,
+    1737, 0, 0, 1711, 1776, 0, 0, 1516, 1984, 1503, 1776, 0, 0, 1932, 0, 0,
+    0, 0, 0, 1672, 0, 0, 0, 0, 1529, 1620, 1815, 0, 0, 0, 0, 0,
+    1724, 1724, 0, 0, 1724, 1711, 0, 0, 0, 1854, 0, 1503, 0, 0, 0, 0,
+    1620, 0, 0, 1815, 1724, 0, 0, 1659, 1607, 0, 1997, 0, 1503, 0, 0, 0,
+    1711, 1568, 1503, 0, 1724, 0, 1503, 1724, 1724, 0, 0, 1711, 1503, 0, 1503, 1503,
+    0, 1724, 1711, 1724, 1724, 0, 1503, 0, 1724, 0, 1724, 1724, 0, 2010, 1620, 0,
+    0, 2023, 2037, 0, 0, 2051, 2065, 0, 0, 2079, 0, 2093, 0, 2107, 0, 0,
+    0, 2121, 0, 0, 2065, 2135, 0, 2065, 0, 2149, 2163, 0, 2177, 0, 2079, 2079,
+    0, 0, 0, 2191, 0, 0, 0, 0, 0, 0, 2149, 0, 0, 2205, 0, 0,
+    2023, 0, 0, 0, 0, 2219, 2233, 2205, 0, 0, 2079, 0, 2163, 0, 0, 0,
+    2247, 0, 0, 0, 0, 2177, 0, 2261, 0, 0, 2205, 0, 0, 2037, 2037, 2275,
+    0, 0, 2037, 2037, 0, 2289, 0, 0, 0, 0, 0, 2065, 0, 0, 2163, 0,
+    0, 2303, 0, 2177, 2317, 2317, 0, 2331, 0, 2149, 0, 2345, 2359, 0, 0, 2037,
+    0, 0, 0, 2037, 2037, 0, 2205, 2177, 0, 0, 2373, 0, 2163, 0, 0, 2191,
+    0, 2387, 0, 2205, 0, 0, 2079, 0, 2205, 2401, 0, 0, 2093, 0, 2401, 2415,
+    2219, 2401, 2429, 0, 2023, 2023, 0, 0, 2443, 2205, 0, 2443, 0, 2457, 0, 0,
+    0, 2471, 0, 0, 0, 2163, 2107, 0, 2443, 2485, 2485, 0, 0, 2079, 0, 0,
+    0, 0, 0, 2499, 0, 0, 0, 0, 2457, 2023, 0, 0, 2513, 0, 0, 0,
+    0, 2107, 0, 2121, 2121, 2527, 0, 2541, 2205, 2555, 0, 0, 0, 2569, 0, 2023,
+    2401, 0, 0, 2373, 0, 0, 2583, 0, 0, 2597, 0, 0, 0, 0, 2359, 2359,
+    0, 0, 0, 0, 0, 0, 2611, 0, 0, 0, 0, 0, 2191, 0, 0, 0,
+    0, 2023, 2401, 0, 0, 0, 2625, 0, 2443, 0, 0, 2177, 0, 2401, 2401, 2401,
+    0, 0, 2205, 2555, 0, 0, 0, 0, 2555, 0, 0, 0, 0, 0, 0, 2065,
+    0, 2317, 2275, 2499, 2219, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 2639,
+    2653, 0, 0, 0, 2359, 0, 2555, 0, 0, 0, 0, 2219, 0, 0, 2569, 2653,
+    2443, 0, 2177, 2065, 0, 0, 2359, 0, 2079, 2401, 2205, 2205, 2401, 0, 2037, 0,
+    0, 0, 0, 0, 2485, 0, 2219, 0, 2037, 2233, 2499, 0, 0, 0, 0, 0,
+    0, 2065, 0, 2065, 2667, 2681, 0, 0, 2065, 0, 0, 0, 0, 2569, 0, 0,
+    0, 0, 0, 0, 2513, 2443, 2317, 2317, 0, 0, 2695, 0, 2499, 2457, 2331, 2709,
+    0, 0, 0, 2177, 2289, 2331, 2443, 0, 2401, 2023, 2023, 0, 0, 0, 0, 0,
+    0, 2485, 0, 0, 2093, 2443, 2093, 0, 2723, 2653, 0, 0, 0, 2401, 0, 0,
+    0, 2401, 2205, 2065, 2485, 0, 0, 2737, 2023, 2023, 0, 2485, 2485, 0, 0, 2723,
+    2639, 0, 0, 2723, 2023, 0, 0, 2275, 0, 2079, 0, 0, 2667, 2065, 2037, 2037,
+    2037, 2149, 0, 2135, 0, 0, 2653, 0, 0, 0, 2457, 0, 0, 2023, 0, 0,
+    0, 2443, 0, 0, 2751, 2485, 0, 2401, 0, 0, 0, 0, 2331, 0, 0, 2205,
+    0, 0, 2023, 2023, 0, 2205, 2401, 2401, 2401, 0, 0, 2765, 0, 0, 2780, 2795,
+    0, 0, 2810, 0, 0, 0, 0, 2825, 2825, 0, 2840, 2855, 0, 2810, 2870, 0,
+    0, 0, 0, 2885, 0, 0, 2855, 2855, 0, 0, 0, 0, 0, 2900, 2915, 2855,
+    2930, 2945, 0, 0, 0, 0, 2915, 0, 0, 2960, 0, 2855, 0, 0, 0, 0,
+    0, 2780, 0, 2975, 2990, 0, 3005, 2765, 2930, 0, 3020, 2810, 0, 0, 3035, 2960,
+    0, 0, 2870, 3050, 0, 3065, 3080, 0, 2765, 0, 0, 0, 2930, 0, 0, 2855,
+    0, 3095, 0, 3110, 0, 0, 3125, 2915, 3140, 2855, 0, 2780, 3155, 0, 0, 3170,
+    2930, 0, 3185, 3185, 0, 2795, 0, 3200, 2960, 0, 3215, 0, 3230, 0, 3245, 3260,
+    0, 0, 0, 0, 0, 3185, 3275, 0, 3080, 3080, 0, 3290, 3305, 3320, 0, 2915,
+    3335, 3305, 0, 0, 0, 3350, 3230, 0, 3365, 0, 0, 0, 0, 0, 2795, 2900,
+    0, 0, 2915, 0, 0, 0, 3380, 2990, 3395, 3155, 0, 0, 3410, 0, 3080, 3425,
+    0, 0, 2915, 0, 2870, 0, 3305, 0, 0, 3440, 0, 0, 0, 3455, 2780, 3470,
+    0, 2930, 0, 0, 0, 0, 0, 0, 0, 0, 3095, 0, 0, 3485, 0, 3455,
+    0, 3410, 0, 3155, 0, 0, 3305, 0, 3500, 0, 3380, 0, 0, 2870, 0, 0,
+    0, 0, 3350, 0, 3500, 0, 3500, 0, 3515, 0, 0, 2900, 0, 0, 0, 3530,
+    3230, 0, 0, 0, 0, 0, 3545, 0, 0, 3560, 0, 3575, 3590, 3605, 0, 0,
+    0, 0, 0, 0, 3425, 3095, 0, 0, 0, 0, 0, 3245, 0, 3110, 0, 3620,
+    3245, 0, 3140, 0, 0, 0, 0, 2795, 2870, 3545, 3635, 3635, 0, 0, 0, 0,
+    0, 2990, 0, 3650, 3410, 3410, 0, 0, 0, 3665, 0, 0, 3275, 0, 3620, 0,
+    0, 3680, 3696, 3712, 3728, 3744, 0, 3760, 0, 0, 0, 3776, 0, 0, 0, 3792,
+    0, 0, 3808, 0, 0, 0, 0, 0, 0, 0, 3824, 0, 0, 3840, 0, 3776,
+    3856, 3872, 0, 3888, 3904, 3920, 0, 3936, 3952, 0, 3968, 0, 3984, 0, 4000, 3872,
+    0, 0, 0, 0, 0, 3824, 4016, 4032, 4048, 0, 0, 4000, 0, 3824, 0, 0,
+    3984, 0, 4064, 0, 0, 4080, 0, 0, 4096, 4112, 3872, 4128, 0, 3680, 4144, 4160,
+    0, 4064, 0, 3792, 0, 0, 0, 4176, 4128, 0, 0, 3952, 0, 0, 4192, 4208,
+    4224, 3856, 3856, 4240, 0, 4112, 0, 0, 0, 0, 4256, 3824, 0, 0, 0, 0,
+    3792, 0, 0, 0, 4272, 4288, 0, 3792, 0, 0, 4304, 4288, 4320, 0, 4336, 4320,
+    0, 4352, 0, 0, 4192, 4368, 0, 0, 0, 4384, 0, 0, 4064, 0, 4400, 4416,
+    0, 4432, 0, 4448, 3680, 3952, 0, 4464, 0, 4480, 0, 4496, 0, 0, 0, 0,
+    0, 4480, 4272, 4480, 4512, 0, 3856, 0, 0, 0, 4320, 0, 4528, 3792, 0, 0,
+    4128, 4544, 4560, 0, 0, 0, 3840, 0, 0, 4576, 0, 0, 0, 4593, 0, 0,
+    4610, 4610, 4627, 0, 0, 0, 4644, 4661, 0, 0, 4678, 4695, 0, 4712, 4729, 4746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4763, 0, 4780, 4797, 0, 0, 4814,
+    0, 0, 4831, 4848, 4865, 4882, 0, 4899, 4831, 0, 4916, 4814, 0, 0, 0, 4933,
+    0, 0, 0, 0, 0, 0, 0, 0, 4950, 4967, 0, 4610, 4610, 0, 4984, 5001,
+    0, 0, 0, 0, 0, 4797, 5018, 0, 0, 5035, 5035, 4984, 0, 0, 5052, 0,
+    5069, 0, 5086, 0, 0, 0, 4797, 5103, 5120, 0, 0, 0, 5137, 5155, 5173, 0,
+    5191, 5209, 5227, 0, 0, 0, 5245, 0, 5173, 5263, 0, 0, 5281, 5299, 5317, 0,
+    0, 5335, 0, 0, 5353, 0, 5371, 5389, 0, 5407, 0, 5425, 5443, 5461, 0, 0,
+    0, 0, 5479, 5497, 0, 0, 0, 5515, 5533, 5551, 5569, 0, 5587, 0, 5605, 5623,
+    5641, 5659, 0, 0, 0, 0, 0, 0, 0, 5677, 0, 5696, 5715, 0, 0, 0,
+    0, 0, 5734, 0, 5753, 5772, 0, 0, 0, 0, 0, 0, 5791, 0, 5810, 0,
+    5829, 0, 0, 5848, 0, 5867, 5886, 5906, 5926, 0, 0, 0, 5946, 5966, 5986, 0,
+    6006, 6006, 0, 0, 6026, 0, 0, 6046, 0, 0, 6066, 6087, 0, 0, 6108, 6129,
+    0, 6150, 0, 0, 6171, 6193, 6215, 0, 0, 0, 0, 0, 6237, 0, 0, 0,
+    0, 6262,
+};
+
+static const uint8_t hyph_enLevels[6291] = {
+    0, 1, 1, 2, 2, 1, 2, 1, 1, 1, 0, 1, 4, 0, 2, 2,
+    2, 0, 2, 2, 1, 0, 2, 4, 1, 0, 1, 2, 0, 2, 4, 3,
+    2, 1, 4, 1, 2, 2, 2, 0, 3, 2, 5, 2, 0, 2, 4, 5,
+    0, 1, 1, 1, 1, 3, 2, 1, 1, 0, 3, 1, 4, 4, 1, 1,
+    5, 0, 3, 4, 3, 2, 0, 2, 1, 2, 1, 2, 1, 4, 1, 2,
+    1, 2, 1, 2, 5, 2, 0, 3, 4, 1, 4, 0, 3, 2, 1, 2,
+    1, 2, 4, 2, 0, 2, 2, 3, 0, 1, 3, 0, 3, 4, 1, 2,
+    0, 3, 4, 0, 4, 0, 3, 2, 0, 4, 0, 3, 4, 5, 4, 0,
+    1, 5, 0, 3, 4, 0, 2, 0, 3, 2, 3, 2, 0, 3, 1, 2,
+    2, 1, 1, 4, 0, 3, 2, 0, 2, 0, 3, 1, 0, 2, 1, 2,
+    3, 2, 3, 1, 4, 3, 1, 2, 3, 1, 3, 3, 1, 1, 0, 2,
+    4, 2, 1, 2, 4, 4, 2, 1, 3, 2, 2, 4, 2, 0, 3, 4,
+    0, 5, 0, 4, 4, 0, 0, 4, 0, 4, 5, 0, 0, 4, 0, 2,
+    2, 5, 0, 4, 3, 0, 0, 2, 2, 1, 5, 3, 1, 5, 0, 2,
+    3, 4, 0, 3, 2, 3, 4, 2, 2, 2, 2, 0, 3, 1, 4, 3,
+    0, 3, 1, 0, 1, 1, 2, 1, 1, 0, 3, 4, 0, 3, 2, 2,
+    4, 1, 2, 2, 2, 4, 1, 3, 4, 0, 4, 2, 2, 3, 4, 1,
+    3, 2, 0, 5, 0, 3, 1, 0, 4, 0, 3, 3, 4, 4, 0, 3,
+    2, 5, 3, 1, 3, 4, 0, 2, 0, 3, 2, 0, 1, 0, 3, 4,
+    0, 1, 0, 2, 5, 2, 0, 3, 4, 4, 4, 0, 2, 4, 4, 0,
+    4, 2, 0, 0, 4, 2, 2, 2, 1, 0, 3, 3, 0, 4, 1, 3,
+    2, 0, 4, 0, 3, 3, 0, 1, 0, 3, 5, 0, 4, 0, 2, 1,
+    4, 1, 3, 1, 0, 4, 1, 3, 3, 0, 4, 2, 2, 4, 4, 1,
+    2, 2, 5, 2, 2, 4, 3, 2, 2, 2, 3, 0, 3, 5, 0, 3,
+    1, 2, 4, 1, 0, 3, 2, 1, 4, 1, 2, 5, 4, 0, 4, 3,
+    0, 0, 4, 1, 2, 4, 5, 4, 1, 4, 4, 1, 2, 4, 1, 5,
+    4, 1, 3, 4, 1, 1, 1, 3, 5, 0, 5, 2, 2, 3, 3, 2,
+    3, 5, 0, 4, 2, 2, 5, 5, 0, 4, 5, 5, 0, 4, 2, 2,
+    2, 5, 1, 3, 4, 0, 3, 1, 2, 4, 3, 1, 4, 5, 0, 0,
+    5, 1, 4, 3, 0, 0, 3, 2, 3, 1, 0, 2, 1, 4, 1, 0,
+    0, 4, 3, 2, 2, 5, 1, 3, 1, 0, 3, 3, 2, 5, 4, 0,
+    2, 5, 4, 0, 3, 4, 3, 3, 0, 4, 5, 0, 0, 5, 2, 3,
+    5, 0, 5, 3, 2, 3, 4, 0, 3, 5, 0, 5, 2, 3, 4, 0,
+    4, 1, 4, 4, 0, 0, 4, 0, 3, 5, 5, 2, 0, 4, 4, 0,
+    0, 5, 1, 3, 2, 5, 5, 1, 4, 2, 0, 0, 4, 1, 4, 5,
+    0, 0, 4, 3, 2, 4, 5, 1, 2, 5, 5, 3, 2, 1, 3, 1,
+    3, 4, 0, 5, 2, 2, 5, 4, 0, 3, 3, 0, 3, 0, 2, 1,
+    1, 2, 3, 3, 0, 5, 3, 2, 5, 2, 3, 2, 3, 3, 3, 2,
+    3, 2, 2, 3, 2, 0, 2, 0, 4, 5, 0, 0, 3, 1, 3, 4,
+    0, 1, 0, 2, 5, 5, 5, 1, 5, 5, 1, 3, 4, 2, 3, 4,
+    4, 2, 5, 5, 5, 1, 4, 4, 2, 5, 4, 0, 4, 3, 0, 0,
+    5, 3, 2, 5, 5, 1, 4, 4, 3, 0, 3, 2, 3, 3, 0, 3,
+    1, 2, 3, 3, 3, 2, 4, 4, 3, 3, 3, 0, 3, 4, 2, 4,
+    3, 4, 2, 4, 5, 0, 5, 5, 0, 0, 0, 4, 6, 1, 5, 3,
+    3, 5, 0, 5, 6, 1, 4, 0, 5, 5, 0, 0, 5, 5, 4, 3,
+    5, 0, 5, 1, 6, 10, 10, 10, 10, 10, 10, 7, 1, 5, 1, 6,
+    10, 10, 10, 11, 10, 10, 1, 6, 10, 10, 11, 10, 10, 10, 1, 7,
+    10, 10, 10, 11, 10, 10, 10, 1, 7, 10, 10, 10, 10, 10, 10, 10,
+    1, 7, 10, 10, 10, 10, 11, 10, 10, 1, 7, 10, 10, 11, 10, 10,
+    10, 10, 1, 7, 10, 10, 10, 11, 10, 11, 10, 1, 7, 10, 10, 11,
+    10, 11, 10, 10, 1, 8, 10, 10, 10, 10, 11, 11, 10, 10, 1, 8,
+    10, 10, 10, 10, 11, 10, 10, 10, 1, 8, 10, 10, 10, 11, 11, 10,
+    10, 10, 1, 8, 10, 10, 11, 11, 10, 10, 10, 10, 1, 8, 10, 10,
+    11, 10, 10, 10, 10, 10, 1, 8, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 8, 10, 10, 10, 10, 10, 11, 10, 10, 1, 8, 10, 10, 10, 10,
+    10, 10, 10, 10, 1, 8, 10, 10, 11, 10, 11, 11, 10, 10, 1, 8,
+    10, 10, 11, 10, 10, 11, 10, 10, 1, 8, 10, 10, 11, 10, 11, 10,
+    10, 10, 1, 8, 10, 10, 10, 11, 10, 11, 10, 10, 1, 8, 10, 10,
+    11, 10, 10, 11, 11, 10, 1, 9, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 1, 9, 10, 10, 11, 11, 10, 10, 10, 10, 10, 1, 9, 10, 10,
+    10, 10, 10, 11, 10, 10, 10, 1, 9, 10, 10, 11, 10, 11, 10, 10,
+    10, 10, 1, 9, 10, 10, 11, 10, 10, 11, 11, 10, 10, 1, 9, 10,
+    10, 11, 10, 10, 11, 10, 10, 10, 1, 9, 10, 10, 11, 10, 10, 10,
+    10, 10, 10, 1, 9, 10, 11, 10, 10, 10, 10, 11, 10, 10, 1, 9,
+    10, 10, 11, 10, 10, 10, 11, 10, 10, 1, 9, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 1, 9, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1,
+    9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 9, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 1, 9, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+    1, 9, 10, 10, 11, 11, 10, 10, 11, 10, 10, 1, 9, 10, 10, 11,
+    10, 11, 10, 11, 10, 10, 1, 9, 10, 10, 10, 10, 11, 10, 11, 10,
+    10, 1, 9, 10, 10, 11, 10, 10, 10, 11, 11, 10, 1, 9, 10, 10,
+    10, 10, 10, 10, 11, 10, 10, 1, 9, 10, 10, 10, 10, 11, 11, 10,
+    10, 10, 1, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 10,
+    10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1, 10, 10, 10, 10, 10,
+    11, 10, 11, 10, 10, 10, 1, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+    10, 10, 1, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 1, 10,
+    10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 1, 10, 10, 11, 10, 10,
+    10, 11, 10, 10, 10, 10, 1, 10, 10, 10, 11, 10, 10, 10, 11, 10,
+    10, 10, 1, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 1, 10,
+    10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 10, 10, 10, 10, 10,
+    10, 11, 10, 10, 10, 10, 1, 10, 10, 10, 11, 10, 10, 10, 11, 11,
+    10, 10, 1, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 1, 10,
+    10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 1, 10, 10, 10, 11, 10,
+    11, 10, 11, 10, 10, 10, 1, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    10, 10, 1, 10, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 1, 10,
+    10, 10, 11, 10, 11, 11, 10, 10, 10, 10, 1, 10, 10, 10, 10, 10,
+    11, 11, 11, 10, 10, 10, 1, 10, 10, 10, 10, 11, 10, 10, 10, 11,
+    10, 10, 1, 10, 10, 10, 10, 11, 10, 11, 11, 10, 10, 10, 1, 10,
+    10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 1, 10, 10, 10, 10, 11,
+    11, 10, 11, 10, 10, 10, 1, 10, 10, 10, 10, 10, 11, 10, 10, 11,
+    10, 10, 1, 10, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10, 1, 10,
+    10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 1, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 10, 10, 1, 10, 10, 10, 10, 10, 10, 11, 11, 10,
+    10, 10, 1, 11, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 1,
+    11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1, 11, 10, 10,
+    10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 11, 10, 10, 11, 10, 10,
+    11, 10, 10, 10, 10, 10, 1, 11, 10, 10, 11, 10, 11, 10, 10, 11,
+    10, 10, 10, 1, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 1, 11, 10,
+    10, 10, 10, 10, 11, 11, 11, 10, 10, 10, 1, 11, 10, 10, 11, 10,
+    10, 11, 10, 11, 10, 10, 10, 1, 11, 10, 10, 11, 10, 10, 11, 10,
+    10, 11, 10, 10, 1, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 1, 11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 1, 11,
+    10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 1, 11, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 10, 10, 1, 11, 10, 10, 10, 10, 11, 10,
+    10, 10, 11, 10, 10, 1, 11, 10, 10, 10, 11, 10, 10, 11, 11, 10,
+    10, 10, 1, 11, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 1,
+    11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 1, 11, 10, 10,
+    10, 10, 11, 10, 10, 10, 10, 10, 10, 1, 11, 10, 10, 10, 10, 10,
+    10, 10, 11, 10, 10, 10, 1, 11, 10, 10, 10, 10, 10, 11, 10, 11,
+    10, 10, 10, 1, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 10,
+    1, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 1, 11, 10,
+    10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 1, 11, 10, 10, 10, 10,
+    11, 11, 10, 10, 10, 10, 10, 1, 11, 10, 10, 10, 10, 11, 10, 11,
+    10, 10, 10, 10, 1, 11, 10, 10, 10, 11, 11, 10, 11, 10, 10, 10,
+    10, 1, 11, 10, 10, 11, 10, 11, 11, 10, 10, 10, 10, 10, 1, 11,
+    10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 11, 10, 10, 10,
+    11, 10, 11, 10, 11, 10, 10, 10, 1, 11, 10, 10, 10, 11, 10, 11,
+    10, 10, 10, 10, 10, 1, 11, 10, 10, 10, 10, 10, 11, 10, 10, 11,
+    10, 10, 1, 11, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 1,
+    11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 1, 11, 10, 10,
+    10, 11, 10, 10, 10, 10, 11, 10, 10, 1, 11, 10, 10, 10, 10, 11,
+    11, 10, 10, 11, 10, 10, 1, 11, 10, 10, 10, 11, 10, 11, 10, 10,
+    11, 10, 10, 1, 11, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10,
+    1, 11, 10, 10, 10, 10, 10, 10, 10, 11, 11, 10, 10, 1, 11, 10,
+    10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 1, 11, 10, 10, 10, 10,
+    10, 10, 11, 10, 11, 10, 10, 1, 12, 10, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 10, 1, 12, 10, 10, 10, 11, 10, 10, 10, 11, 10,
+    10, 10, 10, 1, 12, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10,
+    10, 1, 12, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 1,
+    12, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 12, 10,
+    10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 1, 12, 10, 10, 11,
+    10, 10, 11, 10, 10, 10, 11, 10, 10, 1, 12, 10, 10, 11, 10, 11,
+    10, 10, 11, 10, 10, 10, 10, 1, 12, 10, 10, 10, 10, 11, 10, 11,
+    10, 10, 11, 10, 10, 1, 12, 10, 10, 11, 10, 10, 11, 10, 11, 10,
+    10, 10, 10, 1, 12, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10,
+    10, 1, 12, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 1,
+    12, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 1, 12, 10,
+    10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 1, 12, 10, 10, 10,
+    11, 10, 10, 11, 11, 10, 10, 10, 10, 1, 12, 10, 10, 10, 11, 10,
+    10, 10, 11, 10, 11, 10, 10, 1, 12, 10, 10, 10, 11, 10, 11, 10,
+    10, 10, 11, 10, 10, 1, 12, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 1, 12, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10,
+    10, 1, 12, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 10, 1,
+    12, 10, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 12, 10,
+    10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1, 12, 10, 10, 10,
+    11, 10, 11, 10, 11, 10, 10, 10, 10, 1, 12, 10, 10, 10, 11, 11,
+    10, 11, 10, 10, 10, 10, 10, 1, 12, 10, 10, 11, 10, 10, 11, 11,
+    10, 10, 10, 10, 10, 1, 12, 10, 10, 10, 10, 11, 11, 10, 10, 10,
+    10, 10, 10, 1, 12, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10, 10,
+    10, 1, 12, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 1,
+    12, 10, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 1, 12, 10,
+    10, 11, 11, 10, 10, 10, 10, 10, 10, 10, 10, 1, 12, 10, 10, 10,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 12, 10, 10, 11, 10, 11,
+    10, 10, 10, 11, 10, 10, 10, 1, 12, 10, 10, 10, 10, 11, 10, 10,
+    11, 11, 10, 10, 10, 1, 12, 10, 10, 10, 10, 10, 10, 11, 10, 10,
+    10, 10, 10, 1, 12, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10,
+    10, 1, 12, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 10, 1,
+    12, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 10, 10, 1, 12, 10,
+    10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 1, 12, 10, 10, 10,
+    10, 11, 10, 10, 11, 10, 10, 10, 10, 1, 12, 10, 10, 10, 11, 10,
+    11, 10, 10, 10, 10, 10, 10, 1, 12, 10, 10, 10, 11, 11, 10, 10,
+    10, 11, 10, 10, 10, 1, 12, 10, 10, 10, 11, 11, 10, 10, 10, 10,
+    10, 10, 10, 1, 12, 10, 10, 10, 10, 11, 10, 11, 11, 10, 10, 10,
+    10, 1, 12, 10, 10, 10, 11, 10, 11, 10, 11, 11, 10, 10, 10, 1,
+    12, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 1, 12, 10,
+    10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 1, 12, 10, 10, 10,
+    11, 10, 10, 11, 10, 10, 11, 10, 10, 1, 12, 10, 10, 11, 10, 10,
+    10, 11, 11, 10, 11, 10, 10, 1, 12, 10, 10, 10, 11, 11, 10, 10,
+    10, 11, 11, 10, 10, 1, 12, 10, 10, 11, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 1, 12, 10, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 1, 12, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 1,
+    12, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 1, 13, 10,
+    10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 1, 13, 10, 10,
+    11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 1, 13, 10, 10, 11,
+    10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 1, 13, 10, 10, 11, 10,
+    10, 10, 11, 10, 11, 10, 10, 10, 10, 1, 13, 10, 10, 11, 10, 10,
+    11, 10, 10, 11, 11, 10, 10, 10, 1, 13, 10, 10, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 10,
+    10, 11, 10, 10, 10, 10, 1, 13, 10, 10, 10, 11, 10, 10, 10, 11,
+    10, 10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    11, 10, 10, 10, 1, 13, 10, 10, 10, 11, 10, 11, 10, 10, 11, 11,
+    10, 10, 10, 1, 13, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10,
+    10, 10, 1, 13, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 1, 13, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 11, 10, 10,
+    1, 13, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 1,
+    13, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 13,
+    10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 1, 13, 10,
+    10, 10, 11, 10, 10, 11, 10, 11, 11, 10, 10, 10, 1, 13, 10, 10,
+    10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10,
+    11, 11, 10, 11, 10, 10, 10, 11, 10, 10, 1, 13, 10, 10, 10, 11,
+    10, 10, 10, 10, 10, 10, 11, 10, 10, 1, 13, 10, 10, 10, 11, 10,
+    10, 10, 11, 11, 10, 10, 10, 10, 1, 13, 10, 10, 10, 11, 10, 10,
+    11, 10, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 10,
+    11, 11, 10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 10, 10, 11, 10,
+    10, 11, 10, 10, 10, 1, 13, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 10, 10, 10, 11, 10, 10,
+    10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10,
+    10, 10, 1, 13, 10, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10,
+    10, 1, 13, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    1, 13, 10, 10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 1,
+    13, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 11, 10, 10, 1, 13,
+    10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 1, 13, 10,
+    10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 1, 13, 10, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 1, 13, 10, 10, 10,
+    11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 13, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 11, 10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 11,
+    10, 10, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10, 11, 11, 10, 10,
+    10, 11, 10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 11, 10,
+    11, 10, 10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 10, 10, 11,
+    11, 10, 10, 10, 1, 13, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    10, 10, 1, 13, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 1, 13, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+    1, 13, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 1,
+    13, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 10, 1, 13,
+    10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 10, 1, 13, 10,
+    10, 10, 10, 11, 11, 10, 10, 11, 10, 10, 10, 10, 1, 13, 10, 10,
+    10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10,
+    10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 1, 13, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 11, 10, 10, 10, 1, 13, 10, 10, 11, 10, 10,
+    11, 10, 11, 10, 10, 10, 10, 10, 1, 13, 10, 10, 11, 10, 10, 10,
+    10, 11, 10, 10, 10, 10, 10, 1, 13, 10, 10, 10, 11, 10, 11, 10,
+    10, 11, 10, 11, 10, 10, 1, 13, 10, 10, 10, 10, 11, 11, 10, 10,
+    11, 11, 10, 10, 10, 1, 13, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 11, 10, 10, 1, 13, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    11, 10, 10, 1, 13, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10,
+    10, 10, 1, 13, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10,
+    10, 1, 13, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 11, 11, 10, 10, 11, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10,
+    1, 14, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10,
+    1, 14, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+    1, 14, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    1, 15, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10,
+    10, 1, 15, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 10, 1, 15, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10,
+    10, 10, 10, 1, 15, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    11, 10, 10, 10, 1, 15, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10,
+    11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 11, 10, 10, 10, 11, 11,
+    10, 10, 11, 10, 10, 10, 1, 15, 10, 10, 10, 10, 10, 11, 10, 10,
+    10, 11, 11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 10, 10, 10, 11,
+    10, 10, 10, 11, 10, 10, 10, 10, 1, 15, 10, 10, 11, 10, 11, 10,
+    11, 10, 10, 10, 11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 10, 10,
+    10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 1, 15, 10, 10, 10, 10,
+    11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 15, 10, 10, 10,
+    11, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 1, 15, 10, 10,
+    11, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 15, 10,
+    10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 1, 15,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 1,
+    15, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    1, 15, 10, 10, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10, 10, 10,
+    10, 1, 15, 10, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11,
+    10, 10, 1, 15, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+    10, 10, 10, 1, 15, 10, 10, 10, 10, 11, 10, 11, 10, 11, 10, 11,
+    10, 10, 10, 10, 1, 15, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 11, 10, 11, 11, 10, 10,
+    10, 11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 11, 10, 11, 10, 11,
+    10, 10, 11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 10, 10, 11, 10,
+    11, 11, 10, 11, 10, 10, 10, 10, 1, 15, 10, 10, 10, 10, 11, 10,
+    11, 10, 11, 10, 10, 10, 11, 10, 10, 1, 15, 10, 10, 10, 10, 11,
+    10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 1, 15, 10, 10, 11, 10,
+    10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1, 15, 10, 10, 10,
+    10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 1, 15, 10, 10,
+    10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 15, 10,
+    10, 10, 11, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 1, 15,
+    10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1,
+    15, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10,
+    1, 15, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10, 11, 10,
+    10, 1, 16, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10,
+    11, 10, 10, 1, 16, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11,
+    10, 10, 10, 10, 10, 1, 16, 10, 10, 10, 10, 11, 10, 10, 10, 11,
+    10, 10, 11, 10, 10, 10, 10, 1, 16, 10, 10, 10, 11, 10, 11, 11,
+    10, 10, 10, 11, 10, 11, 10, 10, 10, 1, 16, 10, 10, 10, 10, 11,
+    10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 1, 16, 10, 10, 10,
+    11, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 1, 16, 10,
+    10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1,
+    16, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    10, 1, 16, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11,
+    10, 10, 10, 1, 16, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+    10, 10, 11, 10, 10, 1, 16, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+    10, 10, 10, 11, 10, 10, 10, 1, 16, 10, 10, 11, 10, 10, 11, 10,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 16, 10, 10, 11, 10, 10,
+    11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 1, 16, 10, 10, 10,
+    10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 16, 10,
+    10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 1,
+    16, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    10, 1, 16, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 1, 16, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    10, 11, 10, 10, 10, 1, 16, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+    11, 10, 10, 11, 10, 10, 10, 1, 16, 10, 10, 11, 10, 10, 11, 11,
+    10, 10, 11, 10, 11, 10, 10, 10, 10, 1, 16, 10, 10, 10, 11, 10,
+    10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 16, 10, 10, 10,
+    11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 1, 16, 10,
+    10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 1,
+    16, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    10, 1, 16, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 11, 10, 11,
+    10, 10, 10, 1, 16, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+    10, 11, 10, 10, 10, 1, 16, 10, 10, 10, 11, 10, 11, 10, 11, 10,
+    10, 10, 11, 11, 10, 10, 10, 1, 16, 10, 10, 10, 11, 10, 11, 10,
+    10, 10, 11, 11, 10, 10, 10, 10, 10, 1, 16, 10, 10, 10, 11, 10,
+    10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 1, 16, 10, 10, 10,
+    10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 1, 17, 10,
+    10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+    1, 17, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 11, 11, 10, 10,
+    10, 10, 10, 1, 17, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 11,
+    10, 10, 11, 10, 10, 10, 1, 17, 10, 10, 11, 10, 11, 10, 11, 10,
+    10, 11, 11, 10, 11, 10, 11, 10, 10, 1, 17, 10, 10, 10, 10, 10,
+    11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 1, 17, 10, 10,
+    10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 1,
+    17, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10,
+    10, 10, 1, 17, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10,
+    11, 10, 10, 10, 10, 1, 17, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    11, 10, 11, 10, 10, 10, 10, 10, 1, 17, 10, 10, 10, 11, 10, 10,
+    11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 1, 17, 10, 10, 10,
+    11, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 1, 18,
+    10, 10, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 10, 10, 11, 10,
+    10, 10, 1, 18, 10, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10,
+    11, 10, 10, 10, 10, 10, 1, 18, 10, 10, 10, 10, 10, 10, 10, 11,
+    10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 1, 18, 10, 10, 10, 10,
+    11, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10, 1, 18,
+    10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10,
+    10, 10, 1, 18, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 10, 10, 1, 18, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 1, 18, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 1, 18,
+    10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 10, 1, 19, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10,
+    11, 10, 10, 11, 10, 10, 10, 1, 19, 10, 10, 10, 10, 11, 10, 10,
+    10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 1, 19, 10, 10,
+    11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10,
+    10, 1, 19, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 1, 19, 10, 10, 10, 10, 10, 11, 10, 10,
+    10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 1, 20, 10, 10, 10,
+    10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 1, 20, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 11,
+    10, 10, 10, 10, 10, 10, 10, 1, 20, 10, 10, 10, 10, 11, 10, 10,
+    11, 10, 11, 10, 11, 11, 10, 10, 11, 11, 10, 10, 10, 1, 23, 10,
+    10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10,
+    10, 10, 10, 10, 10, 10, 1, 27, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 11,
+    10, 10, 10,
+};
+
+static const HyphenationPatterns hyph_en = {
+    "en",
+    hyph_enLetters,
+    52,
+    hyph_enNodeChars,
+    hyph_enNodeFirstChild,
+    hyph_enNodeLevels,
+    hyph_enLevels,
+    15794,
+    2,
+    3,
+};
@@ -0,0 +1,1227 @@
+/**
+ * generated by hyphenconvert.py
+ * name: hyph_es
+ * language: es
+ * patterns: 3590
+ * nodes: 5829
+ */
+#pragma once
+#include "HyphenationPatterns.h"
+
+static const HyphenationLetter hyph_esLetters[64] = {
+    { 0x41, 1 }, // A
+    { 0x42, 2 }, // B
+    { 0x43, 3 }, // C
+    { 0x44, 4 }, // D
+    { 0x45, 5 }, // E
+    { 0x46, 6 }, // F
+    { 0x47, 7 }, // G
+    { 0x48, 8 }, // H
+    { 0x49, 9 }, // I
+    { 0x4A, 10 }, // J
+    { 0x4B, 11 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 13 }, // M
+    { 0x4E, 14 }, // N
+    { 0x4F, 15 }, // O
+    { 0x50, 16 }, // P
+    { 0x51, 17 }, // Q
+    { 0x52, 18 }, // R
+    { 0x53, 19 }, // S
+    { 0x54, 20 }, // T
+    { 0x55, 21 }, // U
+    { 0x56, 22 }, // V
+    { 0x57, 23 }, // W
+    { 0x58, 24 }, // X
+    { 0x59, 25 }, // Y
+    { 0x5A, 26 }, // Z
+    { 0x61, 1 }, // a
+    { 0x62, 2 }, // b
+    { 0x63, 3 }, // c
+    { 0x64, 4 }, // d
+    { 0x65, 5 }, // e
+    { 0x66, 6 }, // f
+    { 0x67, 7 }, // g
+    { 0x68, 8 }, // h
+    { 0x69, 9 }, // i
+    { 0x6A, 10 }, // j
+    { 0x6B, 11 }, // k
+    { 0x6C, 12 }, // l
+    { 0x6D, 13 }, // m
+    { 0x6E, 14 }, // n
+    { 0x6F, 15 }, // o
+    { 0x70, 16 }, // p
+    { 0x71, 17 }, // q
+    { 0x72, 18 }, // r
+    { 0x73, 19 }, // s
+    { 0x74, 20 }, // t
+    { 0x75, 21 }, // u
+    { 0x76, 22 }, // v
+    { 0x77, 23 }, // w
+    { 0x78, 24 }, // x
+    { 0x79, 25 }, // y
+    { 0x7A, 26 }, // z
+    { 0xC1, 27 }, // Á
+    { 0xC9, 28 }, // É
+    { 0xCD, 29 }, // Í
+    { 0xD1, 30 }, // Ñ
+    { 0xD3, 31 }, // Ó
+    { 0xDA, 32 }, // Ú
+    { 0xE1, 27 }, // á
+    { 0xE9, 28 }, // é
+    { 0xED, 29 }, // í
+    { 0xF1, 30 }, // ñ
+    { 0xF3, 31 }, // ó
+    { 0xFA, 32 }, // ú
+};
+
+static const uint8_t hyph_esNodeChars[5829] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16,
+    17, 18, 19, 20, 22, 23, 24, 25, 26, 0, 1, 2, 3, 4, 5, 6,
+    9, 12, 13, 14, 15, 18, 19, 20, 21, 29, 0, 2, 3, 4, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25,
+    26, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 2, 3, 4,
+    5, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23,
+    24, 25, 26, 0, 1, 3, 4, 5, 13, 14, 15, 18, 19, 21, 24, 27,
+    0, 1, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 22, 23, 24, 25, 26, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 1, 2, 3,
+    4, 5, 7, 14, 15, 19, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12,
+    13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0, 2, 3, 4,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23,
+    24, 25, 26, 0, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 0, 1, 2, 3, 4, 5, 6, 7, 8, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0,
+    1, 3, 5, 9, 12, 13, 14, 15, 19, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22,
+    23, 24, 25, 26, 0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 22, 23, 24, 25, 26, 12, 20, 0, 2, 3, 4, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25,
+    26, 0, 1, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17,
+    18, 19, 20, 22, 23, 24, 25, 26, 0, 2, 3, 4, 5, 6, 7, 8,
+    10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0,
+    2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20,
+    22, 23, 24, 25, 26, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 2, 4, 9, 14,
+    15, 18, 19, 0, 4, 9, 15, 18, 19, 0, 1, 2, 4, 13, 19, 20,
+    0, 0, 12, 14, 19, 20, 14, 9, 1, 15, 5, 9, 14, 24, 5, 21,
+    14, 1, 9, 1, 15, 18, 5, 15, 21, 5, 18, 5, 31, 1, 1, 9,
+    20, 0, 1, 12, 13, 14, 15, 20, 18, 9, 18, 7, 0, 5, 9, 15,
+    0, 1, 4, 6, 7, 20, 19, 0, 1, 3, 5, 9, 12, 13, 14, 15,
+    19, 20, 27, 28, 29, 0, 5, 20, 21, 5, 20, 19, 14, 20, 26, 20,
+    14, 2, 5, 15, 21, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13,
+    14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 14, 14, 19, 20, 0,
+    2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20,
+    22, 23, 24, 25, 26, 19, 26, 3, 7, 18, 14, 20, 26, 6, 14, 20,
+    14, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18,
+    19, 20, 22, 23, 24, 25, 26, 3, 20, 0, 2, 3, 4, 6, 7, 8,
+    10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 14,
+    0, 5, 9, 14, 14, 19, 20, 0, 2, 3, 4, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0,
+    19, 26, 12, 0, 14, 20, 26, 3, 9, 19, 20, 14, 14, 14, 19, 20,
+    0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19,
+    20, 22, 23, 24, 25, 26, 19, 26, 3, 4, 13, 1, 15, 20, 0, 12,
+    13, 14, 18, 20, 4, 2, 9, 15, 0, 4, 20, 5, 19, 27, 0, 1,
+    5, 9, 12, 13, 14, 15, 19, 20, 27, 28, 29, 0, 3, 18, 1, 5,
+    9, 15, 16, 20, 21, 27, 28, 29, 31, 14, 13, 0, 2, 3, 4, 6,
+    7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25,
+    26, 14, 20, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16,
+    17, 18, 19, 20, 22, 23, 24, 25, 26, 0, 19, 15, 7, 0, 2, 3,
+    4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 0, 14, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12,
+    13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 1, 15, 2, 3,
+    12, 13, 24, 4, 16, 19, 13, 0, 14, 18, 19, 5, 1, 15, 1, 5,
+    18, 1, 15, 27, 6, 9, 20, 29, 0, 19, 15, 12, 0, 2, 3, 4,
+    6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24,
+    25, 26, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17,
+    18, 19, 20, 22, 23, 24, 25, 26, 14, 20, 26, 20, 14, 27, 0, 2,
+    3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22,
+    23, 24, 25, 26, 14, 7, 14, 19, 20, 19, 26, 3, 12, 14, 24, 14,
+    20, 26, 1, 7, 12, 14, 15, 20, 14, 3, 12, 14, 18, 14, 0, 14,
+    14, 19, 20, 19, 26, 12, 13, 14, 20, 26, 3, 15, 20, 20, 14, 14,
+    0, 18, 14, 19, 20, 5, 19, 26, 5, 20, 21, 31, 3, 4, 9, 15,
+    31, 14, 5, 19, 0, 1, 15, 12, 14, 18, 4, 14, 18, 5, 0, 1,
+    2, 3, 4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 0, 12, 19, 0, 2, 3, 4, 5, 6, 7,
+    8, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25,
+    26, 0, 9, 0, 20, 5, 4, 14, 18, 14, 20, 26, 9, 20, 20, 14,
+    1, 14, 13, 14, 19, 20, 0, 2, 3, 4, 6, 7, 8, 10, 11, 12,
+    13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 19, 26, 0, 14,
+    19, 14, 20, 26, 13, 21, 20, 14, 14, 2, 3, 1, 14, 19, 20, 1,
+    5, 9, 15, 19, 26, 4, 16, 12, 14, 20, 26, 12, 18, 20, 20, 14,
+    15, 14, 16, 14, 19, 20, 0, 1, 2, 3, 4, 6, 7, 8, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0, 19,
+    26, 0, 19, 20, 5, 3, 4, 0, 2, 3, 4, 6, 7, 8, 10, 11,
+    12, 13, 14, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 0, 2, 3,
+    4, 6, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 22, 23,
+    24, 25, 26, 19, 14, 20, 26, 14, 20, 14, 14, 14, 19, 20, 19, 26,
+    14, 20, 26, 20, 14, 14, 14, 19, 20, 19, 26, 15, 1, 13, 14, 19,
+    20, 19, 4, 19, 1, 5, 13, 14, 15, 19, 20, 0, 5, 13, 14, 18,
+    19, 20, 19, 19, 13, 14, 15, 19, 20, 0, 9, 13, 14, 19, 12, 1,
+    15, 15, 13, 20, 5, 15, 0, 20, 9, 1, 5, 8, 9, 15, 20, 21,
+    27, 28, 29, 31, 32, 1, 5, 15, 21, 31, 21, 1, 5, 9, 14, 15,
+    21, 27, 28, 29, 31, 32, 19, 21, 5, 1, 5, 9, 15, 21, 27, 28,
+    29, 31, 32, 1, 5, 9, 15, 21, 27, 28, 29, 31, 32, 13, 16, 13,
+    1, 5, 9, 15, 20, 21, 27, 28, 29, 31, 32, 12, 12, 14, 19, 5,
+    15, 1, 5, 9, 15, 21, 27, 28, 29, 31, 32, 1, 2, 4, 18, 12,
+    1, 9, 0, 9, 14, 19, 14, 15, 31, 15, 0, 19, 1, 5, 15, 5,
+    15, 0, 18, 19, 5, 15, 3, 15, 1, 19, 12, 19, 12, 15, 9, 12,
+    5, 0, 0, 9, 14, 19, 8, 0, 9, 13, 14, 19, 1, 15, 1, 5,
+    15, 5, 15, 14, 19, 5, 5, 0, 14, 19, 0, 9, 19, 1, 19, 0,
+    9, 14, 19, 5, 2, 19, 15, 15, 12, 14, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 14, 1, 1, 15, 4, 1, 20, 12, 15, 15, 3,
+    20, 16, 14, 15, 1, 19, 1, 5, 9, 15, 21, 28, 31, 9, 12, 9,
+    14, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 18, 1, 5, 15,
+    5, 15, 15, 5, 12, 15, 15, 19, 15, 15, 18, 0, 2, 4, 13, 14,
+    18, 19, 20, 13, 15, 1, 5, 15, 5, 15, 19, 5, 5, 0, 2, 9,
+    14, 18, 19, 0, 9, 19, 1, 19, 15, 15, 3, 7, 13, 3, 7, 17,
+    7, 10, 12, 13, 20, 3, 7, 14, 20, 15, 18, 2, 4, 13, 18, 7,
+    7, 10, 12, 13, 20, 4, 9, 15, 15, 20, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 1, 3, 1, 15, 0, 19, 0, 19, 9, 12, 20,
+    9, 1, 9, 15, 1, 18, 5, 15, 20, 15, 1, 15, 5, 0, 18, 0,
+    19, 0, 14, 19, 12, 15, 0, 0, 13, 19, 0, 9, 13, 19, 18, 3,
+    5, 18, 3, 0, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15,
+    18, 29, 18, 2, 3, 4, 6, 7, 8, 13, 16, 17, 19, 20, 22, 20,
+    9, 2, 1, 1, 20, 0, 18, 9, 9, 9, 15, 20, 15, 18, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 20, 18, 1, 15, 1, 15,
+    1, 5, 7, 7, 7, 9, 19, 0, 0, 13, 19, 0, 19, 5, 20, 1,
+    15, 20, 1, 5, 16, 26, 14, 18, 9, 20, 5, 15, 20, 3, 17, 1,
+    15, 20, 9, 3, 1, 5, 15, 27, 28, 29, 14, 18, 14, 15, 3, 0,
+    9, 4, 18, 9, 14, 12, 0, 19, 12, 18, 15, 5, 18, 13, 5, 13,
+    1, 18, 3, 17, 15, 14, 19, 16, 3, 18, 18, 5, 5, 8, 15, 1,
+    5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 13, 5, 15, 5, 5, 0,
+    15, 12, 13, 13, 5, 15, 19, 5, 5, 13, 5, 15, 9, 5, 5, 0,
+    12, 5, 15, 19, 5, 5, 19, 15, 0, 0, 5, 0, 19, 0, 19, 19,
+    15, 1, 5, 9, 19, 7, 5, 3, 5, 12, 16, 24, 4, 12, 13, 17,
+    19, 22, 3, 4, 13, 14, 20, 5, 9, 1, 2, 4, 12, 12, 13, 14,
+    0, 14, 21, 14, 24, 14, 24, 20, 3, 7, 12, 18, 21, 4, 6, 20,
+    24, 13, 20, 21, 16, 18, 7, 16, 1, 5, 9, 15, 21, 27, 28, 29,
+    31, 32, 20, 3, 3, 18, 13, 10, 13, 5, 20, 5, 2, 3, 4, 7,
+    13, 14, 16, 18, 19, 6, 12, 14, 3, 3, 5, 20, 14, 4, 20, 1,
+    5, 9, 9, 1, 5, 8, 31, 20, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 1, 5, 9, 15, 21, 27, 28, 29, 31, 32, 2, 5, 6,
+    7, 10, 12, 14, 16, 17, 26, 13, 14, 2, 3, 10, 18, 2, 13, 14,
+    19, 20, 2, 19, 1, 5, 9, 15, 18, 21, 27, 28, 29, 31, 32, 1,
+    5, 1, 5, 15, 5, 19, 31, 19, 0, 0, 20, 14, 14, 1, 5, 8,
+    9, 15, 21, 27, 28, 29, 31, 32, 0, 19, 0, 19, 0, 19, 0, 19,
+    0, 1, 5, 0, 0, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32,
+    9, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 14, 0, 9, 0,
+    29, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 1, 5, 8,
+    9, 15, 21, 27, 28, 29, 31, 32, 19, 0, 0, 9, 19, 15, 0, 0,
+    0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0,
+    19, 0, 0, 9, 13, 14, 19, 0, 19, 0, 0, 0, 9, 19, 0, 1,
+    5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 0, 19, 9, 4, 8, 13,
+    17, 20, 22, 29, 19, 9, 12, 9, 15, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 18, 15, 18, 20, 15, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 20, 2, 3, 4, 6, 7, 8, 10, 12, 13, 14, 16,
+    18, 19, 20, 21, 22, 25, 26, 13, 14, 15, 17, 18, 19, 4, 5, 7,
+    12, 13, 14, 19, 2, 3, 4, 12, 14, 18, 19, 22, 24, 25, 2, 4,
+    5, 14, 19, 18, 18, 1, 15, 1, 5, 15, 15, 19, 0, 19, 0, 19,
+    0, 19, 0, 19, 0, 1, 3, 0, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 5, 1,
+    12, 0, 1, 15, 15, 0, 1, 5, 15, 27, 28, 29, 0, 5, 20, 5,
+    15, 18, 0, 19, 0, 19, 0, 19, 0, 19, 0, 0, 0, 1, 19, 0,
+    1, 5, 0, 5, 19, 0, 0, 9, 13, 14, 19, 0, 1, 5, 8, 9,
+    15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29,
+    31, 32, 5, 5, 9, 18, 28, 21, 5, 9, 29, 1, 15, 27, 1, 9,
+    1, 5, 9, 15, 27, 28, 29, 31, 15, 18, 1, 27, 5, 9, 28, 12,
+    1, 5, 1, 5, 9, 5, 5, 1, 15, 9, 1, 5, 9, 15, 9, 15,
+    12, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9,
+    15, 21, 27, 28, 29, 31, 32, 18, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 15, 12, 0, 19, 0, 0, 5, 1, 15, 15, 20, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15,
+    18, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 1, 5, 8,
+    9, 15, 21, 27, 28, 29, 31, 32, 0, 19, 0, 19, 19, 15, 0, 15,
+    0, 0, 5, 0, 19, 15, 0, 19, 15, 0, 1, 9, 18, 1, 9, 1,
+    5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 5, 1, 15, 5, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 12, 1, 5, 8, 9, 12, 15,
+    21, 27, 28, 29, 31, 32, 14, 5, 15, 1, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 1, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 9, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 5, 9, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 0, 19, 0, 19, 12, 0, 1, 19, 15, 29, 9, 1, 5, 8, 9,
+    15, 21, 27, 28, 29, 31, 32, 0, 5, 0, 0, 15, 5, 1, 5, 8,
+    9, 15, 21, 27, 28, 29, 31, 32, 1, 14, 13, 15, 15, 3, 9, 1,
+    5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 12, 13, 24, 3, 12,
+    16, 15, 15, 5, 15, 15, 9, 29, 15, 15, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 20, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 15, 5, 15, 15, 0, 5, 0, 12, 0, 1, 5, 5, 18, 1, 15,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 0, 19, 1, 15,
+    21, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 19, 1, 15, 8,
+    1, 9, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 15, 12, 19, 12, 12, 12, 13,
+    14, 15, 19, 20, 1, 5, 15, 15, 15, 12, 19, 12, 12, 12, 15, 12,
+    19, 3, 12, 12, 1, 5, 15, 12, 19, 12, 12, 12, 0, 19, 0, 19,
+    0, 0, 0, 0, 19, 0, 19, 0, 9, 19, 3, 0, 1, 15, 15, 18,
+    9, 9, 1, 5, 9, 27, 28, 1, 12, 1, 27, 15, 31, 5, 8, 9,
+    1, 1, 9, 1, 27, 15, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 12, 12, 1, 9, 1, 9, 21, 18, 1, 5, 9, 15, 18, 5, 21,
+    9, 18, 20, 9, 21, 9, 27, 9, 16, 15, 18, 5, 20, 28, 4, 21,
+    20, 14, 9, 5, 2, 9, 29, 1, 5, 5, 1, 1, 15, 1, 15, 5,
+    1, 21, 15, 1, 9, 5, 12, 18, 18, 9, 9, 21, 1, 21, 21, 18,
+    9, 9, 9, 9, 3, 5, 14, 4, 19, 14, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 6, 13, 21, 9, 16, 1, 5, 9, 15, 18, 21,
+    27, 28, 29, 31, 32, 2, 18, 7, 9, 29, 18, 21, 32, 9, 29, 9,
+    29, 1, 1, 3, 7, 19, 20, 7, 9, 29, 1, 27, 9, 20, 29, 1,
+    27, 9, 18, 3, 6, 12, 13, 18, 14, 19, 5, 12, 13, 14, 18, 28,
+    6, 18, 1, 5, 18, 13, 14, 6, 13, 19, 13, 19, 5, 9, 15, 1,
+    5, 9, 15, 21, 27, 28, 29, 31, 32, 24, 0, 5, 5, 0, 0, 0,
+    0, 0, 0, 19, 19, 15, 0, 1, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 0, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 0,
+    19, 0, 0, 0, 0, 0, 0, 19, 15, 0, 0, 0, 19, 0, 0, 15,
+    1, 15, 0, 15, 15, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 1, 15, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 13, 9, 1, 15, 18, 5, 9, 15, 18, 20, 21, 5, 15,
+    22, 5, 9, 15, 1, 18, 21, 32, 5, 9, 21, 1, 5, 6, 9, 13,
+    15, 17, 20, 21, 1, 15, 16, 21, 4, 7, 9, 21, 29, 1, 5, 12,
+    15, 18, 2, 5, 13, 18, 20, 5, 9, 14, 5, 9, 15, 18, 20, 9,
+    21, 15, 31, 2, 5, 16, 1, 3, 4, 6, 7, 8, 10, 12, 13, 18,
+    19, 20, 22, 3, 20, 16, 20, 5, 9, 18, 14, 21, 21, 1, 16, 3,
+    5, 6, 8, 19, 20, 22, 20, 5, 12, 19, 21, 15, 1, 12, 3, 4,
+    5, 7, 9, 20, 5, 9, 9, 5, 28, 9, 19, 1, 12, 9, 20, 20,
+    4, 0, 19, 0, 19, 0, 14, 1, 5, 8, 9, 15, 21, 27, 28, 29,
+    31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 0, 0, 0,
+    0, 0, 0, 1, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 0,
+    9, 14, 19, 5, 0, 19, 0, 18, 19, 19, 0, 9, 14, 19, 0, 9,
+    13, 14, 19, 14, 0, 14, 19, 0, 9, 19, 1, 19, 0, 9, 14, 19,
+    5, 19, 19, 0, 1, 5, 9, 13, 0, 0, 0, 0, 13, 0, 13, 13,
+    13, 0, 19, 15, 0, 0, 18, 18, 14, 20, 9, 18, 1, 5, 15, 27,
+    28, 31, 19, 9, 13, 13, 18, 3, 17, 19, 18, 9, 1, 5, 8, 9,
+    15, 21, 27, 28, 29, 31, 32, 18, 3, 18, 20, 14, 1, 5, 15, 9,
+    15, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 0, 5, 0, 14,
+    14, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9,
+    15, 21, 27, 28, 29, 31, 32, 15, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 1, 5, 9, 15, 18, 21, 27, 28, 29, 31, 32, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 0, 0, 0, 1, 5, 8, 9,
+    15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29,
+    31, 32, 19, 0, 19, 0, 14, 15, 19, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 1, 5, 27, 5, 9, 18, 28, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 1, 1, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 1, 5, 15, 15, 0, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 18, 20, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 14, 0, 0, 0, 5, 0, 19, 0, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 1, 3, 14, 1, 5, 8, 9, 15, 21, 27, 28, 29,
+    31, 32, 15, 19, 12, 19, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 20, 9, 14, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 20,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 14, 18, 13, 18, 18,
+    19, 0, 19, 9, 9, 9, 21, 32, 29, 9, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 3, 3, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1,
+    5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 19, 1, 15, 31, 0, 19, 19, 19, 1, 5, 9,
+    15, 18, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28,
+    29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5,
+    8, 9, 15, 21, 27, 28, 29, 31, 32, 0, 1, 5, 8, 9, 15, 21,
+    27, 28, 29, 31, 32, 1, 5, 9, 15, 21, 27, 28, 29, 31, 32, 14,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31,
+    32, 19, 1, 5, 15, 12, 1, 5, 15, 1, 5, 15, 1, 5, 15, 5,
+    15, 19, 5, 5, 0, 19, 0, 19, 0, 19, 19, 19, 1, 5, 15, 12,
+    1, 5, 15, 1, 5, 15, 1, 5, 15, 19, 1, 5, 15, 12, 1, 15,
+    1, 5, 15, 1, 5, 15, 0, 19, 0, 19, 0, 19, 1, 5, 15, 12,
+    1, 5, 15, 1, 5, 15, 1, 5, 15, 0, 0, 0, 0, 19, 0, 1,
+    15, 0, 19, 0, 19, 0, 19, 15, 7, 15, 31, 18, 4, 4, 12, 5,
+    14, 12, 4, 13, 10, 14, 13, 12, 13, 1, 14, 16, 22, 19, 14, 12,
+    5, 14, 12, 3, 5, 15, 3, 20, 3, 3, 19, 21, 2, 18, 18, 5,
+    9, 29, 12, 20, 15, 9, 19, 19, 18, 18, 5, 18, 18, 14, 16, 1,
+    22, 12, 3, 13, 12, 9, 5, 21, 19, 3, 4, 18, 1, 15, 1, 12,
+    15, 1, 5, 9, 15, 18, 21, 27, 28, 29, 31, 32, 12, 13, 20, 12,
+    15, 4, 21, 20, 20, 18, 5, 18, 19, 20, 12, 18, 7, 12, 13, 14,
+    26, 16, 5, 15, 12, 18, 14, 14, 15, 18, 18, 21, 19, 19, 13, 19,
+    26, 26, 13, 13, 18, 1, 3, 3, 20, 20, 18, 18, 18, 18, 12, 21,
+    12, 20, 18, 20, 16, 20, 14, 12, 9, 19, 14, 9, 4, 25, 9, 2,
+    9, 4, 18, 5, 20, 5, 20, 19, 13, 2, 12, 30, 19, 0, 0, 14,
+    0, 19, 0, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 19, 0,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 1, 5, 8, 9, 15,
+    21, 27, 28, 29, 31, 32, 18, 1, 5, 8, 9, 15, 21, 27, 28, 29,
+    31, 32, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 9, 19, 12,
+    20, 9, 15, 9, 12, 18, 5, 2, 13, 14, 16, 18, 19, 20, 1, 5,
+    9, 1, 18, 21, 18, 5, 18, 3, 12, 14, 18, 18, 1, 5, 21, 9,
+    18, 10, 19, 7, 14, 15, 5, 14, 22, 30, 9, 10, 21, 5, 13, 18,
+    2, 12, 18, 1, 5, 5, 18, 4, 13, 4, 13, 3, 4, 18, 30, 7,
+    18, 19, 9, 12, 25, 5, 9, 15, 15, 14, 5, 1, 5, 9, 15, 21,
+    9, 14, 19, 14, 5, 14, 18, 1, 15, 19, 14, 14, 14, 1, 15, 18,
+    27, 10, 1, 5, 12, 15, 27, 28, 13, 1, 8, 12, 15, 18, 21, 27,
+    1, 9, 15, 18, 21, 27, 31, 1, 15, 18, 27, 5, 1, 15, 1, 5,
+    9, 15, 18, 21, 1, 15, 9, 1, 5, 1, 9, 18, 1, 15, 20, 1,
+    19, 7, 14, 15, 18, 5, 12, 15, 18, 14, 5, 12, 15, 9, 5, 20,
+    5, 15, 5, 5, 4, 9, 20, 16, 18, 3, 4, 5, 5, 10, 1, 5,
+    9, 7, 3, 20, 14, 18, 19, 12, 5, 13, 18, 1, 5, 0, 0, 20,
+    19, 0, 0, 0, 13, 19, 0, 0, 1, 5, 0, 0, 19, 0, 0, 19,
+    15, 0, 0, 0, 0, 0, 19, 0, 0, 9, 13, 14, 19, 0, 19, 0,
+    0, 0, 9, 19, 0, 0, 0, 19, 19, 4, 5, 15, 15, 15, 15, 0,
+    19, 2, 9, 1, 14, 9, 9, 13, 1, 1, 5, 8, 9, 15, 21, 27,
+    28, 29, 31, 32, 19, 20, 20, 1, 5, 8, 9, 15, 21, 27, 28, 29,
+    31, 32, 3, 14, 24, 14, 0, 0, 15, 19, 5, 12, 13, 20, 19, 14,
+    15, 5, 19, 0, 19, 1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32,
+    1, 5, 8, 9, 15, 21, 27, 28, 29, 31, 32, 21, 19, 19, 0, 0,
+    19, 1, 15, 20, 14, 0, 1, 15, 5, 1, 4, 4, 20, 3, 17, 9,
+    17, 20, 0, 7, 10, 14, 19, 16, 16, 14, 9, 9, 0, 0, 19, 14,
+    14, 0, 0, 18, 15, 18, 22, 3, 12, 14, 20, 24, 32, 3, 7, 10,
+    19, 20, 3, 2, 18, 19, 20, 0, 0, 19, 0, 19, 0, 19, 1, 5,
+    15, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0,
+    19, 0, 19, 0, 12, 19, 0, 0, 12, 13, 14, 0, 12, 13, 14, 0,
+    0, 0, 0, 0, 0, 19, 0, 19, 0, 19, 1, 5, 15, 0, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0,
+    0, 19, 0, 19, 0, 19, 1, 5, 15, 0, 19, 0, 19, 0, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 0, 0, 0, 19, 0, 19,
+    0, 19, 1, 5, 15, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 0, 19, 0, 19, 0, 0, 0, 18,
+    5, 5, 12, 4, 1, 5, 20, 20, 9, 5, 14, 9, 20, 14, 14, 14,
+    5, 20, 20, 20, 1, 5, 27, 3, 4, 20, 20, 14, 9, 9, 3, 3,
+    14, 7, 20, 9, 9, 18, 1, 5, 27, 19, 15, 21, 9, 14, 19, 1,
+    9, 18, 15, 16, 9, 5, 7, 9, 15, 1, 16, 4, 5, 1, 15, 5,
+    22, 13, 1, 5, 27, 28, 1, 9, 18, 13, 13, 16, 20, 20, 13, 20,
+    1, 27, 1, 5, 1, 1, 9, 9, 9, 29, 27, 21, 5, 5, 5, 1,
+    9, 29, 5, 16, 3, 9, 29, 14, 1, 9, 5, 16, 10, 31, 0, 1,
+    0, 0, 5, 5, 20, 12, 15, 4, 3, 20, 5, 20, 18, 1, 15, 16,
+    19, 12, 18, 20, 12, 4, 22, 18, 5, 4, 1, 13, 14, 18, 18, 18,
+    3, 4, 22, 7, 16, 19, 18, 20, 1, 20, 13, 18, 14, 5, 28, 4,
+    9, 18, 2, 18, 12, 4, 20, 2, 12, 9, 18, 5, 9, 3, 3, 9,
+    14, 20, 5, 2, 16, 22, 12, 9, 7, 14, 13, 12, 16, 7, 3, 20,
+    20, 3, 4, 20, 14, 14, 14, 18, 12, 18, 12, 18, 19, 20, 1, 15,
+    21, 27, 31, 32, 12, 18, 3, 17, 18, 20, 30, 4, 7, 15, 18, 5,
+    12, 20, 26, 30, 2, 4, 10, 12, 13, 14, 16, 18, 10, 12, 18, 4,
+    5, 14, 18, 4, 14, 18, 19, 30, 13, 26, 1, 30, 2, 4, 26, 14,
+    18, 5, 28, 9, 12, 18, 2, 13, 12, 9, 9, 14, 5, 14, 9, 18,
+    21, 3, 3, 1, 18, 2, 3, 1, 7, 18, 24, 18, 14, 5, 7, 18,
+    14, 14, 10, 1, 18, 14, 15, 0, 5, 0, 0, 19, 19, 0, 0, 19,
+    0, 19, 15, 0, 0, 0, 19, 0, 0, 0, 1, 14, 19, 19, 19, 19,
+    0, 18, 0, 5, 5, 29, 9, 29, 9, 9, 19, 0, 12, 12, 1, 5,
+    15, 5, 5, 1, 19, 18, 7, 0, 18, 21, 0, 0, 0, 13, 19, 0,
+    19, 5, 20, 18, 18, 5, 1, 5, 5, 1, 5, 27, 1, 0, 5, 0,
+    18, 9, 3, 16, 4, 12, 21, 14, 9, 5, 9, 29, 1, 15, 27, 20,
+    1, 5, 9, 15, 27, 28, 31, 5, 19, 20, 5, 0, 0, 0, 0, 19,
+    0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 15,
+    0, 1, 5, 15, 5, 15, 1, 5, 15, 5, 15, 0, 0, 0, 0, 19,
+    0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 19, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 19, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 19, 5, 4, 18, 20, 2, 26, 9, 19, 1, 5, 15, 27, 28,
+    31, 7, 13, 16, 26, 14, 9, 16, 3, 18, 20, 3, 26, 26, 5, 18,
+    14, 13, 13, 14, 9, 14, 14, 20, 4, 1, 14, 8, 18, 20, 18, 4,
+    21, 9, 9, 20, 26, 18, 5, 20, 9, 9, 18, 12, 18, 12, 2, 3,
+    3, 9, 12, 4, 20, 9, 5, 7, 12, 4, 12, 21, 4, 3, 7, 19,
+    18, 3, 7, 22, 12, 10, 7, 22, 12, 10, 21, 5, 28, 18, 18, 5,
+    14, 22, 18, 12, 20, 12, 14, 4, 3, 18, 4, 14, 18, 14, 18, 14,
+    22, 1, 9, 14, 19, 20, 14, 16, 19, 13, 13, 20, 12, 18, 3, 9,
+    20, 14, 14, 0, 0, 0, 19, 0, 4, 20, 0, 0, 0, 0, 9, 14,
+    13, 13, 1, 13, 0, 12, 1, 5, 15, 1, 5, 15, 0, 19, 0, 19,
+    0, 19, 0, 12, 0, 12, 18, 20, 14, 5, 0, 0, 0, 1, 1, 19,
+    20, 9, 15, 31, 15, 22, 18, 20, 1, 0, 0, 0, 0, 19, 0, 19,
+    0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19,
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 16, 3, 20, 20,
+    26, 20, 13, 26, 20, 3, 2, 12, 3, 12, 5, 12, 5, 12, 5, 28,
+    10, 14, 10, 26, 8, 9, 3, 14, 12, 20, 20, 0, 0, 5, 5, 5,
+    9, 9, 15, 1, 5, 15, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19,
+    0, 19, 0, 0, 0, 1, 5, 15, 1, 5, 15, 15, 14, 0, 0, 19,
+    14, 14, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 8,
+    20, 20, 20, 13, 26, 5, 19, 0, 0, 19, 0, 19, 0, 19, 0, 0,
+    0, 0, 0, 0, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19,
+    20, 0, 1, 5, 15, 27, 28, 31, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0,
+};
+
+static const uint16_t hyph_esNodeFirstChild[5830] = {
+    1, 33, 57, 74, 97, 124, 147, 160, 184, 211, 237, 246, 268, 291, 315, 342,
+    367, 377, 404, 427, 452, 478, 504, 506, 529, 552, 575, 597, 620, 627, 633, 640,
+    641, 646, 647, 648, 650, 652, 654, 654, 654, 656, 657, 657, 657, 657, 659, 659,
+    662, 662, 663, 665, 667, 667, 667, 667, 667, 667, 667, 669, 670, 673, 680, 681,
+    683, 684, 686, 688, 694, 695, 709, 713, 714, 715, 716, 716, 716, 719, 719, 720,
+    721, 721, 725, 725, 725, 747, 748, 748, 751, 751, 773, 773, 775, 775, 775, 775,
+    775, 775, 775, 778, 778, 781, 781, 783, 784, 785, 807, 809, 809, 809, 831, 832,
+    835, 836, 839, 839, 863, 863, 866, 867, 867, 867, 867, 867, 868, 868, 868, 871,
+    871, 874, 875, 876, 876, 876, 876, 876, 877, 877, 880, 880, 902, 902, 904, 904,
+    904, 904, 904, 904, 904, 907, 910, 916, 917, 920, 923, 926, 939, 940, 942, 953,
+    954, 954, 955, 955, 955, 955, 955, 955, 955, 955, 955, 977, 977, 977, 979, 979,
+    979, 1001, 1001, 1002, 1002, 1002, 1002, 1002, 1002, 1002, 1003, 1003, 1003, 1003, 1004, 1004,
+    1004, 1004, 1005, 1005, 1005, 1028, 1028, 1029, 1030, 1030, 1030, 1052, 1052, 1052, 1054, 1054,
+    1054, 1054, 1054, 1054, 1054, 1055, 1055, 1055, 1055, 1059, 1059, 1059, 1059, 1062, 1062, 1062,
+    1062, 1062, 1062, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1067, 1068,
+    1070, 1072, 1073, 1076, 1080, 1082, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083,
+    1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083,
+    1083, 1083, 1083, 1083, 1084, 1084, 1084, 1106, 1106, 1106, 1106, 1106, 1128, 1128, 1128, 1128,
+    1128, 1128, 1128, 1128, 1128, 1128, 1131, 1131, 1132, 1133, 1133, 1134, 1134, 1134, 1156, 1157,
+    1157, 1158, 1161, 1161, 1161, 1161, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1167, 1167, 1170,
+    1170, 1175, 1176, 1177, 1177, 1181, 1181, 1181, 1181, 1182, 1183, 1184, 1187, 1187, 1187, 1187,
+    1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1191, 1194, 1194, 1197, 1198, 1199, 1199,
+    1199, 1199, 1199, 1200, 1200, 1202, 1205, 1205, 1205, 1205, 1208, 1208, 1208, 1208, 1208, 1208,
+    1208, 1209, 1210, 1212, 1214, 1217, 1218, 1219, 1220, 1223, 1223, 1226, 1226, 1226, 1226, 1229,
+    1229, 1229, 1229, 1230, 1230, 1230, 1254, 1254, 1255, 1257, 1257, 1257, 1281, 1283, 1284, 1285,
+    1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+    1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1289, 1289, 1292,
+    1292, 1294, 1295, 1296, 1296, 1296, 1296, 1296, 1298, 1298, 1299, 1302, 1302, 1324, 1324, 1326,
+    1326, 1326, 1326, 1326, 1326, 1326, 1329, 1329, 1332, 1332, 1334, 1335, 1336, 1336, 1336, 1336,
+    1336, 1337, 1337, 1339, 1343, 1343, 1343, 1343, 1349, 1351, 1351, 1351, 1351, 1351, 1351, 1351,
+    1352, 1352, 1355, 1355, 1358, 1359, 1360, 1360, 1361, 1361, 1361, 1361, 1362, 1362, 1363, 1366,
+    1366, 1390, 1391, 1393, 1393, 1393, 1393, 1393, 1395, 1396, 1397, 1397, 1397, 1397, 1397, 1397,
+    1397, 1397, 1399, 1399, 1399, 1421, 1421, 1421, 1421, 1421, 1443, 1443, 1443, 1443, 1443, 1443,
+    1443, 1443, 1443, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
+    1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1447, 1447, 1448, 1449, 1450,
+    1450, 1450, 1450, 1450, 1451, 1451, 1454, 1454, 1454, 1454, 1456, 1456, 1456, 1456, 1456, 1456,
+    1456, 1456, 1459, 1459, 1460, 1461, 1461, 1461, 1461, 1461, 1462, 1462, 1465, 1465, 1465, 1465,
+    1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+    1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1473, 1474,
+    1475, 1476, 1483, 1485, 1485, 1490, 1491, 1492, 1497, 1497, 1497, 1502, 1503, 1505, 1506, 1508,
+    1509, 1509, 1509, 1510, 1511, 1512, 1513, 1525, 1530, 1531, 1542, 1544, 1545, 1555, 1565, 1567,
+    1568, 1579, 1580, 1581, 1582, 1583, 1585, 1595, 1596, 1599, 1600, 1602, 1602, 1602, 1606, 1607,
+    1609, 1610, 1610, 1612, 1615, 1616, 1617, 1620, 1621, 1622, 1623, 1624, 1625, 1625, 1626, 1627,
+    1628, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1634, 1638, 1639, 1644, 1646, 1649, 1650, 1651,
+    1653, 1654, 1655, 1658, 1661, 1663, 1663, 1667, 1668, 1669, 1670, 1671, 1672, 1672, 1672, 1672,
+    1672, 1672, 1673, 1674, 1685, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686,
+    1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686,
+    1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686,
+    1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1687, 1689, 1690, 1690, 1690, 1690, 1691, 1692,
+    1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692,
+    1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1693, 1694, 1694, 1694, 1694, 1694, 1694, 1694,
+    1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694,
+    1694, 1694, 1695, 1696, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1698,
+    1698, 1698, 1698, 1698, 1698, 1699, 1699, 1699, 1699, 1699, 1699, 1699, 1699, 1699, 1699, 1699,
+    1699, 1699, 1699, 1700, 1700, 1700, 1700, 1700, 1701, 1702, 1709, 1709, 1709, 1709, 1709, 1709,
+    1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709,
+    1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1710, 1711, 1712, 1713, 1724, 1725, 1725,
+    1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1736, 1737, 1739, 1739, 1740, 1740, 1740,
+    1747, 1748, 1749, 1752, 1753, 1754, 1755, 1756, 1757, 1763, 1766, 1768, 1768, 1769, 1770, 1773,
+    1776, 1781, 1785, 1786, 1787, 1789, 1791, 1792, 1796, 1797, 1798, 1799, 1799, 1799, 1799, 1799,
+    1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799,
+    1799, 1799, 1800, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801,
+    1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1802, 1813, 1814, 1814, 1814,
+    1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1815,
+    1815, 1815, 1815, 1815, 1815, 1815, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817,
+    1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1819, 1821, 1823,
+    1824, 1825, 1828, 1829, 1830, 1832, 1833, 1834, 1834, 1836, 1837, 1838, 1839, 1841, 1844, 1845,
+    1846, 1847, 1850, 1851, 1854, 1855, 1856, 1858, 1859, 1859, 1860, 1871, 1872, 1872, 1872, 1872,
+    1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
+    1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
+    1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1873, 1873,
+    1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873,
+    1873, 1873, 1873, 1873, 1873, 1873, 1874, 1874, 1874, 1874, 1874, 1874, 1875, 1887, 1888, 1889,
+    1889, 1889, 1889, 1890, 1891, 1892, 1893, 1894, 1894, 1894, 1895, 1896, 1897, 1898, 1898, 1898,
+    1899, 1899, 1899, 1899, 1899, 1899, 1900, 1901, 1901, 1901, 1901, 1902, 1913, 1914, 1914, 1914,
+    1914, 1914, 1915, 1915, 1915, 1915, 1916, 1916, 1916, 1916, 1918, 1918, 1918, 1920, 1922, 1923,
+    1924, 1925, 1926, 1927, 1928, 1928, 1931, 1933, 1934, 1935, 1936, 1937, 1938, 1941, 1942, 1942,
+    1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943,
+    1943, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1945, 1946, 1946, 1946, 1946, 1946, 1948, 1948,
+    1948, 1948, 1948, 1948, 1948, 1948, 1948, 1949, 1949, 1949, 1949, 1949, 1949, 1949, 1949, 1949,
+    1949, 1949, 1949, 1951, 1951, 1953, 1954, 1955, 1956, 1962, 1962, 1962, 1962, 1963, 1964, 1964,
+    1964, 1965, 1965, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966,
+    1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966, 1966,
+    1967, 1968, 1968, 1968, 1968, 1969, 1970, 1970, 1970, 1970, 1971, 1972, 1973, 1973, 1973, 1973,
+    1974, 1976, 1977, 1978, 1978, 1978, 1979, 1981, 1982, 1982, 1982, 1982, 1983, 1984, 1986, 1986,
+    1986, 1988, 1988, 1989, 1989, 1989, 1989, 1989, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991,
+    1991, 1991, 1991, 1991, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992,
+    1992, 1992, 1992, 1993, 1994, 1995, 1996, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997,
+    1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997,
+    1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997, 1997,
+    1997, 1997, 1997, 1997, 1998, 1998, 1998, 1998, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999,
+    1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 2010, 2011, 2012, 2013,
+    2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2025, 2026, 2027, 2028,
+    2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2038, 2039, 2040, 2041, 2042, 2043,
+    2045, 2047, 2048, 2049, 2052, 2053, 2054, 2054, 2055, 2056, 2058, 2060, 2060, 2066, 2071, 2073,
+    2077, 2078, 2078, 2078, 2080, 2081, 2083, 2084, 2085, 2086, 2087, 2088, 2093, 2097, 2099, 2100,
+    2102, 2102, 2103, 2103, 2103, 2104, 2104, 2114, 2115, 2116, 2118, 2119, 2119, 2120, 2121, 2121,
+    2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2121, 2122, 2123,
+    2124, 2133, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2142, 2142, 2143, 2146, 2147, 2151, 2152,
+    2163, 2173, 2183, 2183, 2185, 2189, 2194, 2195, 2195, 2195, 2195, 2195, 2196, 2207, 2209, 2212,
+    2213, 2214, 2215, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2232, 2232, 2233, 2234, 2236, 2238,
+    2239, 2240, 2240, 2243, 2244, 2245, 2256, 2257, 2268, 2269, 2270, 2271, 2272, 2273, 2273, 2284,
+    2285, 2296, 2296, 2296, 2297, 2298, 2299, 2300, 2300, 2301, 2302, 2303, 2304, 2304, 2306, 2308,
+    2310, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2318, 2319, 2320, 2320, 2321, 2322, 2327, 2328,
+    2328, 2329, 2330, 2331, 2334, 2334, 2335, 2346, 2348, 2349, 2355, 2355, 2355, 2355, 2355, 2355,
+    2355, 2355, 2355, 2355, 2355, 2355, 2356, 2356, 2357, 2357, 2358, 2359, 2360, 2361, 2372, 2373,
+    2374, 2375, 2376, 2377, 2377, 2388, 2389, 2407, 2413, 2420, 2430, 2435, 2436, 2437, 2439, 2440,
+    2441, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2442, 2443, 2444, 2446,
+    2448, 2449, 2450, 2452, 2453, 2454, 2455, 2455, 2456, 2467, 2478, 2479, 2479, 2481, 2484, 2485,
+    2486, 2492, 2495, 2496, 2497, 2498, 2500, 2502, 2504, 2505, 2506, 2507, 2508, 2509, 2509, 2510,
+    2511, 2512, 2514, 2516, 2516, 2517, 2518, 2523, 2524, 2535, 2546, 2547, 2548, 2549, 2550, 2551,
+    2552, 2555, 2558, 2560, 2568, 2569, 2570, 2572, 2573, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
+    2582, 2583, 2585, 2586, 2590, 2591, 2592, 2593, 2604, 2615, 2616, 2616, 2616, 2616, 2616, 2616,
+    2616, 2616, 2616, 2616, 2616, 2616, 2627, 2628, 2629, 2631, 2631, 2632, 2632, 2633, 2634, 2635,
+    2636, 2637, 2638, 2649, 2660, 2671, 2672, 2673, 2684, 2685, 2696, 2698, 2700, 2701, 2701, 2702,
+    2702, 2703, 2703, 2704, 2705, 2707, 2709, 2709, 2709, 2710, 2711, 2711, 2712, 2713, 2714, 2715,
+    2716, 2717, 2718, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719,
+    2730, 2731, 2732, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733,
+    2734, 2745, 2746, 2758, 2759, 2760, 2760, 2761, 2762, 2773, 2774, 2785, 2786, 2797, 2798, 2798,
+    2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2809, 2810, 2811, 2822, 2833, 2835,
+    2837, 2838, 2841, 2842, 2843, 2844, 2855, 2856, 2856, 2856, 2857, 2858, 2858, 2859, 2860, 2861,
+    2872, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2890, 2891, 2894, 2897, 2898, 2899, 2899,
+    2899, 2899, 2900, 2901, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2904, 2905, 2906, 2917, 2918,
+    2918, 2929, 2930, 2931, 2932, 2933, 2935, 2935, 2936, 2937, 2940, 2941, 2942, 2943, 2944, 2955,
+    2956, 2958, 2959, 2960, 2961, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2989, 2990, 2990, 3001,
+    3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3001, 3002, 3003, 3004, 3005, 3006,
+    3006, 3012, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028,
+    3028, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3038, 3038, 3040, 3040, 3041, 3041, 3042,
+    3043, 3045, 3047, 3050, 3051, 3052, 3054, 3055, 3055, 3056, 3057, 3058, 3063, 3064, 3065, 3067,
+    3067, 3069, 3070, 3071, 3072, 3073, 3075, 3077, 3078, 3089, 3090, 3091, 3092, 3092, 3093, 3094,
+    3095, 3095, 3096, 3097, 3101, 3101, 3101, 3101, 3101, 3102, 3104, 3105, 3106, 3107, 3109, 3110,
+    3111, 3112, 3113, 3114, 3115, 3118, 3119, 3120, 3121, 3121, 3121, 3122, 3122, 3122, 3122, 3122,
+    3122, 3122, 3122, 3122, 3123, 3124, 3125, 3127, 3128, 3129, 3130, 3131, 3133, 3135, 3136, 3137,
+    3138, 3139, 3141, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156,
+    3159, 3161, 3162, 3173, 3175, 3176, 3177, 3178, 3189, 3189, 3189, 3189, 3189, 3189, 3189, 3189,
+    3189, 3189, 3189, 3189, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3190, 3191, 3192,
+    3194, 3195, 3197, 3199, 3201, 3202, 3202, 3202, 3202, 3207, 3207, 3207, 3207, 3208, 3210, 3212,
+    3215, 3217, 3218, 3219, 3219, 3224, 3226, 3232, 3234, 3236, 3237, 3237, 3237, 3239, 3239, 3239,
+    3241, 3242, 3243, 3244, 3245, 3247, 3257, 3258, 3259, 3259, 3259, 3260, 3261, 3262, 3262, 3262,
+    3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3262, 3263, 3263, 3264, 3264, 3265, 3265,
+    3266, 3266, 3268, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269, 3269,
+    3269, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3270, 3271, 3271, 3272,
+    3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3283, 3283, 3283,
+    3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3283, 3284, 3284, 3284, 3295, 3296, 3297, 3297,
+    3297, 3297, 3298, 3298, 3299, 3299, 3300, 3300, 3301, 3301, 3302, 3302, 3302, 3302, 3302, 3302,
+    3302, 3303, 3303, 3303, 3304, 3305, 3306, 3307, 3307, 3308, 3308, 3308, 3308, 3309, 3310, 3310,
+    3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3310, 3311, 3312, 3314, 3314,
+    3314, 3314, 3314, 3314, 3314, 3315, 3316, 3317, 3328, 3339, 3339, 3339, 3339, 3339, 3339, 3339,
+    3339, 3339, 3339, 3339, 3339, 3339, 3350, 3351, 3352, 3363, 3363, 3363, 3363, 3364, 3364, 3364,
+    3364, 3364, 3364, 3364, 3364, 3365, 3368, 3374, 3377, 3380, 3384, 3386, 3387, 3396, 3400, 3405,
+    3410, 3415, 3418, 3422, 3423, 3424, 3425, 3427, 3430, 3443, 3443, 3443, 3445, 3447, 3449, 3450,
+    3452, 3453, 3455, 3462, 3463, 3466, 3467, 3468, 3470, 3471, 3476, 3477, 3478, 3479, 3481, 3483,
+    3484, 3485, 3486, 3487, 3488, 3489, 3491, 3493, 3494, 3495, 3506, 3517, 3518, 3518, 3519, 3519,
+    3520, 3520, 3521, 3521, 3522, 3522, 3523, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524,
+    3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3524, 3535,
+    3539, 3540, 3540, 3542, 3545, 3546, 3546, 3550, 3555, 3556, 3559, 3562, 3564, 3564, 3568, 3569,
+    3570, 3571, 3576, 3576, 3577, 3577, 3578, 3578, 3579, 3579, 3580, 3580, 3580, 3580, 3581, 3582,
+    3582, 3583, 3584, 3584, 3585, 3586, 3586, 3586, 3587, 3588, 3589, 3590, 3590, 3590, 3590, 3590,
+    3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590, 3590,
+    3590, 3590, 3590, 3591, 3592, 3593, 3593, 3594, 3595, 3595, 3595, 3595, 3595, 3595, 3595, 3596,
+    3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3602, 3603, 3604, 3605, 3606, 3607, 3610, 3611,
+    3612, 3623, 3624, 3627, 3628, 3628, 3628, 3628, 3628, 3628, 3631, 3631, 3631, 3631, 3631, 3631,
+    3631, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632,
+    3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3633, 3633, 3633, 3633, 3633, 3633, 3633, 3633,
+    3633, 3633, 3633, 3633, 3644, 3646, 3646, 3647, 3647, 3647, 3648, 3649, 3660, 3671, 3672, 3672,
+    3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672,
+    3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672, 3672,
+    3683, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3694, 3705, 3705, 3705,
+    3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3705, 3706, 3706, 3707, 3708, 3719, 3719,
+    3730, 3730, 3730, 3731, 3731, 3732, 3733, 3733, 3734, 3737, 3737, 3748, 3751, 3755, 3766, 3767,
+    3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3767, 3768, 3768, 3779, 3780, 3780,
+    3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3780, 3781, 3781, 3781, 3781, 3781, 3782,
+    3782, 3782, 3782, 3782, 3782, 3782, 3782, 3783, 3784, 3795, 3796, 3797, 3797, 3797, 3797, 3797,
+    3797, 3797, 3797, 3797, 3797, 3797, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808,
+    3808, 3808, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3819, 3830, 3830,
+    3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3830, 3841, 3842, 3842, 3842, 3842, 3842,
+    3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
+    3842, 3842, 3842, 3843, 3843, 3844, 3846, 3846, 3848, 3849, 3860, 3861, 3862, 3862, 3862, 3862,
+    3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3862, 3863, 3863, 3863, 3874, 3875, 3875, 3875,
+    3875, 3876, 3876, 3877, 3877, 3877, 3878, 3878, 3878, 3889, 3890, 3891, 3892, 3903, 3904, 3915,
+    3917, 3917, 3917, 3917, 3918, 3919, 3920, 3921, 3921, 3921, 3921, 3923, 3924, 3925, 3926, 3928,
+    3929, 3930, 3941, 3952, 3963, 3974, 3985, 3986, 3987, 3998, 4009, 4009, 4009, 4009, 4009, 4009,
+    4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009, 4009,
+    4009, 4009, 4020, 4031, 4042, 4053, 4053, 4054, 4054, 4057, 4057, 4059, 4060, 4061, 4072, 4083,
+    4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4094, 4105, 4105, 4106, 4117,
+    4117, 4117, 4117, 4117, 4117, 4117, 4117, 4117, 4117, 4117, 4117, 4117, 4117, 4127, 4128, 4139,
+    4139, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4150, 4161, 4161,
+    4161, 4161, 4161, 4161, 4161, 4161, 4161, 4161, 4161, 4161, 4162, 4165, 4166, 4169, 4172, 4175,
+    4176, 4177, 4178, 4179, 4180, 4182, 4184, 4186, 4187, 4188, 4191, 4192, 4195, 4198, 4201, 4202,
+    4205, 4206, 4208, 4211, 4214, 4216, 4218, 4220, 4223, 4224, 4227, 4230, 4233, 4233, 4234, 4234,
+    4235, 4235, 4235, 4235, 4235, 4236, 4236, 4237, 4237, 4238, 4239, 4241, 4241, 4243, 4245, 4247,
+    4248, 4248, 4249, 4249, 4249, 4251, 4251, 4251, 4252, 4252, 4253, 4254, 4254, 4254, 4255, 4256,
+    4257, 4258, 4259, 4260, 4260, 4260, 4262, 4262, 4262, 4262, 4262, 4262, 4262, 4262, 4262, 4262,
+    4262, 4262, 4263, 4263, 4263, 4263, 4264, 4265, 4266, 4266, 4269, 4270, 4271, 4272, 4273, 4274,
+    4275, 4276, 4277, 4278, 4280, 4281, 4282, 4282, 4283, 4284, 4284, 4285, 4286, 4286, 4287, 4290,
+    4291, 4291, 4292, 4293, 4294, 4294, 4295, 4296, 4297, 4298, 4298, 4299, 4299, 4299, 4300, 4301,
+    4302, 4303, 4304, 4305, 4306, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4318, 4321,
+    4332, 4333, 4334, 4335, 4336, 4337, 4337, 4338, 4339, 4340, 4341, 4341, 4341, 4341, 4341, 4341,
+    4341, 4341, 4341, 4341, 4341, 4341, 4342, 4343, 4344, 4345, 4346, 4346, 4348, 4353, 4354, 4356,
+    4358, 4358, 4358, 4359, 4360, 4360, 4361, 4361, 4361, 4362, 4363, 4364, 4365, 4366, 4369, 4370,
+    4371, 4372, 4373, 4373, 4373, 4373, 4373, 4373, 4374, 4375, 4376, 4377, 4378, 4379, 4379, 4380,
+    4381, 4382, 4383, 4383, 4384, 4385, 4386, 4386, 4387, 4388, 4390, 4391, 4392, 4393, 4394, 4394,
+    4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 4411,
+    4411, 4411, 4411, 4412, 4412, 4412, 4412, 4412, 4412, 4412, 4412, 4412, 4412, 4413, 4413, 4413,
+    4413, 4413, 4413, 4413, 4414, 4415, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+    4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+    4416, 4417, 4417, 4417, 4417, 4417, 4417, 4417, 4417, 4418, 4418, 4418, 4418, 4419, 4419, 4419,
+    4430, 4431, 4432, 4432, 4443, 4454, 4454, 4454, 4454, 4454, 4454, 4454, 4455, 4455, 4455, 4455,
+    4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455, 4455,
+    4455, 4455, 4455, 4455, 4455, 4455, 4455, 4466, 4477, 4477, 4477, 4477, 4477, 4477, 4477, 4477,
+    4477, 4477, 4477, 4477, 4478, 4478, 4479, 4481, 4483, 4486, 4487, 4494, 4496, 4497, 4498, 4500,
+    4501, 4502, 4503, 4506, 4507, 4508, 4511, 4512, 4512, 4513, 4514, 4515, 4516, 4517, 4518, 4522,
+    4523, 4524, 4525, 4526, 4527, 4528, 4531, 4532, 4533, 4533, 4535, 4537, 4538, 4539, 4543, 4546,
+    4547, 4549, 4552, 4553, 4554, 4555, 4560, 4561, 4562, 4563, 4563, 4564, 4566, 4567, 4568, 4569,
+    4570, 4571, 4572, 4573, 4577, 4578, 4584, 4585, 4592, 4592, 4599, 4603, 4604, 4604, 4606, 4606,
+    4606, 4606, 4612, 4614, 4615, 4615, 4617, 4619, 4620, 4622, 4623, 4623, 4624, 4625, 4627, 4629,
+    4633, 4634, 4637, 4638, 4640, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4651, 4651, 4652,
+    4653, 4654, 4655, 4656, 4657, 4658, 4658, 4658, 4658, 4658, 4659, 4660, 4663, 4664, 4667, 4668,
+    4668, 4669, 4669, 4670, 4670, 4671, 4671, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672,
+    4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672,
+    4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672,
+    4672, 4673, 4674, 4675, 4678, 4678, 4679, 4679, 4682, 4683, 4684, 4684, 4685, 4686, 4687, 4687,
+    4688, 4689, 4690, 4691, 4692, 4692, 4693, 4694, 4694, 4695, 4696, 4701, 4702, 4702, 4703, 4704,
+    4705, 4708, 4709, 4710, 4710, 4712, 4713, 4714, 4715, 4715, 4715, 4715, 4715, 4716, 4716, 4717,
+    4718, 4719, 4719, 4720, 4721, 4721, 4721, 4722, 4722, 4722, 4723, 4724, 4724, 4724, 4724, 4724,
+    4724, 4724, 4724, 4724, 4725, 4726, 4727, 4727, 4727, 4727, 4728, 4728, 4728, 4728, 4728, 4728,
+    4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728, 4728,
+    4729, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4741, 4741,
+    4742, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743,
+    4743, 4743, 4743, 4743, 4743, 4743, 4743, 4743, 4754, 4754, 4754, 4754, 4754, 4754, 4754, 4754,
+    4754, 4754, 4754, 4754, 4754, 4754, 4755, 4757, 4757, 4757, 4757, 4757, 4757, 4758, 4758, 4758,
+    4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758,
+    4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758, 4758,
+    4758, 4758, 4758, 4759, 4759, 4760, 4760, 4761, 4762, 4766, 4766, 4766, 4766, 4766, 4766, 4766,
+    4766, 4766, 4766, 4766, 4766, 4766, 4766, 4766, 4767, 4769, 4770, 4771, 4771, 4771, 4771, 4771,
+    4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771, 4771,
+    4771, 4771, 4771, 4771, 4771, 4773, 4784, 4795, 4795, 4795, 4795, 4795, 4795, 4795, 4795, 4795,
+    4795, 4795, 4795, 4795, 4795, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796,
+    4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796,
+    4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796, 4796,
+    4796, 4796, 4797, 4797, 4797, 4797, 4798, 4798, 4799, 4799, 4799, 4799, 4799, 4799, 4799, 4799,
+    4799, 4799, 4799, 4799, 4799, 4801, 4803, 4804, 4804, 4804, 4804, 4804, 4804, 4804, 4804, 4804,
+    4804, 4804, 4804, 4805, 4806, 4807, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808,
+    4808, 4808, 4809, 4810, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811,
+    4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4811, 4813, 4815, 4816, 4816,
+    4817, 4818, 4818, 4819, 4821, 4822, 4823, 4824, 4825, 4825, 4826, 4826, 4826, 4826, 4826, 4826,
+    4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826,
+    4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826,
+    4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826, 4826,
+    4826, 4826, 4827, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828,
+    4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828,
+    4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828,
+    4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828, 4828,
+    4828, 4828, 4828, 4828, 4828, 4828, 4829, 4831, 4832, 4833, 4833, 4834, 4835, 4835, 4836, 4836,
+    4837, 4837, 4837, 4837, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839,
+    4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839,
+    4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839, 4839,
+    4839, 4839, 4839, 4839, 4839, 4839, 4843, 4845, 4850, 4851, 4854, 4854, 4854, 4854, 4854, 4854,
+    4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855,
+    4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855, 4855,
+    4855, 4855, 4856, 4858, 4860, 4862, 4865, 4867, 4869, 4871, 4873, 4875, 4877, 4879, 4881, 4883,
+    4885, 4886, 4887, 4891, 4895, 4895, 4896, 4896, 4897, 4897, 4898, 4899, 4900, 4902, 4904, 4906,
+    4909, 4911, 4913, 4915, 4917, 4919, 4921, 4923, 4925, 4927, 4928, 4930, 4932, 4934, 4937, 4939,
+    4941, 4943, 4945, 4947, 4949, 4951, 4953, 4953, 4954, 4954, 4955, 4955, 4956, 4958, 4960, 4962,
+    4965, 4967, 4969, 4971, 4973, 4975, 4977, 4979, 4981, 4983, 4983, 4983, 4983, 4983, 4984, 4984,
+    4986, 4988, 4988, 4989, 4989, 4990, 4990, 4991, 4991, 4992, 4992, 4992, 4992, 4992, 4992, 4992,
+    4992, 4992, 4992, 4992, 4992, 4993, 4994, 4994, 4994, 4994, 4995, 4996, 4997, 4998, 4999, 5000,
+    5001, 5002, 5002, 5002, 5002, 5003, 5003, 5003, 5003, 5003, 5004, 5004, 5005, 5005, 5005, 5005,
+    5006, 5007, 5008, 5008, 5009, 5009, 5010, 5011, 5012, 5012, 5015, 5015, 5016, 5017, 5018, 5019,
+    5020, 5021, 5022, 5022, 5022, 5022, 5023, 5025, 5026, 5027, 5028, 5029, 5030, 5030, 5030, 5030,
+    5033, 5033, 5033, 5034, 5034, 5034, 5036, 5036, 5036, 5036, 5036, 5036, 5036, 5037, 5037, 5037,
+    5037, 5039, 5040, 5040, 5040, 5040, 5041, 5042, 5043, 5044, 5045, 5046, 5048, 5049, 5050, 5051,
+    5053, 5055, 5056, 5057, 5058, 5062, 5063, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5070,
+    5072, 5074, 5075, 5075, 5075, 5076, 5076, 5077, 5078, 5079, 5080, 5080, 5080, 5080, 5080, 5082,
+    5083, 5084, 5085, 5085, 5086, 5087, 5090, 5090, 5090, 5091, 5092, 5092, 5093, 5095, 5095, 5096,
+    5098, 5098, 5098, 5098, 5098, 5099, 5099, 5099, 5099, 5100, 5101, 5102, 5102, 5103, 5103, 5103,
+    5104, 5104, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5105, 5106,
+    5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106, 5106,
+    5106, 5106, 5106, 5106, 5106, 5106, 5106, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107,
+    5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5107, 5108, 5109,
+    5110, 5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 5120, 5121, 5122, 5123, 5124, 5124, 5125,
+    5126, 5127, 5128, 5129, 5130, 5133, 5134, 5135, 5135, 5135, 5135, 5135, 5136, 5139, 5140, 5141,
+    5142, 5143, 5143, 5144, 5145, 5146, 5148, 5149, 5151, 5151, 5151, 5152, 5152, 5153, 5154, 5155,
+    5156, 5157, 5158, 5159, 5159, 5160, 5161, 5161, 5161, 5161, 5161, 5161, 5162, 5163, 5165, 5165,
+    5165, 5166, 5166, 5167, 5168, 5168, 5170, 5171, 5174, 5175, 5175, 5175, 5176, 5178, 5179, 5181,
+    5182, 5183, 5184, 5185, 5188, 5189, 5189, 5190, 5191, 5192, 5192, 5192, 5192, 5192, 5194, 5198,
+    5204, 5206, 5206, 5211, 5215, 5216, 5219, 5220, 5220, 5220, 5228, 5228, 5228, 5228, 5228, 5228,
+    5231, 5232, 5232, 5232, 5233, 5235, 5236, 5236, 5240, 5242, 5243, 5244, 5245, 5247, 5247, 5247,
+    5249, 5251, 5251, 5251, 5251, 5252, 5253, 5253, 5253, 5254, 5255, 5256, 5256, 5256, 5256, 5256,
+    5257, 5258, 5259, 5259, 5260, 5261, 5262, 5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271,
+    5272, 5274, 5275, 5276, 5277, 5278, 5279, 5280, 5280, 5280, 5280, 5280, 5280, 5280, 5280, 5281,
+    5282, 5283, 5283, 5283, 5284, 5284, 5284, 5284, 5284, 5285, 5285, 5285, 5286, 5286, 5286, 5286,
+    5287, 5288, 5288, 5288, 5288, 5289, 5290, 5290, 5290, 5292, 5293, 5293, 5293, 5294, 5294, 5294,
+    5295, 5296, 5296, 5296, 5296, 5296, 5296, 5297, 5297, 5297, 5298, 5299, 5300, 5301, 5301, 5302,
+    5302, 5302, 5302, 5303, 5304, 5304, 5304, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312,
+    5312, 5313, 5313, 5313, 5313, 5313, 5313, 5313, 5313, 5314, 5314, 5314, 5314, 5314, 5314, 5314,
+    5314, 5314, 5314, 5314, 5314, 5315, 5316, 5317, 5317, 5317, 5317, 5317, 5317, 5317, 5317, 5317,
+    5317, 5317, 5317, 5318, 5320, 5321, 5322, 5322, 5322, 5323, 5325, 5326, 5329, 5330, 5331, 5332,
+    5333, 5334, 5335, 5335, 5335, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336,
+    5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5336, 5337, 5338, 5339, 5339,
+    5339, 5340, 5343, 5345, 5346, 5346, 5346, 5347, 5347, 5347, 5347, 5348, 5349, 5350, 5351, 5351,
+    5352, 5352, 5353, 5353, 5353, 5353, 5353, 5353, 5353, 5353, 5353, 5356, 5357, 5357, 5357, 5358,
+    5359, 5360, 5360, 5360, 5360, 5361, 5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5372,
+    5375, 5376, 5383, 5384, 5385, 5385, 5386, 5387, 5387, 5387, 5388, 5388, 5389, 5389, 5390, 5392,
+    5394, 5396, 5396, 5397, 5397, 5398, 5398, 5399, 5399, 5400, 5400, 5401, 5401, 5402, 5402, 5403,
+    5403, 5404, 5404, 5405, 5405, 5408, 5409, 5409, 5409, 5412, 5413, 5414, 5414, 5417, 5418, 5419,
+    5419, 5419, 5419, 5419, 5419, 5419, 5420, 5420, 5421, 5421, 5422, 5424, 5426, 5428, 5428, 5429,
+    5429, 5430, 5430, 5431, 5431, 5432, 5432, 5433, 5433, 5434, 5434, 5435, 5435, 5436, 5436, 5437,
+    5437, 5437, 5438, 5438, 5439, 5439, 5440, 5442, 5444, 5446, 5446, 5447, 5447, 5448, 5448, 5449,
+    5449, 5450, 5450, 5451, 5451, 5452, 5452, 5453, 5453, 5454, 5454, 5454, 5454, 5454, 5455, 5455,
+    5456, 5456, 5457, 5459, 5461, 5463, 5463, 5464, 5464, 5465, 5465, 5466, 5466, 5467, 5467, 5468,
+    5468, 5469, 5469, 5470, 5470, 5471, 5471, 5472, 5472, 5472, 5473, 5473, 5474, 5474, 5474, 5474,
+    5474, 5474, 5475, 5475, 5475, 5475, 5475, 5475, 5475, 5476, 5476, 5477, 5477, 5477, 5477, 5477,
+    5477, 5478, 5478, 5478, 5478, 5478, 5478, 5478, 5478, 5478, 5478, 5478, 5479, 5480, 5481, 5481,
+    5482, 5483, 5483, 5483, 5483, 5483, 5483, 5483, 5483, 5483, 5489, 5490, 5492, 5493, 5493, 5493,
+    5494, 5494, 5495, 5496, 5496, 5496, 5497, 5497, 5497, 5497, 5497, 5498, 5498, 5498, 5498, 5498,
+    5498, 5498, 5498, 5498, 5498, 5498, 5498, 5498, 5498, 5499, 5499, 5499, 5499, 5499, 5499, 5499,
+    5499, 5499, 5499, 5499, 5500, 5500, 5500, 5500, 5500, 5501, 5502, 5502, 5503, 5504, 5505, 5505,
+    5505, 5506, 5507, 5508, 5508, 5509, 5510, 5511, 5511, 5511, 5511, 5511, 5511, 5511, 5512, 5512,
+    5513, 5513, 5513, 5514, 5515, 5515, 5515, 5515, 5515, 5516, 5516, 5517, 5517, 5518, 5519, 5520,
+    5520, 5520, 5520, 5520, 5521, 5522, 5523, 5523, 5524, 5525, 5525, 5526, 5527, 5527, 5528, 5528,
+    5528, 5529, 5529, 5530, 5530, 5530, 5530, 5530, 5530, 5531, 5531, 5531, 5531, 5531, 5531, 5531,
+    5531, 5532, 5532, 5533, 5533, 5533, 5533, 5533, 5534, 5534, 5535, 5535, 5536, 5537, 5538, 5538,
+    5539, 5540, 5540, 5541, 5541, 5542, 5543, 5543, 5544, 5545, 5546, 5546, 5547, 5547, 5547, 5548,
+    5548, 5548, 5548, 5548, 5548, 5549, 5549, 5550, 5550, 5550, 5551, 5552, 5553, 5554, 5554, 5556,
+    5557, 5558, 5560, 5561, 5562, 5562, 5562, 5562, 5563, 5565, 5565, 5565, 5566, 5566, 5567, 5569,
+    5569, 5570, 5571, 5571, 5571, 5571, 5571, 5571, 5572, 5572, 5573, 5573, 5573, 5573, 5574, 5574,
+    5574, 5575, 5576, 5576, 5576, 5577, 5577, 5577, 5577, 5577, 5577, 5577, 5577, 5578, 5578, 5578,
+    5579, 5579, 5581, 5583, 5584, 5585, 5586, 5587, 5587, 5587, 5587, 5588, 5588, 5589, 5590, 5591,
+    5592, 5593, 5593, 5593, 5594, 5595, 5595, 5596, 5597, 5598, 5598, 5598, 5598, 5598, 5599, 5599,
+    5599, 5600, 5601, 5601, 5602, 5602, 5602, 5602, 5602, 5603, 5603, 5603, 5604, 5605, 5605, 5605,
+    5606, 5606, 5606, 5607, 5607, 5607, 5607, 5608, 5608, 5608, 5608, 5609, 5610, 5611, 5612, 5613,
+    5614, 5614, 5615, 5615, 5615, 5615, 5616, 5617, 5618, 5619, 5620, 5622, 5622, 5625, 5628, 5630,
+    5632, 5634, 5636, 5638, 5639, 5640, 5640, 5641, 5641, 5641, 5641, 5641, 5641, 5641, 5642, 5643,
+    5643, 5644, 5645, 5646, 5646, 5646, 5647, 5647, 5647, 5647, 5647, 5647, 5647, 5647, 5647, 5648,
+    5648, 5648, 5649, 5650, 5650, 5650, 5650, 5650, 5650, 5652, 5652, 5652, 5652, 5652, 5652, 5652,
+    5653, 5653, 5653, 5654, 5655, 5655, 5655, 5655, 5655, 5656, 5656, 5657, 5657, 5657, 5657, 5657,
+    5658, 5658, 5659, 5659, 5660, 5660, 5660, 5660, 5660, 5660, 5660, 5660, 5660, 5660, 5662, 5664,
+    5666, 5666, 5668, 5670, 5672, 5673, 5674, 5676, 5678, 5680, 5681, 5682, 5682, 5682, 5682, 5682,
+    5683, 5683, 5684, 5684, 5685, 5685, 5685, 5685, 5685, 5685, 5685, 5685, 5685, 5685, 5685, 5685,
+    5685, 5685, 5686, 5686, 5687, 5687, 5688, 5688, 5688, 5688, 5688, 5688, 5688, 5688, 5688, 5688,
+    5688, 5688, 5688, 5689, 5689, 5690, 5690, 5691, 5691, 5691, 5691, 5691, 5691, 5691, 5691, 5691,
+    5691, 5691, 5691, 5691, 5691, 5691, 5692, 5692, 5692, 5692, 5692, 5692, 5692, 5692, 5692, 5692,
+    5692, 5692, 5692, 5693, 5695, 5695, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697,
+    5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5697, 5698, 5698, 5698, 5698, 5698,
+    5698, 5699, 5700, 5701, 5701, 5701, 5701, 5702, 5702, 5702, 5702, 5702, 5702, 5702, 5702, 5702,
+    5702, 5702, 5703, 5704, 5704, 5704, 5704, 5705, 5705, 5705, 5705, 5705, 5706, 5706, 5706, 5706,
+    5706, 5706, 5706, 5706, 5707, 5708, 5708, 5708, 5709, 5710, 5710, 5712, 5714, 5715, 5715, 5715,
+    5716, 5716, 5716, 5716, 5716, 5716, 5716, 5716, 5716, 5717, 5717, 5717, 5717, 5717, 5717, 5717,
+    5717, 5718, 5720, 5721, 5721, 5721, 5721, 5721, 5721, 5722, 5722, 5722, 5722, 5722, 5722, 5722,
+    5722, 5722, 5722, 5723, 5723, 5723, 5723, 5724, 5724, 5726, 5727, 5727, 5727, 5727, 5727, 5727,
+    5728, 5729, 5730, 5730, 5731, 5731, 5734, 5736, 5738, 5740, 5742, 5744, 5746, 5746, 5747, 5747,
+    5748, 5748, 5749, 5749, 5752, 5752, 5755, 5755, 5755, 5756, 5757, 5757, 5757, 5757, 5757, 5757,
+    5758, 5760, 5760, 5761, 5762, 5762, 5762, 5763, 5763, 5763, 5763, 5763, 5763, 5763, 5764, 5764,
+    5765, 5765, 5766, 5766, 5767, 5767, 5768, 5768, 5769, 5769, 5770, 5770, 5771, 5771, 5772, 5772,
+    5773, 5773, 5774, 5774, 5774, 5774, 5774, 5774, 5774, 5774, 5774, 5774, 5775, 5775, 5775, 5775,
+    5775, 5775, 5775, 5775, 5775, 5775, 5775, 5775, 5775, 5776, 5776, 5776, 5776, 5776, 5776, 5777,
+    5778, 5778, 5779, 5779, 5779, 5779, 5780, 5780, 5781, 5781, 5781, 5782, 5782, 5782, 5783, 5784,
+    5784, 5784, 5784, 5784, 5786, 5788, 5790, 5790, 5791, 5791, 5792, 5792, 5793, 5793, 5794, 5794,
+    5795, 5795, 5796, 5796, 5796, 5796, 5798, 5800, 5802, 5804, 5806, 5808, 5808, 5809, 5809, 5809,
+    5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5810, 5816,
+    5816, 5816, 5816, 5816, 5816, 5816, 5817, 5818, 5818, 5818, 5819, 5819, 5820, 5820, 5821, 5821,
+    5821, 5821, 5821, 5821, 5821, 5821, 5822, 5822, 5823, 5823, 5824, 5824, 5825, 5825, 5826, 5826,
+    5827, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828, 5828,
+    5828, 5828, 5828, 5828, 5829, 5829,
+};
+
+static const uint16_t hyph_esNodeLevels[5829] = {
+    0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 1,
+    0, 4, 4, 4, 4, 0, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 10, 10, 10, 10, 10,
+    13, 0, 10, 10, 17, 10, 10, 10, 10, 17, 10, 10, 10, 10, 10, 10,
+    10, 7, 0, 10, 10, 10, 0, 10, 10, 20, 0, 10, 10, 17, 10, 10,
+    0, 10, 10, 17, 10, 10, 0, 10, 10, 10, 10, 10, 7, 10, 10, 10,
+    0, 10, 10, 13, 10, 10, 10, 10, 10, 10, 10, 17, 10, 10, 10, 10,
+    10, 10, 10, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 10, 10, 10, 10, 10, 13, 10, 10, 17, 10, 10, 0, 10, 10,
+    17, 10, 10, 10, 10, 10, 10, 10, 7, 0, 10, 10, 10, 0, 10, 10,
+    13, 0, 10, 10, 17, 10, 10, 0, 10, 10, 17, 10, 10, 0, 10, 10,
+    10, 10, 10, 7, 0, 10, 10, 10, 0, 10, 10, 13, 0, 10, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 10, 10, 10, 10, 10, 13, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 10, 10, 10,
+    10, 10, 13, 0, 10, 10, 17, 10, 10, 10, 10, 17, 10, 10, 10, 10,
+    10, 10, 10, 7, 10, 10, 10, 10, 10, 13, 0, 10, 10, 20, 10, 10,
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 0, 10, 10, 10,
+    0, 10, 10, 13, 0, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10,
+    0, 10, 10, 10, 10, 10, 7, 0, 10, 10, 10, 0, 10, 10, 13, 10,
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 10, 10, 10, 0, 10,
+    10, 13, 0, 10, 10, 17, 10, 10, 0, 10, 10, 17, 10, 10, 0, 10,
+    10, 10, 10, 10, 7, 10, 10, 10, 10, 10, 13, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 7, 0, 10, 10, 10,
+    0, 10, 10, 13, 10, 10, 10, 10, 10, 0, 10, 10, 17, 10, 10, 10,
+    10, 10, 10, 10, 7, 0, 10, 10, 10, 0, 10, 10, 13, 10, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 7, 0,
+    10, 10, 10, 0, 10, 10, 13, 0, 10, 10, 23, 10, 10, 0, 10, 10,
+    17, 23, 10, 10, 10, 23, 10, 23, 0, 0, 7, 10, 10, 10, 10, 10,
+    13, 0, 10, 10, 17, 10, 10, 10, 10, 17, 10, 10, 10, 10, 10, 10,
+    10, 7, 0, 10, 10, 10, 10, 10, 13, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 7, 10, 10, 10, 0, 10, 10, 13,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7,
+    10, 10, 10, 10, 10, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 7, 10, 10, 10, 10, 10, 13, 10, 10, 10, 10,
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+    7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0,
+    7, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32,
+    32, 0, 0, 0, 0, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 7,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 32, 32, 0, 0, 0, 32, 32, 32, 0, 0, 32,
+    32, 7, 10, 10, 10, 10, 10, 10, 10, 10, 4, 10, 10, 10, 10, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 7, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32,
+    7, 0, 0, 0, 32, 32, 32, 7, 37, 37, 37, 37, 37, 37, 0, 37,
+    37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 7,
+    32, 32, 0, 7, 32, 32, 32, 0, 0, 0, 32, 32, 32, 32, 32, 32,
+    7, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 32, 32, 0, 0, 0, 0, 0, 0, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 42, 0, 42, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 0, 0, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 7, 0, 0, 0, 7, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37,
+    37, 37, 37, 37, 7, 0, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 7, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 0, 7, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 32, 0, 32, 32, 32, 32, 32, 0, 46, 0, 0, 32,
+    32, 32, 0, 0, 0, 0, 0, 32, 32, 0, 0, 0, 0, 32, 7, 0,
+    32, 32, 32, 32, 32, 0, 0, 32, 32, 32, 0, 0, 0, 32, 32, 32,
+    10, 0, 32, 32, 32, 0, 32, 32, 27, 0, 27, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    0, 37, 37, 37, 37, 37, 7, 0, 0, 7, 37, 37, 37, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 7, 0, 7, 0, 0, 0, 0, 0, 32, 32, 32, 0, 0, 32, 32,
+    0, 32, 0, 32, 32, 32, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 49, 0,
+    0, 32, 32, 32, 0, 0, 32, 32, 32, 0, 0, 0, 32, 32, 32, 0,
+    0, 0, 0, 32, 32, 0, 0, 0, 32, 32, 32, 0, 0, 0, 32, 32,
+    0, 32, 0, 32, 32, 32, 7, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 7, 32,
+    32, 7, 0, 0, 0, 0, 0, 7, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 7, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 0, 32, 32, 32, 0, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 52, 52, 56, 52, 52, 0, 52,
+    52, 52, 52, 52, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 0, 59,
+    52, 52, 52, 52, 52, 52, 0, 0, 0, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 0, 0,
+    63, 63, 63, 63, 0, 63, 63, 63, 63, 63, 63, 0, 0, 0, 0, 0,
+    0, 52, 59, 52, 52, 52, 52, 52, 52, 52, 52, 0, 0, 0, 0, 0,
+    0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0,
+    0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+    0, 7, 68, 0, 0, 0, 0, 68, 0, 0, 0, 0, 72, 72, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 68, 0, 0, 0, 0, 68,
+    0, 0, 0, 0, 75, 0, 0, 0, 0, 79, 82, 82, 86, 82, 82, 82,
+    82, 82, 82, 82, 82, 0, 89, 89, 89, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 82, 82, 86, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0,
+    0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82, 86, 82, 82, 82,
+    82, 82, 82, 82, 82, 0, 0, 0, 0, 49, 0, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 96,
+    0, 96, 0, 0, 0, 0, 100, 68, 0, 0, 68, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 82, 82, 86, 82, 82, 82, 82, 82, 82, 82, 82, 0,
+    0, 0, 0, 56, 56, 56, 56, 56, 104, 56, 56, 56, 56, 56, 56, 0,
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82,
+    86, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 17, 96, 0, 0, 96, 0, 0, 0, 0,
+    89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 108, 89,
+    89, 0, 0, 0, 112, 112, 112, 112, 112, 112, 0, 0, 0, 0, 0, 49,
+    0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 0, 82,
+    82, 86, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 68, 0, 68, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 119, 119,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 0, 0,
+    52, 0, 0, 0, 86, 86, 82, 122, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 130, 130, 134, 130, 130, 130, 130, 130,
+    130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 0, 0, 0,
+    0, 0, 0, 0, 0, 75, 75, 75, 0, 75, 56, 56, 0, 0, 0, 0,
+    0, 0, 0, 59, 138, 138, 138, 138, 0, 138, 138, 138, 138, 138, 138, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 0, 0, 0, 134, 134, 143,
+    134, 134, 134, 134, 134, 134, 134, 134, 68, 0, 7, 0, 7, 0, 7, 0,
+    68, 0, 0, 68, 7, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134,
+    0, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 10, 0, 68,
+    56, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 143,
+    134, 134, 134, 134, 134, 134, 134, 134, 0, 68, 68, 0, 0, 0, 68, 68,
+    72, 0, 146, 0, 146, 0, 146, 0, 100, 0, 68, 68, 146, 146, 68, 68,
+    0, 68, 68, 0, 0, 0, 0, 68, 0, 68, 68, 7, 0, 0, 7, 134,
+    134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 112, 0, 0, 0, 119, 119,
+    119, 119, 119, 42, 0, 0, 0, 0, 0, 134, 134, 143, 134, 134, 134, 134,
+    134, 134, 134, 134, 108, 0, 0, 0, 0, 134, 134, 143, 134, 134, 134, 134,
+    134, 134, 134, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 154, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 7, 0,
+    7, 0, 68, 0, 7, 0, 0, 68, 134, 134, 143, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0,
+    0, 158, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 158, 0, 0, 0,
+    0, 0, 7, 0, 7, 0, 7, 0, 7, 0, 68, 7, 7, 0, 0, 68,
+    0, 0, 68, 0, 0, 68, 68, 0, 0, 0, 0, 68, 134, 134, 143, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 143, 134, 134, 134, 134, 134, 134,
+    134, 134, 0, 0, 0, 56, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+    56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 56, 56, 56, 56, 56, 0, 56, 56, 56, 56, 56, 20,
+    0, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 143, 134,
+    134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 143, 134, 134, 134, 134, 134,
+    134, 134, 134, 0, 0, 49, 0, 49, 49, 0, 0, 0, 0, 0, 134, 134,
+    143, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 143, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0,
+    0, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 143,
+    134, 134, 134, 134, 134, 134, 134, 134, 100, 0, 100, 0, 0, 0, 96, 0,
+    96, 162, 0, 68, 0, 0, 68, 0, 0, 68, 0, 56, 0, 0, 56, 134,
+    134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 49, 0, 0, 134, 134,
+    143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 143, 134, 0, 134,
+    134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 134, 134, 143, 134, 134, 134,
+    134, 134, 134, 134, 134, 0, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134,
+    134, 0, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 134, 134,
+    143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 134, 134, 143, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134,
+    134, 162, 0, 162, 0, 0, 166, 0, 0, 0, 0, 0, 134, 134, 143, 134,
+    134, 134, 134, 134, 134, 134, 134, 7, 0, 96, 96, 0, 0, 134, 134, 143,
+    134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0, 0, 0, 134,
+    134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 134, 143, 134, 134, 134,
+    134, 134, 134, 134, 134, 171, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134,
+    134, 0, 0, 0, 0, 72, 0, 72, 0, 72, 0, 0, 0, 0, 175, 0,
+    134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 7, 0, 0, 154,
+    154, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 0, 115,
+    0, 20, 134, 134, 143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 134, 134,
+    143, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 68, 0,
+    68, 68, 68, 7, 0, 7, 0, 146, 0, 0, 0, 68, 0, 0, 0, 0,
+    119, 0, 119, 119, 0, 119, 119, 0, 119, 0, 0, 75, 75, 0, 0, 0,
+    0, 0, 0, 122, 119, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178,
+    178, 185, 119, 119, 119, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 119, 0, 0, 119, 0, 0, 188, 0, 0, 0,
+    188, 0, 0, 0, 56, 0, 0, 0, 0, 188, 0, 188, 188, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 182, 0, 0, 0, 0, 178, 178, 182, 178, 178, 178,
+    178, 178, 178, 178, 178, 0, 0, 0, 0, 0, 191, 191, 191, 191, 0, 191,
+    191, 191, 191, 191, 191, 0, 56, 75, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 119, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 56, 0, 0,
+    0, 0, 56, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 56, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196,
+    196, 196, 196, 196, 196, 196, 196, 196, 196, 134, 68, 201, 0, 68, 7, 7,
+    7, 7, 68, 0, 0, 0, 146, 204, 178, 178, 182, 178, 178, 178, 178, 178,
+    178, 178, 178, 68, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 68,
+    0, 72, 146, 146, 146, 146, 68, 68, 0, 68, 68, 68, 0, 7, 112, 0,
+    0, 0, 7, 0, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178,
+    178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178,
+    178, 178, 178, 178, 178, 178, 0, 0, 178, 178, 182, 178, 178, 178, 178, 178,
+    178, 178, 178, 0, 151, 0, 0, 154, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 154, 119, 0, 0, 0, 0, 0, 0, 0, 154,
+    0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 154, 0, 0, 0, 0, 154, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 0, 154, 0, 154, 154,
+    154, 0, 0, 0, 115, 0, 0, 0, 0, 0, 151, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 0,
+    0, 0, 0, 0, 0, 154, 154, 154, 154, 0, 0, 0, 0, 0, 0, 115,
+    0, 151, 0, 151, 0, 7, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178,
+    178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 7, 7, 7,
+    7, 68, 7, 7, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 207,
+    0, 0, 0, 0, 207, 0, 207, 0, 0, 0, 207, 0, 0, 0, 207, 0,
+    0, 0, 0, 0, 207, 0, 0, 207, 0, 0, 0, 0, 207, 0, 0, 0,
+    0, 0, 0, 68, 0, 0, 0, 0, 7, 7, 7, 7, 0, 158, 0, 0,
+    0, 68, 0, 0, 68, 68, 0, 56, 56, 0, 0, 56, 56, 56, 56, 56,
+    56, 56, 56, 0, 0, 0, 56, 56, 56, 0, 56, 212, 178, 178, 182, 178,
+    178, 178, 178, 178, 178, 178, 178, 56, 56, 56, 56, 56, 56, 56, 56, 0,
+    0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 49, 0, 49, 0,
+    0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178,
+    178, 178, 178, 178, 178, 178, 178, 0, 178, 178, 182, 178, 178, 178, 178, 178,
+    178, 178, 178, 215, 215, 215, 215, 220, 215, 215, 215, 215, 215, 215, 178, 178,
+    182, 178, 178, 178, 178, 178, 178, 178, 178, 100, 100, 112, 178, 178, 182, 178,
+    178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178,
+    178, 178, 0, 68, 0, 68, 0, 0, 0, 178, 178, 182, 178, 178, 178, 178,
+    178, 178, 178, 178, 56, 56, 56, 0, 0, 0, 0, 178, 178, 182, 178, 178,
+    178, 178, 178, 178, 178, 178, 56, 112, 178, 178, 182, 178, 178, 178, 178, 178,
+    178, 178, 178, 224, 0, 0, 0, 227, 178, 178, 182, 178, 178, 178, 178, 178,
+    178, 178, 178, 230, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178,
+    178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178,
+    178, 233, 162, 162, 241, 0, 241, 0, 166, 178, 178, 182, 178, 178, 178, 178,
+    178, 178, 178, 178, 0, 0, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178,
+    178, 178, 0, 0, 0, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178,
+    178, 0, 0, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 245,
+    178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 0, 0, 0, 249, 0,
+    0, 56, 0, 0, 0, 0, 0, 0, 56, 0, 178, 178, 182, 178, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178,
+    178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178,
+    178, 0, 0, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+    182, 178, 178, 178, 178, 178, 178, 178, 178, 253, 253, 262, 253, 253, 253, 253,
+    253, 253, 253, 253, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+    178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178, 178,
+    178, 178, 178, 178, 178, 0, 0, 0, 0, 72, 0, 0, 104, 215, 215, 215,
+    215, 220, 215, 215, 215, 215, 215, 215, 178, 178, 182, 178, 178, 178, 178, 178,
+    178, 178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+    182, 178, 178, 178, 178, 178, 178, 178, 178, 7, 178, 178, 182, 178, 178, 178,
+    178, 178, 178, 178, 178, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 0,
+    178, 178, 182, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 178, 182, 178, 178, 178, 178, 178, 178, 178,
+    178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 7, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 7, 0, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 270, 68, 7, 7, 0, 146, 0,
+    0, 68, 0, 68, 0, 7, 0, 56, 0, 119, 119, 119, 119, 119, 119, 122,
+    122, 122, 122, 122, 0, 0, 224, 122, 119, 0, 0, 0, 0, 0, 0, 0,
+    0, 56, 119, 119, 0, 56, 56, 56, 56, 0, 56, 0, 46, 275, 275, 0,
+    0, 0, 119, 0, 279, 0, 0, 0, 119, 0, 282, 0, 0, 0, 0, 0,
+    0, 0, 119, 56, 56, 0, 0, 0, 0, 56, 0, 0, 119, 119, 119, 0,
+    119, 285, 285, 285, 285, 290, 285, 285, 285, 285, 285, 285, 0, 119, 119, 119,
+    0, 0, 294, 143, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119,
+    0, 0, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 56, 0,
+    0, 0, 56, 56, 0, 56, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0,
+    0, 0, 119, 0, 0, 0, 59, 220, 0, 0, 56, 0, 0, 275, 0, 0,
+    119, 119, 299, 299, 0, 299, 304, 304, 0, 0, 0, 308, 0, 68, 68, 0,
+    68, 0, 7, 313, 313, 282, 313, 313, 313, 313, 313, 313, 313, 313, 0, 317,
+    313, 313, 282, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 282, 313, 313,
+    313, 313, 313, 313, 313, 313, 0, 313, 313, 282, 313, 313, 313, 313, 313, 313,
+    313, 313, 313, 313, 282, 313, 313, 313, 313, 313, 313, 313, 313, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 154, 154, 154, 154, 0, 0, 0, 0, 0,
+    0, 154, 0, 0, 0, 0, 0, 0, 119, 154, 0, 154, 0, 0, 0, 0,
+    0, 0, 0, 154, 0, 0, 151, 154, 154, 154, 154, 0, 0, 0, 119, 154,
+    0, 154, 0, 0, 154, 0, 0, 0, 0, 154, 188, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 119, 0, 0, 0, 154, 119, 119, 119, 0, 0, 0,
+    0, 151, 0, 0, 0, 0, 0, 154, 154, 0, 154, 154, 154, 154, 154, 0,
+    0, 154, 154, 0, 0, 0, 154, 0, 0, 0, 0, 0, 0, 154, 154, 0,
+    0, 154, 154, 154, 0, 0, 115, 154, 0, 0, 0, 151, 151, 151, 151, 0,
+    0, 0, 154, 0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 151, 154, 151, 151, 151, 154, 154, 0, 0,
+    0, 115, 323, 0, 329, 329, 329, 151, 0, 154, 154, 0, 154, 151, 151, 0,
+    0, 207, 207, 334, 0, 0, 207, 207, 0, 0, 207, 207, 0, 207, 207, 0,
+    0, 207, 207, 207, 207, 207, 0, 207, 207, 0, 0, 0, 0, 207, 0, 207,
+    207, 158, 0, 0, 158, 340, 68, 0, 0, 0, 0, 0, 0, 0, 0, 68,
+    0, 56, 56, 56, 56, 56, 56, 56, 0, 313, 313, 282, 313, 313, 313, 313,
+    313, 313, 313, 313, 0, 0, 0, 313, 313, 282, 313, 313, 313, 313, 313, 313,
+    313, 313, 0, 0, 0, 0, 162, 68, 0, 0, 0, 0, 0, 0, 0, 346,
+    0, 0, 224, 7, 0, 313, 313, 282, 313, 313, 313, 313, 313, 313, 313, 313,
+    313, 313, 282, 313, 313, 313, 313, 313, 313, 313, 313, 0, 0, 0, 241, 68,
+    0, 0, 0, 0, 352, 79, 0, 230, 356, 360, 0, 0, 0, 0, 230, 0,
+    230, 0, 56, 56, 56, 56, 56, 119, 79, 56, 0, 0, 365, 365, 0, 0,
+    0, 72, 72, 370, 0, 370, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 375, 0, 0, 68, 270, 0, 7, 0, 7, 0, 0, 0,
+    0, 7, 0, 7, 0, 7, 0, 270, 0, 7, 0, 7, 0, 7, 0, 7,
+    0, 7, 0, 7, 0, 0, 7, 7, 0, 0, 0, 7, 0, 0, 0, 7,
+    7, 7, 68, 68, 146, 0, 100, 0, 100, 0, 0, 0, 0, 7, 0, 7,
+    0, 7, 0, 146, 0, 146, 0, 146, 0, 146, 0, 146, 0, 146, 0, 68,
+    270, 0, 7, 0, 7, 0, 0, 0, 0, 68, 0, 68, 0, 7, 0, 7,
+    0, 7, 0, 270, 0, 7, 0, 7, 0, 7, 7, 7, 270, 0, 7, 0,
+    7, 0, 0, 0, 0, 68, 0, 68, 0, 68, 0, 7, 0, 7, 0, 7,
+    0, 270, 0, 7, 0, 7, 0, 270, 7, 0, 7, 0, 68, 68, 7, 75,
+    290, 0, 86, 249, 379, 379, 249, 249, 0, 56, 0, 56, 56, 188, 188, 188,
+    0, 56, 119, 119, 119, 119, 119, 56, 56, 56, 56, 0, 0, 0, 56, 0,
+    0, 56, 56, 56, 56, 119, 119, 119, 119, 0, 0, 0, 0, 143, 143, 0,
+    384, 0, 0, 384, 384, 0, 119, 388, 388, 388, 0, 185, 388, 388, 388, 185,
+    220, 220, 388, 388, 388, 388, 388, 388, 0, 56, 56, 75, 56, 119, 119, 119,
+    119, 119, 119, 0, 56, 56, 119, 119, 0, 0, 119, 0, 0, 0, 119, 119,
+    0, 0, 0, 119, 0, 0, 0, 171, 119, 56, 304, 182, 182, 0, 68, 0,
+    68, 317, 0, 0, 154, 154, 154, 275, 0, 154, 0, 119, 0, 0, 0, 154,
+    154, 154, 154, 0, 0, 0, 154, 0, 0, 154, 0, 0, 154, 0, 154, 119,
+    0, 154, 0, 154, 154, 275, 154, 154, 0, 154, 154, 154, 154, 393, 393, 154,
+    0, 154, 0, 119, 119, 154, 154, 0, 154, 0, 154, 154, 0, 0, 154, 0,
+    0, 154, 0, 154, 0, 0, 154, 0, 0, 0, 154, 0, 154, 154, 0, 154,
+    154, 154, 154, 154, 0, 154, 0, 154, 154, 154, 0, 0, 0, 154, 0, 0,
+    0, 0, 0, 0, 154, 154, 154, 0, 0, 154, 154, 0, 154, 0, 0, 154,
+    0, 0, 154, 154, 154, 154, 154, 0, 154, 0, 154, 154, 154, 0, 154, 151,
+    0, 0, 154, 151, 0, 154, 154, 151, 154, 154, 154, 151, 0, 154, 154, 0,
+    154, 0, 0, 0, 0, 0, 0, 154, 151, 151, 0, 154, 0, 0, 0, 0,
+    0, 151, 151, 0, 0, 154, 0, 0, 0, 115, 154, 154, 151, 0, 154, 154,
+    0, 0, 151, 0, 154, 115, 241, 207, 0, 334, 207, 0, 0, 207, 207, 0,
+    207, 207, 0, 207, 207, 207, 0, 158, 68, 68, 0, 0, 0, 0, 0, 0,
+    68, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 340, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 398, 0, 7, 245, 405, 241, 68, 68, 0, 0, 68,
+    0, 0, 0, 413, 230, 0, 230, 245, 230, 417, 417, 417, 417, 365, 0, 365,
+    224, 0, 0, 375, 375, 375, 388, 119, 0, 388, 388, 388, 388, 388, 388, 0,
+    388, 388, 0, 388, 388, 388, 388, 375, 0, 119, 0, 270, 7, 7, 7, 0,
+    7, 0, 7, 0, 7, 7, 7, 270, 7, 7, 7, 7, 7, 0, 0, 0,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 146, 146, 146, 0,
+    146, 0, 146, 0, 7, 7, 7, 146, 146, 146, 146, 146, 146, 270, 7, 7,
+    7, 0, 7, 0, 7, 0, 68, 68, 7, 7, 7, 270, 7, 7, 270, 7,
+    7, 7, 0, 7, 0, 7, 0, 68, 68, 68, 7, 7, 7, 270, 7, 7,
+    7, 7, 423, 379, 56, 0, 56, 119, 56, 56, 56, 426, 426, 426, 426, 426,
+    426, 433, 0, 0, 119, 0, 439, 384, 185, 185, 119, 56, 56, 56, 119, 119,
+    119, 119, 119, 220, 119, 56, 56, 352, 49, 444, 0, 154, 154, 119, 154, 154,
+    0, 0, 0, 154, 154, 154, 0, 154, 154, 154, 154, 154, 154, 154, 119, 154,
+    154, 0, 0, 154, 154, 154, 0, 154, 154, 154, 119, 0, 154, 154, 154, 154,
+    154, 154, 154, 0, 0, 154, 154, 0, 0, 154, 0, 0, 0, 154, 154, 0,
+    154, 154, 154, 154, 151, 154, 151, 154, 0, 154, 151, 151, 154, 151, 154, 154,
+    0, 0, 0, 154, 154, 154, 154, 154, 0, 154, 154, 154, 154, 115, 154, 154,
+    154, 115, 0, 207, 207, 207, 0, 158, 0, 0, 207, 207, 207, 207, 447, 0,
+    0, 0, 450, 0, 340, 0, 0, 0, 0, 0, 0, 0, 340, 0, 340, 0,
+    340, 0, 340, 0, 340, 0, 455, 459, 0, 0, 68, 68, 96, 230, 230, 0,
+    0, 119, 0, 0, 119, 388, 0, 119, 119, 7, 7, 7, 7, 0, 7, 0,
+    7, 0, 7, 0, 7, 0, 7, 0, 7, 0, 7, 0, 7, 0, 7, 0,
+    7, 0, 146, 146, 146, 7, 7, 7, 7, 7, 7, 0, 433, 433, 433, 143,
+    143, 220, 154, 119, 154, 154, 154, 154, 0, 154, 154, 154, 154, 154, 0, 0,
+    154, 0, 154, 154, 154, 0, 151, 0, 154, 154, 0, 207, 68, 0, 0, 450,
+    450, 450, 450, 0, 0, 0, 340, 0, 340, 0, 340, 0, 340, 0, 340, 0,
+    340, 0, 340, 340, 340, 0, 0, 0, 0, 0, 0, 465, 0, 365, 450, 0,
+    388, 388, 388, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 154,
+    154, 154, 154, 151, 154, 0, 0, 68, 340, 0, 340, 0, 340, 0, 340, 340,
+    340, 340, 340, 340, 469, 0, 340, 0, 340, 0, 469, 0, 340, 0, 340, 0,
+    0, 450, 478, 478, 478, 478, 478, 478, 334, 68, 340, 340, 340, 469, 340, 340,
+    469, 340, 340, 0, 68,
+};
+
+static const uint8_t hyph_esLevels[488] = {
+    0, 0, 1, 1, 2, 1, 2, 0, 1, 4, 0, 1, 2, 0, 2, 2,
+    1, 1, 1, 2, 1, 1, 4, 0, 2, 2, 2, 1, 3, 1, 0, 2,
+    0, 3, 2, 3, 2, 0, 3, 2, 0, 2, 2, 2, 1, 2, 3, 1,
+    2, 0, 1, 3, 3, 2, 2, 2, 3, 1, 3, 3, 2, 3, 4, 2,
+    3, 2, 2, 2, 0, 2, 4, 3, 1, 1, 3, 3, 2, 3, 2, 4,
+    1, 2, 3, 2, 1, 2, 3, 1, 1, 0, 5, 4, 0, 0, 0, 4,
+    0, 2, 2, 3, 0, 2, 4, 4, 2, 2, 4, 3, 0, 2, 3, 2,
+    2, 1, 5, 2, 2, 3, 4, 4, 1, 3, 4, 1, 5, 3, 3, 2,
+    0, 2, 4, 2, 2, 2, 4, 2, 1, 2, 3, 3, 2, 2, 2, 4,
+    1, 1, 0, 3, 4, 4, 3, 2, 1, 3, 2, 2, 2, 3, 1, 2,
+    5, 4, 0, 2, 4, 2, 0, 3, 4, 2, 3, 3, 2, 4, 5, 3,
+    1, 6, 5, 2, 1, 2, 5, 1, 1, 5, 1, 3, 3, 1, 4, 4,
+    3, 2, 2, 2, 4, 3, 2, 0, 2, 6, 1, 2, 5, 1, 6, 1,
+    3, 5, 4, 3, 6, 1, 4, 4, 3, 2, 1, 2, 4, 2, 2, 3,
+    5, 1, 4, 0, 1, 5, 4, 1, 4, 0, 6, 4, 3, 0, 3, 0,
+    3, 1, 2, 4, 3, 4, 2, 4, 5, 4, 2, 4, 3, 0, 7, 2,
+    0, 0, 0, 0, 1, 2, 0, 6, 2, 0, 0, 0, 0, 1, 0, 3,
+    4, 0, 3, 3, 2, 4, 3, 7, 1, 2, 6, 1, 1, 5, 3, 2,
+    1, 2, 5, 2, 2, 3, 3, 3, 4, 3, 4, 3, 3, 2, 1, 2,
+    3, 2, 2, 1, 4, 3, 3, 2, 3, 6, 2, 1, 2, 1, 4, 4,
+    0, 0, 3, 2, 4, 2, 3, 0, 4, 2, 3, 3, 0, 3, 0, 4,
+    4, 3, 4, 3, 0, 4, 4, 3, 0, 3, 4, 4, 4, 4, 4, 4,
+    5, 2, 4, 3, 2, 2, 5, 4, 2, 3, 3, 4, 3, 1, 3, 3,
+    0, 3, 4, 3, 3, 4, 4, 4, 2, 2, 1, 4, 3, 4, 3, 4,
+    3, 2, 4, 1, 4, 3, 3, 0, 3, 2, 3, 2, 3, 4, 4, 5,
+    3, 4, 0, 0, 4, 0, 6, 4, 4, 0, 4, 5, 4, 6, 2, 5,
+    6, 2, 4, 3, 0, 0, 3, 6, 1, 3, 3, 5, 3, 0, 0, 2,
+    3, 3, 4, 3, 0, 3, 4, 3, 3, 4, 1, 4, 5, 1, 5, 7,
+    1, 3, 4, 3, 3, 4, 3, 4, 2, 3, 4, 5, 4, 5, 0, 0,
+    5, 4, 2, 5, 4, 0, 7, 4, 3, 0, 3, 0, 0, 3, 3, 8,
+    3, 4, 0, 3, 0, 0, 2, 3,
+};
+
+static const HyphenationPatterns hyph_es = {
+    "es",
+    hyph_esLetters,
+    64,
+    hyph_esNodeChars,
+    hyph_esNodeFirstChild,
+    hyph_esNodeLevels,
+    hyph_esLevels,
+    5829,
+    2,
+    2,
+};
@@ -0,0 +1,728 @@
+/**
+ * generated by hyphenconvert.py
+ * name: hyph_fr
+ * language: fr
+ * patterns: 1208
+ * nodes: 3181
+ */
+#pragma once
+#include "HyphenationPatterns.h"
+
+static const HyphenationLetter hyph_frLetters[76] = {
+    { 0x27, 1 }, // '
+    { 0x41, 2 }, // A
+    { 0x42, 3 }, // B
+    { 0x43, 4 }, // C
+    { 0x44, 5 }, // D
+    { 0x45, 6 }, // E
+    { 0x46, 7 }, // F
+    { 0x47, 8 }, // G
+    { 0x48, 9 }, // H
+    { 0x49, 10 }, // I
+    { 0x4A, 11 }, // J
+    { 0x4B, 12 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 14 }, // M
+    { 0x4E, 15 }, // N
+    { 0x4F, 16 }, // O
+    { 0x50, 17 }, // P
+    { 0x51, 18 }, // Q
+    { 0x52, 19 }, // R
+    { 0x53, 20 }, // S
+    { 0x54, 21 }, // T
+    { 0x55, 22 }, // U
+    { 0x56, 23 }, // V
+    { 0x57, 24 }, // W
+    { 0x58, 25 }, // X
+    { 0x59, 26 }, // Y
+    { 0x5A, 27 }, // Z
+    { 0x61, 2 }, // a
+    { 0x62, 3 }, // b
+    { 0x63, 4 }, // c
+    { 0x64, 5 }, // d
+    { 0x65, 6 }, // e
+    { 0x66, 7 }, // f
+    { 0x67, 8 }, // g
+    { 0x68, 9 }, // h
+    { 0x69, 10 }, // i
+    { 0x6A, 11 }, // j
+    { 0x6B, 12 }, // k
+    { 0x6C, 13 }, // l
+    { 0x6D, 14 }, // m
+    { 0x6E, 15 }, // n
+    { 0x6F, 16 }, // o
+    { 0x70, 17 }, // p
+    { 0x71, 18 }, // q
+    { 0x72, 19 }, // r
+    { 0x73, 20 }, // s
+    { 0x74, 21 }, // t
+    { 0x75, 22 }, // u
+    { 0x76, 23 }, // v
+    { 0x77, 24 }, // w
+    { 0x78, 25 }, // x
+    { 0x79, 26 }, // y
+    { 0x7A, 27 }, // z
+    { 0xC0, 28 }, // À
+    { 0xC2, 29 }, // Â
+    { 0xC7, 30 }, // Ç
+    { 0xC8, 31 }, // È
+    { 0xC9, 32 }, // É
+    { 0xCA, 33 }, // Ê
+    { 0xCE, 34 }, // Î
+    { 0xCF, 35 }, // Ï
+    { 0xD4, 36 }, // Ô
+    { 0xDB, 37 }, // Û
+    { 0xE0, 28 }, // à
+    { 0xE2, 29 }, // â
+    { 0xE7, 30 }, // ç
+    { 0xE8, 31 }, // è
+    { 0xE9, 32 }, // é
+    { 0xEA, 33 }, // ê
+    { 0xEE, 34 }, // î
+    { 0xEF, 35 }, // ï
+    { 0xF4, 36 }, // ô
+    { 0xFB, 37 }, // û
+    { 0x152, 38 }, // Œ
+    { 0x153, 38 }, // œ
+    { 0x2019, 1 }, // ’
+};
+
+static const uint8_t hyph_frNodeChars[3181] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 29, 30, 31,
+    32, 36, 39, 2, 3, 4, 5, 6, 8, 10, 12, 13, 14, 15, 16, 17,
+    19, 20, 21, 22, 26, 29, 31, 32, 33, 34, 36, 37, 2, 6, 10, 16,
+    22, 26, 29, 31, 32, 33, 34, 36, 37, 3, 4, 5, 8, 10, 13, 14,
+    15, 17, 19, 20, 22, 23, 31, 2, 6, 10, 13, 16, 19, 22, 26, 29,
+    31, 32, 33, 34, 36, 37, 2, 4, 6, 9, 10, 12, 13, 16, 19, 22,
+    26, 29, 31, 32, 33, 34, 36, 37, 38, 1, 2, 5, 6, 9, 10, 13,
+    16, 19, 20, 22, 26, 29, 31, 32, 33, 34, 36, 37, 39, 15, 19, 20,
+    22, 25, 2, 6, 10, 13, 16, 19, 20, 22, 26, 29, 31, 32, 33, 34,
+    36, 37, 2, 6, 9, 10, 13, 15, 16, 19, 20, 22, 26, 29, 31, 32,
+    33, 34, 36, 37, 2, 6, 10, 16, 22, 26, 29, 31, 32, 33, 34, 36,
+    37, 2, 3, 13, 14, 15, 16, 20, 23, 31, 2, 6, 12, 2, 6, 9,
+    10, 16, 19, 22, 26, 29, 31, 32, 33, 34, 36, 37, 2, 6, 10, 13,
+    14, 16, 20, 22, 26, 28, 29, 31, 32, 33, 34, 36, 37, 2, 6, 10,
+    15, 16, 20, 22, 26, 29, 31, 32, 33, 34, 36, 37, 38, 2, 6, 10,
+    16, 20, 22, 25, 26, 29, 31, 32, 33, 34, 36, 37, 38, 3, 4, 5,
+    8, 10, 14, 17, 19, 20, 25, 31, 2, 6, 9, 10, 13, 15, 16, 19,
+    20, 21, 22, 26, 29, 31, 32, 33, 34, 36, 37, 22, 2, 4, 6, 9,
+    10, 14, 16, 22, 26, 29, 31, 32, 33, 34, 36, 37, 2, 4, 6, 9,
+    10, 13, 16, 17, 21, 22, 26, 29, 31, 32, 33, 34, 36, 37, 38, 2,
+    4, 6, 9, 10, 16, 19, 21, 22, 26, 28, 29, 31, 32, 33, 34, 36,
+    37, 4, 6, 15, 20, 23, 2, 6, 10, 16, 19, 22, 26, 29, 31, 32,
+    33, 34, 36, 37, 2, 6, 10, 16, 19, 22, 6, 10, 2, 20, 2, 6,
+    10, 16, 22, 26, 31, 32, 14, 14, 4, 5, 13, 14, 15, 17, 18, 19,
+    14, 2, 6, 10, 16, 22, 26, 29, 31, 32, 33, 34, 36, 37, 3, 6,
+    8, 14, 15, 17, 19, 20, 2, 10, 9, 10, 16, 22, 2, 10, 16, 26,
+    32, 15, 22, 6, 8, 15, 9, 2, 2, 10, 16, 32, 16, 15, 22, 23,
+    2, 6, 9, 13, 16, 19, 20, 22, 32, 6, 32, 2, 4, 6, 9, 16,
+    21, 22, 26, 2, 9, 19, 14, 3, 6, 8, 14, 15, 17, 19, 20, 15,
+    22, 8, 15, 15, 22, 23, 9, 20, 34, 4, 18, 9, 15, 14, 2, 4,
+    2, 6, 10, 21, 16, 17, 4, 14, 14, 21, 14, 10, 5, 0, 15, 20,
+    6, 22, 6, 22, 16, 17, 19, 10, 0, 15, 20, 0, 3, 6, 8, 10,
+    13, 14, 15, 17, 19, 20, 21, 24, 13, 0, 3, 6, 7, 8, 9, 17,
+    20, 21, 2, 6, 2, 6, 8, 14, 15, 19, 32, 6, 19, 19, 14, 9,
+    0, 15, 20, 2, 16, 2, 13, 20, 6, 6, 4, 21, 10, 21, 14, 4,
+    21, 20, 21, 14, 0, 15, 20, 4, 19, 2, 6, 6, 10, 14, 4, 0,
+    15, 20, 2, 6, 10, 16, 26, 13, 6, 6, 2, 6, 6, 0, 20, 13,
+    14, 17, 14, 13, 19, 19, 13, 14, 17, 4, 5, 7, 15, 20, 21, 2,
+    25, 4, 21, 2, 5, 4, 0, 15, 20, 0, 15, 20, 0, 24, 0, 15,
+    20, 13, 10, 22, 6, 21, 0, 20, 13, 14, 21, 31, 32, 15, 26, 15,
+    4, 0, 15, 20, 2, 21, 13, 21, 13, 15, 16, 3, 14, 15, 22, 14,
+    21, 26, 5, 13, 17, 0, 15, 19, 20, 0, 6, 13, 15, 16, 19, 20,
+    21, 19, 6, 22, 6, 32, 2, 13, 6, 10, 16, 22, 32, 26, 31, 32,
+    8, 17, 20, 15, 19, 2, 6, 5, 10, 14, 10, 0, 13, 15, 17, 20,
+    6, 26, 14, 15, 10, 13, 21, 8, 14, 20, 21, 2, 9, 13, 16, 0,
+    14, 15, 19, 20, 0, 6, 14, 16, 19, 20, 2, 16, 2, 6, 9, 10,
+    16, 2, 6, 10, 16, 19, 26, 32, 3, 4, 14, 17, 19, 4, 14, 15,
+    9, 0, 14, 15, 19, 20, 0, 6, 13, 14, 15, 19, 20, 14, 19, 2,
+    6, 10, 22, 13, 14, 15, 19, 13, 10, 23, 10, 21, 10, 4, 15, 0,
+    15, 20, 5, 13, 13, 6, 13, 8, 0, 15, 20, 15, 13, 13, 20, 21,
+    0, 15, 20, 6, 6, 6, 10, 22, 6, 9, 19, 6, 10, 16, 32, 10,
+    6, 10, 10, 22, 6, 6, 3, 6, 8, 14, 15, 17, 19, 20, 15, 22,
+    8, 15, 15, 22, 23, 19, 20, 15, 10, 2, 21, 16, 5, 8, 17, 21,
+    10, 2, 16, 20, 22, 31, 20, 14, 15, 16, 13, 4, 2, 6, 20, 13,
+    20, 2, 10, 16, 20, 2, 16, 19, 14, 15, 2, 6, 10, 16, 20, 21,
+    22, 32, 21, 4, 8, 13, 19, 13, 15, 8, 20, 21, 15, 8, 2, 10,
+    15, 19, 21, 15, 19, 2, 22, 15, 20, 16, 32, 26, 5, 19, 20, 2,
+    6, 10, 16, 21, 22, 31, 32, 19, 9, 19, 22, 22, 2, 10, 3, 19,
+    15, 13, 10, 10, 19, 20, 15, 10, 2, 21, 16, 8, 17, 21, 2, 16,
+    19, 15, 2, 6, 10, 16, 20, 21, 22, 32, 8, 2, 10, 6, 21, 14,
+    6, 22, 16, 6, 13, 16, 13, 20, 14, 10, 20, 2, 9, 6, 10, 6,
+    19, 6, 13, 19, 21, 0, 0, 15, 20, 14, 21, 0, 15, 20, 14, 22,
+    10, 33, 5, 21, 0, 0, 15, 20, 23, 6, 6, 16, 6, 16, 13, 0,
+    15, 20, 14, 0, 15, 20, 4, 5, 17, 19, 20, 22, 25, 7, 15, 25,
+    15, 17, 7, 15, 21, 22, 17, 0, 15, 20, 19, 10, 6, 21, 0, 13,
+    22, 17, 10, 4, 20, 21, 15, 0, 15, 20, 2, 19, 23, 19, 6, 6,
+    9, 16, 10, 21, 19, 6, 21, 0, 9, 14, 14, 0, 15, 20, 0, 15,
+    20, 21, 6, 22, 21, 0, 13, 0, 15, 20, 0, 15, 20, 14, 15, 0,
+    15, 20, 0, 15, 20, 0, 13, 6, 6, 16, 10, 16, 8, 21, 10, 2,
+    10, 16, 22, 10, 10, 16, 22, 16, 16, 16, 21, 6, 10, 4, 26, 6,
+    9, 2, 13, 19, 6, 21, 0, 21, 0, 19, 21, 0, 13, 16, 14, 15,
+    0, 13, 6, 21, 20, 14, 20, 16, 21, 6, 10, 16, 21, 0, 21, 19,
+    16, 6, 16, 15, 22, 6, 10, 13, 6, 2, 10, 16, 19, 32, 2, 19,
+    32, 10, 21, 9, 14, 21, 0, 0, 15, 20, 6, 21, 6, 2, 10, 10,
+    0, 15, 20, 14, 22, 20, 26, 0, 15, 20, 23, 20, 32, 5, 20, 32,
+    4, 19, 19, 15, 10, 10, 22, 32, 14, 0, 15, 20, 10, 14, 6, 13,
+    6, 10, 21, 6, 0, 0, 20, 22, 5, 6, 8, 13, 6, 9, 6, 2,
+    22, 10, 17, 0, 6, 20, 32, 17, 10, 21, 8, 17, 0, 18, 0, 15,
+    20, 14, 13, 23, 23, 21, 19, 31, 32, 6, 19, 19, 15, 10, 8, 4,
+    14, 16, 22, 13, 19, 13, 20, 4, 6, 6, 2, 32, 9, 6, 8, 10,
+    17, 21, 8, 0, 21, 0, 19, 20, 22, 6, 10, 6, 19, 15, 0, 15,
+    20, 5, 4, 6, 8, 3, 32, 13, 10, 2, 16, 19, 13, 10, 10, 10,
+    21, 0, 10, 13, 21, 0, 15, 20, 16, 15, 21, 0, 21, 13, 8, 21,
+    16, 21, 0, 15, 15, 15, 14, 14, 15, 10, 10, 4, 14, 18, 14, 13,
+    19, 21, 20, 6, 10, 15, 15, 19, 20, 15, 10, 2, 21, 16, 8, 17,
+    21, 2, 16, 19, 15, 2, 6, 10, 16, 20, 21, 22, 32, 8, 2, 10,
+    32, 4, 2, 15, 20, 10, 20, 6, 6, 6, 2, 20, 4, 21, 22, 2,
+    2, 23, 2, 14, 20, 21, 13, 19, 4, 13, 14, 21, 15, 9, 6, 2,
+    10, 16, 22, 16, 2, 4, 6, 10, 16, 17, 21, 22, 32, 38, 2, 14,
+    10, 32, 15, 22, 7, 17, 19, 25, 14, 18, 21, 4, 15, 21, 6, 10,
+    13, 13, 15, 6, 12, 19, 15, 2, 6, 10, 16, 25, 13, 16, 16, 2,
+    6, 10, 22, 2, 16, 22, 16, 20, 2, 10, 16, 2, 6, 9, 6, 21,
+    2, 6, 10, 16, 22, 32, 13, 19, 21, 21, 8, 20, 22, 32, 2, 6,
+    10, 16, 20, 22, 32, 4, 5, 10, 4, 17, 18, 20, 21, 13, 22, 13,
+    19, 7, 19, 20, 19, 14, 14, 13, 23, 8, 13, 2, 10, 13, 22, 32,
+    2, 6, 9, 10, 16, 32, 8, 6, 2, 16, 15, 32, 4, 2, 15, 20,
+    10, 20, 6, 6, 2, 2, 10, 32, 15, 22, 7, 17, 19, 25, 14, 18,
+    21, 4, 15, 21, 6, 10, 13, 13, 15, 22, 16, 20, 15, 10, 6, 15,
+    10, 20, 15, 8, 16, 8, 21, 6, 7, 21, 19, 10, 15, 13, 15, 16,
+    15, 13, 6, 0, 21, 0, 6, 10, 21, 0, 6, 21, 13, 14, 6, 0,
+    21, 0, 10, 15, 0, 20, 19, 0, 20, 14, 21, 0, 6, 21, 0, 4,
+    18, 20, 10, 32, 10, 10, 10, 19, 22, 21, 0, 6, 13, 15, 0, 5,
+    9, 8, 16, 10, 10, 21, 21, 0, 5, 10, 19, 6, 15, 15, 17, 14,
+    2, 2, 15, 0, 22, 6, 14, 21, 0, 21, 0, 10, 15, 13, 0, 21,
+    0, 21, 0, 14, 5, 21, 0, 21, 0, 15, 19, 2, 6, 10, 16, 20,
+    22, 32, 32, 17, 10, 9, 13, 15, 15, 20, 21, 5, 5, 8, 13, 13,
+    19, 4, 13, 10, 13, 14, 21, 15, 10, 32, 21, 6, 6, 15, 0, 0,
+    6, 0, 15, 6, 21, 6, 15, 6, 16, 10, 23, 19, 15, 7, 15, 0,
+    0, 20, 10, 15, 21, 14, 20, 10, 5, 15, 17, 20, 6, 15, 20, 21,
+    14, 14, 2, 10, 19, 6, 16, 13, 0, 2, 10, 21, 0, 0, 20, 16,
+    0, 20, 13, 20, 13, 21, 0, 6, 21, 2, 6, 10, 16, 20, 22, 23,
+    31, 32, 21, 0, 2, 21, 14, 6, 6, 14, 9, 2, 13, 13, 13, 18,
+    6, 21, 0, 16, 6, 15, 13, 15, 14, 0, 15, 0, 19, 19, 15, 6,
+    13, 15, 14, 15, 15, 19, 4, 9, 0, 20, 19, 13, 0, 6, 6, 22,
+    21, 0, 16, 10, 14, 19, 19, 13, 16, 22, 5, 15, 14, 12, 16, 17,
+    4, 6, 32, 10, 22, 15, 19, 9, 14, 26, 15, 6, 15, 32, 0, 6,
+    2, 14, 0, 19, 0, 20, 13, 15, 6, 20, 21, 0, 6, 22, 15, 20,
+    22, 6, 10, 16, 20, 13, 13, 25, 23, 13, 13, 13, 14, 0, 19, 14,
+    2, 21, 0, 20, 0, 0, 10, 9, 14, 0, 21, 21, 21, 6, 6, 21,
+    6, 18, 21, 6, 22, 6, 13, 8, 6, 4, 15, 17, 23, 21, 21, 32,
+    4, 2, 15, 20, 10, 20, 6, 6, 2, 2, 10, 32, 15, 22, 7, 17,
+    19, 25, 14, 18, 21, 4, 15, 21, 6, 10, 13, 13, 15, 22, 16, 20,
+    2, 9, 21, 16, 21, 2, 6, 20, 32, 21, 15, 15, 15, 6, 19, 13,
+    6, 19, 10, 26, 10, 32, 5, 10, 16, 15, 4, 14, 20, 21, 15, 19,
+    25, 5, 8, 13, 15, 19, 20, 5, 13, 17, 19, 22, 15, 8, 6, 10,
+    8, 7, 21, 16, 10, 22, 5, 2, 19, 21, 22, 2, 15, 16, 10, 22,
+    5, 10, 17, 23, 15, 15, 4, 5, 10, 2, 6, 10, 16, 20, 22, 32,
+    35, 9, 15, 20, 20, 20, 3, 6, 22, 4, 7, 14, 19, 20, 17, 4,
+    20, 15, 32, 15, 2, 2, 10, 6, 9, 10, 16, 19, 20, 15, 4, 5,
+    13, 22, 9, 13, 16, 20, 22, 2, 10, 16, 19, 6, 10, 13, 16, 22,
+    6, 2, 10, 16, 19, 22, 26, 32, 6, 10, 25, 10, 16, 20, 6, 6,
+    6, 6, 15, 13, 13, 15, 10, 22, 19, 19, 21, 2, 13, 21, 14, 15,
+    7, 25, 15, 15, 4, 15, 21, 15, 6, 2, 9, 21, 16, 21, 2, 6,
+    20, 32, 21, 15, 15, 10, 8, 7, 21, 16, 10, 22, 5, 2, 19, 21,
+    22, 2, 6, 22, 4, 21, 15, 15, 21, 6, 21, 10, 13, 2, 9, 15,
+    6, 19, 6, 32, 21, 13, 21, 21, 0, 15, 13, 0, 15, 13, 6, 15,
+    0, 13, 5, 0, 2, 32, 0, 6, 0, 15, 0, 16, 22, 21, 21, 5,
+    23, 15, 3, 13, 0, 15, 13, 21, 19, 6, 17, 5, 13, 0, 0, 6,
+    14, 8, 21, 21, 6, 21, 4, 10, 21, 14, 15, 6, 0, 0, 13, 21,
+    6, 0, 0, 6, 10, 0, 0, 21, 2, 6, 10, 16, 20, 22, 32, 21,
+    19, 13, 6, 6, 4, 6, 6, 6, 6, 6, 8, 14, 6, 6, 13, 13,
+    6, 21, 2, 16, 15, 21, 15, 0, 21, 21, 15, 2, 32, 29, 10, 21,
+    0, 14, 8, 16, 10, 20, 21, 16, 15, 21, 5, 21, 4, 16, 32, 13,
+    15, 15, 0, 0, 20, 0, 32, 13, 0, 15, 19, 2, 0, 21, 2, 10,
+    15, 15, 10, 3, 4, 13, 13, 15, 0, 2, 15, 21, 21, 6, 21, 21,
+    15, 21, 6, 21, 6, 8, 6, 0, 13, 15, 15, 10, 0, 14, 2, 20,
+    13, 2, 20, 9, 21, 16, 14, 13, 21, 16, 20, 10, 2, 21, 15, 21,
+    19, 15, 14, 16, 0, 13, 21, 15, 2, 9, 16, 17, 22, 0, 15, 13,
+    21, 13, 3, 17, 13, 13, 13, 6, 10, 6, 14, 0, 12, 0, 0, 0,
+    15, 15, 0, 22, 19, 15, 6, 15, 15, 16, 21, 16, 2, 0, 0, 2,
+    9, 21, 16, 21, 2, 6, 20, 32, 21, 15, 15, 10, 8, 7, 21, 16,
+    10, 22, 5, 2, 19, 21, 22, 2, 6, 22, 4, 2, 19, 15, 2, 21,
+    21, 21, 14, 6, 17, 15, 6, 6, 16, 5, 14, 21, 19, 21, 6, 20,
+    21, 22, 15, 10, 6, 23, 21, 32, 10, 14, 17, 7, 19, 15, 21, 22,
+    2, 19, 21, 13, 3, 2, 6, 10, 16, 20, 22, 32, 4, 19, 21, 20,
+    4, 7, 14, 19, 20, 21, 2, 5, 21, 20, 15, 32, 2, 9, 21, 9,
+    21, 21, 15, 2, 21, 15, 2, 32, 9, 2, 16, 20, 20, 21, 17, 20,
+    22, 10, 4, 19, 6, 15, 10, 15, 3, 8, 15, 21, 14, 17, 4, 17,
+    6, 10, 15, 19, 20, 21, 2, 15, 15, 15, 21, 14, 15, 22, 13, 7,
+    21, 2, 21, 15, 2, 19, 15, 2, 21, 21, 21, 22, 2, 19, 21, 13,
+    3, 2, 6, 10, 16, 20, 22, 32, 4, 19, 15, 0, 6, 21, 0, 20,
+    0, 14, 32, 21, 19, 15, 17, 0, 0, 0, 21, 13, 21, 15, 21, 13,
+    6, 4, 21, 15, 21, 4, 19, 10, 6, 6, 6, 6, 8, 6, 21, 0,
+    2, 15, 6, 13, 15, 6, 6, 0, 0, 15, 0, 6, 21, 15, 13, 0,
+    15, 15, 13, 0, 15, 15, 6, 15, 15, 15, 15, 15, 6, 2, 15, 15,
+    13, 10, 15, 0, 21, 0, 21, 0, 21, 13, 2, 8, 4, 6, 6, 15,
+    0, 21, 21, 0, 22, 21, 2, 6, 10, 16, 6, 6, 21, 6, 13, 5,
+    21, 15, 21, 21, 15, 13, 21, 21, 0, 0, 15, 0, 0, 21, 0, 15,
+    0, 15, 6, 15, 21, 21, 2, 6, 6, 19, 22, 20, 6, 6, 0, 15,
+    0, 21, 2, 21, 6, 20, 0, 21, 4, 21, 2, 21, 6, 0, 6, 10,
+    15, 17, 15, 17, 10, 21, 21, 6, 21, 15, 21, 21, 17, 0, 21, 13,
+    2, 19, 15, 2, 21, 21, 21, 22, 2, 19, 21, 13, 3, 2, 6, 10,
+    16, 20, 22, 32, 4, 19, 15, 4, 15, 0, 0, 0, 2, 7, 21, 14,
+    20, 2, 0, 19, 13, 10, 15, 16, 13, 19, 21, 19, 3, 2, 10, 21,
+    19, 0, 4, 10, 10, 6, 16, 32, 14, 32, 2, 21, 6, 31, 0, 0,
+    20, 21, 2, 2, 10, 16, 21, 15, 20, 13, 21, 5, 10, 4, 15, 21,
+    21, 21, 10, 21, 0, 21, 4, 15, 0, 0, 19, 3, 2, 10, 21, 19,
+    21, 15, 0, 4, 6, 20, 0, 14, 21, 10, 0, 0, 21, 0, 15, 21,
+    0, 15, 15, 15, 15, 6, 15, 0, 8, 21, 15, 21, 15, 15, 21, 15,
+    0, 21, 21, 21, 16, 21, 21, 15, 21, 21, 21, 21, 21, 15, 21, 21,
+    21, 8, 21, 0, 0, 0, 6, 13, 6, 15, 15, 10, 6, 0, 10, 14,
+    15, 15, 0, 6, 16, 6, 0, 0, 6, 6, 0, 0, 21, 0, 21, 21,
+    15, 21, 0, 0, 15, 15, 5, 15, 15, 6, 0, 14, 0, 15, 0, 21,
+    20, 19, 0, 15, 15, 15, 20, 21, 16, 21, 0, 0, 0, 21, 0, 6,
+    6, 6, 4, 15, 0, 0, 19, 3, 2, 10, 21, 19, 21, 6, 10, 6,
+    0, 2, 4, 13, 3, 0, 2, 2, 5, 4, 20, 0, 21, 9, 15, 5,
+    0, 15, 21, 0, 0, 0, 15, 9, 0, 6, 2, 2, 0, 21, 6, 15,
+    10, 6, 0, 20, 0, 21, 0, 21, 21, 21, 21, 15, 21, 14, 0, 21,
+    0, 21, 21, 0, 21, 0, 0, 0, 18, 0, 0, 21, 0, 0, 0, 0,
+    0, 21, 0, 0, 6, 0, 15, 15, 21, 21, 15, 16, 21, 21, 15, 4,
+    27, 15, 15, 0, 0, 0, 21, 0, 21, 21, 21, 21, 15, 6, 21, 6,
+    21, 21, 0, 21, 0, 0, 15, 15, 6, 2, 2, 0, 15, 22, 34, 6,
+    2, 0, 15, 21, 15, 0, 0, 0, 0, 0, 21, 0, 6, 0, 0, 0,
+    0, 22, 0, 0, 15, 21, 21, 0, 0, 21, 15, 0, 0, 21, 6, 6,
+    21, 21, 0, 0, 0, 0, 0, 21, 15, 0, 15, 0, 0, 6, 21, 21,
+    10, 21, 21, 21, 0, 21, 0, 15, 6, 21, 0, 0, 0, 0, 15, 15,
+    0, 0, 0, 21, 21, 15, 0, 0, 13, 19, 0, 0, 21, 15, 0, 21,
+    21, 0, 0, 21, 13, 6, 0, 21, 0, 0, 0, 6, 0,
+};
+
+static const uint16_t hyph_frNodeFirstChild[3182] = {
+    1, 35, 60, 73, 87, 102, 121, 141, 146, 162, 180, 193, 202, 205, 220, 237,
+    253, 269, 280, 299, 300, 316, 335, 353, 358, 372, 378, 380, 382, 390, 391, 391,
+    392, 400, 401, 414, 422, 424, 428, 433, 435, 436, 438, 439, 440, 444, 445, 448,
+    457, 459, 467, 470, 470, 470, 470, 470, 471, 471, 471, 471, 471, 479, 481, 483,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 489, 491, 492, 493, 494, 496,
+    497, 500, 502, 504, 506, 507, 508, 509, 509, 512, 512, 513, 514, 516, 516, 516,
+    516, 516, 516, 516, 516, 516, 516, 519, 520, 523, 536, 537, 546, 548, 555, 556,
+    557, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 559, 560, 563, 565, 568,
+    569, 569, 570, 570, 570, 570, 570, 570, 572, 572, 572, 572, 572, 572, 574, 575,
+    577, 578, 579, 580, 583, 585, 587, 587, 589, 589, 590, 590, 590, 590, 591, 591,
+    591, 591, 591, 591, 594, 599, 600, 601, 602, 602, 604, 604, 605, 605, 605, 605,
+    605, 605, 605, 605, 605, 605, 607, 608, 608, 609, 610, 610, 610, 611, 611, 611,
+    611, 611, 613, 614, 615, 617, 623, 625, 627, 628, 629, 630, 633, 633, 633, 636,
+    637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 638, 641, 642,
+    644, 645, 645, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 648,
+    651, 653, 655, 655, 656, 656, 656, 656, 657, 657, 657, 657, 657, 657, 657, 660,
+    660, 660, 661, 662, 662, 662, 662, 662, 662, 662, 662, 662, 662, 662, 663, 664,
+    665, 666, 667, 670, 671, 672, 673, 674, 675, 677, 681, 689, 690, 692, 694, 696,
+    701, 702, 704, 707, 707, 707, 707, 709, 709, 709, 709, 709, 711, 714, 715, 720,
+    722, 724, 725, 725, 726, 727, 727, 727, 731, 731, 731, 731, 731, 731, 735, 740,
+    746, 746, 748, 748, 753, 760, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765,
+    768, 769, 774, 781, 781, 783, 787, 788, 791, 791, 791, 791, 791, 792, 792, 792,
+    792, 792, 793, 794, 795, 796, 797, 799, 802, 804, 805, 806, 806, 806, 806, 806,
+    807, 807, 807, 807, 807, 808, 811, 811, 811, 811, 811, 812, 813, 815, 816, 816,
+    819, 819, 819, 819, 819, 819, 819, 820, 821, 824, 827, 831, 832, 834, 835, 836,
+    837, 838, 846, 848, 850, 853, 853, 853, 853, 853, 853, 853, 853, 853, 853, 854,
+    855, 856, 857, 859, 860, 863, 864, 865, 869, 870, 871, 874, 875, 876, 879, 880,
+    881, 885, 887, 888, 889, 890, 898, 898, 899, 903, 904, 905, 908, 909, 910, 911,
+    912, 915, 917, 918, 919, 921, 923, 924, 925, 926, 927, 935, 936, 937, 939, 939,
+    940, 942, 944, 945, 946, 946, 947, 948, 949, 950, 951, 952, 954, 955, 957, 958,
+    960, 961, 962, 970, 971, 972, 973, 973, 975, 976, 977, 978, 978, 979, 980, 981,
+    982, 983, 984, 985, 986, 987, 988, 989, 991, 992, 993, 994, 995, 996, 996, 997,
+    998, 1001, 1003, 1006, 1007, 1008, 1009, 1010, 1011, 1011, 1012, 1013, 1013, 1013, 1017, 1017,
+    1018, 1020, 1020, 1020, 1020, 1022, 1022, 1022, 1022, 1023, 1023, 1023, 1026, 1026, 1026, 1026,
+    1026, 1026, 1026, 1027, 1030, 1037, 1040, 1041, 1042, 1046, 1047, 1047, 1050, 1051, 1052, 1053,
+    1053, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1062, 1063, 1066, 1067, 1068, 1069, 1070, 1071,
+    1074, 1075, 1076, 1077, 1078, 1078, 1079, 1080, 1081, 1082, 1083, 1086, 1089, 1090, 1091, 1092,
+    1092, 1093, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1098, 1101, 1103, 1106, 1109, 1109, 1110,
+    1111, 1112, 1114, 1116, 1117, 1118, 1119, 1119, 1121, 1123, 1124, 1127, 1128, 1129, 1131, 1133,
+    1134, 1135, 1137, 1138, 1139, 1140, 1141, 1141, 1142, 1143, 1143, 1144, 1145, 1145, 1146, 1146,
+    1147, 1148, 1149, 1150, 1151, 1152, 1152, 1152, 1153, 1154, 1155, 1156, 1157, 1159, 1161, 1162,
+    1163, 1164, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+    1177, 1182, 1183, 1184, 1185, 1186, 1186, 1187, 1190, 1191, 1191, 1194, 1195, 1195, 1196, 1197,
+    1197, 1199, 1200, 1203, 1204, 1205, 1205, 1206, 1207, 1210, 1211, 1213, 1214, 1216, 1217, 1218,
+    1219, 1220, 1221, 1222, 1223, 1224, 1225, 1228, 1229, 1230, 1231, 1232, 1232, 1234, 1235, 1236,
+    1237, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1254, 1255, 1256,
+    1256, 1257, 1258, 1260, 1262, 1262, 1265, 1265, 1266, 1266, 1266, 1268, 1269, 1270, 1271, 1273,
+    1275, 1276, 1277, 1278, 1279, 1281, 1283, 1284, 1285, 1287, 1288, 1289, 1290, 1292, 1293, 1294,
+    1295, 1296, 1296, 1297, 1298, 1299, 1301, 1301, 1305, 1305, 1305, 1305, 1307, 1307, 1308, 1309,
+    1310, 1313, 1314, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1323, 1324, 1325, 1326, 1327,
+    1327, 1329, 1330, 1331, 1332, 1333, 1336, 1337, 1338, 1338, 1339, 1340, 1341, 1342, 1343, 1344,
+    1345, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+    1360, 1361, 1362, 1363, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1373, 1374, 1376, 1377, 1379,
+    1380, 1381, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402,
+    1403, 1404, 1407, 1408, 1409, 1409, 1410, 1411, 1412, 1414, 1415, 1415, 1416, 1420, 1421, 1422,
+    1423, 1427, 1427, 1428, 1428, 1438, 1438, 1438, 1439, 1440, 1442, 1444, 1448, 1451, 1453, 1454,
+    1455, 1457, 1459, 1460, 1462, 1463, 1467, 1468, 1469, 1470, 1471, 1475, 1476, 1477, 1478, 1479,
+    1480, 1483, 1486, 1487, 1488, 1494, 1495, 1496, 1497, 1498, 1502, 1509, 1510, 1511, 1512, 1517,
+    1519, 1521, 1522, 1522, 1523, 1524, 1525, 1525, 1526, 1526, 1527, 1528, 1529, 1530, 1531, 1536,
+    1542, 1543, 1544, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1557,
+    1557, 1558, 1560, 1562, 1566, 1569, 1571, 1572, 1573, 1575, 1577, 1578, 1579, 1580, 1581, 1582,
+    1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598,
+    1599, 1600, 1601, 1602, 1603, 1604, 1604, 1604, 1605, 1606, 1607, 1608, 1608, 1609, 1610, 1611,
+    1612, 1613, 1614, 1615, 1616, 1616, 1616, 1617, 1618, 1619, 1620, 1622, 1623, 1625, 1626, 1626,
+    1626, 1627, 1628, 1629, 1629, 1630, 1631, 1633, 1633, 1633, 1633, 1634, 1634, 1634, 1634, 1634,
+    1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1647,
+    1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
+    1662, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1668, 1669, 1670, 1671, 1671, 1672, 1673, 1673,
+    1674, 1675, 1676, 1677, 1678, 1679, 1679, 1679, 1679, 1680, 1681, 1681, 1682, 1683, 1684, 1685,
+    1685, 1686, 1687, 1687, 1688, 1689, 1689, 1689, 1690, 1691, 1698, 1699, 1700, 1701, 1702, 1703,
+    1704, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1719,
+    1720, 1722, 1723, 1724, 1725, 1726, 1727, 1727, 1728, 1728, 1729, 1730, 1730, 1730, 1731, 1732,
+    1733, 1733, 1734, 1735, 1736, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1744, 1746,
+    1747, 1748, 1749, 1751, 1752, 1753, 1754, 1756, 1757, 1758, 1760, 1761, 1762, 1764, 1765, 1765,
+    1766, 1767, 1768, 1769, 1769, 1770, 1771, 1771, 1771, 1772, 1773, 1775, 1776, 1778, 1779, 1780,
+    1781, 1781, 1782, 1783, 1784, 1784, 1785, 1794, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801,
+    1802, 1803, 1803, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1809, 1810, 1811, 1812, 1813, 1814,
+    1815, 1816, 1817, 1818, 1819, 1819, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828,
+    1829, 1830, 1831, 1832, 1832, 1834, 1834, 1835, 1835, 1836, 1837, 1838, 1839, 1839, 1840, 1840,
+    1841, 1842, 1842, 1843, 1843, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853,
+    1854, 1855, 1856, 1857, 1858, 1859, 1860, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868,
+    1869, 1870, 1871, 1872, 1872, 1873, 1873, 1874, 1875, 1876, 1878, 1879, 1880, 1881, 1882, 1882,
+    1883, 1884, 1885, 1886, 1887, 1888, 1889, 1893, 1894, 1895, 1896, 1897, 1897, 1898, 1899, 1900,
+    1901, 1903, 1903, 1904, 1904, 1905, 1905, 1906, 1907, 1908, 1908, 1909, 1909, 1910, 1910, 1911,
+    1912, 1913, 1914, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1920, 1922, 1923, 1924, 1925, 1926,
+    1927, 1928, 1929, 1930, 1931, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+    1944, 1945, 1945, 1945, 1946, 1948, 1950, 1954, 1957, 1959, 1960, 1961, 1963, 1965, 1966, 1967,
+    1968, 1969, 1970, 1971, 1972, 1973, 1977, 1978, 1979, 1980, 1981, 1981, 1982, 1982, 1982, 1982,
+    1982, 1982, 1983, 1984, 1985, 1985, 1986, 1987, 1988, 1990, 1991, 1992, 1993, 1993, 1993, 1994,
+    1994, 1994, 1994, 1994, 1994, 1998, 1998, 2001, 2007, 2012, 2012, 2012, 2013, 2014, 2014, 2014,
+    2015, 2015, 2015, 2016, 2017, 2018, 2019, 2019, 2020, 2021, 2021, 2021, 2022, 2023, 2024, 2025,
+    2026, 2026, 2027, 2028, 2029, 2029, 2030, 2032, 2036, 2037, 2038, 2040, 2040, 2041, 2049, 2050,
+    2051, 2052, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2061, 2062, 2063, 2065, 2066, 2067, 2068,
+    2069, 2069, 2069, 2069, 2069, 2069, 2069, 2070, 2071, 2072, 2077, 2078, 2079, 2080, 2080, 2082,
+    2082, 2082, 2082, 2082, 2082, 2082, 2083, 2084, 2087, 2091, 2095, 2096, 2097, 2104, 2106, 2107,
+    2107, 2107, 2108, 2109, 2110, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2120, 2121,
+    2122, 2123, 2126, 2126, 2128, 2130, 2130, 2131, 2132, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
+    2142, 2146, 2147, 2148, 2149, 2149, 2149, 2149, 2149, 2150, 2151, 2152, 2153, 2153, 2154, 2155,
+    2155, 2155, 2156, 2157, 2158, 2159, 2160, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168,
+    2169, 2170, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183,
+    2183, 2184, 2184, 2184, 2184, 2185, 2185, 2186, 2187, 2188, 2188, 2189, 2189, 2190, 2191, 2192,
+    2192, 2193, 2193, 2194, 2195, 2195, 2196, 2198, 2198, 2199, 2200, 2201, 2201, 2202, 2203, 2203,
+    2203, 2203, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2213, 2214, 2215, 2216, 2216,
+    2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2223, 2224, 2225, 2225, 2226, 2227, 2228, 2228,
+    2229, 2230, 2232, 2233, 2233, 2234, 2235, 2236, 2237, 2237, 2238, 2238, 2239, 2240, 2241, 2241,
+    2242, 2242, 2243, 2243, 2244, 2245, 2246, 2246, 2247, 2247, 2248, 2255, 2255, 2255, 2255, 2255,
+    2255, 2255, 2255, 2255, 2256, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266,
+    2267, 2268, 2269, 2270, 2271, 2272, 2273, 2273, 2274, 2276, 2276, 2276, 2277, 2277, 2278, 2278,
+    2278, 2278, 2278, 2278, 2279, 2280, 2281, 2282, 2283, 2283, 2283, 2284, 2285, 2286, 2287, 2288,
+    2288, 2288, 2289, 2290, 2291, 2291, 2292, 2293, 2293, 2294, 2295, 2296, 2296, 2297, 2298, 2298,
+    2298, 2298, 2298, 2300, 2301, 2302, 2302, 2303, 2304, 2304, 2305, 2306, 2307, 2307, 2307, 2308,
+    2309, 2309, 2310, 2311, 2311, 2312, 2313, 2313, 2314, 2315, 2315, 2315, 2315, 2315, 2315, 2315,
+    2316, 2316, 2316, 2317, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2323, 2325, 2326, 2327, 2327,
+    2327, 2328, 2329, 2329, 2330, 2331, 2332, 2332, 2333, 2334, 2334, 2335, 2335, 2335, 2335, 2336,
+    2337, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2343, 2343, 2344, 2344, 2345, 2345, 2346, 2347,
+    2348, 2349, 2349, 2350, 2351, 2351, 2351, 2351, 2351, 2352, 2353, 2354, 2354, 2354, 2354, 2355,
+    2356, 2357, 2357, 2358, 2359, 2360, 2361, 2363, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2369,
+    2370, 2371, 2372, 2372, 2372, 2372, 2373, 2374, 2375, 2376, 2381, 2382, 2382, 2383, 2384, 2385,
+    2385, 2386, 2386, 2386, 2388, 2388, 2388, 2389, 2389, 2389, 2389, 2390, 2391, 2392, 2392, 2393,
+    2394, 2395, 2396, 2396, 2397, 2397, 2397, 2397, 2397, 2397, 2397, 2398, 2399, 2400, 2401, 2402,
+    2403, 2403, 2404, 2405, 2406, 2407, 2408, 2408, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+    2416, 2417, 2418, 2419, 2420, 2424, 2425, 2426, 2427, 2427, 2427, 2427, 2427, 2428, 2429, 2430,
+    2431, 2431, 2432, 2433, 2433, 2433, 2434, 2435, 2436, 2437, 2438, 2438, 2439, 2440, 2441, 2442,
+    2443, 2443, 2443, 2443, 2444, 2445, 2445, 2446, 2446, 2446, 2447, 2448, 2449, 2450, 2451, 2452,
+    2453, 2454, 2455, 2456, 2457, 2458, 2458, 2458, 2458, 2459, 2460, 2461, 2461, 2462, 2463, 2464,
+    2465, 2466, 2466, 2467, 2468, 2470, 2470, 2471, 2472, 2472, 2473, 2475, 2476, 2476, 2477, 2478,
+    2479, 2480, 2481, 2481, 2482, 2483, 2484, 2484, 2485, 2492, 2492, 2493, 2494, 2495, 2496, 2498,
+    2499, 2500, 2501, 2501, 2501, 2501, 2502, 2502, 2502, 2503, 2503, 2503, 2503, 2503, 2503, 2503,
+    2503, 2504, 2504, 2504, 2504, 2504, 2505, 2506, 2507, 2507, 2507, 2507, 2508, 2509, 2509, 2511,
+    2512, 2512, 2513, 2513, 2514, 2514, 2515, 2516, 2517, 2517, 2518, 2518, 2518, 2518, 2519, 2520,
+    2521, 2522, 2522, 2523, 2523, 2524, 2526, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534,
+    2535, 2536, 2540, 2542, 2544, 2546, 2546, 2546, 2548, 2548, 2550, 2550, 2550, 2551, 2551, 2552,
+    2553, 2553, 2554, 2554, 2554, 2555, 2555, 2557, 2557, 2557, 2557, 2557, 2558, 2559, 2559, 2559,
+    2561, 2561, 2561, 2562, 2563, 2563, 2563, 2563, 2563, 2564, 2564, 2564, 2564, 2565, 2566, 2566,
+    2567, 2567, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2573, 2574, 2575, 2576, 2576, 2577, 2584,
+    2584, 2585, 2586, 2587, 2587, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2593, 2593, 2594, 2595,
+    2596, 2597, 2597, 2598, 2599, 2600, 2600, 2601, 2602, 2602, 2603, 2604, 2604, 2605, 2605, 2606,
+    2607, 2607, 2608, 2609, 2609, 2610, 2611, 2611, 2612, 2612, 2613, 2613, 2614, 2615, 2616, 2617,
+    2618, 2619, 2621, 2621, 2622, 2622, 2623, 2623, 2624, 2625, 2626, 2626, 2627, 2628, 2628, 2628,
+    2629, 2630, 2631, 2632, 2633, 2634, 2634, 2634, 2634, 2635, 2636, 2637, 2638, 2638, 2638, 2639,
+    2640, 2641, 2641, 2641, 2642, 2643, 2643, 2643, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644,
+    2644, 2644, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657,
+    2658, 2659, 2660, 2660, 2660, 2661, 2662, 2663, 2663, 2663, 2664, 2665, 2666, 2667, 2668, 2669,
+    2670, 2670, 2671, 2671, 2672, 2672, 2672, 2673, 2674, 2675, 2676, 2676, 2677, 2678, 2678, 2678,
+    2682, 2683, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2684, 2685, 2686, 2687, 2687, 2688, 2689,
+    2690, 2691, 2692, 2693, 2694, 2694, 2694, 2694, 2695, 2695, 2695, 2696, 2697, 2698, 2699, 2700,
+    2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2708, 2708, 2709, 2710, 2711, 2711, 2712, 2712,
+    2712, 2713, 2714, 2714, 2714, 2715, 2716, 2717, 2718, 2719, 2719, 2719, 2720, 2720, 2721, 2722,
+    2722, 2723, 2724, 2725, 2726, 2726, 2726, 2727, 2728, 2730, 2730, 2730, 2731, 2731, 2731, 2732,
+    2733, 2734, 2735, 2735, 2735, 2735, 2735, 2736, 2737, 2738, 2739, 2740, 2740, 2741, 2741, 2741,
+    2741, 2742, 2743, 2743, 2744, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2752, 2752,
+    2752, 2752, 2752, 2753, 2754, 2754, 2755, 2755, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2761,
+    2762, 2763, 2764, 2764, 2765, 2772, 2772, 2773, 2774, 2775, 2775, 2775, 2776, 2776, 2777, 2777,
+    2778, 2779, 2780, 2781, 2782, 2782, 2783, 2785, 2785, 2786, 2786, 2786, 2787, 2787, 2788, 2789,
+    2790, 2790, 2790, 2790, 2790, 2791, 2792, 2792, 2792, 2793, 2793, 2793, 2794, 2794, 2795, 2795,
+    2796, 2797, 2798, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2800, 2801, 2802,
+    2803, 2804, 2805, 2805, 2807, 2808, 2808, 2809, 2810, 2811, 2811, 2812, 2812, 2812, 2812, 2812,
+    2814, 2815, 2816, 2817, 2817, 2817, 2817, 2818, 2818, 2818, 2818, 2819, 2819, 2819, 2820, 2820,
+    2822, 2822, 2822, 2823, 2823, 2824, 2825, 2826, 2827, 2827, 2827, 2828, 2828, 2828, 2828, 2828,
+    2828, 2829, 2831, 2831, 2831, 2831, 2831, 2831, 2832, 2833, 2834, 2834, 2835, 2835, 2835, 2835,
+    2835, 2835, 2836, 2837, 2838, 2839, 2839, 2840, 2840, 2841, 2842, 2842, 2843, 2844, 2845, 2846,
+    2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2847, 2848, 2849, 2849, 2850, 2851, 2851,
+    2852, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2858, 2858, 2858, 2859, 2859, 2860, 2861, 2862,
+    2862, 2863, 2863, 2863, 2864, 2865, 2865, 2865, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872,
+    2872, 2873, 2874, 2875, 2875, 2876, 2877, 2878, 2878, 2878, 2879, 2879, 2880, 2881, 2882, 2882,
+    2882, 2883, 2884, 2885, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896,
+    2897, 2897, 2898, 2899, 2899, 2900, 2900, 2901, 2901, 2902, 2903, 2904, 2904, 2905, 2906, 2907,
+    2908, 2908, 2909, 2910, 2910, 2910, 2911, 2911, 2911, 2911, 2912, 2913, 2914, 2915, 2915, 2916,
+    2917, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2924, 2924, 2925, 2925, 2925, 2926, 2926,
+    2927, 2927, 2928, 2929, 2930, 2931, 2932, 2932, 2933, 2934, 2935, 2935, 2935, 2936, 2937, 2937,
+    2938, 2938, 2939, 2940, 2941, 2942, 2942, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2948, 2949,
+    2951, 2952, 2953, 2954, 2954, 2954, 2955, 2956, 2956, 2957, 2958, 2958, 2959, 2960, 2960, 2961,
+    2962, 2963, 2963, 2964, 2964, 2965, 2966, 2966, 2967, 2968, 2969, 2970, 2970, 2970, 2970, 2970,
+    2970, 2970, 2970, 2970, 2970, 2971, 2972, 2973, 2973, 2974, 2974, 2974, 2974, 2975, 2976, 2977,
+    2978, 2979, 2979, 2979, 2979, 2980, 2981, 2981, 2981, 2981, 2981, 2982, 2982, 2982, 2982, 2982,
+    2983, 2984, 2984, 2984, 2985, 2986, 2987, 2987, 2987, 2987, 2987, 2987, 2988, 2988, 2988, 2988,
+    2988, 2989, 2990, 2991, 2991, 2991, 2991, 2991, 2992, 2992, 2992, 2993, 2993, 2994, 2995, 2995,
+    2996, 2997, 2998, 2999, 3000, 3000, 3001, 3001, 3002, 3002, 3002, 3002, 3002, 3002, 3002, 3003,
+    3004, 3005, 3006, 3006, 3007, 3008, 3009, 3009, 3010, 3011, 3012, 3012, 3012, 3013, 3013, 3014,
+    3015, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028,
+    3029, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3042,
+    3043, 3044, 3045, 3046, 3046, 3046, 3046, 3047, 3047, 3048, 3049, 3050, 3050, 3051, 3051, 3052,
+    3052, 3053, 3054, 3054, 3055, 3057, 3058, 3058, 3058, 3059, 3059, 3059, 3059, 3060, 3060, 3061,
+    3062, 3063, 3064, 3064, 3064, 3065, 3066, 3066, 3067, 3068, 3069, 3069, 3070, 3070, 3071, 3071,
+    3071, 3071, 3072, 3072, 3073, 3074, 3074, 3074, 3075, 3076, 3077, 3077, 3077, 3077, 3078, 3078,
+    3078, 3079, 3080, 3080, 3081, 3081, 3081, 3081, 3081, 3081, 3081, 3082, 3083, 3084, 3084, 3085,
+    3086, 3086, 3087, 3087, 3087, 3087, 3087, 3087, 3087, 3088, 3089, 3089, 3089, 3089, 3089, 3089,
+    3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3090, 3091,
+    3092, 3092, 3093, 3093, 3093, 3093, 3094, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3101,
+    3102, 3102, 3103, 3104, 3104, 3105, 3105, 3105, 3105, 3106, 3106, 3106, 3107, 3107, 3107, 3107,
+    3107, 3107, 3108, 3108, 3108, 3109, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118,
+    3119, 3120, 3121, 3122, 3122, 3122, 3122, 3123, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130,
+    3131, 3132, 3133, 3133, 3134, 3134, 3134, 3135, 3136, 3136, 3136, 3136, 3136, 3136, 3137, 3138,
+    3138, 3139, 3139, 3140, 3141, 3142, 3142, 3142, 3142, 3142, 3142, 3143, 3143, 3144, 3144, 3144,
+    3144, 3144, 3145, 3145, 3145, 3146, 3147, 3148, 3148, 3148, 3149, 3149, 3149, 3149, 3150, 3151,
+    3152, 3153, 3154, 3154, 3154, 3154, 3154, 3154, 3155, 3156, 3156, 3157, 3157, 3157, 3158, 3159,
+    3160, 3161, 3162, 3162, 3163, 3163, 3164, 3164, 3165, 3166, 3167, 3167, 3167, 3167, 3167, 3168,
+    3169, 3169, 3169, 3169, 3170, 3171, 3172, 3172, 3172, 3173, 3174, 3174, 3174, 3175, 3176, 3176,
+    3177, 3178, 3178, 3178, 3179, 3180, 3180, 3180, 3181, 3181, 3181, 3181, 3181, 3181,
+};
+
+static const uint16_t hyph_frNodeLevels[3181] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+    0, 0, 1, 8, 0, 0, 0, 8, 0, 8, 0, 0, 0, 0, 8, 0,
+    0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 11, 5, 11, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 11, 5, 11, 11, 5, 11, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 0,
+    5, 11, 15, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 0, 5, 5, 5, 11, 5, 11, 15, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 5, 11, 11, 5, 11, 15, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 5, 5, 11,
+    5, 5, 11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 15, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 22, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 11, 5, 11, 0, 5, 11,
+    0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 11,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 11,
+    5, 0, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 11, 5, 5, 11, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 0, 0, 0, 0, 5, 5, 5, 5, 11, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 11, 5, 0, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0,
+    0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 31, 19, 0, 19, 0,
+    28, 19, 19, 19, 28, 19, 19, 19, 0, 31, 19, 0, 19, 19, 34, 19,
+    19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 15,
+    31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    0, 0, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 31, 0, 0,
+    0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 31, 0, 0, 31, 0, 0, 31, 0, 31, 0,
+    0, 0, 0, 0, 0, 15, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 31, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 31, 0, 0, 0, 31, 0, 28, 19, 0, 28, 19,
+    19, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 31,
+    0, 0, 0, 0, 31, 0, 19, 0, 19, 19, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 31, 0, 0, 0, 0, 31, 0, 19, 19, 19, 28, 19, 0, 0, 0,
+    0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+    0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0,
+    31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 43, 0, 0, 0, 47, 43, 47, 0, 0, 0, 0, 0,
+    50, 43, 0, 43, 54, 43, 43, 0, 0, 0, 43, 43, 43, 43, 0, 0,
+    43, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 43,
+    43, 43, 43, 0, 57, 0, 43, 0, 47, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 43,
+    0, 0, 43, 43, 43, 43, 0, 0, 43, 43, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 31, 31, 0, 0, 0, 0, 31, 0, 0, 0, 0,
+    0, 0, 0, 0, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 60, 31,
+    0, 0, 0, 31, 0, 0, 0, 39, 63, 63, 0, 63, 63, 63, 63, 63,
+    0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 31, 66,
+    0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0,
+    70, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 31, 0, 0, 31, 0,
+    0, 0, 0, 0, 0, 31, 60, 31, 0, 0, 31, 0, 0, 0, 0, 31,
+    0, 0, 31, 0, 0, 31, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0,
+    0, 0, 0, 0, 0, 0, 31, 0, 31, 0, 0, 31, 60, 0, 0, 0,
+    31, 60, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0,
+    0, 0, 0, 60, 0, 0, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0,
+    31, 0, 0, 0, 11, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 11, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 31, 0, 19, 0, 11, 0, 0, 0, 0, 31, 0, 31, 0,
+    0, 74, 0, 11, 11, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 31, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0,
+    0, 31, 0, 60, 0, 31, 0, 0, 0, 78, 0, 31, 0, 60, 0, 0,
+    0, 0, 31, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 43, 43, 0, 0, 43, 43, 43, 43, 0, 0, 43, 43, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 43, 43, 82, 85,
+    89, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 43, 50, 0, 89,
+    89, 89, 89, 82, 0, 97, 0, 89, 0, 97, 97, 0, 89, 101, 89, 0,
+    78, 78, 0, 0, 0, 0, 54, 0, 0, 50, 50, 0, 0, 0, 0, 0,
+    50, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 54,
+    0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85,
+    85, 85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 54,
+    54, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 89,
+    89, 89, 50, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 54, 89, 78, 78, 0, 0, 0, 0, 54, 0, 0, 50,
+    50, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
+    0, 47, 15, 19, 0, 31, 0, 0, 0, 31, 0, 105, 0, 0, 0, 19,
+    0, 31, 0, 0, 31, 0, 0, 31, 0, 0, 0, 31, 0, 0, 31, 63,
+    63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 19, 66,
+    0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 111, 0, 0, 0, 70, 0,
+    0, 116, 0, 19, 0, 0, 0, 0, 31, 0, 31, 0, 0, 0, 19, 0,
+    31, 0, 31, 0, 0, 0, 31, 0, 31, 0, 119, 85, 85, 85, 85, 85,
+    85, 85, 123, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 39, 0, 0, 70, 15, 0, 15, 0, 19, 19,
+    78, 19, 126, 0, 0, 0, 0, 0, 11, 11, 0, 0, 0, 0, 0, 19,
+    129, 0, 0, 0, 5, 0, 0, 22, 0, 0, 0, 85, 0, 0, 15, 15,
+    15, 15, 0, 0, 0, 15, 0, 0, 19, 0, 0, 0, 31, 31, 0, 0,
+    31, 0, 0, 133, 0, 0, 31, 0, 0, 85, 85, 85, 85, 85, 85, 0,
+    85, 85, 0, 31, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 28, 138,
+    0, 0, 31, 0, 0, 0, 47, 0, 0, 19, 0, 31, 74, 74, 0, 0,
+    47, 0, 0, 0, 0, 0, 0, 11, 31, 0, 11, 0, 19, 0, 0, 0,
+    0, 31, 0, 0, 11, 11, 11, 11, 0, 0, 0, 11, 11, 11, 0, 0,
+    0, 11, 0, 0, 0, 0, 119, 143, 0, 0, 0, 0, 0, 0, 19, 0,
+    0, 0, 31, 74, 31, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 147,
+    0, 85, 85, 0, 85, 47, 0, 43, 43, 47, 0, 0, 0, 19, 0, 0,
+    0, 0, 31, 0, 19, 19, 22, 22, 15, 19, 0, 0, 0, 0, 0, 0,
+    11, 0, 0, 0, 0, 0, 47, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 54, 89, 78, 78, 0, 0, 0, 0,
+    54, 0, 0, 50, 50, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0,
+    60, 151, 78, 0, 0, 155, 155, 155, 155, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 43, 82, 43, 0, 0, 0, 147, 0, 0, 0, 0,
+    0, 159, 0, 0, 0, 159, 0, 0, 159, 0, 0, 0, 89, 0, 0, 0,
+    0, 0, 54, 0, 0, 0, 54, 0, 164, 54, 0, 0, 0, 0, 0, 0,
+    0, 0, 101, 89, 101, 0, 101, 89, 0, 155, 155, 155, 155, 155, 155, 155,
+    0, 101, 60, 101, 89, 0, 0, 0, 123, 85, 89, 0, 0, 101, 0, 0,
+    155, 0, 50, 0, 57, 0, 0, 0, 147, 0, 168, 147, 155, 0, 0, 0,
+    0, 57, 0, 85, 0, 155, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 151, 151, 151, 0, 50, 0, 54, 50, 0, 54, 0, 0,
+    57, 0, 147, 173, 0, 101, 0, 50, 101, 159, 159, 0, 0, 97, 89, 0,
+    101, 101, 0, 0, 85, 85, 85, 85, 0, 60, 151, 78, 0, 0, 155, 155,
+    155, 155, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 54, 0, 164, 54,
+    0, 0, 0, 123, 85, 0, 0, 0, 0, 0, 0, 176, 5, 0, 0, 0,
+    0, 50, 0, 0, 0, 180, 0, 0, 19, 0, 0, 19, 0, 173, 0, 0,
+    19, 0, 0, 31, 0, 0, 31, 0, 19, 0, 19, 0, 0, 0, 0, 0,
+    0, 0, 28, 0, 19, 0, 173, 0, 0, 0, 78, 0, 0, 19, 19, 0,
+    0, 0, 0, 0, 0, 39, 183, 183, 0, 0, 0, 0, 19, 19, 0, 0,
+    0, 19, 19, 0, 0, 19, 19, 0, 186, 186, 186, 186, 186, 186, 186, 85,
+    22, 173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 70, 70, 0, 0, 0, 189, 25, 0, 0, 0, 0, 0, 0, 0,
+    129, 0, 70, 0, 70, 192, 0, 0, 0, 0, 15, 0, 0, 15, 155, 0,
+    0, 0, 19, 31, 155, 31, 133, 173, 19, 0, 0, 0, 19, 0, 0, 0,
+    0, 0, 0, 0, 78, 173, 173, 0, 19, 155, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 31, 94, 0, 0, 0, 19, 0, 11, 11,
+    0, 0, 11, 11, 0, 0, 0, 0, 0, 186, 186, 0, 155, 0, 0, 196,
+    0, 0, 0, 0, 31, 173, 0, 0, 168, 147, 168, 147, 168, 19, 0, 0,
+    0, 0, 85, 85, 94, 94, 0, 0, 0, 0, 0, 19, 0, 189, 189, 126,
+    0, 0, 126, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 126, 189, 60,
+    151, 78, 0, 0, 155, 155, 155, 155, 0, 0, 0, 0, 0, 0, 54, 0,
+    0, 0, 54, 0, 164, 54, 0, 0, 0, 123, 85, 0, 200, 0, 147, 0,
+    0, 0, 0, 0, 101, 0, 0, 50, 0, 43, 43, 0, 159, 0, 0, 0,
+    97, 97, 159, 159, 0, 0, 97, 159, 0, 97, 97, 0, 159, 0, 50, 0,
+    0, 0, 0, 50, 43, 204, 204, 204, 204, 204, 204, 204, 0, 0, 0, 0,
+    0, 0, 50, 0, 0, 101, 0, 0, 0, 101, 0, 89, 89, 89, 101, 0,
+    0, 0, 0, 207, 57, 210, 0, 85, 196, 147, 0, 116, 192, 0, 50, 0,
+    50, 50, 0, 50, 0, 0, 0, 0, 151, 151, 0, 151, 151, 151, 151, 151,
+    0, 0, 151, 151, 50, 50, 214, 0, 0, 0, 97, 0, 50, 97, 97, 101,
+    101, 0, 0, 0, 0, 200, 0, 147, 0, 0, 50, 0, 0, 0, 0, 50,
+    43, 204, 204, 204, 204, 204, 204, 204, 0, 0, 0, 218, 0, 0, 218, 0,
+    28, 0, 0, 0, 0, 0, 0, 28, 28, 28, 0, 221, 0, 0, 0, 224,
+    0, 227, 227, 0, 0, 63, 63, 78, 0, 0, 0, 0, 0, 0, 0, 28,
+    0, 0, 0, 221, 0, 0, 0, 28, 218, 0, 28, 0, 0, 0, 221, 28,
+    0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    221, 0, 0, 218, 0, 218, 0, 28, 0, 0, 0, 168, 0, 0, 0, 0,
+    28, 0, 0, 28, 15, 0, 173, 173, 173, 0, 0, 0, 0, 63, 0, 0,
+    50, 0, 0, 0, 0, 0, 0, 0, 28, 218, 0, 218, 28, 0, 218, 0,
+    218, 0, 0, 0, 0, 0, 214, 0, 0, 0, 11, 214, 0, 0, 28, 0,
+    28, 0, 0, 0, 0, 214, 28, 0, 0, 0, 0, 0, 0, 28, 0, 0,
+    0, 0, 0, 101, 85, 0, 0, 11, 0, 0, 11, 0, 50, 126, 0, 0,
+    0, 200, 0, 147, 0, 0, 50, 0, 0, 0, 0, 50, 43, 204, 204, 204,
+    204, 204, 204, 204, 0, 0, 0, 214, 0, 60, 60, 60, 0, 0, 0, 0,
+    0, 232, 60, 97, 0, 0, 159, 97, 159, 97, 0, 54, 54, 54, 50, 0,
+    0, 60, 214, 0, 0, 0, 89, 101, 207, 155, 155, 0, 89, 89, 60, 60,
+    0, 0, 0, 192, 50, 50, 50, 0, 50, 50, 0, 151, 0, 0, 236, 0,
+    0, 0, 0, 0, 60, 0, 214, 0, 60, 60, 54, 54, 54, 50, 0, 0,
+    0, 0, 54, 0, 0, 0, 54, 0, 0, 0, 54, 54, 0, 60, 0, 0,
+    54, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+    0, 0, 0, 60, 54, 60, 0, 50, 0, 0, 0, 70, 0, 60, 0, 173,
+    0, 0, 54, 0, 0, 0, 60, 60, 0, 78, 54, 60, 0, 60, 0, 0,
+    0, 0, 60, 60, 0, 0, 11, 0, 0, 0, 60, 0, 60, 0, 60, 240,
+    240, 0, 60, 0, 0, 173, 173, 0, 0, 0, 54, 54, 54, 0, 60, 151,
+    0, 0, 214, 0, 60, 60, 54, 54, 54, 50, 0, 0, 0, 183, 0, 0,
+    244, 0, 232, 159, 97, 57, 50, 50, 0, 0, 89, 60, 247, 147, 232, 50,
+    244, 236, 236, 244, 244, 244, 50, 147, 244, 183, 50, 50, 60, 0, 0, 0,
+    11, 0, 244, 155, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 244, 0,
+    244, 0, 0, 57, 0, 57, 244, 57, 0, 244, 244, 0, 244, 244, 244, 244,
+    244, 0, 244, 244, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 57, 57, 244, 0, 244, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 57, 0, 57, 60, 0, 0, 183, 50, 50, 60, 251, 0, 0, 50,
+    0, 173, 0, 0, 0, 173, 173, 173, 173, 173, 0, 173, 0, 173, 173, 173,
+    173, 0, 94, 173, 0, 0, 0, 173, 173, 0, 15, 173, 173, 0, 0, 0,
+    0, 0, 173, 183, 94, 183, 173, 0, 0, 173, 0, 173, 173, 0, 0, 0,
+    0, 0, 50, 0, 186, 0, 221, 0, 0, 0, 221, 221, 221, 221, 0, 0,
+    221, 221, 221, 0, 0, 0, 221, 224, 0, 0, 256, 259, 0, 0, 259, 0,
+    0, 259, 259, 0, 0, 259, 262, 0, 265, 265, 265, 268, 265,
+};
+
+static const uint8_t hyph_frLevels[274] = {
+    0, 0, 2, 2, 2, 0, 1, 1, 2, 1, 4, 0, 2, 1, 2, 1,
+    2, 1, 2, 0, 1, 2, 1, 1, 1, 3, 1, 4, 2, 1, 2, 0,
+    1, 4, 0, 3, 2, 0, 3, 2, 2, 1, 2, 3, 2, 1, 2, 4,
+    1, 4, 3, 2, 2, 3, 3, 1, 2, 4, 1, 2, 3, 1, 3, 2,
+    1, 1, 0, 2, 3, 2, 1, 2, 2, 3, 0, 2, 2, 3, 2, 2,
+    2, 3, 3, 1, 1, 4, 2, 1, 2, 3, 3, 2, 1, 2, 5, 1,
+    4, 3, 2, 3, 2, 3, 2, 2, 1, 2, 4, 3, 0, 3, 2, 1,
+    3, 2, 1, 2, 5, 1, 1, 4, 2, 4, 1, 4, 1, 1, 1, 1,
+    3, 1, 2, 3, 2, 0, 3, 3, 0, 2, 2, 3, 1, 2, 2, 2,
+    2, 3, 2, 4, 2, 2, 3, 3, 2, 3, 4, 5, 2, 1, 2, 3,
+    3, 3, 2, 3, 5, 2, 4, 3, 4, 3, 2, 1, 2, 5, 1, 3,
+    1, 2, 2, 1, 5, 1, 5, 5, 1, 2, 6, 1, 2, 1, 1, 2,
+    5, 2, 2, 3, 5, 2, 3, 2, 4, 2, 3, 4, 7, 1, 2, 6,
+    1, 1, 4, 2, 2, 1, 6, 2, 1, 2, 2, 1, 3, 6, 1, 3,
+    6, 1, 4, 4, 3, 2, 3, 2, 7, 2, 1, 2, 3, 2, 4, 5,
+    4, 2, 3, 2, 4, 1, 3, 7, 2, 3, 2, 4, 3, 2, 0, 3,
+    7, 1, 4, 7, 1, 3, 8, 1, 2, 8, 1, 3, 4, 4, 2, 0,
+    0, 3,
+};
+
+static const HyphenationPatterns hyph_fr = {
+    "fr",
+    hyph_frLetters,
+    76,
+    hyph_frNodeChars,
+    hyph_frNodeFirstChild,
+    hyph_frNodeLevels,
+    hyph_frLevels,
+    3181,
+    2,
+    3,
+};
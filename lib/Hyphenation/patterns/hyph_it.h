@@ -0,0 +1,195 @@
+/**
+ * generated by hyphenconvert.py
+ * name: hyph_it
+ * language: it
+ * patterns: 384
+ * nodes: 497
+ */
+#pragma once
+#include "HyphenationPatterns.h"
+
+static const HyphenationLetter hyph_itLetters[54] = {
+    { 0x27, 1 }, // '
+    { 0x41, 2 }, // A
+    { 0x42, 3 }, // B
+    { 0x43, 4 }, // C
+    { 0x44, 5 }, // D
+    { 0x45, 6 }, // E
+    { 0x46, 7 }, // F
+    { 0x47, 8 }, // G
+    { 0x48, 9 }, // H
+    { 0x49, 10 }, // I
+    { 0x4A, 11 }, // J
+    { 0x4B, 12 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 14 }, // M
+    { 0x4E, 15 }, // N
+    { 0x4F, 16 }, // O
+    { 0x50, 17 }, // P
+    { 0x51, 18 }, // Q
+    { 0x52, 19 }, // R
+    { 0x53, 20 }, // S
+    { 0x54, 21 }, // T
+    { 0x55, 22 }, // U
+    { 0x56, 23 }, // V
+    { 0x57, 24 }, // W
+    { 0x58, 25 }, // X
+    { 0x59, 26 }, // Y
+    { 0x5A, 27 }, // Z
+    { 0x61, 2 }, // a
+    { 0x62, 3 }, // b
+    { 0x63, 4 }, // c
+    { 0x64, 5 }, // d
+    { 0x65, 6 }, // e
+    { 0x66, 7 }, // f
+    { 0x67, 8 }, // g
+    { 0x68, 9 }, // h
+    { 0x69, 10 }, // i
+    { 0x6A, 11 }, // j
+    { 0x6B, 12 }, // k
+    { 0x6C, 13 }, // l
+    { 0x6D, 14 }, // m
+    { 0x6E, 15 }, // n
+    { 0x6F, 16 }, // o
+    { 0x70, 17 }, // p
+    { 0x71, 18 }, // q
+    { 0x72, 19 }, // r
+    { 0x73, 20 }, // s
+    { 0x74, 21 }, // t
+    { 0x75, 22 }, // u
+    { 0x76, 23 }, // v
+    { 0x77, 24 }, // w
+    { 0x78, 25 }, // x
+    { 0x79, 26 }, // y
+    { 0x7A, 27 }, // z
+    { 0x2019, 1 }, // ’
+};
+
+static const uint8_t hyph_itNodeChars[497] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 28, 2, 3, 4, 5,
+    6, 7, 9, 11, 12, 13, 15, 16, 17, 19, 20, 21, 24, 27, 10, 21,
+    22, 26, 0, 1, 3, 4, 5, 7, 13, 14, 15, 17, 19, 20, 21, 23,
+    28, 0, 1, 3, 4, 5, 7, 9, 12, 13, 14, 15, 18, 19, 20, 21,
+    27, 28, 0, 1, 3, 5, 8, 13, 14, 15, 17, 19, 20, 21, 23, 24,
+    28, 10, 24, 0, 1, 3, 7, 8, 13, 15, 19, 20, 21, 28, 0, 1,
+    3, 5, 7, 8, 9, 13, 14, 15, 17, 19, 20, 21, 23, 24, 27, 28,
+    0, 1, 3, 5, 9, 10, 13, 14, 15, 19, 23, 28, 0, 1, 28, 0,
+    1, 7, 8, 9, 12, 13, 14, 19, 20, 21, 28, 0, 1, 3, 4, 5,
+    7, 8, 9, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 23, 24, 27,
+    28, 0, 1, 3, 4, 7, 13, 14, 15, 17, 18, 19, 20, 21, 23, 24,
+    28, 0, 1, 3, 4, 5, 7, 8, 9, 12, 13, 14, 15, 17, 18, 19,
+    20, 21, 23, 27, 28, 10, 0, 1, 5, 9, 13, 15, 17, 19, 20, 21,
+    27, 28, 0, 1, 18, 28, 0, 1, 3, 4, 5, 7, 8, 9, 12, 13,
+    14, 15, 17, 18, 19, 20, 21, 23, 24, 25, 27, 28, 0, 1, 9, 17,
+    20, 21, 27, 28, 0, 1, 3, 4, 5, 7, 8, 9, 13, 14, 15, 17,
+    19, 20, 21, 23, 24, 27, 28, 0, 1, 4, 13, 19, 23, 28, 0, 1,
+    2, 9, 26, 28, 0, 1, 3, 4, 7, 9, 14, 17, 21, 24, 28, 10,
+    16, 0, 1, 3, 5, 13, 15, 17, 20, 21, 23, 27, 28, 15, 17, 10,
+    2, 10, 16, 10, 25, 19, 10, 2, 17, 19, 2, 9, 16, 19, 20, 6,
+    9, 22, 19, 2, 6, 2, 6, 16, 22, 0, 16, 2, 0, 1, 3, 9,
+    15, 19, 28, 22, 21, 17, 0, 1, 0, 28, 15, 6, 7, 2, 6, 16,
+    22, 6, 10, 20, 0, 1, 0, 1, 14, 28, 15, 14, 3, 4, 5, 7,
+    8, 14, 15, 17, 20, 21, 23, 0, 28, 0, 1, 0, 4, 20, 12, 20,
+    0, 28, 0, 1, 0, 28, 19, 22, 0, 1, 0, 28, 21, 15, 16, 17,
+    19, 15, 20, 6, 2, 6, 17, 19, 21, 21, 19, 13, 19, 13, 6, 10,
+    2, 3, 2, 8, 13, 0, 1, 0, 28, 15, 10, 6, 4, 9, 10, 20,
+    4, 21, 4, 22, 15, 6, 20, 4, 16, 16, 2, 10, 20, 19, 13, 19,
+    15, 15, 21, 0, 0, 21, 19, 14, 22, 19, 10, 12, 2, 16, 17, 17,
+    4, 6, 22, 20, 15, 14, 16, 15, 19, 4, 5, 13, 15, 17, 19, 21,
+    6,
+};
+
+static const uint16_t hyph_itNodeFirstChild[498] = {
+    1, 28, 46, 46, 50, 65, 82, 97, 99, 110, 128, 140, 143, 155, 177, 193,
+    213, 214, 226, 230, 252, 260, 279, 286, 292, 303, 305, 317, 317, 319, 320, 323,
+    324, 325, 326, 326, 326, 326, 327, 328, 330, 335, 336, 338, 339, 341, 341, 345,
+    346, 347, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+    356, 356, 356, 356, 356, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    357, 357, 357, 357, 357, 357, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+    358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 360, 360, 360,
+    360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 360,
+    360, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362,
+    362, 362, 362, 362, 362, 362, 362, 362, 363, 364, 364, 364, 364, 364, 364, 364,
+    364, 365, 365, 365, 365, 365, 369, 369, 369, 369, 369, 369, 370, 370, 370, 371,
+    371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371,
+    371, 371, 371, 371, 371, 371, 371, 372, 372, 372, 372, 372, 372, 372, 374, 378,
+    379, 380, 391, 391, 393, 393, 395, 395, 395, 395, 395, 395, 396, 396, 396, 396,
+    396, 396, 397, 398, 398, 398, 400, 402, 402, 404, 404, 404, 404, 404, 406, 406,
+    406, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407,
+    407, 408, 408, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 412, 413, 414,
+    415, 416, 417, 418, 419, 420, 422, 423, 424, 425, 426, 427, 429, 430, 431, 431,
+    432, 433, 434, 435, 436, 437, 437, 437, 437, 437, 437, 437, 437, 437, 439, 439,
+    439, 439, 439, 441, 441, 441, 442, 442, 442, 442, 442, 442, 443, 444, 444, 444,
+    444, 444, 444, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445,
+    445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 446, 446, 446,
+    446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 447, 447, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 459, 459, 460, 460,
+    461, 462, 464, 465, 466, 467, 467, 468, 468, 469, 469, 470, 471, 471, 471, 472,
+    472, 473, 474, 475, 475, 476, 476, 477, 478, 478, 479, 479, 480, 481, 482, 483,
+    483, 484, 484, 484, 484, 484, 484, 484, 485, 486, 487, 488, 488, 488, 488, 488,
+    488, 489, 489, 489, 496, 496, 496, 496, 497, 497, 497, 497, 497, 497, 497, 497,
+    497, 497,
+};
+
+static const uint16_t hyph_itNodeLevels[497] = {
+    0, 0, 1, 0, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 5, 5, 8, 5, 5, 5, 5, 0, 5, 1, 0, 0, 12, 12,
+    0, 0, 12, 12, 12, 0, 0, 0, 0, 0, 0, 12, 0, 12, 0, 0,
+    0, 0, 15, 15, 15, 15, 15, 15, 18, 15, 15, 15, 18, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 18, 15, 18, 15, 15, 15, 18, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 18, 15, 15, 15, 15,
+    15, 0, 18, 15, 15, 15, 15, 15, 18, 15, 18, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 18, 18, 15, 18, 15, 18, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 0, 18, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 18, 15, 18, 15, 18, 15, 15, 15, 15, 0, 15, 15, 15,
+    21, 15, 18, 18, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 0, 15, 15, 15, 18, 18, 15, 15, 18, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 18, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 0, 0, 0,
+    29, 0, 15, 0, 15, 0, 15, 15, 15, 15, 15, 18, 18, 15, 15, 15,
+    18, 18, 15, 15, 15, 18, 0, 15, 0, 15, 18, 18, 15, 0, 15, 15,
+    0, 18, 33, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 37,
+    0, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0,
+    0, 0, 0, 0, 0, 37, 37, 37, 37, 15, 37, 37, 15, 0, 15, 15,
+    15, 12, 0, 37, 40, 0, 15, 15, 15, 15, 45, 0, 0, 37, 37, 37,
+    37, 49, 0, 53, 26, 26, 15, 15, 15, 15, 21, 58, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 26, 26, 15, 15, 15, 0, 45, 15, 12,
+    15, 15, 15, 15, 15, 15, 12, 37, 15, 15, 15, 15, 0, 62, 66, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 0, 66, 0,
+    0, 0, 0, 0, 0, 15, 0, 15, 0, 62, 0, 0, 49, 49, 72, 75,
+    0, 0, 0, 79, 0, 83, 0, 0, 72, 0, 72, 0, 0, 0, 0, 86,
+    0, 86, 90, 15, 15, 15, 45, 0, 0, 0, 0, 94, 98, 102, 105, 105,
+    0, 109, 86, 0, 105, 114, 118, 0, 121, 94, 94, 94, 94, 94, 94, 94,
+    86,
+};
+
+static const uint8_t hyph_itLevels[125] = {
+    0, 0, 2, 2, 2, 0, 1, 1, 0, 2, 1, 2, 2, 1, 2, 0,
+    1, 2, 1, 1, 2, 0, 3, 2, 3, 2, 0, 1, 4, 0, 2, 2,
+    3, 0, 2, 2, 1, 1, 1, 1, 0, 3, 2, 0, 2, 1, 2, 2,
+    3, 0, 2, 3, 2, 1, 3, 2, 2, 3, 1, 2, 4, 3, 2, 2,
+    3, 2, 4, 1, 1, 3, 1, 2, 5, 1, 1, 3, 2, 4, 3, 2,
+    2, 2, 1, 5, 1, 3, 3, 2, 2, 3, 4, 2, 2, 1, 5, 2,
+    2, 3, 3, 2, 3, 2, 6, 1, 1, 5, 2, 3, 2, 4, 3, 2,
+    0, 3, 6, 2, 2, 1, 7, 1, 1, 3, 2, 1, 2,
+};
+
+static const HyphenationPatterns hyph_it = {
+    "it",
+    hyph_itLetters,
+    54,
+    hyph_itNodeChars,
+    hyph_itNodeFirstChild,
+    hyph_itNodeLevels,
+    hyph_itLevels,
+    497,
+    2,
+    2,
+};
@@ -0,0 +1,27 @@
+#!/bin/bash
+
+set -e
+
+cd "$(dirname "$0")"
+
+# name, language, left min, right min, hyph-utf8 pattern file
+PATTERN_SETS=(
+  "hyph_en en 2 3 en-us"
+  "hyph_de de 2 2 de-1996"
+  "hyph_fr fr 2 3 fr"
+  "hyph_es es 2 2 es"
+  "hyph_it it 2 2 it"
+)
+
+for pattern_set in "${PATTERN_SETS[@]}"; do
+  read -r name language leftmin rightmin source <<< "$pattern_set"
+  pattern_path="../patterns/source/hyph-${source}.pat.txt"
+  exception_path="../patterns/source/hyph-${source}.hyp.txt"
+  output_path="../patterns/${name}.h"
+  if [ -f "$exception_path" ]; then
+    python hyphenconvert.py $name $language $leftmin $rightmin $pattern_path --exceptions $exception_path > $output_path
+  else
+    python hyphenconvert.py $name $language $leftmin $rightmin $pattern_path > $output_path
+  fi
+  echo "Generated $output_path"
+done
@@ -0,0 +1,169 @@
+#!python3
+import argparse
+import re
+from collections import deque
+
+# Compiles TeX hyphenation patterns (as distributed by the hyph-utf8 project) into the packed trie read by
+# Hyphenator.cpp. The whole trie ends up in const arrays, so it is used straight from flash.
+
+parser = argparse.ArgumentParser(description="Generate a header file from TeX hyphenation patterns.")
+parser.add_argument("name", action="store", help="name of the pattern set.")
+parser.add_argument("language", action="store", help="primary language subtag the patterns are used for.")
+parser.add_argument("leftmin", type=int, help="minimum number of letters before a hyphen.")
+parser.add_argument("rightmin", type=int, help="minimum number of letters after a hyphen.")
+parser.add_argument("patterns", action="store", help="pattern file, one pattern per line (hyph-*.pat.txt).")
+parser.add_argument("--exceptions", dest="exceptions", action="store", help="hyphenation exceptions, one hyphenated word per line (hyph-*.hyp.txt).")
+args = parser.parse_args()
+
+# Exceptions are compiled into whole word patterns with levels above anything the regular patterns use, an even
+# level forbids a hyphen, an odd one forces it
+EXCEPTION_NO_HYPHEN = 10
+EXCEPTION_HYPHEN = 11
+
+
+def parse_pattern(text):
+    letters = []
+    levels = [0]
+    for token in re.findall(r"\d+|\D", text):
+        if token.isdigit():
+            levels[-1] = int(token)
+        else:
+            letters.append(token)
+            levels.append(0)
+    return "".join(letters), levels
+
+
+def parse_exception(word):
+    letters = []
+    levels = [EXCEPTION_NO_HYPHEN]
+    for c in word:
+        if c == "-":
+            levels[-1] = EXCEPTION_HYPHEN
+        else:
+            letters.append(c)
+            levels.append(EXCEPTION_NO_HYPHEN)
+    # The boundary dots need levels too, but never carry a hyphen
+    return "." + "".join(letters) + ".", [0] + levels + [0]
+
+
+def read_lines(path):
+    with open(path, encoding="utf-8") as f:
+        return [line.strip() for line in f if line.strip() and not line.startswith("%")]
+
+
+patterns = {}
+for line in read_lines(args.patterns):
+    letters, levels = parse_pattern(line)
+    if max(levels) > 0:
+        patterns[letters] = levels
+if args.exceptions:
+    for line in read_lines(args.exceptions):
+        letters, levels = parse_exception(line.lower())
+        patterns[letters] = levels
+
+# Letter codes: 0 is the word boundary, every other letter gets its own code in code point order
+alphabet = sorted({c for letters in patterns for c in letters if c != "."})
+if len(alphabet) > 255:
+    raise SystemExit("too many letters in pattern alphabet")
+letter_codes = {c: i + 1 for i, c in enumerate(alphabet)}
+letter_codes["."] = 0
+
+# Upper case letters map to the code of their lower case form, so words don't need to be case folded at runtime
+code_points = {ord(c): code for c, code in letter_codes.items() if c != "."}
+for c in alphabet:
+    upper = c.upper()
+    if len(upper) == 1 and upper != c and ord(upper) not in code_points:
+        code_points[ord(upper)] = letter_codes[c]
+# Books mostly use the typographic apostrophe, patterns the ASCII one
+if "'" in letter_codes:
+    code_points[0x2019] = letter_codes["'"]
+
+# Build the trie, then lay it out breadth first so the children of a node are consecutive
+root = {"children": {}, "levels": None}
+for letters, levels in patterns.items():
+    node = root
+    for c in letters:
+        node = node["children"].setdefault(letter_codes[c], {"children": {}, "levels": None})
+    node["levels"] = levels
+
+nodes = []
+queue = deque([root])
+while queue:
+    node = queue.popleft()
+    nodes.append(node)
+    for code in sorted(node["children"]):
+        queue.append(node["children"][code])
+if len(nodes) >= 0xFFFF:
+    raise SystemExit("too many trie nodes")
+
+# Levels are stored once per distinct set as [offset of first non zero level, count, levels...], offset 0 of the
+# table is a placeholder so a node without a pattern can use 0
+level_data = [0]
+level_offsets = {}
+node_first_child = []
+node_levels = []
+next_child = 1
+for node in nodes:
+    node_first_child.append(next_child)
+    next_child += len(node["children"])
+    levels = node["levels"]
+    if levels is None:
+        node_levels.append(0)
+        continue
+    first = next(i for i, level in enumerate(levels) if level)
+    last = max(i for i, level in enumerate(levels) if level)
+    key = (first,) + tuple(levels[first:last + 1])
+    if key not in level_offsets:
+        level_offsets[key] = len(level_data)
+        level_data.extend([first, last - first + 1] + list(levels[first:last + 1]))
+    node_levels.append(level_offsets[key])
+node_first_child.append(next_child)
+if len(level_data) > 0xFFFF:
+    raise SystemExit("level table too large")
+
+# Letter of every node in BFS order, the root itself has none
+node_chars = [0]
+for node in nodes:
+    node_chars.extend(sorted(node["children"]))
+
+
+def print_array(c_type, name, values, per_line=16):
+    print(f"static const {c_type} {name}[{len(values)}] = {{")
+    for i in range(0, len(values), per_line):
+        print("    " + " ".join(f"{v}," for v in values[i : i + per_line]))
+    print("};\n")
+
+
+print(f"""/**
+ * generated by hyphenconvert.py
+ * name: {args.name}
+ * language: {args.language}
+ * patterns: {len(patterns)}
+ * nodes: {len(nodes)}
+ */
+#pragma once
+#include "HyphenationPatterns.h"
+""")
+
+print(f"static const HyphenationLetter {args.name}Letters[{len(code_points)}] = {{")
+for cp in sorted(code_points):
+    print(f"    {{ 0x{cp:X}, {code_points[cp]} }}, // {chr(cp)}")
+print("};\n")
+
+print_array("uint8_t", f"{args.name}NodeChars", node_chars)
+print_array("uint16_t", f"{args.name}NodeFirstChild", node_first_child)
+print_array("uint16_t", f"{args.name}NodeLevels", node_levels)
+print_array("uint8_t", f"{args.name}Levels", level_data)
+
+print(f"""static const HyphenationPatterns {args.name} = {{
+    "{args.language}",
+    {args.name}Letters,
+    {len(code_points)},
+    {args.name}NodeChars,
+    {args.name}NodeFirstChild,
+    {args.name}NodeLevels,
+    {args.name}Levels,
+    {len(nodes)},
+    {args.leftmin},
+    {args.rightmin},
+}};""")
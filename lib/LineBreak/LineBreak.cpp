@@ -0,0 +1,43 @@
+#include "LineBreak.h"
+
+#include "LineBreakTable.h"
+
+namespace LineBreak {
+Class classOf(const uint32_t codePoint) {
+  if (codePoint >= LINE_BREAK_CODE_POINT_LIMIT) {
+    return AL;
+  }
+  const uint32_t block = lineBreakStage1[codePoint >> LINE_BREAK_BLOCK_BITS];
+  const uint32_t index = (block << (LINE_BREAK_BLOCK_BITS - 1)) | ((codePoint & 0xFF) >> 1);
+  const uint8_t packed = lineBreakStage2[index];
+  return static_cast<Class>(codePoint & 1 ? packed >> 4 : packed & 0x0F);
+}
+
+bool isBreakAllowed(const Class before, const Class after) {
+  // Rule numbers are those of UAX #14
+  if (before == ZW) return true;                                                     // LB8
+  if (after == CM || after == ZW) return false;                                      // LB9, LB7
+  if (before == GL || after == GL) return false;                                     // LB11, LB12
+  if (after == CL || after == CP || after == EX || after == IS) return false;        // LB13
+  if (before == OP) return false;                                                    // LB14
+  if (before == QU || after == QU) return false;                                     // LB19
+  if (after == BA || after == NS) return false;                                      // LB21
+  if (before == B2 && after == B2) return false;                                     // LB17
+  if ((before == PR && after == ID) || (before == ID && after == PO)) return false;  // LB23a
+  if (before == AL && after == OP) return false;                                     // LB30
+
+  // What is left only breaks next to ideographs, dashes and closing punctuation, UAX #14 keeps letters, numbers and
+  // the punctuation around them together (LB22 - LB30)
+  switch (before) {
+    case ID:
+    case NS:
+    case CL:
+    case EX:
+    case B2:
+    case BA:
+      return true;
+    default:
+      return after == ID || after == OP || after == B2;
+  }
+}
+}  // namespace LineBreak
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Line break opportunities inside text that has no spaces, following a subset of the Unicode line breaking algorithm
+ * (UAX #14).
+ *
+ * Chinese and Japanese can be broken between almost any two characters, except before closing punctuation and
+ * small kana or after opening punctuation. Text in other scripts only gets break opportunities around em dashes,
+ * zero width spaces and the like, so words stay whole. Classes come from a two stage table generated by
+ * scripts/linebreakconvert.py, which lists the classes kept and how the others are merged into them.
+ */
+namespace LineBreak {
+enum Class : uint8_t {
+  AL,  // Alphabetic and anything unlisted, never broken between
+  ID,  // Ideographic, breaks on either side
+  NS,  // Nonstarter (small kana, iteration marks, ...)
+  OP,  // Opening punctuation
+  CL,  // Closing punctuation
+  CP,  // Closing parenthesis
+  EX,  // Exclamation and question marks
+  IS,  // Infix separator (comma, period, colon, ...)
+  QU,  // Ambiguous quotation
+  B2,  // Em dash, break opportunity before and after
+  BA,  // Break after (en dash, ideographic space, ...)
+  ZW,  // Zero width space
+  GL,  // Non breaking (no-break space, word joiner)
+  PR,  // Prefix (currency signs)
+  PO,  // Postfix (percent, degree, ...)
+  CM,  // Combining mark, takes the class of the character it is attached to
+};
+
+Class classOf(uint32_t codePoint);
+
+// Whether a line may be broken between two characters of these classes that have no space between them
+bool isBreakAllowed(Class before, Class after);
+
+// Only characters from U+2000 up (UTF-8 lead byte 0xE2 and above) can create a break opportunity, text without them
+// never needs to be looked at
+inline bool mayHaveBreaks(const char* s, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (static_cast<uint8_t>(s[i]) >= 0xE2) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace LineBreak
@@ -0,0 +1,254 @@
+#!python3
+
+# Generates the two stage line break class table read by LineBreak.cpp.
+#
+# The classes are a subset of those of UAX #14 (https://www.unicode.org/reports/tr14/), assigned from
+# LineBreak.txt for the characters that matter when breaking text without spaces. Classes that behave the same
+# for our purposes are merged: CJ, H2 and H3 become NS or AL, SY and IN become IS, WJ becomes GL, ZWJ becomes CM and
+# everything without a listed class is AL. Scripts that need a dictionary to break (SA: Thai, Khmer, ...) are left as
+# AL, as is Hangul, which separates words with spaces.
+
+CLASSES = ["AL", "ID", "NS", "OP", "CL", "CP", "EX", "IS", "QU", "B2", "BA", "ZW", "GL", "PR", "PO", "CM"]
+
+# (first, last, class), later entries override earlier ones
+RANGES = [
+    # ASCII
+    (0x21, 0x21, "EX"),
+    (0x22, 0x22, "QU"),
+    (0x24, 0x24, "PR"),
+    (0x25, 0x25, "PO"),
+    (0x27, 0x27, "QU"),
+    (0x28, 0x28, "OP"),
+    (0x29, 0x29, "CP"),
+    (0x2B, 0x2B, "PR"),
+    (0x2C, 0x2C, "IS"),
+    (0x2E, 0x2F, "IS"),
+    (0x3A, 0x3B, "IS"),
+    (0x3F, 0x3F, "EX"),
+    (0x5B, 0x5B, "OP"),
+    (0x5C, 0x5C, "PR"),
+    (0x5D, 0x5D, "CP"),
+    (0x7B, 0x7B, "OP"),
+    (0x7D, 0x7D, "CL"),
+    # Latin-1
+    (0xA0, 0xA0, "GL"),
+    (0xA1, 0xA1, "OP"),
+    (0xA2, 0xA2, "PO"),
+    (0xA3, 0xA5, "PR"),
+    (0xAB, 0xAB, "QU"),
+    (0xB0, 0xB0, "PO"),
+    (0xB1, 0xB1, "PR"),
+    (0xBB, 0xBB, "QU"),
+    (0xBF, 0xBF, "OP"),
+    # Combining marks
+    (0x300, 0x36F, "CM"),
+    (0x1AB0, 0x1AFF, "CM"),
+    (0x1DC0, 0x1DFF, "CM"),
+    (0x20D0, 0x20FF, "CM"),
+    (0xFE00, 0xFE0F, "CM"),
+    (0xFE20, 0xFE2F, "CM"),
+    # General punctuation
+    (0x2000, 0x2006, "BA"),
+    (0x2007, 0x2007, "GL"),
+    (0x2008, 0x200A, "BA"),
+    (0x200B, 0x200B, "ZW"),
+    (0x200C, 0x200D, "CM"),
+    (0x2010, 0x2010, "BA"),
+    (0x2011, 0x2011, "GL"),
+    (0x2012, 0x2013, "BA"),
+    (0x2014, 0x2014, "B2"),
+    (0x2018, 0x2018, "OP"),
+    (0x2019, 0x2019, "QU"),
+    (0x201A, 0x201A, "OP"),
+    (0x201B, 0x201B, "QU"),
+    (0x201C, 0x201C, "OP"),
+    (0x201D, 0x201D, "CL"),
+    (0x201E, 0x201E, "OP"),
+    (0x201F, 0x201F, "QU"),
+    (0x2024, 0x2026, "IS"),
+    (0x202F, 0x202F, "GL"),
+    (0x2030, 0x2037, "PO"),
+    (0x2039, 0x203A, "QU"),
+    (0x203C, 0x203D, "NS"),
+    (0x2044, 0x2044, "IS"),
+    (0x2047, 0x2049, "NS"),
+    (0x2060, 0x2060, "GL"),
+    (0x20A0, 0x20BF, "PR"),
+    (0x2E3A, 0x2E3B, "B2"),
+    # CJK radicals, Kangxi radicals, ideographic description characters
+    (0x2E80, 0x2FFF, "ID"),
+    # CJK symbols and punctuation
+    (0x3000, 0x3000, "BA"),
+    (0x3001, 0x3002, "CL"),
+    (0x3003, 0x3004, "ID"),
+    (0x3005, 0x3005, "NS"),
+    (0x3006, 0x3007, "ID"),
+    (0x3008, 0x3008, "OP"),
+    (0x3009, 0x3009, "CL"),
+    (0x300A, 0x300A, "OP"),
+    (0x300B, 0x300B, "CL"),
+    (0x300C, 0x300C, "OP"),
+    (0x300D, 0x300D, "CL"),
+    (0x300E, 0x300E, "OP"),
+    (0x300F, 0x300F, "CL"),
+    (0x3010, 0x3010, "OP"),
+    (0x3011, 0x3011, "CL"),
+    (0x3012, 0x3013, "ID"),
+    (0x3014, 0x3014, "OP"),
+    (0x3015, 0x3015, "CL"),
+    (0x3016, 0x3016, "OP"),
+    (0x3017, 0x3017, "CL"),
+    (0x3018, 0x3018, "OP"),
+    (0x3019, 0x3019, "CL"),
+    (0x301A, 0x301A, "OP"),
+    (0x301B, 0x301B, "CL"),
+    (0x301C, 0x301C, "NS"),
+    (0x301D, 0x301D, "OP"),
+    (0x301E, 0x301F, "CL"),
+    (0x3020, 0x303A, "ID"),
+    (0x303B, 0x303C, "NS"),
+    (0x303D, 0x303F, "ID"),
+    # Hiragana, small kana are NS (CJ in UAX #14, strict line breaking)
+    (0x3040, 0x309F, "ID"),
+    (0x3041, 0x3041, "NS"),
+    (0x3043, 0x3043, "NS"),
+    (0x3045, 0x3045, "NS"),
+    (0x3047, 0x3047, "NS"),
+    (0x3049, 0x3049, "NS"),
+    (0x3063, 0x3063, "NS"),
+    (0x3083, 0x3083, "NS"),
+    (0x3085, 0x3085, "NS"),
+    (0x3087, 0x3087, "NS"),
+    (0x308E, 0x308E, "NS"),
+    (0x3095, 0x3096, "NS"),
+    (0x3099, 0x309A, "CM"),
+    (0x309B, 0x309E, "NS"),
+    # Katakana
+    (0x30A0, 0x30A0, "NS"),
+    (0x30A1, 0x30FF, "ID"),
+    (0x30A1, 0x30A1, "NS"),
+    (0x30A3, 0x30A3, "NS"),
+    (0x30A5, 0x30A5, "NS"),
+    (0x30A7, 0x30A7, "NS"),
+    (0x30A9, 0x30A9, "NS"),
+    (0x30C3, 0x30C3, "NS"),
+    (0x30E3, 0x30E3, "NS"),
+    (0x30E5, 0x30E5, "NS"),
+    (0x30E7, 0x30E7, "NS"),
+    (0x30EE, 0x30EE, "NS"),
+    (0x30F5, 0x30F6, "NS"),
+    (0x30FB, 0x30FE, "NS"),
+    # Bopomofo, Hangul compatibility jamo, Kanbun, CJK strokes, enclosed and compatibility CJK
+    (0x3100, 0x31EF, "ID"),
+    (0x31F0, 0x31FF, "NS"),
+    (0x3200, 0x33FF, "ID"),
+    # CJK unified ideographs and extension A, Yi
+    (0x3400, 0x4DBF, "ID"),
+    (0x4E00, 0x9FFF, "ID"),
+    (0xA000, 0xA4CF, "ID"),
+    # CJK compatibility ideographs and forms
+    (0xF900, 0xFAFF, "ID"),
+    (0xFE10, 0xFE19, "ID"),
+    (0xFE30, 0xFE4F, "ID"),
+    (0xFE50, 0xFE52, "CL"),
+    (0xFE54, 0xFE55, "NS"),
+    (0xFE56, 0xFE57, "EX"),
+    (0xFE59, 0xFE59, "OP"),
+    (0xFE5A, 0xFE5A, "CL"),
+    (0xFE5B, 0xFE5B, "OP"),
+    (0xFE5C, 0xFE5C, "CL"),
+    (0xFE5D, 0xFE5D, "OP"),
+    (0xFE5E, 0xFE5E, "CL"),
+    (0xFEFF, 0xFEFF, "GL"),
+    # Halfwidth and fullwidth forms
+    (0xFF01, 0xFF60, "ID"),
+    (0xFF01, 0xFF01, "EX"),
+    (0xFF04, 0xFF04, "PR"),
+    (0xFF05, 0xFF05, "PO"),
+    (0xFF08, 0xFF08, "OP"),
+    (0xFF09, 0xFF09, "CL"),
+    (0xFF0C, 0xFF0C, "CL"),
+    (0xFF0E, 0xFF0E, "CL"),
+    (0xFF1A, 0xFF1B, "NS"),
+    (0xFF1F, 0xFF1F, "EX"),
+    (0xFF3B, 0xFF3B, "OP"),
+    (0xFF3D, 0xFF3D, "CL"),
+    (0xFF5B, 0xFF5B, "OP"),
+    (0xFF5D, 0xFF5D, "CL"),
+    (0xFF5F, 0xFF5F, "OP"),
+    (0xFF60, 0xFF60, "CL"),
+    (0xFF61, 0xFF61, "CL"),
+    (0xFF62, 0xFF62, "OP"),
+    (0xFF63, 0xFF64, "CL"),
+    (0xFF65, 0xFF65, "NS"),
+    (0xFF66, 0xFF9D, "ID"),
+    (0xFF67, 0xFF70, "NS"),
+    (0xFF9E, 0xFF9F, "NS"),
+    (0xFFE0, 0xFFE0, "PO"),
+    (0xFFE1, 0xFFE1, "PR"),
+    (0xFFE2, 0xFFE4, "ID"),
+    (0xFFE5, 0xFFE6, "PR"),
+    # Kana supplement and extensions
+    (0x1AFF0, 0x1B16F, "ID"),
+    # Emoji and pictographs
+    (0x1F000, 0x1F0FF, "ID"),
+    (0x1F200, 0x1F2FF, "ID"),
+    (0x1F300, 0x1F5FF, "ID"),
+    (0x1F3FB, 0x1F3FF, "CM"),
+    (0x1F600, 0x1F64F, "ID"),
+    (0x1F680, 0x1F6FF, "ID"),
+    (0x1F900, 0x1F9FF, "ID"),
+    (0x1FA70, 0x1FAFF, "ID"),
+    # CJK unified ideographs extension B and up
+    (0x20000, 0x2FFFD, "ID"),
+    (0x30000, 0x3FFFD, "ID"),
+]
+
+CODE_POINT_LIMIT = 0x40000
+BLOCK_BITS = 8
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+classes = [0] * CODE_POINT_LIMIT
+for first, last, name in RANGES:
+    for cp in range(first, min(last, CODE_POINT_LIMIT - 1) + 1):
+        classes[cp] = CLASSES.index(name)
+
+# Stage 1 maps each block of 256 code points to one of the distinct blocks in stage 2, which packs two classes a byte
+blocks = []
+block_index = {}
+stage1 = []
+for start in range(0, CODE_POINT_LIMIT, BLOCK_SIZE):
+    block = tuple(classes[start:start + BLOCK_SIZE])
+    if block not in block_index:
+        block_index[block] = len(blocks)
+        blocks.append(block)
+    stage1.append(block_index[block])
+if len(blocks) > 256:
+    raise SystemExit("too many distinct blocks")
+
+stage2 = []
+for block in blocks:
+    for i in range(0, BLOCK_SIZE, 2):
+        stage2.append(block[i] | (block[i + 1] << 4))
+
+
+def print_array(name, values, per_line=16):
+    print(f"static const uint8_t {name}[{len(values)}] = {{")
+    for i in range(0, len(values), per_line):
+        print("    " + " ".join(f"0x{v:02X}," for v in values[i : i + per_line]))
+    print("};\n")
+
+
+print(f"""/**
+ * generated by linebreakconvert.py
+ * code points: 0x0 - 0x{CODE_POINT_LIMIT - 1:X}
+ * blocks: {len(blocks)}
+ */
+#pragma once
+#include <cstdint>
+
+static constexpr uint32_t LINE_BREAK_CODE_POINT_LIMIT = 0x{CODE_POINT_LIMIT:X};
+static constexpr uint32_t LINE_BREAK_BLOCK_BITS = {BLOCK_BITS};
+""")
+print_array("lineBreakStage1", stage1)
+print_array("lineBreakStage2", stage2)
@@ -0,0 +1,194 @@
+#include "GlyphRasterizer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+void GlyphRasterizer::addLine(EdgeList& list, const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1) {
+  list.minX = std::min({list.minX, x0, x1});
+  list.maxX = std::max({list.maxX, x0, x1});
+  list.minY = std::min({list.minY, y0, y1});
+  list.maxY = std::max({list.maxY, y0, y1});
+
+  // Horizontal lines never cross a sample row
+  if (y0 == y1) {
+    return;
+  }
+  const int32_t slope = static_cast<int32_t>((static_cast<int64_t>(x1 - x0) << 16) / (y1 - y0));
+  if (y1 > y0) {
+    list.edges.push_back({x0, y0, y1, slope, 1});
+  } else {
+    list.edges.push_back({x1, y1, y0, slope, -1});
+  }
+}
+
+void GlyphRasterizer::addCurve(EdgeList& list, const int32_t x0, const int32_t y0, const int32_t cx, const int32_t cy,
+                               const int32_t x1, const int32_t y1) {
+  // A quadratic strays from its chord by at most |p0 - 2c + p1| / 8, n lines get that down by n^2. Split until it is
+  // within 1/16 of a pixel.
+  const int32_t dx = std::abs(x0 - 2 * cx + x1);
+  const int32_t dy = std::abs(y0 - 2 * cy + y1);
+  const int32_t deviation = std::max(dx, dy) + std::min(dx, dy) / 2;
+  int segments = 1;
+  while (segments < MAX_CURVE_SEGMENTS && segments * segments * (ONE / 2) < deviation) {
+    segments++;
+  }
+
+  const int64_t n2 = segments * segments;
+  int32_t px = x0, py = y0;
+  for (int i = 1; i <= segments; i++) {
+    const int64_t u = segments - i;
+    const int32_t x = static_cast<int32_t>((u * u * x0 + 2 * u * i * cx + int64_t{i} * i * x1) / n2);
+    const int32_t y = static_cast<int32_t>((u * u * y0 + 2 * u * i * cy + int64_t{i} * i * y1) / n2);
+    addLine(list, px, py, x, y);
+    px = x;
+    py = y;
+  }
+}
+
+void GlyphRasterizer::buildEdges(const TrueTypeFont::Outline& outline, const float scale, EdgeList& list) {
+  const float fixedScale = scale * ONE;
+  size_t start = 0;
+  for (const uint16_t end : outline.contourEnds) {
+    const size_t count = end + 1 - start;
+    if (end < start || count < 2) {
+      start = end + 1;
+      continue;
+    }
+    // 24.8 pixels, y down
+    auto pointX = [&](const size_t i) {
+      return static_cast<int32_t>(std::lround(outline.points[start + i % count].x * fixedScale));
+    };
+    auto pointY = [&](const size_t i) {
+      return static_cast<int32_t>(std::lround(-outline.points[start + i % count].y * fixedScale));
+    };
+    auto onCurve = [&](const size_t i) { return outline.points[start + i % count].onCurve; };
+
+    // Start on an on-curve point, or between the first two control points of a contour without any
+    size_t first = 0;
+    while (first < count && !onCurve(first)) {
+      first++;
+    }
+    int32_t startX, startY;
+    if (first < count) {
+      startX = pointX(first);
+      startY = pointY(first);
+    } else {
+      first = 0;
+      startX = (pointX(0) + pointX(1)) / 2;
+      startY = (pointY(0) + pointY(1)) / 2;
+    }
+
+    // Two control points in a row have an implied on-curve point half way between them
+    int32_t x = startX, y = startY, controlX = 0, controlY = 0;
+    bool haveControl = false;
+    for (size_t k = 1; k <= count; k++) {
+      const int32_t qx = pointX(first + k);
+      const int32_t qy = pointY(first + k);
+      if (onCurve(first + k)) {
+        if (haveControl) {
+          addCurve(list, x, y, controlX, controlY, qx, qy);
+        } else {
+          addLine(list, x, y, qx, qy);
+        }
+        x = qx;
+        y = qy;
+        haveControl = false;
+      } else {
+        if (haveControl) {
+          const int32_t midX = (controlX + qx) / 2;
+          const int32_t midY = (controlY + qy) / 2;
+          addCurve(list, x, y, controlX, controlY, midX, midY);
+          x = midX;
+          y = midY;
+        }
+        controlX = qx;
+        controlY = qy;
+        haveControl = true;
+      }
+    }
+    if (haveControl) {
+      addCurve(list, x, y, controlX, controlY, startX, startY);
+    }
+    start = end + 1;
+  }
+}
+
+bool GlyphRasterizer::rasterize(const TrueTypeFont::Outline& outline, const float scale, Glyph& glyph) {
+  glyph.width = 0;
+  glyph.height = 0;
+  glyph.left = 0;
+  glyph.top = 0;
+  glyph.bitmap.clear();
+
+  const long advance = std::lround(outline.advance * scale);
+  if (advance > 255) {
+    return false;
+  }
+  glyph.advanceX = static_cast<uint8_t>(advance);
+
+  EdgeList list = {{}, INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN};
+  buildEdges(outline, scale, list);
+  if (list.edges.empty()) {
+    return true;
+  }
+
+  // Whole pixels around the outline
+  const int minX = list.minX >> FRACTION_BITS;
+  const int minY = list.minY >> FRACTION_BITS;
+  const int width = ((list.maxX + ONE - 1) >> FRACTION_BITS) - minX;
+  const int height = ((list.maxY + ONE - 1) >> FRACTION_BITS) - minY;
+  if (width <= 0 || height <= 0) {
+    return true;
+  }
+  if (width > 255 || height > 255) {
+    return false;
+  }
+
+  // Number of the 4x4 samples of every pixel inside the outline
+  constexpr int SAMPLE_STEP = ONE / SUBSAMPLES;
+  const int32_t originX = minX * ONE + SAMPLE_STEP / 2;
+  const int columns = width * SUBSAMPLES;
+  std::vector<uint8_t> coverage(width * height, 0);
+  std::vector<Crossing> crossings;
+  for (int row = 0; row < height * SUBSAMPLES; row++) {
+    const int32_t sampleY = minY * ONE + row * SAMPLE_STEP + SAMPLE_STEP / 2;
+    crossings.clear();
+    for (const auto& edge : list.edges) {
+      if (sampleY < edge.top || sampleY >= edge.bottom) {
+        continue;
+      }
+      const int32_t x = edge.x + static_cast<int32_t>((static_cast<int64_t>(sampleY - edge.top) * edge.slope) >> 16);
+      crossings.push_back({x, edge.winding});
+    }
+    std::sort(crossings.begin(), crossings.end(), [](const Crossing& a, const Crossing& b) { return a.x < b.x; });
+
+    uint8_t* pixels = &coverage[(row >> SUBSAMPLE_BITS) * width];
+    int winding = 0;
+    for (size_t i = 0; i + 1 < crossings.size(); i++) {
+      winding += crossings[i].winding;
+      if (winding == 0) {
+        continue;
+      }
+      // Samples whose centers are within the span
+      const int from = std::max(0, (crossings[i].x - originX + SAMPLE_STEP - 1) / SAMPLE_STEP);
+      const int to = std::min(columns, (crossings[i + 1].x - originX + SAMPLE_STEP - 1) / SAMPLE_STEP);
+      for (int column = from; column < to; column++) {
+        pixels[column >> SUBSAMPLE_BITS]++;
+      }
+    }
+  }
+
+  glyph.width = static_cast<uint8_t>(width);
+  glyph.height = static_cast<uint8_t>(height);
+  glyph.left = static_cast<int16_t>(minX);
+  glyph.top = static_cast<int16_t>(-minY);
+  glyph.bitmap.assign((width * height + 3) / 4, 0);
+  for (int i = 0; i < width * height; i++) {
+    // Same thresholds as fontconvert.py on a 4-bit scale
+    const int level = coverage[i] * 15 / (SUBSAMPLES * SUBSAMPLES);
+    const uint8_t value = level >= 12 ? 3 : level >= 8 ? 2 : level >= 4 ? 1 : 0;
+    glyph.bitmap[i / 4] |= value << ((3 - i % 4) * 2);
+  }
+  return true;
+}
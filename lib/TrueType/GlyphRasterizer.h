@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "TrueTypeFont.h"
+
+/**
+ * Scanline rasterizer for TrueType outlines, producing glyphs in the format of the builtin fonts (EpdGlyph metrics
+ * and 2-bit bitmaps, 0 white to 3 black, packed 4 pixels per byte MSB first).
+ *
+ * Quadratic curves are flattened into lines, every pixel is sampled 4x4 with the nonzero winding rule and the coverage
+ * is quantized to 2 bits with the same thresholds fontconvert.py uses. There is no hinting. Past scaling the outline
+ * everything is done in 24.8 fixed point, the ESP32-C3 has no FPU.
+ */
+class GlyphRasterizer {
+ public:
+  struct Glyph {
+    uint8_t width = 0;
+    uint8_t height = 0;
+    uint8_t advanceX = 0;
+    int16_t left = 0;  // Pen position to the left edge of the bitmap
+    int16_t top = 0;   // Baseline to the top edge of the bitmap
+    std::vector<uint8_t> bitmap;
+  };
+
+  // scale is pixels per font unit, false if the glyph doesn't fit the 8-bit glyph metrics
+  static bool rasterize(const TrueTypeFont::Outline& outline, float scale, Glyph& glyph);
+
+ private:
+  static constexpr int FRACTION_BITS = 8;
+  static constexpr int32_t ONE = 1 << FRACTION_BITS;
+  static constexpr int SUBSAMPLE_BITS = 2;
+  static constexpr int SUBSAMPLES = 1 << SUBSAMPLE_BITS;
+  static constexpr int MAX_CURVE_SEGMENTS = 16;
+
+  // Line going down from (x, top) to bottom in 24.8 pixels (y down), slope is dx/dy in 16.16
+  struct Edge {
+    int32_t x, top, bottom;
+    int32_t slope;
+    int8_t winding;
+  };
+  struct Crossing {
+    int32_t x;
+    int8_t winding;
+  };
+  struct EdgeList {
+    std::vector<Edge> edges;
+    int32_t minX, minY, maxX, maxY;
+  };
+
+  static void addLine(EdgeList& list, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+  static void addCurve(EdgeList& list, int32_t x0, int32_t y0, int32_t cx, int32_t cy, int32_t x1, int32_t y1);
+  static void buildEdges(const TrueTypeFont::Outline& outline, float scale, EdgeList& list);
+};
@@ -0,0 +1,542 @@
+#include "TrueTypeFont.h"
+
+#include <Arduino.h>
+
+#include <cstring>
+
+namespace {
+constexpr uint32_t TAG_TRUETYPE = 0x00010000;
+constexpr uint32_t TAG_TRUE = 0x74727565;  // 'true', old Apple fonts
+constexpr uint32_t TAG_OTTO = 0x4F54544F;  // 'OTTO', CFF outlines
+constexpr uint16_t MAX_TABLES = 64;
+constexpr uint16_t MAX_POINTS = 4096;
+
+// Simple glyph flags
+constexpr uint8_t ON_CURVE = 0x01;
+constexpr uint8_t X_SHORT = 0x02;
+constexpr uint8_t Y_SHORT = 0x04;
+constexpr uint8_t REPEAT = 0x08;
+constexpr uint8_t X_SAME_OR_POSITIVE = 0x10;
+constexpr uint8_t Y_SAME_OR_POSITIVE = 0x20;
+
+// Composite glyph flags
+constexpr uint16_t ARGS_ARE_WORDS = 0x0001;
+constexpr uint16_t ARGS_ARE_XY_VALUES = 0x0002;
+constexpr uint16_t HAVE_A_SCALE = 0x0008;
+constexpr uint16_t MORE_COMPONENTS = 0x0020;
+constexpr uint16_t HAVE_AN_X_AND_Y_SCALE = 0x0040;
+constexpr uint16_t HAVE_A_TWO_BY_TWO = 0x0080;
+
+uint16_t u16(const uint8_t* p) { return static_cast<uint16_t>(p[0] << 8 | p[1]); }
+int16_t s16(const uint8_t* p) { return static_cast<int16_t>(u16(p)); }
+uint32_t u32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 | static_cast<uint32_t>(p[2]) << 8 |
+         p[3];
+}
+float f2dot14(const uint8_t* p) { return static_cast<float>(s16(p)) / 16384.0f; }
+}  // namespace
+
+bool TrueTypeFont::readU16(const uint32_t offset, uint16_t& value) const {
+  uint8_t buffer[2];
+  if (!read(offset, buffer, sizeof(buffer))) {
+    return false;
+  }
+  value = u16(buffer);
+  return true;
+}
+
+bool TrueTypeFont::readU32(const uint32_t offset, uint32_t& value) const {
+  uint8_t buffer[4];
+  if (!read(offset, buffer, sizeof(buffer))) {
+    return false;
+  }
+  value = u32(buffer);
+  return true;
+}
+
+bool TrueTypeFont::open(ReadFn readFn) {
+  read = std::move(readFn);
+
+  uint8_t offsetTable[12];
+  if (!read(0, offsetTable, sizeof(offsetTable))) {
+    return false;
+  }
+  const uint32_t version = u32(offsetTable);
+  if (version == TAG_OTTO) {
+    Serial.printf("[%lu] [TTF] CFF outlines are not supported\n", millis());
+    return false;
+  }
+  if (version != TAG_TRUETYPE && version != TAG_TRUE) {
+    Serial.printf("[%lu] [TTF] Not a TrueType font (0x%08x)\n", millis(), version);
+    return false;
+  }
+  const uint16_t numTables = u16(offsetTable + 4);
+  if (numTables == 0 || numTables > MAX_TABLES) {
+    return false;
+  }
+
+  uint32_t headOffset, hheaOffset, maxpOffset, cmapTableOffset, length;
+  if (!findTable(numTables, "head", headOffset, length) || length < 54 ||
+      !findTable(numTables, "hhea", hheaOffset, length) || length < 36 ||
+      !findTable(numTables, "maxp", maxpOffset, length) || length < 6 ||
+      !findTable(numTables, "hmtx", hmtxOffset, length) || !findTable(numTables, "loca", locaOffset, length) ||
+      !findTable(numTables, "glyf", glyfOffset, glyfLength) ||
+      !findTable(numTables, "cmap", cmapTableOffset, length)) {
+    Serial.printf("[%lu] [TTF] Missing required tables\n", millis());
+    return false;
+  }
+
+  uint8_t head[54];
+  uint8_t hhea[36];
+  uint8_t maxp[6];
+  if (!read(headOffset, head, sizeof(head)) || !read(hheaOffset, hhea, sizeof(hhea)) ||
+      !read(maxpOffset, maxp, sizeof(maxp))) {
+    return false;
+  }
+  unitsPerEm = u16(head + 18);
+  const uint16_t macStyle = u16(head + 44);
+  longLoca = s16(head + 50) == 1;
+  ascender = s16(hhea + 4);
+  descender = s16(hhea + 6);
+  lineGap = s16(hhea + 8);
+  numHMetrics = u16(hhea + 34);
+  numGlyphs = u16(maxp + 4);
+  style = (macStyle & 0x01 ? BOLD : REGULAR) | (macStyle & 0x02 ? ITALIC : REGULAR);
+
+  if (unitsPerEm < 16 || unitsPerEm > 16384 || numGlyphs == 0 || numHMetrics == 0 || numHMetrics > numGlyphs) {
+    Serial.printf("[%lu] [TTF] Bad font header\n", millis());
+    return false;
+  }
+
+  if (!selectCmap(cmapTableOffset)) {
+    Serial.printf("[%lu] [TTF] No unicode cmap\n", millis());
+    return false;
+  }
+
+  uint32_t os2Offset;
+  uint16_t weightClass;
+  if (findTable(numTables, "OS/2", os2Offset, length) && length >= 6 && readU16(os2Offset + 4, weightClass) &&
+      weightClass >= 100 && weightClass <= 1000) {
+    weight = weightClass;
+  } else if (style & BOLD) {
+    weight = 700;
+  }
+
+  uint32_t nameOffset;
+  if (findTable(numTables, "name", nameOffset, length)) {
+    readFamilyName(nameOffset, length);
+  }
+  return true;
+}
+
+bool TrueTypeFont::findTable(const uint16_t numTables, const char* tag, uint32_t& offset, uint32_t& length) const {
+  const uint32_t wanted = u32(reinterpret_cast<const uint8_t*>(tag));
+  for (uint16_t i = 0; i < numTables; i++) {
+    uint8_t record[16];
+    if (!read(12 + i * 16, record, sizeof(record))) {
+      return false;
+    }
+    if (u32(record) == wanted) {
+      offset = u32(record + 8);
+      length = u32(record + 12);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TrueTypeFont::selectCmap(const uint32_t offset) {
+  uint16_t count;
+  if (!readU16(offset + 2, count)) {
+    return false;
+  }
+
+  // Prefer the full unicode tables over the BMP ones
+  int bestScore = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t record[8];
+    if (!read(offset + 4 + i * 8, record, sizeof(record))) {
+      return false;
+    }
+    const uint16_t platform = u16(record);
+    const uint16_t encoding = u16(record + 2);
+    const uint32_t subtableOffset = offset + u32(record + 4);
+    uint16_t format;
+    if ((platform != 0 && platform != 3) || !readU16(subtableOffset, format)) {
+      continue;
+    }
+
+    int score = 0;
+    if (format == 12 && (platform == 0 || encoding == 10)) {
+      score = platform == 3 ? 4 : 3;
+    } else if (format == 4 && (platform == 0 || encoding == 1)) {
+      score = platform == 3 ? 2 : 1;
+    }
+    if (score > bestScore) {
+      bestScore = score;
+      cmapOffset = subtableOffset;
+      cmapFormat = format;
+    }
+  }
+  return bestScore > 0;
+}
+
+void TrueTypeFont::readFamilyName(const uint32_t offset, const uint32_t length) {
+  uint8_t header[6];
+  if (length < sizeof(header) || !read(offset, header, sizeof(header))) {
+    return;
+  }
+  const uint16_t count = u16(header + 2);
+  const uint32_t stringsOffset = offset + u16(header + 4);
+
+  // Typographic family (16) groups more styles than the legacy family (1), Windows names are UTF-16
+  int bestScore = 0;
+  uint16_t bestLength = 0;
+  uint32_t bestOffset = 0;
+  bool bestUtf16 = false;
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t record[12];
+    if (!read(offset + 6 + i * 12, record, sizeof(record))) {
+      return;
+    }
+    const uint16_t platform = u16(record);
+    const uint16_t encoding = u16(record + 2);
+    const uint16_t nameId = u16(record + 6);
+    if (nameId != 1 && nameId != 16) {
+      continue;
+    }
+    const bool utf16 = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+    if (!utf16 && !(platform == 1 && encoding == 0)) {
+      continue;
+    }
+    const int score = (nameId == 16 ? 2 : 0) + (utf16 ? 1 : 0);
+    if (score > bestScore) {
+      bestScore = score;
+      bestLength = u16(record + 8);
+      bestOffset = stringsOffset + u16(record + 10);
+      bestUtf16 = utf16;
+    }
+  }
+  if (bestScore == 0 || bestLength == 0 || bestLength > 128) {
+    return;
+  }
+
+  uint8_t name[128];
+  if (!read(bestOffset, name, bestLength)) {
+    return;
+  }
+  familyName.clear();
+  if (!bestUtf16) {
+    familyName.assign(reinterpret_cast<const char*>(name), bestLength);
+    return;
+  }
+  for (uint16_t i = 0; i + 1 < bestLength; i += 2) {
+    const uint16_t c = u16(name + i);
+    if (c < 0x80) {
+      familyName += static_cast<char>(c);
+    } else if (c < 0x800) {
+      familyName += static_cast<char>(0xC0 | c >> 6);
+      familyName += static_cast<char>(0x80 | (c & 0x3F));
+    } else if (c < 0xD800 || c > 0xDFFF) {
+      familyName += static_cast<char>(0xE0 | c >> 12);
+      familyName += static_cast<char>(0x80 | (c >> 6 & 0x3F));
+      familyName += static_cast<char>(0x80 | (c & 0x3F));
+    }
+  }
+}
+
+uint16_t TrueTypeFont::getGlyphIndex(const uint32_t codepoint) const {
+  const uint16_t glyphIndex = cmapFormat == 12 ? glyphIndexFormat12(codepoint) : glyphIndexFormat4(codepoint);
+  return glyphIndex < numGlyphs ? glyphIndex : 0;
+}
+
+uint16_t TrueTypeFont::glyphIndexFormat4(const uint32_t codepoint) const {
+  uint16_t segCountX2;
+  if (codepoint > 0xFFFF || !readU16(cmapOffset + 6, segCountX2) || segCountX2 < 2) {
+    return 0;
+  }
+  const uint32_t endCodes = cmapOffset + 14;
+  const uint32_t startCodes = endCodes + segCountX2 + 2;
+  const uint32_t idDeltas = startCodes + segCountX2;
+  const uint32_t idRangeOffsets = idDeltas + segCountX2;
+
+  // First segment ending at or after the codepoint
+  uint16_t low = 0;
+  uint16_t high = segCountX2 / 2;
+  while (low < high) {
+    const uint16_t mid = (low + high) / 2;
+    uint16_t endCode;
+    if (!readU16(endCodes + mid * 2, endCode)) {
+      return 0;
+    }
+    if (endCode < codepoint) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == segCountX2 / 2) {
+    return 0;
+  }
+
+  uint16_t startCode, idDelta, idRangeOffset;
+  if (!readU16(startCodes + low * 2, startCode) || startCode > codepoint ||
+      !readU16(idDeltas + low * 2, idDelta) || !readU16(idRangeOffsets + low * 2, idRangeOffset)) {
+    return 0;
+  }
+  if (idRangeOffset == 0) {
+    return static_cast<uint16_t>(codepoint + idDelta);
+  }
+  uint16_t glyphIndex;
+  if (!readU16(idRangeOffsets + low * 2 + idRangeOffset + (codepoint - startCode) * 2, glyphIndex) ||
+      glyphIndex == 0) {
+    return 0;
+  }
+  return static_cast<uint16_t>(glyphIndex + idDelta);
+}
+
+uint16_t TrueTypeFont::glyphIndexFormat12(const uint32_t codepoint) const {
+  uint32_t numGroups;
+  if (!readU32(cmapOffset + 12, numGroups)) {
+    return 0;
+  }
+  uint32_t low = 0;
+  uint32_t high = numGroups;
+  while (low < high) {
+    const uint32_t mid = low + (high - low) / 2;
+    uint8_t group[12];
+    if (!read(cmapOffset + 16 + mid * 12, group, sizeof(group))) {
+      return 0;
+    }
+    if (codepoint < u32(group)) {
+      high = mid;
+    } else if (codepoint > u32(group + 4)) {
+      low = mid + 1;
+    } else {
+      const uint32_t glyphIndex = u32(group + 8) + (codepoint - u32(group));
+      return glyphIndex <= 0xFFFF ? glyphIndex : 0;
+    }
+  }
+  return 0;
+}
+
+bool TrueTypeFont::glyphRange(const uint16_t glyphIndex, uint32_t& offset, uint32_t& length) const {
+  uint32_t start, end;
+  if (longLoca) {
+    uint8_t entries[8];
+    if (!read(locaOffset + glyphIndex * 4, entries, sizeof(entries))) {
+      return false;
+    }
+    start = u32(entries);
+    end = u32(entries + 4);
+  } else {
+    uint8_t entries[4];
+    if (!read(locaOffset + glyphIndex * 2, entries, sizeof(entries))) {
+      return false;
+    }
+    start = u16(entries) * 2u;
+    end = u16(entries + 2) * 2u;
+  }
+  if (end < start || end > glyfLength) {
+    return false;
+  }
+  offset = glyfOffset + start;
+  length = end - start;
+  return true;
+}
+
+uint16_t TrueTypeFont::advanceWidth(const uint16_t glyphIndex) const {
+  const uint16_t metric = glyphIndex < numHMetrics ? glyphIndex : numHMetrics - 1;
+  uint16_t advance = 0;
+  readU16(hmtxOffset + metric * 4, advance);
+  return advance;
+}
+
+bool TrueTypeFont::loadOutline(const uint16_t glyphIndex, Outline& outline) const {
+  static constexpr float identity[6] = {1, 0, 0, 1, 0, 0};
+  outline.points.clear();
+  outline.contourEnds.clear();
+  outline.advance = advanceWidth(glyphIndex);
+  return appendGlyph(glyphIndex, identity, 0, outline);
+}
+
+// transform maps glyph coordinates to the outline, x' = t[0] x + t[2] y + t[4] and y' = t[1] x + t[3] y + t[5]
+bool TrueTypeFont::appendGlyph(const uint16_t glyphIndex, const float transform[6], const int depth,
+                               Outline& outline) const {
+  uint32_t offset, length;
+  if (!glyphRange(glyphIndex, offset, length)) {
+    return false;
+  }
+  if (length == 0) {
+    // No outline, like a space
+    return true;
+  }
+  if (length < 10 || length > MAX_GLYPH_SIZE) {
+    return false;
+  }
+
+  std::vector<uint8_t> data(length);
+  if (!read(offset, data.data(), length)) {
+    return false;
+  }
+  const int16_t numContours = s16(data.data());
+  if (numContours >= 0) {
+    return appendSimpleGlyph(data.data(), length, numContours, transform, outline);
+  }
+  if (depth >= MAX_COMPONENT_DEPTH) {
+    return false;
+  }
+
+  size_t pos = 10;
+  uint16_t flags;
+  do {
+    if (pos + 4 > length) {
+      return false;
+    }
+    flags = u16(&data[pos]);
+    const uint16_t componentIndex = u16(&data[pos + 2]);
+    pos += 4;
+
+    float dx = 0, dy = 0;
+    if (flags & ARGS_ARE_WORDS) {
+      if (pos + 4 > length) {
+        return false;
+      }
+      dx = s16(&data[pos]);
+      dy = s16(&data[pos + 2]);
+      pos += 4;
+    } else {
+      if (pos + 2 > length) {
+        return false;
+      }
+      dx = static_cast<int8_t>(data[pos]);
+      dy = static_cast<int8_t>(data[pos + 1]);
+      pos += 2;
+    }
+    if (!(flags & ARGS_ARE_XY_VALUES)) {
+      // Components aligned by matching points are rare enough to place without an offset
+      dx = dy = 0;
+    }
+
+    float a = 1, b = 0, c = 0, d = 1;
+    if (flags & HAVE_A_SCALE) {
+      if (pos + 2 > length) {
+        return false;
+      }
+      a = d = f2dot14(&data[pos]);
+      pos += 2;
+    } else if (flags & HAVE_AN_X_AND_Y_SCALE) {
+      if (pos + 4 > length) {
+        return false;
+      }
+      a = f2dot14(&data[pos]);
+      d = f2dot14(&data[pos + 2]);
+      pos += 4;
+    } else if (flags & HAVE_A_TWO_BY_TWO) {
+      if (pos + 8 > length) {
+        return false;
+      }
+      a = f2dot14(&data[pos]);
+      b = f2dot14(&data[pos + 2]);
+      c = f2dot14(&data[pos + 4]);
+      d = f2dot14(&data[pos + 6]);
+      pos += 8;
+    }
+
+    const float* t = transform;
+    const float combined[6] = {t[0] * a + t[2] * b,  t[1] * a + t[3] * b,  t[0] * c + t[2] * d,
+                               t[1] * c + t[3] * d,  t[0] * dx + t[2] * dy + t[4], t[1] * dx + t[3] * dy + t[5]};
+    if (!appendGlyph(componentIndex, combined, depth + 1, outline)) {
+      return false;
+    }
+  } while (flags & MORE_COMPONENTS);
+  return true;
+}
+
+bool TrueTypeFont::appendSimpleGlyph(const uint8_t* data, const size_t size, const int16_t numContours,
+                                     const float transform[6], Outline& outline) {
+  if (numContours == 0) {
+    return true;
+  }
+  size_t pos = 10;
+  if (pos + numContours * 2 + 2 > size) {
+    return false;
+  }
+  const size_t firstPoint = outline.points.size();
+  const uint16_t numPoints = u16(data + pos + (numContours - 1) * 2) + 1;
+  if (numPoints > MAX_POINTS || firstPoint + numPoints > MAX_POINTS) {
+    return false;
+  }
+  uint16_t previousEnd = 0;
+  for (int16_t i = 0; i < numContours; i++) {
+    const uint16_t end = u16(data + pos + i * 2);
+    if (end >= numPoints || (i > 0 && end < previousEnd)) {
+      return false;
+    }
+    outline.contourEnds.push_back(static_cast<uint16_t>(firstPoint + end));
+    previousEnd = end;
+  }
+  pos += numContours * 2;
+  pos += 2 + u16(data + pos);  // Skip the hinting instructions
+
+  // Flags, with runs of the same flag stored as a count
+  std::vector<uint8_t> flags(numPoints);
+  for (uint16_t i = 0; i < numPoints;) {
+    if (pos >= size) {
+      return false;
+    }
+    const uint8_t flag = data[pos++];
+    flags[i++] = flag;
+    if (flag & REPEAT) {
+      if (pos >= size) {
+        return false;
+      }
+      for (uint8_t repeat = data[pos++]; repeat > 0 && i < numPoints; repeat--) {
+        flags[i++] = flag;
+      }
+    }
+  }
+
+  // Coordinates are deltas from the previous point, x for all points then y
+  std::vector<int16_t> xs(numPoints);
+  int16_t value = 0;
+  for (uint16_t i = 0; i < numPoints; i++) {
+    if (flags[i] & X_SHORT) {
+      if (pos >= size) {
+        return false;
+      }
+      value += flags[i] & X_SAME_OR_POSITIVE ? data[pos] : -data[pos];
+      pos++;
+    } else if (!(flags[i] & X_SAME_OR_POSITIVE)) {
+      if (pos + 2 > size) {
+        return false;
+      }
+      value += s16(data + pos);
+      pos += 2;
+    }
+    xs[i] = value;
+  }
+
+  value = 0;
+  outline.points.reserve(firstPoint + numPoints);
+  for (uint16_t i = 0; i < numPoints; i++) {
+    if (flags[i] & Y_SHORT) {
+      if (pos >= size) {
+        return false;
+      }
+      value += flags[i] & Y_SAME_OR_POSITIVE ? data[pos] : -data[pos];
+      pos++;
+    } else if (!(flags[i] & Y_SAME_OR_POSITIVE)) {
+      if (pos + 2 > size) {
+        return false;
+      }
+      value += s16(data + pos);
+      pos += 2;
+    }
+    const float x = xs[i];
+    const float y = value;
+    outline.points.push_back({transform[0] * x + transform[2] * y + transform[4],
+                              transform[1] * x + transform[3] * y + transform[5], (flags[i] & ON_CURVE) != 0});
+  }
+  return true;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Reader for the outlines and metrics of a TrueType font (sfnt with glyf outlines), just enough to rasterize glyphs:
+ * head, hhea, hmtx, maxp, cmap (formats 4 and 12), loca, glyf and the family name from name.
+ *
+ * Tables are read through a read function as they are needed rather than loaded, so a font extracted to the SD card
+ * costs a few dozen bytes of RAM. OpenType fonts with CFF outlines, and fonts that don't parse (such as obfuscated
+ * EPUB fonts), are rejected by open().
+ */
+class TrueTypeFont {
+ public:
+  // Reads size bytes at offset into buffer, false if they are not all there
+  using ReadFn = std::function<bool(uint32_t offset, void* buffer, size_t size)>;
+
+  // Bit flags from head.macStyle, REGULAR/BOLD/ITALIC/BOLD_ITALIC line up with EpdFontFamily::Style
+  enum Style : uint8_t { REGULAR = 0, BOLD = 1, ITALIC = 2, BOLD_ITALIC = 3 };
+
+  struct Point {
+    float x;
+    float y;
+    bool onCurve;
+  };
+
+  // Glyph outline in font units, y up
+  struct Outline {
+    std::vector<Point> points;
+    // Index of the last point of every contour
+    std::vector<uint16_t> contourEnds;
+    uint16_t advance = 0;
+  };
+
+  bool open(ReadFn readFn);
+
+  uint16_t getUnitsPerEm() const { return unitsPerEm; }
+  int16_t getAscender() const { return ascender; }
+  int16_t getDescender() const { return descender; }
+  int16_t getLineGap() const { return lineGap; }
+  uint8_t getStyle() const { return style; }
+  // OS/2 usWeightClass, 400 for regular and 700 for bold
+  uint16_t getWeight() const { return weight; }
+  const std::string& getFamilyName() const { return familyName; }
+
+  // Glyph index of a codepoint, 0 (the missing glyph) if the font doesn't map it
+  uint16_t getGlyphIndex(uint32_t codepoint) const;
+  bool loadOutline(uint16_t glyphIndex, Outline& outline) const;
+
+ private:
+  static constexpr int MAX_COMPONENT_DEPTH = 4;
+  // Glyph descriptions are read into RAM to be parsed, anything larger is treated as broken
+  static constexpr uint32_t MAX_GLYPH_SIZE = 16 * 1024;
+
+  ReadFn read;
+  uint16_t unitsPerEm = 0;
+  int16_t ascender = 0;
+  int16_t descender = 0;
+  int16_t lineGap = 0;
+  uint16_t numGlyphs = 0;
+  uint16_t numHMetrics = 0;
+  bool longLoca = false;
+  uint8_t style = REGULAR;
+  uint16_t weight = 400;
+  std::string familyName;
+
+  uint32_t cmapOffset = 0;
+  uint16_t cmapFormat = 0;
+  uint32_t locaOffset = 0;
+  uint32_t glyfOffset = 0;
+  uint32_t glyfLength = 0;
+  uint32_t hmtxOffset = 0;
+
+  bool readU16(uint32_t offset, uint16_t& value) const;
+  bool readU32(uint32_t offset, uint32_t& value) const;
+  bool findTable(uint16_t numTables, const char* tag, uint32_t& offset, uint32_t& length) const;
+  bool selectCmap(uint32_t offset);
+  void readFamilyName(uint32_t offset, uint32_t length);
+
+  uint16_t glyphIndexFormat4(uint32_t codepoint) const;
+  uint16_t glyphIndexFormat12(uint32_t codepoint) const;
+  bool glyphRange(uint16_t glyphIndex, uint32_t& offset, uint32_t& length) const;
+  uint16_t advanceWidth(uint16_t glyphIndex) const;
+  bool appendGlyph(uint16_t glyphIndex, const float transform[6], int depth, Outline& outline) const;
+  static bool appendSimpleGlyph(const uint8_t* data, size_t size, int16_t numContours, const float transform[6],
+                                Outline& outline);
+};
@@ -0,0 +1,577 @@
+#include "Inflater.h"
+
+#include <HardwareSerial.h>
+
+namespace {
+// Table entry layout
+// bits 0-3   bits taken by the code (both codes for a literal pair), or the root bits for a subtable pointer
+// bits 4-7   extra bits of a length or distance, or index bits of a subtable
+// bits 8-10  entry type
+// bits 16-31 literal (pair: first in 16-23, second in 24-31), length/distance base or subtable offset
+enum EntryType : uint32_t { LITERAL = 0, LITERAL_PAIR = 1, BASE = 2, SUBTABLE = 3, END_OF_BLOCK = 4, INVALID = 5 };
+
+constexpr uint32_t makeEntry(const EntryType type, const uint32_t length, const uint32_t extra, const uint32_t value) {
+  return length | extra << 4 | static_cast<uint32_t>(type) << 8 | value << 16;
+}
+constexpr uint32_t entryLength(const uint32_t entry) { return entry & 0xF; }
+constexpr uint32_t entryExtra(const uint32_t entry) { return (entry >> 4) & 0xF; }
+constexpr uint32_t entryType(const uint32_t entry) { return (entry >> 8) & 0x7; }
+constexpr uint32_t entryValue(const uint32_t entry) { return entry >> 16; }
+
+constexpr int MAX_CODE_LENGTH = 15;
+constexpr int MAX_SYMBOLS = 288;
+constexpr int LITLEN_SYMBOLS = 286;
+constexpr int DIST_SYMBOLS = 30;
+constexpr int PRECODE_SYMBOLS = 19;
+
+constexpr uint16_t LENGTH_BASE[] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr uint8_t LENGTH_EXTRA[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                    2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr uint16_t DIST_BASE[] = {1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
+                                  33,   49,   65,   97,   129,  193,  257,  385,   513,   769,
+                                  1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr uint8_t DIST_EXTRA[] = {0, 0, 0, 0, 1, 1, 2, 2, 3,  3,  4,  4,  5,  5,  6,
+                                  6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+constexpr uint8_t PRECODE_ORDER[PRECODE_SYMBOLS] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+uint32_t litlenEntry(const int symbol) {
+  if (symbol < 256) return makeEntry(LITERAL, 0, 0, symbol);
+  if (symbol == 256) return makeEntry(END_OF_BLOCK, 0, 0, 0);
+  if (symbol < 257 + static_cast<int>(sizeof(LENGTH_BASE) / sizeof(LENGTH_BASE[0]))) {
+    return makeEntry(BASE, 0, LENGTH_EXTRA[symbol - 257], LENGTH_BASE[symbol - 257]);
+  }
+  return makeEntry(INVALID, 0, 0, 0);
+}
+
+uint32_t distEntry(const int symbol) {
+  if (symbol < DIST_SYMBOLS) return makeEntry(BASE, 0, DIST_EXTRA[symbol], DIST_BASE[symbol]);
+  return makeEntry(INVALID, 0, 0, 0);
+}
+
+uint32_t precodeEntry(const int symbol) { return makeEntry(BASE, 0, 0, symbol); }
+
+uint32_t reverseBits(uint32_t code, const int length) {
+  uint32_t reversed = 0;
+  for (int i = 0; i < length; i++) {
+    reversed = reversed << 1 | (code & 1);
+    code >>= 1;
+  }
+  return reversed;
+}
+
+// Build the lookup table of a canonical Huffman code, codes longer than tableBits go to subtables after the root
+// table. Incomplete codes are accepted, their unused entries decode as INVALID.
+bool buildTable(uint32_t* table, const size_t capacity, const int tableBits, const uint8_t* lengths, const int count,
+                uint32_t (*symbolEntry)(int)) {
+  uint16_t lengthCount[MAX_CODE_LENGTH + 1] = {};
+  for (int symbol = 0; symbol < count; symbol++) {
+    lengthCount[lengths[symbol]]++;
+  }
+  lengthCount[0] = 0;
+
+  int left = 1;
+  for (int length = 1; length <= MAX_CODE_LENGTH; length++) {
+    left = (left << 1) - lengthCount[length];
+    if (left < 0) {
+      return false;  // Over-subscribed
+    }
+  }
+
+  // Symbols sorted by code length, then by value, which is the order canonical codes are assigned in
+  uint16_t offsets[MAX_CODE_LENGTH + 2] = {};
+  for (int length = 1; length <= MAX_CODE_LENGTH; length++) {
+    offsets[length + 1] = offsets[length] + lengthCount[length];
+  }
+  uint16_t sorted[MAX_SYMBOLS];
+  for (int symbol = 0; symbol < count; symbol++) {
+    if (lengths[symbol]) sorted[offsets[lengths[symbol]]++] = symbol;
+  }
+  const int coded = offsets[MAX_CODE_LENGTH + 1];
+
+  const size_t rootSize = size_t{1} << tableBits;
+  const uint32_t invalid = makeEntry(INVALID, 0, 0, 0);
+  for (size_t i = 0; i < rootSize; i++) {
+    table[i] = invalid;
+  }
+
+  size_t used = rootSize;
+  uint32_t subPrefix = UINT32_MAX;
+  size_t subOffset = 0;
+  int subBits = 0;
+  uint32_t code = 0;
+  for (int i = 0; i < coded; i++) {
+    const int symbol = sorted[i];
+    const int length = lengths[symbol];
+    const uint32_t reversed = reverseBits(code, length);
+    const uint32_t entry = symbolEntry(symbol);
+
+    if (length <= tableBits) {
+      for (size_t index = reversed; index < rootSize; index += size_t{1} << length) {
+        table[index] = entry | length;
+      }
+    } else {
+      const uint32_t prefix = reversed & (rootSize - 1);
+      if (prefix != subPrefix) {
+        // Make the subtable just big enough for the codes left that start with this prefix
+        subBits = length - tableBits;
+        int room = 1 << subBits;
+        while (subBits + tableBits < MAX_CODE_LENGTH) {
+          room -= lengthCount[subBits + tableBits];
+          if (room <= 0) break;
+          subBits++;
+          room <<= 1;
+        }
+        if (used + (size_t{1} << subBits) > capacity) {
+          return false;
+        }
+        subOffset = used;
+        used += size_t{1} << subBits;
+        for (size_t index = 0; index < (size_t{1} << subBits); index++) {
+          table[subOffset + index] = invalid;
+        }
+        table[prefix] = makeEntry(SUBTABLE, tableBits, subBits, subOffset);
+        subPrefix = prefix;
+      }
+      for (size_t index = reversed >> tableBits; index < (size_t{1} << subBits);
+           index += size_t{1} << (length - tableBits)) {
+        table[subOffset + index] = entry | (length - tableBits);
+      }
+    }
+
+    lengthCount[length]--;
+    code++;
+    if (i + 1 < coded) {
+      code <<= lengths[sorted[i + 1]] - length;
+    }
+  }
+  return true;
+}
+
+// Merge root entries for two literals whose codes fit the root bits together
+void pairLiterals(uint32_t* table, const int tableBits) {
+  // Walking down leaves the entries looked up (at lower indices) untouched until they are merged themselves
+  for (int index = (1 << tableBits) - 1; index >= 0; index--) {
+    const uint32_t first = table[index];
+    if (entryType(first) != LITERAL) continue;
+    const uint32_t firstLength = entryLength(first);
+    const uint32_t second = table[index >> firstLength];
+    if (entryType(second) != LITERAL || firstLength + entryLength(second) > static_cast<uint32_t>(tableBits)) continue;
+    table[index] = makeEntry(LITERAL_PAIR, firstLength + entryLength(second), 0,
+                             entryValue(first) | entryValue(second) << 8);
+  }
+}
+}  // namespace
+
+bool Inflater::inflateToBuffer(const uint8_t* input, const size_t inputSize, uint8_t* output,
+                               const size_t outputSize) {
+  read = nullptr;
+  inputBuffer = nullptr;
+  inputBufferSize = 0;
+  in = input;
+  inEnd = input + inputSize;
+  window = output;
+  windowEnd = output + outputSize;
+  sink = nullptr;
+  if (!inflate()) {
+    return false;
+  }
+  if (out != windowEnd) {
+    Serial.printf("[%lu] [INF] Inflated %zu bytes, expected %zu\n", millis(), static_cast<size_t>(out - window),
+                  outputSize);
+    return false;
+  }
+  return true;
+}
+
+bool Inflater::inflateToStream(const ReadFn& read, uint8_t* inputBuffer, const size_t inputBufferSize,
+                               uint8_t* window, Print& out) {
+  this->read = &read;
+  this->inputBuffer = inputBuffer;
+  this->inputBufferSize = inputBufferSize;
+  in = inputBuffer;
+  inEnd = inputBuffer;
+  this->window = window;
+  windowEnd = window + WINDOW_SIZE;
+  sink = &out;
+  return inflate() && flushWindow();
+}
+
+bool Inflater::inflate() {
+  inputDone = false;
+  bitBuffer = 0;
+  bitCount = 0;
+  overrun = 0;
+  out = window;
+  wrapped = false;
+  fixedTables = false;
+
+  bool finalBlock = false;
+  while (!finalBlock) {
+    if (!refill()) {
+      return false;
+    }
+    finalBlock = peekBits(1);
+    const uint32_t type = peekBits(3) >> 1;
+    dropBits(3);
+
+    bool ok;
+    if (type == 0) {
+      ok = inflateStoredBlock();
+    } else if (type == 1) {
+      if (!fixedTables) buildFixedTables();
+      ok = inflateHuffmanBlock();
+    } else if (type == 2) {
+      fixedTables = false;
+      ok = readDynamicTables() && inflateHuffmanBlock();
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      Serial.printf("[%lu] [INF] Invalid or truncated deflate data (block type %u)\n", millis(), type);
+      return false;
+    }
+  }
+
+  // Bits still in the buffer may only be padding taken past the end of the input, not stream data
+  if (overrun * 8 > bitCount) {
+    Serial.printf("[%lu] [INF] Deflate data is truncated\n", millis());
+    return false;
+  }
+  return true;
+}
+
+bool Inflater::fetchInput() {
+  if (!read || inputDone) {
+    return false;
+  }
+  // Keep the few bytes not taken into the bit buffer yet
+  const size_t kept = inEnd - in;
+  memmove(inputBuffer, in, kept);
+  const size_t fetched = (*read)(inputBuffer + kept, inputBufferSize - kept);
+  in = inputBuffer;
+  inEnd = inputBuffer + kept + fetched;
+  if (fetched == 0) {
+    inputDone = true;
+    return false;
+  }
+  return true;
+}
+
+bool Inflater::refillSlow() {
+  while (bitCount <= 23) {
+    // A read may return fewer bytes than asked for anywhere in the stream, only pad once it returned none
+    if (in == inEnd) {
+      fetchInput();
+    }
+    if (in < inEnd) {
+      bitBuffer |= static_cast<uint32_t>(*in++) << bitCount;
+    } else if (++overrun > sizeof(bitBuffer)) {
+      // More padding than the bit buffer can look ahead, the stream is cut off
+      return false;
+    }
+    bitCount += 8;
+  }
+  return true;
+}
+
+bool Inflater::flushWindow() {
+  if (!sink) {
+    return false;
+  }
+  const size_t size = out - window;
+  if (sink->write(window, size) != size) {
+    Serial.printf("[%lu] [INF] Failed to write all output bytes to stream\n", millis());
+    return false;
+  }
+  if (out == windowEnd) {
+    wrapped = true;
+  }
+  out = window;
+  return true;
+}
+
+bool Inflater::putByte(const uint8_t byte) {
+  if (out == windowEnd && !flushWindow()) {
+    return false;
+  }
+  *out++ = byte;
+  return true;
+}
+
+bool Inflater::copyMatch(uint32_t length, const uint32_t distance) {
+  const uint8_t* from = out - distance;
+  if (from < window) {
+    if (!wrapped) {
+      return false;  // Reaches back before the start of the output
+    }
+    from += WINDOW_SIZE;
+  }
+
+  // Words may be copied up to 7 bytes past the match, as long as that stays inside the window
+  if (windowEnd - out >= static_cast<ptrdiff_t>(length) + 8 && windowEnd - from >= static_cast<ptrdiff_t>(length) + 8) {
+    uint8_t* const end = out + length;
+    if (distance >= 8) {
+      do {
+        memcpy(out, from, 8);
+        out += 8;
+        from += 8;
+      } while (out < end);
+    } else if (distance == 1) {
+      memset(out, *from, length);
+    } else {
+      // Overlapping copy, byte by byte repeats the pattern
+      do {
+        *out++ = *from++;
+      } while (out < end);
+    }
+    out = end;
+    return true;
+  }
+
+  // Either side runs into the end of the window
+  while (length--) {
+    if (!putByte(*from++)) {
+      return false;
+    }
+    if (from == windowEnd) {
+      from = window;
+    }
+  }
+  return true;
+}
+
+bool Inflater::inflateStoredBlock() {
+  // The length fields start at the next byte, the bytes before them may still be in the bit buffer
+  dropBits(bitCount & 7);
+  if (!refill()) {
+    return false;
+  }
+  const uint32_t length = peekBits(16);
+  dropBits(16);
+  if (!refill()) {
+    return false;
+  }
+  const uint32_t invertedLength = peekBits(16);
+  dropBits(16);
+  if (length != (~invertedLength & 0xFFFF)) {
+    return false;
+  }
+
+  uint32_t remaining = length;
+  const uint32_t buffered = bitCount / 8;
+  if (remaining > 0 && overrun > 0 && remaining + overrun > buffered) {
+    return false;
+  }
+  while (remaining > 0 && bitCount >= 8) {
+    if (!putByte(static_cast<uint8_t>(peekBits(8)))) {
+      return false;
+    }
+    dropBits(8);
+    remaining--;
+  }
+  if (bitCount < 8) {
+    // The buffer is now empty up to in, start over with no bits held
+    bitBuffer = 0;
+    bitCount = 0;
+  }
+
+  while (remaining > 0) {
+    if (in == inEnd && !fetchInput()) {
+      return false;
+    }
+    if (out == windowEnd && !flushWindow()) {
+      return false;
+    }
+    size_t chunk = remaining;
+    if (chunk > static_cast<size_t>(inEnd - in)) chunk = inEnd - in;
+    if (chunk > static_cast<size_t>(windowEnd - out)) chunk = windowEnd - out;
+    memcpy(out, in, chunk);
+    out += chunk;
+    in += chunk;
+    remaining -= chunk;
+  }
+  return true;
+}
+
+void Inflater::buildFixedTables() {
+  for (int symbol = 0; symbol < MAX_LITLEN_SYMBOLS; symbol++) {
+    codeLengths[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+  }
+  for (int symbol = 0; symbol < MAX_DIST_SYMBOLS; symbol++) {
+    codeLengths[MAX_LITLEN_SYMBOLS + symbol] = 5;
+  }
+  buildTable(litlenTable, LITLEN_TABLE_SIZE, LITLEN_TABLE_BITS, codeLengths, MAX_LITLEN_SYMBOLS, litlenEntry);
+  pairLiterals(litlenTable, LITLEN_TABLE_BITS);
+  buildTable(distTable, DIST_TABLE_SIZE, DIST_TABLE_BITS, codeLengths + MAX_LITLEN_SYMBOLS, MAX_DIST_SYMBOLS,
+             distEntry);
+  fixedTables = true;
+}
+
+bool Inflater::readDynamicTables() {
+  if (!refill()) {
+    return false;
+  }
+  const int litlenCount = static_cast<int>(peekBits(5)) + 257;
+  dropBits(5);
+  const int distCount = static_cast<int>(peekBits(5)) + 1;
+  dropBits(5);
+  const int precodeCount = static_cast<int>(peekBits(4)) + 4;
+  dropBits(4);
+  if (litlenCount > LITLEN_SYMBOLS || distCount > DIST_SYMBOLS) {
+    return false;
+  }
+
+  uint8_t precodeLengths[PRECODE_SYMBOLS] = {};
+  for (int i = 0; i < precodeCount; i++) {
+    if (bitCount < 3 && !refill()) {
+      return false;
+    }
+    precodeLengths[PRECODE_ORDER[i]] = peekBits(3);
+    dropBits(3);
+  }
+  if (!buildTable(precodeTable, PRECODE_TABLE_SIZE, PRECODE_TABLE_BITS, precodeLengths, PRECODE_SYMBOLS,
+                  precodeEntry)) {
+    return false;
+  }
+
+  // Literal/length and distance code lengths are sent as one run-length coded sequence
+  const int total = litlenCount + distCount;
+  int i = 0;
+  while (i < total) {
+    if (!refill()) {
+      return false;
+    }
+    const uint32_t entry = precodeTable[peekBits(PRECODE_TABLE_BITS)];
+    if (entryType(entry) != BASE) {
+      return false;
+    }
+    dropBits(entryLength(entry));
+    const uint32_t symbol = entryValue(entry);
+    if (symbol < 16) {
+      codeLengths[i++] = symbol;
+      continue;
+    }
+
+    uint8_t value = 0;
+    int repeat;
+    if (symbol == 16) {
+      if (i == 0) return false;
+      value = codeLengths[i - 1];
+      repeat = 3 + peekBits(2);
+      dropBits(2);
+    } else if (symbol == 17) {
+      repeat = 3 + peekBits(3);
+      dropBits(3);
+    } else {
+      repeat = 11 + peekBits(7);
+      dropBits(7);
+    }
+    if (i + repeat > total) {
+      return false;
+    }
+    memset(codeLengths + i, value, repeat);
+    i += repeat;
+  }
+  if (codeLengths[256] == 0) {
+    return false;  // No end of block code
+  }
+
+  if (!buildTable(litlenTable, LITLEN_TABLE_SIZE, LITLEN_TABLE_BITS, codeLengths, litlenCount, litlenEntry) ||
+      !buildTable(distTable, DIST_TABLE_SIZE, DIST_TABLE_BITS, codeLengths + litlenCount, distCount, distEntry)) {
+    return false;
+  }
+  pairLiterals(litlenTable, LITLEN_TABLE_BITS);
+  return true;
+}
+
+bool Inflater::inflateHuffmanBlock() {
+  constexpr uint32_t litlenMask = (1u << LITLEN_TABLE_BITS) - 1;
+  constexpr uint32_t distMask = (1u << DIST_TABLE_BITS) - 1;
+
+  while (true) {
+    if (!refill()) {
+      return false;
+    }
+    uint32_t entry = litlenTable[bitBuffer & litlenMask];
+
+    if (entryType(entry) <= LITERAL_PAIR) {
+      if (windowEnd - out < 4) {
+        dropBits(entryLength(entry));
+        if (!putByte(entryValue(entry)) ||
+            (entryType(entry) == LITERAL_PAIR && !putByte(entryValue(entry) >> 8))) {
+          return false;
+        }
+        continue;
+      }
+      // Both bytes are stored for a single literal too, the second is overwritten by the next symbol and the window
+      // slack keeps it clear of the history
+      dropBits(entryLength(entry));
+      out[0] = entryValue(entry);
+      out[1] = entryValue(entry) >> 8;
+      out += 1 + entryType(entry);
+
+      // A root entry takes at most 10 of the 24 bits, so the next one can be looked up without a refill
+      entry = litlenTable[bitBuffer & litlenMask];
+      if (entryType(entry) <= LITERAL_PAIR) {
+        dropBits(entryLength(entry));
+        out[0] = entryValue(entry);
+        out[1] = entryValue(entry) >> 8;
+        out += 1 + entryType(entry);
+        continue;
+      }
+      // The bits of the entry stay in place, only more are added behind them
+      if (!refill()) {
+        return false;
+      }
+    }
+
+    if (entryType(entry) == SUBTABLE) {
+      dropBits(LITLEN_TABLE_BITS);
+      entry = litlenTable[entryValue(entry) + peekBits(entryExtra(entry))];
+      if (entryType(entry) == LITERAL) {
+        dropBits(entryLength(entry));
+        if (!putByte(entryValue(entry))) {
+          return false;
+        }
+        continue;
+      }
+    }
+
+    if (entryType(entry) == END_OF_BLOCK) {
+      dropBits(entryLength(entry));
+      return true;
+    }
+    if (entryType(entry) != BASE) {
+      return false;
+    }
+
+    // At most 15 code and 5 extra bits, still within the 24 of the refill
+    dropBits(entryLength(entry));
+    const uint32_t length = entryValue(entry) + peekBits(entryExtra(entry));
+    dropBits(entryExtra(entry));
+
+    if (!refill()) {
+      return false;
+    }
+    entry = distTable[bitBuffer & distMask];
+    if (entryType(entry) == SUBTABLE) {
+      dropBits(DIST_TABLE_BITS);
+      entry = distTable[entryValue(entry) + peekBits(entryExtra(entry))];
+    }
+    if (entryType(entry) != BASE) {
+      return false;
+    }
+    dropBits(entryLength(entry));
+    // Up to 13 extra bits may not be left after a 15 bit code
+    if (bitCount < entryExtra(entry) && !refill()) {
+      return false;
+    }
+    const uint32_t distance = entryValue(entry) + peekBits(entryExtra(entry));
+    dropBits(entryExtra(entry));
+
+    if (!copyMatch(length, distance)) {
+      return false;
+    }
+  }
+}
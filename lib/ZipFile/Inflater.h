@@ -0,0 +1,103 @@
+#pragma once
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+/**
+ * Deflate (RFC 1951) decoder for zip entries, used in place of miniz's tinfl which decodes a symbol at a time
+ * through a resumable state machine.
+ *
+ * - The bit buffer is refilled a 32-bit word at a time without branching on the bit count, after a refill it holds
+ *   at least 24 bits, enough for a literal/length code and its extra bits.
+ * - Codes are decoded with one lookup in a 10-bit table (8 bits for distances, plus a small subtable for the rare
+ *   longer codes). Entries carry the length or distance base and extra bit count, and an entry whose code is short
+ *   enough holds the following literal too, so text mostly decodes two literals per lookup.
+ * - Literal runs are written without going back to the block loop, matches are copied with memcpy()/memset() when
+ *   they don't wrap around the window.
+ *
+ * A stream is decoded in a single call: input is pulled through a read function and output is written through a
+ * circular window, so no decoder state has to survive between chunks.
+ */
+class Inflater {
+ public:
+  // Fills buffer with up to size more compressed bytes, returns how many were read, 0 at the end of the input
+  using ReadFn = std::function<size_t(uint8_t* buffer, size_t size)>;
+
+  // The 32 KB deflate can refer back to, plus slack for literals and matches written a word at a time to run over
+  static constexpr size_t WINDOW_SIZE = 32768 + 16;
+
+  // Decode a stream held in memory into output, which has to be exactly the inflated size
+  bool inflateToBuffer(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize);
+  // Decode a stream read with read through inputBuffer (at least 4 bytes), window is a WINDOW_SIZE byte ring that
+  // is written to out every time it fills up
+  bool inflateToStream(const ReadFn& read, uint8_t* inputBuffer, size_t inputBufferSize, uint8_t* window, Print& out);
+
+ private:
+  static constexpr int LITLEN_TABLE_BITS = 10;
+  static constexpr int DIST_TABLE_BITS = 8;
+  static constexpr int PRECODE_TABLE_BITS = 7;
+  // Largest tables for these root sizes including subtables, as computed by zlib's examples/enough.c
+  static constexpr size_t LITLEN_TABLE_SIZE = 1334;
+  static constexpr size_t DIST_TABLE_SIZE = 402;
+  static constexpr size_t PRECODE_TABLE_SIZE = 1 << PRECODE_TABLE_BITS;
+  static constexpr int MAX_LITLEN_SYMBOLS = 288;
+  static constexpr int MAX_DIST_SYMBOLS = 32;
+
+  uint32_t litlenTable[LITLEN_TABLE_SIZE];
+  uint32_t distTable[DIST_TABLE_SIZE];
+  uint32_t precodeTable[PRECODE_TABLE_SIZE];
+  uint8_t codeLengths[MAX_LITLEN_SYMBOLS + MAX_DIST_SYMBOLS];
+  bool fixedTables = false;
+
+  // Input
+  const ReadFn* read = nullptr;
+  uint8_t* inputBuffer = nullptr;
+  size_t inputBufferSize = 0;
+  const uint8_t* in = nullptr;
+  const uint8_t* inEnd = nullptr;
+  bool inputDone = false;
+  uint32_t bitBuffer = 0;
+  uint32_t bitCount = 0;
+  // Zero bytes added to the bit buffer past the end of the input
+  uint32_t overrun = 0;
+
+  // Output
+  uint8_t* window = nullptr;
+  uint8_t* windowEnd = nullptr;
+  uint8_t* out = nullptr;
+  Print* sink = nullptr;
+  bool wrapped = false;
+
+  bool inflate();
+  bool inflateStoredBlock();
+  bool inflateHuffmanBlock();
+  bool readDynamicTables();
+  void buildFixedTables();
+
+  bool fetchInput();
+  bool refillSlow();
+  bool flushWindow();
+  bool putByte(uint8_t byte);
+  bool copyMatch(uint32_t length, uint32_t distance);
+
+  // Make sure the bit buffer holds at least 24 bits, false if the input ran out well before the stream did
+  bool refill() {
+    if (inEnd - in < 4 && (!fetchInput() || inEnd - in < 4)) {
+      return refillSlow();
+    }
+    uint32_t word;
+    memcpy(&word, in, sizeof(word));
+    bitBuffer |= word << bitCount;
+    in += (31 - bitCount) >> 3;
+    bitCount |= 24;
+    return true;
+  }
+  uint32_t peekBits(const uint32_t count) const { return bitBuffer & ((1u << count) - 1); }
+  void dropBits(const uint32_t count) {
+    bitBuffer >>= count;
+    bitCount -= count;
+  }
+};
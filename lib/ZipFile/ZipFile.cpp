@@ -4,28 +4,18 @@
 #include <SDCardManager.h>
 #include <miniz.h>
 
-bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
-  // Setup inflator
-  const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
-  if (!inflator) {
-    Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflator\n", millis());
-    return false;
-  }
-  memset(inflator, 0, sizeof(tinfl_decompressor));
-  tinfl_init(inflator);
+#include <memory>
 
-  size_t inBytes = deflatedSize;
-  size_t outBytes = inflatedSize;
-  const tinfl_status status = tinfl_decompress(inflator, inputBuf, &inBytes, nullptr, outputBuf, &outBytes,
-                                               TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
-  free(inflator);
+#include "Inflater.h"
 
-  if (status != TINFL_STATUS_DONE) {
-    Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
+bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
+  const std::unique_ptr<Inflater> inflater(new (std::nothrow) Inflater());
+  if (!inflater) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflator\n", millis());
     return false;
   }
 
-  return true;
+  return inflater->inflateToBuffer(inputBuf, deflatedSize, outputBuf, inflatedSize);
 }
 
 bool ZipFile::loadAllFileStatSlims() {
@@ -418,127 +408,57 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
   if (fileStat.method == MZ_DEFLATED) {
     // Setup inflator
-    const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
-    if (!inflator) {
+    const std::unique_ptr<Inflater> inflater(new (std::nothrow) Inflater());
+    if (!inflater) {
       Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflator\n", millis());
       if (!wasOpen) {
         close();
       }
       return false;
     }
-    memset(inflator, 0, sizeof(tinfl_decompressor));
-    tinfl_init(inflator);
 
     // Setup file read buffer
     const auto fileReadBuffer = static_cast<uint8_t*>(malloc(chunkSize));
     if (!fileReadBuffer) {
       Serial.printf("[%lu] [ZIP] Failed to allocate memory for zip file read buffer\n", millis());
-      free(inflator);
       if (!wasOpen) {
         close();
       }
       return false;
     }
 
-    const auto outputBuffer = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+    const auto outputBuffer = static_cast<uint8_t*>(malloc(Inflater::WINDOW_SIZE));
     if (!outputBuffer) {
       Serial.printf("[%lu] [ZIP] Failed to allocate memory for dictionary\n", millis());
-      free(inflator);
       free(fileReadBuffer);
       if (!wasOpen) {
         close();
       }
       return false;
     }
-    memset(outputBuffer, 0, TINFL_LZ_DICT_SIZE);
 
     size_t fileRemainingBytes = deflatedDataSize;
-    size_t processedOutputBytes = 0;
-    size_t fileReadBufferFilledBytes = 0;
-    size_t fileReadBufferCursor = 0;
-    size_t outputCursor = 0;  // Current offset in the circular dictionary
-
-    while (true) {
-      // Load more compressed bytes when needed
-      if (fileReadBufferCursor >= fileReadBufferFilledBytes) {
-        if (fileRemainingBytes == 0) {
-          // Should not be hit, but a safe protection
-          break;  // EOF
-        }
-
-        fileReadBufferFilledBytes =
-            file.read(fileReadBuffer, fileRemainingBytes < chunkSize ? fileRemainingBytes : chunkSize);
-        fileRemainingBytes -= fileReadBufferFilledBytes;
-        fileReadBufferCursor = 0;
-
-        if (fileReadBufferFilledBytes == 0) {
-          // Bad read
-          break;  // EOF
-        }
-      }
-
-      // Available bytes in fileReadBuffer to process
-      size_t inBytes = fileReadBufferFilledBytes - fileReadBufferCursor;
-      // Space remaining in outputBuffer
-      size_t outBytes = TINFL_LZ_DICT_SIZE - outputCursor;
-
-      const tinfl_status status = tinfl_decompress(inflator, fileReadBuffer + fileReadBufferCursor, &inBytes,
-                                                   outputBuffer, outputBuffer + outputCursor, &outBytes,
-                                                   fileRemainingBytes > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
-
-      // Update input position
-      fileReadBufferCursor += inBytes;
-
-      // Write output chunk
-      if (outBytes > 0) {
-        processedOutputBytes += outBytes;
-        if (out.write(outputBuffer + outputCursor, outBytes) != outBytes) {
-          Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
-          if (!wasOpen) {
-            close();
-          }
-          free(outputBuffer);
-          free(fileReadBuffer);
-          free(inflator);
-          return false;
-        }
-        // Update output position in buffer (with wraparound)
-        outputCursor = (outputCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
-      }
-
-      if (status < 0) {
-        Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
-        if (!wasOpen) {
-          close();
-        }
-        free(outputBuffer);
-        free(fileReadBuffer);
-        free(inflator);
-        return false;
-      }
-
-      if (status == TINFL_STATUS_DONE) {
-        Serial.printf("[%lu] [ZIP] Decompressed %d bytes into %d bytes\n", millis(), deflatedDataSize,
-                      inflatedDataSize);
-        if (!wasOpen) {
-          close();
-        }
-        free(inflator);
-        free(fileReadBuffer);
-        free(outputBuffer);
-        return true;
+    const Inflater::ReadFn readDeflated = [this, &fileRemainingBytes](uint8_t* buffer, const size_t size) {
+      const int dataRead = file.read(buffer, fileRemainingBytes < size ? fileRemainingBytes : size);
+      if (dataRead <= 0) {
+        return size_t{0};
       }
+      fileRemainingBytes -= dataRead;
+      return static_cast<size_t>(dataRead);
+    };
+    const bool success = inflater->inflateToStream(readDeflated, fileReadBuffer, chunkSize, outputBuffer, out);
+    if (success) {
+      Serial.printf("[%lu] [ZIP] Decompressed %d bytes into %d bytes\n", millis(), deflatedDataSize, inflatedDataSize);
+    } else {
+      Serial.printf("[%lu] [ZIP] Failed to inflate file\n", millis());
     }
 
-    // If we get here, EOF reached without TINFL_STATUS_DONE
-    Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
     if (!wasOpen) {
       close();
     }
     free(outputBuffer);
     free(fileReadBuffer);
-    free(inflator);
-    return false;
+    return success;
   }
 
   if (!wasOpen) {
@@ -1,3 +1,5 @@
+import gzip
+import hashlib
 import os
 import re
 
@@ -31,6 +33,16 @@ def minify_html(html: str) -> str:
 
     return html.strip()
 
+def gzip_bytes(data: bytes) -> bytes:
+    # mtime=0 keeps the output (and therefore the ETag) stable between builds
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+def format_byte_array(data: bytes) -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
 for root, _, files in os.walk(SRC_DIR):
     for file in files:
         if file.endswith(".html"):
@@ -40,12 +52,20 @@ for root, _, files in os.walk(SRC_DIR):
 
             # minified = regex.sub("\g<1>", html_content)
             minified = minify_html(html_content)
+            compressed = gzip_bytes(minified.encode("utf-8"))
+            # Strong validator: changes whenever the served bytes change
+            etag = hashlib.sha1(compressed).hexdigest()[:16]
             base_name = f"{os.path.splitext(file)[0]}Html"
             header_path = os.path.join(root, f"{base_name}.generated.h")
 
             with open(header_path, "w", encoding="utf-8") as h:
                 h.write(f"// THIS FILE IS AUTOGENERATED, DO NOT EDIT MANUALLY\n\n")
                 h.write(f"#pragma once\n")
-                h.write(f'constexpr char {base_name}[] PROGMEM = R"rawliteral({minified})rawliteral";\n')
+                h.write(f"#include <cstddef>\n")
+                h.write(f"#include <cstdint>\n\n")
+                h.write(f"// Gzip-compressed, minified {file} ({len(minified)} bytes uncompressed)\n")
+                h.write(f'constexpr char {base_name}Etag[] = "\\"{etag}\\"";\n')
+                h.write(f"constexpr size_t {base_name}GzSize = {len(compressed)};\n")
+                h.write(f"constexpr uint8_t {base_name}Gz[] PROGMEM = {{\n{format_byte_array(compressed)}\n}};\n")
 
-            print(f"Generated: {header_path}")
+            print(f"Generated: {header_path} ({len(minified)} -> {len(compressed)} bytes)")
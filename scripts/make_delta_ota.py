@@ -0,0 +1,125 @@
+"""
+Build a delta OTA patch between two firmware images.
+
+Usage: python scripts/make_delta_ota.py <old firmware.bin> <new firmware.bin> <out.delta>
+
+Attach the output to the new release as "firmware-from-<old version>.delta". Devices running <old version> download
+it instead of firmware.bin and rebuild the new image against their running partition (see src/network/DeltaOtaPatcher).
+
+Format (all integers little endian):
+  "CPDELTA1"
+  u32 base size, 32 byte SHA-256 of the base image
+  u32 target size, 32 byte SHA-256 of the target image
+  raw deflate stream of records:
+    u32 diff length, u32 extra length, i32 old seek adjustment
+    <diff length> bytes added (mod 256) to the base image at the current old position
+    <extra length> bytes copied verbatim
+  After each record the old position advances by diff length + seek adjustment.
+"""
+
+import hashlib
+import struct
+import sys
+import zlib
+
+MAGIC = b"CPDELTA1"
+# Match key length and how densely the base image is indexed
+KEY_LEN = 32
+INDEX_STEP = 8
+# Stop extending a diff run once mismatches outweigh matches by this much
+MAX_SCORE_DROP = 64
+
+
+def build_index(old: bytes) -> dict:
+    index = {}
+    for i in range(0, len(old) - KEY_LEN, INDEX_STEP):
+        index.setdefault(old[i:i + KEY_LEN], i)
+    return index
+
+
+def extend_forward(old: bytes, new: bytes, old_pos: int, new_pos: int) -> int:
+    """Length of the region starting at the given positions that is worth encoding as a diff.
+
+    Like bsdiff, runs continue through small differences (e.g. relocated addresses) since those only cost a few
+    non-zero bytes in an otherwise zero diff stream.
+    """
+    limit = min(len(old) - old_pos, len(new) - new_pos)
+    score = best_score = best_len = 0
+    i = 0
+    while i < limit:
+        # Fast path over exact matches
+        chunk = min(256, limit - i)
+        if old[old_pos + i:old_pos + i + chunk] == new[new_pos + i:new_pos + i + chunk]:
+            i += chunk
+            score += chunk
+        else:
+            score += 1 if old[old_pos + i] == new[new_pos + i] else -1
+            i += 1
+        if score > best_score:
+            best_score, best_len = score, i
+        elif score < best_score - MAX_SCORE_DROP:
+            break
+    return best_len
+
+
+def make_patch(old: bytes, new: bytes) -> bytes:
+    index = build_index(old)
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15)
+    body = []
+
+    # The pending diff run (old start, new start, length), literal bytes are collected after it
+    prev_old, prev_new, prev_len = 0, 0, 0
+    literal_start = 0
+    pos = 0
+
+    def emit(extra_end: int, next_old: int):
+        diff = bytes((new[prev_new + i] - old[prev_old + i]) & 0xFF for i in range(prev_len))
+        extra = new[prev_new + prev_len:extra_end]
+        seek = next_old - (prev_old + prev_len)
+        body.append(compressor.compress(struct.pack("<IIi", prev_len, len(extra), seek) + diff + extra))
+
+    while pos + KEY_LEN <= len(new):
+        match = index.get(new[pos:pos + KEY_LEN])
+        if match is None:
+            pos += 1
+            continue
+
+        # Grow the match backwards into the pending literal bytes
+        old_start, new_start = match, pos
+        while new_start > literal_start and old_start > 0 and new[new_start - 1] == old[old_start - 1]:
+            new_start -= 1
+            old_start -= 1
+
+        length = extend_forward(old, new, old_start, new_start)
+        emit(new_start, old_start)
+        prev_old, prev_new, prev_len = old_start, new_start, length
+        pos = literal_start = new_start + length
+
+    emit(len(new), prev_old + prev_len)
+    body.append(compressor.flush())
+
+    header = MAGIC
+    header += struct.pack("<I", len(old)) + hashlib.sha256(old).digest()
+    header += struct.pack("<I", len(new)) + hashlib.sha256(new).digest()
+    return header + b"".join(body)
+
+
+def main():
+    if len(sys.argv) != 4:
+        print(__doc__)
+        sys.exit(1)
+
+    with open(sys.argv[1], "rb") as f:
+        old = f.read()
+    with open(sys.argv[2], "rb") as f:
+        new = f.read()
+
+    patch = make_patch(old, new)
+    with open(sys.argv[3], "wb") as f:
+        f.write(patch)
+
+    print(f"Delta: {len(patch)} bytes ({100.0 * len(patch) / len(new):.1f}% of {len(new)} byte image)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,113 @@
+#include "BookCacheMigration.h"
+
+#include <FsHelpers.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+constexpr size_t NAME_LENGTH = 32;
+
+// Hash of a flat layout cache folder name, false for anything else
+bool parseLegacyName(const char* name, size_t& hash) {
+  const char* digits;
+  if (strncmp(name, "epub_", 5) == 0) {
+    digits = name + 5;
+  } else if (strncmp(name, "xtc_", 4) == 0) {
+    digits = name + 4;
+  } else {
+    return false;
+  }
+  if (*digits < '0' || *digits > '9') {
+    return false;
+  }
+
+  char* end;
+  const unsigned long long value = strtoull(digits, &end, 10);
+  if (*end != '\0') {
+    return false;
+  }
+  hash = static_cast<size_t>(value);
+  return true;
+}
+
+// Name of the next directory in the listing, false at the end. Names that don't fit are not ours and come back empty
+bool nextDirectory(FsFile& dir, char* name, bool& isDirectory) {
+  auto file = dir.openNextFile();
+  if (!file) {
+    return false;
+  }
+  isDirectory = file.isDirectory();
+  if (file.getName(name, NAME_LENGTH) == 0) {
+    name[0] = '\0';
+  }
+  file.close();
+  return true;
+}
+}  // namespace
+
+bool BookCacheMigration::hasWork(const char* cacheDir) {
+  auto dir = SdMan.open(cacheDir);
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return false;
+  }
+
+  char name[NAME_LENGTH];
+  bool isDirectory;
+  size_t hash;
+  bool found = false;
+  while (!found && nextDirectory(dir, name, isDirectory)) {
+    found = isDirectory && parseLegacyName(name, hash);
+  }
+  dir.close();
+  return found;
+}
+
+uint16_t BookCacheMigration::run(const char* cacheDir) {
+  auto dir = SdMan.open(cacheDir);
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return 0;
+  }
+
+  const unsigned long start = millis();
+  uint16_t moved = 0;
+  bool cacheRootCreated = false;
+  char name[NAME_LENGTH];
+  bool isDirectory;
+  while (nextDirectory(dir, name, isDirectory)) {
+    size_t hash;
+    if (!isDirectory || !parseLegacyName(name, hash)) {
+      continue;
+    }
+
+    if (!cacheRootCreated) {
+      SdMan.mkdir((std::string(cacheDir) + "/cache").c_str());
+      cacheRootCreated = true;
+    }
+    const std::string shardPath = FsHelpers::bookCacheShardPath(cacheDir, hash);
+    const std::string from = std::string(cacheDir) + "/" + name;
+    const std::string to = shardPath + "/" + name;
+    SdMan.mkdir(shardPath.c_str());
+
+    // Moving or deleting an entry only marks it free, listing goes on from the same position
+    if (SdMan.exists(to.c_str())) {
+      // Built again by a firmware that already used the new layout, the old one is stale
+      SdMan.removeDir(from.c_str());
+    } else if (!SdMan.rename(from.c_str(), to.c_str())) {
+      Serial.printf("[%lu] [BCM] Failed to move cache %s\n", millis(), from.c_str());
+      continue;
+    }
+    moved++;
+  }
+  dir.close();
+
+  if (moved > 0) {
+    Serial.printf("[%lu] [BCM] Moved %u book caches to shard folders in %lu ms\n", millis(), moved, millis() - start);
+  }
+  return moved;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Moves book caches from the flat layout (<cacheDir>/epub_<hash>, <cacheDir>/xtc_<hash>) into the shard folders of
+ * FsHelpers::bookCachePath, so books indexed by older firmware keep their caches and reading progress.
+ *
+ * Runs at boot. Once nothing is left to move it only lists the few entries left in <cacheDir>. Moving a large library
+ * takes a while, so check hasWork() first to put something on the screen.
+ */
+class BookCacheMigration {
+ public:
+  // Whether any cache is still in the flat layout, stops listing at the first one
+  static bool hasWork(const char* cacheDir);
+  // Number of caches moved
+  static uint16_t run(const char* cacheDir);
+};
@@ -0,0 +1,109 @@
+#include "BookSession.h"
+
+#include <Arduino.h>
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <Xtc.h>
+
+#include <algorithm>
+#include <cstring>
+
+BookSession BookSession::instance;
+
+BookSession::Book* BookSession::find(const std::string& path) {
+  const auto it = std::find_if(books.begin(), books.end(), [&path](const Book& book) { return book.path == path; });
+  return it == books.end() ? nullptr : &*it;
+}
+
+BookSession::Book& BookSession::promote(const std::string& path) {
+  auto it = std::find_if(books.begin(), books.end(), [&path](const Book& book) { return book.path == path; });
+  if (it == books.end()) {
+    Book book;
+    book.path = path;
+    books.insert(books.begin(), std::move(book));
+  } else {
+    std::rotate(books.begin(), it, it + 1);
+  }
+  return books.front();
+}
+
+void BookSession::trim() {
+  while (books.size() > MAX_BOOKS || (books.size() > 1 && ESP.getFreeHeap() < MIN_FREE_HEAP)) {
+    Serial.printf("[%lu] [BKS] Releasing %s (free heap %u)\n", millis(), books.back().path.c_str(), ESP.getFreeHeap());
+    books.pop_back();
+  }
+}
+
+std::shared_ptr<Epub> BookSession::findEpub(const std::string& path) {
+  const Book* book = find(path);
+  if (!book || !book->epub) {
+    return nullptr;
+  }
+  auto epub = book->epub;
+  promote(path);
+  return epub;
+}
+
+std::shared_ptr<Xtc> BookSession::findXtc(const std::string& path) {
+  const Book* book = find(path);
+  if (!book || !book->xtc) {
+    return nullptr;
+  }
+  auto xtc = book->xtc;
+  promote(path);
+  return xtc;
+}
+
+void BookSession::retain(const std::shared_ptr<Epub>& epub) {
+  Book& book = promote(epub->getPath());
+  book.epub = epub;
+  book.xtc.reset();
+  book.section.reset();
+  trim();
+}
+
+void BookSession::retain(const std::shared_ptr<Xtc>& xtc) {
+  Book& book = promote(xtc->getPath());
+  book.xtc = xtc;
+  book.epub.reset();
+  book.section.reset();
+  trim();
+}
+
+void BookSession::retainSection(const std::string& path, std::unique_ptr<Section> section, const int spineIndex,
+                                const uint32_t layout) {
+  Book* book = find(path);
+  if (!book || !book->epub) {
+    return;
+  }
+  book->section = std::move(section);
+  book->sectionSpineIndex = spineIndex;
+  book->sectionLayout = layout;
+  trim();
+}
+
+std::unique_ptr<Section> BookSession::takeSection(const std::string& path, const int spineIndex,
+                                                  const uint32_t layout) {
+  Book* book = find(path);
+  if (!book || !book->section) {
+    return nullptr;
+  }
+  auto section = std::move(book->section);
+  if (book->sectionSpineIndex != spineIndex || book->sectionLayout != layout) {
+    return nullptr;
+  }
+  return section;
+}
+
+void BookSession::invalidate(const char* changedPath) {
+  const size_t length = strlen(changedPath);
+  books.erase(std::remove_if(books.begin(), books.end(),
+                             [changedPath, length](const Book& book) {
+                               // A deleted folder takes the books in it along
+                               return book.path.compare(0, length, changedPath) == 0 &&
+                                      (book.path.size() == length || book.path[length] == '/');
+                             }),
+              books.end());
+}
+
+void BookSession::clear() { books.clear(); }
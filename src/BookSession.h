@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Epub;
+class Section;
+class Xtc;
+
+/**
+ * Keeps the most recently opened books loaded between reader sessions, so leaving a book for the file browser or
+ * the home screen and coming back (or flipping between two books) skips Epub::load()/Xtc::load() and the section
+ * header reads and goes straight to rendering the saved page.
+ *
+ * A retained book holds its loaded metadata with the open cache files, and for EPUBs the section that was on screen
+ * together with the layout it was paginated for. Books are dropped oldest first past MAX_BOOKS or when the heap runs
+ * low, and by invalidate() when the web server replaces or deletes the file.
+ */
+class BookSession {
+  // Static instance
+  static BookSession instance;
+
+  struct Book {
+    std::string path;
+    std::shared_ptr<Epub> epub;
+    std::shared_ptr<Xtc> xtc;
+    std::unique_ptr<Section> section;
+    int sectionSpineIndex = 0;
+    uint32_t sectionLayout = 0;
+  };
+  // Most recently used first
+  std::vector<Book> books;
+
+  Book* find(const std::string& path);
+  Book& promote(const std::string& path);
+  void trim();
+
+ public:
+  static constexpr size_t MAX_BOOKS = 2;
+  // Retained books are given up rather than pushing the free heap below this
+  static constexpr uint32_t MIN_FREE_HEAP = 48 * 1024;
+
+  // Get singleton instance
+  static BookSession& getInstance() { return instance; }
+
+  bool contains(const std::string& path) { return find(path) != nullptr; }
+  std::shared_ptr<Epub> findEpub(const std::string& path);
+  std::shared_ptr<Xtc> findXtc(const std::string& path);
+  void retain(const std::shared_ptr<Epub>& epub);
+  void retain(const std::shared_ptr<Xtc>& xtc);
+
+  // Hand the reader's current section over when leaving the book, layout identifies the settings it was built with
+  void retainSection(const std::string& path, std::unique_ptr<Section> section, int spineIndex, uint32_t layout);
+  // The retained section of the book if it is for this spine item and layout, nullptr otherwise
+  std::unique_ptr<Section> takeSection(const std::string& path, int spineIndex, uint32_t layout);
+
+  // Call after changing a file on the card, drops the book if it was retained
+  void invalidate(const char* changedPath);
+  void clear();
+};
+
+// Helper macro to access the session
+#define BOOK_SESSION BookSession::getInstance()
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Decides which CPU clock the device should run at, without touching the hardware so it can be exercised on the host.
+ *
+ * The device spends most of its time waiting for a button press, where the clock only costs battery. Work that is
+ * bound by the CPU (section builds, inflating, JPEG decoding, uploads) hints at the policy and gets the full clock:
+ * - Scoped boosts are counted, the clock stays high while any of them is open
+ * - Timed boosts keep the clock high until a deadline, for work without a clear end (button presses, upload chunks)
+ * - A short hold after the last boost keeps back to back jobs from switching the clock for every one of them
+ *
+ * All times are millis() values, differences are taken unsigned so the wrap around after 49 days is harmless.
+ */
+class CpuFrequencyPolicy {
+  uint16_t activeBoosts = 0;
+  unsigned long boostedUntil = 0;
+  bool timedBoost = false;
+
+  void extendUntil(const unsigned long deadline, const unsigned long now) {
+    // Never shorten a boost that is still running
+    if (!timedBoost || static_cast<long>(deadline - boostedUntil) > 0 || static_cast<long>(boostedUntil - now) <= 0) {
+      boostedUntil = deadline;
+    }
+    timedBoost = true;
+  }
+
+ public:
+  // 80 MHz is the lowest clock that keeps the APB bus (SPI for display and SD card, WiFi) at full speed on the C3
+  static constexpr uint32_t IDLE_MHZ = 80;
+  static constexpr uint32_t BOOST_MHZ = 160;
+  static constexpr unsigned long BOOST_HOLD_MS = 250;
+  // Covers rendering the page or menu that follows a button press
+  static constexpr unsigned long INPUT_BOOST_MS = 1000;
+
+  void beginBoost() { activeBoosts++; }
+
+  void endBoost(const unsigned long now) {
+    if (activeBoosts > 0) {
+      activeBoosts--;
+    }
+    if (activeBoosts == 0) {
+      extendUntil(now + BOOST_HOLD_MS, now);
+    }
+  }
+
+  void boostFor(const unsigned long durationMs, const unsigned long now) { extendUntil(now + durationMs, now); }
+
+  void onUserInput(const unsigned long now) { boostFor(INPUT_BOOST_MS, now); }
+
+  bool isBoosted(const unsigned long now) const {
+    return activeBoosts > 0 || (timedBoost && static_cast<long>(boostedUntil - now) > 0);
+  }
+
+  uint32_t targetMhz(const unsigned long now) const { return isBoosted(now) ? BOOST_MHZ : IDLE_MHZ; }
+};
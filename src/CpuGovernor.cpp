@@ -0,0 +1,79 @@
+#include "CpuGovernor.h"
+
+#include <Arduino.h>
+
+// Initialize the static instance
+CpuGovernor CpuGovernor::instance;
+
+void CpuGovernor::begin() {
+  mutex = xSemaphoreCreateMutex();
+  currentMhz = getCpuFrequencyMhz();
+  // Boot work (loading settings, opening the last book) counts as user input
+  onUserInput();
+}
+
+void CpuGovernor::lock() const {
+  if (mutex) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+  }
+}
+
+void CpuGovernor::unlock() const {
+  if (mutex) {
+    xSemaphoreGive(mutex);
+  }
+}
+
+void CpuGovernor::apply() {
+  const uint32_t targetMhz = policy.targetMhz(millis());
+  if (targetMhz == currentMhz) {
+    return;
+  }
+
+  if (!setCpuFrequencyMhz(targetMhz)) {
+    Serial.printf("[%lu] [CPU] Could not switch to %u MHz\n", millis(), targetMhz);
+    return;
+  }
+  currentMhz = targetMhz;
+  Serial.printf("[%lu] [CPU] Clock set to %u MHz\n", millis(), currentMhz);
+}
+
+void CpuGovernor::update() {
+  lock();
+  apply();
+  unlock();
+}
+
+void CpuGovernor::beginBoost() {
+  lock();
+  policy.beginBoost();
+  apply();
+  unlock();
+}
+
+void CpuGovernor::endBoost() {
+  lock();
+  policy.endBoost(millis());
+  unlock();
+}
+
+void CpuGovernor::boostFor(const unsigned long durationMs) {
+  lock();
+  policy.boostFor(durationMs, millis());
+  apply();
+  unlock();
+}
+
+bool CpuGovernor::isBoosted() {
+  lock();
+  const bool boosted = policy.isBoosted(millis());
+  unlock();
+  return boosted;
+}
+
+void CpuGovernor::onUserInput() {
+  lock();
+  policy.onUserInput(millis());
+  apply();
+  unlock();
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstdint>
+
+#include "CpuFrequencyPolicy.h"
+
+/**
+ * Applies CpuFrequencyPolicy to the hardware clock.
+ *
+ * Subsystems hint at the governor when they start CPU bound work, either with a CpuBoost guard around the work or with
+ * boostFor() for work that arrives in pieces. Boosting takes effect immediately, the clock only drops again from
+ * update() in the main loop once the policy says the device is idle. Hints may come from any task (sections are
+ * built on the display task), so every call goes through a mutex.
+ */
+class CpuGovernor {
+  // Static instance
+  static CpuGovernor instance;
+
+  CpuFrequencyPolicy policy;
+  uint32_t currentMhz = 0;
+  SemaphoreHandle_t mutex = nullptr;
+
+  void apply();
+  void lock() const;
+  void unlock() const;
+
+ public:
+  // Get singleton instance
+  static CpuGovernor& getInstance() { return instance; }
+
+  void begin();
+  // Called once per main loop iteration, drops to the idle clock when nothing asks for more
+  void update();
+
+  void beginBoost();
+  void endBoost();
+  void boostFor(unsigned long durationMs);
+  void onUserInput();
+  // Whether any subsystem still asks for the full clock
+  bool isBoosted();
+
+  uint32_t getCurrentMhz() const { return currentMhz; }
+};
+
+// Helper macro to access the governor
+#define CPU_GOVERNOR CpuGovernor::getInstance()
+
+// Keeps the CPU at full clock for the lifetime of the guard
+class CpuBoost {
+ public:
+  CpuBoost() { CPU_GOVERNOR.beginBoost(); }
+  ~CpuBoost() { CPU_GOVERNOR.endBoost(); }
+  CpuBoost(const CpuBoost&) = delete;
+  CpuBoost& operator=(const CpuBoost&) = delete;
+};
@@ -12,7 +12,7 @@ CrossPointSettings CrossPointSettings::instance;
 namespace {
 constexpr uint8_t SETTINGS_FILE_VERSION = 1;
 // Increment this when adding new persisted settings fields
-constexpr uint8_t SETTINGS_COUNT = 12;
+constexpr uint8_t SETTINGS_COUNT = 15;
 constexpr char SETTINGS_FILE[] = "/.crosspoint/settings.bin";
 }  // namespace
 
@@ -39,6 +39,9 @@ bool CrossPointSettings::saveToFile() const {
   serialization::writePod(outputFile, lineSpacing);
   serialization::writePod(outputFile, sleepTimeout);
   serialization::writePod(outputFile, refreshFrequency);
+  serialization::writeString(outputFile, opdsServerUrl);
+  serialization::writePod(outputFile, hyphenation);
+  serialization::writePod(outputFile, embeddedFonts);
   outputFile.close();
 
   Serial.printf("[%lu] [CPS] Settings saved to file\n", millis());
@@ -89,6 +92,12 @@ bool CrossPointSettings::loadFromFile() {
     if (++settingsRead >= fileSettingsCount) break;
     serialization::readPod(inputFile, refreshFrequency);
     if (++settingsRead >= fileSettingsCount) break;
+    serialization::readString(inputFile, opdsServerUrl);
+    if (++settingsRead >= fileSettingsCount) break;
+    serialization::readPod(inputFile, hyphenation);
+    if (++settingsRead >= fileSettingsCount) break;
+    serialization::readPod(inputFile, embeddedFonts);
+    if (++settingsRead >= fileSettingsCount) break;
   } while (false);
 
   inputFile.close();
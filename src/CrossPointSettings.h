@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <iosfwd>
+#include <string>
 
 class CrossPointSettings {
  private:
@@ -68,10 +69,16 @@ class CrossPointSettings {
   uint8_t fontFamily = BOOKERLY;
   uint8_t fontSize = MEDIUM;
   uint8_t lineSpacing = NORMAL;
+  // Hyphenate words in books whose language has hyphenation patterns
+  uint8_t hyphenation = 1;
+  // Typeset books in the fonts they embed instead of the reader font family
+  uint8_t embeddedFonts = 0;
   // Auto-sleep timeout setting (default 10 minutes)
   uint8_t sleepTimeout = SLEEP_10_MIN;
   // E-ink refresh frequency (default 15 pages)
   uint8_t refreshFrequency = REFRESH_15;
+  // OPDS catalog root, e.g. http://192.168.1.10:8080/opds for a calibre content server (empty = not configured)
+  std::string opdsServerUrl;
 
   ~CrossPointSettings() = default;
 
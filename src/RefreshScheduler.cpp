@@ -0,0 +1,38 @@
+#include "RefreshScheduler.h"
+
+#include <Arduino.h>
+
+#include <cstring>
+
+EInkDisplay::RefreshMode RefreshScheduler::nextRefreshMode(const uint8_t* frameBuffer, const int pagesPerRefresh) {
+  uint32_t erasedInk = 0;
+  for (int band = 0; band < BAND_COUNT; band++) {
+    const uint8_t* bandStart = frameBuffer + band * BAND_BYTES;
+    uint32_t hash = 2166136261u;  // FNV-1a over words
+    uint32_t ink = 0;
+    for (size_t offset = 0; offset < BAND_BYTES; offset += sizeof(uint32_t)) {
+      uint32_t word;
+      memcpy(&word, bandStart + offset, sizeof(word));
+      hash = (hash ^ word) * 16777619u;
+      // 0 bits are black
+      ink += __builtin_popcount(~word);
+    }
+
+    if (hash != bandHashes[band]) {
+      erasedInk += bandInk[band];
+      bandHashes[band] = hash;
+      bandInk[band] = static_cast<uint16_t>(ink);
+    }
+  }
+
+  ghosting += erasedInk;
+  const uint32_t budget = PAGE_INK * static_cast<uint32_t>(pagesPerRefresh > 1 ? pagesPerRefresh - 1 : 0);
+  if (fullRefreshPending || ghosting > budget || erasedInk >= HEAVY_PAGE_INK) {
+    Serial.printf("[%lu] [RFS] Full refresh, %u black pixels erased since the last one (%u this page)\n", millis(),
+                  ghosting, erasedInk);
+    fullRefreshPending = false;
+    ghosting = 0;
+    return EInkDisplay::HALF_REFRESH;
+  }
+  return EInkDisplay::FAST_REFRESH;
+}
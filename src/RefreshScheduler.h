@@ -0,0 +1,45 @@
+#pragma once
+#include <EInkDisplay.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Decides when a reader page gets a slow, ghost clearing HALF_REFRESH instead of a fast one.
+ *
+ * Ghosting builds up where ink is taken off the screen by fast refreshes, so rather than counting pages the scheduler
+ * estimates how much ink each page turn removes. The panel frame buffer is split into bands of rows; for each band it
+ * keeps a hash and the number of black pixels of the last frame. A band whose hash changed is taken to have had all
+ * its previous ink erased (that is what a page turn does to text), bands that stayed the same (margins, an unchanged
+ * status bar) add nothing.
+ *
+ * The budget is given in pages of body text, so the refresh frequency setting keeps its meaning for ordinary pages:
+ * light pages (chapter ends, short paragraphs) stretch the time between full refreshes, and turning away from an image
+ * or otherwise ink heavy page triggers one straight away.
+ */
+class RefreshScheduler {
+ public:
+  static constexpr int BAND_ROWS = 8;
+  static constexpr int BAND_COUNT = EInkDisplay::DISPLAY_HEIGHT / BAND_ROWS;
+  static constexpr size_t BAND_BYTES = BAND_ROWS * EInkDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(BAND_COUNT * BAND_ROWS == EInkDisplay::DISPLAY_HEIGHT, "bands do not cover the panel");
+  static_assert(BAND_BYTES % sizeof(uint32_t) == 0, "bands are read a word at a time");
+
+  // Black pixels of a full page of body text, the unit of the ghosting budget
+  static constexpr uint32_t PAGE_INK = 30000;
+  // Erasing this much ink at once (a quarter of the panel, e.g. an image) always gets a full refresh
+  static constexpr uint32_t HEAVY_PAGE_INK = EInkDisplay::DISPLAY_WIDTH * EInkDisplay::DISPLAY_HEIGHT / 4;
+
+ private:
+  uint32_t bandHashes[BAND_COUNT] = {};
+  uint16_t bandInk[BAND_COUNT] = {};
+  uint32_t ghosting = 0;  // Black pixels erased by fast refreshes since the last full one
+  bool fullRefreshPending = true;
+
+ public:
+  // Looks at the frame about to be displayed and picks the refresh for it, pagesPerRefresh pages of body text may be
+  // turned with fast refreshes before a full one
+  EInkDisplay::RefreshMode nextRefreshMode(const uint8_t* frameBuffer, int pagesPerRefresh);
+  // The screen was drawn over by something else (a popup, another activity), give the next page a full refresh
+  void requestFullRefresh() { fullRefreshPending = true; }
+};
@@ -0,0 +1,31 @@
+#include "SelectionRefresh.h"
+
+#include <algorithm>
+
+void SelectionRefresh::display(const GfxRenderer& renderer, const uint32_t layoutKey, const Rect& highlight) {
+  const bool sameLayout = shown && layoutKey == shownLayoutKey;
+  const bool highlightMoved = highlight.x != shownHighlight.x || highlight.y != shownHighlight.y ||
+                              highlight.width != shownHighlight.width || highlight.height != shownHighlight.height;
+
+  // With the same layout and highlight the panel already shows this frame
+  if (!sameLayout) {
+    renderer.displayBuffer();
+  } else if (!highlightMoved) {
+    return;
+  } else if (windowedMoves >= CLEANUP_MOVES) {
+    renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
+    windowedMoves = 0;
+  } else {
+    // One window around both, a second one would cost a second waveform
+    const int left = std::min(highlight.x, shownHighlight.x);
+    const int top = std::min(highlight.y, shownHighlight.y);
+    const int right = std::max(highlight.x + highlight.width, shownHighlight.x + shownHighlight.width);
+    const int bottom = std::max(highlight.y + highlight.height, shownHighlight.y + shownHighlight.height);
+    renderer.displayWindow(left, top, right - left, bottom - top);
+    windowedMoves++;
+  }
+
+  shown = true;
+  shownLayoutKey = layoutKey;
+  shownHighlight = highlight;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <GfxRenderer.h>
+
+#include <cstdint>
+
+/**
+ * Puts menu and list screens on the panel, refreshing only what moved when just the selection changed.
+ *
+ * The activity draws its whole screen as before and hands over a key for everything on it but the highlight (the list
+ * page, setting values, the keyboard's text...) and the rectangle of the highlight. With the same key as the frame on
+ * the panel, only the old and the new highlight are refreshed, as one panel window around both. Anything else gets
+ * the whole screen. Every CLEANUP_MOVES windowed updates the next frame gets a half refresh to clear the ghosting
+ * they leave behind.
+ */
+class SelectionRefresh {
+ public:
+  static constexpr uint8_t CLEANUP_MOVES = 30;
+
+  struct Rect {
+    int x;
+    int y;
+    int width;
+    int height;
+  };
+
+  // Fold a value into a layout key
+  static uint32_t mix(const uint32_t key, const uint32_t value) { return (key ^ value) * 16777619u; }
+
+  // Display the frame in the renderer's buffer
+  void display(const GfxRenderer& renderer, uint32_t layoutKey, const Rect& highlight);
+  // Something else was drawn on the panel (a sub activity), the next frame goes out whole
+  void invalidate() { shown = false; }
+
+ private:
+  bool shown = false;
+  uint32_t shownLayoutKey = 0;
+  Rect shownHighlight = {};
+  uint8_t windowedMoves = 0;
+};
@@ -0,0 +1,235 @@
+#include "SleepImageManifest.h"
+
+#include <Arduino.h>
+#include <Bitmap.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <esp_attr.h>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+constexpr uint8_t MANIFEST_VERSION = 1;
+constexpr char SLEEP_DIR[] = "/sleep";
+constexpr char MANIFEST_FILE[] = "/.crosspoint/sleep.bin";
+constexpr char MANIFEST_TMP_FILE[] = "/.crosspoint/sleep.bin.tmp";
+constexpr size_t HEADER_SIZE = sizeof(MANIFEST_VERSION) + sizeof(uint16_t) * 3;
+
+// Kept in RTC memory through deep sleep, a power loss just starts the count over
+RTC_DATA_ATTR uint8_t sleepsSinceRebuild = 0;
+
+// FNV-1a over what identifies an unchanged file
+uint32_t recordKey(const SleepImageManifest::Record& record) {
+  uint32_t key = 2166136261u;
+  const auto mix = [&key](const uint8_t byte) { key = (key ^ byte) * 16777619u; };
+  for (const char* c = record.name; *c; c++) {
+    mix(static_cast<uint8_t>(*c));
+  }
+  for (int shift = 0; shift < 32; shift += 8) {
+    mix(static_cast<uint8_t>(record.size >> shift));
+  }
+  mix(static_cast<uint8_t>(record.modifyDate));
+  mix(static_cast<uint8_t>(record.modifyDate >> 8));
+  mix(static_cast<uint8_t>(record.modifyTime));
+  mix(static_cast<uint8_t>(record.modifyTime >> 8));
+  return key;
+}
+
+bool isBmpName(const char* name) {
+  const size_t length = strlen(name);
+  return length >= 4 && strcmp(name + length - 4, ".bmp") == 0;
+}
+}  // namespace
+
+bool SleepImageManifest::readHeader(FsFile& manifest, uint16_t& dirDate, uint16_t& dirTime, uint16_t& count) {
+  uint8_t version = 0;
+  serialization::readPod(manifest, version);
+  if (version != MANIFEST_VERSION) {
+    return false;
+  }
+  serialization::readPod(manifest, dirDate);
+  serialization::readPod(manifest, dirTime);
+  serialization::readPod(manifest, count);
+  return manifest.size() == HEADER_SIZE + count * sizeof(Record);
+}
+
+bool SleepImageManifest::readRecord(FsFile& manifest, const uint16_t index, Record& record) {
+  if (!manifest.seek(HEADER_SIZE + index * sizeof(Record))) {
+    return false;
+  }
+  return manifest.read(&record, sizeof(Record)) == sizeof(Record) && memchr(record.name, '\0', NAME_LENGTH);
+}
+
+uint16_t SleepImageManifest::rebuild(FsFile& dir, const uint16_t dirDate, const uint16_t dirTime) {
+  // Records of the previous manifest are reused for files that haven't changed. Only a key per record is held in
+  // memory, a match is read back from the old file.
+  std::vector<uint32_t> previousKeys;
+  FsFile previous;
+  if (SdMan.exists(MANIFEST_FILE) && SdMan.openFileForRead("SIM", MANIFEST_FILE, previous)) {
+    uint16_t previousDate, previousTime, previousCount;
+    if (readHeader(previous, previousDate, previousTime, previousCount)) {
+      previousKeys.reserve(previousCount);
+      Record record;
+      for (uint16_t i = 0; i < previousCount && readRecord(previous, i, record); i++) {
+        previousKeys.push_back(recordKey(record));
+      }
+    }
+  }
+
+  // The new manifest goes to a temporary file first, a rebuild cut short leaves the old one in place
+  FsFile manifest;
+  if (!SdMan.openFileForWrite("SIM", MANIFEST_TMP_FILE, manifest)) {
+    if (previous) previous.close();
+    return 0;
+  }
+  serialization::writePod(manifest, MANIFEST_VERSION);
+  serialization::writePod(manifest, dirDate);
+  serialization::writePod(manifest, dirTime);
+  serialization::writePod(manifest, static_cast<uint16_t>(0));
+
+  uint16_t count = 0;
+  size_t parsed = 0;
+  bool writeFailed = false;
+  dir.rewindDirectory();
+  for (auto file = dir.openNextFile(); file && count < UINT16_MAX && !writeFailed; file = dir.openNextFile()) {
+    Record record = {};
+    file.getName(record.name, NAME_LENGTH);
+    // Names that don't fit the record are skipped as well
+    if (file.isDirectory() || record.name[0] == '.' || record.name[0] == '\0' ||
+        strlen(record.name) >= NAME_LENGTH - 1) {
+      file.close();
+      continue;
+    }
+    if (!isBmpName(record.name)) {
+      Serial.printf("[%lu] [SIM] Skipping non-.bmp file name: %s\n", millis(), record.name);
+      file.close();
+      continue;
+    }
+
+    record.size = file.size();
+    file.getModifyDateTime(&record.modifyDate, &record.modifyTime);
+    bool known = false;
+    const uint32_t key = recordKey(record);
+    for (size_t i = 0; i < previousKeys.size() && !known; i++) {
+      Record candidate;
+      known = previousKeys[i] == key && readRecord(previous, i, candidate) && candidate.size == record.size &&
+              candidate.modifyDate == record.modifyDate && candidate.modifyTime == record.modifyTime &&
+              strcmp(candidate.name, record.name) == 0;
+      if (known) {
+        record = candidate;
+      }
+    }
+
+    if (!known) {
+      Bitmap bitmap(file);
+      if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+        Serial.printf("[%lu] [SIM] Skipping invalid BMP file: %s\n", millis(), record.name);
+        file.close();
+        continue;
+      }
+      record.width = bitmap.getWidth();
+      record.height = bitmap.getHeight();
+      record.bpp = bitmap.getBpp();
+      parsed++;
+    }
+    file.close();
+
+    writeFailed = manifest.write(reinterpret_cast<const uint8_t*>(&record), sizeof(Record)) != sizeof(Record);
+    count++;
+  }
+  if (previous) previous.close();
+
+  sleepsSinceRebuild = 0;
+  // The record count is the last field of the header
+  writeFailed = writeFailed || !manifest.seek(HEADER_SIZE - sizeof(count));
+  if (!writeFailed) {
+    serialization::writePod(manifest, count);
+  }
+  manifest.close();
+  if (writeFailed) {
+    Serial.printf("[%lu] [SIM] Could not write sleep image manifest\n", millis());
+    SdMan.remove(MANIFEST_TMP_FILE);
+    return 0;
+  }
+
+  if (SdMan.exists(MANIFEST_FILE)) {
+    SdMan.remove(MANIFEST_FILE);
+  }
+  if (!SdMan.rename(MANIFEST_TMP_FILE, MANIFEST_FILE)) {
+    Serial.printf("[%lu] [SIM] Could not move sleep image manifest into place\n", millis());
+    return 0;
+  }
+
+  Serial.printf("[%lu] [SIM] Indexed %u sleep images (%u parsed)\n", millis(), count, parsed);
+  return count;
+}
+
+bool SleepImageManifest::openRandomImage(FsFile& file, std::string& name) {
+  auto dir = SdMan.open(SLEEP_DIR);
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return false;
+  }
+  uint16_t dirDate = 0;
+  uint16_t dirTime = 0;
+  dir.getModifyDateTime(&dirDate, &dirTime);
+
+  uint16_t count = 0;
+  bool rebuilt = false;
+  FsFile manifest;
+  uint16_t manifestDate, manifestTime;
+  if (++sleepsSinceRebuild > REVALIDATE_SLEEPS || !SdMan.exists(MANIFEST_FILE) ||
+      !SdMan.openFileForRead("SIM", MANIFEST_FILE, manifest) ||
+      !readHeader(manifest, manifestDate, manifestTime, count) || manifestDate != dirDate ||
+      manifestTime != dirTime) {
+    if (manifest) manifest.close();
+    count = rebuild(dir, dirDate, dirTime);
+    rebuilt = true;
+  }
+
+  while (count > 0) {
+    if (!manifest && !SdMan.openFileForRead("SIM", MANIFEST_FILE, manifest)) {
+      break;
+    }
+
+    Record record;
+    if (readRecord(manifest, random(count), record)) {
+      const std::string path = std::string(SLEEP_DIR) + "/" + record.name;
+      if (SdMan.openFileForRead("SIM", path, file)) {
+        uint16_t modifyDate = 0;
+        uint16_t modifyTime = 0;
+        file.getModifyDateTime(&modifyDate, &modifyTime);
+        if (file.size() == record.size && modifyDate == record.modifyDate && modifyTime == record.modifyTime) {
+          manifest.close();
+          dir.close();
+          name = record.name;
+          return true;
+        }
+        file.close();
+      }
+    }
+    manifest.close();
+
+    if (rebuilt) {
+      break;
+    }
+    Serial.printf("[%lu] [SIM] Sleep image manifest is stale, rebuilding\n", millis());
+    count = rebuild(dir, dirDate, dirTime);
+    rebuilt = true;
+  }
+
+  if (manifest) manifest.close();
+  dir.close();
+  return false;
+}
+
+void SleepImageManifest::invalidate(const char* changedPath) {
+  constexpr size_t dirLength = sizeof(SLEEP_DIR) - 1;
+  if (strncmp(changedPath, SLEEP_DIR, dirLength) != 0 || changedPath[dirLength] != '/') {
+    return;
+  }
+  if (SdMan.exists(MANIFEST_FILE)) {
+    SdMan.remove(MANIFEST_FILE);
+  }
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Manifest of the usable BMPs in /sleep, so going to sleep reads one fixed size record instead of opening and parsing
+ * the headers of every file in the folder.
+ *
+ * The manifest is rebuilt when
+ * - the modification time of /sleep changed,
+ * - the web server added or removed a file in it (invalidate()),
+ * - the picked file no longer matches its record (deleted or replaced),
+ * - every REVALIDATE_SLEEPS sleeps, for copies that leave the folder time alone.
+ * A rebuild walks the folder but keeps the records of files whose size and time are unchanged, so only new images are
+ * parsed.
+ */
+class SleepImageManifest {
+ public:
+  static constexpr size_t NAME_LENGTH = 128;
+  static constexpr uint8_t REVALIDATE_SLEEPS = 20;
+
+  struct Record {
+    char name[NAME_LENGTH];  // NUL terminated, relative to /sleep
+    uint32_t size;
+    uint16_t modifyDate;
+    uint16_t modifyTime;
+    uint16_t width;
+    uint16_t height;
+    uint16_t bpp;
+  };
+
+  // Open a random image from /sleep, false if there is none
+  static bool openRandomImage(FsFile& file, std::string& name);
+  // Call after changing a file, rebuilds the manifest on the next sleep if it was in /sleep
+  static void invalidate(const char* changedPath);
+
+ private:
+  static bool readHeader(FsFile& manifest, uint16_t& dirDate, uint16_t& dirTime, uint16_t& count);
+  static bool readRecord(FsFile& manifest, uint16_t index, Record& record);
+  static uint16_t rebuild(FsFile& dir, uint16_t dirDate, uint16_t dirTime);
+};
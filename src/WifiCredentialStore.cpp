@@ -4,12 +4,14 @@
 #include <SDCardManager.h>
 #include <Serialization.h>
 
+#include <cstring>
+
 // Initialize the static instance
 WifiCredentialStore WifiCredentialStore::instance;
 
 namespace {
-// File format version
-constexpr uint8_t WIFI_FILE_VERSION = 1;
+// File format version, version 1 files (no connection cache) are still read
+constexpr uint8_t WIFI_FILE_VERSION = 2;
 
 // WiFi credentials file path
 constexpr char WIFI_FILE[] = "/.crosspoint/wifi.bin";
@@ -51,7 +53,11 @@ bool WifiCredentialStore::saveToFile() const {
     std::string obfuscatedPwd = cred.password;
     obfuscate(obfuscatedPwd);
     serialization::writeString(file, obfuscatedPwd);
+
+    serialization::writePod(file, cred.bssid);
+    serialization::writePod(file, cred.channel);
   }
+  serialization::writeString(file, lastConnectedSsid);
 
   file.close();
   Serial.printf("[%lu] [WCS] Saved %zu WiFi credentials to file\n", millis(), credentials.size());
@@ -67,7 +73,7 @@ bool WifiCredentialStore::loadFromFile() {
   // Read and verify version
   uint8_t version;
   serialization::readPod(file, version);
-  if (version != WIFI_FILE_VERSION) {
+  if (version != WIFI_FILE_VERSION && version != 1) {
     Serial.printf("[%lu] [WCS] Unknown file version: %u\n", millis(), version);
     file.close();
     return false;
@@ -92,9 +98,19 @@ bool WifiCredentialStore::loadFromFile() {
     obfuscate(cred.password);  // XOR is symmetric, so same function deobfuscates
     Serial.printf("[%lu] [WCS] After deobfuscation, password length: %zu\n", millis(), cred.password.size());
 
+    if (version >= 2) {
+      serialization::readPod(file, cred.bssid);
+      serialization::readPod(file, cred.channel);
+    }
+
     credentials.push_back(cred);
   }
 
+  lastConnectedSsid.clear();
+  if (version >= 2) {
+    serialization::readString(file, lastConnectedSsid);
+  }
+
   file.close();
   Serial.printf("[%lu] [WCS] Loaded %zu WiFi credentials from file\n", millis(), credentials.size());
   return true;
@@ -105,6 +121,10 @@ bool WifiCredentialStore::addCredential(const std::string& ssid, const std::stri
   const auto cred = find_if(credentials.begin(), credentials.end(),
                             [&ssid](const WifiCredential& cred) { return cred.ssid == ssid; });
   if (cred != credentials.end()) {
+    if (cred->password != password) {
+      // A changed password usually means a changed network, don't trust the cached access point
+      cred->channel = 0;
+    }
     cred->password = password;
     Serial.printf("[%lu] [WCS] Updated credentials for: %s\n", millis(), ssid.c_str());
     return saveToFile();
@@ -117,7 +137,10 @@ bool WifiCredentialStore::addCredential(const std::string& ssid, const std::stri
   }
 
   // Add new credential
-  credentials.push_back({ssid, password});
+  WifiCredential newCred;
+  newCred.ssid = ssid;
+  newCred.password = password;
+  credentials.push_back(newCred);
   Serial.printf("[%lu] [WCS] Added credentials for: %s\n", millis(), ssid.c_str());
   return saveToFile();
 }
@@ -144,10 +167,36 @@ const WifiCredential* WifiCredentialStore::findCredential(const std::string& ssi
   return nullptr;
 }
 
+bool WifiCredentialStore::updateConnectionCache(const std::string& ssid, const uint8_t* bssid, const uint8_t channel) {
+  const auto cred = find_if(credentials.begin(), credentials.end(),
+                            [&ssid](const WifiCredential& cred) { return cred.ssid == ssid; });
+  if (cred == credentials.end() || !bssid) {
+    return false;
+  }
+
+  if (lastConnectedSsid == ssid && cred->channel == channel && memcmp(cred->bssid, bssid, sizeof(cred->bssid)) == 0) {
+    return true;
+  }
+
+  memcpy(cred->bssid, bssid, sizeof(cred->bssid));
+  cred->channel = channel;
+  lastConnectedSsid = ssid;
+  Serial.printf("[%lu] [WCS] Cached connection for %s on channel %u\n", millis(), ssid.c_str(), channel);
+  return saveToFile();
+}
+
+const WifiCredential* WifiCredentialStore::getLastConnected() const {
+  if (lastConnectedSsid.empty()) {
+    return nullptr;
+  }
+  return findCredential(lastConnectedSsid);
+}
+
 bool WifiCredentialStore::hasSavedCredential(const std::string& ssid) const { return findCredential(ssid) != nullptr; }
 
 void WifiCredentialStore::clearAll() {
   credentials.clear();
+  lastConnectedSsid.clear();
   saveToFile();
   Serial.printf("[%lu] [WCS] Cleared all WiFi credentials\n", millis());
 }
@@ -1,10 +1,17 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
 struct WifiCredential {
   std::string ssid;
   std::string password;  // Stored obfuscated in file
+
+  // Remembered from the last successful connection so reconnecting can skip the scan (channel 0 = none)
+  uint8_t bssid[6] = {};
+  uint8_t channel = 0;
+
+  bool hasConnectionCache() const { return channel != 0; }
 };
 
 /**
@@ -16,6 +23,7 @@ class WifiCredentialStore {
  private:
   static WifiCredentialStore instance;
   std::vector<WifiCredential> credentials;
+  std::string lastConnectedSsid;
 
   static constexpr size_t MAX_NETWORKS = 8;
 
@@ -42,6 +50,11 @@ class WifiCredentialStore {
   bool removeCredential(const std::string& ssid);
   const WifiCredential* findCredential(const std::string& ssid) const;
 
+  // Remember the access point of a successful connection, only writes the file when something changed
+  bool updateConnectionCache(const std::string& ssid, const uint8_t* bssid, uint8_t channel);
+  // Saved network that was connected to most recently, nullptr if there is none
+  const WifiCredential* getLastConnected() const;
+
   // Get all stored credentials (for UI display)
   const std::vector<WifiCredential>& getCredentials() const { return credentials; }
 
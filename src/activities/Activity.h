@@ -22,4 +22,6 @@ class Activity {
   virtual void onExit() { Serial.printf("[%lu] [ACT] Exiting activity: %s\n", millis(), name.c_str()); }
   virtual void loop() {}
   virtual bool skipLoopDelay() { return false; }
+  // A frame was asked for but the display task has not put it on the panel yet
+  virtual bool isRenderPending() { return false; }
 };
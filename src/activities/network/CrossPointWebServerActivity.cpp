@@ -6,10 +6,12 @@
 #include <WiFi.h>
 #include <qrcode.h>
 
+#include <algorithm>
 #include <cstddef>
 
 #include "MappedInputManager.h"
 #include "NetworkModeSelectionActivity.h"
+#include "OpdsBrowserActivity.h"
 #include "WifiSelectionActivity.h"
 #include "fontIds.h"
 
@@ -126,7 +128,9 @@ void CrossPointWebServerActivity::onExit() {
 
 void CrossPointWebServerActivity::onNetworkModeSelected(const NetworkMode mode) {
   Serial.printf("[%lu] [WEBACT] Network mode selected: %s\n", millis(),
-                mode == NetworkMode::JOIN_NETWORK ? "Join Network" : "Create Hotspot");
+                mode == NetworkMode::JOIN_NETWORK     ? "Join Network"
+                : mode == NetworkMode::CREATE_HOTSPOT ? "Create Hotspot"
+                                                      : "OPDS Catalog");
 
   networkMode = mode;
   isApMode = (mode == NetworkMode::CREATE_HOTSPOT);
@@ -134,7 +138,7 @@ void CrossPointWebServerActivity::onNetworkModeSelected(const NetworkMode mode)
   // Exit mode selection subactivity
   exitActivity();
 
-  if (mode == NetworkMode::JOIN_NETWORK) {
+  if (mode == NetworkMode::JOIN_NETWORK || mode == NetworkMode::OPDS_CATALOG) {
     // STA mode - launch WiFi selection
     Serial.printf("[%lu] [WEBACT] Turning on WiFi (STA mode)...\n", millis());
     WiFi.mode(WIFI_STA);
@@ -162,6 +166,14 @@ void CrossPointWebServerActivity::onWifiSelectionComplete(const bool connected)
 
     exitActivity();
 
+    if (networkMode == NetworkMode::OPDS_CATALOG) {
+      // Browsing the catalog needs no server, leaving it goes straight home
+      state = WebServerActivityState::OPDS_BROWSING;
+      Serial.printf("[%lu] [WEBACT] Launching OpdsBrowserActivity...\n", millis());
+      enterNewActivity(new OpdsBrowserActivity(renderer, mappedInput, [this]() { onGoBack(); }));
+      return;
+    }
+
     // Start mDNS for hostname resolution
     if (MDNS.begin(AP_HOSTNAME)) {
       Serial.printf("[%lu] [WEBACT] mDNS started: http://%s.local/\n", millis(), AP_HOSTNAME);
@@ -302,6 +314,16 @@ void CrossPointWebServerActivity::loop() {
         webServer->handleClient();
       }
       lastHandleClientTime = millis();
+
+      // Build caches for freshly uploaded books once the transfer has settled.
+      // The SD card shares the SPI bus with the display, so hold the rendering mutex.
+      auto& preIndexer = webServer->getPreIndexer();
+      if (preIndexer.hasPending() && webServer->isIdle()) {
+        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        preIndexer.processNext();
+        xSemaphoreGive(renderingMutex);
+        updateRequired = true;
+      }
     }
 
     // Handle exit on Back button
@@ -425,6 +447,24 @@ void CrossPointWebServerActivity::renderServerRunning() const {
     renderer.drawCenteredText(SMALL_FONT_ID, startY + LINE_SPACING * 5, "or scan QR code with your phone:");
   }
 
+  // Pre-indexing status for uploaded books
+  if (webServer) {
+    const auto& preIndexer = webServer->getPreIndexer();
+    const size_t pending = preIndexer.getPendingCount();
+    if (pending > 0) {
+      const std::string status = "Preparing " + std::to_string(pending) + (pending == 1 ? " book" : " books") +
+                                 " for reading...";
+      renderer.drawCenteredText(SMALL_FONT_ID, renderer.getScreenHeight() - 70, status.c_str());
+    } else if (!preIndexer.getEntries().empty()) {
+      const auto& entries = preIndexer.getEntries();
+      const bool anyFailed = std::any_of(entries.begin(), entries.end(), [](const BookPreIndexer::Entry& entry) {
+        return entry.status == BookPreIndexer::Status::FAILED;
+      });
+      renderer.drawCenteredText(SMALL_FONT_ID, renderer.getScreenHeight() - 70,
+                                anyFailed ? "Some uploaded books could not be prepared" : "Uploaded books are ready");
+    }
+  }
+
   const auto labels = mappedInput.mapLabels("« Exit", "", "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 }
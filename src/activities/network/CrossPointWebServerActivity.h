@@ -17,6 +17,7 @@ enum class WebServerActivityState {
   WIFI_SELECTION,  // WiFi selection subactivity is active (for Join Network mode)
   AP_STARTING,     // Starting Access Point mode
   SERVER_RUNNING,  // Web server is running and handling requests
+  OPDS_BROWSING,   // OPDS catalog browser subactivity is active
   SHUTTING_DOWN    // Shutting down server and WiFi
 };
 
@@ -26,6 +27,7 @@ enum class WebServerActivityState {
  * - First presents a choice between "Join a Network" (STA) and "Create Hotspot" (AP)
  * - For STA mode: Launches WifiSelectionActivity to connect to an existing network
  * - For AP mode: Creates an Access Point that clients can connect to
+ * - For OPDS mode: Joins a network like STA mode, then launches OpdsBrowserActivity instead of the server
  * - Starts the CrossPointWebServer when connected
  * - Handles client requests in its loop() function
  * - Cleans up the server and shuts down WiFi on exit
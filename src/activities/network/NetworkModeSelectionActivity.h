@@ -8,12 +8,13 @@
 #include "../Activity.h"
 
 // Enum for network mode selection
-enum class NetworkMode { JOIN_NETWORK, CREATE_HOTSPOT };
+enum class NetworkMode { JOIN_NETWORK, CREATE_HOTSPOT, OPDS_CATALOG };
 
 /**
  * NetworkModeSelectionActivity presents the user with a choice:
  * - "Join a Network" - Connect to an existing WiFi network (STA mode)
  * - "Create Hotspot" - Create an Access Point that others can connect to (AP mode)
+ * - "Browse OPDS Catalog" - Join a network and download books from the configured OPDS server
  *
  * The onModeSelected callback is called with the user's choice.
  * The onCancel callback is called if the user presses back.
@@ -0,0 +1,461 @@
+#include "OpdsBrowserActivity.h"
+
+#include <GfxRenderer.h>
+#include <SDCardManager.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "CrossPointSettings.h"
+#include "MappedInputManager.h"
+#include "fontIds.h"
+#include "network/BookPreIndexer.h"
+#include "network/HttpDownloader.h"
+
+namespace {
+constexpr int PAGE_ITEMS = 12;
+constexpr int headerY = 16;
+constexpr int separatorY = 42;
+constexpr int listStartY = 54;
+constexpr int rowHeight = 52;
+constexpr int horizontalMargin = 16;
+// Longest file name generated from a book title, in bytes
+constexpr size_t MAX_FILE_NAME_LENGTH = 80;
+
+// Resolve a link from a feed against the URL of the feed it appeared in
+std::string resolveUrl(const std::string& base, const std::string& href) {
+  if (href.find("://") != std::string::npos) {
+    return href;
+  }
+  const size_t schemeEnd = base.find("://");
+  if (schemeEnd == std::string::npos || href.empty()) {
+    return href;
+  }
+  if (href.rfind("//", 0) == 0) {
+    return base.substr(0, schemeEnd + 1) + href;
+  }
+
+  const size_t pathStart = base.find('/', schemeEnd + 3);
+  const std::string origin = base.substr(0, pathStart);
+  if (href[0] == '/') {
+    return origin + href;
+  }
+
+  std::string path = pathStart == std::string::npos ? "/" : base.substr(pathStart, base.find('?') - pathStart);
+  if (href[0] == '?') {
+    return origin + path + href;
+  }
+  path.erase(path.rfind('/') + 1);
+  return origin + path + href;
+}
+
+// SD card path for a downloaded book, named after its title and author so books that share a title don't replace
+// each other
+std::string bookPath(const std::string& title, const std::string& author) {
+  std::string name = author.empty() ? title : title + " - " + author;
+  for (auto& c : name) {
+    if (static_cast<uint8_t>(c) < 0x20 || strchr("\\/:*?\"<>|", c)) {
+      c = '_';
+    }
+  }
+  if (name.length() > MAX_FILE_NAME_LENGTH) {
+    size_t cut = MAX_FILE_NAME_LENGTH;
+    while (cut > 0 && (static_cast<uint8_t>(name[cut]) & 0xC0) == 0x80) {
+      cut--;
+    }
+    name.resize(cut);
+  }
+  if (name.empty() || name[0] == '.') {
+    name.insert(0, "book");
+  }
+  return "/" + name + ".epub";
+}
+}  // namespace
+
+void OpdsBrowserActivity::taskTrampoline(void* param) {
+  auto* self = static_cast<OpdsBrowserActivity*>(param);
+  self->displayTaskLoop();
+}
+
+void OpdsBrowserActivity::onEnter() {
+  Activity::onEnter();
+
+  renderingMutex = xSemaphoreCreateMutex();
+
+  state = LOADING;
+  history.clear();
+  entries.clear();
+  feedTitle.clear();
+  selectorIndex = 0;
+  updateRequired = true;
+
+  xTaskCreate(&OpdsBrowserActivity::taskTrampoline, "OpdsBrowserTask",
+              4096,               // Stack size
+              this,               // Parameters
+              1,                  // Priority
+              &displayTaskHandle  // Task handle
+  );
+
+  FeedPosition root;
+  root.url = SETTINGS.opdsServerUrl;
+  loadFeed(root);
+}
+
+void OpdsBrowserActivity::onExit() {
+  Activity::onExit();
+
+  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  if (displayTaskHandle) {
+    vTaskDelete(displayTaskHandle);
+    displayTaskHandle = nullptr;
+  }
+  vSemaphoreDelete(renderingMutex);
+  renderingMutex = nullptr;
+  entries.clear();
+  history.clear();
+}
+
+void OpdsBrowserActivity::setState(const State newState) {
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  state = newState;
+  xSemaphoreGive(renderingMutex);
+  updateRequired = true;
+}
+
+void OpdsBrowserActivity::loadFeed(const FeedPosition& target) {
+  position = target;
+  downloadPath.clear();
+  if (target.url.empty()) {
+    statusMessage = "Set the OPDS server in Settings";
+    setState(FAILED);
+    return;
+  }
+
+  setState(LOADING);
+  vTaskDelay(10 / portTICK_PERIOD_MS);
+  const unsigned long start = millis();
+
+  // Only the requested window of the feed is kept, everything before it is counted and dropped
+  std::vector<OpdsEntry> loaded;
+  bool moreInFeed = false;
+  int seen = 0;
+  OpdsFeedParser parser([&](const OpdsEntry& entry) {
+    if (seen++ < target.skip) {
+      return true;
+    }
+    if (static_cast<int>(loaded.size()) == FEED_WINDOW) {
+      moreInFeed = true;
+      return false;
+    }
+    loaded.push_back(entry);
+    return true;
+  });
+
+  if (!parser.setup()) {
+    statusMessage = "Out of memory";
+    setState(FAILED);
+    return;
+  }
+  const auto res = HttpDownloader::fetch(target.url, [&parser](const uint8_t* data, const size_t len) {
+    return parser.write(data, len) == len && !parser.isStopped();
+  });
+  if (res != HttpDownloader::OK || !parser.finish()) {
+    Serial.printf("[%lu] [OPDS] Could not load %s (%d)\n", millis(), target.url.c_str(), res);
+    statusMessage = res == HttpDownloader::OK ? "Not a valid OPDS feed" : "Could not reach the catalog";
+    setState(FAILED);
+    return;
+  }
+  Serial.printf("[%lu] [OPDS] Loaded %zu entries (skipped %d) in %lu ms\n", millis(), loaded.size(), target.skip,
+                millis() - start);
+
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  entries.swap(loaded);
+  feedTitle = parser.feedTitle;
+  nextWindow = FeedPosition();
+  if (moreInFeed) {
+    nextWindow.url = target.url;
+    nextWindow.skip = target.skip + FEED_WINDOW;
+  } else if (!parser.nextHref.empty()) {
+    nextWindow.url = resolveUrl(target.url, parser.nextHref);
+  }
+  selectorIndex = std::max(0, std::min(target.selected, static_cast<int>(entries.size()) - 1));
+  state = BROWSING;
+  xSemaphoreGive(renderingMutex);
+  updateRequired = true;
+}
+
+void OpdsBrowserActivity::openSelected() {
+  if (selectorIndex >= static_cast<int>(entries.size())) {
+    return;
+  }
+
+  const OpdsEntry entry = entries[selectorIndex];
+  if (entry.type == OpdsEntry::Type::BOOK) {
+    downloadBook(entry);
+    return;
+  }
+
+  FeedPosition current = position;
+  current.selected = selectorIndex;
+  current.isPrevious = false;
+  history.push_back(current);
+  if (history.size() > MAX_HISTORY) {
+    history.erase(history.begin());
+  }
+
+  FeedPosition target;
+  target.url = resolveUrl(position.url, entry.href);
+  loadFeed(target);
+}
+
+void OpdsBrowserActivity::goForward() {
+  FeedPosition current = position;
+  current.selected = selectorIndex;
+  current.isPrevious = true;
+  history.push_back(current);
+  if (history.size() > MAX_HISTORY) {
+    history.erase(history.begin());
+  }
+
+  loadFeed(nextWindow);
+}
+
+void OpdsBrowserActivity::goBack() {
+  if (history.empty()) {
+    onGoBack();
+    return;
+  }
+
+  const FeedPosition previous = history.back();
+  history.pop_back();
+  loadFeed(previous);
+}
+
+void OpdsBrowserActivity::downloadBook(const OpdsEntry& entry) {
+  downloadTitle = entry.title;
+  downloadPath = bookPath(entry.title, entry.author);
+  downloadedSize = 0;
+  downloadTotalSize = 0;
+  lastDownloadStep = -1;
+
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  const bool alreadyDownloaded = SdMan.exists(downloadPath.c_str());
+  xSemaphoreGive(renderingMutex);
+
+  if (alreadyDownloaded) {
+    Serial.printf("[%lu] [OPDS] %s already on SD card\n", millis(), downloadPath.c_str());
+  } else {
+    setState(DOWNLOADING);
+    const auto res = HttpDownloader::downloadToFile(
+        resolveUrl(position.url, entry.href), downloadPath, renderingMutex,
+        [this](const size_t downloaded, const size_t total) {
+          downloadedSize = downloaded;
+          downloadTotalSize = total;
+          // Redraw every 2%, or every 256 KB when the size is unknown
+          const int step = total > 0 ? static_cast<int>(downloaded * 50 / total) : static_cast<int>(downloaded >> 18);
+          if (step != lastDownloadStep) {
+            lastDownloadStep = step;
+            updateRequired = true;
+          }
+        });
+    if (res != HttpDownloader::OK) {
+      statusMessage = res == HttpDownloader::FILE_ERROR ? "Could not write to SD card"
+                                                        : "Download failed, select the book again to resume";
+      setState(FAILED);
+      return;
+    }
+  }
+
+  // Build the cache now so opening the book for the first time is quick
+  setState(INDEXING);
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  BookPreIndexer indexer;
+  if (!alreadyDownloaded) {
+    // A cache left behind by an earlier file at this path belongs to another book
+    BookPreIndexer::clearCache(downloadPath);
+  }
+  indexer.enqueue(downloadPath);
+  while (indexer.processNext()) {
+  }
+  const auto* indexed = indexer.findEntry(downloadPath);
+  const bool ready = indexed && indexed->status == BookPreIndexer::Status::READY;
+  xSemaphoreGive(renderingMutex);
+
+  statusMessage = ready ? "Ready to read" : "Saved, but the book could not be prepared";
+  setState(DOWNLOADED);
+}
+
+void OpdsBrowserActivity::loop() {
+  if (state == FAILED) {
+    if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+      if (!downloadPath.empty()) {
+        setState(BROWSING);
+      } else {
+        goBack();
+      }
+    } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
+      if (!downloadPath.empty()) {
+        openSelected();
+      } else {
+        loadFeed(position);
+      }
+    }
+    return;
+  }
+
+  if (state == DOWNLOADED) {
+    if (mappedInput.wasPressed(MappedInputManager::Button::Back) ||
+        mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
+      setState(BROWSING);
+    }
+    return;
+  }
+
+  if (state != BROWSING) {
+    return;
+  }
+
+  if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+    goBack();
+    return;
+  }
+
+  if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
+    openSelected();
+    return;
+  }
+
+  const bool prevPressed = mappedInput.wasPressed(MappedInputManager::Button::Up) ||
+                           mappedInput.wasPressed(MappedInputManager::Button::Left);
+  const bool nextPressed = mappedInput.wasPressed(MappedInputManager::Button::Down) ||
+                           mappedInput.wasPressed(MappedInputManager::Button::Right);
+
+  if (prevPressed) {
+    if (selectorIndex > 0) {
+      selectorIndex--;
+      updateRequired = true;
+    } else if (!history.empty() && history.back().isPrevious) {
+      // Scrolling up past the first entry returns to the previous window
+      goBack();
+    }
+  } else if (nextPressed) {
+    if (selectorIndex < static_cast<int>(entries.size()) - 1) {
+      selectorIndex++;
+      updateRequired = true;
+    } else if (!nextWindow.url.empty()) {
+      goForward();
+    }
+  }
+}
+
+void OpdsBrowserActivity::displayTaskLoop() {
+  while (true) {
+    if (updateRequired) {
+      updateRequired = false;
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      render();
+      xSemaphoreGive(renderingMutex);
+    }
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+}
+
+void OpdsBrowserActivity::render() const {
+  renderer.clearScreen();
+
+  if (state == BROWSING) {
+    renderList();
+  } else if (state == LOADING) {
+    renderer.drawCenteredText(UI_12_FONT_ID, headerY, "OPDS Catalog", true, EpdFontFamily::BOLD);
+    renderer.drawCenteredText(UI_10_FONT_ID, 300, "Loading...", true, EpdFontFamily::BOLD);
+  } else {
+    renderDownload();
+  }
+
+  renderer.displayBuffer();
+}
+
+void OpdsBrowserActivity::renderList() const {
+  const auto pageWidth = renderer.getScreenWidth();
+  const int textWidth = pageWidth - horizontalMargin * 2 - 8;
+
+  const std::string title =
+      renderer.truncatedText(UI_12_FONT_ID, feedTitle.empty() ? "OPDS Catalog" : feedTitle.c_str(), textWidth,
+                             EpdFontFamily::BOLD);
+  renderer.drawCenteredText(UI_12_FONT_ID, headerY, title.c_str(), true, EpdFontFamily::BOLD);
+  renderer.drawLine(horizontalMargin, separatorY, pageWidth - horizontalMargin, separatorY);
+
+  if (entries.empty()) {
+    renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4, listStartY, "No books here");
+    const auto labels = mappedInput.mapLabels("« Back", "", "", "");
+    renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+    return;
+  }
+
+  const int pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
+  renderer.fillRect(0, listStartY + (selectorIndex % PAGE_ITEMS) * rowHeight - 2, pageWidth - 1, rowHeight - 4);
+  for (int i = pageStartIndex; i < static_cast<int>(entries.size()) && i < pageStartIndex + PAGE_ITEMS; i++) {
+    const auto& entry = entries[i];
+    const int y = listStartY + (i % PAGE_ITEMS) * rowHeight;
+    const bool black = i != selectorIndex;
+
+    const std::string name = renderer.truncatedText(UI_10_FONT_ID, entry.title.c_str(), textWidth);
+    renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4, y, name.c_str(), black);
+
+    const char* detail = entry.type == OpdsEntry::Type::BOOK
+                             ? (entry.author.empty() ? "EPUB" : entry.author.c_str())
+                             : "Catalog";
+    const std::string detailText = renderer.truncatedText(SMALL_FONT_ID, detail, textWidth);
+    renderer.drawText(SMALL_FONT_ID, horizontalMargin + 4, y + 24, detailText.c_str(), black);
+  }
+
+  // Tell the user there is more to scroll into when this screen ends the window
+  const bool lastScreen = pageStartIndex + PAGE_ITEMS >= static_cast<int>(entries.size());
+  if (lastScreen && !nextWindow.url.empty()) {
+    renderer.drawText(SMALL_FONT_ID, horizontalMargin + 4, listStartY + PAGE_ITEMS * rowHeight, "More below...");
+  }
+
+  const bool isBook = entries[selectorIndex].type == OpdsEntry::Type::BOOK;
+  const auto labels = mappedInput.mapLabels("« Back", isBook ? "Download" : "Open", "", "");
+  renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+}
+
+void OpdsBrowserActivity::renderDownload() const {
+  const auto pageWidth = renderer.getScreenWidth();
+
+  renderer.drawCenteredText(UI_12_FONT_ID, headerY, "OPDS Catalog", true, EpdFontFamily::BOLD);
+
+  if (state == FAILED) {
+    renderer.drawCenteredText(UI_10_FONT_ID, 300, statusMessage.c_str(), true, EpdFontFamily::BOLD);
+    const auto labels = mappedInput.mapLabels("« Back", "Retry", "", "");
+    renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+    return;
+  }
+
+  const std::string title = renderer.truncatedText(UI_10_FONT_ID, downloadTitle.c_str(), pageWidth - 40);
+  renderer.drawCenteredText(UI_10_FONT_ID, 260, title.c_str());
+
+  if (state == DOWNLOADING) {
+    renderer.drawCenteredText(UI_10_FONT_ID, 310, "Downloading...", true, EpdFontFamily::BOLD);
+    if (downloadTotalSize > 0) {
+      const float progress = static_cast<float>(downloadedSize) / static_cast<float>(downloadTotalSize);
+      renderer.drawRect(20, 350, pageWidth - 40, 50);
+      renderer.fillRect(24, 354, static_cast<int>(progress * static_cast<float>(pageWidth - 44)), 42);
+      renderer.drawCenteredText(UI_10_FONT_ID, 420, (std::to_string(static_cast<int>(progress * 100)) + "%").c_str());
+    }
+    renderer.drawCenteredText(UI_10_FONT_ID, 440, (std::to_string(downloadedSize / 1024) + " KB").c_str());
+    return;
+  }
+
+  if (state == INDEXING) {
+    renderer.drawCenteredText(UI_10_FONT_ID, 310, "Preparing book...", true, EpdFontFamily::BOLD);
+    return;
+  }
+
+  renderer.drawCenteredText(UI_10_FONT_ID, 310, "Download complete", true, EpdFontFamily::BOLD);
+  renderer.drawCenteredText(UI_10_FONT_ID, 340, statusMessage.c_str());
+  renderer.drawCenteredText(SMALL_FONT_ID, 370, downloadPath.c_str());
+  const auto labels = mappedInput.mapLabels("« Back", "", "", "");
+  renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+}
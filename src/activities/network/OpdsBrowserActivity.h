@@ -0,0 +1,76 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../Activity.h"
+#include "network/OpdsFeedParser.h"
+
+/**
+ * OpdsBrowserActivity browses the OPDS catalog configured in settings and downloads books from it.
+ * It expects WiFi to be connected already and:
+ * - Streams each feed through OpdsFeedParser, keeping only a window of FEED_WINDOW entries in memory
+ * - Moves to the next window (or the feed's next page) when scrolling past the last entry
+ * - Downloads the selected EPUB to the SD card root, resuming a partial download of the same book
+ * - Builds the book's cache right after the download so the first open is fast
+ */
+class OpdsBrowserActivity final : public Activity {
+  enum State { LOADING, BROWSING, DOWNLOADING, INDEXING, DOWNLOADED, FAILED };
+
+  // Where a list came from, enough to fetch it again when navigating back
+  struct FeedPosition {
+    std::string url;
+    int skip = 0;             // Entries of the feed before this window
+    int selected = 0;         // Selected entry when the position was left
+    bool isPrevious = false;  // Left by scrolling forward rather than opening a sub-catalog
+  };
+
+  // Entries held in memory at once, larger feeds are fetched again for each window
+  static constexpr int FEED_WINDOW = 36;
+  static constexpr size_t MAX_HISTORY = 16;
+
+  TaskHandle_t displayTaskHandle = nullptr;
+  SemaphoreHandle_t renderingMutex = nullptr;
+  bool updateRequired = false;
+  const std::function<void()> onGoBack;
+
+  State state = LOADING;
+  FeedPosition position;
+  std::vector<FeedPosition> history;
+  std::string feedTitle;
+  std::vector<OpdsEntry> entries;
+  FeedPosition nextWindow;  // url is empty when this is the last window of the last page
+  int selectorIndex = 0;
+  std::string statusMessage;
+
+  std::string downloadTitle;
+  std::string downloadPath;
+  size_t downloadedSize = 0;
+  size_t downloadTotalSize = 0;
+  int lastDownloadStep = -1;
+
+  static void taskTrampoline(void* param);
+  [[noreturn]] void displayTaskLoop();
+  void render() const;
+  void renderList() const;
+  void renderDownload() const;
+
+  void setState(State newState);
+  void loadFeed(const FeedPosition& target);
+  void openSelected();
+  void goForward();
+  void goBack();
+  void downloadBook(const OpdsEntry& entry);
+
+ public:
+  explicit OpdsBrowserActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
+                               const std::function<void()>& onGoBack)
+      : Activity("OpdsBrowser", renderer, mappedInput), onGoBack(onGoBack) {}
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+};
@@ -36,6 +36,7 @@ void WifiSelectionActivity::onEnter() {
   usedSavedPassword = false;
   savePromptSelection = 0;
   forgetPromptSelection = 0;
+  quickConnecting = false;
 
   // Trigger first update to show scanning message
   updateRequired = true;
@@ -47,8 +48,10 @@ void WifiSelectionActivity::onEnter() {
               &displayTaskHandle  // Task handle
   );
 
-  // Start WiFi scan
-  startWifiScan();
+  // Reconnect to the last network without a scan if possible
+  if (!startQuickConnect()) {
+    startWifiScan();
+  }
 }
 
 void WifiSelectionActivity::onExit() {
@@ -86,6 +89,39 @@ void WifiSelectionActivity::onExit() {
   Serial.printf("[%lu] [WIFI] [MEM] Free heap at onExit end: %d bytes\n", millis(), ESP.getFreeHeap());
 }
 
+bool WifiSelectionActivity::startQuickConnect() {
+  const auto* cred = WIFI_STORE.getLastConnected();
+  if (!cred || !cred->hasConnectionCache()) {
+    return false;
+  }
+
+  selectedSSID = cred->ssid;
+  enteredPassword = cred->password;
+  selectedRequiresPassword = !cred->password.empty();
+  usedSavedPassword = true;
+  quickConnecting = true;
+  state = WifiSelectionState::CONNECTING;
+  connectionStartTime = millis();
+  updateRequired = true;
+
+  WiFi.mode(WIFI_STA);
+  // Passing the channel and BSSID lets the driver associate without scanning every channel first
+  WiFi.begin(selectedSSID.c_str(), selectedRequiresPassword ? enteredPassword.c_str() : nullptr, cred->channel,
+             cred->bssid);
+  Serial.printf("[%lu] [WIFI] Quick connect to %s on channel %u\n", millis(), selectedSSID.c_str(), cred->channel);
+  return true;
+}
+
+void WifiSelectionActivity::abortQuickConnect() {
+  Serial.printf("[%lu] [WIFI] Quick connect failed after %lu ms, scanning\n", millis(), millis() - connectionStartTime);
+  quickConnecting = false;
+  WiFi.disconnect();
+  selectedSSID.clear();
+  enteredPassword.clear();
+  usedSavedPassword = false;
+  startWifiScan();
+}
+
 void WifiSelectionActivity::startWifiScan() {
   state = WifiSelectionState::SCANNING;
   networks.clear();
@@ -215,6 +251,7 @@ void WifiSelectionActivity::selectNetwork(const int index) {
 
 void WifiSelectionActivity::attemptConnection() {
   state = WifiSelectionState::CONNECTING;
+  quickConnecting = false;
   connectionStartTime = millis();
   connectedIP.clear();
   connectionError.clear();
@@ -242,6 +279,10 @@ void WifiSelectionActivity::checkConnectionStatus() {
     char ipStr[16];
     snprintf(ipStr, sizeof(ipStr), "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
     connectedIP = ipStr;
+    if (quickConnecting) {
+      Serial.printf("[%lu] [WIFI] Quick connect succeeded in %lu ms\n", millis(), millis() - connectionStartTime);
+      quickConnecting = false;
+    }
 
     // If we entered a new password, ask if user wants to save it
     // Otherwise, immediately complete so parent can start web server
@@ -252,11 +293,20 @@ void WifiSelectionActivity::checkConnectionStatus() {
     } else {
       // Using saved password or open network - complete immediately
       Serial.printf("[%lu] [WIFI] Connected with saved/open credentials, completing immediately\n", millis());
+      rememberConnection();
       onComplete(true);
     }
     return;
   }
 
+  if (quickConnecting) {
+    if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL ||
+        millis() - connectionStartTime > QUICK_CONNECT_TIMEOUT_MS) {
+      abortQuickConnect();
+    }
+    return;
+  }
+
   if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL) {
     connectionError = "Connection failed";
     if (status == WL_NO_SSID_AVAIL) {
@@ -277,6 +327,12 @@ void WifiSelectionActivity::checkConnectionStatus() {
   }
 }
 
+void WifiSelectionActivity::rememberConnection() {
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  WIFI_STORE.updateConnectionCache(selectedSSID, WiFi.BSSID(), static_cast<uint8_t>(WiFi.channel()));
+  xSemaphoreGive(renderingMutex);
+}
+
 void WifiSelectionActivity::loop() {
   if (subActivity) {
     subActivity->loop();
@@ -321,6 +377,7 @@ void WifiSelectionActivity::loop() {
         xSemaphoreTake(renderingMutex, portMAX_DELAY);
         WIFI_STORE.addCredential(selectedSSID, enteredPassword);
         xSemaphoreGive(renderingMutex);
+        rememberConnection();
       }
       // Complete - parent will start web server
       onComplete(true);
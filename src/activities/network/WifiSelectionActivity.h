@@ -34,7 +34,8 @@ enum class WifiSelectionState {
 /**
  * WifiSelectionActivity is responsible for scanning WiFi APs and connecting to them.
  * It will:
- * - Enter scanning mode on entry
+ * - Try the last connected network directly on entry, using its cached BSSID and channel
+ * - Enter scanning mode on entry, or when that fails
  * - List available WiFi networks
  * - Allow selection and launch KeyboardEntryActivity for password if needed
  * - Save the password if requested
@@ -73,6 +74,10 @@ class WifiSelectionActivity final : public ActivityWithSubactivity {
   static constexpr unsigned long CONNECTION_TIMEOUT_MS = 15000;
   unsigned long connectionStartTime = 0;
 
+  // Direct connect to the cached access point, a scan is only started when it doesn't come up in time
+  static constexpr unsigned long QUICK_CONNECT_TIMEOUT_MS = 5000;
+  bool quickConnecting = false;
+
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
   void render() const;
@@ -84,11 +89,14 @@ class WifiSelectionActivity final : public ActivityWithSubactivity {
   void renderConnectionFailed() const;
   void renderForgetPrompt() const;
 
+  bool startQuickConnect();
+  void abortQuickConnect();
   void startWifiScan();
   void processWifiScanResults();
   void selectNetwork(int index);
   void attemptConnection();
   void checkConnectionStatus();
+  void rememberConnection();
   std::string getSignalStrengthIndicator(int32_t rssi) const;
 
  public:
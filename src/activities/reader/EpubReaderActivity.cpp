@@ -5,6 +5,10 @@
 #include <GfxRenderer.h>
 #include <SDCardManager.h>
 
+#include <algorithm>
+
+#include "BookSession.h"
+#include "CpuGovernor.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
@@ -15,6 +19,9 @@
 namespace {
 // pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
+// Holding a page button for longer than this scrubs through the chapter instead of skipping it
+constexpr unsigned long scrubStartMs = 1200;
+constexpr int scrubBarHeight = 6;
 constexpr unsigned long goHomeMs = 1000;
 constexpr int topPadding = 5;
 constexpr int horizontalPadding = 5;
@@ -25,6 +32,40 @@ constexpr int horizontalPadding = 5;
 constexpr int footerHeight = 34;  // total footer area height (includes bottom margin)
 constexpr int contentGap = 6;     // gap above delimiter line
 constexpr int lineToText = 6;     // gap below delimiter line to text
+
+// Identifies the settings a section is paginated for, a retained section is only reused while they are unchanged
+uint32_t sectionLayout(const int fontId) {
+  uint32_t layout = static_cast<uint32_t>(fontId);
+  layout = layout * 31 + SETTINGS.lineSpacing;
+  layout = layout * 31 + SETTINGS.extraParagraphSpacing;
+  layout = layout * 31 + SETTINGS.hyphenation;
+  return layout * 31 + SETTINGS.orientation;
+}
+
+// Pages skimmed after scrubbing for ms: 4 a second to begin with, speeding up to 24 a second after 5 seconds. Frames
+// show the latest page, so pages the display can't keep up with are skipped.
+int scrubbedPages(const unsigned long ms) {
+  constexpr unsigned long rampMs = 5000;
+  if (ms < rampMs) {
+    return 1 + static_cast<int>((4 * ms + 2 * ms * ms / 1000) / 1000);
+  }
+  return 71 + static_cast<int>(24 * (ms - rampMs) / 1000);
+}
+
+// Pixel size of the builtin Bookerly at the reader font size, which fontconvert renders at 150 dpi
+uint16_t embeddedFontPixelSize() {
+  switch (SETTINGS.fontSize) {
+    case CrossPointSettings::SMALL:
+      return 12 * 150 / 72;
+    case CrossPointSettings::MEDIUM:
+    default:
+      return 14 * 150 / 72;
+    case CrossPointSettings::LARGE:
+      return 16 * 150 / 72;
+    case CrossPointSettings::EXTRA_LARGE:
+      return 18 * 150 / 72;
+  }
+}
 }  // namespace
 
 void EpubReaderActivity::taskTrampoline(void* param) {
@@ -82,6 +123,25 @@ void EpubReaderActivity::onEnter() {
     }
   }
 
+  fontId = SETTINGS.getReaderFontId();
+  if (SETTINGS.embeddedFonts) {
+    // The first open at a size rasterizes the glyphs of the whole book
+    const CpuBoost boost;
+    embeddedFonts.reset(new EmbeddedFontCache(epub, embeddedFontPixelSize()));
+    if (embeddedFonts->load()) {
+      fontId = embeddedFonts->getFontId();
+      renderer.insertFont(fontId, embeddedFonts->getFamily());
+    } else {
+      embeddedFonts.reset();
+    }
+  }
+
+  // Back in a retained book, keep the section that was on screen instead of reading it in again
+  section = BOOK_SESSION.takeSection(epub->getPath(), currentSpineIndex, sectionLayout(fontId));
+  if (section) {
+    section->currentPage = nextPageNumber;
+  }
+
   // Save current epub as last opened epub
   APP_STATE.openEpubPath = epub->getPath();
   APP_STATE.saveToFile();
@@ -111,7 +171,14 @@ void EpubReaderActivity::onExit() {
   }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  if (epub && section) {
+    BOOK_SESSION.retainSection(epub->getPath(), std::move(section), currentSpineIndex, sectionLayout(fontId));
+  }
   section.reset();
+  if (embeddedFonts) {
+    renderer.removeFont(fontId);
+    embeddedFonts.reset();
+  }
   epub.reset();
 }
 
@@ -122,6 +189,11 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  if (scrubbing) {
+    updateScrub();
+    return;
+  }
+
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     // Don't start activity transition while rendering
@@ -162,6 +234,18 @@ void EpubReaderActivity::loop() {
   const bool nextReleased = mappedInput.wasReleased(MappedInputManager::Button::PageForward) ||
                             mappedInput.wasReleased(MappedInputManager::Button::Right);
 
+  const bool prevHeld = mappedInput.isPressed(MappedInputManager::Button::PageBack) ||
+                        mappedInput.isPressed(MappedInputManager::Button::Left);
+  const bool nextHeld = mappedInput.isPressed(MappedInputManager::Button::PageForward) ||
+                        mappedInput.isPressed(MappedInputManager::Button::Right);
+  if ((prevHeld || nextHeld) && section && section->pageCount > 0 && mappedInput.getHeldTime() >= scrubStartMs) {
+    scrubbing = true;
+    scrubForward = nextHeld;
+    scrubOrigin = section->currentPage;
+    updateScrub();
+    return;
+  }
+
   if (!prevReleased && !nextReleased) {
     return;
   }
@@ -220,6 +304,38 @@ void EpubReaderActivity::loop() {
   }
 }
 
+void EpubReaderActivity::updateScrub() {
+  const bool held = scrubForward ? mappedInput.isPressed(MappedInputManager::Button::PageForward) ||
+                                       mappedInput.isPressed(MappedInputManager::Button::Right)
+                                 : mappedInput.isPressed(MappedInputManager::Button::PageBack) ||
+                                       mappedInput.isPressed(MappedInputManager::Button::Left);
+  if (!held || !section) {
+    // One clean render where the scrub stopped, with a full refresh to clear what the quick frames left behind
+    scrubbing = false;
+    refreshScheduler.requestFullRefresh();
+    updateRequired = true;
+    if (section) {
+      Serial.printf("[%lu] [ERS] Scrubbed from page %d to %d\n", millis(), scrubOrigin, section->currentPage);
+    }
+    return;
+  }
+
+  const int pages = scrubbedPages(mappedInput.getHeldTime() - scrubStartMs);
+  const int target = std::max(0, std::min(section->pageCount - 1, scrubOrigin + (scrubForward ? pages : -pages)));
+  if (target != section->currentPage) {
+    section->currentPage = target;
+    updateRequired = true;
+  }
+}
+
+bool EpubReaderActivity::isRenderPending() {
+  if (ActivityWithSubactivity::isRenderPending()) {
+    return true;
+  }
+  // The display task holds the mutex while it draws, skimming asks for the next frame as soon as this one is out
+  return updateRequired || (renderingMutex && xSemaphoreGetMutexHolder(renderingMutex) != nullptr);
+}
+
 void EpubReaderActivity::displayTaskLoop() {
   while (true) {
     if (updateRequired) {
@@ -272,8 +388,8 @@ void EpubReaderActivity::renderScreen() {
     const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
     const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
 
-    if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
-                                  SETTINGS.extraParagraphSpacing, viewportWidth, viewportHeight)) {
+    if (!section->loadSectionFile(fontId, SETTINGS.getReaderLineCompression(), SETTINGS.extraParagraphSpacing,
+                                  SETTINGS.hyphenation, viewportWidth, viewportHeight)) {
       Serial.printf("[%lu] [ERS] Cache not found, building...\n", millis());
 
       // Progress bar dimensions
@@ -297,7 +413,7 @@ void EpubReaderActivity::renderScreen() {
         renderer.drawText(UI_12_FONT_ID, boxXNoBar + boxMargin, boxY + boxMargin, "Indexing...");
         renderer.drawRect(boxXNoBar + 5, boxY + 5, boxWidthNoBar - 10, boxHeightNoBar - 10);
         renderer.displayBuffer();
-        pagesUntilFullRefresh = 0;
+        refreshScheduler.requestFullRefresh();
       }
 
       // Setup callback - only called for chapters >= 50KB, redraws with progress bar
@@ -316,8 +432,9 @@ void EpubReaderActivity::renderScreen() {
         renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
       };
 
-      if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
-                                      SETTINGS.extraParagraphSpacing, viewportWidth, viewportHeight, progressSetup,
+      const CpuBoost boost;
+      if (!section->createSectionFile(fontId, SETTINGS.getReaderLineCompression(), SETTINGS.extraParagraphSpacing,
+                                      SETTINGS.hyphenation, viewportWidth, viewportHeight, progressSetup,
                                       progressCallback)) {
         Serial.printf("[%lu] [ERS] Failed to persist page data to SD\n", millis());
         section.reset();
@@ -360,9 +477,16 @@ void EpubReaderActivity::renderScreen() {
       section.reset();
       return renderScreen();
     }
+    if (scrubbing) {
+      // Progress is saved by the render after the scrub
+      renderScrubFrame(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+      return;
+    }
     const auto start = millis();
     renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-    Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(), millis() - start);
+    const auto& wordCache = renderer.getWordCache();
+    Serial.printf("[%lu] [ERS] Rendered page in %dms (word cache: %u hits, %u misses, %u bytes)\n", millis(),
+                  millis() - start, wordCache.getHits(), wordCache.getMisses(), wordCache.getUsedBytes());
   }
 
   FsFile f;
@@ -380,15 +504,9 @@ void EpubReaderActivity::renderScreen() {
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  page->render(renderer, fontId, orientedMarginLeft, orientedMarginTop);
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  renderer.displayBuffer(refreshScheduler.nextRefreshMode(renderer.getFrameBuffer(), SETTINGS.getRefreshFrequency()));
 
   // Save bw buffer to reset buffer state after grayscale data sync
   renderer.storeBwBuffer();
@@ -398,13 +516,13 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   {
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    page->render(renderer, fontId, orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleLsbBuffers();
 
     // Render and copy to MSB buffer
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    page->render(renderer, fontId, orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleMsbBuffers();
 
     // display grayscale part
@@ -416,6 +534,26 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   renderer.restoreBwBuffer();
 }
 
+void EpubReaderActivity::renderScrubFrame(std::unique_ptr<Page> page, const int orientedMarginTop,
+                                          const int orientedMarginRight, const int orientedMarginBottom,
+                                          const int orientedMarginLeft) {
+  // BW only at the fast waveform, without the grayscale passes
+  page->render(renderer, fontId, orientedMarginLeft, orientedMarginTop);
+
+  // Position in the chapter as a bar with the page number, in place of the status bar
+  const int left = orientedMarginLeft;
+  const int width = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+  const int barY = renderer.getScreenHeight() - orientedMarginBottom + contentGap;
+  renderer.drawRect(left, barY, width, scrubBarHeight);
+  renderer.fillRect(left + 1, barY + 1, (width - 2) * (section->currentPage + 1) / section->pageCount,
+                    scrubBarHeight - 2, true);
+  const std::string position = std::to_string(section->currentPage + 1) + " / " + std::to_string(section->pageCount);
+  renderer.drawText(SMALL_FONT_ID, left + (width - renderer.getTextWidth(SMALL_FONT_ID, position.c_str())) / 2,
+                    barY + scrubBarHeight + lineToText, position.c_str());
+
+  renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
+}
+
 void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const int orientedMarginBottom,
                                          const int orientedMarginLeft) const {
   // determine visible status bar elements
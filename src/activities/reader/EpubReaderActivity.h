@@ -1,21 +1,30 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/EmbeddedFontCache.h>
 #include <Epub/Section.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include "RefreshScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  // Glyphs of the book's own font when the setting is on, the reader font otherwise
+  std::unique_ptr<EmbeddedFontCache> embeddedFonts = nullptr;
+  int fontId = 0;
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
-  int pagesUntilFullRefresh = 0;
+  RefreshScheduler refreshScheduler;
   bool updateRequired = false;
+  // Holding a page button skims through the chapter, from scrubOrigin, with quick BW only frames
+  bool scrubbing = false;
+  bool scrubForward = false;
+  int scrubOrigin = 0;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
@@ -24,10 +33,13 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   void renderScreen();
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
+  void renderScrubFrame(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
+                        int orientedMarginBottom, int orientedMarginLeft);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  void updateScrub();
 
  public:
-  explicit EpubReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Epub> epub,
+  explicit EpubReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::shared_ptr<Epub> epub,
                               const std::function<void()>& onGoBack, const std::function<void()>& onGoHome)
       : ActivityWithSubactivity("EpubReader", renderer, mappedInput),
         epub(std::move(epub)),
@@ -36,4 +48,5 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  bool isRenderPending() override;
 };
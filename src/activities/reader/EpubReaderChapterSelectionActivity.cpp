@@ -1,6 +1,10 @@
 #include "EpubReaderChapterSelectionActivity.h"
 
 #include <GfxRenderer.h>
+#include <Utf8.h>
+
+#include <algorithm>
+#include <cctype>
 
 #include "MappedInputManager.h"
 #include "fontIds.h"
@@ -8,6 +12,9 @@
 namespace {
 // Time threshold for treating a long press as a page-up/page-down
 constexpr int SKIP_PAGE_MS = 700;
+// TOCs with this many entries use Left/Right to jump by first letter (press) or by a tenth of the TOC (hold)
+constexpr int QUICK_JUMP_MIN_ITEMS = 200;
+constexpr int QUICK_JUMP_PERCENT = 10;
 constexpr int headerY = 16;
 constexpr int separatorY = 42;
 constexpr int listStartY = 54;
@@ -27,6 +34,57 @@ int EpubReaderChapterSelectionActivity::getPageItems() const {
   return items;
 }
 
+// Make sure the titles from first to first + count - 1 are loaded, reading them along with the page before and
+// after them in one go otherwise
+bool EpubReaderChapterSelectionActivity::loadTocTitles(const int first, const int count) {
+  if (tocWindow.contains(first) && tocWindow.contains(first + count - 1)) {
+    return true;
+  }
+
+  const int pageItems = getPageItems();
+  const int windowStart = std::max(0, first - pageItems);
+  const int windowEnd = std::min(epub->getTocItemsCount(), first + count + pageItems);
+  return epub->getTocTitles(windowStart, windowEnd - windowStart, tocWindow);
+}
+
+// First character of a title with leading spaces and punctuation skipped and ASCII letters upper cased
+uint32_t EpubReaderChapterSelectionActivity::getFirstLetter(const int tocIndex) {
+  if (!loadTocTitles(tocIndex, 1)) {
+    return 0;
+  }
+
+  const auto* title = reinterpret_cast<const unsigned char*>(tocWindow.getTitle(tocIndex));
+  uint32_t codePoint;
+  while ((codePoint = utf8NextCodepoint(&title)) != 0) {
+    if (codePoint >= 0x80 || isalnum(codePoint)) {
+      return codePoint < 0x80 ? toupper(codePoint) : codePoint;
+    }
+  }
+  return 0;
+}
+
+// Start of the next run of titles with the same first letter, or of the current run (of the previous one if the
+// selection is already at its start) going backwards. Wraps around like the other selection moves.
+int EpubReaderChapterSelectionActivity::findLetterStart(const bool forward) {
+  const int tocCount = epub->getTocItemsCount();
+  if (forward) {
+    const uint32_t letter = getFirstLetter(selectorIndex);
+    for (int i = selectorIndex + 1; i < tocCount; i++) {
+      if (getFirstLetter(i) != letter) {
+        return i;
+      }
+    }
+    return 0;
+  }
+
+  int target = selectorIndex > 0 ? selectorIndex - 1 : tocCount - 1;
+  const uint32_t letter = getFirstLetter(target);
+  while (target > 0 && getFirstLetter(target - 1) == letter) {
+    target--;
+  }
+  return target;
+}
+
 void EpubReaderChapterSelectionActivity::taskTrampoline(void* param) {
   auto* self = static_cast<EpubReaderChapterSelectionActivity*>(param);
   self->displayTaskLoop();
@@ -69,10 +127,12 @@ void EpubReaderChapterSelectionActivity::onExit() {
 }
 
 void EpubReaderChapterSelectionActivity::loop() {
-  const bool prevReleased = mappedInput.wasReleased(MappedInputManager::Button::Up) ||
-                            mappedInput.wasReleased(MappedInputManager::Button::Left);
-  const bool nextReleased = mappedInput.wasReleased(MappedInputManager::Button::Down) ||
-                            mappedInput.wasReleased(MappedInputManager::Button::Right);
+  const int tocCount = epub->getTocItemsCount();
+  const bool quickJump = tocCount >= QUICK_JUMP_MIN_ITEMS;
+  const bool leftReleased = mappedInput.wasReleased(MappedInputManager::Button::Left);
+  const bool rightReleased = mappedInput.wasReleased(MappedInputManager::Button::Right);
+  const bool prevReleased = mappedInput.wasReleased(MappedInputManager::Button::Up) || (leftReleased && !quickJump);
+  const bool nextReleased = mappedInput.wasReleased(MappedInputManager::Button::Down) || (rightReleased && !quickJump);
 
   const bool skipPage = mappedInput.getHeldTime() > SKIP_PAGE_MS;
   const int pageItems = getPageItems();
@@ -86,19 +146,28 @@ void EpubReaderChapterSelectionActivity::loop() {
     }
   } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
     onGoBack();
+  } else if (quickJump && (leftReleased || rightReleased)) {
+    if (skipPage) {
+      const int step = tocCount * QUICK_JUMP_PERCENT / 100;
+      selectorIndex = std::max(0, std::min(tocCount - 1, selectorIndex + (rightReleased ? step : -step)));
+    } else {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      selectorIndex = findLetterStart(rightReleased);
+      xSemaphoreGive(renderingMutex);
+    }
+    updateRequired = true;
   } else if (prevReleased) {
     if (skipPage) {
-      selectorIndex =
-          ((selectorIndex / pageItems - 1) * pageItems + epub->getTocItemsCount()) % epub->getTocItemsCount();
+      selectorIndex = ((selectorIndex / pageItems - 1) * pageItems + tocCount) % tocCount;
     } else {
-      selectorIndex = (selectorIndex + epub->getTocItemsCount() - 1) % epub->getTocItemsCount();
+      selectorIndex = (selectorIndex + tocCount - 1) % tocCount;
     }
     updateRequired = true;
   } else if (nextReleased) {
     if (skipPage) {
-      selectorIndex = ((selectorIndex / pageItems + 1) * pageItems) % epub->getTocItemsCount();
+      selectorIndex = ((selectorIndex / pageItems + 1) * pageItems) % tocCount;
     } else {
-      selectorIndex = (selectorIndex + 1) % epub->getTocItemsCount();
+      selectorIndex = (selectorIndex + 1) % tocCount;
     }
     updateRequired = true;
   }
@@ -132,16 +201,23 @@ void EpubReaderChapterSelectionActivity::renderScreen() {
 
   // Draw selection highlight
   const auto pageStartIndex = selectorIndex / pageItems * pageItems;
-  renderer.fillRect(0, listStartY + (selectorIndex % pageItems) * rowHeight - 2, pageWidth - 1, rowHeight);
+  const SelectionRefresh::Rect highlight = {0, listStartY + (selectorIndex % pageItems) * rowHeight - 2, pageWidth - 1,
+                                            rowHeight};
+  renderer.fillRect(highlight.x, highlight.y, highlight.width, highlight.height);
 
   // Draw chapter list
-  for (int tocIndex = pageStartIndex; tocIndex < epub->getTocItemsCount() && tocIndex < pageStartIndex + pageItems;
-       tocIndex++) {
-    auto item = epub->getTocItem(tocIndex);
-    const int indentPx = (item.level - 1) * 12;
-    renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4 + indentPx, listStartY + (tocIndex % pageItems) * rowHeight,
-                      item.title.c_str(), tocIndex != selectorIndex);
+  const int pageEndIndex = std::min(epub->getTocItemsCount(), pageStartIndex + pageItems);
+  const bool titlesLoaded =
+      pageEndIndex > pageStartIndex && loadTocTitles(pageStartIndex, pageEndIndex - pageStartIndex);
+  if (titlesLoaded) {
+    for (int tocIndex = pageStartIndex; tocIndex < pageEndIndex; tocIndex++) {
+      const int indentPx = (tocWindow.getLevel(tocIndex) - 1) * 12;
+      renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4 + indentPx,
+                        listStartY + (tocIndex % pageItems) * rowHeight, tocWindow.getTitle(tocIndex),
+                        tocIndex != selectorIndex);
+    }
   }
 
-  renderer.displayBuffer();
+  // The page of the TOC on screen
+  selectionRefresh.display(renderer, SelectionRefresh::mix(pageStartIndex, titlesLoaded), highlight);
 }
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "../Activity.h"
+#include "SelectionRefresh.h"
 
 class EpubReaderChapterSelectionActivity final : public Activity {
   std::shared_ptr<Epub> epub;
@@ -15,12 +16,19 @@ class EpubReaderChapterSelectionActivity final : public Activity {
   int currentSpineIndex = 0;
   int selectorIndex = 0;
   bool updateRequired = false;
+  SelectionRefresh selectionRefresh;
   const std::function<void()> onGoBack;
   const std::function<void(int newSpineIndex)> onSelectSpineIndex;
+  // Titles of the visible page and the pages around it, book.bin is only read again once scrolling leaves them.
+  // Guarded by renderingMutex, the quick jumps scan through the TOC with it too.
+  BookMetadataCache::TocTitleRange tocWindow;
 
   // Number of items that fit on a page, derived from logical screen height.
   // This adapts automatically when switching between portrait and landscape.
   int getPageItems() const;
+  bool loadTocTitles(int first, int count);
+  uint32_t getFirstLetter(int tocIndex);
+  int findLetterStart(bool forward);
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
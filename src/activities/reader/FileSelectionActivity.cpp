@@ -174,7 +174,7 @@ void FileSelectionActivity::displayTaskLoop() {
   }
 }
 
-void FileSelectionActivity::render() const {
+void FileSelectionActivity::render() {
   renderer.clearScreen();
 
   const auto pageWidth = renderer.getScreenWidth();
@@ -189,19 +189,26 @@ void FileSelectionActivity::render() const {
   const auto labels = mappedInput.mapLabels("« Home", "Open", "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
+  // The folder and the page of it on screen
+  uint32_t layoutKey = std::hash<std::string>{}(basepath);
+  layoutKey = SelectionRefresh::mix(layoutKey, files.size());
+
   if (files.empty()) {
     renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4, listStartY, "No books found");
-    renderer.displayBuffer();
+    selectionRefresh.display(renderer, layoutKey, {});
     return;
   }
 
   const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
-  renderer.fillRect(0, listStartY + (selectorIndex % PAGE_ITEMS) * rowHeight - 2, pageWidth - 1, rowHeight);
+  layoutKey = SelectionRefresh::mix(layoutKey, pageStartIndex);
+  const SelectionRefresh::Rect highlight = {0, listStartY + (selectorIndex % PAGE_ITEMS) * rowHeight - 2, pageWidth - 1,
+                                            rowHeight};
+  renderer.fillRect(highlight.x, highlight.y, highlight.width, highlight.height);
   for (int i = pageStartIndex; i < files.size() && i < pageStartIndex + PAGE_ITEMS; i++) {
     auto item = renderer.truncatedText(UI_10_FONT_ID, files[i].c_str(), pageWidth - horizontalMargin * 2 - 8);
     renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4, listStartY + (i % PAGE_ITEMS) * rowHeight, item.c_str(),
                       i != selectorIndex);
   }
 
-  renderer.displayBuffer();
+  selectionRefresh.display(renderer, layoutKey, highlight);
 }
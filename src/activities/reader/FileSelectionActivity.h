@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "SelectionRefresh.h"
 
 class FileSelectionActivity final : public Activity {
   TaskHandle_t displayTaskHandle = nullptr;
@@ -16,12 +17,13 @@ class FileSelectionActivity final : public Activity {
   std::vector<std::string> files;
   int selectorIndex = 0;
   bool updateRequired = false;
+  SelectionRefresh selectionRefresh;
   const std::function<void(const std::string&)> onSelect;
   const std::function<void()> onGoHome;
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
-  void render() const;
+  void render();
   void loadFiles();
 
  public:
@@ -1,5 +1,7 @@
 #include "ReaderActivity.h"
 
+#include "BookSession.h"
+#include "CpuGovernor.h"
 #include "Epub.h"
 #include "EpubReaderActivity.h"
 #include "FileSelectionActivity.h"
@@ -26,14 +28,21 @@ bool ReaderActivity::isXtcFile(const std::string& path) {
   return false;
 }
 
-std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
+std::shared_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
+  if (auto epub = BOOK_SESSION.findEpub(path)) {
+    Serial.printf("[%lu] [   ] Reusing loaded epub: %s\n", millis(), path.c_str());
+    return epub;
+  }
+
   if (!SdMan.exists(path.c_str())) {
     Serial.printf("[%lu] [   ] File does not exist: %s\n", millis(), path.c_str());
     return nullptr;
   }
 
-  auto epub = std::unique_ptr<Epub>(new Epub(path, "/.crosspoint"));
+  auto epub = std::make_shared<Epub>(path, "/.crosspoint");
+  const CpuBoost boost;
   if (epub->load()) {
+    BOOK_SESSION.retain(epub);
     return epub;
   }
 
@@ -41,14 +50,21 @@ std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
   return nullptr;
 }
 
-std::unique_ptr<Xtc> ReaderActivity::loadXtc(const std::string& path) {
+std::shared_ptr<Xtc> ReaderActivity::loadXtc(const std::string& path) {
+  if (auto xtc = BOOK_SESSION.findXtc(path)) {
+    Serial.printf("[%lu] [   ] Reusing loaded XTC: %s\n", millis(), path.c_str());
+    return xtc;
+  }
+
   if (!SdMan.exists(path.c_str())) {
     Serial.printf("[%lu] [   ] File does not exist: %s\n", millis(), path.c_str());
     return nullptr;
   }
 
-  auto xtc = std::unique_ptr<Xtc>(new Xtc(path, "/.crosspoint"));
+  auto xtc = std::make_shared<Xtc>(path, "/.crosspoint");
+  const CpuBoost boost;
   if (xtc->load()) {
+    BOOK_SESSION.retain(xtc);
     return xtc;
   }
 
@@ -59,7 +75,10 @@ std::unique_ptr<Xtc> ReaderActivity::loadXtc(const std::string& path) {
 void ReaderActivity::onSelectBookFile(const std::string& path) {
   currentBookPath = path;  // Track current book path
   exitActivity();
-  enterNewActivity(new FullScreenMessageActivity(renderer, mappedInput, "Loading..."));
+  // Retained books open without loading, don't flash a message for them
+  if (!BOOK_SESSION.contains(path)) {
+    enterNewActivity(new FullScreenMessageActivity(renderer, mappedInput, "Loading..."));
+  }
 
   if (isXtcFile(path)) {
     // Load XTC file
@@ -96,7 +115,7 @@ void ReaderActivity::onGoToFileSelection(const std::string& fromBookPath) {
       renderer, mappedInput, [this](const std::string& path) { onSelectBookFile(path); }, onGoBack, initialPath));
 }
 
-void ReaderActivity::onGoToEpubReader(std::unique_ptr<Epub> epub) {
+void ReaderActivity::onGoToEpubReader(std::shared_ptr<Epub> epub) {
   const auto epubPath = epub->getPath();
   currentBookPath = epubPath;
   exitActivity();
@@ -105,7 +124,7 @@ void ReaderActivity::onGoToEpubReader(std::unique_ptr<Epub> epub) {
       [this] { onGoBack(); }));
 }
 
-void ReaderActivity::onGoToXtcReader(std::unique_ptr<Xtc> xtc) {
+void ReaderActivity::onGoToXtcReader(std::shared_ptr<Xtc> xtc) {
   const auto xtcPath = xtc->getPath();
   currentBookPath = xtcPath;
   exitActivity();
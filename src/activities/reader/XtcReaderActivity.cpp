@@ -263,14 +263,8 @@ void XtcReaderActivity::renderPage() {
       }
     }
 
-    // Display BW with conditional refresh based on pagesUntilFullRefresh
-    if (pagesUntilFullRefresh <= 1) {
-      renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
-      pagesUntilFullRefresh = pagesPerRefresh;
-    } else {
-      renderer.displayBuffer();
-      pagesUntilFullRefresh--;
-    }
+    // Display BW, with a full refresh once the ghosting estimate asks for it
+    renderer.displayBuffer(refreshScheduler.nextRefreshMode(renderer.getFrameBuffer(), pagesPerRefresh));
 
     // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
@@ -344,13 +338,7 @@ void XtcReaderActivity::renderPage() {
   // XTC pages already have status bar pre-rendered, no need to add our own
 
   // Display with appropriate refresh
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = pagesPerRefresh;
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  renderer.displayBuffer(refreshScheduler.nextRefreshMode(renderer.getFrameBuffer(), pagesPerRefresh));
 
   Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (%u-bit)\n", millis(), currentPage + 1, xtc->getPageCount(),
                 bitDepth);
@@ -54,6 +54,19 @@ void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
   updateRequired = true;
 }
 
+void OtaUpdateActivity::findSdFirmware() {
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  const auto res = sdUpdater.findFirmware();
+  if (res == SdOtaUpdater::OK) {
+    state = WAITING_CONFIRMATION;
+  } else {
+    Serial.printf("[%lu] [OTA] No usable firmware on SD card: %d\n", millis(), res);
+    state = res == SdOtaUpdater::NO_FILE ? NO_UPDATE : FAILED;
+  }
+  xSemaphoreGive(renderingMutex);
+  updateRequired = true;
+}
+
 void OtaUpdateActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -66,6 +79,12 @@ void OtaUpdateActivity::onEnter() {
               &displayTaskHandle  // Task handle
   );
 
+  if (fromSdCard) {
+    // No network needed, go straight to confirmation
+    findSdFirmware();
+    return;
+  }
+
   // Turn on WiFi immediately
   Serial.printf("[%lu] [OTA] Turning on WiFi...\n", millis());
   WiFi.mode(WIFI_STA);
@@ -80,10 +99,12 @@ void OtaUpdateActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
   // Turn off wifi
-  WiFi.disconnect(false);  // false = don't erase credentials, send disconnect frame
-  delay(100);              // Allow disconnect frame to be sent
-  WiFi.mode(WIFI_OFF);
-  delay(100);  // Allow WiFi hardware to fully power down
+  if (!fromSdCard) {
+    WiFi.disconnect(false);  // false = don't erase credentials, send disconnect frame
+    delay(100);              // Allow disconnect frame to be sent
+    WiFi.mode(WIFI_OFF);
+    delay(100);  // Allow WiFi hardware to fully power down
+  }
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
@@ -115,8 +136,8 @@ void OtaUpdateActivity::render() {
 
   float updaterProgress = 0;
   if (state == UPDATE_IN_PROGRESS) {
-    Serial.printf("[%lu] [OTA] Update progress: %d / %d\n", millis(), updater.processedSize, updater.totalSize);
-    updaterProgress = static_cast<float>(updater.processedSize) / static_cast<float>(updater.totalSize);
+    Serial.printf("[%lu] [OTA] Update progress: %d / %d\n", millis(), getProcessedSize(), getTotalSize());
+    updaterProgress = static_cast<float>(getProcessedSize()) / static_cast<float>(getTotalSize());
     // Only update every 2% at the most
     if (static_cast<int>(updaterProgress * 50) == lastUpdaterPercentage / 2) {
       return;
@@ -135,6 +156,19 @@ void OtaUpdateActivity::render() {
     return;
   }
 
+  if (state == WAITING_CONFIRMATION && fromSdCard) {
+    renderer.drawCenteredText(UI_10_FONT_ID, 200, "Firmware found on SD card", true, EpdFontFamily::BOLD);
+    renderer.drawText(UI_10_FONT_ID, 20, 250, "Current Version: " CROSSPOINT_VERSION);
+    const auto& version = sdUpdater.getFirmwareVersion();
+    renderer.drawText(UI_10_FONT_ID, 20, 270, ("New Version: " + (version.empty() ? "unknown" : version)).c_str());
+    renderer.drawText(UI_10_FONT_ID, 20, 290, ("File: " + sdUpdater.getFirmwarePath()).c_str());
+
+    const auto labels = mappedInput.mapLabels("Cancel", "Update", "", "");
+    renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+    renderer.displayBuffer();
+    return;
+  }
+
   if (state == WAITING_CONFIRMATION) {
     renderer.drawCenteredText(UI_10_FONT_ID, 200, "New update available!", true, EpdFontFamily::BOLD);
     renderer.drawText(UI_10_FONT_ID, 20, 250, "Current Version: " CROSSPOINT_VERSION);
@@ -154,13 +188,14 @@ void OtaUpdateActivity::render() {
                               (std::to_string(static_cast<int>(updaterProgress * 100)) + "%").c_str());
     renderer.drawCenteredText(
         UI_10_FONT_ID, 440,
-        (std::to_string(updater.processedSize) + " / " + std::to_string(updater.totalSize)).c_str());
+        (std::to_string(getProcessedSize()) + " / " + std::to_string(getTotalSize())).c_str());
     renderer.displayBuffer();
     return;
   }
 
   if (state == NO_UPDATE) {
-    renderer.drawCenteredText(UI_10_FONT_ID, 300, "No update available", true, EpdFontFamily::BOLD);
+    renderer.drawCenteredText(UI_10_FONT_ID, 300, fromSdCard ? "No firmware .bin on SD card" : "No update available",
+                              true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
     return;
   }
@@ -194,10 +229,24 @@ void OtaUpdateActivity::loop() {
       xSemaphoreGive(renderingMutex);
       updateRequired = true;
       vTaskDelay(10 / portTICK_PERIOD_MS);
-      const auto res = updater.installUpdate([this](const size_t, const size_t) { updateRequired = true; });
+      const auto onProgress = [this](const size_t, const size_t) { updateRequired = true; };
+      // The two updaters report failures with their own error enums
+      bool installed;
+      if (fromSdCard) {
+        const auto res = sdUpdater.installUpdate(renderingMutex, onProgress);
+        installed = res == SdOtaUpdater::OK;
+        if (!installed) {
+          Serial.printf("[%lu] [OTA] Update from SD card failed: %d\n", millis(), res);
+        }
+      } else {
+        const auto res = updater.installUpdate(onProgress);
+        installed = res == OtaUpdater::OK;
+        if (!installed) {
+          Serial.printf("[%lu] [OTA] Update failed: %d\n", millis(), res);
+        }
+      }
 
-      if (res != OtaUpdater::OK) {
-        Serial.printf("[%lu] [OTA] Update failed: %d\n", millis(), res);
+      if (!installed) {
         xSemaphoreTake(renderingMutex, portMAX_DELAY);
         state = FAILED;
         xSemaphoreGive(renderingMutex);
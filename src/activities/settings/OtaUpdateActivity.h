@@ -5,6 +5,7 @@
 
 #include "activities/ActivityWithSubactivity.h"
 #include "network/OtaUpdater.h"
+#include "network/SdOtaUpdater.h"
 
 class OtaUpdateActivity : public ActivityWithSubactivity {
   enum State {
@@ -25,19 +26,29 @@ class OtaUpdateActivity : public ActivityWithSubactivity {
   SemaphoreHandle_t renderingMutex = nullptr;
   bool updateRequired = false;
   const std::function<void()> goBack;
+  // Install a firmware file from the SD card instead of the latest release
+  const bool fromSdCard;
   State state = WIFI_SELECTION;
   unsigned int lastUpdaterPercentage = UNINITIALIZED_PERCENTAGE;
   OtaUpdater updater;
+  SdOtaUpdater sdUpdater;
 
   void onWifiSelectionComplete(bool success);
+  void findSdFirmware();
+  size_t getProcessedSize() const { return fromSdCard ? sdUpdater.processedSize : updater.processedSize; }
+  size_t getTotalSize() const { return fromSdCard ? sdUpdater.totalSize : updater.totalSize; }
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
   void render();
 
  public:
   explicit OtaUpdateActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
-                             const std::function<void()>& goBack)
-      : ActivityWithSubactivity("OtaUpdate", renderer, mappedInput), goBack(goBack), updater() {}
+                             const std::function<void()>& goBack, const bool fromSdCard = false)
+      : ActivityWithSubactivity("OtaUpdate", renderer, mappedInput),
+        goBack(goBack),
+        fromSdCard(fromSdCard),
+        updater(),
+        sdUpdater() {}
   void onEnter() override;
   void onExit() override;
   void loop() override;
@@ -5,11 +5,12 @@
 #include "CrossPointSettings.h"
 #include "MappedInputManager.h"
 #include "OtaUpdateActivity.h"
+#include "activities/util/KeyboardEntryActivity.h"
 #include "fontIds.h"
 
 // Define the static settings list
 namespace {
-constexpr int settingsCount = 13;
+constexpr int settingsCount = 17;
 const SettingInfo settingsList[settingsCount] = {
     // Should match with SLEEP_SCREEN_MODE
     {"Sleep Screen", SettingType::ENUM, &CrossPointSettings::sleepScreen, {"Dark", "Light", "Custom", "Cover"}},
@@ -34,6 +35,8 @@ const SettingInfo settingsList[settingsCount] = {
      {"Bookerly", "Noto Sans", "Open Dyslexic"}},
     {"Reader Font Size", SettingType::ENUM, &CrossPointSettings::fontSize, {"Small", "Medium", "Large", "X Large"}},
     {"Reader Line Spacing", SettingType::ENUM, &CrossPointSettings::lineSpacing, {"Tight", "Normal", "Wide"}},
+    {"Hyphenation", SettingType::TOGGLE, &CrossPointSettings::hyphenation, {}},
+    {"Book Fonts", SettingType::TOGGLE, &CrossPointSettings::embeddedFonts, {}},
     {"Time to Sleep",
      SettingType::ENUM,
      &CrossPointSettings::sleepTimeout,
@@ -42,7 +45,9 @@ const SettingInfo settingsList[settingsCount] = {
      SettingType::ENUM,
      &CrossPointSettings::refreshFrequency,
      {"1 page", "5 pages", "10 pages", "15 pages", "30 pages"}},
+    {"OPDS Server", SettingType::ACTION, nullptr, {}},
     {"Check for updates", SettingType::ACTION, nullptr, {}},
+    {"Update from SD card", SettingType::ACTION, nullptr, {}},
 };
 }  // namespace
 
@@ -134,14 +139,48 @@ void SettingsActivity::toggleCurrentSetting() {
     const uint8_t currentValue = SETTINGS.*(setting.valuePtr);
     SETTINGS.*(setting.valuePtr) = (currentValue + 1) % static_cast<uint8_t>(setting.enumValues.size());
   } else if (setting.type == SettingType::ACTION) {
-    if (std::string(setting.name) == "Check for updates") {
+    if (std::string(setting.name) == "OPDS Server") {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      selectionRefresh.invalidate();
+      exitActivity();
+      enterNewActivity(new KeyboardEntryActivity(
+          renderer, mappedInput, "OPDS Server URL",
+          SETTINGS.opdsServerUrl.empty() ? "http://" : SETTINGS.opdsServerUrl,
+          10,     // Y position
+          128,    // Max URL length
+          false,  // Not a password
+          [this](const std::string& text) {
+            SETTINGS.opdsServerUrl = text == "http://" ? "" : text;
+            SETTINGS.saveToFile();
+            exitActivity();
+            updateRequired = true;
+          },
+          [this] {
+            exitActivity();
+            updateRequired = true;
+          }));
+      xSemaphoreGive(renderingMutex);
+    } else if (std::string(setting.name) == "Check for updates") {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      selectionRefresh.invalidate();
       exitActivity();
       enterNewActivity(new OtaUpdateActivity(renderer, mappedInput, [this] {
         exitActivity();
         updateRequired = true;
       }));
       xSemaphoreGive(renderingMutex);
+    } else if (std::string(setting.name) == "Update from SD card") {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      selectionRefresh.invalidate();
+      exitActivity();
+      enterNewActivity(new OtaUpdateActivity(
+          renderer, mappedInput,
+          [this] {
+            exitActivity();
+            updateRequired = true;
+          },
+          true));
+      xSemaphoreGive(renderingMutex);
     }
   } else {
     // Only toggle if it's a toggle type and has a value pointer
@@ -164,7 +203,7 @@ void SettingsActivity::displayTaskLoop() {
   }
 }
 
-void SettingsActivity::render() const {
+void SettingsActivity::render() {
   renderer.clearScreen();
 
   const auto pageWidth = renderer.getScreenWidth();
@@ -184,11 +223,17 @@ void SettingsActivity::render() const {
   renderer.drawLine(horizontalMargin, separatorY, pageWidth - horizontalMargin, separatorY);
 
   // Draw selection highlight
-  renderer.fillRect(0, listStartY + selectedSettingIndex * rowHeight - 2, pageWidth - 1, rowHeight);
+  const SelectionRefresh::Rect highlight = {0, listStartY + selectedSettingIndex * rowHeight - 2, pageWidth - 1,
+                                            rowHeight};
+  renderer.fillRect(highlight.x, highlight.y, highlight.width, highlight.height);
 
-  // Draw all settings
+  // Draw all settings, the values shown make up the layout
+  uint32_t layoutKey = std::hash<std::string>{}(SETTINGS.opdsServerUrl);
   for (int i = 0; i < settingsCount; i++) {
     const int settingY = listStartY + i * rowHeight;
+    if (settingsList[i].valuePtr != nullptr) {
+      layoutKey = SelectionRefresh::mix(layoutKey, SETTINGS.*(settingsList[i].valuePtr));
+    }
 
     // Draw setting name
     renderer.drawText(UI_10_FONT_ID, horizontalMargin + 4, settingY, settingsList[i].name, i != selectedSettingIndex);
@@ -201,6 +246,16 @@ void SettingsActivity::render() const {
     } else if (settingsList[i].type == SettingType::ENUM && settingsList[i].valuePtr != nullptr) {
       const uint8_t value = SETTINGS.*(settingsList[i].valuePtr);
       valueText = settingsList[i].enumValues[value];
+    } else if (std::string(settingsList[i].name) == "OPDS Server") {
+      // Host part of the URL, the full address doesn't fit next to the name
+      valueText = SETTINGS.opdsServerUrl.empty() ? "Not set" : SETTINGS.opdsServerUrl;
+      const size_t schemeEnd = valueText.find("://");
+      if (schemeEnd != std::string::npos) {
+        valueText.erase(0, schemeEnd + 3);
+      }
+      if (valueText.length() > 20) {
+        valueText.replace(17, valueText.length() - 17, "...");
+      }
     }
     const auto width = renderer.getTextWidth(UI_10_FONT_ID, valueText.c_str());
     renderer.drawText(UI_10_FONT_ID, pageWidth - horizontalMargin - 4 - width, settingY, valueText.c_str(),
@@ -215,6 +270,5 @@ void SettingsActivity::render() const {
   const auto labels = mappedInput.mapLabels("« Save", "Toggle", "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  // Always use standard refresh for settings screen
-  renderer.displayBuffer();
+  selectionRefresh.display(renderer, layoutKey, highlight);
 }
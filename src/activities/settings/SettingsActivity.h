@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+#include "SelectionRefresh.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class CrossPointSettings;
@@ -26,11 +27,12 @@ class SettingsActivity final : public ActivityWithSubactivity {
   SemaphoreHandle_t renderingMutex = nullptr;
   bool updateRequired = false;
   int selectedSettingIndex = 0;  // Currently selected setting
+  SelectionRefresh selectionRefresh;
   const std::function<void()> onGoHome;
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
-  void render() const;
+  void render();
   void toggleCurrentSetting();
 
  public:
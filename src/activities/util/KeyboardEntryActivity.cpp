@@ -235,7 +235,7 @@ void KeyboardEntryActivity::loop() {
   }
 }
 
-void KeyboardEntryActivity::render() const {
+void KeyboardEntryActivity::render() {
   const auto pageWidth = renderer.getScreenWidth();
 
   renderer.clearScreen();
@@ -332,15 +332,20 @@ void KeyboardEntryActivity::render() const {
   // Draw help text at absolute bottom of screen (consistent with other screens)
   const auto pageHeight = renderer.getScreenHeight();
   renderer.drawText(SMALL_FONT_ID, 10, pageHeight - 30, "Navigate: D-pad | Select: OK | Cancel: BACK");
-  renderer.displayBuffer();
+
+  // Moving between keys only changes their brackets, typing changes the text and can change the layout
+  const uint32_t layoutKey = SelectionRefresh::mix(std::hash<std::string>{}(text), shiftActive);
+  selectionRefresh.display(renderer, layoutKey, selectedKeyRect);
 }
 
 void KeyboardEntryActivity::renderItemWithSelector(const int x, const int y, const char* item,
-                                                   const bool isSelected) const {
+                                                   const bool isSelected) {
   if (isSelected) {
     const int itemWidth = renderer.getTextWidth(UI_10_FONT_ID, item);
     renderer.drawText(UI_10_FONT_ID, x - 6, y, "[");
     renderer.drawText(UI_10_FONT_ID, x + itemWidth, y, "]");
+    selectedKeyRect = {x - 6, y, itemWidth + 6 + renderer.getTextWidth(UI_10_FONT_ID, "]"),
+                       renderer.getLineHeight(UI_10_FONT_ID)};
   }
   renderer.drawText(UI_10_FONT_ID, x, y, item);
 }
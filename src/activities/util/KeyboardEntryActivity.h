@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "../Activity.h"
+#include "SelectionRefresh.h"
 
 /**
  * Reusable keyboard entry activity for text input.
@@ -66,6 +67,9 @@ class KeyboardEntryActivity : public Activity {
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   bool updateRequired = false;
+  SelectionRefresh selectionRefresh;
+  // Around the selected key of the frame being drawn
+  SelectionRefresh::Rect selectedKeyRect = {};
 
   // Keyboard state
   int selectedRow = 0;
@@ -94,6 +98,6 @@ class KeyboardEntryActivity : public Activity {
   char getSelectedChar() const;
   void handleKeyPress();
   int getRowLength(int row) const;
-  void render() const;
-  void renderItemWithSelector(int x, int y, const char* item, bool isSelected) const;
+  void render();
+  void renderItemWithSelector(int x, int y, const char* item, bool isSelected);
 };
@@ -5,9 +5,14 @@
 #include <InputManager.h>
 #include <SDCardManager.h>
 #include <SPI.h>
+#include <WiFi.h>
 #include <builtinFonts/all.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
 
 #include "Battery.h"
+#include "BookCacheMigration.h"
+#include "CpuGovernor.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
@@ -33,6 +38,12 @@
 
 #define SD_SPI_MISO 7
 
+// Light sleep between button polls once the device has been idle this long (the last page is on e-ink by then)
+#define IDLE_SLEEP_DELAY_MS 3000
+// Timer wake-up while light sleeping, the front buttons sit on an ADC ladder and most of them never pull their pin
+// low enough for a GPIO wake-up, so they are still polled at this interval
+#define IDLE_POLL_INTERVAL_MS 25
+
 EInkDisplay einkDisplay(EPD_SCLK, EPD_MOSI, EPD_CS, EPD_DC, EPD_RST, EPD_BUSY);
 InputManager inputManager;
 MappedInputManager mappedInputManager(inputManager);
@@ -202,6 +213,45 @@ void enterDeepSleep() {
   esp_deep_sleep_start();
 }
 
+// A held button is input in progress, skimming with a held page button turns pages without new presses
+bool isAnyButtonHeld() {
+  for (uint8_t button = InputManager::BTN_BACK; button <= InputManager::BTN_POWER; button++) {
+    if (inputManager.isPressed(button)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Light sleep is only worth it (and only safe) when nothing else needs the chip awake
+bool canIdleSleep(const unsigned long lastActivityTime) {
+  if (millis() - lastActivityTime < IDLE_SLEEP_DELAY_MS) {
+    return false;
+  }
+  // Light sleep drops the USB serial connection and any WiFi association
+  if (digitalRead(UART0_RXD) == HIGH || WiFi.getMode() != WIFI_OFF) {
+    return false;
+  }
+  if (isAnyButtonHeld()) {
+    return false;
+  }
+  // Light sleep pauses the display task too, a frame on its way to the panel would be held up by every poll interval
+  if (renderer.isDisplaying() || (currentActivity && currentActivity->isRenderPending())) {
+    return false;
+  }
+  // Section builds and other CPU bound work run on the display task, it must not be paused halfway
+  return !CPU_GOVERNOR.isBoosted();
+}
+
+// Sleep until the power button goes down or the next poll of the front buttons is due
+void idleLightSleep() {
+  gpio_wakeup_enable(static_cast<gpio_num_t>(InputManager::POWER_BUTTON_PIN), GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(IDLE_POLL_INTERVAL_MS * 1000ULL);
+  esp_light_sleep_start();
+  gpio_wakeup_disable(static_cast<gpio_num_t>(InputManager::POWER_BUTTON_PIN));
+}
+
 void onGoHome();
 void onGoToReader(const std::string& initialEpubPath) {
   exitActivity();
@@ -226,6 +276,47 @@ void onGoHome() {
                                     onGoToFileTransfer));
 }
 
+// Where the time between reset and the first screen goes, printed once setup is done
+struct BootPhase {
+  const char* name;
+  unsigned long endMs;
+};
+constexpr uint8_t MAX_BOOT_PHASES = 10;
+BootPhase bootPhases[MAX_BOOT_PHASES];
+uint8_t bootPhaseCount = 0;
+// The first activity draws from its own task, loop() finishes the list once a frame newer than this is on the panel
+bool firstScreenPending = false;
+uint32_t framesBeforeFirstScreen = 0;
+
+// Serial may not be up yet and prints would skew the power button timing, so phases are only recorded here
+void markBootPhase(const char* name) {
+  if (bootPhaseCount < MAX_BOOT_PHASES) {
+    bootPhases[bootPhaseCount++] = {name, millis()};
+  }
+}
+
+void printBootPhases() {
+  unsigned long phaseStart = 0;
+  for (uint8_t i = 0; i < bootPhaseCount; i++) {
+    Serial.printf("[%lu] [BOOT] %-22s %5lu ms\n", millis(), bootPhases[i].name, bootPhases[i].endMs - phaseStart);
+    phaseStart = bootPhases[i].endMs;
+  }
+  Serial.printf("[%lu] [BOOT] Ready for input %lu ms after reset\n", millis(), phaseStart);
+}
+
+// A book with its index on the SD card opens in about the time of a refresh, its page can be the first screen
+bool isQuickToResume(const std::string& path) {
+  if (!SdMan.exists(path.c_str())) {
+    return false;
+  }
+  // XTC pages are prerendered, opening one only reads its header and page table
+  if (ReaderActivity::isXtcFile(path)) {
+    return true;
+  }
+  const Epub epub(path, "/.crosspoint");
+  return SdMan.exists((epub.getCachePath() + "/book.bin").c_str());
+}
+
 void setupDisplayAndFonts() {
   einkDisplay.begin();
   Serial.printf("[%lu] [   ] Display initialized\n", millis());
@@ -256,6 +347,7 @@ void setup() {
     Serial.begin(115200);
   }
 
+  CPU_GOVERNOR.begin();
   inputManager.begin();
   // Initialize pins
   pinMode(BAT_GPIO0, INPUT);
@@ -265,7 +357,9 @@ void setup() {
 
   // SD Card Initialization
   // We need 6 open files concurrently when parsing a new chapter
-  if (!SdMan.begin()) {
+  const bool sdReady = SdMan.begin();
+  markBootPhase("sd card");
+  if (!sdReady) {
     Serial.printf("[%lu] [   ] SD card initialization failed\n", millis());
     setupDisplayAndFonts();
     exitActivity();
@@ -275,27 +369,51 @@ void setup() {
 
   SETTINGS.loadFromFile();
 
+  markBootPhase("settings");
+
   // verify power button press duration after we've read settings.
   verifyWakeupLongPress();
+  markBootPhase("power button");
 
   // First serial output only here to avoid timing inconsistencies for power button press duration verification
   Serial.printf("[%lu] [   ] Starting CrossPoint version " CROSSPOINT_VERSION "\n", millis());
 
   setupDisplayAndFonts();
-
-  exitActivity();
-  enterNewActivity(new BootActivity(renderer, mappedInputManager));
+  markBootPhase("display and fonts");
 
   APP_STATE.loadFromFile();
-  if (APP_STATE.openEpubPath.empty()) {
+  const auto path = APP_STATE.openEpubPath;
+  markBootPhase("book state");
+
+  // Book caches of older firmware are moved once, before any book is opened. With a large library that takes a while,
+  // the boot screen goes up first so it doesn't look like a hang.
+  const bool migrating = BookCacheMigration::hasWork("/.crosspoint");
+  if (migrating) {
+    exitActivity();
+    enterNewActivity(new BootActivity(renderer, mappedInputManager));
+    markBootPhase("boot screen");
+    BookCacheMigration::run("/.crosspoint");
+  }
+  markBootPhase("book caches");
+
+  // The boot screen is a full panel refresh of its own, only worth it while something slow comes after it
+  if (!migrating && (path.empty() || !isQuickToResume(path))) {
+    exitActivity();
+    enterNewActivity(new BootActivity(renderer, mappedInputManager));
+    markBootPhase("boot screen");
+  }
+
+  framesBeforeFirstScreen = renderer.getDisplayedFrames();
+  firstScreenPending = true;
+  if (path.empty()) {
     onGoHome();
   } else {
     // Clear app state to avoid getting into a boot loop if the epub doesn't load
-    const auto path = APP_STATE.openEpubPath;
     APP_STATE.openEpubPath = "";
     APP_STATE.saveToFile();
     onGoToReader(path);
   }
+  markBootPhase("first activity");
 
   // Ensure we're not still holding the power button before leaving setup
   waitForPowerRelease();
@@ -308,6 +426,12 @@ void loop() {
 
   inputManager.update();
 
+  if (firstScreenPending && renderer.getDisplayedFrames() != framesBeforeFirstScreen) {
+    firstScreenPending = false;
+    markBootPhase("first screen");
+    printBootPhases();
+  }
+
   if (Serial && millis() - lastMemPrint >= 10000) {
     Serial.printf("[%lu] [MEM] Free: %d bytes, Total: %d bytes, Min Free: %d bytes\n", millis(), ESP.getFreeHeap(),
                   ESP.getHeapSize(), ESP.getMinFreeHeap());
@@ -316,8 +440,9 @@ void loop() {
 
   // Check for any user activity (button press or release)
   static unsigned long lastActivityTime = millis();
-  if (inputManager.wasAnyPressed() || inputManager.wasAnyReleased()) {
+  if (inputManager.wasAnyPressed() || inputManager.wasAnyReleased() || isAnyButtonHeld()) {
     lastActivityTime = millis();  // Reset inactivity timer
+    CPU_GOVERNOR.onUserInput();
   }
 
   const unsigned long sleepTimeoutMs = SETTINGS.getSleepTimeoutMs();
@@ -350,11 +475,16 @@ void loop() {
     }
   }
 
+  // Drop back to the idle clock once the activity has no more CPU bound work
+  CPU_GOVERNOR.update();
+
   // Add delay at the end of the loop to prevent tight spinning
   // When an activity requests skip loop delay (e.g., webserver running), use yield() for faster response
-  // Otherwise, use longer delay to save power
+  // Otherwise, use longer delay to save power, or light sleep when idle between page turns
   if (currentActivity && currentActivity->skipLoopDelay()) {
     yield();  // Give FreeRTOS a chance to run tasks, but return immediately
+  } else if (canIdleSleep(lastActivityTime)) {
+    idleLightSleep();
   } else {
     delay(10);  // Normal delay when no activity requires fast response
   }
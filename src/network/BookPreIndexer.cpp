@@ -0,0 +1,141 @@
+#include "BookPreIndexer.h"
+
+#include <Epub.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Xtc.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "CpuGovernor.h"
+
+namespace {
+bool endsWithIgnoreCase(const std::string& str, const char* suffix) {
+  const size_t suffixLen = strlen(suffix);
+  if (str.length() < suffixLen) return false;
+  for (size_t i = 0; i < suffixLen; i++) {
+    if (tolower(str[str.length() - suffixLen + i]) != suffix[i]) return false;
+  }
+  return true;
+}
+}  // namespace
+
+bool BookPreIndexer::isIndexable(const std::string& path) {
+  return endsWithIgnoreCase(path, ".epub") || endsWithIgnoreCase(path, ".xtc") || endsWithIgnoreCase(path, ".xtch");
+}
+
+const char* BookPreIndexer::statusToString(const Status status) {
+  switch (status) {
+    case Status::QUEUED:
+      return "queued";
+    case Status::READY:
+      return "ready";
+    case Status::FAILED:
+      return "failed";
+  }
+  return "unknown";
+}
+
+void BookPreIndexer::enqueue(const std::string& path) {
+  if (!isIndexable(path)) {
+    return;
+  }
+
+  // Re-uploading a book resets its state
+  remove(path);
+
+  if (entries.size() >= MAX_ENTRIES) {
+    const auto finished = std::find_if(entries.begin(), entries.end(),
+                                       [](const Entry& entry) { return entry.status != Status::QUEUED; });
+    if (finished == entries.end()) {
+      Serial.printf("[%lu] [PIX] Queue full, not pre-indexing: %s\n", millis(), path.c_str());
+      return;
+    }
+    entries.erase(finished);
+  }
+
+  entries.push_back({path, Status::QUEUED, Step::CACHE});
+  Serial.printf("[%lu] [PIX] Queued for pre-indexing: %s\n", millis(), path.c_str());
+}
+
+void BookPreIndexer::remove(const std::string& path) {
+  entries.erase(
+      std::remove_if(entries.begin(), entries.end(), [&path](const Entry& entry) { return entry.path == path; }),
+      entries.end());
+}
+
+bool BookPreIndexer::hasPending() const { return getPendingCount() > 0; }
+
+size_t BookPreIndexer::getPendingCount() const {
+  return std::count_if(entries.begin(), entries.end(),
+                       [](const Entry& entry) { return entry.status == Status::QUEUED; });
+}
+
+bool BookPreIndexer::processNext() {
+  const auto next =
+      std::find_if(entries.begin(), entries.end(), [](const Entry& entry) { return entry.status == Status::QUEUED; });
+  if (next == entries.end()) {
+    return false;
+  }
+
+  const CpuBoost boost;
+  const auto start = millis();
+  if (next->step == Step::CACHE) {
+    Serial.printf("[%lu] [PIX] Pre-indexing: %s\n", start, next->path.c_str());
+    if (!SdMan.exists(next->path.c_str())) {
+      Serial.printf("[%lu] [PIX] File no longer exists: %s\n", millis(), next->path.c_str());
+      next->status = Status::FAILED;
+    } else if (!buildCache(next->path)) {
+      Serial.printf("[%lu] [PIX] Pre-indexing failed in %lu ms: %s\n", millis(), millis() - start,
+                    next->path.c_str());
+      next->status = Status::FAILED;
+    } else {
+      Serial.printf("[%lu] [PIX] Built cache in %lu ms: %s\n", millis(), millis() - start, next->path.c_str());
+      next->step = Step::COVER;
+    }
+    return true;
+  }
+
+  generateCover(next->path);
+  next->status = Status::READY;
+  Serial.printf("[%lu] [PIX] Pre-indexing done, cover in %lu ms: %s\n", millis(), millis() - start,
+                next->path.c_str());
+  return true;
+}
+
+const BookPreIndexer::Entry* BookPreIndexer::findEntry(const std::string& path) const {
+  const auto entry =
+      std::find_if(entries.begin(), entries.end(), [&path](const Entry& entry) { return entry.path == path; });
+  return entry != entries.end() ? &*entry : nullptr;
+}
+
+void BookPreIndexer::clearCache(const std::string& path) {
+  if (endsWithIgnoreCase(path, ".epub")) {
+    Epub(path, CACHE_DIR).clearCache();
+  } else if (isIndexable(path)) {
+    Xtc(path, CACHE_DIR).clearCache();
+  }
+}
+
+bool BookPreIndexer::buildCache(const std::string& path) {
+  if (endsWithIgnoreCase(path, ".epub")) {
+    return Epub(path, CACHE_DIR).load();
+  }
+  return Xtc(path, CACHE_DIR).load();
+}
+
+void BookPreIndexer::generateCover(const std::string& path) {
+  // Not every book has a (JPG) cover, so don't treat this as a failure
+  bool generated = false;
+  if (endsWithIgnoreCase(path, ".epub")) {
+    Epub epub(path, CACHE_DIR);
+    generated = epub.load(false) && epub.generateCoverBmp();
+  } else {
+    Xtc xtc(path, CACHE_DIR);
+    generated = xtc.load() && xtc.generateCoverBmp();
+  }
+  if (!generated) {
+    Serial.printf("[%lu] [PIX] No cover generated for: %s\n", millis(), path.c_str());
+  }
+}
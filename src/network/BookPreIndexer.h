@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * BookPreIndexer keeps a small queue of books that have just landed on the SD card (e.g. via the web server upload)
+ * and builds their cache (book.bin and cover.bmp) ahead of the first open.
+ *
+ * Work is performed synchronously, one step of one book (its book.bin, then its cover) per processNext() call, so the
+ * owner decides when it is safe to touch the SD card (e.g. between web requests while holding the rendering mutex).
+ */
+class BookPreIndexer {
+ public:
+  enum class Status : uint8_t { QUEUED, READY, FAILED };
+
+  // Where book caches live, shared with everything that reads them
+  static constexpr char CACHE_DIR[] = "/.crosspoint";
+
+  // Indexing is split into steps so the web server can serve requests between them
+  enum class Step : uint8_t { CACHE, COVER };
+
+  struct Entry {
+    std::string path;
+    Status status;
+    Step step;
+  };
+
+ private:
+  // Upper bound on remembered books, oldest finished entries are dropped first
+  static constexpr size_t MAX_ENTRIES = 32;
+  std::vector<Entry> entries;
+
+  static bool buildCache(const std::string& path);
+  static void generateCover(const std::string& path);
+
+ public:
+  BookPreIndexer() = default;
+  ~BookPreIndexer() = default;
+
+  // Whether the file is a book type that has a cache to build
+  static bool isIndexable(const std::string& path);
+  static const char* statusToString(Status status);
+  // Drop the cache of a book that is about to be replaced, a new file at the same path would otherwise open with it
+  static void clearCache(const std::string& path);
+
+  void enqueue(const std::string& path);
+  void remove(const std::string& path);
+  bool hasPending() const;
+  size_t getPendingCount() const;
+  // Run the next step of the oldest queued book, returns false if there was nothing to do
+  bool processNext();
+  const Entry* findEntry(const std::string& path) const;
+  const std::vector<Entry>& getEntries() const { return entries; }
+};
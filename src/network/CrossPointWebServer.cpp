@@ -1,12 +1,17 @@
 #include "CrossPointWebServer.h"
 
 #include <ArduinoJson.h>
+#include <Epub.h>
 #include <FsHelpers.h>
 #include <SDCardManager.h>
 #include <WiFi.h>
 
 #include <algorithm>
 
+#include "BookSession.h"
+#include "CpuGovernor.h"
+#include "JsonChunkWriter.h"
+#include "SleepImageManifest.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
 
@@ -15,13 +20,19 @@ namespace {
 // Note: Items starting with "." are automatically hidden
 const char* HIDDEN_ITEMS[] = {"System Volume Information", "XTCache"};
 constexpr size_t HIDDEN_ITEMS_COUNT = sizeof(HIDDEN_ITEMS) / sizeof(HIDDEN_ITEMS[0]);
+// Quiet period after the last upload chunk before background pre-indexing may use the SD card
+constexpr unsigned long PRE_INDEX_IDLE_MS = 2000;
+// Full clock after each upload chunk, long enough to bridge the gap to the next one
+constexpr unsigned long UPLOAD_BOOST_MS = 1000;
+// Page size limits for /api/files
+constexpr size_t FILE_LIST_DEFAULT_LIMIT = 100;
+constexpr size_t FILE_LIST_MAX_LIMIT = 500;
 }  // namespace
 
-// File listing page template - now using generated headers:
-// - HomePageHtml (from html/HomePage.html)
-// - FilesPageHeaderHtml (from html/FilesPageHeader.html)
-// - FilesPageFooterHtml (from html/FilesPageFooter.html)
-CrossPointWebServer::CrossPointWebServer() {}
+// Pages are embedded gzip-compressed by scripts/build_html.py:
+// - HomePageHtmlGz (from html/HomePage.html)
+// - FilesPageHtmlGz (from html/FilesPage.html)
+CrossPointWebServer::CrossPointWebServer() : preIndexer(new BookPreIndexer()), fileListing(new FileListing()) {}
 
 CrossPointWebServer::~CrossPointWebServer() { stop(); }
 
@@ -45,6 +56,9 @@ void CrossPointWebServer::begin() {
   // Store AP mode flag for later use (e.g., in handleStatus)
   apMode = isInApMode;
 
+  // The server needs the heap more than the reader needs its retained books
+  BOOK_SESSION.clear();
+
   Serial.printf("[%lu] [WEB] [MEM] Free heap before begin: %d bytes\n", millis(), ESP.getFreeHeap());
   Serial.printf("[%lu] [WEB] Network mode: %s\n", millis(), apMode ? "AP" : "STA");
 
@@ -83,6 +97,10 @@ void CrossPointWebServer::begin() {
   server->on("/delete", HTTP_POST, [this] { handleDelete(); });
 
   server->onNotFound([this] { handleNotFound(); });
+
+  // WebServer only keeps request headers it was told about, we need If-None-Match for page caching
+  const char* headerKeys[] = {"If-None-Match"};
+  server->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
   Serial.printf("[%lu] [WEB] [MEM] Free heap after route setup: %d bytes\n", millis(), ESP.getFreeHeap());
 
   server->begin();
@@ -150,8 +168,21 @@ void CrossPointWebServer::handleClient() const {
   server->handleClient();
 }
 
+void CrossPointWebServer::sendGzipPage(const uint8_t* data, const size_t size, const char* etag) const {
+  // Browsers revalidate on every load, which is answered with an empty 304 while the firmware is unchanged
+  server->sendHeader("ETag", etag);
+  server->sendHeader("Cache-Control", "no-cache");
+  if (server->header("If-None-Match") == etag) {
+    server->send(304);
+    return;
+  }
+
+  server->sendHeader("Content-Encoding", "gzip");
+  server->send_P(200, "text/html", reinterpret_cast<const char*>(data), size);
+}
+
 void CrossPointWebServer::handleRoot() const {
-  server->send(200, "text/html", HomePageHtml);
+  sendGzipPage(HomePageHtmlGz, HomePageHtmlGzSize, HomePageHtmlEtag);
   Serial.printf("[%lu] [WEB] Served root page\n", millis());
 }
 
@@ -241,7 +272,45 @@ bool CrossPointWebServer::isEpubFile(const String& filename) const {
   return lower.endsWith(".epub");
 }
 
-void CrossPointWebServer::handleFileList() const { server->send(200, "text/html", FilesPageHtml); }
+void CrossPointWebServer::handleFileList() const {
+  sendGzipPage(FilesPageHtmlGz, FilesPageHtmlGzSize, FilesPageHtmlEtag);
+}
+
+void CrossPointWebServer::FileListing::clear() {
+  path = "";
+  sort = "";
+  // swap() rather than clear() so the memory is actually returned
+  std::string().swap(names);
+  std::vector<Entry>().swap(entries);
+}
+
+void CrossPointWebServer::buildFileListing(const String& path, const String& sort) const {
+  const unsigned long start = millis();
+  fileListing->clear();
+  fileListing->path = path;
+  fileListing->sort = sort;
+
+  scanFiles(path.c_str(), [this](const FileInfo& info) {
+    fileListing->entries.push_back({static_cast<uint32_t>(fileListing->names.size()), static_cast<uint32_t>(info.size),
+                                    info.isDirectory, info.isEpub});
+    fileListing->names.append(info.name.c_str(), info.name.length() + 1);
+  });
+
+  // Folders always come first. "type" puts books before other files, "size" lists the largest files first.
+  const FileListing& listing = *fileListing;
+  const bool bySize = sort == "size";
+  const bool byType = !bySize && sort != "name";
+  std::sort(fileListing->entries.begin(), fileListing->entries.end(),
+            [&listing, bySize, byType](const FileListing::Entry& a, const FileListing::Entry& b) {
+              if (a.isDirectory != b.isDirectory) return a.isDirectory;
+              if (byType && a.isEpub != b.isEpub) return a.isEpub;
+              if (bySize && a.size != b.size) return a.size > b.size;
+              return strcasecmp(listing.nameOf(a), listing.nameOf(b)) < 0;
+            });
+
+  Serial.printf("[%lu] [WEB] Listed %u entries in %s (sort=%s) in %lu ms\n", millis(), listing.entries.size(),
+                path.c_str(), sort.c_str(), millis() - start);
+}
 
 void CrossPointWebServer::handleFileListData() const {
   // Get current path from query string (default to root)
@@ -258,39 +327,95 @@ void CrossPointWebServer::handleFileListData() const {
     }
   }
 
+  const String sort = server->hasArg("sort") ? server->arg("sort") : String("type");
+  size_t cursor = server->hasArg("cursor") ? std::max(0L, server->arg("cursor").toInt()) : 0;
+  size_t limit = server->hasArg("limit") ? std::max(1L, server->arg("limit").toInt()) : FILE_LIST_DEFAULT_LIMIT;
+  limit = std::min(limit, FILE_LIST_MAX_LIMIT);
+
+  // The first page always rescans so a reload reflects the card, following pages reuse that snapshot so the cursor
+  // stays stable and the directory is only read once
+  if (cursor == 0 || fileListing->path != currentPath || fileListing->sort != sort) {
+    buildFileListing(currentPath, sort);
+  }
+  const auto& entries = fileListing->entries;
+  cursor = std::min(cursor, entries.size());
+  const size_t end = std::min(entries.size(), cursor + limit);
+
   server->setContentLength(CONTENT_LENGTH_UNKNOWN);
   server->send(200, "application/json", "");
-  server->sendContent("[");
-  char output[512];
-  constexpr size_t outputSize = sizeof(output);
-  bool seenFirst = false;
-  JsonDocument doc;
 
-  scanFiles(currentPath.c_str(), [this, &output, &doc, seenFirst](const FileInfo& info) mutable {
-    doc.clear();
-    doc["name"] = info.name;
-    doc["size"] = info.size;
-    doc["isDirectory"] = info.isDirectory;
-    doc["isEpub"] = info.isEpub;
-
-    const size_t written = serializeJson(doc, output, outputSize);
-    if (written >= outputSize) {
-      // JSON output truncated; skip this entry to avoid sending malformed JSON
-      Serial.printf("[%lu] [WEB] Skipping file entry with oversized JSON for name: %s\n", millis(), info.name.c_str());
-      return;
-    }
+  JsonChunkWriter json(*server);
+  json.beginObject();
+  json.key("path");
+  json.value(currentPath.c_str());
+  json.key("sort");
+  json.value(fileListing->sort.c_str());
+  json.key("total");
+  json.value(static_cast<uint64_t>(entries.size()));
+  json.key("nextCursor");
+  if (end < entries.size()) {
+    json.value(static_cast<uint64_t>(end));
+  } else {
+    json.null();
+  }
 
-    if (seenFirst) {
-      server->sendContent(",");
-    } else {
-      seenFirst = true;
+  json.key("files");
+  json.beginArray();
+  String basePath = currentPath;
+  if (!basePath.endsWith("/")) basePath += "/";
+  for (size_t i = cursor; i < end; i++) {
+    const auto& entry = entries[i];
+    const char* name = fileListing->nameOf(entry);
+
+    json.beginObject();
+    json.key("name");
+    json.value(name);
+    json.key("size");
+    json.value(static_cast<uint64_t>(entry.size));
+    json.key("isDirectory");
+    json.value(entry.isDirectory);
+    json.key("isEpub");
+    json.value(entry.isEpub);
+
+    if (!entry.isDirectory && BookPreIndexer::isIndexable(name)) {
+      const std::string filePath = std::string(basePath.c_str()) + name;
+      const auto* indexEntry = preIndexer->findEntry(filePath);
+      if (indexEntry) {
+        json.key("indexStatus");
+        json.value(BookPreIndexer::statusToString(indexEntry->status));
+      }
+
+      // Only report metadata that is already cached, and only the header of book.bin, a page can list hundreds of books
+      std::string title;
+      std::string author;
+      if (entry.isEpub &&
+          BookMetadataCache::readTitleAndAuthor(Epub(filePath, BookPreIndexer::CACHE_DIR).getCachePath(), title,
+                                                author)) {
+        if (!title.empty()) {
+          json.key("title");
+          json.value(title.c_str());
+        }
+        if (!author.empty()) {
+          json.key("author");
+          json.value(author.c_str());
+        }
+      }
     }
-    server->sendContent(output);
-  });
-  server->sendContent("]");
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  json.flush();
+
   // End of streamed response, empty chunk to signal client
   server->sendContent("");
-  Serial.printf("[%lu] [WEB] Served file listing page for path: %s\n", millis(), currentPath.c_str());
+  Serial.printf("[%lu] [WEB] Served file listing entries %u-%u of %u for path: %s\n", millis(), cursor, end,
+                entries.size(), currentPath.c_str());
+
+  // Release the snapshot once the client has everything
+  if (end == entries.size()) {
+    fileListing->clear();
+  }
 }
 
 // Static variables for upload handling
@@ -300,6 +425,11 @@ static String uploadPath = "/";
 static size_t uploadSize = 0;
 static bool uploadSuccess = false;
 static String uploadError = "";
+static unsigned long lastUploadActivityTime = 0;
+
+bool CrossPointWebServer::isIdle() const {
+  return !uploadFile && millis() - lastUploadActivityTime >= PRE_INDEX_IDLE_MS;
+}
 
 void CrossPointWebServer::handleUpload() const {
   static unsigned long lastWriteTime = 0;
@@ -313,6 +443,9 @@ void CrossPointWebServer::handleUpload() const {
   }
 
   const HTTPUpload& upload = server->upload();
+  lastUploadActivityTime = millis();
+  // Upload chunks arrive one at a time with no clear end when a client goes away, so keep the clock up for a while
+  CPU_GOVERNOR.boostFor(UPLOAD_BOOST_MS);
 
   if (upload.status == UPLOAD_FILE_START) {
     uploadFileName = upload.filename;
@@ -352,6 +485,8 @@ void CrossPointWebServer::handleUpload() const {
     if (SdMan.exists(filePath.c_str())) {
       Serial.printf("[%lu] [WEB] [UPLOAD] Overwriting existing file: %s\n", millis(), filePath.c_str());
       SdMan.remove(filePath.c_str());
+      // The cache is keyed by path, the new book would be opened with the old book's index and sections
+      BookPreIndexer::clearCache(filePath.c_str());
     }
 
     // Open file for writing
@@ -399,6 +534,14 @@ void CrossPointWebServer::handleUpload() const {
       if (uploadError.isEmpty()) {
         uploadSuccess = true;
         Serial.printf("[%lu] [WEB] Upload complete: %s (%d bytes)\n", millis(), uploadFileName.c_str(), uploadSize);
+
+        // Build the book cache while Wi-Fi keeps us awake anyway, so the first open is quick
+        String filePath = uploadPath;
+        if (!filePath.endsWith("/")) filePath += "/";
+        filePath += uploadFileName;
+        BOOK_SESSION.invalidate(filePath.c_str());
+        preIndexer->enqueue(filePath.c_str());
+        SleepImageManifest::invalidate(filePath.c_str());
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -548,6 +691,9 @@ void CrossPointWebServer::handleDelete() const {
   }
 
   if (success) {
+    BOOK_SESSION.invalidate(itemPath.c_str());
+    preIndexer->remove(itemPath.c_str());
+    SleepImageManifest::invalidate(itemPath.c_str());
     Serial.printf("[%lu] [WEB] Successfully deleted: %s\n", millis(), itemPath.c_str());
     server->send(200, "text/plain", "Deleted successfully");
   } else {
@@ -2,8 +2,12 @@
 
 #include <WebServer.h>
 
+#include <memory>
+#include <string>
 #include <vector>
 
+#include "BookPreIndexer.h"
+
 // Structure to hold file information
 struct FileInfo {
   String name;
@@ -13,6 +17,23 @@ struct FileInfo {
 };
 
 class CrossPointWebServer {
+  // Sorted snapshot of one directory, kept while a client pages through /api/files
+  struct FileListing {
+    struct Entry {
+      uint32_t nameOffset;  // into names
+      uint32_t size;
+      bool isDirectory;
+      bool isEpub;
+    };
+    String path;
+    String sort;
+    std::string names;  // NUL separated, avoids a heap allocation per entry
+    std::vector<Entry> entries;
+
+    const char* nameOf(const Entry& entry) const { return names.c_str() + entry.nameOffset; }
+    void clear();
+  };
+
  public:
   CrossPointWebServer();
   ~CrossPointWebServer();
@@ -32,16 +53,28 @@ class CrossPointWebServer {
   // Get the port number
   uint16_t getPort() const { return port; }
 
+  // Books uploaded during this session that are waiting for (or done with) pre-indexing
+  BookPreIndexer& getPreIndexer() const { return *preIndexer; }
+
+  // True when no upload is in flight and the server has been quiet for a moment, so background SD work won't stall
+  // a transfer
+  bool isIdle() const;
+
  private:
   std::unique_ptr<WebServer> server = nullptr;
   bool running = false;
   bool apMode = false;  // true when running in AP mode, false for STA mode
   uint16_t port = 80;
+  std::unique_ptr<BookPreIndexer> preIndexer;
+  std::unique_ptr<FileListing> fileListing;
 
   // File scanning
   void scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const;
   String formatFileSize(size_t bytes) const;
   bool isEpubFile(const String& filename) const;
+  void buildFileListing(const String& path, const String& sort) const;
+  // Serve an embedded gzip page, or 304 if the client already has this version
+  void sendGzipPage(const uint8_t* data, size_t size, const char* etag) const;
 
   // Request handlers
   void handleRoot() const;
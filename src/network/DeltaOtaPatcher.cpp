@@ -0,0 +1,269 @@
+#include "DeltaOtaPatcher.h"
+
+#include <HardwareSerial.h>
+#include <Update.h>
+#include <esp_ota_ops.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr char MAGIC[] = "CPDELTA1";
+constexpr size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+
+uint32_t readLe32(const uint8_t* data) {
+  return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 | static_cast<uint32_t>(data[2]) << 16 |
+         static_cast<uint32_t>(data[3]) << 24;
+}
+}  // namespace
+
+DeltaOtaPatcher::~DeltaOtaPatcher() {
+  free(inflator);
+  free(dictionary);
+  free(baseBuffer);
+  mbedtls_sha256_free(&targetSha);
+}
+
+bool DeltaOtaPatcher::begin() {
+  basePartition = esp_ota_get_running_partition();
+  if (!basePartition) {
+    Serial.printf("[%lu] [DOTA] Could not find running partition\n", millis());
+    return fail(BAD_HEADER);
+  }
+
+  inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  baseBuffer = static_cast<uint8_t*>(malloc(BASE_READ_SIZE));
+  if (!inflator || !dictionary || !baseBuffer) {
+    Serial.printf("[%lu] [DOTA] Failed to allocate patch buffers\n", millis());
+    return fail(OOM);
+  }
+  memset(inflator, 0, sizeof(tinfl_decompressor));
+  tinfl_init(inflator);
+
+  mbedtls_sha256_starts_ret(&targetSha, 0);
+
+  state = State::HEADER;
+  error = NONE;
+  pendingBytes = 0;
+  outputSize = 0;
+  basePos = 0;
+  dictionaryCursor = 0;
+  return true;
+}
+
+bool DeltaOtaPatcher::fail(const Error err) {
+  error = err;
+  return false;
+}
+
+bool DeltaOtaPatcher::parseHeader() {
+  if (memcmp(header, MAGIC, MAGIC_SIZE) != 0) {
+    Serial.printf("[%lu] [DOTA] Not a delta patch\n", millis());
+    return fail(BAD_HEADER);
+  }
+
+  const uint8_t* cursor = header + MAGIC_SIZE;
+  baseSize = readLe32(cursor);
+  cursor += 4 + 32;
+  targetSize = readLe32(cursor);
+  cursor += 4;
+  memcpy(targetSha256, cursor, sizeof(targetSha256));
+
+  if (baseSize > basePartition->size) {
+    Serial.printf("[%lu] [DOTA] Base image larger than partition\n", millis());
+    return fail(BASE_MISMATCH);
+  }
+  if (!baseMatches()) {
+    Serial.printf("[%lu] [DOTA] Running image is not the base of this patch\n", millis());
+    return fail(BASE_MISMATCH);
+  }
+
+  if (!Update.begin(targetSize)) {
+    Serial.printf("[%lu] [DOTA] Update.begin failed: %s\n", millis(), Update.errorString());
+    return fail(UPDATE_BEGIN_FAILED);
+  }
+
+  Serial.printf("[%lu] [DOTA] Patching %u byte base into %u byte image\n", millis(), baseSize, targetSize);
+  return true;
+}
+
+bool DeltaOtaPatcher::baseMatches() const {
+  const unsigned long start = millis();
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts_ret(&sha, 0);
+
+  for (uint32_t offset = 0; offset < baseSize; offset += BASE_READ_SIZE) {
+    const size_t len = std::min<size_t>(BASE_READ_SIZE, baseSize - offset);
+    if (esp_partition_read(basePartition, offset, baseBuffer, len) != ESP_OK) {
+      mbedtls_sha256_free(&sha);
+      return false;
+    }
+    mbedtls_sha256_update_ret(&sha, baseBuffer, len);
+  }
+
+  uint8_t digest[32];
+  mbedtls_sha256_finish_ret(&sha, digest);
+  mbedtls_sha256_free(&sha);
+  Serial.printf("[%lu] [DOTA] Hashed running image in %lu ms\n", millis(), millis() - start);
+  return memcmp(digest, header + MAGIC_SIZE + 4, sizeof(digest)) == 0;
+}
+
+bool DeltaOtaPatcher::write(const uint8_t* data, size_t len) {
+  if (error != NONE) {
+    return false;
+  }
+
+  if (state == State::HEADER) {
+    const size_t take = std::min(len, HEADER_SIZE - pendingBytes);
+    memcpy(header + pendingBytes, data, take);
+    pendingBytes += take;
+    data += take;
+    len -= take;
+    if (pendingBytes < HEADER_SIZE) {
+      return true;
+    }
+    if (!parseHeader()) {
+      return false;
+    }
+    pendingBytes = 0;
+    state = State::CONTROL;
+  }
+
+  // Anything after the end of the deflate stream is ignored
+  return len == 0 || state == State::DONE || inflate(data, len);
+}
+
+bool DeltaOtaPatcher::inflate(const uint8_t* data, size_t len) {
+  while (state != State::DONE) {
+    size_t inBytes = len;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - dictionaryCursor;
+    const tinfl_status status = tinfl_decompress(inflator, data, &inBytes, dictionary, dictionary + dictionaryCursor,
+                                                 &outBytes, TINFL_FLAG_HAS_MORE_INPUT);
+    data += inBytes;
+    len -= inBytes;
+
+    if (outBytes > 0) {
+      if (!consume(dictionary + dictionaryCursor, outBytes)) {
+        return false;
+      }
+      dictionaryCursor = (dictionaryCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+    }
+
+    if (status < 0) {
+      Serial.printf("[%lu] [DOTA] tinfl_decompress() failed with status %d\n", millis(), status);
+      return fail(CORRUPT_PATCH);
+    }
+    if (status == TINFL_STATUS_DONE || (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0)) {
+      break;
+    }
+  }
+  return true;
+}
+
+void DeltaOtaPatcher::settleRecord() {
+  if (state == State::DIFF && diffRemaining == 0) {
+    state = State::EXTRA;
+  }
+  if (state == State::EXTRA && extraRemaining == 0) {
+    basePos += seekAdjust;
+    state = outputSize == targetSize ? State::DONE : State::CONTROL;
+  }
+}
+
+bool DeltaOtaPatcher::consume(const uint8_t* data, size_t len) {
+  while (len > 0) {
+    switch (state) {
+      case State::CONTROL: {
+        const size_t take = std::min(len, CONTROL_SIZE - pendingBytes);
+        memcpy(control + pendingBytes, data, take);
+        pendingBytes += take;
+        data += take;
+        len -= take;
+        if (pendingBytes < CONTROL_SIZE) {
+          break;
+        }
+
+        pendingBytes = 0;
+        diffRemaining = readLe32(control);
+        extraRemaining = readLe32(control + 4);
+        seekAdjust = static_cast<int32_t>(readLe32(control + 8));
+        if (outputSize + diffRemaining + extraRemaining > targetSize ||
+            (diffRemaining > 0 && (basePos < 0 || basePos + diffRemaining > baseSize))) {
+          Serial.printf("[%lu] [DOTA] Patch record out of bounds at output %u\n", millis(), outputSize);
+          return fail(CORRUPT_PATCH);
+        }
+        state = State::DIFF;
+        break;
+      }
+      case State::DIFF: {
+        // Add the diff bytes onto the base image
+        const size_t take = std::min({len, static_cast<size_t>(diffRemaining), BASE_READ_SIZE});
+        if (esp_partition_read(basePartition, static_cast<size_t>(basePos), baseBuffer, take) != ESP_OK) {
+          Serial.printf("[%lu] [DOTA] Failed to read base image at %lld\n", millis(), basePos);
+          return fail(CORRUPT_PATCH);
+        }
+        for (size_t i = 0; i < take; i++) {
+          baseBuffer[i] += data[i];
+        }
+        if (!writeOutput(baseBuffer, take)) {
+          return false;
+        }
+        basePos += take;
+        diffRemaining -= take;
+        data += take;
+        len -= take;
+        break;
+      }
+      case State::EXTRA: {
+        const size_t take = std::min(len, static_cast<size_t>(extraRemaining));
+        if (!writeOutput(data, take)) {
+          return false;
+        }
+        extraRemaining -= take;
+        data += take;
+        len -= take;
+        break;
+      }
+      case State::HEADER:
+      case State::DONE:
+        Serial.printf("[%lu] [DOTA] Unexpected data after end of patch\n", millis());
+        return fail(CORRUPT_PATCH);
+    }
+    // Skip over empty diff/extra sections and advance to the next record once this one is complete
+    settleRecord();
+  }
+  return true;
+}
+
+bool DeltaOtaPatcher::writeOutput(const uint8_t* data, const size_t len) {
+  if (Update.write(const_cast<uint8_t*>(data), len) != len) {
+    Serial.printf("[%lu] [DOTA] Flash write failed at %u bytes. Error: %s\n", millis(), outputSize,
+                  Update.errorString());
+    return fail(FLASH_WRITE_FAILED);
+  }
+  mbedtls_sha256_update_ret(&targetSha, data, len);
+  outputSize += len;
+  return true;
+}
+
+bool DeltaOtaPatcher::finish() {
+  if (error != NONE) {
+    return false;
+  }
+  if (state != State::DONE || outputSize != targetSize) {
+    Serial.printf("[%lu] [DOTA] Patch ended early: %u / %u bytes\n", millis(), outputSize, targetSize);
+    return fail(CORRUPT_PATCH);
+  }
+
+  uint8_t digest[32];
+  mbedtls_sha256_finish_ret(&targetSha, digest);
+  if (memcmp(digest, targetSha256, sizeof(digest)) != 0) {
+    Serial.printf("[%lu] [DOTA] Rebuilt image does not match target checksum\n", millis());
+    return fail(TARGET_MISMATCH);
+  }
+
+  Serial.printf("[%lu] [DOTA] Rebuilt %u byte image\n", millis(), outputSize);
+  return true;
+}
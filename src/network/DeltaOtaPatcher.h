@@ -0,0 +1,81 @@
+#pragma once
+
+#include <esp_partition.h>
+#include <mbedtls/sha256.h>
+#include <miniz.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Applies a delta OTA patch (see scripts/make_delta_ota.py for the format) against the running app partition and
+ * streams the rebuilt image into the inactive one through the Update library.
+ *
+ * Patch bytes are pushed in with write() as they arrive from the network. The header is checked first: the running
+ * image has to hash to the patch's base SHA-256, otherwise BASE_MISMATCH is reported and the caller should fall back
+ * to a full image. RAM use is bounded by the inflate state, its 32 KB dictionary and a small base read buffer.
+ */
+class DeltaOtaPatcher {
+ public:
+  enum Error {
+    NONE = 0,
+    OOM,
+    BAD_HEADER,
+    BASE_MISMATCH,
+    UPDATE_BEGIN_FAILED,
+    CORRUPT_PATCH,
+    FLASH_WRITE_FAILED,
+    TARGET_MISMATCH,
+  };
+
+ private:
+  static constexpr size_t HEADER_SIZE = 8 + 4 + 32 + 4 + 32;
+  static constexpr size_t CONTROL_SIZE = 12;
+  static constexpr size_t BASE_READ_SIZE = 1024;
+
+  enum class State : uint8_t { HEADER, CONTROL, DIFF, EXTRA, DONE };
+
+  State state = State::HEADER;
+  Error error = NONE;
+
+  uint8_t header[HEADER_SIZE] = {};
+  uint8_t control[CONTROL_SIZE] = {};
+  size_t pendingBytes = 0;  // Bytes collected into header/control so far
+
+  uint32_t baseSize = 0;
+  uint32_t targetSize = 0;
+  uint8_t targetSha256[32] = {};
+
+  uint32_t diffRemaining = 0;
+  uint32_t extraRemaining = 0;
+  int32_t seekAdjust = 0;
+  int64_t basePos = 0;
+  size_t outputSize = 0;
+
+  tinfl_decompressor* inflator = nullptr;
+  uint8_t* dictionary = nullptr;
+  size_t dictionaryCursor = 0;
+  uint8_t* baseBuffer = nullptr;
+  const esp_partition_t* basePartition = nullptr;
+  mbedtls_sha256_context targetSha;
+
+  bool fail(Error err);
+  bool parseHeader();
+  bool baseMatches() const;
+  bool inflate(const uint8_t* data, size_t len);
+  bool consume(const uint8_t* data, size_t len);
+  void settleRecord();
+  bool writeOutput(const uint8_t* data, size_t len);
+
+ public:
+  DeltaOtaPatcher() { mbedtls_sha256_init(&targetSha); }
+  ~DeltaOtaPatcher();
+
+  bool begin();
+  // Feed the next patch bytes, returns false once the patch can't be applied (see getError())
+  bool write(const uint8_t* data, size_t len);
+  // Verify the rebuilt image, must be called before Update.end()
+  bool finish();
+
+  Error getError() const { return error; }
+};
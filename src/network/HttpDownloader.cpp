@@ -0,0 +1,393 @@
+#include "HttpDownloader.h"
+
+#include <HTTPClient.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <WiFiClientSecure.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+constexpr size_t READ_BLOCK_SIZE = 1024;
+// Received data is written to the card in blocks of this size (a whole number of 512 byte sectors)
+constexpr size_t WRITE_BLOCK_SIZE = 8 * 1024;
+// A connection that delivers nothing for this long is dropped and the download resumed on a new one
+constexpr unsigned long STALL_TIMEOUT_MS = 10000;
+constexpr int MAX_RESUME_ATTEMPTS = 5;
+constexpr unsigned long RESUME_BACKOFF_MS = 2000;
+
+constexpr size_t MAX_VALIDATOR_FILE_SIZE = 1024;
+
+enum class TransferResult { COMPLETE, INTERRUPTED, HTTP_FAILED, WRITE_FAILED };
+
+// Identifies the version of the file a partial download holds. It is sent as If-Range when resuming, so a server
+// whose file changed in between answers with the whole new body instead of the rest of it.
+struct Validator {
+  std::string etag;
+  std::string lastModified;
+
+  // Weak ETags can't be used in If-Range (RFC 9110 13.1.5), the date can
+  std::string ifRange() const {
+    if (!etag.empty() && etag.rfind("W/", 0) != 0) {
+      return etag;
+    }
+    return lastModified;
+  }
+
+  // A server that doesn't honour If-Range answers a range of the new file, tell by the validators it sends with it
+  bool matches(const Validator& response) const {
+    if (!etag.empty() && !response.etag.empty()) {
+      return etag == response.etag;
+    }
+    return lastModified.empty() || response.lastModified.empty() || lastModified == response.lastModified;
+  }
+};
+
+bool readValidator(const std::string& path, Validator& validator) {
+  FsFile file;
+  if (!SdMan.exists(path.c_str()) || !SdMan.openFileForRead("HTTP", path, file)) {
+    return false;
+  }
+  const bool valid = file.size() <= MAX_VALIDATOR_FILE_SIZE;
+  if (valid) {
+    serialization::readString(file, validator.etag);
+    serialization::readString(file, validator.lastModified);
+  }
+  file.close();
+  return valid && !validator.ifRange().empty();
+}
+
+// Called with the SD mutex held
+bool writeValidator(const std::string& path, const Validator& validator) {
+  FsFile file;
+  if (!SdMan.openFileForWrite("HTTP", path, file)) {
+    return false;
+  }
+  serialization::writeString(file, validator.etag);
+  serialization::writeString(file, validator.lastModified);
+  file.close();
+  return true;
+}
+
+// Called with the SD mutex held, drops what the partial file holds to download it again from the start
+bool restart(FsFile& file, const std::string& validatorPath, size_t& written) {
+  written = 0;
+  if (SdMan.exists(validatorPath.c_str())) {
+    SdMan.remove(validatorPath.c_str());
+  }
+  return file.truncate(0) && file.seekSet(0);
+}
+
+WiFiClient* createClient(const std::string& url) {
+  if (url.rfind("https://", 0) == 0) {
+    auto* secureClient = new WiFiClientSecure;
+    secureClient->setInsecure();
+    return secureClient;
+  }
+  // Plain http is what a catalog server on the local network usually speaks
+  return new WiFiClient;
+}
+
+void beginRequest(HTTPClient& http, WiFiClient& client, const std::string& url) {
+  http.begin(client, url.c_str());
+  // HTTP/1.0 keeps servers from answering with a chunked body, which the raw stream below doesn't decode
+  http.useHTTP10(true);
+  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+}
+
+// Collects received bytes and writes them to the file in WRITE_BLOCK_SIZE pieces
+class CoalescingWriter {
+  FsFile& file;
+  SemaphoreHandle_t sdMutex;
+  uint8_t* buffer;
+  size_t used = 0;
+
+ public:
+  CoalescingWriter(FsFile& file, SemaphoreHandle_t sdMutex, uint8_t* buffer)
+      : file(file), sdMutex(sdMutex), buffer(buffer) {}
+
+  bool write(const uint8_t* data, size_t len) {
+    while (len > 0) {
+      const size_t take = std::min(len, WRITE_BLOCK_SIZE - used);
+      memcpy(buffer + used, data, take);
+      used += take;
+      data += take;
+      len -= take;
+      if (used == WRITE_BLOCK_SIZE && !flush()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool flush() {
+    if (used == 0) {
+      return true;
+    }
+    xSemaphoreTake(sdMutex, portMAX_DELAY);
+    const size_t written = file.write(buffer, used);
+    xSemaphoreGive(sdMutex);
+    if (written != used) {
+      Serial.printf("[%lu] [HTTP] SD write failed (%u of %u bytes)\n", millis(), written, used);
+      return false;
+    }
+    used = 0;
+    return true;
+  }
+};
+
+// Append the rest of the body to the file, starting at written bytes. totalSize is filled in from the response
+// headers when it is still unknown (0). validator is what the partial file was downloaded as, it is replaced (and
+// saved to validatorPath) whenever the download starts over.
+TransferResult transferRemaining(const std::string& url, FsFile& file, SemaphoreHandle_t sdMutex, size_t& written,
+                                 size_t& totalSize, Validator& validator, const std::string& validatorPath,
+                                 uint8_t* readBuffer, uint8_t* writeBuffer,
+                                 const std::function<void(size_t, size_t)>& onProgress) {
+  const std::unique_ptr<WiFiClient> client(createClient(url));
+  HTTPClient http;
+  beginRequest(http, *client, url);
+  if (written > 0) {
+    http.addHeader("Range", ("bytes=" + std::to_string(written) + "-").c_str());
+    http.addHeader("If-Range", validator.ifRange().c_str());
+    Serial.printf("[%lu] [HTTP] Resuming download at %u bytes\n", millis(), written);
+  }
+  const char* headerKeys[] = {"Content-Range", "ETag", "Last-Modified"};
+  http.collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+
+  const int httpCode = http.GET();
+  const int contentLength = http.getSize();
+  const Validator received = {http.header("ETag").c_str(), http.header("Last-Modified").c_str()};
+  if (httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE && written > 0) {
+    // Nothing left after the requested offset. With the .part file as long as the body ("bytes */<length>", or the
+    // length seen on an earlier attempt) the download was already complete, e.g. the device went off before the rename
+    const String contentRange = http.header("Content-Range");
+    const int slash = contentRange.indexOf('/');
+    const size_t length = slash >= 0 ? strtoul(contentRange.c_str() + slash + 1, nullptr, 10) : totalSize;
+    http.end();
+    if (length > 0 && length == written) {
+      totalSize = length;
+      Serial.printf("[%lu] [HTTP] Partial file already holds all %u bytes\n", millis(), written);
+      return TransferResult::COMPLETE;
+    }
+    Serial.printf("[%lu] [HTTP] Resume offset %u not satisfiable (length %u)\n", millis(), written, length);
+    return TransferResult::HTTP_FAILED;
+  }
+  if (httpCode == HTTP_CODE_PARTIAL_CONTENT && written > 0) {
+    if (!validator.matches(received)) {
+      Serial.printf("[%lu] [HTTP] File changed on the server, restarting download\n", millis());
+      http.end();
+      xSemaphoreTake(sdMutex, portMAX_DELAY);
+      const bool truncated = restart(file, validatorPath, written);
+      xSemaphoreGive(sdMutex);
+      return truncated ? TransferResult::INTERRUPTED : TransferResult::WRITE_FAILED;
+    }
+    if (contentLength > 0) {
+      totalSize = written + contentLength;
+    }
+  } else if (httpCode == HTTP_CODE_OK) {
+    // The whole body, either the first request or the server ignored the range (or the file changed), start over
+    if (written > 0) {
+      Serial.printf("[%lu] [HTTP] Server sent the whole file, restarting download\n", millis());
+    }
+    xSemaphoreTake(sdMutex, portMAX_DELAY);
+    bool ready = written == 0 || restart(file, validatorPath, written);
+    // Without a validator the partial file can't be resumed safely, it is downloaded again next time
+    if (ready && !received.ifRange().empty() && !writeValidator(validatorPath, received)) {
+      Serial.printf("[%lu] [HTTP] Could not save %s, a partial download won't be resumed\n", millis(),
+                    validatorPath.c_str());
+    }
+    xSemaphoreGive(sdMutex);
+    if (!ready) {
+      http.end();
+      return TransferResult::WRITE_FAILED;
+    }
+    validator = received;
+    totalSize = contentLength > 0 ? contentLength : 0;
+  } else {
+    Serial.printf("[%lu] [HTTP] Download failed: %d\n", millis(), httpCode);
+    http.end();
+    // Connection level failures (negative codes) and server errors are worth retrying, client errors are not
+    return httpCode < 0 || httpCode >= 500 ? TransferResult::INTERRUPTED : TransferResult::HTTP_FAILED;
+  }
+
+  CoalescingWriter writer(file, sdMutex, writeBuffer);
+  WiFiClient* stream = http.getStreamPtr();
+  unsigned long lastDataTime = millis();
+  bool streamEnded = false;
+  while (totalSize == 0 || written < totalSize) {
+    const size_t available = stream->available();
+    if (available == 0) {
+      if (!http.connected()) {
+        streamEnded = true;
+        break;
+      }
+      if (millis() - lastDataTime > STALL_TIMEOUT_MS) {
+        break;
+      }
+      delay(1);
+      continue;
+    }
+
+    size_t toRead = std::min(available, READ_BLOCK_SIZE);
+    if (totalSize > 0) {
+      toRead = std::min(toRead, totalSize - written);
+    }
+    const size_t read = stream->readBytes(readBuffer, toRead);
+    if (read == 0) {
+      continue;
+    }
+    lastDataTime = millis();
+
+    if (!writer.write(readBuffer, read)) {
+      http.end();
+      return TransferResult::WRITE_FAILED;
+    }
+    written += read;
+    onProgress(written, totalSize);
+  }
+  http.end();
+
+  if (!writer.flush()) {
+    return TransferResult::WRITE_FAILED;
+  }
+  // Without a length the only sign of a complete body is the server closing the connection
+  if (totalSize > 0 ? written == totalSize : streamEnded) {
+    return TransferResult::COMPLETE;
+  }
+  Serial.printf("[%lu] [HTTP] Connection lost at %u / %u bytes\n", millis(), written, totalSize);
+  return TransferResult::INTERRUPTED;
+}
+}  // namespace
+
+HttpDownloader::HttpDownloaderError HttpDownloader::fetch(const std::string& url,
+                                                          const std::function<bool(const uint8_t*, size_t)>& sink) {
+  const std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[READ_BLOCK_SIZE]);
+  if (!buffer) {
+    return OOM_ERROR;
+  }
+
+  const std::unique_ptr<WiFiClient> client(createClient(url));
+  HTTPClient http;
+  beginRequest(http, *client, url);
+  Serial.printf("[%lu] [HTTP] Fetching: %s\n", millis(), url.c_str());
+
+  const int httpCode = http.GET();
+  if (httpCode != HTTP_CODE_OK) {
+    Serial.printf("[%lu] [HTTP] HTTP error: %d\n", millis(), httpCode);
+    http.end();
+    return HTTP_ERROR;
+  }
+
+  const int contentLength = http.getSize();
+  size_t remaining = contentLength > 0 ? contentLength : SIZE_MAX;
+  WiFiClient* stream = http.getStreamPtr();
+  unsigned long lastDataTime = millis();
+  while (remaining > 0) {
+    const size_t available = stream->available();
+    if (available == 0) {
+      if (!http.connected() || millis() - lastDataTime > STALL_TIMEOUT_MS) {
+        break;
+      }
+      delay(1);
+      continue;
+    }
+
+    const size_t read = stream->readBytes(buffer.get(), std::min({available, remaining, READ_BLOCK_SIZE}));
+    if (read == 0) {
+      continue;
+    }
+    lastDataTime = millis();
+    if (contentLength > 0) {
+      remaining -= read;
+    }
+    if (!sink(buffer.get(), read)) {
+      break;
+    }
+  }
+  http.end();
+  return OK;
+}
+
+HttpDownloader::HttpDownloaderError HttpDownloader::downloadToFile(
+    const std::string& url, const std::string& path, SemaphoreHandle_t sdMutex,
+    const std::function<void(size_t, size_t)>& onProgress) {
+  const std::unique_ptr<uint8_t[]> readBuffer(new (std::nothrow) uint8_t[READ_BLOCK_SIZE]);
+  const std::unique_ptr<uint8_t[]> writeBuffer(new (std::nothrow) uint8_t[WRITE_BLOCK_SIZE]);
+  if (!readBuffer || !writeBuffer) {
+    Serial.printf("[%lu] [HTTP] Could not allocate download buffers\n", millis());
+    return OOM_ERROR;
+  }
+
+  const std::string partPath = path + ".part";
+  const std::string validatorPath = partPath + ".tag";
+  Validator validator;
+  xSemaphoreTake(sdMutex, portMAX_DELAY);
+  FsFile file = SdMan.open(partPath.c_str(), O_RDWR | O_CREAT);
+  bool opened = file && file.seekEnd();
+  size_t written = opened ? file.size() : 0;
+  if (opened && written > 0 && !readValidator(validatorPath, validator)) {
+    // Without knowing which version of the file the partial download holds, appending to it could mix two versions
+    Serial.printf("[%lu] [HTTP] No validator for %s, downloading again\n", millis(), partPath.c_str());
+    opened = restart(file, validatorPath, written);
+  }
+  xSemaphoreGive(sdMutex);
+  if (!opened) {
+    Serial.printf("[%lu] [HTTP] Could not open %s for writing\n", millis(), partPath.c_str());
+    return FILE_ERROR;
+  }
+
+  Serial.printf("[%lu] [HTTP] Downloading %s to %s\n", millis(), url.c_str(), path.c_str());
+  const unsigned long start = millis();
+  size_t totalSize = 0;
+  TransferResult result = TransferResult::INTERRUPTED;
+  for (int attempt = 0; attempt <= MAX_RESUME_ATTEMPTS; attempt++) {
+    if (attempt > 0) {
+      Serial.printf("[%lu] [HTTP] Retrying download (%d/%d)\n", millis(), attempt, MAX_RESUME_ATTEMPTS);
+      delay(RESUME_BACKOFF_MS * attempt);
+    }
+
+    result = transferRemaining(url, file, sdMutex, written, totalSize, validator, validatorPath, readBuffer.get(),
+                               writeBuffer.get(), onProgress);
+    if (result != TransferResult::INTERRUPTED) {
+      break;
+    }
+  }
+
+  xSemaphoreTake(sdMutex, portMAX_DELAY);
+  file.close();
+  bool renamed = false;
+  if (result == TransferResult::COMPLETE) {
+    if (SdMan.exists(path.c_str())) {
+      SdMan.remove(path.c_str());
+    }
+    renamed = SdMan.rename(partPath.c_str(), path.c_str());
+  } else if (result == TransferResult::HTTP_FAILED) {
+    // The server refused the request, a partial file is of no use for a retry
+    SdMan.remove(partPath.c_str());
+  }
+  if ((result == TransferResult::COMPLETE || result == TransferResult::HTTP_FAILED) &&
+      SdMan.exists(validatorPath.c_str())) {
+    SdMan.remove(validatorPath.c_str());
+  }
+  xSemaphoreGive(sdMutex);
+
+  if (result == TransferResult::WRITE_FAILED) {
+    return FILE_ERROR;
+  }
+  if (result != TransferResult::COMPLETE) {
+    // The partial file is kept so the next attempt picks up where this one stopped
+    Serial.printf("[%lu] [HTTP] Downloaded only %u bytes\n", millis(), written);
+    return HTTP_ERROR;
+  }
+  if (!renamed) {
+    Serial.printf("[%lu] [HTTP] Could not move download to %s\n", millis(), path.c_str());
+    return FILE_ERROR;
+  }
+  Serial.printf("[%lu] [HTTP] Downloaded %u bytes in %lu ms\n", millis(), written, millis() - start);
+  return OK;
+}
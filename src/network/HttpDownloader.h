@@ -0,0 +1,36 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * Plain HTTP(S) transfers for content that doesn't come from the firmware release (catalog feeds and books).
+ *
+ * downloadToFile() writes into "<path>.part" and only renames it to path once the whole body has arrived. A partial
+ * file left behind by a dropped connection, or by switching the device off, is picked up again with a Range request.
+ * The ETag or Last-Modified date of the file is kept in "<path>.part.tag" and sent as If-Range, so a file that changed
+ * on the server in the meantime is downloaded again as a whole instead of being spliced onto the old version.
+ * Received data is collected into sector-aligned blocks before it is written, so the SD card sees a few large writes
+ * instead of one per network packet and the shared SPI bus is only held briefly.
+ */
+class HttpDownloader {
+ public:
+  enum HttpDownloaderError {
+    OK = 0,
+    HTTP_ERROR,
+    FILE_ERROR,
+    OOM_ERROR,
+  };
+
+  // Stream the response body into sink, which may return false to stop reading early (this is not an error)
+  static HttpDownloaderError fetch(const std::string& url, const std::function<bool(const uint8_t*, size_t)>& sink);
+
+  // sdMutex guards the SPI bus shared with the display and is held around every SD access. onProgress receives
+  // (downloaded, total), total is 0 when the server doesn't report a length
+  static HttpDownloaderError downloadToFile(const std::string& url, const std::string& path, SemaphoreHandle_t sdMutex,
+                                            const std::function<void(size_t, size_t)>& onProgress);
+};
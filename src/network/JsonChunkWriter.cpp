@@ -0,0 +1,146 @@
+#include "JsonChunkWriter.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+void JsonChunkWriter::put(const char c) {
+  if (length == BUFFER_SIZE) {
+    flush();
+  }
+  buffer[length++] = c;
+}
+
+void JsonChunkWriter::put(const char* str, size_t len) {
+  while (len > 0) {
+    if (length == BUFFER_SIZE) {
+      flush();
+    }
+    const size_t chunk = std::min(len, BUFFER_SIZE - length);
+    memcpy(buffer + length, str, chunk);
+    length += chunk;
+    str += chunk;
+    len -= chunk;
+  }
+}
+
+void JsonChunkWriter::putEscaped(const char* str) {
+  put('"');
+  // Copy runs of plain characters in one go, only special characters need per-byte handling
+  const char* runStart = str;
+  for (const char* p = str; *p; p++) {
+    const auto c = static_cast<unsigned char>(*p);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    put(runStart, p - runStart);
+    runStart = p + 1;
+    switch (c) {
+      case '"':
+        put("\\\"", 2);
+        break;
+      case '\\':
+        put("\\\\", 2);
+        break;
+      case '\n':
+        put("\\n", 2);
+        break;
+      case '\r':
+        put("\\r", 2);
+        break;
+      case '\t':
+        put("\\t", 2);
+        break;
+      default: {
+        char escaped[7];
+        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        put(escaped, 6);
+        break;
+      }
+    }
+  }
+  put(runStart, strlen(runStart));
+  put('"');
+}
+
+void JsonChunkWriter::beginValue() {
+  if (afterKey) {
+    afterKey = false;
+    return;
+  }
+  if (depth > 0) {
+    if (hasValue[depth - 1]) {
+      put(',');
+    }
+    hasValue[depth - 1] = true;
+  }
+}
+
+void JsonChunkWriter::beginObject() {
+  beginValue();
+  put('{');
+  if (depth < MAX_DEPTH) {
+    hasValue[depth++] = false;
+  }
+}
+
+void JsonChunkWriter::endObject() {
+  if (depth > 0) depth--;
+  put('}');
+}
+
+void JsonChunkWriter::beginArray() {
+  beginValue();
+  put('[');
+  if (depth < MAX_DEPTH) {
+    hasValue[depth++] = false;
+  }
+}
+
+void JsonChunkWriter::endArray() {
+  if (depth > 0) depth--;
+  put(']');
+}
+
+void JsonChunkWriter::key(const char* name) {
+  beginValue();
+  putEscaped(name);
+  put(':');
+  afterKey = true;
+}
+
+void JsonChunkWriter::value(const char* str) {
+  beginValue();
+  putEscaped(str);
+}
+
+void JsonChunkWriter::value(const uint64_t number) {
+  beginValue();
+  char digits[21];
+  const int len = snprintf(digits, sizeof(digits), "%" PRIu64, number);
+  put(digits, len);
+}
+
+void JsonChunkWriter::value(const bool flag) {
+  beginValue();
+  if (flag) {
+    put("true", 4);
+  } else {
+    put("false", 5);
+  }
+}
+
+void JsonChunkWriter::null() {
+  beginValue();
+  put("null", 4);
+}
+
+void JsonChunkWriter::flush() {
+  if (length == 0) {
+    return;
+  }
+  server.sendContent(buffer, length);
+  length = 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <WebServer.h>
+
+#include <cstdint>
+
+/**
+ * Minimal streaming JSON writer for chunked HTTP responses.
+ *
+ * Output is escaped straight into a fixed buffer which is handed to WebServer::sendContent() only when full (or on
+ * flush()), so a large listing goes out in a handful of TCP writes instead of one per value. Commas between values
+ * are inserted automatically; nesting depth is limited to MAX_DEPTH.
+ */
+class JsonChunkWriter {
+  static constexpr size_t BUFFER_SIZE = 2048;
+  static constexpr uint8_t MAX_DEPTH = 8;
+
+  WebServer& server;
+  char buffer[BUFFER_SIZE];
+  size_t length = 0;
+  uint8_t depth = 0;
+  // Whether the current container already holds a value (needs a comma before the next one)
+  bool hasValue[MAX_DEPTH] = {};
+  // Set after key(), the following value belongs to it and must not be preceded by a comma
+  bool afterKey = false;
+
+  void put(char c);
+  void put(const char* str, size_t len);
+  void putEscaped(const char* str);
+  void beginValue();
+
+ public:
+  explicit JsonChunkWriter(WebServer& server) : server(server) {}
+  ~JsonChunkWriter() = default;
+
+  void beginObject();
+  void endObject();
+  void beginArray();
+  void endArray();
+  void key(const char* name);
+
+  void value(const char* str);
+  void value(uint64_t number);
+  void value(bool flag);
+  void null();
+
+  // Send everything buffered so far
+  void flush();
+};
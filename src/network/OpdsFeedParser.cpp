@@ -0,0 +1,227 @@
+#include "OpdsFeedParser.h"
+
+#include <HardwareSerial.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// Longer values are cut, a title never needs more than a couple of lines on screen
+constexpr size_t MAX_TITLE_LENGTH = 128;
+constexpr size_t MAX_AUTHOR_LENGTH = 64;
+constexpr size_t MAX_HREF_LENGTH = 512;
+
+constexpr char ACQUISITION_REL[] = "http://opds-spec.org/acquisition";
+constexpr char EPUB_TYPE[] = "application/epub+zip";
+constexpr char ATOM_TYPE[] = "application/atom+xml";
+
+// Element or attribute name without its namespace prefix ("atom:entry" -> "entry")
+const char* localName(const XML_Char* name) {
+  const char* colon = strrchr(name, ':');
+  return colon ? colon + 1 : name;
+}
+
+const char* getAttribute(const XML_Char** atts, const char* name) {
+  for (int i = 0; atts[i]; i += 2) {
+    if (strcmp(localName(atts[i]), name) == 0) {
+      return atts[i + 1];
+    }
+  }
+  return nullptr;
+}
+
+// Append at most up to maxLength bytes, never ending in the middle of a UTF-8 sequence
+void appendCapped(std::string& target, const char* s, const size_t len, const size_t maxLength) {
+  if (target.size() >= maxLength) {
+    return;
+  }
+  size_t take = std::min(len, maxLength - target.size());
+  if (take < len) {
+    while (take > 0 && (static_cast<uint8_t>(s[take]) & 0xC0) == 0x80) {
+      take--;
+    }
+  }
+  target.append(s, take);
+}
+
+void trim(std::string& s) {
+  const size_t start = s.find_first_not_of(" \t\r\n");
+  if (start == std::string::npos) {
+    s.clear();
+    return;
+  }
+  s.erase(s.find_last_not_of(" \t\r\n") + 1);
+  s.erase(0, start);
+}
+}  // namespace
+
+bool OpdsFeedParser::setup() {
+  parser = XML_ParserCreate(nullptr);
+  if (!parser) {
+    Serial.printf("[%lu] [OPDS] Couldn't allocate memory for parser\n", millis());
+    return false;
+  }
+
+  XML_SetUserData(parser, this);
+  XML_SetElementHandler(parser, startElement, endElement);
+  XML_SetCharacterDataHandler(parser, characterData);
+  return true;
+}
+
+OpdsFeedParser::~OpdsFeedParser() {
+  if (parser) {
+    XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
+    XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+    XML_SetCharacterDataHandler(parser, nullptr);
+    XML_ParserFree(parser);
+    parser = nullptr;
+  }
+}
+
+bool OpdsFeedParser::parse(const char* data, const size_t len, const bool isFinal) {
+  if (!parser || failed) {
+    return false;
+  }
+  if (stopped) {
+    return true;
+  }
+
+  if (XML_Parse(parser, data, static_cast<int>(len), isFinal) == XML_STATUS_ERROR) {
+    // Aborting from inside onEntry surfaces as an error, but everything wanted has been seen
+    if (stopped && XML_GetErrorCode(parser) == XML_ERROR_ABORTED) {
+      return true;
+    }
+    Serial.printf("[%lu] [OPDS] Parse error at line %lu: %s\n", millis(), XML_GetCurrentLineNumber(parser),
+                  XML_ErrorString(XML_GetErrorCode(parser)));
+    failed = true;
+    return false;
+  }
+  return true;
+}
+
+size_t OpdsFeedParser::write(const uint8_t data) { return write(&data, 1); }
+
+size_t OpdsFeedParser::write(const uint8_t* buffer, const size_t size) {
+  return parse(reinterpret_cast<const char*>(buffer), size, false) ? size : 0;
+}
+
+bool OpdsFeedParser::finish() { return parse(nullptr, 0, true); }
+
+void XMLCALL OpdsFeedParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
+  auto* self = static_cast<OpdsFeedParser*>(userData);
+  const char* element = localName(name);
+  self->depth++;
+
+  if (self->entryDepth == 0) {
+    if (strcmp(element, "entry") == 0) {
+      self->entryDepth = self->depth;
+      self->current = OpdsEntry();
+      self->navigationHref.clear();
+    } else if (self->depth == 2 && strcmp(element, "title") == 0) {
+      self->textTarget = TextTarget::FEED_TITLE;
+    } else if (self->depth == 2 && strcmp(element, "link") == 0) {
+      const char* rel = getAttribute(atts, "rel");
+      const char* href = getAttribute(atts, "href");
+      if (rel && href && strcmp(rel, "next") == 0) {
+        self->nextHref.clear();
+        appendCapped(self->nextHref, href, strlen(href), MAX_HREF_LENGTH);
+      }
+    }
+    return;
+  }
+
+  // Only direct children of <entry> (and <author><name>), nested content like <content> markup is ignored
+  if (self->depth == self->entryDepth + 1) {
+    if (strcmp(element, "title") == 0) {
+      self->textTarget = TextTarget::ENTRY_TITLE;
+    } else if (strcmp(element, "author") == 0) {
+      self->inAuthor = true;
+    } else if (strcmp(element, "link") == 0) {
+      self->handleLink(atts);
+    }
+  } else if (self->inAuthor && self->depth == self->entryDepth + 2 && strcmp(element, "name") == 0) {
+    self->textTarget = TextTarget::AUTHOR_NAME;
+    if (!self->current.author.empty()) {
+      appendCapped(self->current.author, ", ", 2, MAX_AUTHOR_LENGTH);
+    }
+  }
+}
+
+void OpdsFeedParser::handleLink(const XML_Char** atts) {
+  const char* rel = getAttribute(atts, "rel");
+  const char* type = getAttribute(atts, "type");
+  const char* href = getAttribute(atts, "href");
+  if (!href || !type) {
+    return;
+  }
+
+  const bool isAcquisition = rel && strncmp(rel, ACQUISITION_REL, sizeof(ACQUISITION_REL) - 1) == 0;
+  if (isAcquisition && strncmp(type, EPUB_TYPE, sizeof(EPUB_TYPE) - 1) == 0) {
+    if (current.type != OpdsEntry::Type::BOOK) {
+      current.type = OpdsEntry::Type::BOOK;
+      current.href.clear();
+      appendCapped(current.href, href, strlen(href), MAX_HREF_LENGTH);
+    }
+  } else if (!isAcquisition && strncmp(type, ATOM_TYPE, sizeof(ATOM_TYPE) - 1) == 0 && navigationHref.empty() &&
+             (!rel || strcmp(rel, "alternate") != 0)) {
+    appendCapped(navigationHref, href, strlen(href), MAX_HREF_LENGTH);
+  }
+}
+
+void XMLCALL OpdsFeedParser::characterData(void* userData, const XML_Char* s, const int len) {
+  auto* self = static_cast<OpdsFeedParser*>(userData);
+
+  switch (self->textTarget) {
+    case TextTarget::FEED_TITLE:
+      appendCapped(self->feedTitle, s, len, MAX_TITLE_LENGTH);
+      break;
+    case TextTarget::ENTRY_TITLE:
+      appendCapped(self->current.title, s, len, MAX_TITLE_LENGTH);
+      break;
+    case TextTarget::AUTHOR_NAME:
+      appendCapped(self->current.author, s, len, MAX_AUTHOR_LENGTH);
+      break;
+    case TextTarget::NONE:
+      break;
+  }
+}
+
+void XMLCALL OpdsFeedParser::endElement(void* userData, const XML_Char* name) {
+  auto* self = static_cast<OpdsFeedParser*>(userData);
+  const char* element = localName(name);
+
+  const bool closesText = self->textTarget == TextTarget::AUTHOR_NAME ? strcmp(element, "name") == 0
+                                                                      : strcmp(element, "title") == 0;
+  if (self->textTarget != TextTarget::NONE && closesText) {
+    if (self->textTarget == TextTarget::FEED_TITLE) {
+      trim(self->feedTitle);
+    }
+    self->textTarget = TextTarget::NONE;
+  } else if (self->inAuthor && self->depth == self->entryDepth + 1 && strcmp(element, "author") == 0) {
+    self->inAuthor = false;
+  } else if (self->entryDepth > 0 && self->depth == self->entryDepth) {
+    self->entryDepth = 0;
+    self->finishEntry();
+  }
+  self->depth--;
+}
+
+void OpdsFeedParser::finishEntry() {
+  if (current.type != OpdsEntry::Type::BOOK) {
+    if (navigationHref.empty()) {
+      return;
+    }
+    current.href = std::move(navigationHref);
+  }
+
+  trim(current.title);
+  trim(current.author);
+  if (current.title.empty()) {
+    current.title = "Untitled";
+  }
+
+  if (!onEntry(current)) {
+    stopped = true;
+    XML_StopParser(parser, XML_FALSE);
+  }
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <Print.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "expat.h"
+
+struct OpdsEntry {
+  enum class Type : uint8_t { NAVIGATION, BOOK };
+
+  Type type = Type::NAVIGATION;
+  std::string title;
+  std::string author;
+  std::string href;  // Sub-catalog feed for NAVIGATION, EPUB acquisition link for BOOK (as written in the feed)
+};
+
+/**
+ * Streaming parser for OPDS 1.x catalog feeds (Atom XML).
+ *
+ * Feed bytes are pushed in with write() as they arrive from the network. Each <entry> is handed to onEntry as soon as
+ * it closes and then forgotten, so memory use does not depend on the size of the catalog. onEntry returns false to
+ * stop parsing, which lets the caller drop the rest of a long feed once it has the entries it wants to show.
+ *
+ * Entries that offer neither an EPUB download nor a link to another catalog feed are skipped.
+ */
+class OpdsFeedParser final : public Print {
+  enum class TextTarget : uint8_t { NONE, FEED_TITLE, ENTRY_TITLE, AUTHOR_NAME };
+
+  XML_Parser parser = nullptr;
+  const std::function<bool(const OpdsEntry&)> onEntry;
+  int depth = 0;
+  int entryDepth = 0;  // Depth of the open <entry>, 0 outside of one
+  bool inAuthor = false;
+  bool stopped = false;
+  bool failed = false;
+  TextTarget textTarget = TextTarget::NONE;
+  OpdsEntry current;
+  std::string navigationHref;
+
+  static void startElement(void* userData, const XML_Char* name, const XML_Char** atts);
+  static void characterData(void* userData, const XML_Char* s, int len);
+  static void endElement(void* userData, const XML_Char* name);
+  void handleLink(const XML_Char** atts);
+  void finishEntry();
+  bool parse(const char* data, size_t len, bool isFinal);
+
+ public:
+  std::string feedTitle;
+  std::string nextHref;  // rel="next" page of this feed, empty on the last page
+
+  explicit OpdsFeedParser(const std::function<bool(const OpdsEntry&)>& onEntry) : onEntry(onEntry) {}
+  ~OpdsFeedParser() override;
+
+  bool setup();
+  // Signal the end of the document, returns false if the feed was not well formed
+  bool finish();
+  // Whether onEntry asked to stop, no more input is needed
+  bool isStopped() const { return stopped; }
+
+  size_t write(uint8_t) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+};
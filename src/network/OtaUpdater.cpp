@@ -4,11 +4,128 @@
 #include <HTTPClient.h>
 #include <Update.h>
 #include <WiFiClientSecure.h>
+#include <mbedtls/sha256.h>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include "CpuGovernor.h"
+#include "DeltaOtaPatcher.h"
 
 namespace {
 constexpr char latestReleaseUrl[] = "https://api.github.com/repos/daveallie/crosspoint-reader/releases/latest";
+// Patch from the running version to the release, see scripts/make_delta_ota.py
+constexpr char deltaAssetName[] = "firmware-from-" CROSSPOINT_VERSION ".delta";
+
+// The image is streamed in blocks of this size, each block is written to flash and hashed before the next is read
+constexpr size_t DOWNLOAD_BLOCK_SIZE = 4096;
+// A connection that delivers nothing for this long is dropped and the download resumed on a new one
+constexpr unsigned long STALL_TIMEOUT_MS = 10000;
+constexpr int MAX_RESUME_ATTEMPTS = 5;
+constexpr unsigned long RESUME_BACKOFF_MS = 2000;
+
+enum class DownloadResult { COMPLETE, INTERRUPTED, HTTP_FAILED, WRITE_FAILED };
+
+// Stream bytes [written, totalSize) of url into sink, resuming with a Range request when written > 0. written and
+// the hash are advanced for every block the sink accepts, so a later call can pick up exactly where this one stopped.
+DownloadResult downloadRemaining(const std::string& url, const size_t totalSize, size_t& written,
+                                 mbedtls_sha256_context& sha, uint8_t* buffer,
+                                 const std::function<bool(const uint8_t*, size_t)>& sink,
+                                 const std::function<void(size_t)>& onBlockWritten) {
+  // Plain http is accepted so the download can be exercised against a local server
+  std::unique_ptr<WiFiClient> client;
+  if (url.rfind("https://", 0) == 0) {
+    auto* secureClient = new WiFiClientSecure;
+    secureClient->setInsecure();
+    client.reset(secureClient);
+  } else {
+    client.reset(new WiFiClient);
+  }
+
+  HTTPClient http;
+  http.begin(*client, url.c_str());
+  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+  if (written > 0) {
+    http.addHeader("Range", ("bytes=" + std::to_string(written) + "-").c_str());
+    Serial.printf("[%lu] [OTA] Resuming download at %u / %u bytes\n", millis(), written, totalSize);
+  }
+
+  const int httpCode = http.GET();
+  size_t skip = 0;
+  if (httpCode == HTTP_CODE_PARTIAL_CONTENT && written > 0) {
+    if (static_cast<size_t>(http.getSize()) != totalSize - written) {
+      Serial.printf("[%lu] [OTA] Unexpected partial content length: %d\n", millis(), http.getSize());
+      http.end();
+      return DownloadResult::HTTP_FAILED;
+    }
+  } else if (httpCode == HTTP_CODE_OK) {
+    if (static_cast<size_t>(http.getSize()) != totalSize) {
+      Serial.printf("[%lu] [OTA] Invalid content length: %d\n", millis(), http.getSize());
+      http.end();
+      return DownloadResult::HTTP_FAILED;
+    }
+    // Server ignored the range, throw away what is already in flash
+    skip = written;
+  } else {
+    Serial.printf("[%lu] [OTA] Download failed: %d\n", millis(), httpCode);
+    http.end();
+    // Connection level failures (negative codes) and server errors are worth retrying, client errors are not
+    return httpCode < 0 || httpCode >= 500 ? DownloadResult::INTERRUPTED : DownloadResult::HTTP_FAILED;
+  }
+
+  WiFiClient* stream = http.getStreamPtr();
+  unsigned long lastDataTime = millis();
+  while (written < totalSize) {
+    const size_t available = stream->available();
+    if (available == 0) {
+      if (!http.connected() || millis() - lastDataTime > STALL_TIMEOUT_MS) {
+        Serial.printf("[%lu] [OTA] Connection lost at %u / %u bytes\n", millis(), written, totalSize);
+        break;
+      }
+      delay(1);
+      continue;
+    }
+
+    const size_t remaining = skip > 0 ? skip : totalSize - written;
+    const size_t read = stream->readBytes(buffer, std::min({available, remaining, DOWNLOAD_BLOCK_SIZE}));
+    if (read == 0) {
+      continue;
+    }
+    lastDataTime = millis();
+
+    if (skip > 0) {
+      skip -= read;
+      continue;
+    }
+
+    if (!sink(buffer, read)) {
+      Serial.printf("[%lu] [OTA] Could not apply download at %u bytes\n", millis(), written);
+      http.end();
+      return DownloadResult::WRITE_FAILED;
+    }
+    mbedtls_sha256_update_ret(&sha, buffer, read);
+    written += read;
+    onBlockWritten(written);
+  }
+
+  http.end();
+  return written == totalSize ? DownloadResult::COMPLETE : DownloadResult::INTERRUPTED;
 }
 
+std::string toHex(const uint8_t* data, const size_t length) {
+  static constexpr char digits[] = "0123456789abcdef";
+  std::string hex;
+  hex.reserve(length * 2);
+  for (size_t i = 0; i < length; i++) {
+    hex += digits[data[i] >> 4];
+    hex += digits[data[i] & 0x0F];
+  }
+  return hex;
+}
+}  // namespace
+
 OtaUpdater::OtaUpdaterError OtaUpdater::checkForUpdate() {
   const std::unique_ptr<WiFiClientSecure> client(new WiFiClientSecure);
   client->setInsecure();
@@ -32,6 +149,7 @@ OtaUpdater::OtaUpdaterError OtaUpdater::checkForUpdate() {
   filter["assets"][0]["name"] = true;
   filter["assets"][0]["browser_download_url"] = true;
   filter["assets"][0]["size"] = true;
+  filter["assets"][0]["digest"] = true;
   const DeserializationError error = deserializeJson(doc, *client, DeserializationOption::Filter(filter));
   http.end();
   if (error) {
@@ -55,8 +173,17 @@ OtaUpdater::OtaUpdaterError OtaUpdater::checkForUpdate() {
       otaUrl = doc["assets"][i]["browser_download_url"].as<std::string>();
       otaSize = doc["assets"][i]["size"].as<size_t>();
       totalSize = otaSize;
+      // GitHub publishes "sha256:<hex>" for release assets
+      const auto digest = doc["assets"][i]["digest"].as<std::string>();
+      otaSha256 = digest.rfind("sha256:", 0) == 0 ? digest.substr(7) : "";
+      std::transform(otaSha256.begin(), otaSha256.end(), otaSha256.begin(), ::tolower);
       updateAvailable = true;
-      break;
+    } else if (doc["assets"][i]["name"] == deltaAssetName) {
+      deltaUrl = doc["assets"][i]["browser_download_url"].as<std::string>();
+      deltaSize = doc["assets"][i]["size"].as<size_t>();
+      const auto digest = doc["assets"][i]["digest"].as<std::string>();
+      deltaSha256 = digest.rfind("sha256:", 0) == 0 ? digest.substr(7) : "";
+      std::transform(deltaSha256.begin(), deltaSha256.end(), deltaSha256.begin(), ::tolower);
     }
   }
 
@@ -108,60 +235,129 @@ bool OtaUpdater::isUpdateNewer() {
 
 const std::string& OtaUpdater::getLatestVersion() { return latestVersion; }
 
-OtaUpdater::OtaUpdaterError OtaUpdater::installUpdate(const std::function<void(size_t, size_t)>& onProgress) {
-  if (!isUpdateNewer()) {
-    return UPDATE_OLDER_ERROR;
+OtaUpdater::OtaUpdaterError OtaUpdater::downloadAsset(const std::string& url, const size_t size,
+                                                      const std::string& sha256,
+                                                      const std::function<bool(const uint8_t*, size_t)>& sink,
+                                                      const std::function<void(size_t, size_t)>& onProgress) {
+  const std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[DOWNLOAD_BLOCK_SIZE]);
+  if (!buffer) {
+    Serial.printf("[%lu] [OTA] Could not allocate download buffer\n", millis());
+    return OOM_ERROR;
   }
 
-  const std::unique_ptr<WiFiClientSecure> client(new WiFiClientSecure);
-  client->setInsecure();
-  HTTPClient http;
+  this->processedSize = 0;
+  this->totalSize = size;
+  Serial.printf("[%lu] [OTA] Downloading: %s\n", millis(), url.c_str());
 
-  Serial.printf("[%lu] [OTA] Fetching: %s\n", millis(), otaUrl.c_str());
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts_ret(&sha, 0);
 
-  http.begin(*client, otaUrl.c_str());
-  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
-  const int httpCode = http.GET();
+  const auto onBlockWritten = [this, &onProgress](const size_t written) {
+    this->processedSize = written;
+    onProgress(written, this->totalSize);
+  };
 
-  if (httpCode != HTTP_CODE_OK) {
-    Serial.printf("[%lu] [OTA] Download failed: %d\n", millis(), httpCode);
-    http.end();
-    return HTTP_ERROR;
+  size_t written = 0;
+  DownloadResult result = DownloadResult::INTERRUPTED;
+  for (int attempt = 0; attempt <= MAX_RESUME_ATTEMPTS; attempt++) {
+    if (attempt > 0) {
+      Serial.printf("[%lu] [OTA] Retrying download (%d/%d)\n", millis(), attempt, MAX_RESUME_ATTEMPTS);
+      delay(RESUME_BACKOFF_MS * attempt);
+    }
+
+    result = downloadRemaining(url, size, written, sha, buffer.get(), sink, onBlockWritten);
+    if (result != DownloadResult::INTERRUPTED) {
+      break;
+    }
   }
 
-  // 2. Get length and stream
-  const size_t contentLength = http.getSize();
+  uint8_t digest[32];
+  mbedtls_sha256_finish_ret(&sha, digest);
+  mbedtls_sha256_free(&sha);
 
-  if (contentLength != otaSize) {
-    Serial.printf("[%lu] [OTA] Invalid content length\n", millis());
-    http.end();
-    return HTTP_ERROR;
+  if (result != DownloadResult::COMPLETE) {
+    Serial.printf("[%lu] [OTA] Downloaded only %u/%u bytes\n", millis(), written, size);
+    return result == DownloadResult::WRITE_FAILED ? INTERNAL_UPDATE_ERROR : HTTP_ERROR;
+  }
+  Serial.printf("[%lu] [OTA] Successfully downloaded %u bytes\n", millis(), written);
+
+  // Reject a corrupted download before it is marked bootable
+  const std::string actualSha256 = toHex(digest, sizeof(digest));
+  if (sha256.empty()) {
+    Serial.printf("[%lu] [OTA] No published checksum, SHA-256 is %s\n", millis(), actualSha256.c_str());
+  } else if (actualSha256 != sha256) {
+    Serial.printf("[%lu] [OTA] Checksum mismatch: expected %s, got %s\n", millis(), sha256.c_str(),
+                  actualSha256.c_str());
+    return CHECKSUM_ERROR;
+  }
+  return OK;
+}
+
+OtaUpdater::OtaUpdaterError OtaUpdater::installDelta(const std::function<void(size_t, size_t)>& onProgress) {
+  DeltaOtaPatcher patcher;
+  if (!patcher.begin()) {
+    return OOM_ERROR;
   }
 
-  // 3. Begin the ESP-IDF Update process
+  // The patcher starts the Update session itself once the header shows the running image is the patch base
+  const auto res =
+      downloadAsset(deltaUrl, deltaSize, deltaSha256,
+                    [&patcher](const uint8_t* data, const size_t len) { return patcher.write(data, len); }, onProgress);
+  if (res != OK || !patcher.finish()) {
+    Serial.printf("[%lu] [OTA] Delta update failed (%d, patch error %d)\n", millis(), res, patcher.getError());
+    if (Update.isRunning()) {
+      Update.abort();
+    }
+    return res != OK ? res : INTERNAL_UPDATE_ERROR;
+  }
+  return OK;
+}
+
+OtaUpdater::OtaUpdaterError OtaUpdater::installFull(const std::function<void(size_t, size_t)>& onProgress) {
+  // Begin the ESP-IDF Update process, it stays open across reconnects so a resumed download continues in place
   if (!Update.begin(otaSize)) {
     Serial.printf("[%lu] [OTA] Not enough space. Error: %s\n", millis(), Update.errorString());
-    http.end();
     return INTERNAL_UPDATE_ERROR;
   }
 
-  this->totalSize = otaSize;
-  Serial.printf("[%lu] [OTA] Update started\n", millis());
-  Update.onProgress([this, onProgress](const size_t progress, const size_t total) {
-    this->processedSize = progress;
-    this->totalSize = total;
-    onProgress(progress, total);
-  });
-  const size_t written = Update.writeStream(*client);
-  http.end();
+  const auto res = downloadAsset(
+      otaUrl, otaSize, otaSha256,
+      [](const uint8_t* data, const size_t len) {
+        if (Update.write(const_cast<uint8_t*>(data), len) != len) {
+          Serial.printf("[%lu] [OTA] Flash write failed. Error: %s\n", millis(), Update.errorString());
+          return false;
+        }
+        return true;
+      },
+      onProgress);
+  if (res != OK) {
+    Update.abort();
+  }
+  return res;
+}
 
-  if (written == otaSize) {
-    Serial.printf("[%lu] [OTA] Successfully written %u bytes\n", millis(), written);
-  } else {
-    Serial.printf("[%lu] [OTA] Written only %u/%u bytes. Error: %s\n", millis(), written, otaSize,
-                  Update.errorString());
-    return INTERNAL_UPDATE_ERROR;
+OtaUpdater::OtaUpdaterError OtaUpdater::installUpdate(const std::function<void(size_t, size_t)>& onProgress) {
+  if (!isUpdateNewer()) {
+    return UPDATE_OLDER_ERROR;
+  }
+
+  // Hashing, inflating and patching keep the CPU busy between network reads
+  const CpuBoost boost;
+  // Prefer the much smaller patch against the running firmware, the full image still works when it doesn't apply
+  OtaUpdaterError res = NO_UPDATE;
+  if (!deltaUrl.empty()) {
+    Serial.printf("[%lu] [OTA] Trying delta update (%u bytes instead of %u)\n", millis(), deltaSize, otaSize);
+    res = installDelta(onProgress);
+    if (res != OK) {
+      Serial.printf("[%lu] [OTA] Falling back to full image\n", millis());
+    }
+  }
+  if (res != OK) {
+    res = installFull(onProgress);
+  }
+  if (res != OK) {
+    return res;
   }
 
   if (Update.end() && Update.isFinished()) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -8,6 +9,12 @@ class OtaUpdater {
   std::string latestVersion;
   std::string otaUrl;
   size_t otaSize = 0;
+  // Lowercase hex SHA-256 of the image as published with the release, empty if unknown
+  std::string otaSha256;
+  // Optional patch from the running version to the latest one, empty if the release has none
+  std::string deltaUrl;
+  size_t deltaSize = 0;
+  std::string deltaSha256;
 
  public:
   enum OtaUpdaterError {
@@ -18,7 +25,17 @@ class OtaUpdater {
     UPDATE_OLDER_ERROR,
     INTERNAL_UPDATE_ERROR,
     OOM_ERROR,
+    CHECKSUM_ERROR,
   };
+
+ private:
+  OtaUpdaterError downloadAsset(const std::string& url, size_t size, const std::string& sha256,
+                                const std::function<bool(const uint8_t*, size_t)>& sink,
+                                const std::function<void(size_t, size_t)>& onProgress);
+  OtaUpdaterError installDelta(const std::function<void(size_t, size_t)>& onProgress);
+  OtaUpdaterError installFull(const std::function<void(size_t, size_t)>& onProgress);
+
+ public:
   size_t processedSize = 0;
   size_t totalSize = 0;
 
@@ -0,0 +1,265 @@
+#include "SdOtaUpdater.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Update.h>
+#include <esp_app_format.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <mbedtls/sha256.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "CpuGovernor.h"
+
+namespace {
+constexpr char FIRMWARE_FILE[] = "/firmware.bin";
+// Two of these are in flight: one being read from the SD card while the other is written to flash
+constexpr size_t BLOCK_SIZE = 16 * 1024;
+constexpr size_t SHA256_SIZE = 32;
+
+struct ReadPipeline {
+  FsFile file;
+  SemaphoreHandle_t sdMutex = nullptr;
+  uint8_t* buffers[2] = {};
+  size_t lengths[2] = {};
+  QueueHandle_t filled = nullptr;  // Buffer indexes holding data to flash, a length of 0 marks the end of the file
+  QueueHandle_t empty = nullptr;   // Buffer indexes free for the next read
+  SemaphoreHandle_t readerDone = nullptr;
+  volatile bool stop = false;
+};
+
+void readerTask(void* param) {
+  auto* pipeline = static_cast<ReadPipeline*>(param);
+  uint8_t index;
+  while (xQueueReceive(pipeline->empty, &index, portMAX_DELAY) == pdTRUE && !pipeline->stop) {
+    xSemaphoreTake(pipeline->sdMutex, portMAX_DELAY);
+    const int read = pipeline->file.read(pipeline->buffers[index], BLOCK_SIZE);
+    xSemaphoreGive(pipeline->sdMutex);
+
+    pipeline->lengths[index] = read > 0 ? read : 0;
+    xQueueSend(pipeline->filled, &index, portMAX_DELAY);
+    if (read <= 0) {
+      break;
+    }
+  }
+  xSemaphoreGive(pipeline->readerDone);
+  vTaskDelete(nullptr);
+}
+
+bool isBinFile(const char* name) {
+  const size_t len = strlen(name);
+  return len > 4 && name[0] != '.' && strcasecmp(name + len - 4, ".bin") == 0;
+}
+
+// Check the image and extract its version, returns whether esptool appended a SHA-256
+bool readImageHeader(FsFile& file, std::string& version, bool& hashAppended) {
+  esp_image_header_t imageHeader;
+  esp_image_segment_header_t segmentHeader;
+  esp_app_desc_t appDesc;
+  if (file.read(&imageHeader, sizeof(imageHeader)) != sizeof(imageHeader) ||
+      file.read(&segmentHeader, sizeof(segmentHeader)) != sizeof(segmentHeader) ||
+      file.read(&appDesc, sizeof(appDesc)) != sizeof(appDesc)) {
+    Serial.printf("[%lu] [SDOTA] Firmware file too short\n", millis());
+    return false;
+  }
+
+  if (imageHeader.magic != ESP_IMAGE_HEADER_MAGIC) {
+    Serial.printf("[%lu] [SDOTA] Not a firmware image (magic 0x%02x)\n", millis(), imageHeader.magic);
+    return false;
+  }
+  if (imageHeader.chip_id != CONFIG_IDF_FIRMWARE_CHIP_ID) {
+    Serial.printf("[%lu] [SDOTA] Firmware is for another chip (id %d)\n", millis(), imageHeader.chip_id);
+    return false;
+  }
+
+  hashAppended = imageHeader.hash_appended == 1;
+  if (appDesc.magic_word == ESP_APP_DESC_MAGIC_WORD) {
+    version.assign(appDesc.version, strnlen(appDesc.version, sizeof(appDesc.version)));
+  }
+  return true;
+}
+}  // namespace
+
+SdOtaUpdater::SdOtaUpdaterError SdOtaUpdater::findFirmware() {
+  firmwarePath.clear();
+  firmwareVersion.clear();
+
+  if (SdMan.exists(FIRMWARE_FILE)) {
+    firmwarePath = FIRMWARE_FILE;
+  } else {
+    FsFile root = SdMan.open("/");
+    char name[128];
+    for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+      file.getName(name, sizeof(name));
+      const bool match = !file.isDirectory() && isBinFile(name);
+      file.close();
+      if (match) {
+        firmwarePath = std::string("/") + name;
+        break;
+      }
+    }
+    root.close();
+  }
+
+  if (firmwarePath.empty()) {
+    Serial.printf("[%lu] [SDOTA] No firmware file found\n", millis());
+    return NO_FILE;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("SDOTA", firmwarePath, file)) {
+    return READ_ERROR;
+  }
+  bool hashAppended;
+  const bool valid = readImageHeader(file, firmwareVersion, hashAppended);
+  totalSize = file.size();
+  processedSize = 0;
+  file.close();
+
+  if (!valid) {
+    return INVALID_IMAGE;
+  }
+  Serial.printf("[%lu] [SDOTA] Found firmware %s (%s, %u bytes)\n", millis(), firmwarePath.c_str(),
+                firmwareVersion.c_str(), totalSize);
+  return OK;
+}
+
+SdOtaUpdater::SdOtaUpdaterError SdOtaUpdater::installUpdate(SemaphoreHandle_t sdMutex,
+                                                            const std::function<void(size_t, size_t)>& onProgress) {
+  if (firmwarePath.empty()) {
+    return NO_FILE;
+  }
+
+  const CpuBoost boost;
+  ReadPipeline pipeline;
+  pipeline.sdMutex = sdMutex;
+
+  xSemaphoreTake(sdMutex, portMAX_DELAY);
+  const bool opened = SdMan.openFileForRead("SDOTA", firmwarePath, pipeline.file);
+  bool hashAppended = false;
+  std::string version;
+  const bool valid = opened && readImageHeader(pipeline.file, version, hashAppended);
+  if (opened) {
+    totalSize = pipeline.file.size();
+    pipeline.file.seekSet(0);
+  }
+  xSemaphoreGive(sdMutex);
+
+  if (!opened) {
+    return READ_ERROR;
+  }
+  if (!valid || (hashAppended && totalSize <= SHA256_SIZE)) {
+    pipeline.file.close();
+    return INVALID_IMAGE;
+  }
+
+  if (!Update.begin(totalSize)) {
+    Serial.printf("[%lu] [SDOTA] Not enough space. Error: %s\n", millis(), Update.errorString());
+    pipeline.file.close();
+    return INTERNAL_UPDATE_ERROR;
+  }
+
+  pipeline.buffers[0] = static_cast<uint8_t*>(malloc(BLOCK_SIZE));
+  pipeline.buffers[1] = static_cast<uint8_t*>(malloc(BLOCK_SIZE));
+  pipeline.filled = xQueueCreate(2, sizeof(uint8_t));
+  pipeline.empty = xQueueCreate(2, sizeof(uint8_t));
+  pipeline.readerDone = xSemaphoreCreateBinary();
+  const auto cleanup = [&pipeline] {
+    free(pipeline.buffers[0]);
+    free(pipeline.buffers[1]);
+    if (pipeline.filled) vQueueDelete(pipeline.filled);
+    if (pipeline.empty) vQueueDelete(pipeline.empty);
+    if (pipeline.readerDone) vSemaphoreDelete(pipeline.readerDone);
+    pipeline.file.close();
+  };
+
+  if (!pipeline.buffers[0] || !pipeline.buffers[1] || !pipeline.filled || !pipeline.empty || !pipeline.readerDone) {
+    Serial.printf("[%lu] [SDOTA] Could not allocate read buffers\n", millis());
+    cleanup();
+    Update.abort();
+    return OOM_ERROR;
+  }
+
+  for (uint8_t i = 0; i < 2; i++) {
+    xQueueSend(pipeline.empty, &i, 0);
+  }
+  if (xTaskCreate(&readerTask, "SdOtaReader", 4096, &pipeline, 2, nullptr) != pdPASS) {
+    cleanup();
+    Update.abort();
+    return OOM_ERROR;
+  }
+
+  const unsigned long start = millis();
+  Serial.printf("[%lu] [SDOTA] Flashing %s\n", start, firmwarePath.c_str());
+
+  // The appended digest covers everything before it
+  const size_t hashedSize = hashAppended ? totalSize - SHA256_SIZE : totalSize;
+  uint8_t appendedHash[SHA256_SIZE] = {};
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts_ret(&sha, 0);
+
+  processedSize = 0;
+  SdOtaUpdaterError result = OK;
+  uint8_t index;
+  while (xQueueReceive(pipeline.filled, &index, portMAX_DELAY) == pdTRUE) {
+    const size_t len = pipeline.lengths[index];
+    const uint8_t* data = pipeline.buffers[index];
+    if (len == 0) {
+      if (processedSize != totalSize) {
+        Serial.printf("[%lu] [SDOTA] Read failed at %u / %u bytes\n", millis(), processedSize, totalSize);
+        result = READ_ERROR;
+      }
+      break;
+    }
+    if (processedSize + len > totalSize) {
+      result = READ_ERROR;
+      break;
+    }
+
+    if (processedSize < hashedSize) {
+      mbedtls_sha256_update_ret(&sha, data, std::min(len, hashedSize - processedSize));
+    }
+    for (size_t pos = std::max(processedSize, hashedSize); pos < processedSize + len; pos++) {
+      appendedHash[pos - hashedSize] = data[pos - processedSize];
+    }
+
+    if (Update.write(pipeline.buffers[index], len) != len) {
+      Serial.printf("[%lu] [SDOTA] Flash write failed at %u bytes. Error: %s\n", millis(), processedSize,
+                    Update.errorString());
+      result = INTERNAL_UPDATE_ERROR;
+      break;
+    }
+    processedSize += len;
+    onProgress(processedSize, totalSize);
+    xQueueSend(pipeline.empty, &index, portMAX_DELAY);
+  }
+
+  // Wake the reader if it is still waiting for a buffer and let it exit before tearing down
+  pipeline.stop = true;
+  xQueueSend(pipeline.empty, &index, 0);
+  xSemaphoreTake(pipeline.readerDone, portMAX_DELAY);
+  cleanup();
+
+  uint8_t digest[SHA256_SIZE];
+  mbedtls_sha256_finish_ret(&sha, digest);
+  mbedtls_sha256_free(&sha);
+
+  if (result == OK && hashAppended && memcmp(digest, appendedHash, SHA256_SIZE) != 0) {
+    Serial.printf("[%lu] [SDOTA] Image checksum mismatch\n", millis());
+    result = CHECKSUM_ERROR;
+  }
+  if (result != OK) {
+    Update.abort();
+    return result;
+  }
+
+  if (!Update.end() || !Update.isFinished()) {
+    Serial.printf("[%lu] [SDOTA] Error Occurred: %s\n", millis(), Update.errorString());
+    return INTERNAL_UPDATE_ERROR;
+  }
+  Serial.printf("[%lu] [SDOTA] Flashed %u bytes in %lu ms\n", millis(), processedSize, millis() - start);
+  return OK;
+}
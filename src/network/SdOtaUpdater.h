@@ -0,0 +1,46 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * Installs a firmware image from the SD card into the inactive OTA partition, no network required.
+ *
+ * The image header (magic and chip id) is checked before anything is written. While flashing, a reader task fills
+ * one buffer from the SD card as the previous one is written to flash, and the SHA-256 that esptool appends to the
+ * image is recomputed so a corrupted copy is rejected before the boot partition is switched.
+ */
+class SdOtaUpdater {
+ public:
+  enum SdOtaUpdaterError {
+    OK = 0,
+    NO_FILE,
+    READ_ERROR,
+    INVALID_IMAGE,
+    CHECKSUM_ERROR,
+    INTERNAL_UPDATE_ERROR,
+    OOM_ERROR,
+  };
+
+ private:
+  std::string firmwarePath;
+  std::string firmwareVersion;
+
+ public:
+  size_t processedSize = 0;
+  size_t totalSize = 0;
+
+  SdOtaUpdater() = default;
+
+  // Look for /firmware.bin, or the first .bin in the card's root, and validate its header
+  SdOtaUpdaterError findFirmware();
+  const std::string& getFirmwarePath() const { return firmwarePath; }
+  // Version embedded in the image's app description, may be empty
+  const std::string& getFirmwareVersion() const { return firmwareVersion; }
+  // sdMutex guards the SPI bus shared with the display and is held around every SD read
+  SdOtaUpdaterError installUpdate(SemaphoreHandle_t sdMutex, const std::function<void(size_t, size_t)>& onProgress);
+};
@@ -0,0 +1,30 @@
+#pragma once
+// Minimal assertions for the host tests: a failed CHECK reports and the test exits non-zero from checkResult()
+
+#include <cstdio>
+
+namespace check {
+inline int& failures() {
+  static int count = 0;
+  return count;
+}
+
+inline bool report(const bool ok, const char* expression, const char* file, const int line) {
+  if (!ok) {
+    fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, expression);
+    failures()++;
+  }
+  return ok;
+}
+
+inline int result(const char* name) {
+  if (failures() > 0) {
+    fprintf(stderr, "%s: %d check(s) failed\n", name, failures());
+    return 1;
+  }
+  printf("%s: all checks passed\n", name);
+  return 0;
+}
+}  // namespace check
+
+#define CHECK(expression) check::report(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
@@ -0,0 +1,157 @@
+#pragma once
+// HTTP server on a loopback port for the network tests. Every request is answered by the handler the test supplies,
+// a response can be cut off part way through its body to simulate a dropped connection.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct HttpRequest {
+  std::string path;
+  std::vector<std::pair<std::string, std::string>> headers;
+
+  // Empty if the request doesn't have it
+  std::string header(const char* name) const {
+    for (const auto& [key, value] : headers) {
+      if (strcasecmp(key.c_str(), name) == 0) {
+        return value;
+      }
+    }
+    return "";
+  }
+};
+
+struct HttpResponse {
+  int status = 200;
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string body;
+  // Close the connection after this many bytes of the body
+  size_t dropAfter = SIZE_MAX;
+};
+
+class LocalHttpServer {
+ public:
+  using Handler = std::function<HttpResponse(const HttpRequest&)>;
+
+  explicit LocalHttpServer(Handler handler) : handler(std::move(handler)) {
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    const int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    socklen_t length = sizeof(address);
+    getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length);
+    boundPort = ntohs(address.sin_port);
+    listen(listener, 8);
+    thread = std::thread([this] { serve(); });
+  }
+
+  ~LocalHttpServer() {
+    stopping = true;
+    thread.join();
+    close(listener);
+  }
+
+  uint16_t port() const { return boundPort; }
+  std::string url(const std::string& path) const { return "http://127.0.0.1:" + std::to_string(boundPort) + path; }
+
+  std::vector<HttpRequest> requests() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return received;
+  }
+  void clearRequests() {
+    std::lock_guard<std::mutex> lock(mutex);
+    received.clear();
+  }
+
+ private:
+  Handler handler;
+  int listener = -1;
+  uint16_t boundPort = 0;
+  std::atomic<bool> stopping{false};
+  std::thread thread;
+  std::mutex mutex;
+  std::vector<HttpRequest> received;
+
+  void serve() {
+    while (!stopping) {
+      pollfd descriptor = {listener, POLLIN, 0};
+      if (poll(&descriptor, 1, 20) <= 0) {
+        continue;
+      }
+      const int connection = accept(listener, nullptr, nullptr);
+      if (connection >= 0) {
+        answer(connection);
+        close(connection);
+      }
+    }
+  }
+
+  void answer(const int connection) {
+    std::string head;
+    char c;
+    while (head.size() < 4 || head.compare(head.size() - 4, 4, "\r\n\r\n") != 0) {
+      if (recv(connection, &c, 1, 0) != 1) {
+        return;
+      }
+      head += c;
+    }
+
+    HttpRequest request;
+    const auto pathStart = head.find(' ') + 1;
+    request.path = head.substr(pathStart, head.find(' ', pathStart) - pathStart);
+    size_t lineStart = head.find("\r\n") + 2;
+    while (lineStart < head.size() - 2) {
+      const auto lineEnd = head.find("\r\n", lineStart);
+      const auto line = head.substr(lineStart, lineEnd - lineStart);
+      lineStart = lineEnd + 2;
+      const auto colon = line.find(':');
+      if (colon != std::string::npos) {
+        const auto valueStart = line.find_first_not_of(' ', colon + 1);
+        request.headers.emplace_back(line.substr(0, colon),
+                                     valueStart == std::string::npos ? "" : line.substr(valueStart));
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      received.push_back(request);
+    }
+
+    const HttpResponse response = handler(request);
+    std::string out = "HTTP/1.1 " + std::to_string(response.status) + " Status\r\n";
+    bool hasLength = false;
+    for (const auto& [name, value] : response.headers) {
+      out += name + ": " + value + "\r\n";
+      hasLength |= strcasecmp(name.c_str(), "Content-Length") == 0;
+    }
+    if (!hasLength) {
+      out += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    }
+    out += "Connection: close\r\n\r\n";
+    out.append(response.body, 0, std::min(response.dropAfter, response.body.size()));
+    size_t sent = 0;
+    while (sent < out.size()) {
+      const ssize_t count = send(connection, out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+      if (count <= 0) {
+        break;
+      }
+      sent += count;
+    }
+    shutdown(connection, SHUT_WR);
+  }
+};
@@ -0,0 +1,43 @@
+#pragma once
+// Text of a book for the benchmarks: a file's contents without markup, as expat hands it to the parser between tags
+
+#include <cstdio>
+#include <string>
+
+namespace text_file {
+inline std::string read(const std::string& path) {
+  std::string text;
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file) {
+    fprintf(stderr, "Could not read %s\n", path.c_str());
+    return text;
+  }
+  char buffer[4096];
+  size_t count;
+  bool inTag = false;
+  while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    for (size_t i = 0; i < count; i++) {
+      if (buffer[i] == '<') {
+        inTag = true;
+      } else if (buffer[i] == '>' && inTag) {
+        inTag = false;
+      } else if (!inTag) {
+        text += buffer[i];
+      }
+    }
+  }
+  fclose(file);
+  return text;
+}
+
+// The prose of the repository's documentation, when no book is given
+inline std::string readDocs() {
+  std::string text;
+  for (const char* path :
+       {"USER_GUIDE.md", "README.md", "docs/comparison.md", "docs/file-formats.md", "docs/webserver.md"}) {
+    text += read(std::string(CROSSPOINT_ROOT) + "/" + path);
+    text += '\n';
+  }
+  return text;
+}
+}  // namespace text_file
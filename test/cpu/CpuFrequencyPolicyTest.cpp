@@ -0,0 +1,141 @@
+// CpuFrequencyPolicy decisions over time, and CpuGovernor applying them to the clock on the fake millis() clock.
+
+#include <Arduino.h>
+#include <CpuGovernor.h>
+
+#include <climits>
+
+#include "../common/Check.h"
+
+namespace {
+constexpr unsigned long HOLD = CpuFrequencyPolicy::BOOST_HOLD_MS;
+
+// Boosted from the first to the last millisecond, idle right after
+bool boostedUntil(const CpuFrequencyPolicy& policy, const unsigned long from, const unsigned long until) {
+  return policy.isBoosted(from) && policy.isBoosted(until - 1) && !policy.isBoosted(until);
+}
+
+void testIdle() {
+  const CpuFrequencyPolicy policy;
+  CHECK(!policy.isBoosted(0));
+  CHECK(policy.targetMhz(0) == CpuFrequencyPolicy::IDLE_MHZ);
+}
+
+void testNestedBoosts() {
+  CpuFrequencyPolicy policy;
+  policy.beginBoost();
+  CHECK(policy.targetMhz(0) == CpuFrequencyPolicy::BOOST_MHZ);
+  policy.beginBoost();
+  // The inner boost ending starts no hold, the outer one keeps the clock up for as long as it takes
+  policy.endBoost(100);
+  CHECK(policy.isBoosted(100 + HOLD));
+  CHECK(policy.isBoosted(3600000));
+  policy.endBoost(3600000);
+  CHECK(boostedUntil(policy, 3600000, 3600000 + HOLD));
+  CHECK(policy.targetMhz(3600000 + HOLD) == CpuFrequencyPolicy::IDLE_MHZ);
+}
+
+void testHoldAfterLastBoost() {
+  CpuFrequencyPolicy policy;
+  policy.beginBoost();
+  policy.endBoost(1000);
+  CHECK(boostedUntil(policy, 1000, 1000 + HOLD));
+
+  // A job starting within the hold keeps the clock up, its own hold counts from its end
+  policy.beginBoost();
+  policy.endBoost(1100);
+  CHECK(boostedUntil(policy, 1100, 1100 + HOLD));
+
+  // One more endBoost than beginBoost doesn't leave the clock up for good
+  policy.endBoost(5000);
+  CHECK(boostedUntil(policy, 5000, 5000 + HOLD));
+  policy.beginBoost();
+  policy.endBoost(6000);
+  CHECK(boostedUntil(policy, 6000, 6000 + HOLD));
+}
+
+void testTimedBoostNotShortened() {
+  CpuFrequencyPolicy policy;
+  policy.onUserInput(0);
+  CHECK(boostedUntil(policy, 0, CpuFrequencyPolicy::INPUT_BOOST_MS));
+
+  // A hold or a shorter boost ending earlier leaves the deadline alone
+  policy.beginBoost();
+  policy.endBoost(100);
+  policy.boostFor(50, 200);
+  CHECK(boostedUntil(policy, 200, CpuFrequencyPolicy::INPUT_BOOST_MS));
+
+  // A later deadline extends it
+  policy.boostFor(500, 800);
+  CHECK(boostedUntil(policy, 800, 1300));
+
+  // Once it ran out, a shorter boost starts afresh
+  policy.boostFor(100, 2000);
+  CHECK(boostedUntil(policy, 2000, 2100));
+}
+
+// Deadlines past the wrap of millis(), about 49 days in on the device
+void testWrapAround() {
+  const unsigned long beforeWrap = ULONG_MAX - 99;  // 100 ms before millis() wraps to 0
+
+  CpuFrequencyPolicy policy;
+  policy.boostFor(1000, beforeWrap);
+  CHECK(policy.isBoosted(ULONG_MAX));
+  CHECK(policy.isBoosted(0));
+  CHECK(boostedUntil(policy, beforeWrap, 900));
+
+  // Still not shortened by a hold ending on the other side of the wrap
+  policy.beginBoost();
+  policy.endBoost(ULONG_MAX - 9);
+  CHECK(boostedUntil(policy, ULONG_MAX - 9, 900));
+
+  CpuFrequencyPolicy hold;
+  hold.beginBoost();
+  hold.endBoost(beforeWrap);
+  CHECK(boostedUntil(hold, beforeWrap, HOLD - 100));
+
+  // A deadline from before the wrap counts as over afterwards, not as far in the future
+  CpuFrequencyPolicy expired;
+  expired.boostFor(100, beforeWrap);
+  CHECK(!expired.isBoosted(1000));
+  expired.boostFor(100, 1000);
+  CHECK(boostedUntil(expired, 1000, 1100));
+}
+
+// The governor raises the clock right away and drops it from update() once the policy says so
+void testGovernor() {
+  host::setMillis(10000);
+  setCpuFrequencyMhz(CpuFrequencyPolicy::BOOST_MHZ);
+  CPU_GOVERNOR.begin();
+  CHECK(getCpuFrequencyMhz() == CpuFrequencyPolicy::BOOST_MHZ);
+
+  delay(CpuFrequencyPolicy::INPUT_BOOST_MS);
+  CPU_GOVERNOR.update();
+  CHECK(getCpuFrequencyMhz() == CpuFrequencyPolicy::IDLE_MHZ);
+
+  {
+    const CpuBoost boost;
+    CHECK(getCpuFrequencyMhz() == CpuFrequencyPolicy::BOOST_MHZ);
+    delay(60000);
+    CPU_GOVERNOR.update();
+    CHECK(getCpuFrequencyMhz() == CpuFrequencyPolicy::BOOST_MHZ);
+  }
+  delay(HOLD - 1);
+  CPU_GOVERNOR.update();
+  CHECK(getCpuFrequencyMhz() == CpuFrequencyPolicy::BOOST_MHZ);
+  delay(1);
+  CPU_GOVERNOR.update();
+  CHECK(getCpuFrequencyMhz() == CpuFrequencyPolicy::IDLE_MHZ);
+  CHECK(CPU_GOVERNOR.getCurrentMhz() == CpuFrequencyPolicy::IDLE_MHZ);
+}
+}  // namespace
+
+int main() {
+  testIdle();
+  testNestedBoosts();
+  testHoldAfterLastBoost();
+  testTimedBoostNotShortened();
+  testWrapAround();
+  testGovernor();
+  return check::result("cpu_frequency_policy_test");
+}
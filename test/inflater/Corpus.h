@@ -0,0 +1,92 @@
+#pragma once
+// Inputs the inflater is checked and timed on: files from the repository (text, source, a font table, images that
+// don't compress) and generated data for the edge cases (empty, long runs, incompressible bytes)
+
+#include <miniz.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace corpus {
+struct Sample {
+  std::string name;
+  std::vector<uint8_t> data;
+};
+
+struct Compressed {
+  std::string name;
+  const Sample* sample;
+  std::vector<uint8_t> deflated;
+};
+
+inline bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file) {
+    return false;
+  }
+  uint8_t buffer[4096];
+  size_t count;
+  while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + count);
+  }
+  fclose(file);
+  return true;
+}
+
+inline std::vector<Sample> samples() {
+  std::vector<Sample> samples;
+  for (const char* path : {"USER_GUIDE.md", "docs/file-formats.md", "lib/miniz/miniz.c",
+                           "lib/EpdFont/builtinFonts/bookerly_18_bold.h", "docs/images/cover.jpg",
+                           "docs/images/wifi/webserver_homepage.png"}) {
+    Sample sample{path, {}};
+    if (readFile(std::string(CROSSPOINT_ROOT) + "/" + path, sample.data)) {
+      samples.push_back(std::move(sample));
+    } else {
+      fprintf(stderr, "Corpus file %s is missing\n", path);
+    }
+  }
+
+  std::mt19937 random(1234);
+  samples.push_back({"empty", {}});
+  samples.push_back({"one byte", {'x'}});
+  samples.push_back({"zeros", std::vector<uint8_t>(300000, 0)});
+  Sample noise{"noise", std::vector<uint8_t>(200000)};
+  for (auto& byte : noise.data) {
+    byte = static_cast<uint8_t>(random());
+  }
+  samples.push_back(std::move(noise));
+  // Few distinct bytes with runs, lots of short matches at all distances
+  Sample runs{"runs", {}};
+  while (runs.data.size() < 500000) {
+    runs.data.insert(runs.data.end(), 1 + random() % 300, static_cast<uint8_t>('a' + random() % 4));
+  }
+  samples.push_back(std::move(runs));
+  return samples;
+}
+
+// Raw deflate (no zlib header), as stored in zip entries
+inline std::vector<uint8_t> deflate(const std::vector<uint8_t>& data, const int level, const mz_uint extraFlags) {
+  const mz_uint flags = tdefl_create_comp_flags_from_zip_params(level, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+  size_t size = 0;
+  void* deflated = tdefl_compress_mem_to_heap(data.data(), data.size(), &size, static_cast<int>(flags | extraFlags));
+  std::vector<uint8_t> result(static_cast<uint8_t*>(deflated), static_cast<uint8_t*>(deflated) + size);
+  mz_free(deflated);
+  return result;
+}
+
+// Every sample as stored blocks, fixed Huffman blocks and dynamic blocks at a fast and the best level
+inline std::vector<Compressed> compress(const std::vector<Sample>& samples) {
+  std::vector<Compressed> compressed;
+  for (const auto& sample : samples) {
+    compressed.push_back({sample.name + " stored", &sample, deflate(sample.data, 0, TDEFL_FORCE_ALL_RAW_BLOCKS)});
+    compressed.push_back({sample.name + " fixed", &sample, deflate(sample.data, 6, TDEFL_FORCE_ALL_STATIC_BLOCKS)});
+    compressed.push_back({sample.name + " level 1", &sample, deflate(sample.data, 1, 0)});
+    compressed.push_back({sample.name + " level 9", &sample, deflate(sample.data, 9, 0)});
+  }
+  return compressed;
+}
+}  // namespace corpus
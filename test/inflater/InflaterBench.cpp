@@ -0,0 +1,93 @@
+// Inflater throughput against miniz's tinfl on the test corpus, into a buffer and through a 32 KB window. Host
+// numbers are only good for comparing the two, the last line is the geometric mean of Inflater's speedup.
+
+#include <Inflater.h>
+#include <miniz.h>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+#include "Corpus.h"
+
+namespace {
+class NullPrint final : public Print {
+ public:
+  size_t write(uint8_t) override { return 1; }
+  size_t write(const uint8_t*, const size_t size) override { return size; }
+};
+
+int discard(const void*, const int length, void*) { return length > 0; }
+
+// Best of a few runs, each repeating fn until it took long enough to time
+template <typename Fn>
+double megabytesPerSecond(const size_t bytes, Fn fn) {
+  double best = 0;
+  for (int run = 0; run < 5; run++) {
+    int iterations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    double seconds;
+    do {
+      if (!fn()) {
+        return -1;
+      }
+      iterations++;
+      seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (seconds < 0.05);
+    best = std::max(best, bytes * iterations / seconds / 1e6);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  const auto samples = corpus::samples();
+  const auto compressed = corpus::compress(samples);
+  auto inflater = std::unique_ptr<Inflater>(new Inflater());
+  std::unique_ptr<uint8_t[]> inputBuffer(new uint8_t[1024]);
+  std::unique_ptr<uint8_t[]> window(new uint8_t[Inflater::WINDOW_SIZE]);
+  NullPrint sink;
+
+  printf("%-52s %8s | %21s | %21s\n", "", "", "to buffer MB/s", "to stream MB/s");
+  printf("%-52s %8s | %10s %10s | %10s %10s\n", "sample", "bytes", "tinfl", "Inflater", "tinfl", "Inflater");
+  double logSpeedups[2] = {};
+  int counted = 0;
+  for (const auto& entry : compressed) {
+    const auto& data = entry.sample->data;
+    if (data.size() < 4096) {
+      continue;
+    }
+    std::vector<uint8_t> output(data.size());
+
+    const double tinflBuffer = megabytesPerSecond(data.size(), [&] {
+      return tinfl_decompress_mem_to_mem(output.data(), output.size(), entry.deflated.data(), entry.deflated.size(),
+                                         0) == data.size();
+    });
+    const double inflaterBuffer = megabytesPerSecond(data.size(), [&] {
+      return inflater->inflateToBuffer(entry.deflated.data(), entry.deflated.size(), output.data(), output.size());
+    });
+    const double tinflStream = megabytesPerSecond(data.size(), [&] {
+      size_t size = entry.deflated.size();
+      return tinfl_decompress_mem_to_callback(entry.deflated.data(), &size, discard, nullptr, 0) == 1;
+    });
+    const double inflaterStream = megabytesPerSecond(data.size(), [&] {
+      size_t offset = 0;
+      const Inflater::ReadFn read = [&](uint8_t* buffer, const size_t size) {
+        const size_t count = std::min(size, entry.deflated.size() - offset);
+        memcpy(buffer, entry.deflated.data() + offset, count);
+        offset += count;
+        return count;
+      };
+      return inflater->inflateToStream(read, inputBuffer.get(), 1024, window.get(), sink);
+    });
+
+    printf("%-52s %8zu | %10.1f %10.1f | %10.1f %10.1f\n", entry.name.c_str(), data.size(), tinflBuffer,
+           inflaterBuffer, tinflStream, inflaterStream);
+    logSpeedups[0] += std::log(inflaterBuffer / tinflBuffer);
+    logSpeedups[1] += std::log(inflaterStream / tinflStream);
+    counted++;
+  }
+  printf("%-52s %8s | %20.2fx | %20.2fx\n", "Inflater speedup", "", std::exp(logSpeedups[0] / counted),
+         std::exp(logSpeedups[1] / counted));
+  return 0;
+}
@@ -0,0 +1,124 @@
+// Inflater against miniz's tinfl: both must reproduce every corpus sample, through a buffer and through a stream fed
+// in chunks of any size, and reject truncated or corrupted streams without touching memory they don't own
+
+#include <Inflater.h>
+#include <miniz.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include "../common/Check.h"
+#include "Corpus.h"
+
+namespace {
+class VectorPrint final : public Print {
+ public:
+  std::vector<uint8_t> data;
+  size_t write(const uint8_t c) override {
+    data.push_back(c);
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    data.insert(data.end(), buffer, buffer + size);
+    return size;
+  }
+};
+
+// The reference, into a buffer with room to spare so a stream that inflates to too much shows
+bool inflateWithTinfl(const std::vector<uint8_t>& deflated, const size_t size, std::vector<uint8_t>& output) {
+  output.resize(size + 1);
+  const size_t inflated =
+      tinfl_decompress_mem_to_mem(output.data(), output.size(), deflated.data(), deflated.size(), 0);
+  if (inflated == TINFL_DECOMPRESS_MEM_TO_MEM_FAILED) {
+    return false;
+  }
+  output.resize(inflated);
+  return true;
+}
+
+bool inflateToBuffer(Inflater& inflater, const std::vector<uint8_t>& deflated, const size_t size,
+                     std::vector<uint8_t>& output) {
+  // Exactly sized heap block, so a write past the end is caught by the address sanitizer
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[size]);
+  const bool ok = inflater.inflateToBuffer(deflated.data(), deflated.size(), buffer.get(), size);
+  output.assign(buffer.get(), buffer.get() + size);
+  return ok;
+}
+
+// chunk is the most the read function hands over per call, bufferSize the inflater's input buffer
+bool inflateToStream(Inflater& inflater, const std::vector<uint8_t>& deflated, const size_t chunk,
+                     const size_t bufferSize, std::vector<uint8_t>& output) {
+  size_t offset = 0;
+  const Inflater::ReadFn read = [&](uint8_t* buffer, const size_t size) {
+    const size_t count = std::min({size, chunk, deflated.size() - offset});
+    memcpy(buffer, deflated.data() + offset, count);
+    offset += count;
+    return count;
+  };
+  std::unique_ptr<uint8_t[]> inputBuffer(new uint8_t[bufferSize]);
+  std::unique_ptr<uint8_t[]> window(new uint8_t[Inflater::WINDOW_SIZE]);
+  VectorPrint out;
+  const bool ok = inflater.inflateToStream(read, inputBuffer.get(), bufferSize, window.get(), out);
+  output = std::move(out.data);
+  return ok;
+}
+}  // namespace
+
+int main() {
+  const auto samples = corpus::samples();
+  const auto compressed = corpus::compress(samples);
+  CHECK(samples.size() >= 11);
+  auto inflater = std::unique_ptr<Inflater>(new Inflater());
+
+  for (const auto& entry : compressed) {
+    const auto& expected = entry.sample->data;
+    std::vector<uint8_t> output;
+
+    CHECK(inflateWithTinfl(entry.deflated, expected.size(), output) && output == expected);
+
+    const bool buffered = inflateToBuffer(*inflater, entry.deflated, expected.size(), output);
+    if (!CHECK(buffered && output == expected)) {
+      fprintf(stderr, "  inflateToBuffer: %s\n", entry.name.c_str());
+    }
+
+    for (const auto& [chunk, bufferSize] : {std::pair<size_t, size_t>{1, 4}, {3, 16}, {1000, 1024}, {SIZE_MAX, 4096}}) {
+      const bool streamed = inflateToStream(*inflater, entry.deflated, chunk, bufferSize, output);
+      if (!CHECK(streamed && output == expected)) {
+        fprintf(stderr, "  inflateToStream: %s (chunk %zu, buffer %zu)\n", entry.name.c_str(), chunk, bufferSize);
+      }
+    }
+
+    // The output size is that of the zip entry, a stream that inflates to more or less is corrupt
+    if (!expected.empty()) {
+      CHECK(!inflateToBuffer(*inflater, entry.deflated, expected.size() - 1, output));
+      CHECK(!inflateToBuffer(*inflater, entry.deflated, expected.size() + 1, output));
+    }
+
+    // Cut off streams must fail rather than pad the output with whatever the missing bits would have been
+    if (entry.deflated.size() > 8) {
+      std::vector<uint8_t> truncated(entry.deflated.begin(), entry.deflated.end() - 8);
+      CHECK(!inflateToBuffer(*inflater, truncated, expected.size(), output));
+      CHECK(!inflateToStream(*inflater, truncated, 1000, 1024, output) || output.size() < expected.size());
+    }
+  }
+
+  // Corrupted streams may decode to anything or fail, they only must not crash or write out of bounds
+  std::mt19937 random(99);
+  for (const auto& entry : compressed) {
+    if (entry.deflated.size() < 16 || entry.sample->data.empty()) {
+      continue;
+    }
+    for (int round = 0; round < 20; round++) {
+      auto corrupted = entry.deflated;
+      for (int flips = 1 + random() % 4; flips > 0; flips--) {
+        corrupted[random() % corrupted.size()] ^= static_cast<uint8_t>(1 << random() % 8);
+      }
+      std::vector<uint8_t> output;
+      inflateToBuffer(*inflater, corrupted, entry.sample->data.size(), output);
+      inflateToStream(*inflater, corrupted, 777, 1024, output);
+    }
+  }
+
+  return check::result("inflater_test");
+}
@@ -0,0 +1,310 @@
+// HttpDownloader against a local server that answers like the Calibre content server (ETag, Last-Modified, byte
+// ranges with If-Range): dropped connections resume, a book that changed on the server is never spliced onto the
+// old partial download, and a partial file from an earlier session is only resumed when its validator is known.
+
+#include <Arduino.h>
+#include <HttpDownloader.h>
+#include <SDCardManager.h>
+
+#include <cstdlib>
+#include <random>
+
+#include "../common/Check.h"
+#include "../common/LocalHttpServer.h"
+
+namespace {
+constexpr char BOOK_PATH[] = "/get/EPUB/42/calibre";
+
+struct Book {
+  std::string content;
+  std::string etag;
+  std::string lastModified;
+};
+
+Book makeBook(const unsigned seed, const size_t size) {
+  std::mt19937 random(seed);
+  Book book;
+  book.content.resize(size);
+  for (auto& c : book.content) {
+    c = static_cast<char>(random());
+  }
+  book.etag = "\"" + std::to_string(seed) + "-" + std::to_string(size) + "\"";
+  book.lastModified = "Tue, 0" + std::to_string(seed % 10) + " Sep 2026 10:00:00 GMT";
+  return book;
+}
+
+class CalibreServer {
+ public:
+  Book book;
+  bool honourRange = true;
+  bool honourIfRange = true;
+  bool sendEtag = true;
+  // The first `drops` responses are cut off after dropAfter body bytes
+  int drops = 0;
+  size_t dropAfter = SIZE_MAX;
+  // Called with the number of the request (from 0) before it is answered
+  std::function<void(int)> beforeRequest;
+
+  HttpResponse handle(const HttpRequest& request) {
+    if (beforeRequest) {
+      beforeRequest(served);
+    }
+    HttpResponse response;
+    if (request.path != BOOK_PATH) {
+      response.status = 404;
+      return response;
+    }
+    response.headers = {{"Content-Type", "application/epub+zip"},
+                        {"Accept-Ranges", "bytes"},
+                        {"Last-Modified", book.lastModified}};
+    if (sendEtag) {
+      response.headers.emplace_back("ETag", book.etag);
+    }
+
+    const std::string range = request.header("Range");
+    const std::string ifRange = request.header("If-Range");
+    const bool validatorMatches = ifRange.empty() || ifRange == book.etag || ifRange == book.lastModified;
+    if (honourRange && range.rfind("bytes=", 0) == 0 && (!honourIfRange || validatorMatches)) {
+      const size_t start = strtoul(range.c_str() + 6, nullptr, 10);
+      const size_t size = book.content.size();
+      if (start >= size) {
+        response.status = 416;
+        response.headers.emplace_back("Content-Range", "bytes */" + std::to_string(size));
+      } else {
+        response.status = 206;
+        response.headers.emplace_back("Content-Range", "bytes " + std::to_string(start) + "-" +
+                                                           std::to_string(size - 1) + "/" + std::to_string(size));
+        response.body = book.content.substr(start);
+      }
+    } else {
+      response.body = book.content;
+    }
+    if (served++ < drops) {
+      response.dropAfter = dropAfter;
+    }
+    return response;
+  }
+
+ private:
+  int served = 0;
+};
+
+std::string readSdFile(const char* path) {
+  std::string content;
+  FsFile file = SdMan.open(path, O_RDONLY);
+  char buffer[4096];
+  int count;
+  while (file && (count = file.read(buffer, sizeof(buffer))) > 0) {
+    content.append(buffer, count);
+  }
+  return content;
+}
+
+void writeSdFile(const char* path, const std::string& content) {
+  FsFile file;
+  SdMan.openFileForWrite("TEST", path, file);
+  file.write(content.data(), content.size());
+}
+
+// Run one download from a fresh server, the SD card keeps what earlier runs in the same test left on it
+HttpDownloader::HttpDownloaderError download(CalibreServer& calibre, std::vector<HttpRequest>& requests) {
+  LocalHttpServer server([&calibre](const HttpRequest& request) { return calibre.handle(request); });
+  const auto result = HttpDownloader::downloadToFile(server.url(BOOK_PATH), "/book.epub", xSemaphoreCreateMutex(),
+                                                     [](size_t, size_t) {});
+  requests = server.requests();
+  return result;
+}
+
+void freshSdCard() {
+  host::setSdRoot(host::makeTempSdRoot());
+  host::setMillis(0);
+}
+
+bool noLeftovers() { return !SdMan.exists("/book.epub.part") && !SdMan.exists("/book.epub.part.tag"); }
+
+void testCompleteDownload() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(1, 100000);
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  CHECK(noLeftovers());
+  CHECK(requests.size() == 1 && requests[0].header("Range").empty());
+}
+
+void testResumeAfterDrops() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(2, 100000);
+  calibre.drops = 2;
+  calibre.dropAfter = 40000;
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  CHECK(noLeftovers());
+  if (CHECK(requests.size() == 3)) {
+    CHECK(requests[1].header("Range") == "bytes=40000-");
+    CHECK(requests[1].header("If-Range") == calibre.book.etag);
+    CHECK(requests[2].header("Range") == "bytes=80000-");
+  }
+}
+
+// The book is replaced on the server between the dropped request and the resume, If-Range gets the whole new one
+void testBookChangedBetweenAttempts() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(3, 100000);
+  const Book oldBook = calibre.book;
+  const Book newBook = makeBook(4, 90000);
+  calibre.drops = 1;
+  calibre.dropAfter = 50000;
+  calibre.beforeRequest = [&](const int request) {
+    if (request == 1) {
+      calibre.book = newBook;
+    }
+  };
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == newBook.content);
+  if (CHECK(requests.size() == 2)) {
+    CHECK(requests[1].header("If-Range") == oldBook.etag);
+  }
+}
+
+// A server that serves ranges but ignores If-Range answers with a range of the new book, its ETag gives it away
+void testBookChangedServerIgnoresIfRange() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(5, 100000);
+  const Book newBook = makeBook(6, 120000);
+  calibre.honourIfRange = false;
+  calibre.drops = 1;
+  calibre.dropAfter = 30000;
+  calibre.beforeRequest = [&](const int request) {
+    if (request == 1) {
+      calibre.book = newBook;
+    }
+  };
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == newBook.content);
+  if (CHECK(requests.size() == 3)) {
+    CHECK(requests[1].header("Range") == "bytes=30000-");
+    CHECK(requests[2].header("Range").empty());
+  }
+}
+
+void testServerIgnoresRange() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(7, 100000);
+  calibre.honourRange = false;
+  calibre.drops = 1;
+  calibre.dropAfter = 60000;
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  CHECK(requests.size() == 2);
+}
+
+// A partial file without a validator (e.g. left by an older firmware) can't be trusted to be the same book
+void testPartialFileWithoutValidator() {
+  freshSdCard();
+  writeSdFile("/book.epub.part", std::string(5000, 'x'));
+  CalibreServer calibre;
+  calibre.book = makeBook(8, 50000);
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  CHECK(requests.size() == 1 && requests[0].header("Range").empty());
+}
+
+// Every attempt of the first session drops, the second session picks up the partial file with its saved validator
+void testResumeInLaterSession() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(9, 100000);
+  calibre.drops = 100;
+  calibre.dropAfter = 10000;
+  calibre.honourRange = false;
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::HTTP_ERROR);
+  CHECK(SdMan.exists("/book.epub.part") && SdMan.exists("/book.epub.part.tag"));
+  CHECK(!SdMan.exists("/book.epub"));
+
+  calibre.drops = 0;
+  calibre.honourRange = true;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  CHECK(noLeftovers());
+  if (CHECK(requests.size() == 1)) {
+    CHECK(requests[0].header("Range") == "bytes=10000-");
+    CHECK(requests[0].header("If-Range") == calibre.book.etag);
+  }
+}
+
+// The device went off between the last byte and the rename, the server has nothing past the end to send
+void testPartialFileAlreadyComplete() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(10, 40000);
+  writeSdFile("/book.epub.part", calibre.book.content);
+  // The validator file holds the ETag and the date as length prefixed strings
+  FsFile tag;
+  SdMan.openFileForWrite("TEST", "/book.epub.part.tag", tag);
+  const uint32_t etagLength = calibre.book.etag.size();
+  const uint32_t dateLength = calibre.book.lastModified.size();
+  tag.write(&etagLength, sizeof(etagLength));
+  tag.write(calibre.book.etag.data(), etagLength);
+  tag.write(&dateLength, sizeof(dateLength));
+  tag.write(calibre.book.lastModified.data(), dateLength);
+  tag.close();
+
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  CHECK(noLeftovers());
+  CHECK(requests.size() == 1 && requests[0].header("Range") == "bytes=40000-");
+}
+
+// Without an ETag (or with a weak one) the Last-Modified date is the validator
+void testLastModifiedValidator() {
+  freshSdCard();
+  CalibreServer calibre;
+  calibre.book = makeBook(11, 100000);
+  calibre.sendEtag = false;
+  calibre.drops = 1;
+  calibre.dropAfter = 20000;
+  std::vector<HttpRequest> requests;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  CHECK(readSdFile("/book.epub") == calibre.book.content);
+  if (CHECK(requests.size() == 2)) {
+    CHECK(requests[1].header("If-Range") == calibre.book.lastModified);
+  }
+
+  freshSdCard();
+  calibre = CalibreServer();
+  calibre.book = makeBook(12, 100000);
+  calibre.book.etag = "W/" + calibre.book.etag;
+  calibre.drops = 1;
+  calibre.dropAfter = 20000;
+  CHECK(download(calibre, requests) == HttpDownloader::OK);
+  if (CHECK(requests.size() == 2)) {
+    CHECK(requests[1].header("If-Range") == calibre.book.lastModified);
+  }
+}
+}  // namespace
+
+int main() {
+  testCompleteDownload();
+  testResumeAfterDrops();
+  testBookChangedBetweenAttempts();
+  testBookChangedServerIgnoresIfRange();
+  testServerIgnoresRange();
+  testPartialFileWithoutValidator();
+  testResumeInLaterSession();
+  testPartialFileAlreadyComplete();
+  testLastModifiedValidator();
+  return check::result("http_downloader_test");
+}
@@ -0,0 +1,205 @@
+// OtaUpdater against a local stand-in for the GitHub release API and asset download: a dropped download resumes into
+// the open Update session, a server answering the resume with the whole image (200) has the part already flashed
+// skipped, and an image whose SHA-256 doesn't match the published digest is aborted before Update.end().
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <OtaUpdater.h>
+#include <Update.h>
+#include <mbedtls/sha256.h>
+
+#include <random>
+
+#include "../common/Check.h"
+#include "../common/LocalHttpServer.h"
+
+namespace {
+constexpr char RELEASE_PATH[] = "/repos/daveallie/crosspoint-reader/releases/latest";
+constexpr char FIRMWARE_PATH[] = "/download/firmware.bin";
+
+std::string sha256Hex(const std::string& data) {
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts_ret(&sha, 0);
+  mbedtls_sha256_update_ret(&sha, reinterpret_cast<const unsigned char*>(data.data()), data.size());
+  unsigned char digest[32];
+  mbedtls_sha256_finish_ret(&sha, digest);
+  static constexpr char digits[] = "0123456789abcdef";
+  std::string hex;
+  for (const unsigned char byte : digest) {
+    hex += digits[byte >> 4];
+    hex += digits[byte & 0x0F];
+  }
+  return hex;
+}
+
+std::string makeFirmware(const size_t size) {
+  std::mt19937 random(size);
+  std::string firmware(size, '\0');
+  for (auto& c : firmware) {
+    c = static_cast<char>(random());
+  }
+  return firmware;
+}
+
+class ReleaseServer {
+ public:
+  std::string firmware;
+  std::string publishedDigest;
+  bool honourRange = true;
+  // The first `drops` firmware responses are cut off after dropAfter body bytes
+  int drops = 0;
+  size_t dropAfter = SIZE_MAX;
+  // Flip a byte in every partial response, as a broken proxy mixing up two builds would
+  bool corruptRanges = false;
+  uint16_t port = 0;
+
+  HttpResponse handle(const HttpRequest& request) {
+    HttpResponse response;
+    if (request.path == RELEASE_PATH) {
+      response.headers = {{"Content-Type", "application/json"}};
+      response.body = R"({"tag_name": "1.0.1", "assets": [{"name": "firmware.bin", "browser_download_url": ")"
+                      "http://127.0.0.1:" +
+                      std::to_string(port) + FIRMWARE_PATH + R"(", "size": )" + std::to_string(firmware.size()) +
+                      R"(, "digest": "sha256:)" + publishedDigest + R"("}]})";
+      return response;
+    }
+    if (request.path != FIRMWARE_PATH) {
+      response.status = 404;
+      return response;
+    }
+
+    const std::string range = request.header("Range");
+    if (honourRange && range.rfind("bytes=", 0) == 0) {
+      const size_t start = strtoul(range.c_str() + 6, nullptr, 10);
+      response.status = 206;
+      response.headers = {{"Content-Range", "bytes " + std::to_string(start) + "-" +
+                                                std::to_string(firmware.size() - 1) + "/" +
+                                                std::to_string(firmware.size())}};
+      response.body = firmware.substr(start);
+      if (corruptRanges) {
+        response.body[response.body.size() / 2] ^= 0x01;
+      }
+    } else {
+      response.body = firmware;
+    }
+    if (firmwareRequests++ < drops) {
+      response.dropAfter = dropAfter;
+    }
+    return response;
+  }
+
+ private:
+  int firmwareRequests = 0;
+};
+
+struct Run {
+  OtaUpdater::OtaUpdaterError result;
+  std::vector<HttpRequest> firmwareRequests;
+};
+
+Run runUpdate(ReleaseServer& release) {
+  host::setMillis(0);
+  Update.reset();
+  LocalHttpServer server([&release](const HttpRequest& request) { return release.handle(request); });
+  release.port = server.port();
+  // api.github.com and the asset URL both reach the local server
+  host::routeHttpTo(server.port());
+
+  OtaUpdater updater;
+  Run run = {OtaUpdater::NO_UPDATE, {}};
+  if (!CHECK(updater.checkForUpdate() == OtaUpdater::OK) || !CHECK(updater.isUpdateNewer())) {
+    return run;
+  }
+  run.result = updater.installUpdate([](size_t, size_t) {});
+  for (const auto& request : server.requests()) {
+    if (request.path == FIRMWARE_PATH) {
+      run.firmwareRequests.push_back(request);
+    }
+  }
+  return run;
+}
+
+void testSha256() {
+  CHECK(sha256Hex("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  CHECK(sha256Hex(std::string(1000, 'a')) == "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3");
+}
+
+void testInstall() {
+  ReleaseServer release;
+  release.firmware = makeFirmware(300000);
+  release.publishedDigest = sha256Hex(release.firmware);
+  const Run run = runUpdate(release);
+  CHECK(run.result == OtaUpdater::OK);
+  CHECK(Update.committed && Update.image == std::vector<uint8_t>(release.firmware.begin(), release.firmware.end()));
+  CHECK(run.firmwareRequests.size() == 1);
+}
+
+void testDropAndResume() {
+  ReleaseServer release;
+  release.firmware = makeFirmware(400000);
+  release.publishedDigest = sha256Hex(release.firmware);
+  release.drops = 2;
+  release.dropAfter = 150000;
+  const Run run = runUpdate(release);
+  CHECK(run.result == OtaUpdater::OK);
+  CHECK(Update.committed && Update.image == std::vector<uint8_t>(release.firmware.begin(), release.firmware.end()));
+  CHECK(Update.beginCalls == 1);
+  if (CHECK(run.firmwareRequests.size() == 3)) {
+    CHECK(run.firmwareRequests[0].header("Range").empty());
+    CHECK(run.firmwareRequests[1].header("Range") == "bytes=150000-");
+    CHECK(run.firmwareRequests[2].header("Range") == "bytes=300000-");
+  }
+}
+
+// The resume is answered with 200 and the whole image, the bytes already in flash must not be written again
+void testServerIgnoresRange() {
+  ReleaseServer release;
+  release.firmware = makeFirmware(250000);
+  release.publishedDigest = sha256Hex(release.firmware);
+  release.honourRange = false;
+  release.drops = 1;
+  release.dropAfter = 100000;
+  const Run run = runUpdate(release);
+  CHECK(run.result == OtaUpdater::OK);
+  CHECK(Update.committed && Update.image == std::vector<uint8_t>(release.firmware.begin(), release.firmware.end()));
+  if (CHECK(run.firmwareRequests.size() == 2)) {
+    CHECK(run.firmwareRequests[1].header("Range") == "bytes=100000-");
+  }
+}
+
+void testDigestMismatch() {
+  ReleaseServer release;
+  release.firmware = makeFirmware(200000);
+  release.publishedDigest = sha256Hex(release.firmware + "x");
+  const Run run = runUpdate(release);
+  CHECK(run.result == OtaUpdater::CHECKSUM_ERROR);
+  CHECK(Update.endCalls == 0 && !Update.committed);
+  CHECK(Update.abortCalls > 0 && !Update.isRunning());
+}
+
+// A resumed range that doesn't continue the same image is caught by the digest over all flashed bytes
+void testCorruptResumeRejected() {
+  ReleaseServer release;
+  release.firmware = makeFirmware(200000);
+  release.publishedDigest = sha256Hex(release.firmware);
+  release.drops = 1;
+  release.dropAfter = 50000;
+  release.corruptRanges = true;
+  const Run run = runUpdate(release);
+  CHECK(run.result == OtaUpdater::CHECKSUM_ERROR);
+  CHECK(run.firmwareRequests.size() == 2);
+  CHECK(Update.endCalls == 0 && !Update.committed);
+  CHECK(Update.abortCalls > 0);
+}
+}  // namespace
+
+int main() {
+  testSha256();
+  testInstall();
+  testDropAndResume();
+  testServerIgnoresRange();
+  testDigestMismatch();
+  testCorruptResumeRejected();
+  return check::result("ota_updater_test");
+}
@@ -0,0 +1,103 @@
+#pragma once
+// Pages of real book text laid out the way the reader places words, for the renderer tests and benchmarks
+
+#include <GfxRenderer.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace page_text {
+// The opening of A Tale of Two Cities, with a few words the fonts have no glyph for
+constexpr const char* DICKENS =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, it "
+    "was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way—in short, the period "
+    "was so far like the present period, that some of its noisiest authorities insisted on its being received, for "
+    "good or for evil, in the superlative degree of comparison only. "
+    "There were a king with a large jaw and a queen with a plain face, on the throne of England; there were a king "
+    "with a large jaw and a queen with a fair face, on the throne of France. In both countries it was clearer than "
+    "crystal to the lords of the State preserves of loaves and fishes, that things in general were settled for ever. "
+    "It was the year of Our Lord one thousand seven hundred and seventy-five. Spiritual revelations were conceded to "
+    "England at that favoured period, as at this. Mrs. Southcott had recently attained her five-and-twentieth blessed "
+    "birthday, of whom a prophetic private in the Life Guards had heralded the sublime appearance by announcing that "
+    "arrangements were made for the swallowing up of London and Westminster. Even the Cock-lane ghost had been laid "
+    "only a round dozen of years, after rapping out its messages, as the spirits of this very year last past "
+    "(supernaturally deficient in originality) rapped out theirs. Mere messages in the earthly order of events had "
+    "lately come to the English Crown and People, from a congress of British subjects in America: which, strange to "
+    "relate, have proved more important to the human race than any communications yet received through any of the "
+    "chickens of the Cock-lane brood. "
+    "France, less favoured on the whole as to matters spiritual than her sister of the shield and trident, rolled "
+    "with exceeding smoothness down hill, making paper money and spending it. Under the guidance of her Christian "
+    "pastors, she entertained herself, besides, with such humane achievements as sentencing a youth to have his "
+    "hands cut off, his tongue torn out with pincers, and his body burned alive, because he had not kneeled down in "
+    "the rain to do honour to a dirty procession of monks which passed within his view, at a distance of some fifty "
+    "or sixty yards. It is likely enough that, rooted in the woods of France and Norway, there were growing trees, "
+    "when that sufferer was put to death, already marked by the Woodman, Fate, to come down and be sawn into boards, "
+    "to make a certain movable framework with a sack and a knife in it, terrible in history. “C’est la "
+    "vie,” said the café owner 书 naïvely.";
+
+struct PlacedWord {
+  int x;
+  int y;
+  std::string text;
+  EpdFontFamily::Style style;
+};
+using Page = std::vector<PlacedWord>;
+
+inline std::vector<std::string> splitWords(const std::string& text) {
+  std::vector<std::string> words;
+  std::istringstream stream(text);
+  std::string word;
+  while (stream >> word) {
+    words.push_back(word);
+  }
+  return words;
+}
+
+// Some words in other styles, like a chapter's emphasis
+inline EpdFontFamily::Style styleOf(const size_t wordIndex) {
+  if (wordIndex % 29 == 0) {
+    return EpdFontFamily::BOLD_ITALIC;
+  }
+  if (wordIndex % 17 == 3) {
+    return EpdFontFamily::BOLD;
+  }
+  if (wordIndex % 11 == 5) {
+    return EpdFontFamily::ITALIC;
+  }
+  return EpdFontFamily::REGULAR;
+}
+
+// Greedy line breaking within the viewable area, ragged right
+inline std::vector<Page> layoutPages(const GfxRenderer& renderer, const int fontId,
+                                     const std::vector<std::string>& words) {
+  int top, right, bottom, left;
+  renderer.getOrientedViewableTRBL(&top, &right, &bottom, &left);
+  const int maxX = renderer.getScreenWidth() - right;
+  const int maxY = renderer.getScreenHeight() - bottom;
+  const int lineHeight = renderer.getLineHeight(fontId);
+  const int spaceWidth = renderer.getSpaceWidth(fontId);
+
+  std::vector<Page> pages(1);
+  int x = left;
+  int y = top;
+  for (size_t i = 0; i < words.size(); i++) {
+    const EpdFontFamily::Style style = styleOf(i);
+    const int width = renderer.getTextWidth(fontId, words[i].c_str(), style);
+    if (x > left && x + width > maxX) {
+      x = left;
+      y += lineHeight;
+    }
+    if (y + lineHeight > maxY) {
+      pages.emplace_back();
+      x = left;
+      y = top;
+    }
+    pages.back().push_back({x, y, words[i], style});
+    x += width + spaceWidth;
+  }
+  return pages;
+}
+}  // namespace page_text
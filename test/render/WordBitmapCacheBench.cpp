@@ -0,0 +1,91 @@
+// Reading a book page after page, with every word drawn glyph by glyph (drawText) against drawn through the word
+// bitmap cache (drawWord). The book is the opening of A Tale of Two Cities followed by the repository's documentation,
+// or the files given on the command line (e.g. chapters unzipped from an EPUB), laid out in Bookerly 14.
+//
+//   word_bitmap_cache_bench [chapter.xhtml ...]
+
+#include <GfxRenderer.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "../common/TextFile.h"
+#include "PageText.h"
+
+namespace {
+constexpr int BOOKERLY_14 = 1;
+
+EpdFont bookerly14Regular(&bookerly_14_regular);
+EpdFont bookerly14Bold(&bookerly_14_bold);
+EpdFont bookerly14Italic(&bookerly_14_italic);
+EpdFont bookerly14BoldItalic(&bookerly_14_bolditalic);
+
+struct Result {
+  double microsPerPage = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  size_t usedBytes = 0;
+};
+
+// Best of a few reads of the whole book, each with a new renderer so the cache starts cold like after opening a book
+Result readBook(const std::string& text, const GfxRenderer::Orientation orientation, const bool cached) {
+  Result result;
+  for (int run = 0; run < 5; run++) {
+    EInkDisplay display;
+    GfxRenderer renderer(display);
+    renderer.insertFont(BOOKERLY_14,
+                        EpdFontFamily(&bookerly14Regular, &bookerly14Bold, &bookerly14Italic, &bookerly14BoldItalic));
+    renderer.setOrientation(orientation);
+    const auto pages = page_text::layoutPages(renderer, BOOKERLY_14, page_text::splitWords(text));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& page : pages) {
+      renderer.clearScreen();
+      for (const auto& word : page) {
+        if (cached) {
+          renderer.drawWord(BOOKERLY_14, word.x, word.y, word.text.c_str(), word.style);
+        } else {
+          renderer.drawText(BOOKERLY_14, word.x, word.y, word.text.c_str(), true, word.style);
+        }
+      }
+    }
+    const double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    const double perPage = micros / static_cast<double>(pages.size());
+    if (run == 0 || perPage < result.microsPerPage) {
+      result.microsPerPage = perPage;
+    }
+    result.hits = renderer.getWordCache().getHits();
+    result.misses = renderer.getWordCache().getMisses();
+    result.usedBytes = renderer.getWordCache().getUsedBytes();
+  }
+  return result;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  std::string text;
+  for (int i = 1; i < argc; i++) {
+    text += text_file::read(argv[i]);
+    text += '\n';
+  }
+  if (text.empty()) {
+    text = std::string(page_text::DICKENS) + "\n" + text_file::readDocs();
+  }
+
+  printf("%zu words, cache budget %zu bytes\n", page_text::splitWords(text).size(), WordBitmapCache::MAX_BYTES);
+  printf("%-26s %10s %10s %8s %9s %10s\n", "orientation", "drawText", "drawWord", "saving", "hit rate", "cache");
+  for (const auto orientation : {GfxRenderer::Portrait, GfxRenderer::LandscapeCounterClockwise}) {
+    const Result glyphs = readBook(text, orientation, false);
+    const Result words = readBook(text, orientation, true);
+    printf("%-26s %7.0f us %7.0f us %7.0f%% %8.1f%% %8zu B\n",
+           orientation == GfxRenderer::Portrait ? "Portrait" : "LandscapeCounterClockwise", glyphs.microsPerPage,
+           words.microsPerPage, 100.0 * (1.0 - words.microsPerPage / glyphs.microsPerPage),
+           100.0 * words.hits / (words.hits + words.misses), words.usedBytes);
+  }
+  return 0;
+}
@@ -0,0 +1,144 @@
+// Words drawn from the word bitmap cache must leave the frame buffer exactly as drawing them glyph by glyph does, in
+// every orientation, for 2-bit and 1-bit fonts, whether the word was just rasterized or came from the cache.
+
+#include <GfxRenderer.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/ubuntu_10_bold.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+
+#include <cstdlib>
+
+#include "../common/Check.h"
+#include "PageText.h"
+
+namespace {
+constexpr int BOOKERLY_14 = 1;
+constexpr int UBUNTU_10 = 2;
+
+EpdFont bookerly14Regular(&bookerly_14_regular);
+EpdFont bookerly14Bold(&bookerly_14_bold);
+EpdFont bookerly14Italic(&bookerly_14_italic);
+EpdFont bookerly14BoldItalic(&bookerly_14_bolditalic);
+EpdFont ubuntu10Regular(&ubuntu_10_regular);
+EpdFont ubuntu10Bold(&ubuntu_10_bold);
+
+const char* orientationName(const GfxRenderer::Orientation orientation) {
+  switch (orientation) {
+    case GfxRenderer::Portrait:
+      return "Portrait";
+    case GfxRenderer::LandscapeClockwise:
+      return "LandscapeClockwise";
+    case GfxRenderer::PortraitInverted:
+      return "PortraitInverted";
+    case GfxRenderer::LandscapeCounterClockwise:
+      return "LandscapeCounterClockwise";
+  }
+  return "?";
+}
+
+void insertFonts(GfxRenderer& renderer) {
+  renderer.insertFont(BOOKERLY_14,
+                      EpdFontFamily(&bookerly14Regular, &bookerly14Bold, &bookerly14Italic, &bookerly14BoldItalic));
+  renderer.insertFont(UBUNTU_10, EpdFontFamily(&ubuntu10Regular, &ubuntu10Bold));
+}
+
+bool sameFrame(EInkDisplay& glyphDisplay, EInkDisplay& wordDisplay) {
+  return memcmp(glyphDisplay.getFrameBuffer(), wordDisplay.getFrameBuffer(), EInkDisplay::BUFFER_SIZE) == 0;
+}
+
+// One renderer pair through all orientations, so strips cached for the previous orientation would show up here
+void testPages(GfxRenderer& glyphs, EInkDisplay& glyphDisplay, GfxRenderer& words, EInkDisplay& wordDisplay,
+               const GfxRenderer::Orientation orientation, const int fontId) {
+  glyphs.setOrientation(orientation);
+  words.setOrientation(orientation);
+  const auto pages = page_text::layoutPages(words, fontId, page_text::splitWords(page_text::DICKENS));
+
+  // Each page is drawn twice: the words missed the first time come from the cache the second
+  for (int pass = 0; pass < 2; pass++) {
+    for (size_t page = 0; page < pages.size(); page++) {
+      glyphs.clearScreen();
+      words.clearScreen();
+      for (const auto& word : pages[page]) {
+        glyphs.drawText(fontId, word.x, word.y, word.text.c_str(), true, word.style);
+        words.drawWord(fontId, word.x, word.y, word.text.c_str(), word.style);
+      }
+      if (!CHECK(sameFrame(glyphDisplay, wordDisplay))) {
+        fprintf(stderr, "  font %d, %s, page %zu, pass %d\n", fontId, orientationName(orientation), page, pass);
+      }
+    }
+  }
+
+  // Words hanging off each edge go glyph by glyph, what's on the panel must still match
+  glyphs.clearScreen();
+  words.clearScreen();
+  const int width = glyphs.getScreenWidth();
+  const int height = glyphs.getScreenHeight();
+  const int ascender = glyphs.getFontAscenderSize(fontId);
+  const struct {
+    int x;
+    int y;
+  } edges[] = {{-6, 100}, {width - 20, 100}, {100, -ascender + 4}, {100, height - ascender - 2}};
+  for (const auto& edge : edges) {
+    glyphs.drawText(fontId, edge.x, edge.y, "Westminster", true);
+    words.drawWord(fontId, edge.x, edge.y, "Westminster");
+  }
+  if (!CHECK(sameFrame(glyphDisplay, wordDisplay))) {
+    fprintf(stderr, "  font %d, %s, words off the edges\n", fontId, orientationName(orientation));
+  }
+}
+
+// The pages above were drawn from cached strips, within the budget
+void testCache(const GfxRenderer& words) {
+  const WordBitmapCache& cache = words.getWordCache();
+  CHECK(cache.getHits() > 0);
+  CHECK(cache.getUsedBytes() <= WordBitmapCache::MAX_BYTES);
+}
+
+// A page full of distinct words overflows the cache, evicted words are drawn again from the glyphs
+void testEviction(GfxRenderer& glyphs, EInkDisplay& glyphDisplay, GfxRenderer& words, EInkDisplay& wordDisplay) {
+  glyphs.setOrientation(GfxRenderer::Portrait);
+  words.setOrientation(GfxRenderer::Portrait);
+  std::string text;
+  for (int i = 0; i < 3000; i++) {
+    text += "w" + std::to_string(i * 7919) + " ";
+  }
+  const auto pages = page_text::layoutPages(words, BOOKERLY_14, page_text::splitWords(text));
+  for (int pass = 0; pass < 2; pass++) {
+    for (const auto& page : pages) {
+      glyphs.clearScreen();
+      words.clearScreen();
+      for (const auto& word : page) {
+        glyphs.drawText(BOOKERLY_14, word.x, word.y, word.text.c_str(), true, word.style);
+        words.drawWord(BOOKERLY_14, word.x, word.y, word.text.c_str(), word.style);
+      }
+      CHECK(sameFrame(glyphDisplay, wordDisplay));
+      CHECK(words.getWordCache().getUsedBytes() <= WordBitmapCache::MAX_BYTES);
+    }
+  }
+}
+}  // namespace
+
+int main() {
+  // drawText logs every pixel that falls off the panel
+  setenv("CROSSPOINT_QUIET", "1", 0);
+
+  EInkDisplay glyphDisplay;
+  EInkDisplay wordDisplay;
+  GfxRenderer glyphs(glyphDisplay);
+  GfxRenderer words(wordDisplay);
+  insertFonts(glyphs);
+  insertFonts(words);
+
+  for (const int fontId : {BOOKERLY_14, UBUNTU_10}) {
+    for (const auto orientation : {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                   GfxRenderer::PortraitInverted, GfxRenderer::LandscapeCounterClockwise}) {
+      testPages(glyphs, glyphDisplay, words, wordDisplay, orientation, fontId);
+    }
+  }
+  testCache(words);
+  testEviction(glyphs, glyphDisplay, words, wordDisplay);
+  return check::result("word_bitmap_cache_test");
+}
@@ -0,0 +1,140 @@
+// Cost of opening a book's cache on FAT, before and after BookCacheMigration shards the caches. FAT finds a name by
+// reading its directory's 32-byte entries in order, so the cost is the entries read along the path, counted from the
+// listings of a library on a temp dir SD card. Fails if a legacy folder doesn't end up where
+// FsHelpers::bookCachePath looks for it.
+//
+//   book_cache_bench [books ...]
+
+#include <BookCacheMigration.h>
+#include <FsHelpers.h>
+#include <SDCardManager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr const char* CACHE_DIR = "/.crosspoint";
+
+// Entries a name takes: the short entry, plus a long name entry per 13 characters unless it fits 8.3 as it is
+size_t fatEntries(const std::string& name) {
+  const size_t dot = name.find('.');
+  const size_t baseLength = dot == std::string::npos ? name.size() : dot;
+  const size_t extensionLength = dot == std::string::npos ? 0 : name.size() - dot - 1;
+  bool shortName = baseLength > 0 && baseLength <= 8 && extensionLength <= 3 &&
+                   (dot == std::string::npos || name.find('.', dot + 1) == std::string::npos);
+  for (const char c : name) {
+    shortName = shortName && ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '.');
+  }
+  return 1 + (shortName ? 0 : (name.size() + 12) / 13);
+}
+
+// Entries read to find name in directory, "." and ".." come first in every folder below the root
+size_t lookupCost(const std::string& directory, const std::string& name) {
+  FsFile dir = SdMan.open(directory.c_str());
+  size_t cost = 2;
+  char entryName[256];
+  while (FsFile entry = dir.openNextFile()) {
+    entry.getName(entryName, sizeof(entryName));
+    cost += fatEntries(entryName);
+    if (name == entryName) {
+      return cost;
+    }
+  }
+  return cost;
+}
+
+// Entries read to open path, from the cache folder down
+size_t openCost(const std::string& path) {
+  size_t cost = 0;
+  size_t start = strlen(CACHE_DIR);
+  while (start < path.size()) {
+    const size_t end = std::min(path.find('/', start + 1), path.size());
+    cost += lookupCost(path.substr(0, start), path.substr(start + 1, end - start - 1));
+    start = end;
+  }
+  return cost;
+}
+
+bool measure(const size_t bookCount) {
+  const std::string sdRoot = host::makeTempSdRoot();
+  host::setSdRoot(sdRoot);
+  SdMan.mkdir(CACHE_DIR);
+  for (const char* file : {"/settings.bin", "/state.bin", "/recent.bin", "/wifi.bin"}) {
+    FsFile(SdMan.open((std::string(CACHE_DIR) + file).c_str(), O_RDWR | O_CREAT));
+  }
+
+  std::vector<std::string> books;
+  for (size_t i = 0; i < bookCount; i++) {
+    const bool comic = i % 10 == 9;
+    books.push_back("/Books/Author " + std::to_string(i % 97) + "/Title " + std::to_string(i) +
+                    (comic ? ".xtc" : ".epub"));
+    const std::string legacy = std::string(CACHE_DIR) + (comic ? "/xtc_" : "/epub_") +
+                               std::to_string(std::hash<std::string>{}(books.back()));
+    SdMan.mkdir(legacy.c_str());
+    FsFile file = SdMan.open((legacy + "/book.bin").c_str(), O_RDWR | O_CREAT);
+    file.write(books.back().data(), books.back().size());
+  }
+
+  // Sampled, each lookup lists the directory
+  const size_t step = std::max<size_t>(1, bookCount / 200);
+  size_t flatCost = 0;
+  size_t samples = 0;
+  for (size_t i = 0; i < bookCount; i += step, samples++) {
+    const char* prefix = books[i].ends_with(".xtc") ? "/xtc_" : "/epub_";
+    flatCost += openCost(std::string(CACHE_DIR) + prefix + std::to_string(std::hash<std::string>{}(books[i])) +
+                         "/book.bin");
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const uint16_t moved = BookCacheMigration::run(CACHE_DIR);
+  const double millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  bool ok = moved == bookCount;
+  size_t shardedCost = 0;
+  for (size_t i = 0; i < bookCount; i++) {
+    const char* prefix = books[i].ends_with(".xtc") ? "xtc" : "epub";
+    const std::string path = FsHelpers::bookCachePath(CACHE_DIR, prefix, books[i]) + "/book.bin";
+    FsFile file = SdMan.open(path.c_str());
+    std::string contents(file ? file.size() : 0, '\0');
+    if (file) {
+      file.read(contents.data(), contents.size());
+    }
+    if (contents != books[i]) {
+      fprintf(stderr, "Cache of %s not at %s\n", books[i].c_str(), path.c_str());
+      ok = false;
+    }
+    if (i % step == 0) {
+      shardedCost += openCost(path);
+    }
+  }
+
+  printf("%7zu %9.0f %9.0f %12.0f\n", bookCount, static_cast<double>(flatCost) / samples,
+         static_cast<double>(shardedCost) / samples, millis);
+  std::filesystem::remove_all(sdRoot);
+  return ok;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  std::vector<size_t> sizes;
+  for (int i = 1; i < argc; i++) {
+    sizes.push_back(strtoul(argv[i], nullptr, 10));
+  }
+  if (sizes.empty()) {
+    sizes = {200, 1000, 5000, 20000};
+  }
+
+  printf("Entries read to open <cache>/book.bin, and the host time of the migration\n");
+  printf("%7s %9s %9s %12s\n", "books", "flat", "sharded", "migrate ms");
+  bool ok = true;
+  for (const size_t bookCount : sizes) {
+    ok = measure(bookCount) && ok;
+  }
+  return ok ? 0 : 1;
+}
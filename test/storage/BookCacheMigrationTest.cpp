@@ -0,0 +1,102 @@
+// BookCacheMigration on an SD card in a temp dir: every flat layout cache must end up where FsHelpers::bookCachePath
+// looks for it, with its files, and nothing else in the cache folder may be touched.
+
+#include <BookCacheMigration.h>
+#include <FsHelpers.h>
+#include <SDCardManager.h>
+
+#include <string>
+#include <vector>
+
+#include "../common/Check.h"
+
+namespace {
+constexpr const char* CACHE_DIR = "/.crosspoint";
+
+struct Book {
+  std::string path;
+  const char* prefix;
+};
+
+std::string legacyPath(const Book& book) {
+  return std::string(CACHE_DIR) + "/" + book.prefix + "_" + std::to_string(std::hash<std::string>{}(book.path));
+}
+
+void writeFile(const std::string& path, const std::string& contents) {
+  FsFile file = SdMan.open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC);
+  file.write(contents.data(), contents.size());
+}
+
+std::string readFile(const std::string& path) {
+  FsFile file = SdMan.open(path.c_str());
+  std::string contents(file ? file.size() : 0, '\0');
+  if (file) {
+    file.read(contents.data(), contents.size());
+  }
+  return contents;
+}
+
+void testMigration() {
+  host::setSdRoot(host::makeTempSdRoot());
+  SdMan.mkdir(CACHE_DIR);
+
+  std::vector<Book> books;
+  for (int i = 0; i < 300; i++) {
+    books.push_back({"/Books/Author " + std::to_string(i % 17) + "/Title " + std::to_string(i) + ".epub", "epub"});
+  }
+  for (int i = 0; i < 20; i++) {
+    books.push_back({"/Comics/Issue " + std::to_string(i) + ".xtc", "xtc"});
+  }
+  for (const auto& book : books) {
+    SdMan.mkdir(legacyPath(book).c_str());
+    writeFile(legacyPath(book) + "/progress.bin", book.path);
+  }
+
+  // Rebuilt by firmware that already used the new layout, the new cache is the one to keep
+  const Book& rebuilt = books[7];
+  const std::string rebuiltPath = FsHelpers::bookCachePath(CACHE_DIR, rebuilt.prefix, rebuilt.path);
+  SdMan.mkdir(rebuiltPath.c_str());
+  writeFile(rebuiltPath + "/progress.bin", "rebuilt");
+
+  // Not caches of the flat layout
+  const std::vector<std::string> others = {"/epub_123.bin", "/epub_", "/epub_12x", "/epub_abc", "/xtc", "/cover_1"};
+  writeFile(std::string(CACHE_DIR) + "/settings.bin", "settings");
+  writeFile(std::string(CACHE_DIR) + "/epub_42", "a file, not a folder");
+  for (const auto& other : others) {
+    SdMan.mkdir((CACHE_DIR + other).c_str());
+  }
+
+  CHECK(BookCacheMigration::hasWork(CACHE_DIR));
+  CHECK(BookCacheMigration::run(CACHE_DIR) == books.size());
+  CHECK(!BookCacheMigration::hasWork(CACHE_DIR));
+  CHECK(BookCacheMigration::run(CACHE_DIR) == 0);
+
+  for (const auto& book : books) {
+    const std::string path = FsHelpers::bookCachePath(CACHE_DIR, book.prefix, book.path);
+    const std::string expected = &book == &rebuilt ? "rebuilt" : book.path;
+    if (!CHECK(readFile(path + "/progress.bin") == expected)) {
+      fprintf(stderr, "  %s not at %s\n", book.path.c_str(), path.c_str());
+    }
+    CHECK(!SdMan.exists(legacyPath(book).c_str()));
+  }
+  CHECK(readFile(std::string(CACHE_DIR) + "/settings.bin") == "settings");
+  CHECK(readFile(std::string(CACHE_DIR) + "/epub_42") == "a file, not a folder");
+  for (const auto& other : others) {
+    CHECK(SdMan.exists((CACHE_DIR + other).c_str()));
+  }
+}
+
+// A card without a cache folder yet, as on first boot
+void testNoCacheDir() {
+  host::setSdRoot(host::makeTempSdRoot());
+  CHECK(!BookCacheMigration::hasWork(CACHE_DIR));
+  CHECK(BookCacheMigration::run(CACHE_DIR) == 0);
+  CHECK(!SdMan.exists(CACHE_DIR));
+}
+}  // namespace
+
+int main() {
+  testMigration();
+  testNoCacheDir();
+  return check::result("book_cache_migration_test");
+}
@@ -0,0 +1,74 @@
+#include <Arduino.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+HardwareSerial Serial;
+
+namespace {
+const auto start = std::chrono::steady_clock::now();
+bool fakeClock = false;
+uint32_t cpuMhz = 160;
+unsigned long fakeMillis = 0;
+
+bool quiet() {
+  static const bool value = std::getenv("CROSSPOINT_QUIET") != nullptr;
+  return value;
+}
+}  // namespace
+
+unsigned long millis() {
+  if (fakeClock) {
+    return fakeMillis;
+  }
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+unsigned long micros() {
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+// On the fake clock waits take no time beyond a millisecond, so backoffs don't slow tests down while polling loops
+// still give a server thread time to answer
+void delay(const unsigned long ms) {
+  if (fakeClock) {
+    fakeMillis += ms;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(fakeClock ? std::min(ms, 1UL) : ms));
+}
+
+uint32_t getCpuFrequencyMhz() { return cpuMhz; }
+
+bool setCpuFrequencyMhz(const uint32_t mhz) {
+  cpuMhz = mhz;
+  return true;
+}
+
+void host::setMillis(const unsigned long value) {
+  fakeClock = true;
+  fakeMillis = value;
+}
+
+void host::advanceMillis(const unsigned long ms) { setMillis(fakeMillis + ms); }
+
+size_t HardwareSerial::write(const uint8_t c) {
+  if (!quiet()) {
+    fputc(c, stderr);
+  }
+  return 1;
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+  if (quiet()) {
+    return 0;
+  }
+  va_list args;
+  va_start(args, format);
+  const int written = vfprintf(stderr, format, args);
+  va_end(args);
+  return written > 0 ? written : 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+// Host stand-in for the parts of the Arduino core the tested libraries use
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "HardwareSerial.h"
+#include "Stream.h"
+#include "WString.h"
+
+// Milliseconds since the start of the program, or the fake clock once a test set it
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t mhz);
+
+namespace host {
+// Makes millis() return value from now on and delay() only advance it, tests use it to run time dependent code
+// deterministically
+void setMillis(unsigned long value);
+void advanceMillis(unsigned long ms);
+}  // namespace host
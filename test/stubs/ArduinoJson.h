@@ -0,0 +1,229 @@
+#pragma once
+// The part of ArduinoJson 7 that OtaUpdater::checkForUpdate() uses, a plain DOM parsed from the whole stream. Filters
+// are accepted and ignored, the test server only sends what the filter would keep anyway.
+
+#include <Stream.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace json {
+struct Node {
+  enum Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT } type = NUL;
+  bool boolean = false;
+  double number = 0;
+  std::string string;
+  std::vector<std::shared_ptr<Node>> elements;
+  std::vector<std::pair<std::string, std::shared_ptr<Node>>> members;
+};
+
+bool parse(const std::string& text, size_t& position, Node& node);
+}  // namespace json
+
+class JsonArray {};
+
+class JsonVariant {
+ protected:
+  std::shared_ptr<json::Node> node;
+
+ public:
+  explicit JsonVariant(std::shared_ptr<json::Node> node) : node(std::move(node)) {}
+
+  // Members and elements are created when missing, as writing a filter needs
+  JsonVariant operator[](const char* key) const {
+    if (node->type != json::Node::OBJECT) {
+      *node = json::Node();
+      node->type = json::Node::OBJECT;
+    }
+    for (auto& [name, value] : node->members) {
+      if (name == key) {
+        return JsonVariant(value);
+      }
+    }
+    node->members.emplace_back(key, std::make_shared<json::Node>());
+    return JsonVariant(node->members.back().second);
+  }
+
+  JsonVariant operator[](const int index) const {
+    if (node->type != json::Node::ARRAY) {
+      *node = json::Node();
+      node->type = json::Node::ARRAY;
+    }
+    while (node->elements.size() <= static_cast<size_t>(index)) {
+      node->elements.push_back(std::make_shared<json::Node>());
+    }
+    return JsonVariant(node->elements[index]);
+  }
+
+  JsonVariant& operator=(const bool value) {
+    node->type = json::Node::BOOLEAN;
+    node->boolean = value;
+    return *this;
+  }
+
+  template <typename T>
+  bool is() const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return node->type == json::Node::STRING;
+    } else if constexpr (std::is_same_v<T, JsonArray>) {
+      return node->type == json::Node::ARRAY;
+    } else {
+      return node->type == json::Node::NUMBER;
+    }
+  }
+
+  template <typename T>
+  T as() const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return node->type == json::Node::STRING ? node->string : std::string();
+    } else {
+      return node->type == json::Node::NUMBER ? static_cast<T>(node->number) : T();
+    }
+  }
+
+  size_t size() const {
+    return node->type == json::Node::ARRAY ? node->elements.size()
+                                           : node->type == json::Node::OBJECT ? node->members.size() : 0;
+  }
+
+  bool operator==(const char* value) const { return node->type == json::Node::STRING && node->string == value; }
+};
+
+class JsonDocument : public JsonVariant {
+ public:
+  JsonDocument() : JsonVariant(std::make_shared<json::Node>()) {}
+  json::Node& root() { return *node; }
+};
+
+class DeserializationError {
+  const char* message;
+
+ public:
+  explicit DeserializationError(const char* message = nullptr) : message(message) {}
+  explicit operator bool() const { return message != nullptr; }
+  const char* c_str() const { return message ? message : "Ok"; }
+};
+
+namespace DeserializationOption {
+struct Filter {
+  explicit Filter(const JsonDocument&) {}
+};
+}  // namespace DeserializationOption
+
+inline DeserializationError deserializeJson(JsonDocument& doc, Stream& input, DeserializationOption::Filter) {
+  std::string text;
+  int c;
+  while ((c = input.read()) >= 0) {
+    text += static_cast<char>(c);
+  }
+  size_t position = 0;
+  return json::parse(text, position, doc.root()) ? DeserializationError() : DeserializationError("InvalidInput");
+}
+
+inline bool json::parse(const std::string& text, size_t& position, Node& node) {
+  const auto skipSpace = [&] {
+    while (position < text.size() && isspace(static_cast<unsigned char>(text[position]))) {
+      position++;
+    }
+  };
+  const auto parseString = [&](std::string& out) {
+    if (text[position++] != '"') {
+      return false;
+    }
+    while (position < text.size() && text[position] != '"') {
+      if (text[position] == '\\' && position + 1 < text.size()) {
+        position++;
+      }
+      out += text[position++];
+    }
+    return position++ < text.size();
+  };
+
+  skipSpace();
+  if (position >= text.size()) {
+    return false;
+  }
+  const char c = text[position];
+  if (c == '{') {
+    node.type = Node::OBJECT;
+    position++;
+    skipSpace();
+    if (position < text.size() && text[position] == '}') {
+      position++;
+      return true;
+    }
+    while (true) {
+      skipSpace();
+      std::string key;
+      if (position >= text.size() || !parseString(key)) {
+        return false;
+      }
+      skipSpace();
+      if (position >= text.size() || text[position++] != ':') {
+        return false;
+      }
+      auto value = std::make_shared<Node>();
+      if (!parse(text, position, *value)) {
+        return false;
+      }
+      node.members.emplace_back(key, value);
+      skipSpace();
+      if (position < text.size() && text[position] == ',') {
+        position++;
+        continue;
+      }
+      return position < text.size() && text[position++] == '}';
+    }
+  }
+  if (c == '[') {
+    node.type = Node::ARRAY;
+    position++;
+    skipSpace();
+    if (position < text.size() && text[position] == ']') {
+      position++;
+      return true;
+    }
+    while (true) {
+      auto value = std::make_shared<Node>();
+      if (!parse(text, position, *value)) {
+        return false;
+      }
+      node.elements.push_back(value);
+      skipSpace();
+      if (position < text.size() && text[position] == ',') {
+        position++;
+        continue;
+      }
+      return position < text.size() && text[position++] == ']';
+    }
+  }
+  if (c == '"') {
+    node.type = Node::STRING;
+    return parseString(node.string);
+  }
+  for (const auto& [word, type, value] : {std::tuple{"true", Node::BOOLEAN, true},
+                                          std::tuple{"false", Node::BOOLEAN, false},
+                                          std::tuple{"null", Node::NUL, false}}) {
+    if (text.compare(position, strlen(word), word) == 0) {
+      node.type = type;
+      node.boolean = value;
+      position += strlen(word);
+      return true;
+    }
+  }
+  char* end = nullptr;
+  node.number = strtod(text.c_str() + position, &end);
+  if (end == text.c_str() + position) {
+    return false;
+  }
+  node.type = Node::NUMBER;
+  position = end - text.c_str();
+  return true;
+}
@@ -0,0 +1,35 @@
+#pragma once
+// Display stand-in: a frame buffer in memory, refreshes do nothing but count
+
+#include <Arduino.h>
+
+#include <vector>
+
+class EInkDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+  static constexpr int DISPLAY_WIDTH = 800;
+  static constexpr int DISPLAY_HEIGHT = 480;
+  static constexpr int DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr size_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  EInkDisplay(int = 0, int = 0, int = 0, int = 0, int = 0, int = 0) : frameBuffer(BUFFER_SIZE, 0xFF) {}
+  void begin() {}
+  void clearScreen(const uint8_t color = 0xFF) { frameBuffer.assign(BUFFER_SIZE, color); }
+  void drawImage(const uint8_t*, int, int, int, int, bool = false) const {}
+  void displayBuffer(RefreshMode = FAST_REFRESH) { refreshes++; }
+  void displayWindow(int, int, int, int) { refreshes++; }
+  void displayGrayBuffer() { refreshes++; }
+  void copyGrayscaleLsbBuffers(const uint8_t*) {}
+  void copyGrayscaleMsbBuffers(const uint8_t*) {}
+  void copyGrayscaleBuffers(const uint8_t*, const uint8_t*) {}
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+  void grayscaleRevert() {}
+  uint8_t* getFrameBuffer() { return frameBuffer.data(); }
+  void deepSleep() {}
+
+  int refreshes = 0;
+
+ private:
+  std::vector<uint8_t> frameBuffer;
+};
@@ -0,0 +1,51 @@
+#pragma once
+// HTTP/1.0 client with the interface of the ESP32 HTTPClient, requests go to the host the URL names or, once a test
+// called host::routeHttpTo(), to the local test server whatever the URL
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "WiFiClient.h"
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_PARTIAL_CONTENT 206
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTP_CODE_RANGE_NOT_SATISFIABLE 416
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+
+enum followRedirects_t { HTTPC_DISABLE_FOLLOW_REDIRECTS, HTTPC_STRICT_FOLLOW_REDIRECTS, HTTPC_FORCE_FOLLOW_REDIRECTS };
+
+class HTTPClient {
+  WiFiClient* client = nullptr;
+  std::string host;
+  uint16_t port = 80;
+  std::string path;
+  std::vector<std::pair<std::string, std::string>> requestHeaders;
+  std::vector<std::string> collectedKeys;
+  std::vector<std::pair<std::string, std::string>> responseHeaders;
+  int size = -1;
+
+ public:
+  bool begin(WiFiClient& client, const char* url);
+  void end();
+  void useHTTP10(bool = true) {}
+  void setFollowRedirects(followRedirects_t) {}
+  void setTimeout(uint16_t) {}
+  void addHeader(const String& name, const String& value);
+  // Only these response headers are kept for header(), as on the device
+  void collectHeaders(const char* headerKeys[], size_t count);
+
+  int GET();
+  // Content-Length of the response, -1 without one
+  int getSize() const { return size; }
+  String header(const char* name) const;
+  bool connected() { return client && client->connected(); }
+  WiFiClient* getStreamPtr() { return client; }
+  WiFiClient& getStream() { return *client; }
+};
+
+namespace host {
+void routeHttpTo(uint16_t port);
+}  // namespace host
@@ -0,0 +1,16 @@
+#pragma once
+#include <cstdarg>
+#include <cstdio>
+
+#include "Print.h"
+
+unsigned long millis();
+
+// Log lines go to stderr, set CROSSPOINT_QUIET to drop them (benchmarks do)
+class HardwareSerial : public Print {
+ public:
+  size_t write(uint8_t c) override;
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
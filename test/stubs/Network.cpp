@@ -0,0 +1,189 @@
+#include <HTTPClient.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <strings.h>
+
+namespace {
+constexpr int READ_TIMEOUT_MS = 1000;
+uint16_t routedPort = 0;
+
+bool waitReadable(const int fd, const int timeoutMs) {
+  pollfd descriptor = {fd, POLLIN, 0};
+  return poll(&descriptor, 1, timeoutMs) > 0;
+}
+}  // namespace
+
+void host::routeHttpTo(const uint16_t port) { routedPort = port; }
+
+int WiFiClient::connect(const char* host, const uint16_t port) {
+  stop();
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* addresses = nullptr;
+  if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &addresses) != 0) {
+    return 0;
+  }
+  fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd >= 0 && ::connect(fd, addresses->ai_addr, addresses->ai_addrlen) != 0) {
+    ::close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(addresses);
+  peerClosed = false;
+  return fd >= 0;
+}
+
+void WiFiClient::stop() {
+  if (fd >= 0) {
+    ::close(fd);
+    fd = -1;
+  }
+}
+
+uint8_t WiFiClient::connected() { return fd >= 0 && (available() > 0 || !peerClosed); }
+
+int WiFiClient::available() {
+  if (fd < 0) {
+    return 0;
+  }
+  int count = 0;
+  if (ioctl(fd, FIONREAD, &count) != 0) {
+    return 0;
+  }
+  if (count == 0 && !peerClosed) {
+    char c;
+    peerClosed = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 0;
+  }
+  return count;
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return readBytes(&c, 1) == 1 ? c : -1;
+}
+
+size_t WiFiClient::readBytes(uint8_t* buffer, const size_t length) {
+  size_t received = 0;
+  while (fd >= 0 && received < length && waitReadable(fd, READ_TIMEOUT_MS)) {
+    const ssize_t count = recv(fd, buffer + received, length - received, 0);
+    if (count <= 0) {
+      peerClosed = true;
+      break;
+    }
+    received += count;
+  }
+  return received;
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, const size_t size) {
+  size_t sent = 0;
+  while (fd >= 0 && sent < size) {
+    const ssize_t count = send(fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (count <= 0) {
+      break;
+    }
+    sent += count;
+  }
+  return sent;
+}
+
+bool HTTPClient::begin(WiFiClient& client, const char* url) {
+  this->client = &client;
+  requestHeaders.clear();
+  responseHeaders.clear();
+  size = -1;
+
+  std::string rest = url;
+  const auto scheme = rest.find("://");
+  port = rest.rfind("https", 0) == 0 ? 443 : 80;
+  if (scheme != std::string::npos) {
+    rest = rest.substr(scheme + 3);
+  }
+  const auto slash = rest.find('/');
+  host = rest.substr(0, slash);
+  path = slash == std::string::npos ? "/" : rest.substr(slash);
+  const auto colon = host.find(':');
+  if (colon != std::string::npos) {
+    port = static_cast<uint16_t>(atoi(host.c_str() + colon + 1));
+    host.resize(colon);
+  }
+  return true;
+}
+
+void HTTPClient::end() {
+  if (client) {
+    client->stop();
+  }
+}
+
+void HTTPClient::addHeader(const String& name, const String& value) {
+  requestHeaders.emplace_back(name.c_str(), value.c_str());
+}
+
+void HTTPClient::collectHeaders(const char* headerKeys[], const size_t count) {
+  collectedKeys.assign(headerKeys, headerKeys + count);
+}
+
+int HTTPClient::GET() {
+  if (!client->connect(routedPort ? "127.0.0.1" : host.c_str(), routedPort ? routedPort : port)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  std::string request = "GET " + path + " HTTP/1.0\r\nHost: " + host + "\r\nConnection: close\r\n";
+  for (const auto& [name, value] : requestHeaders) {
+    request += name + ": " + value + "\r\n";
+  }
+  request += "\r\n";
+  client->write(reinterpret_cast<const uint8_t*>(request.data()), request.size());
+
+  // Status line and headers, a byte at a time so nothing of the body is taken off the stream
+  std::string head;
+  while (head.size() < 4 || head.compare(head.size() - 4, 4, "\r\n\r\n") != 0) {
+    const int c = client->read();
+    if (c < 0) {
+      return HTTPC_ERROR_CONNECTION_LOST;
+    }
+    head += static_cast<char>(c);
+  }
+
+  const auto firstSpace = head.find(' ');
+  const int code = firstSpace == std::string::npos ? 0 : atoi(head.c_str() + firstSpace + 1);
+  size_t lineStart = head.find("\r\n") + 2;
+  while (lineStart < head.size() - 2) {
+    const auto lineEnd = head.find("\r\n", lineStart);
+    const auto line = head.substr(lineStart, lineEnd - lineStart);
+    lineStart = lineEnd + 2;
+    const auto colon = line.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    const auto name = line.substr(0, colon);
+    const auto valueStart = line.find_first_not_of(' ', colon + 1);
+    const auto value = valueStart == std::string::npos ? std::string() : line.substr(valueStart);
+    if (strcasecmp(name.c_str(), "Content-Length") == 0) {
+      size = atoi(value.c_str());
+    }
+    for (const auto& key : collectedKeys) {
+      if (strcasecmp(name.c_str(), key.c_str()) == 0) {
+        responseHeaders.emplace_back(key, value);
+      }
+    }
+  }
+  return code;
+}
+
+String HTTPClient::header(const char* name) const {
+  for (const auto& [key, value] : responseHeaders) {
+    if (strcasecmp(key.c_str(), name) == 0) {
+      return String(value);
+    }
+  }
+  return String();
+}
@@ -0,0 +1,27 @@
+#pragma once
+// SD card stand-in: paths are taken relative to a directory on the host, set with host::setSdRoot()
+
+#include <string>
+
+#include "SdFat.h"
+
+class SDCardManager {
+ public:
+  FsFile open(const char* path, int flags = O_RDONLY);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* from, const char* to);
+  bool mkdir(const char* path, bool parents = true);
+  // Removes the directory with everything in it
+  bool removeDir(const char* path);
+  bool openFileForRead(const char* tag, const std::string& path, FsFile& file);
+  bool openFileForWrite(const char* tag, const std::string& path, FsFile& file);
+};
+
+extern SDCardManager SdMan;
+
+namespace host {
+void setSdRoot(const std::string& directory);
+// A fresh empty directory for a test's SD card
+std::string makeTempSdRoot();
+}  // namespace host
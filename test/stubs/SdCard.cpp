@@ -0,0 +1,148 @@
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+SDCardManager SdMan;
+
+namespace {
+std::string root = ".";
+
+std::string hostPath(const char* path) { return root + (path[0] == '/' ? "" : "/") + path; }
+}  // namespace
+
+FsFile& FsFile::operator=(FsFile&& other) noexcept {
+  if (this != &other) {
+    close();
+    fd = other.fd;
+    listing = other.listing;
+    name = std::move(other.name);
+    other.fd = -1;
+    other.listing = nullptr;
+  }
+  return *this;
+}
+
+void FsFile::close() {
+  if (listing) {
+    closedir(listing);
+    listing = nullptr;
+  }
+  if (fd >= 0) {
+    ::close(fd);
+    fd = -1;
+  }
+}
+
+int FsFile::read(void* buffer, const size_t size) {
+  const ssize_t count = ::read(fd, buffer, size);
+  return count < 0 ? -1 : static_cast<int>(count);
+}
+
+int FsFile::read() {
+  uint8_t byte;
+  return read(&byte, 1) == 1 ? byte : -1;
+}
+
+size_t FsFile::write(const uint8_t* buffer, const size_t size) {
+  const ssize_t count = ::write(fd, buffer, size);
+  return count < 0 ? 0 : static_cast<size_t>(count);
+}
+
+bool FsFile::seekSet(const uint64_t position) { return lseek(fd, static_cast<off_t>(position), SEEK_SET) >= 0; }
+
+bool FsFile::seekCur(const int64_t offset) { return lseek(fd, static_cast<off_t>(offset), SEEK_CUR) >= 0; }
+
+bool FsFile::seekEnd() { return lseek(fd, 0, SEEK_END) >= 0; }
+
+uint64_t FsFile::position() const { return static_cast<uint64_t>(lseek(fd, 0, SEEK_CUR)); }
+
+uint64_t FsFile::size() const {
+  struct stat info = {};
+  return fstat(fd, &info) == 0 ? static_cast<uint64_t>(info.st_size) : 0;
+}
+
+bool FsFile::truncate(const uint64_t length) { return ftruncate(fd, static_cast<off_t>(length)) == 0; }
+
+bool FsFile::isDirectory() const {
+  struct stat info = {};
+  return fstat(fd, &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+FsFile FsFile::openNextFile() {
+  if (!listing) {
+    listing = fdopendir(dup(fd));
+    if (!listing) {
+      return {};
+    }
+  }
+  while (const dirent* entry = readdir(listing)) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      return {openat(fd, entry->d_name, O_RDONLY), entry->d_name};
+    }
+  }
+  return {};
+}
+
+size_t FsFile::getName(char* buffer, const size_t size) const {
+  if (name.size() + 1 > size) {
+    return 0;
+  }
+  memcpy(buffer, name.c_str(), name.size() + 1);
+  return name.size();
+}
+
+FsFile SDCardManager::open(const char* path, const int flags) {
+  const char* name = strrchr(path, '/');
+  return {::open(hostPath(path).c_str(), flags, 0644), name ? name + 1 : path};
+}
+
+bool SDCardManager::exists(const char* path) { return access(hostPath(path).c_str(), F_OK) == 0; }
+
+bool SDCardManager::remove(const char* path) { return ::unlink(hostPath(path).c_str()) == 0; }
+
+bool SDCardManager::rename(const char* from, const char* to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool SDCardManager::mkdir(const char* path, const bool parents) {
+  std::error_code error;
+  if (parents) {
+    return std::filesystem::create_directories(hostPath(path), error);
+  }
+  return std::filesystem::create_directory(hostPath(path), error);
+}
+
+bool SDCardManager::removeDir(const char* path) {
+  std::error_code error;
+  return std::filesystem::remove_all(hostPath(path), error) > 0;
+}
+
+bool SDCardManager::openFileForRead(const char* tag, const std::string& path, FsFile& file) {
+  file = open(path.c_str(), O_RDONLY);
+  if (!file) {
+    Serial.printf("[%lu] [%s] Could not open %s for reading\n", millis(), tag, path.c_str());
+  }
+  return static_cast<bool>(file);
+}
+
+bool SDCardManager::openFileForWrite(const char* tag, const std::string& path, FsFile& file) {
+  file = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC);
+  if (!file) {
+    Serial.printf("[%lu] [%s] Could not open %s for writing\n", millis(), tag, path.c_str());
+  }
+  return static_cast<bool>(file);
+}
+
+void host::setSdRoot(const std::string& directory) { root = directory; }
+
+std::string host::makeTempSdRoot() {
+  char pattern[] = "/tmp/crosspoint-sd-XXXXXX";
+  const char* directory = mkdtemp(pattern);
+  return directory ? directory : ".";
+}
@@ -0,0 +1,50 @@
+#pragma once
+// Files of the SD card stand-in, see SDCardManager.h
+
+#include <dirent.h>
+#include <fcntl.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class FsFile {
+  int fd = -1;
+  DIR* listing = nullptr;  // Opened by the first openNextFile() of a directory
+  std::string name;
+
+ public:
+  FsFile() = default;
+  FsFile(int fd, std::string name) : fd(fd), name(std::move(name)) {}
+  FsFile(const FsFile&) = delete;
+  FsFile& operator=(const FsFile&) = delete;
+  FsFile(FsFile&& other) noexcept : fd(other.fd), listing(other.listing), name(std::move(other.name)) {
+    other.fd = -1;
+    other.listing = nullptr;
+  }
+  FsFile& operator=(FsFile&& other) noexcept;
+  ~FsFile() { close(); }
+
+  explicit operator bool() const { return fd >= 0; }
+  void close();
+
+  int read(void* buffer, size_t size);
+  // The next byte, -1 at the end
+  int read();
+  size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const void* buffer, size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+  bool seekSet(uint64_t position);
+  bool seek(uint64_t position) { return seekSet(position); }
+  bool seekCur(int64_t offset);
+  bool seekEnd();
+  uint64_t position() const;
+  uint64_t size() const;
+  int available() const { return static_cast<int>(size() - position()); }
+  bool truncate(uint64_t length);
+
+  bool isDirectory() const;
+  // The next entry of a directory, skipping "." and "..", a closed file at the end
+  FsFile openNextFile();
+  // Length of the name copied, 0 if it doesn't fit
+  size_t getName(char* buffer, size_t size) const;
+};
@@ -0,0 +1,91 @@
+#include <mbedtls/sha256.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr uint32_t K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+uint32_t rotr(const uint32_t x, const int n) { return x >> n | x << (32 - n); }
+
+void transform(mbedtls_sha256_context* context, const uint8_t* block) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; i++) {
+    const uint8_t* word = block + i * 4;
+    w[i] = static_cast<uint32_t>(word[0]) << 24 | word[1] << 16 | word[2] << 8 | word[3];
+  }
+  for (int i = 16; i < 64; i++) {
+    const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ w[i - 15] >> 3;
+    const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ w[i - 2] >> 10;
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  uint32_t v[8];
+  memcpy(v, context->state, sizeof(v));
+  for (int i = 0; i < 64; i++) {
+    const uint32_t s1 = rotr(v[4], 6) ^ rotr(v[4], 11) ^ rotr(v[4], 25);
+    const uint32_t choice = (v[4] & v[5]) ^ (~v[4] & v[6]);
+    const uint32_t t1 = v[7] + s1 + choice + K[i] + w[i];
+    const uint32_t s0 = rotr(v[0], 2) ^ rotr(v[0], 13) ^ rotr(v[0], 22);
+    const uint32_t majority = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+    memmove(v + 1, v, 7 * sizeof(uint32_t));
+    v[4] += t1;
+    v[0] = t1 + s0 + majority;
+  }
+  for (int i = 0; i < 8; i++) {
+    context->state[i] += v[i];
+  }
+}
+}  // namespace
+
+void mbedtls_sha256_init(mbedtls_sha256_context* context) { memset(context, 0, sizeof(*context)); }
+
+void mbedtls_sha256_free(mbedtls_sha256_context* context) { memset(context, 0, sizeof(*context)); }
+
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context* context, int) {
+  static constexpr uint32_t INITIAL[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  memcpy(context->state, INITIAL, sizeof(INITIAL));
+  context->length = 0;
+  context->used = 0;
+  return 0;
+}
+
+int mbedtls_sha256_update_ret(mbedtls_sha256_context* context, const unsigned char* input, size_t length) {
+  context->length += length;
+  while (length > 0) {
+    const size_t take = std::min(length, sizeof(context->block) - context->used);
+    memcpy(context->block + context->used, input, take);
+    context->used += take;
+    input += take;
+    length -= take;
+    if (context->used == sizeof(context->block)) {
+      transform(context, context->block);
+      context->used = 0;
+    }
+  }
+  return 0;
+}
+
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context* context, unsigned char output[32]) {
+  const uint64_t bits = context->length * 8;
+  uint8_t padding[72] = {0x80};
+  const size_t padLength = (context->used < 56 ? 56 : 120) - context->used;
+  for (int i = 0; i < 8; i++) {
+    padding[padLength + i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+  }
+  mbedtls_sha256_update_ret(context, padding, padLength + 8);
+  for (int i = 0; i < 8; i++) {
+    for (int j = 0; j < 4; j++) {
+      output[i * 4 + j] = static_cast<uint8_t>(context->state[i] >> (24 - 8 * j));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include "Print.h"
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual size_t readBytes(uint8_t* buffer, size_t length) = 0;
+};
@@ -0,0 +1,37 @@
+#include <Update.h>
+
+UpdateClass Update;
+
+bool UpdateClass::begin(const size_t size) {
+  beginCalls++;
+  if (running) {
+    return false;
+  }
+  running = true;
+  expectedSize = size;
+  image.clear();
+  return true;
+}
+
+size_t UpdateClass::write(uint8_t* data, const size_t length) {
+  if (!running) {
+    return 0;
+  }
+  image.insert(image.end(), data, data + length);
+  return length;
+}
+
+bool UpdateClass::end(const bool evenIfRemaining) {
+  endCalls++;
+  if (!running || (!evenIfRemaining && image.size() != expectedSize)) {
+    return false;
+  }
+  running = false;
+  committed = true;
+  return true;
+}
+
+void UpdateClass::abort() {
+  abortCalls++;
+  running = false;
+}
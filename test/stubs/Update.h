@@ -0,0 +1,32 @@
+#pragma once
+// OTA flash writer stand-in, keeps the image in memory and records the calls so tests can check what was written
+// and whether the image was committed
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class UpdateClass {
+  bool running = false;
+  size_t expectedSize = 0;
+
+ public:
+  std::vector<uint8_t> image;
+  int beginCalls = 0;
+  int endCalls = 0;
+  int abortCalls = 0;
+  bool committed = false;
+
+  void reset() { *this = UpdateClass(); }
+
+  bool begin(size_t size);
+  size_t write(uint8_t* data, size_t length);
+  // Commits the image, fails unless exactly the size given to begin() was written
+  bool end(bool evenIfRemaining = false);
+  void abort();
+  bool isRunning() const { return running; }
+  bool isFinished() const { return committed; }
+  const char* errorString() const { return "host update error"; }
+};
+
+extern UpdateClass Update;
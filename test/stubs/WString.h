@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+
+// The few String members the networking code calls
+class String {
+  std::string value;
+
+ public:
+  String() = default;
+  String(const char* value) : value(value ? value : "") {}
+  String(std::string value) : value(std::move(value)) {}
+
+  const char* c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.size(); }
+  bool isEmpty() const { return value.empty(); }
+  int indexOf(const char c) const {
+    const auto position = value.find(c);
+    return position == std::string::npos ? -1 : static_cast<int>(position);
+  }
+  bool operator==(const char* other) const { return value == other; }
+};
@@ -0,0 +1,27 @@
+#pragma once
+// TCP client over a host socket, enough of the Arduino WiFiClient for HTTPClient and the code reading its stream
+
+#include <Arduino.h>
+
+class WiFiClient : public Stream {
+  int fd = -1;
+  bool peerClosed = false;
+
+ public:
+  WiFiClient() = default;
+  WiFiClient(const WiFiClient&) = delete;
+  WiFiClient& operator=(const WiFiClient&) = delete;
+  virtual ~WiFiClient() { stop(); }
+
+  int connect(const char* host, uint16_t port);
+  void stop();
+  // Like the Arduino client, a closed connection still counts as connected while received data is unread
+  uint8_t connected();
+
+  int available() override;
+  int read() override;
+  // Waits up to a second for length bytes
+  size_t readBytes(uint8_t* buffer, size_t length) override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override;
+};
@@ -0,0 +1,9 @@
+#pragma once
+// TLS isn't exercised on the host, https URLs are served by the local test server in plain http
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient {
+ public:
+  void setInsecure() {}
+};
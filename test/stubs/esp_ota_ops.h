@@ -0,0 +1,7 @@
+#pragma once
+#include "esp_partition.h"
+
+inline const esp_partition_t* esp_ota_get_running_partition() {
+  static const esp_partition_t running = {0x10000, 0};
+  return &running;
+}
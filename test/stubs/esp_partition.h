@@ -0,0 +1,15 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+using esp_err_t = int;
+constexpr esp_err_t ESP_OK = 0;
+constexpr esp_err_t ESP_FAIL = -1;
+
+struct esp_partition_t {
+  uint32_t address;
+  uint32_t size;
+};
+
+// No running image on the host, delta updates find no base to patch
+inline esp_err_t esp_partition_read(const esp_partition_t*, size_t, void*, size_t) { return ESP_FAIL; }
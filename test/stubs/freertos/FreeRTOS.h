@@ -0,0 +1,14 @@
+#pragma once
+// The tests run single threaded as far as the code under test is concerned, mutexes are never contended
+
+#include <cstdint>
+
+using SemaphoreHandle_t = void*;
+using TickType_t = uint32_t;
+constexpr TickType_t portMAX_DELAY = 0xFFFFFFFF;
+constexpr int pdTRUE = 1;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return reinterpret_cast<SemaphoreHandle_t>(1); }
+inline int xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline int xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+inline void vSemaphoreDelete(SemaphoreHandle_t) {}
@@ -0,0 +1,18 @@
+#pragma once
+// The mbedtls 2.x SHA-256 calls the firmware makes, implemented on the host
+
+#include <cstddef>
+#include <cstdint>
+
+struct mbedtls_sha256_context {
+  uint32_t state[8];
+  uint64_t length;
+  uint8_t block[64];
+  size_t used;
+};
+
+void mbedtls_sha256_init(mbedtls_sha256_context* context);
+void mbedtls_sha256_free(mbedtls_sha256_context* context);
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context* context, int is224);
+int mbedtls_sha256_update_ret(mbedtls_sha256_context* context, const unsigned char* input, size_t length);
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context* context, unsigned char output[32]);
@@ -0,0 +1,115 @@
+// Splitting chapter text into words with WordTokenizer against the byte at a time loop it replaced. The text is the
+// prose in the repository's documentation, or the files given on the command line (e.g. chapters unzipped from an
+// EPUB); tags are dropped first, as the parser only sees what expat hands over between them.
+//
+//   word_tokenizer_bench [chapter.xhtml ...]
+
+#include <WordTokenizer.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../common/TextFile.h"
+
+namespace {
+struct Counts {
+  size_t words = 0;
+  size_t wordBytes = 0;
+  size_t ampersandWords = 0;
+  bool operator==(const Counts& other) const {
+    return words == other.words && wordBytes == other.wordBytes && ampersandWords == other.ampersandWords;
+  }
+};
+
+// The loop the character data handler ran before WordTokenizer
+Counts tokenizeBytewise(const char* s, const size_t length) {
+  Counts counts;
+  size_t i = 0;
+  while (i < length) {
+    if (static_cast<uint8_t>(s[i]) <= 0x20) {
+      i++;
+      continue;
+    }
+    const size_t start = i;
+    bool hasAmpersand = false;
+    while (i < length && static_cast<uint8_t>(s[i]) > 0x20) {
+      hasAmpersand |= s[i] == '&';
+      i++;
+    }
+    counts.words++;
+    counts.wordBytes += i - start;
+    counts.ampersandWords += hasAmpersand;
+  }
+  return counts;
+}
+
+Counts tokenizeWide(const char* s, const size_t length) {
+  Counts counts;
+  size_t i = 0;
+  while (i < length) {
+    const size_t spaces = WordTokenizer::whitespaceLength(s + i, length - i);
+    if (spaces > 0) {
+      i += spaces;
+      continue;
+    }
+    bool hasAmpersand = false;
+    const size_t wordLen = WordTokenizer::wordLength(s + i, length - i, hasAmpersand);
+    counts.words++;
+    counts.wordBytes += wordLen;
+    counts.ampersandWords += hasAmpersand;
+    i += wordLen;
+  }
+  return counts;
+}
+
+template <typename Fn>
+double megabytesPerSecond(const std::string& text, Counts& counts, Fn tokenize) {
+  double best = 0;
+  for (int run = 0; run < 7; run++) {
+    const auto start = std::chrono::steady_clock::now();
+    int iterations = 0;
+    double seconds;
+    do {
+      // Expat hands text over in pieces of up to its buffer size, the parser sees the same
+      for (size_t offset = 0; offset < text.size(); offset += 1024) {
+        const Counts piece = tokenize(text.data() + offset, std::min<size_t>(1024, text.size() - offset));
+        if (iterations == 0 && run == 0) {
+          counts.words += piece.words;
+          counts.wordBytes += piece.wordBytes;
+          counts.ampersandWords += piece.ampersandWords;
+        }
+      }
+      iterations++;
+      seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (seconds < 0.1);
+    best = std::max(best, text.size() * iterations / seconds / 1e6);
+  }
+  return best;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  std::string text;
+  for (int i = 1; i < argc; i++) {
+    text += text_file::read(argv[i]);
+    text += '\n';
+  }
+  if (text.empty()) {
+    text = text_file::readDocs();
+  }
+
+  Counts bytewiseCounts;
+  Counts wideCounts;
+  const double bytewise = megabytesPerSecond(text, bytewiseCounts, tokenizeBytewise);
+  const double wide = megabytesPerSecond(text, wideCounts, tokenizeWide);
+  printf("%zu bytes of text, %zu words (%zu bytes, %zu with '&')\n", text.size(), wideCounts.words,
+         wideCounts.wordBytes, wideCounts.ampersandWords);
+  printf("byte-wise      %8.1f MB/s\n", bytewise);
+  printf("WordTokenizer  %8.1f MB/s  (%.2fx)\n", wide, wide / bytewise);
+  if (!(bytewiseCounts == wideCounts)) {
+    fprintf(stderr, "Word counts differ: byte-wise found %zu words\n", bytewiseCounts.words);
+    return 1;
+  }
+  return 0;
+}
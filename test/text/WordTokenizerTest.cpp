@@ -0,0 +1,109 @@
+// WordTokenizer's four-bytes-at-a-time masks against the byte-wise definitions they stand for: every byte <= 0x20 is
+// whitespace and a word also stops at '&'. Only the lowest flagged byte of a mask is used, so that is what must match.
+
+#include <WordTokenizer.h>
+
+#include <random>
+#include <string>
+
+#include "../common/Check.h"
+
+namespace {
+bool isDelimiter(const uint8_t c) { return c <= 0x20 || c == '&'; }
+
+// Index of the first byte of word (little endian) matching, 4 if none
+template <typename Predicate>
+size_t firstMatching(const uint32_t word, Predicate predicate) {
+  for (size_t i = 0; i < 4; i++) {
+    if (predicate(static_cast<uint8_t>(word >> (i * 8)))) {
+      return i;
+    }
+  }
+  return 4;
+}
+
+size_t firstFlaggedOr4(const uint32_t mask) { return mask ? WordTokenizer::firstFlagged(mask) : 4; }
+
+bool checkWord(const uint32_t word) {
+  const bool delimiterOk = firstFlaggedOr4(WordTokenizer::delimiterMask(word)) == firstMatching(word, isDelimiter);
+  const bool nonWhitespaceOk = firstFlaggedOr4(WordTokenizer::nonWhitespaceMask(word)) ==
+                               firstMatching(word, [](const uint8_t c) { return c > 0x20; });
+  if (!delimiterOk || !nonWhitespaceOk) {
+    fprintf(stderr, "  mask mismatch for 0x%08x\n", word);
+  }
+  return delimiterOk && nonWhitespaceOk;
+}
+
+// Every value of the two low bytes under high bytes around the boundaries, then random words
+void testMasks() {
+  static constexpr uint8_t EDGES[] = {0x00, 0x01, 0x09, 0x0A, 0x1F, 0x20, 0x21, 0x25, 0x26,
+                                      0x27, 0x41, 0x7E, 0x7F, 0x80, 0x81, 0xA0, 0xC3, 0xFE, 0xFF};
+  int failures = 0;
+  for (const uint8_t b3 : EDGES) {
+    for (const uint8_t b2 : EDGES) {
+      for (uint32_t low = 0; low < 0x10000 && failures < 10; low++) {
+        failures += !checkWord(static_cast<uint32_t>(b3) << 24 | static_cast<uint32_t>(b2) << 16 | low);
+      }
+    }
+  }
+  std::mt19937 random(86);
+  for (int i = 0; i < 20000000 && failures < 10; i++) {
+    failures += !checkWord(random());
+  }
+  CHECK(failures == 0);
+}
+
+size_t referenceWhitespaceLength(const char* s, const size_t len) {
+  size_t i = 0;
+  while (i < len && static_cast<uint8_t>(s[i]) <= 0x20) {
+    i++;
+  }
+  return i;
+}
+
+size_t referenceWordLength(const char* s, const size_t len, bool& hasAmpersand) {
+  size_t i = 0;
+  while (i < len && static_cast<uint8_t>(s[i]) > 0x20) {
+    hasAmpersand |= s[i] == '&';
+    i++;
+  }
+  return i;
+}
+
+// Random text from an alphabet heavy in the bytes the masks treat specially, at every length and alignment
+void testScans() {
+  static constexpr char ALPHABET[] = {' ', ' ', '\t', '\n', '\r', '&', 'a', 'b', '!', '\x7f', '\x80',
+                                      '\xc3', '\xa9', '\xe2', '\x80', '\x94', '\xff', '\x1f', '\x21', ';'};
+  std::mt19937 random(1086);
+  int failures = 0;
+  for (int round = 0; round < 200000 && failures < 10; round++) {
+    std::string text(random() % 40, ' ');
+    for (auto& c : text) {
+      c = ALPHABET[random() % sizeof(ALPHABET)];
+    }
+    // Unaligned starts and a buffer end that isn't a multiple of four
+    const size_t offset = random() % 4;
+    const std::string padded = std::string(offset, 'x') + text;
+    const char* s = padded.data() + offset;
+
+    const size_t whitespace = WordTokenizer::whitespaceLength(s, text.size());
+    bool hasAmpersand = false;
+    bool referenceHasAmpersand = false;
+    const size_t word = WordTokenizer::wordLength(s, text.size(), hasAmpersand);
+    const size_t referenceWord = referenceWordLength(s, text.size(), referenceHasAmpersand);
+    const bool ok = whitespace == referenceWhitespaceLength(s, text.size()) &&
+                    (whitespace > 0 || (word == referenceWord && hasAmpersand == referenceHasAmpersand));
+    if (!ok) {
+      fprintf(stderr, "  scan mismatch on \"%s\"\n", text.c_str());
+      failures++;
+    }
+  }
+  CHECK(failures == 0);
+}
+}  // namespace
+
+int main() {
+  testMasks();
+  testScans();
+  return check::result("word_tokenizer_test");
+}